@@ -653,7 +653,7 @@ void ExampleBase::MainLoop()
         LLGL::FrameProfile frameProfile;
         debuggerObj_->FlushProfile(&frameProfile);
 
-        if (showTimeRecords_)
+        if (showTimeRecords_ && !frameProfile.timeRecords.empty())
         {
             LLGL::Log::Printf(
                 "\n"
@@ -671,7 +671,7 @@ void ExampleBase::MainLoop()
             WriteFrameProfileToJsonFile(frameProfile, frameProfileFilename);
             LLGL::Log::Printf("Saved frame profile to file: %s\n", frameProfileFilename);
         }
-        else if (input.KeyDown(LLGL::Key::F1))
+        else if (!showTimeRecords_ && input.KeyDown(LLGL::Key::F1))
         {
             debuggerObj_->SetTimeRecording(true);
             showTimeRecords_ = true;
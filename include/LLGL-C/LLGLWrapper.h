@@ -912,6 +912,12 @@ typedef enum LLGLBarrierFlags
 }
 LLGLBarrierFlags;
 
+typedef enum LLGLBindingFlags
+{
+    LLGLBindingDescriptorIndexing = (1 << 0),
+}
+LLGLBindingFlags;
+
 typedef enum LLGLColorMaskFlags
 {
     LLGLColorMaskZero = 0,
@@ -1206,6 +1212,65 @@ typedef struct LLGLProfileCommandBufferRecord
 }
 LLGLProfileCommandBufferRecord;
 
+typedef struct LLGLProfileTextureViewPoolRecord
+{
+    uint32_t textureViewCreations;  /* = 0 */
+    uint32_t textureViewReuses;     /* = 0 */
+    uint32_t textureViewEvictions;  /* = 0 */
+    uint32_t numTextureViews;       /* = 0 */
+    uint32_t numCachedTextureViews; /* = 0 */
+}
+LLGLProfileTextureViewPoolRecord;
+
+typedef struct LLGLProfileRenderPassCacheRecord
+{
+    uint32_t renderPassCreations;  /* = 0 */
+    uint32_t renderPassReuses;     /* = 0 */
+    uint32_t framebufferCreations; /* = 0 */
+    uint32_t framebufferReuses;    /* = 0 */
+    uint32_t framebufferEvictions; /* = 0 */
+    uint32_t numRenderPasses;      /* = 0 */
+    uint32_t numFramebuffers;      /* = 0 */
+}
+LLGLProfileRenderPassCacheRecord;
+
+typedef struct LLGLProfileGraphicsPipelineRecord
+{
+    uint32_t pipelineCreations; /* = 0 */
+    uint32_t pipelineLinks;     /* = 0 */
+    uint32_t libraryCreations;  /* = 0 */
+    uint32_t libraryReuses;     /* = 0 */
+    uint32_t numLibraries;      /* = 0 */
+    uint32_t creationTime;      /* = 0 */
+}
+LLGLProfileGraphicsPipelineRecord;
+
+typedef struct LLGLProfileDeviceMemoryRecord
+{
+    uint64_t numChunks;       /* = 0 */
+    uint64_t numEmptyChunks;  /* = 0 */
+    uint64_t numBlocks;       /* = 0 */
+    uint64_t numFragments;    /* = 0 */
+    uint64_t allocatedSize;   /* = 0 */
+    uint64_t usedSize;        /* = 0 */
+    uint64_t maxFragmentSize; /* = 0 */
+    uint64_t budget;          /* = 0 */
+    uint64_t usage;           /* = 0 */
+    uint64_t chunkReleases;   /* = 0 */
+    uint64_t relocations;     /* = 0 */
+    uint64_t relocatedSize;   /* = 0 */
+}
+LLGLProfileDeviceMemoryRecord;
+
+typedef struct LLGLProfileNativeCallRecord
+{
+    const char* function;
+    const char* command;
+    uint32_t    calls;       /* = 0 */
+    uint64_t    elapsedTime; /* = 0 */
+}
+LLGLProfileNativeCallRecord;
+
 typedef struct LLGLRendererInfo
 {
     const char*        rendererName;
@@ -1249,6 +1314,8 @@ typedef struct LLGLRenderingFeatures
     bool hasPipelineCaching;           /* = false */
     bool hasPipelineStatistics;        /* = false */
     bool hasRenderCondition;           /* = false */
+    bool hasDescriptorIndexing;        /* = false */
+    bool hasPlacedResources;           /* = false */
 }
 LLGLRenderingFeatures;
 
@@ -1279,6 +1346,7 @@ typedef struct LLGLRenderingLimits
     uint32_t maxStencilBufferSamples;          /* = 0 */
     uint32_t maxNoAttachmentSamples;           /* = 0 */
     long     storageResourceStageFlags;        /* = 0 */
+    uint32_t maxDescriptorIndexingArraySize;   /* = 0 */
 }
 LLGLRenderingLimits;
 
@@ -1419,6 +1487,7 @@ typedef struct LLGLBindingDescriptor
     long             stageFlags; /* = 0 */
     LLGLBindingSlot  slot;
     uint32_t         arraySize;  /* = 0 */
+    long             flags;      /* = 0 */
 }
 LLGLBindingDescriptor;
 
@@ -1507,10 +1576,16 @@ LLGLQueryHeapDescriptor;
 
 typedef struct LLGLFrameProfile
 {
-    LLGLProfileCommandQueueRecord  commandQueueRecord;
-    LLGLProfileCommandBufferRecord commandBufferRecord;
-    size_t                         numTimeRecords;      /* = 0 */
-    const LLGLProfileTimeRecord*   timeRecords;         /* = NULL */
+    LLGLProfileCommandQueueRecord      commandQueueRecord;
+    LLGLProfileCommandBufferRecord     commandBufferRecord;
+    LLGLProfileTextureViewPoolRecord   textureViewPoolRecord;
+    LLGLProfileRenderPassCacheRecord   renderPassCacheRecord;
+    LLGLProfileGraphicsPipelineRecord  graphicsPipelineRecord;
+    LLGLProfileDeviceMemoryRecord      deviceMemoryRecord;
+    size_t                             numNativeCallRecords;   /* = 0 */
+    const LLGLProfileNativeCallRecord* nativeCallRecords;      /* = NULL */
+    size_t                             numTimeRecords;         /* = 0 */
+    const LLGLProfileTimeRecord*       timeRecords;            /* = NULL */
 }
 LLGLFrameProfile;
 
@@ -1588,15 +1663,17 @@ LLGLComputeShaderAttributes;
 
 typedef struct LLGLSwapChainDescriptor
 {
-    const char*  debugName;   /* = NULL */
+    const char*  debugName;      /* = NULL */
     LLGLExtent2D resolution;
-    int          colorBits;   /* = 32 */
-    int          depthBits;   /* = 24 */
-    int          stencilBits; /* = 8 */
-    uint32_t     samples;     /* = 1 */
-    uint32_t     swapBuffers; /* = 2 */
-    bool         fullscreen;  /* = false */
-    bool         resizable;   /* = false */
+    int          colorBits;      /* = 32 */
+    int          depthBits;      /* = 24 */
+    int          stencilBits;    /* = 8 */
+    uint32_t     samples;        /* = 1 */
+    uint32_t     swapBuffers;    /* = 2 */
+    bool         fullscreen;     /* = false */
+    bool         resizable;      /* = false */
+    uint32_t     framesInFlight; /* = 0 */
+    bool         lowLatency;     /* = false */
 }
 LLGLSwapChainDescriptor;
 
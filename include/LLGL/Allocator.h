@@ -0,0 +1,194 @@
+/*
+ * Allocator.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_ALLOCATOR_H
+#define LLGL_ALLOCATOR_H
+
+
+#include <LLGL/Export.h>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/* ----- Enumerations ----- */
+
+/**
+\brief Allocation category enumeration.
+\remarks Each memory allocation that is routed through an Allocator is tagged with one of these categories.
+\see Allocator::Allocate
+\see GetAllocationUsage
+*/
+enum class AllocationCategory
+{
+    /**
+    \brief Memory for render system child objects, e.g. Buffer, Texture, and PipelineState instances.
+    \remarks This only refers to the memory of the objects themselves but not to any memory these objects allocate internally.
+    */
+    Object,
+
+    //! Memory chunks of command buffers that record their commands in software, e.g. OpenGL and Null backends.
+    CommandBuffer,
+
+    /**
+    \brief Temporary memory that is released before the function that allocated it returns, e.g. intermediate buffers for data conversion.
+    \remarks No allocation of this category outlives the frame it was allocated in.
+    \see FrameArenaAllocator
+    */
+    Transient,
+
+    //! Internal memory of the backends, e.g. the containers that hold the render system child objects.
+    Internal,
+
+    /**
+    \brief Host memory that the native graphics API allocates on behalf of LLGL.
+    \remarks This is only used by backends whose native API supports custom host allocators, e.g. \c VkAllocationCallbacks for Vulkan.
+    */
+    Native,
+};
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Memory usage of a single allocation category.
+\see GetAllocationUsage
+*/
+struct AllocationUsage
+{
+    //! Number of bytes that are currently allocated.
+    std::uint64_t currentSize       = 0;
+
+    //! Maximum number of bytes that were allocated at the same time.
+    std::uint64_t peakSize          = 0;
+
+    //! Number of allocations that have not been freed yet.
+    std::uint64_t numAllocations    = 0;
+
+    //! Total number of allocations since the program started.
+    std::uint64_t totalAllocations  = 0;
+};
+
+
+/* ----- Classes ----- */
+
+/**
+\brief Memory allocator interface for the internal allocations of LLGL.
+\remarks An instance of this interface can be passed to RenderSystem::Load via RenderSystemDescriptor::allocator.
+It is used for all memory allocations of the categories listed in AllocationCategory as long as any render system that was loaded with this allocator is alive.
+All render systems that are alive at the same time must use the same allocator.
+\remarks The functions of this interface can be called from multiple threads simultaneously, e.g. when command buffers are encoded in parallel.
+\see RenderSystemDescriptor::allocator
+*/
+class LLGL_EXPORT Allocator
+{
+
+    public:
+
+        virtual ~Allocator() = default;
+
+        /**
+        \brief Allocates a new block of memory.
+        \param[in] size Specifies the size (in bytes) of the memory block. This is always greater than zero.
+        \param[in] alignment Specifies the alignment (in bytes) of the memory block. This is always a power of two.
+        \param[in] category Specifies the category of this allocation.
+        \return Pointer to the new memory block or null if the allocation failed.
+        */
+        virtual void* Allocate(std::size_t size, std::size_t alignment, AllocationCategory category) = 0;
+
+        /**
+        \brief Frees a memory block that was allocated by this allocator.
+        \param[in] ptr Specifies the memory block. This is never null.
+        \param[in] size Specifies the size (in bytes) the memory block was allocated with.
+        \param[in] alignment Specifies the alignment (in bytes) the memory block was allocated with.
+        \param[in] category Specifies the category the memory block was allocated with.
+        */
+        virtual void Free(void* ptr, std::size_t size, std::size_t alignment, AllocationCategory category) = 0;
+
+        /**
+        \brief Changes the size of a memory block that was allocated by this allocator.
+        \param[in] ptr Specifies the memory block. This is never null.
+        \param[in] oldSize Specifies the size (in bytes) the memory block was allocated with.
+        \param[in] newSize Specifies the new size (in bytes) of the memory block. This is always greater than zero.
+        \param[in] alignment Specifies the alignment (in bytes) the memory block was allocated with. The alignment does not change.
+        \param[in] category Specifies the category the memory block was allocated with. The category does not change.
+        \return Pointer to the resized memory block or null if the reallocation failed, in which case the input memory block remains valid.
+        \remarks The content of the memory block is preserved up to the lesser of the old and new sizes.
+        The default implementation allocates a new memory block, copies the content, and frees the old memory block.
+        */
+        virtual void* Reallocate(void* ptr, std::size_t oldSize, std::size_t newSize, std::size_t alignment, AllocationCategory category);
+
+};
+
+/**
+\brief Allocator that serves transient allocations and recorded command data from linear memory arenas.
+\remarks Allocations of the categories AllocationCategory::Transient and AllocationCategory::CommandBuffer are taken from one arena per category,
+i.e. from a list of memory blocks by incrementing an offset. Freeing the most recent allocation of an arena rewinds its offset.
+Memory that is freed out of order is kept in a free list of the arena and reused by later allocations before the arena grows.
+The arena is reset as soon as all of its allocations have been freed. The memory blocks themselves are kept for the next frame.
+Transient allocations are freed at the latest at the end of each frame.
+Command buffers keep their memory chunks for re-encoding until they are released, so the command buffer arena grows with the largest set of command buffers that are alive at the same time.
+All other allocations are forwarded to the upstream allocator.
+*/
+class LLGL_EXPORT FrameArenaAllocator : public Allocator
+{
+
+    public:
+
+        /**
+        \brief Initializes the frame arena.
+        \param[in] blockSize Specifies the minimum size (in bytes) of each memory block of the arenas. By default 1 MB.
+        \param[in] upstream Optional pointer to an allocator that the memory blocks of the arenas and all other allocations are taken from.
+        If this is null, the default heap allocation of LLGL is used. By default null.
+        */
+        FrameArenaAllocator(std::size_t blockSize = 1024*1024, Allocator* upstream = nullptr);
+
+        FrameArenaAllocator(const FrameArenaAllocator&) = delete;
+        FrameArenaAllocator& operator = (const FrameArenaAllocator&) = delete;
+
+        //! Releases all memory blocks of the arenas.
+        ~FrameArenaAllocator();
+
+        void* Allocate(std::size_t size, std::size_t alignment, AllocationCategory category) override;
+        void Free(void* ptr, std::size_t size, std::size_t alignment, AllocationCategory category) override;
+        void* Reallocate(void* ptr, std::size_t oldSize, std::size_t newSize, std::size_t alignment, AllocationCategory category) override;
+
+        /**
+        \brief Returns the number of bytes that are reserved by the memory blocks of the arena for the specified category.
+        \return Capacity of the arena for AllocationCategory::Transient or AllocationCategory::CommandBuffer, or zero for all other categories.
+        */
+        std::size_t GetCapacity(const AllocationCategory category = AllocationCategory::Transient) const;
+
+    private:
+
+        struct Pimpl;
+        Pimpl* pimpl_;
+
+};
+
+
+/* ----- Functions ----- */
+
+/**
+\brief Returns the memory usage of the specified allocation category.
+\remarks The usage is recorded for all allocations that are routed through an Allocator, including the default heap allocation of LLGL.
+\see AllocationCategory
+*/
+LLGL_EXPORT AllocationUsage GetAllocationUsage(const AllocationCategory category);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -24,6 +24,11 @@ virtual void ResourceBarrier(
     LLGL::Texture* const *      textures
 ) override final;
 
+virtual void AliasingBarrier(
+    LLGL::Resource*             resourceBefore,
+    LLGL::Resource*             resourceAfter
+) override final;
+
 
 
 // ================================================================================
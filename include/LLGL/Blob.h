@@ -108,6 +108,23 @@ class LLGL_EXPORT Blob : public NonCopyable
         */
         static Blob CreateFromFile(const std::string& filename);
 
+        /**
+        \brief Creates a new Blob instance that refers to a read-only memory mapping of the specified binary file.
+        \param[in] filename Specifies the file that is to be mapped into memory.
+        \return New instance of Blob that manages the memory mapping of the specified file or null if the file could not be read.
+        \remarks In contrast to CreateFromFile, the file content is not copied into a separate buffer but paged in on demand.
+        This is the preferred way to load large binary assets such as DDS or KTX2 image containers.
+        If memory mapped files are not supported on the host platform, this falls back to CreateFromFile.
+        \see CreateFromFile
+        */
+        static Blob CreateFromMappedFile(const char* filename);
+
+        /**
+        \brief Creates a new Blob instance that refers to a read-only memory mapping of the specified binary file.
+        \see CreateFromMappedFile(const char*)
+        */
+        static Blob CreateFromMappedFile(const std::string& filename);
+
     public:
 
         //! Returns a constant pointer to the internal buffer or null if this is a default initialized blob.
@@ -516,6 +516,23 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
             Texture* const *    textures
         ) = 0;
 
+        /**
+        \brief Inserts an aliasing barrier between two resources that have been placed at overlapping offsets inside the same memory heap.
+
+        \param[in] resourceBefore Optional pointer to the placed resource that was in use before. If this is null, any placed resource may have been in use before.
+        \param[in] resourceAfter Optional pointer to the placed resource that is going to be used next. If this is null, any placed resource may be used next.
+        Each resource that is non-null must be either a Buffer or Texture that was created with RenderSystem::CreatePlacedBuffer or RenderSystem::CreatePlacedTexture.
+
+        \remarks All previous accesses to the memory of \c resourceBefore are completed before \c resourceAfter is accessed.
+        The content of \c resourceAfter is undefined after this barrier, so render targets must be cleared and buffers must be written before they are read.
+        \remarks This must not be called inside a render pass.
+
+        \see RenderSystem::CreateMemoryHeap
+        \see RenderingFeatures::hasPlacedResources
+        \note Only supported with: Vulkan. Backends without placed resources ignore this command.
+        */
+        virtual void AliasingBarrier(Resource* resourceBefore, Resource* resourceAfter) = 0;
+
         /* ----- Render Passes ----- */
 
         /**
@@ -285,6 +285,8 @@ struct CommandBufferDescriptor
     The benefit of having multiple native command buffers is that it reduces the time the GPU is idle
     because it waits for a command buffer to be completed before it can be reused.
     For command buffers that are only recorded once and submitted multiple times, it makes sense to allocate only a single native command buffer.
+    \remarks If this is 0, the Vulkan backend allocates additional native command buffers on demand (up to an implementation defined limit)
+    instead of waiting for the GPU when CommandBuffer::Begin is called while the next native command buffer is still in flight.
     \see CommandBuffer::Begin
     */
     std::uint32_t       numNativeBuffers    = 0;
@@ -21,6 +21,7 @@ class CommandBufferTier1;
 class CommandQueue;
 class Fence;
 class Image;
+class MemoryHeap;
 class PipelineLayout;
 class PipelineState;
 class QueryHeap;
@@ -61,6 +62,8 @@ struct Extent3D;
 struct FragmentAttribute;
 struct GraphicsPipelineDescriptor;
 struct ImageView;
+struct MemoryHeapDescriptor;
+struct MemoryRequirements;
 struct MeshPipelineDescriptor;
 struct MutableImageView;
 struct PipelineLayoutDescriptor;
@@ -24,6 +24,28 @@ namespace LLGL
 {
 
 
+/* ----- Enumerations ----- */
+
+/**
+\brief Image compression quality enumeration.
+\see CompressImageBuffer
+*/
+enum class ImageCompressionQuality
+{
+    /**
+    \brief Range fit: the endpoints of each block are the extremes of its colors projected onto their principal axis.
+    \remarks This is the fastest encoding mode and suited for images that are generated every frame.
+    */
+    Fast,
+
+    /**
+    \brief Cluster fit: every ordered partition of the block's colors along their principal axis is evaluated with a least squares fit of the endpoints.
+    \remarks This is several times slower than ImageCompressionQuality::Fast but significantly reduces the error for blocks with more than two distinct colors.
+    */
+    High,
+};
+
+
 /* ----- Structures ----- */
     
 /**
@@ -239,6 +261,57 @@ LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
     unsigned            threadCount = 0
 );
 
+/**
+\brief Decompresses the specified image buffer into the destination image view in RGBA format with 8-bit unsigned normalized integers.
+\param[in] compressedFormat Specifies the compression format of the source image. The following formats are supported:
+- Format::BC1UNorm, Format::BC1UNorm_sRGB, Format::BC3UNorm, Format::BC3UNorm_sRGB, Format::BC4UNorm, Format::BC5UNorm:
+The image extent must be a multiple of 4.
+- Format::ETC1UNorm, Format::ETC2UNorm, Format::ETC2UNorm_sRGB: Alpha is always one.
+- All ASTC formats: Decoded with the LDR profile. Blocks that are illegal in the LDR profile (e.g. HDR endpoint modes) are decoded to the error color magenta.
+\param[in] srcImageView Specifies the source image view.
+\param[out] dstImageView Specifies the destination image view. This must have format ImageFormat::RGBA and data type DataType::UInt8
+and its size must be at least <code>extent.width * extent.height * 4</code> bytes.
+\param[in] extent Specifies the image extent. For ETC and ASTC formats, this does not have to be a multiple of the block size.
+\param[in] threadCount Specifies the number of threads to use for decompression. Work is distributed in rows of blocks.
+\return True if the image has been decompressed. False if the compression format is not supported or the source image is too small.
+\remarks Color components of sRGB formats are returned in non-linear sRGB color space, i.e. no color space conversion is performed.
+\see DecompressImageBufferToRGBA8UNorm(Format, const ImageView&, const Extent2D&, unsigned)
+*/
+LLGL_EXPORT bool DecompressImageBufferToRGBA8UNorm(
+    Format                  compressedFormat,
+    const ImageView&        srcImageView,
+    const MutableImageView& dstImageView,
+    const Extent2D&         extent,
+    unsigned                threadCount = 0
+);
+
+/**
+\brief Compresses the specified image buffer into a block compressed format.
+\param[in] compressedFormat Specifies the destination compression format. This must be one of the following formats:
+- Format::BC1UNorm, Format::BC1UNorm_sRGB: Pixels with an alpha value less than 128 are encoded as transparent black.
+- Format::BC3UNorm, Format::BC3UNorm_sRGB
+- Format::BC4UNorm: Only the red component is encoded.
+- Format::BC5UNorm: Only the red and green components are encoded.
+\param[in] srcImageView Specifies the source image view. This must be an uncompressed color format.
+If this is not ImageFormat::RGBA with DataType::UInt8, the image is converted to that format first.
+\param[in] extent Specifies the image extent. This does not have to be a multiple of the block size; partial blocks are padded by clamping to the image border.
+\param[in] quality Specifies the compression quality. By default ImageCompressionQuality::Fast.
+\param[in] threadCount Specifies the number of threads to use for compression. Work is distributed in rows of blocks.
+If this is less than 2, no multi-threading is used. If this is equal to \c LLGL_MAX_THREAD_COUNT,
+the number of threads will be determined by the workload and the available CPU cores the system supports (e.g. 4 on a quad-core processor).
+Note that this does not guarantee the maximum number of threads the system supports if the workload does not demand it. By default 0.
+\return Byte buffer with the compressed blocks in row-major order or null if the compression format is not supported for compression.
+\remarks Color components are encoded as they are, i.e. no color space conversion is performed for sRGB formats.
+\see DecompressImageBufferToRGBA8UNorm
+*/
+LLGL_EXPORT DynamicByteArray CompressImageBuffer(
+    Format                  compressedFormat,
+    const ImageView&        srcImageView,
+    const Extent2D&         extent,
+    ImageCompressionQuality quality     = ImageCompressionQuality::Fast,
+    unsigned                threadCount = 0
+);
+
 /**
 \brief Copies an image buffer region from the source buffer to the destination buffer.
 \param[out] dstImageView Specifies the destination image view.
@@ -41,6 +41,7 @@ struct InterfaceID
         CommandBufferTier1,     //!< Extends CommandBuffer. \see CommandBufferTier1
         CommandQueue,           //!< Extends RenderSystemChild. \see CommandQueue
         Fence,                  //!< Extends RenderSystemChild. \see Fence
+        MemoryHeap,             //!< Extends RenderSystemChild. \see MemoryHeap
         PipelineCache,          //!< Extends RenderSystemChild. \see PipelineCache
         PipelineLayout,         //!< Extends RenderSystemChild. \see PipelineLayout
         PipelineState,          //!< Extends RenderSystemChild. \see PipelineState
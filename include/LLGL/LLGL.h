@@ -16,6 +16,8 @@
 #include <LLGL/Timer.h>
 #include <LLGL/TypeInfo.h>
 #include <LLGL/RenderSystem.h>
+#include <LLGL/StaticCommandBuffer.h>
+#include <LLGL/Allocator.h>
 #include <LLGL/Log.h>
 #include <LLGL/IndirectArguments.h>
 #include <LLGL/ImageFlags.h>
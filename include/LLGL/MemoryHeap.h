@@ -0,0 +1,61 @@
+/*
+ * MemoryHeap.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MEMORY_HEAP_H
+#define LLGL_MEMORY_HEAP_H
+
+
+#include <LLGL/RenderSystemChild.h>
+#include <LLGL/MemoryHeapFlags.h>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Memory heap interface that holds a single block of device memory in which textures and buffers can be placed at explicit offsets.
+\remarks Resources whose lifetimes within a frame never overlap, such as transient render targets, can be placed at overlapping offsets to share the same memory.
+Before a placed resource is used after another resource that overlaps its memory, CommandBuffer::AliasingBarrier must be recorded.
+The content of a placed resource is undefined after an aliasing barrier activated it.
+\see RenderSystem::CreateMemoryHeap
+\see RenderSystem::CreatePlacedTexture
+\see RenderSystem::CreatePlacedBuffer
+\see CommandBuffer::AliasingBarrier
+*/
+class LLGL_EXPORT MemoryHeap : public RenderSystemChild
+{
+
+        LLGL_DECLARE_INTERFACE( InterfaceID::MemoryHeap );
+
+    public:
+
+        //! Returns the size (in bytes) of this memory heap.
+        inline std::uint64_t GetSize() const
+        {
+            return size_;
+        }
+
+    protected:
+
+        MemoryHeap(std::uint64_t size);
+
+    private:
+
+        std::uint64_t size_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
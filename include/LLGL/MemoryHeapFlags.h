@@ -0,0 +1,97 @@
+/*
+ * MemoryHeapFlags.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MEMORY_HEAP_FLAGS_H
+#define LLGL_MEMORY_HEAP_FLAGS_H
+
+
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/* ----- Flags ----- */
+
+/**
+\brief Memory heap resource flags enumeration.
+\remarks Some native APIs can only place certain kinds of resources into the same memory,
+so a memory heap must know up front which kinds of resources will be placed in it.
+\see MemoryHeapDescriptor::resources
+*/
+struct MemoryHeapResourceFlags
+{
+    enum
+    {
+        //! Buffers can be placed in the memory heap.
+        Buffers             = (1 << 0),
+
+        //! Textures without BindFlags::ColorAttachment and BindFlags::DepthStencilAttachment can be placed in the memory heap.
+        Textures            = (1 << 1),
+
+        //! Textures with BindFlags::ColorAttachment or BindFlags::DepthStencilAttachment can be placed in the memory heap.
+        AttachmentTextures  = (1 << 2),
+
+        //! All kinds of resources can be placed in the memory heap.
+        All                 = (Buffers | Textures | AttachmentTextures),
+    };
+};
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Memory heap descriptor structure.
+\see RenderSystem::CreateMemoryHeap
+*/
+struct MemoryHeapDescriptor
+{
+    /**
+    \brief Optional name for debugging purposes. By default null.
+    \remarks The final name of the native hardware resource is implementation defined.
+    \see RenderSystemChild::SetName
+    */
+    const char*     debugName   = nullptr;
+
+    //! Specifies the size (in bytes) of the memory heap. This must be greater than zero. By default 0.
+    std::uint64_t   size        = 0;
+
+    /**
+    \brief Specifies which kinds of resources can be placed in the memory heap. This can be a bitwise OR combination of MemoryHeapResourceFlags entries.
+    \remarks The memory type of the heap is selected such that it supports all of the specified kinds of resources.
+    Restricting this to fewer kinds of resources may allow the backend to select a better suited memory type.
+    This must not be zero. By default MemoryHeapResourceFlags::All.
+    \see MemoryHeapResourceFlags
+    \see RenderSystem::CreatePlacedBuffer
+    \see RenderSystem::CreatePlacedTexture
+    */
+    long            resources   = MemoryHeapResourceFlags::All;
+};
+
+/**
+\brief Memory requirements of a resource that is to be placed inside a memory heap.
+\see RenderSystem::GetMemoryRequirements
+*/
+struct MemoryRequirements
+{
+    //! Size (in bytes) the resource occupies inside a memory heap.
+    std::uint64_t   size        = 0;
+
+    //! Alignment (in bytes) of the offset at which the resource can be placed inside a memory heap. This is always a power of two.
+    std::uint64_t   alignment   = 0;
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
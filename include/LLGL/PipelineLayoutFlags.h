@@ -60,6 +60,32 @@ struct BarrierFlags
     };
 };
 
+/**
+\brief Flags for individual binding descriptors of pipeline layouts.
+\see BindingDescriptor::flags
+*/
+struct BindingFlags
+{
+    enum
+    {
+        /**
+        \brief Specifies a descriptor-indexed resource array (aka. "bindless" resources) for a heap binding.
+        \remarks The array is addressed with a dynamic index in the shader, e.g. <code>Texture2D materialTextures[] : register(t0)</code> in HLSL
+        or <code>layout(binding = 0) uniform texture2D materialTextures[];</code> in GLSL. The number of elements is specified by BindingDescriptor::arraySize.
+        \remarks Elements of such an array do not have to be written before the ResourceHeap is bound (i.e. the array can be partially bound),
+        as long as shaders don't access unwritten elements.
+        Elements can be written with RenderSystem::WriteResourceHeap while the ResourceHeap is used by command buffers in flight,
+        as long as those command buffers don't access the same elements (i.e. <b>update-after-bind</b>).
+        This allows to switch materials by changing an index (e.g. via CommandBuffer::SetUniforms) instead of binding another ResourceHeap.
+        \remarks Backends that don't support this flag treat such a binding as a regular array of descriptors.
+        \note Only supported with: Vulkan (via \c VK_EXT_descriptor_indexing), Null.
+        \see RenderingFeatures::hasDescriptorIndexing
+        \see RenderingLimits::maxDescriptorIndexingArraySize
+        */
+        DescriptorIndexing  = (1 << 0),
+    };
+};
+
 
 /* ----- Enumerations ----- */
 
@@ -250,6 +276,13 @@ struct BindingDescriptor
     \see PipelineLayoutDescriptor::heapBindings
     */
     std::uint32_t   arraySize   = 0;
+
+    /**
+    \brief Specifies optional binding flags. This can be a bitwise-OR combination of BindingFlags entries. By default 0.
+    \remarks BindingFlags::DescriptorIndexing can only be used for heap bindings with a non-zero \c arraySize.
+    \see BindingFlags
+    */
+    long            flags       = 0;
 };
 
 /**
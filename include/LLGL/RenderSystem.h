@@ -20,6 +20,8 @@
 #include <LLGL/Fence.h>
 #include <LLGL/Interface.h>
 #include <LLGL/ImageFlags.h>
+#include <LLGL/MemoryHeap.h>
+#include <LLGL/MemoryHeapFlags.h>
 #include <LLGL/PipelineLayout.h>
 #include <LLGL/PipelineLayoutFlags.h>
 #include <LLGL/PipelineCache.h>
@@ -438,6 +440,70 @@ class LLGL_EXPORT RenderSystem : public Interface
         //! Releases the specified Sampler object. After this call, the specified object must no longer be used.
         virtual void Release(Sampler& sampler) = 0;
 
+        /* ----- Memory Heaps ----- */
+
+        /**
+        \brief Creates a new memory heap in which textures and buffers can be placed at explicit offsets.
+        \return Pointer to the new MemoryHeap object or null if placed resources are not supported.
+        \remarks Use GetMemoryRequirements to determine how large the heap must be and at which offsets resources can be placed.
+        \see RenderingFeatures::hasPlacedResources
+        \see CreatePlacedTexture
+        \see CreatePlacedBuffer
+        */
+        virtual MemoryHeap* CreateMemoryHeap(const MemoryHeapDescriptor& memoryHeapDesc);
+
+        /**
+        \brief Releases the specified MemoryHeap object. After this call, the specified object must no longer be used.
+        \remarks All resources that have been placed inside this heap must be released before the heap is released.
+        Otherwise, the heap is not released and the debug layer reports an error.
+        */
+        virtual void Release(MemoryHeap& memoryHeap);
+
+        /**
+        \brief Determines the memory requirements of a texture that is to be placed inside a memory heap.
+        \param[in] textureDesc Specifies the descriptor of the texture. This must be the same descriptor that is passed to CreatePlacedTexture.
+        \param[out] outRequirements Receives the size and alignment the texture requires inside a memory heap.
+        \return True on success or false if placed resources are not supported.
+        */
+        virtual bool GetMemoryRequirements(const TextureDescriptor& textureDesc, MemoryRequirements& outRequirements);
+
+        /**
+        \brief Determines the memory requirements of a buffer that is to be placed inside a memory heap.
+        \param[in] bufferDesc Specifies the descriptor of the buffer. This must be the same descriptor that is passed to CreatePlacedBuffer.
+        \param[out] outRequirements Receives the size and alignment the buffer requires inside a memory heap.
+        \return True on success or false if placed resources are not supported.
+        */
+        virtual bool GetMemoryRequirements(const BufferDescriptor& bufferDesc, MemoryRequirements& outRequirements);
+
+        /**
+        \brief Creates a new texture at the specified offset inside a memory heap.
+        \param[in] memoryHeap Specifies the memory heap the texture is placed in.
+        \param[in] offset Specifies the offset (in bytes) inside the memory heap. This must be a multiple of MemoryRequirements::alignment
+        and the texture must fit into the heap at this offset, i.e. <code>offset + MemoryRequirements::size</code> must not exceed the heap size.
+        \param[in] textureDesc Specifies the texture descriptor. Placed textures have no initial data, i.e. MiscFlags::NoInitialData is implied.
+        \return Pointer to the new Texture object or null if placed resources are not supported, the placement is invalid,
+        or the memory heap was not created for this kind of texture (see MemoryHeapDescriptor::resources).
+        \remarks Multiple resources can be placed at overlapping offsets as long as only one of them is in use at a time.
+        Placed textures are released with Release(Texture&) like any other texture.
+        \see GetMemoryRequirements(const TextureDescriptor&, MemoryRequirements&)
+        \see CommandBuffer::AliasingBarrier
+        */
+        virtual Texture* CreatePlacedTexture(MemoryHeap& memoryHeap, std::uint64_t offset, const TextureDescriptor& textureDesc);
+
+        /**
+        \brief Creates a new buffer at the specified offset inside a memory heap.
+        \param[in] memoryHeap Specifies the memory heap the buffer is placed in.
+        \param[in] offset Specifies the offset (in bytes) inside the memory heap. This must be a multiple of MemoryRequirements::alignment
+        and the buffer must fit into the heap at this offset, i.e. <code>offset + MemoryRequirements::size</code> must not exceed the heap size.
+        \param[in] bufferDesc Specifies the buffer descriptor. Placed buffers must not have any CPU access flags.
+        \return Pointer to the new Buffer object or null if placed resources are not supported, the placement is invalid,
+        or the memory heap was not created for buffers (see MemoryHeapDescriptor::resources).
+        \remarks Placed buffers are released with Release(Buffer&) like any other buffer.
+        \see GetMemoryRequirements(const BufferDescriptor&, MemoryRequirements&)
+        \see CommandBuffer::AliasingBarrier
+        */
+        virtual Buffer* CreatePlacedBuffer(MemoryHeap& memoryHeap, std::uint64_t offset, const BufferDescriptor& bufferDesc);
+
         /* ----- Resource Heaps ----- */
 
         /**
@@ -479,13 +545,36 @@ class LLGL_EXPORT RenderSystem : public Interface
         To swap out resources during command recording, use CommandBuffer::SetResource with individual bindings or write descriptors to unique sets within the heap.
 
         \return Number of resource views that have been updated by this call. Any resource view descriptor with a \c resource field that is null will be ignored silently.
+        If a batched update is pending for this resource heap, this is the number of resource views that have been recorded.
 
         \see ResourceHeap::GetNumDescriptorSets
         \see PipelineLayout::GetNumHeapBindings
         \see CommandBUffer::SetResourceHeap
+        \see BeginResourceHeapUpdate
         */
         virtual std::uint32_t WriteResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews) = 0;
 
+        /**
+        \brief Begins a batched update of the specified resource heap.
+        \remarks All subsequent calls to WriteResourceHeap for this resource heap are only recorded until CommitResourceHeapUpdate is called.
+        This is more efficient when many scattered descriptors are updated, because the backend can coalesce all writes into contiguous ranges
+        and submit them at once, e.g. the Vulkan backend issues a single \c vkUpdateDescriptorSets call for the entire batch.
+        \remarks Backends without batched updates write each descriptor immediately and this function has no effect.
+        \remarks All resources that are passed to WriteResourceHeap during a batched update must remain valid until CommitResourceHeapUpdate is called,
+        because the backend may only record the resource pointers and resolve them on commit. Releasing such a resource before the commit results in undefined behavior.
+        \see CommitResourceHeapUpdate
+        */
+        virtual void BeginResourceHeapUpdate(ResourceHeap& resourceHeap);
+
+        /**
+        \brief Commits all writes that have been recorded for the specified resource heap since the last call to BeginResourceHeapUpdate.
+        \remarks Multiple writes to the same descriptor are resolved in the order they were recorded, i.e. the last write takes effect.
+        \return Number of descriptors that have been updated by this call. This is 0 for backends without batched updates,
+        since their writes have already been counted by WriteResourceHeap.
+        \see BeginResourceHeapUpdate
+        */
+        virtual std::uint32_t CommitResourceHeapUpdate(ResourceHeap& resourceHeap);
+
         /* ----- Render Passes ----- */
 
         /**
@@ -528,6 +617,56 @@ class LLGL_EXPORT RenderSystem : public Interface
         //! Releases the specified Shader object. After this call, the specified object must no longer be used.
         virtual void Release(Shader& shader) = 0;
 
+        /**
+        \brief Creates multiple Shader objects at once.
+        \param[in] numShaders Specifies the number of shaders to create.
+        \param[in] shaderDescs Pointer to an array of \c numShaders shader descriptors.
+        \param[out] outShaders Pointer to an array of \c numShaders elements that receive the new shaders. Entries of shaders that could not be created are set to null.
+        \return Number of shaders that were created successfully.
+        \remarks Backends with asynchronous shader compilation will submit all shaders before any compile status is queried,
+        e.g. the OpenGL backend defers this query until Shader::GetReport is called to let the driver compile shaders concurrently (see \c GL_KHR_parallel_shader_compile).
+        \see CreateShader
+        */
+        virtual std::uint32_t CreateShaders(std::uint32_t numShaders, const ShaderDescriptor* shaderDescs, Shader** outShaders);
+
+        /**
+        \brief Returns a shared Shader object for the specified shader variant and only creates a new one if no equivalent variant exists yet.
+        \remarks Shader variants are identified by the content of the shader source, the set of macros, entry point, profile, compile flags, and stage attributes.
+        Macros are sorted by name and duplicate names are removed (the last definition takes precedence), so the order of \c ShaderDescriptor::defines does not matter.
+        \remarks Files included by the shader source are not part of the variant key.
+        \remarks Each successful call to this function must be paired with a call to ReleaseShaderVariant.
+        \see ReleaseShaderVariant
+        \see GetShaderVariantCacheStatistics
+        */
+        Shader* CreateShaderVariant(const ShaderDescriptor& shaderDesc);
+
+        /**
+        \brief Decrements the reference counter of the specified shader variant and releases it once it is no longer used.
+        \return True if the shader was created by CreateShaderVariant. Otherwise, the shader is not modified.
+        \see CreateShaderVariant
+        */
+        bool ReleaseShaderVariant(Shader& shader);
+
+        //! Returns the statistics of the shader variant cache.
+        ShaderVariantCacheStatistics GetShaderVariantCacheStatistics() const;
+
+        /**
+        \brief Returns a blob with the compiled binaries of all shader variants that can be stored alongside the pipeline cache.
+        \remarks Only backends that can export shader binaries contribute to this blob (see Shader::GetBinary).
+        Persistent binaries that were loaded with SetShaderVariantCacheBlob but have not been requested since, are retained.
+        \return Blob of the shader variant cache or an empty blob if there are no shader binaries.
+        \see SetShaderVariantCacheBlob
+        */
+        Blob GetShaderVariantCacheBlob() const;
+
+        /**
+        \brief Initializes the persistent shader binaries of the shader variant cache, e.g. from a previous run of the application.
+        \remarks Subsequent cache misses in CreateShaderVariant will first try to create the shader from a matching binary before compiling the shader source.
+        \return True if the blob is valid and was created by the same renderer. Otherwise, all persistent binaries are discarded.
+        \see GetShaderVariantCacheBlob
+        */
+        bool SetShaderVariantCacheBlob(const Blob& blob);
+
         /* ----- Pipeline Layouts ----- */
 
         /**
@@ -613,6 +752,18 @@ class LLGL_EXPORT RenderSystem : public Interface
         //! Releases the specified PipelineState object. After this call, the specified object must no longer be used.
         virtual void Release(PipelineState& pipelineState) = 0;
 
+        /**
+        \brief Creates multiple graphics pipeline state objects (PSOs) at once.
+        \param[in] numPipelineStates Specifies the number of PSOs to create.
+        \param[in] pipelineStateDescs Pointer to an array of \c numPipelineStates graphics PSO descriptors.
+        \param[out] outPipelineStates Pointer to an array of \c numPipelineStates elements that receive the new PSOs. Entries of PSOs that could not be created are set to null.
+        \return Number of PSOs that were created successfully.
+        \remarks Backends with asynchronous shader compilation will link all PSOs before the first link status is queried and finalize them in the order they complete,
+        e.g. the OpenGL backend with \c GL_KHR_parallel_shader_compile. Other backends create the PSOs one after another.
+        \see CreatePipelineState(const GraphicsPipelineDescriptor&, PipelineCache*)
+        */
+        virtual std::uint32_t CreatePipelineStates(std::uint32_t numPipelineStates, const GraphicsPipelineDescriptor* pipelineStateDescs, PipelineState** outPipelineStates);
+
         /* ----- Queries ----- */
 
         //! Creates a new query heap.
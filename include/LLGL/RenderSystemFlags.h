@@ -35,6 +35,7 @@ namespace LLGL
 
 
 class RenderingDebugger;
+class Allocator;
 
 /* ----- Enumerations ----- */
 
@@ -357,6 +358,16 @@ struct RenderSystemDescriptor
     */
     RenderingDebugger*  debugger            = nullptr;
 
+    /**
+    \brief Optional pointer to a memory allocator for the internal allocations of LLGL. By default null.
+    \remarks If this is null, the default heap allocation is used.
+    Otherwise, the allocator must remain valid until the render system has been unloaded.
+    All render systems that are alive at the same time must use the same allocator, otherwise RenderSystem::Load fails.
+    \see Allocator
+    \see FrameArenaAllocator
+    */
+    Allocator*          allocator           = nullptr;
+
     /**
     \brief Optional raw pointer to a renderer specific configuration structure.
     \remarks This can be used to pass some refinement configurations to the render system when the module is loaded.
@@ -676,6 +687,20 @@ struct RenderingFeatures
     \see CommandBuffer:BeginRenderCondition
     */
     bool hasRenderCondition             = false;
+
+    /**
+    \brief Specifies whether descriptor-indexed resource arrays in resource heaps are supported (aka. "bindless" resources).
+    \see BindingFlags::DescriptorIndexing
+    \see RenderingLimits::maxDescriptorIndexingArraySize
+    */
+    bool hasDescriptorIndexing          = false;
+
+    /**
+    \brief Specifies whether resources can be placed at explicit offsets inside memory heaps, i.e. memory aliasing.
+    \see RenderSystem::CreateMemoryHeap
+    \see CommandBuffer::AliasingBarrier
+    */
+    bool hasPlacedResources             = false;
 };
 
 /**
@@ -862,6 +887,14 @@ struct RenderingLimits
     \see RenderingFeatures::hasStorageBuffers
     */
     long            storageResourceStageFlags           = 0;
+
+    /**
+    \brief Specifies the maximum number of elements for a single descriptor-indexed heap binding.
+    \remarks If descriptor indexing is not supported, this is zero.
+    \see BindingFlags::DescriptorIndexing
+    \see RenderingFeatures::hasDescriptorIndexing
+    */
+    std::uint32_t   maxDescriptorIndexingArraySize      = 0;
 };
 
 /**
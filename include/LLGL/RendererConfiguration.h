@@ -53,6 +53,21 @@ enum class OpenGLContextProfile
 };
 
 
+/* ----- Types ----- */
+
+/**
+\brief Callback function type for the Vulkan device memory budget.
+\param[in] heapIndex Specifies the index of the Vulkan memory heap whose usage has crossed the budget threshold.
+\param[in] usage Specifies the number of bytes that are currently used in this memory heap.
+If the device supports \c VK_EXT_memory_budget, this is the usage of the entire process, otherwise only the memory allocated by the render system.
+\param[in] budget Specifies the number of bytes the process can use in this memory heap.
+If the device does not support \c VK_EXT_memory_budget, this is the size of the memory heap.
+\param[in] userData Specifies the user data pointer from RendererConfigurationVulkan::memoryBudgetUserData.
+\see RendererConfigurationVulkan::memoryBudgetCallback
+*/
+using VulkanMemoryBudgetCallback = void (*)(std::uint32_t heapIndex, std::uint64_t usage, std::uint64_t budget, void* userData);
+
+
 /* ----- Structures ----- */
 
 /**
@@ -111,6 +126,87 @@ struct RendererConfigurationVulkan
     \todo Remove this as soon as Vulkan memory manage has been improved.
     */
     bool                        reduceDeviceMemoryFragmentation = false;
+
+    /**
+    \brief Number of bytes that RenderSystem::WriteBuffer and RenderSystem::WriteTexture accumulate before they are submitted. By default 4*1024*1024, i.e. 4 MB.
+    \remarks Writes are recorded into a reused command buffer with a ring-buffered staging memory.
+    Such a batch is submitted to the graphics queue once this threshold is reached,
+    or at the latest before the next command buffer or fence is submitted or any GPU data is read back by the CPU.
+    The CPU only waits for an upload batch when its staging memory is about to be reused, when data is read back, or when a destination resource is released.
+    If this is 0, each write is submitted immediately, but the CPU still does not wait for its completion.
+    */
+    std::uint64_t               uploadBatchSize                 = 4*1024*1024;
+
+    /**
+    \brief Specifies the maximum number of unused framebuffers that are kept alive for reuse. By default 64.
+    \remarks Framebuffers are shared between render targets with the same render pass, attachments, and resolution.
+    When a render target is released, its framebuffer is kept in a cache and can be reused by a later render target with the same attachments.
+    The least recently used framebuffer is destroyed once this limit is exceeded. If this is 0, unused framebuffers are destroyed immediately.
+    \see FrameProfile::renderPassCacheRecord
+    */
+    std::uint32_t               maxCachedFramebuffers           = 64;
+
+    /**
+    \brief Specifies whether graphics pipelines declare their fixed-function states as dynamic. By default false.
+    \remarks If enabled and the device supports \c VK_EXT_extended_dynamic_state, the cull mode, front face, primitive topology, depth and stencil states,
+    depth bias, and line width are no longer compiled into the native graphics pipeline but set whenever the pipeline state is bound.
+    If the device also supports \c VK_EXT_extended_dynamic_state2, the primitive restart, rasterizer discard, and depth bias enable states are dynamic, too.
+    \remarks This is most effective in combination with \c enablePipelineLibraries,
+    because graphics pipelines that only differ in dynamic states can then share their pipeline libraries.
+    \see enablePipelineLibraries
+    */
+    bool                        enableDynamicPipelineState      = false;
+
+    /**
+    \brief Specifies whether graphics pipelines are linked from separately compiled pipeline libraries. By default false.
+    \remarks If enabled and the device supports fast linking with \c VK_EXT_graphics_pipeline_library,
+    the vertex input, pre-rasterization, fragment shader, and fragment output states are compiled into separate pipeline libraries.
+    Libraries with equal states are shared between all graphics pipelines, so only the missing libraries have to be compiled and the final pipeline is quickly linked.
+    Otherwise, each graphics pipeline is compiled as a whole.
+    \see enableDynamicPipelineState
+    \see FrameProfile::graphicsPipelineRecord
+    */
+    bool                        enablePipelineLibraries         = false;
+
+    /**
+    \brief Specifies the number of frames an empty device memory chunk is kept alive before it is released. By default 60.
+    \remarks Keeping empty chunks for a few frames avoids that resources which are frequently released and created again
+    allocate and free a new VkDeviceMemory object each time. If this is 0, empty chunks are released immediately.
+    \see FrameProfile::deviceMemoryRecord
+    */
+    std::uint32_t               deviceMemoryChunkLifetime       = 60;
+
+    /**
+    \brief Specifies the maximum number of bytes the device memory defragmentation relocates per frame. By default 0, i.e. defragmentation is disabled.
+    \remarks The defragmentation only runs in frames without new device memory allocations.
+    It moves buffers out of the device memory chunk with the lowest utilization into the fullest other non-empty chunks with GPU copies, so the emptied chunk can be released.
+    A chunk is only relocated if all of its blocks fit into the other chunks and its used size does not exceed this budget, otherwise it is left untouched.
+    \remarks Only buffers without CPU access that are exclusively bound as vertex, index, or indirect argument buffers are relocated,
+    since their native handles are only referenced while commands are encoded.
+    Buffers that are part of a BufferArray or whose native handle has been queried are never relocated, and neither are textures.
+    \remarks Command buffers that have been encoded before a buffer was relocated must be encoded again before they are submitted,
+    i.e. this must not be used together with CommandBufferFlags::MultiSubmit for command buffers that bind relocatable buffers.
+    \see FrameProfile::deviceMemoryRecord
+    */
+    std::uint64_t               deviceMemoryDefragmentationSize = 0;
+
+    /**
+    \brief Optional callback that is invoked when the memory usage of a device memory heap crosses the budget threshold. By default null.
+    \remarks The budget is queried once per frame with \c VK_EXT_memory_budget if the device supports this extension.
+    The callback is only invoked once when the usage exceeds the threshold and again after it has fallen below the threshold in the meantime.
+    \see memoryBudgetThreshold
+    \see memoryBudgetUserData
+    */
+    VulkanMemoryBudgetCallback  memoryBudgetCallback            = nullptr;
+
+    //! Specifies the user data pointer that is passed to the memory budget callback. By default null.
+    void*                       memoryBudgetUserData            = nullptr;
+
+    /**
+    \brief Specifies the fraction of the memory budget at which the memory budget callback is invoked. By default 0.9, i.e. 90% of the budget.
+    \see memoryBudgetCallback
+    */
+    float                       memoryBudgetThreshold           = 0.9f;
 };
 
 /**
@@ -142,6 +238,34 @@ struct RendererConfigurationOpenGL
     the respective extension and procedure name is printed to standard error output.
     */
     bool                    suppressFailedExtensions    = false;
+
+    /**
+    \brief Specifies the maximum number of unused texture views that are kept alive for reuse. By default 64.
+    \remarks Texture views are created when a resource heap binds a texture with a texture view descriptor.
+    Once a texture view is no longer referenced by any resource heap, it is kept in a cache until this limit is exceeded,
+    at which point the least recently used texture view is deleted.
+    If this is 0, texture views are deleted as soon as they are no longer referenced.
+    \see ProfileTextureViewPoolRecord
+    */
+    std::uint32_t           maxCachedTextureViews       = 64;
+
+    /**
+    \brief Specifies whether to create GL contexts without a connection to a display server. By default false.
+    \remarks If this is true, GL contexts are created with EGL on a device or surfaceless platform (\c EGL_EXT_platform_device or \c EGL_MESA_platform_surfaceless)
+    and swap-chains render into offscreen pixel buffers (pbuffers) of the swap-chain resolution instead of windows.
+    If a custom surface is specified for a swap-chain, only its content size is used. Presenting a swap-chain only flushes the GL command stream.
+    \note Only supported on: GNU/Linux, if LLGL was built with the \c LLGL_GL_ENABLE_EGL_HEADLESS option.
+    */
+    bool                    headless                    = false;
+
+    /**
+    \brief Specifies whether vertex arrays with the same vertex format share a single VAO per GL context. By default false.
+    \remarks If this is true and \c GL_ARB_vertex_attrib_binding is supported, VAOs only store the vertex format
+    and vertex buffers are bound with \c glBindVertexBuffer whenever a vertex array with different buffers is bound.
+    This reduces the number of VAOs but can increase the CPU overhead per draw call when vertex buffers change frequently.
+    If this is false, VAOs are only shared between vertex arrays that reference the same vertex buffers.
+    */
+    bool                    shareVertexArraysByFormat   = false;
 };
 
 
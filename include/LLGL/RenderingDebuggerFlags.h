@@ -291,6 +291,219 @@ struct ProfileCommandBufferRecord
     std::uint32_t meshCommands              = 0;
 };
 
+/**
+\brief Texture view pool profile record structure.
+\remarks This is only filled by backends that share native texture views between resource heaps, i.e. the OpenGL backend.
+\see FrameProfile::textureViewPoolRecord
+\see RendererConfigurationOpenGL::maxCachedTextureViews
+*/
+struct ProfileTextureViewPoolRecord
+{
+    /**
+    \brief Counter for all native texture views that have been created.
+    \remarks Each creation of a texture view is a cache miss in the texture view pool.
+    */
+    std::uint32_t textureViewCreations      = 0;
+
+    /**
+    \brief Counter for all texture view requests that have been served by an existing texture view.
+    \remarks This includes texture views that are still in use as well as unused texture views that have been kept alive in the pool.
+    */
+    std::uint32_t textureViewReuses         = 0;
+
+    /**
+    \brief Counter for all unused texture views that have been deleted to stay within the pool limit.
+    \remarks Texture views that are deleted because their source texture has been released are \e not counted here.
+    */
+    std::uint32_t textureViewEvictions      = 0;
+
+    /**
+    \brief Number of native texture views that are alive at the end of the frame, including unused ones.
+    \remarks When profiles are merged, this is the maximum of all merged profiles rather than their sum.
+    */
+    std::uint32_t numTextureViews           = 0;
+
+    /**
+    \brief Number of unused native texture views that are kept alive at the end of the frame.
+    \remarks When profiles are merged, this is the maximum of all merged profiles rather than their sum.
+    */
+    std::uint32_t numCachedTextureViews     = 0;
+};
+
+/**
+\brief Render pass and framebuffer cache profile record structure.
+\remarks This is only filled by backends that share native render pass and framebuffer objects, i.e. the Vulkan backend.
+\see FrameProfile::renderPassCacheRecord
+\see RendererConfigurationVulkan::maxCachedFramebuffers
+*/
+struct ProfileRenderPassCacheRecord
+{
+    /**
+    \brief Counter for all native render passes that have been created.
+    \remarks Each creation of a render pass is a cache miss in the render pass cache.
+    */
+    std::uint32_t renderPassCreations       = 0;
+
+    /**
+    \brief Counter for all render pass requests that have been served by an existing compatible render pass.
+    \remarks This includes render passes of render targets and swap-chains as well as RenderPass objects.
+    */
+    std::uint32_t renderPassReuses          = 0;
+
+    /**
+    \brief Counter for all native framebuffers that have been created.
+    \remarks Each creation of a framebuffer is a cache miss in the framebuffer cache.
+    */
+    std::uint32_t framebufferCreations      = 0;
+
+    /**
+    \brief Counter for all framebuffer requests that have been served by an existing framebuffer.
+    \remarks This includes framebuffers that are still in use as well as unused framebuffers that have been kept alive in the cache.
+    */
+    std::uint32_t framebufferReuses         = 0;
+
+    /**
+    \brief Counter for all unused framebuffers that have been destroyed to stay within the cache limit.
+    \remarks Framebuffers that are destroyed because one of their attachments has been released are \e not counted here.
+    */
+    std::uint32_t framebufferEvictions      = 0;
+
+    /**
+    \brief Number of native render passes that are alive at the end of the frame.
+    \remarks When profiles are merged, this is the maximum of all merged profiles rather than their sum.
+    */
+    std::uint32_t numRenderPasses           = 0;
+
+    /**
+    \brief Number of native framebuffers that are alive at the end of the frame, including unused ones.
+    \remarks When profiles are merged, this is the maximum of all merged profiles rather than their sum.
+    */
+    std::uint32_t numFramebuffers           = 0;
+};
+
+/**
+\brief Graphics pipeline creation profile record structure.
+\remarks This is only filled by backends that can link graphics pipelines from pipeline libraries, i.e. the Vulkan backend.
+\see FrameProfile::graphicsPipelineRecord
+\see RendererConfigurationVulkan::enablePipelineLibraries
+*/
+struct ProfileGraphicsPipelineRecord
+{
+    /**
+    \brief Counter for all native graphics pipelines that have been compiled as a whole.
+    \see RenderSystem::CreatePipelineState
+    */
+    std::uint32_t pipelineCreations     = 0;
+
+    /**
+    \brief Counter for all native graphics pipelines that have been linked from pipeline libraries.
+    \see RenderSystem::CreatePipelineState
+    */
+    std::uint32_t pipelineLinks         = 0;
+
+    /**
+    \brief Counter for all pipeline libraries that have been compiled.
+    \remarks Each compilation of a pipeline library is a cache miss in the pipeline library cache.
+    */
+    std::uint32_t libraryCreations      = 0;
+
+    //! Counter for all pipeline library requests that have been served by an existing pipeline library.
+    std::uint32_t libraryReuses         = 0;
+
+    /**
+    \brief Number of pipeline libraries that are alive at the end of the frame.
+    \remarks When profiles are merged, this is the maximum of all merged profiles rather than their sum.
+    */
+    std::uint32_t numLibraries          = 0;
+
+    /**
+    \brief CPU time (in microseconds) spent to create native graphics pipelines, including the compilation of pipeline libraries.
+    \remarks This is measured around the native pipeline creation only and excludes the conversion of pipeline state descriptors.
+    */
+    std::uint32_t creationTime          = 0;
+};
+
+/**
+\brief Device memory profiling record structure.
+\remarks All members are of type \c std::uint64_t and denote either a counter or a number of bytes.
+\note Only supported with: Vulkan.
+\see FrameProfile::deviceMemoryRecord
+\see RendererConfigurationVulkan::deviceMemoryChunkLifetime
+\see RendererConfigurationVulkan::deviceMemoryDefragmentationSize
+*/
+struct ProfileDeviceMemoryRecord
+{
+    /**
+    \brief Number of device memory chunks (i.e. \c VkDeviceMemory objects) at the end of the frame.
+    \remarks When profiles are merged, this and all other gauges of this record are the maximum of all merged profiles rather than their sum.
+    */
+    std::uint64_t numChunks             = 0;
+
+    //! Number of empty device memory chunks that are kept alive for reuse at the end of the frame.
+    std::uint64_t numEmptyChunks        = 0;
+
+    //! Number of allocated memory blocks within all chunks at the end of the frame.
+    std::uint64_t numBlocks             = 0;
+
+    //! Number of free memory fragments between allocated blocks at the end of the frame.
+    std::uint64_t numFragments          = 0;
+
+    //! Size (in bytes) of all device memory chunks at the end of the frame.
+    std::uint64_t allocatedSize         = 0;
+
+    //! Size (in bytes) of all allocated memory blocks at the end of the frame.
+    std::uint64_t usedSize              = 0;
+
+    //! Size (in bytes) of the largest free memory fragment at the end of the frame.
+    std::uint64_t maxFragmentSize       = 0;
+
+    /**
+    \brief Sum of the memory budgets (in bytes) of all memory heaps.
+    \remarks If the device does not support \c VK_EXT_memory_budget, this is the sum of the sizes of all memory heaps.
+    */
+    std::uint64_t budget                = 0;
+
+    /**
+    \brief Sum of the memory usage (in bytes) of all memory heaps.
+    \remarks If the device does not support \c VK_EXT_memory_budget, this only includes the memory allocated by the render system.
+    */
+    std::uint64_t usage                 = 0;
+
+    //! Counter for all empty device memory chunks that have been released.
+    std::uint64_t chunkReleases         = 0;
+
+    //! Counter for all buffers that have been relocated by the device memory defragmentation.
+    std::uint64_t relocations           = 0;
+
+    //! Size (in bytes) of all buffers that have been relocated by the device memory defragmentation.
+    std::uint64_t relocatedSize         = 0;
+};
+
+/**
+\brief Native function call profiling record structure.
+\remarks Each record accumulates all calls of a single native function that have been issued on behalf of the same command.
+\note Only supported with: OpenGL, if LLGL was built with the \c LLGL_GL_ENABLE_PROC_PROFILER option.
+This includes the statically linked GL 1.0 and 1.1 functions on Windows and Linux. With OpenGLES, only the GL functions that are loaded as extensions are recorded.
+\see FrameProfile::nativeCallRecords
+*/
+struct ProfileNativeCallRecord
+{
+    //! Name of the native function, e.g. \c "glBindBufferRange".
+    StringLiteral   function;
+
+    /**
+    \brief Name of the command that issued the native function calls, e.g. \c "DrawElements".
+    \remarks This is an empty string for all calls outside of deferred command buffers, e.g. from immediate command buffers or the RenderSystem.
+    */
+    StringLiteral   command;
+
+    //! Counter for all calls of this native function.
+    std::uint32_t   calls           = 0;
+
+    //! CPU time (in nanoseconds) spent in all calls of this native function.
+    std::uint64_t   elapsedTime     = 0;
+};
+
 /**
 \brief Profile of a rendered frame.
 \see RenderingDebugger::NextFrame
@@ -310,8 +523,42 @@ struct FrameProfile
     */
     ProfileCommandBufferRecord          commandBufferRecord;
 
+    /**
+    \brief Structure for all texture view pool recordings of this frame profile.
+    \see ProfileTextureViewPoolRecord
+    */
+    ProfileTextureViewPoolRecord        textureViewPoolRecord;
+
+    /**
+    \brief Structure for all render pass and framebuffer cache recordings of this frame profile.
+    see ProfileRenderPassCacheRecord
+    */
+    ProfileRenderPassCacheRecord        renderPassCacheRecord;
+
+    /**
+    \brief Structure for all graphics pipeline creations of this frame profile.
+    see ProfileGraphicsPipelineRecord
+    */
+    ProfileGraphicsPipelineRecord       graphicsPipelineRecord;
+
+    /**
+    \brief Structure for device memory statistics of this frame profile.
+    see ProfileDeviceMemoryRecord
+    */
+    ProfileDeviceMemoryRecord           deviceMemoryRecord;
+
+    /**
+    \brief List of all native function call records for this frame profile.
+    \remarks When profiles are merged, records with the same function and command are accumulated.
+    \see ProfileNativeCallRecord
+    */
+    DynamicVector<ProfileNativeCallRecord> nativeCallRecords;
+
     /**
     \brief List of all time records for this frame profile.
+    \remarks Timer queries are resolved asynchronously to avoid stalling the CPU,
+    so these records usually belong to an encoding from up to three frames earlier than the other members of this profile.
+    Records are still delivered for a few frames after time recording has been disabled.
     \see RenderingDebugger::SetTimeRecording
     */
     DynamicVector<ProfileTimeRecord>    timeRecords;
@@ -13,6 +13,7 @@
 #include <LLGL/ShaderFlags.h>
 #include <LLGL/ShaderReflection.h>
 #include <LLGL/Report.h>
+#include <LLGL/Blob.h>
 
 
 namespace LLGL
@@ -63,6 +64,15 @@ class LLGL_EXPORT Shader : public RenderSystemChild
         */
         virtual bool Reflect(ShaderReflection& reflection) const = 0;
 
+        /**
+        \brief Returns the compiled binary code of this shader or an empty blob if the backend does not expose it.
+        \remarks The returned binary can be passed back to RenderSystem::CreateShader via ShaderSourceType::BinaryBuffer
+        to skip the shader compilation on the same backend and device. This is used to persist the shader variant cache.
+        \note Only supported with: Direct3D 11, Direct3D 12.
+        \see RenderSystem::GetShaderVariantCacheBlob
+        */
+        virtual Blob GetBinary() const;
+
     public:
 
         //! Returns the type of this shader.
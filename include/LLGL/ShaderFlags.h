@@ -421,6 +421,31 @@ struct ShaderDescriptor
     ComputeShaderAttributes     compute;
 };
 
+/**
+\brief Shader variant cache statistics structure.
+\see RenderSystem::GetShaderVariantCacheStatistics
+*/
+struct ShaderVariantCacheStatistics
+{
+    //! Number of shader variants that are currently held by the cache.
+    std::uint32_t   numVariants     = 0;
+
+    //! Number of shader variant requests that returned an already existing shader.
+    std::uint64_t   numHits         = 0;
+
+    //! Number of shader variant requests that had to create a new shader.
+    std::uint64_t   numMisses       = 0;
+
+    /**
+    \brief Number of cache misses that were created from a persistent shader binary instead of compiling the shader source.
+    \see RenderSystem::SetShaderVariantCacheBlob
+    */
+    std::uint64_t   numBinaryLoads  = 0;
+
+    //! Ratio of cache hits to all shader variant requests in the range [0, 1].
+    float           hitRate         = 0.0f;
+};
+
 
 /* ----- Functions ----- */
 
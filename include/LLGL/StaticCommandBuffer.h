@@ -0,0 +1,184 @@
+/*
+ * StaticCommandBuffer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_STATIC_COMMAND_BUFFER_H
+#define LLGL_STATIC_COMMAND_BUFFER_H
+
+
+#ifdef LLGL_STATIC_BACKEND
+
+#include <LLGL/CommandBuffer.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Non-virtual forwarding interface for the command buffer of the statically linked backend.
+
+\remarks This is only available if LLGL was built as static library with a single backend, i.e. with the CMake option \c LLGL_STATIC_BACKEND=<Name>.
+Each function of this class directly calls the respective function of the \c final command buffer class of that backend instead of dispatching through the virtual CommandBuffer interface.
+When the application is linked with link-time optimization (LTO), these calls can be inlined into the application code.
+
+\remarks Only the most frequently encoded commands are forwarded. All other commands must be encoded with the CommandBuffer interface returned by GetCommandBuffer.
+
+\remarks This must not be used for command buffers of a render system that was loaded with a debugger (see RenderSystemDescriptor::debugger),
+because such command buffers are wrapped by the debug layer and are not instances of the backend command buffer class.
+
+\code
+LLGL::StaticCommandBuffer myStaticCmdBuffer{ *myCmdBuffer };
+myStaticCmdBuffer.Begin();
+{
+    myStaticCmdBuffer.BeginRenderPass(*mySwapChain);
+    {
+        myStaticCmdBuffer.SetPipelineState(*myPipeline);
+        myStaticCmdBuffer.SetVertexBuffer(*myVertexBuffer);
+        myStaticCmdBuffer.Draw(3, 0);
+    }
+    myStaticCmdBuffer.EndRenderPass();
+}
+myStaticCmdBuffer.End();
+\endcode
+
+\see CommandBuffer
+*/
+class LLGL_EXPORT StaticCommandBuffer
+{
+
+    public:
+
+        StaticCommandBuffer(const StaticCommandBuffer&) = default;
+        StaticCommandBuffer& operator = (const StaticCommandBuffer&) = delete;
+
+        /**
+        \brief Initializes the forwarding interface for the specified command buffer.
+        \param[in] commandBuffer Specifies the command buffer that was created by the render system of the statically linked backend.
+        */
+        explicit StaticCommandBuffer(CommandBuffer& commandBuffer);
+
+        //! Returns the virtual interface of the command buffer to encode all commands that are not forwarded by this class.
+        inline CommandBuffer& GetCommandBuffer() const
+        {
+            return commandBuffer_;
+        }
+
+    public:
+
+        /* ----- Encoding ----- */
+
+        //! \see CommandBuffer::Begin
+        void Begin();
+
+        //! \see CommandBuffer::End
+        void End();
+
+        /* ----- Viewport and Scissor ----- */
+
+        //! \see CommandBuffer::SetViewport
+        void SetViewport(const Viewport& viewport);
+
+        //! \see CommandBuffer::SetScissor
+        void SetScissor(const Scissor& scissor);
+
+        /* ----- Input Assembly ------ */
+
+        //! \see CommandBuffer::SetVertexBuffer(Buffer&)
+        void SetVertexBuffer(Buffer& buffer);
+
+        //! \see CommandBuffer::SetVertexBufferArray
+        void SetVertexBufferArray(BufferArray& bufferArray);
+
+        //! \see CommandBuffer::SetIndexBuffer(Buffer&)
+        void SetIndexBuffer(Buffer& buffer);
+
+        //! \see CommandBuffer::SetIndexBuffer(Buffer&, const Format, std::uint64_t)
+        void SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset = 0);
+
+        /* ----- Resources ----- */
+
+        //! \see CommandBuffer::SetResourceHeap
+        void SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet = 0);
+
+        //! \see CommandBuffer::SetResource
+        void SetResource(std::uint32_t descriptor, Resource& resource);
+
+        /* ----- Render Passes ----- */
+
+        //! \see CommandBuffer::BeginRenderPass
+        void BeginRenderPass(
+            RenderTarget&       renderTarget,
+            const RenderPass*   renderPass      = nullptr,
+            std::uint32_t       numClearValues  = 0,
+            const ClearValue*   clearValues     = nullptr,
+            std::uint32_t       swapBufferIndex = LLGL_CURRENT_SWAP_INDEX
+        );
+
+        //! \see CommandBuffer::EndRenderPass
+        void EndRenderPass();
+
+        //! \see CommandBuffer::Clear
+        void Clear(long flags, const ClearValue& clearValue = {});
+
+        /* ----- Pipeline States ----- */
+
+        //! \see CommandBuffer::SetPipelineState
+        void SetPipelineState(PipelineState& pipelineState);
+
+        //! \see CommandBuffer::SetUniforms
+        void SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize);
+
+        /* ----- Drawing ----- */
+
+        //! \see CommandBuffer::Draw
+        void Draw(std::uint32_t numVertices, std::uint32_t firstVertex);
+
+        //! \see CommandBuffer::DrawIndexed(std::uint32_t, std::uint32_t)
+        void DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex);
+
+        //! \see CommandBuffer::DrawIndexed(std::uint32_t, std::uint32_t, std::int32_t)
+        void DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset);
+
+        //! \see CommandBuffer::DrawInstanced(std::uint32_t, std::uint32_t, std::uint32_t)
+        void DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances);
+
+        //! \see CommandBuffer::DrawInstanced(std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t)
+        void DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance);
+
+        //! \see CommandBuffer::DrawIndexedInstanced(std::uint32_t, std::uint32_t, std::uint32_t)
+        void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex);
+
+        //! \see CommandBuffer::DrawIndexedInstanced(std::uint32_t, std::uint32_t, std::uint32_t, std::int32_t)
+        void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset);
+
+        //! \see CommandBuffer::DrawIndexedInstanced(std::uint32_t, std::uint32_t, std::uint32_t, std::int32_t, std::uint32_t)
+        void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance);
+
+        /* ----- Compute ----- */
+
+        //! \see CommandBuffer::Dispatch
+        void Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ);
+
+    private:
+
+        CommandBuffer& commandBuffer_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif // /LLGL_STATIC_BACKEND
+
+
+#endif
+
+
+
+// ================================================================================
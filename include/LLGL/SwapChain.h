@@ -169,6 +169,16 @@ class LLGL_EXPORT SwapChain : public RenderTarget
         */
         virtual bool SetVsyncInterval(std::uint32_t vsyncInterval) = 0;
 
+        /**
+        \brief Retrieves the CPU timings of the most recently presented frame.
+        \param[out] outTimings Specifies the output structure that receives the frame timings.
+        \return True on success, otherwise the renderer does not support frame timings and \c outTimings is not modified.
+        \remarks This can be used to determine how long the CPU was blocked by the GPU or the presentation engine.
+        Currently only supported by the Vulkan backend.
+        \see SwapChainFrameTimings
+        */
+        virtual bool GetFrameTimings(SwapChainFrameTimings& outTimings) const;
+
     public:
 
         /* ----- Surface & Display ----- */
@@ -128,6 +128,61 @@ struct SwapChainDescriptor
     \see WindowFlags::Resizable
     */
     bool            resizable       = false;
+
+    /**
+    \brief Maximum number of frames the CPU can record ahead of the GPU. By default 0.
+    \remarks If this is 0, the renderer chooses its default number of frames in flight, e.g. 3 for Vulkan.
+    Smaller values reduce the latency between recording a frame and presenting it, but the CPU is more likely to stall on the GPU.
+    \remarks This is only a hint to the renderer and it is clamped to the range the renderer supports.
+    Currently only supported by the Vulkan backend.
+    \see SwapChainFrameTimings::fenceWaitTime
+    */
+    std::uint32_t   framesInFlight  = 0;
+
+    /**
+    \brief Specifies whether the swap-chain reduces input latency by delaying the CPU before the next frame. By default false.
+    \remarks If enabled, SwapChain::Present sleeps just long enough that the next frame is submitted when the GPU is about to become idle,
+    instead of letting the CPU record frames that wait in the queue. The sleep duration is estimated from the recent frame timings.
+    \remarks Currently only supported by the Vulkan backend.
+    \see SwapChainFrameTimings::latencySleepTime
+    */
+    bool            lowLatency      = false;
+};
+
+/**
+\brief Swap-chain frame timings structure.
+\remarks All durations are measured on the CPU in nanoseconds during the last call to SwapChain::Present.
+This includes the waits for the next frame, since they are performed at the end of SwapChain::Present.
+\see SwapChain::GetFrameTimings
+*/
+struct SwapChainFrameTimings
+{
+    //! Number of frames that have been presented by the swap-chain so far.
+    std::uint64_t   frameCount          = 0;
+
+    //! Time the CPU spent to submit the pending command buffers of the frame to the GPU.
+    std::uint64_t   submitTime          = 0;
+
+    //! Time the CPU spent to queue the frame for presentation.
+    std::uint64_t   presentTime         = 0;
+
+    /**
+    \brief Time the CPU waited for the GPU to complete an earlier frame before the next frame could be recorded.
+    \see SwapChainDescriptor::framesInFlight
+    */
+    std::uint64_t   fenceWaitTime       = 0;
+
+    //! Time the CPU waited for the next swap-chain image to become available.
+    std::uint64_t   acquireWaitTime     = 0;
+
+    /**
+    \brief Time the CPU slept to reduce the latency of the next frame. This is always 0 if low-latency mode is disabled.
+    \see SwapChainDescriptor::lowLatency
+    */
+    std::uint64_t   latencySleepTime    = 0;
+
+    //! Time between the beginning of the last two calls to SwapChain::Present, i.e. the total CPU frame time.
+    std::uint64_t   frameTime           = 0;
 };
 
 
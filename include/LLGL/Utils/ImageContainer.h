@@ -0,0 +1,168 @@
+/*
+ * ImageContainer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_IMAGE_CONTAINER_H
+#define LLGL_IMAGE_CONTAINER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/Blob.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Report.h>
+#include <LLGL/Container/DynamicVector.h>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class Texture;
+
+/**
+\brief Enumeration of image container file formats.
+\see ImageContainer::GetContainerType
+*/
+enum class ImageContainerType
+{
+    Undefined,  //!< Undefined container type.
+    DDS,        //!< DirectDraw Surface (<code>.dds</code>), including the DX10 header extension.
+    KTX2,       //!< Khronos Texture 2.0 (<code>.ktx2</code>) without supercompression.
+};
+
+/**
+\brief Utility class to load texture containers (DDS and KTX2) without copying or converting their payload.
+
+This class is not required for any interaction with the render system.
+The container file is memory mapped and each subresource (i.e. MIP-map and array layer) is exposed as an ImageView
+that points directly into the mapped file. This avoids any intermediate decoding or copying of the image data
+and supports block compressed formats (BC, ETC, ASTC), all MIP-map levels, array layers, cube faces, and 3D textures.
+\remarks The image views returned by GetSubresourceView are only valid for the lifetime of this container.
+\see Blob::CreateFromMappedFile
+*/
+class LLGL_EXPORT ImageContainer : public NonCopyable
+{
+
+    public:
+
+        ImageContainer() = default;
+
+        //! Move constructor which takes the ownership of the container data.
+        ImageContainer(ImageContainer&& rhs) noexcept;
+
+        //! Move operator which takes the ownership of the container data.
+        ImageContainer& operator = (ImageContainer&& rhs) noexcept;
+
+    public:
+
+        /**
+        \brief Loads the specified DDS or KTX2 file. The container type is determined by the file header, not by the file extension.
+        \param[in] filename Specifies the file that is to be memory mapped.
+        \param[out] report Optional pointer to a report that receives the error message if the file could not be loaded.
+        \return True on success. Otherwise, this container is reset and the error is written to \c report if specified.
+        */
+        bool LoadFromFile(const char* filename, Report* report = nullptr);
+
+        /**
+        \brief Loads a DDS or KTX2 container from the specified blob and takes its ownership.
+        \remarks This can be used to parse containers from memory, e.g. a blob that was created with Blob::CreateWeakRef.
+        \see LoadFromFile
+        */
+        bool LoadFromBlob(Blob&& blob, Report* report = nullptr);
+
+        //! Releases the container data and resets all attributes.
+        void Reset();
+
+    public:
+
+        /**
+        \brief Returns an image view of the specified subresource that points directly into the container data.
+        \param[in] mipLevel Specifies the zero-based MIP-map level.
+        \param[in] arrayLayer Specifies the zero-based array layer. For cube textures, this is <code>6 * cubeIndex + faceIndex</code>.
+        \return Image view with the container's format and data type. For compressed formats, \c format is ImageFormat::Compressed.
+        If the subresource is out of bounds, the returned image view is empty.
+        \remarks The depth slices of a 3D texture are always stored contiguously, i.e. the returned view covers all slices of the MIP-map.
+        */
+        ImageView GetSubresourceView(std::uint32_t mipLevel, std::uint32_t arrayLayer = 0) const;
+
+        /**
+        \brief Creates a texture from this container with all its MIP-maps and array layers.
+        \param[in] renderSystem Specifies the render system that is to create the texture.
+        \param[in] bindFlags Specifies the texture binding flags. By default BindFlags::Sampled.
+        \return Pointer to the new texture or null if this container is empty.
+        \remarks The initial image data is passed directly from the memory mapped container to the render system without intermediate copies.
+        */
+        Texture* CreateTexture(RenderSystem& renderSystem, long bindFlags = BindFlags::Sampled) const;
+
+    public:
+
+        //! Returns the type of the loaded container or ImageContainerType::Undefined if the container is empty.
+        inline ImageContainerType GetContainerType() const
+        {
+            return type_;
+        }
+
+        //! Returns the texture descriptor that describes the loaded container. The \c bindFlags and \c miscFlags fields are zero.
+        inline const TextureDescriptor& GetTextureDesc() const
+        {
+            return desc_;
+        }
+
+        //! Returns the container blob.
+        inline const Blob& GetBlob() const
+        {
+            return blob_;
+        }
+
+        //! Returns true if this container holds a valid image.
+        inline operator bool () const
+        {
+            return (type_ != ImageContainerType::Undefined);
+        }
+
+    public:
+
+        //! Location of a single subresource within the container blob.
+        struct Subresource
+        {
+            std::size_t offset;
+            std::size_t size;
+        };
+
+    private:
+
+        bool ParseDDS(Report* report);
+        bool ParseKTX2(Report* report);
+
+        void AppendSubresource(std::size_t offset, std::size_t size);
+
+        bool ValidateSubresources(Report* report);
+
+    private:
+
+        Blob                        blob_;
+        ImageContainerType          type_               = ImageContainerType::Undefined;
+        TextureDescriptor           desc_;
+        ImageFormat                 imageFormat_        = ImageFormat::RGBA;
+        DataType                    dataType_           = DataType::UInt8;
+        DynamicVector<Subresource>  subresources_;      // Subresources in order [arrayLayer * mipLevels + mipLevel]
+        bool                        layersContiguous_   = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
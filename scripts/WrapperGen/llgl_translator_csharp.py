@@ -90,6 +90,11 @@ class CsharpTranslator(Translator):
             'PipelineLayoutDescriptor': CsharpProperties(getter = True),
             'ProfileCommandBufferRecord': CsharpProperties(setter = True),
             'ProfileCommandQueueRecord': CsharpProperties(setter = True),
+            'ProfileDeviceMemoryRecord': CsharpProperties(setter = True),
+            'ProfileGraphicsPipelineRecord': CsharpProperties(setter = True),
+            'ProfileNativeCallRecord': CsharpProperties(getter = True, setter = True),
+            'ProfileRenderPassCacheRecord': CsharpProperties(setter = True),
+            'ProfileTextureViewPoolRecord': CsharpProperties(setter = True),
             'ProfileTimeRecord': CsharpProperties(getter = True, setter = True),
             'QueryHeapDescriptor': CsharpProperties(getter = True),
             'RasterizerDescriptor': CsharpProperties(getter = True),
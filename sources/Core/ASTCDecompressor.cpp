@@ -0,0 +1,1136 @@
+/*
+ * ASTCDecompressor.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ASTCDecompressor.h"
+#include "Threading.h"
+#include <LLGL/Types.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/* ----- Constants ----- */
+
+static constexpr std::uint32_t g_ASTCMaxBlockDim        = 12;
+static constexpr std::uint32_t g_ASTCMaxTexels          = g_ASTCMaxBlockDim * g_ASTCMaxBlockDim;
+static constexpr std::uint32_t g_ASTCMaxWeights         = 64;
+static constexpr std::uint32_t g_ASTCMaxColorValues     = 18;
+static constexpr std::uint32_t g_ASTCNumQuantModes      = 21;
+static constexpr std::uint32_t g_ASTCNumWeightModes     = 12;
+static constexpr std::uint32_t g_ASTCMinColorQuantMode  = 4; // Color endpoints require at least 6 quantization levels
+static constexpr std::uint32_t g_ASTCNumPartitionSeeds  = 1024;
+
+// Number of trits, quints, and bits for each quantization mode from 2 to 256 levels.
+struct ASTCQuantMode
+{
+    std::uint8_t trits;
+    std::uint8_t quints;
+    std::uint8_t bits;
+};
+
+static const ASTCQuantMode g_ASTCQuantModes[g_ASTCNumQuantModes] =
+{
+    { 0, 0, 1 }, // 2
+    { 1, 0, 0 }, // 3
+    { 0, 0, 2 }, // 4
+    { 0, 1, 0 }, // 5
+    { 1, 0, 1 }, // 6
+    { 0, 0, 3 }, // 8
+    { 0, 1, 1 }, // 10
+    { 1, 0, 2 }, // 12
+    { 0, 0, 4 }, // 16
+    { 0, 1, 2 }, // 20
+    { 1, 0, 3 }, // 24
+    { 0, 0, 5 }, // 32
+    { 0, 1, 3 }, // 40
+    { 1, 0, 4 }, // 48
+    { 0, 0, 6 }, // 64
+    { 0, 1, 4 }, // 80
+    { 1, 0, 5 }, // 96
+    { 0, 0, 7 }, // 128
+    { 0, 1, 5 }, // 160
+    { 1, 0, 6 }, // 192
+    { 0, 0, 8 }, // 256
+};
+
+// Returns the number of bits for an integer sequence of 'count' values in the specified quantization mode.
+static std::uint32_t GetASTCIntegerSequenceBitCount(std::uint32_t count, std::uint32_t quantMode)
+{
+    const ASTCQuantMode& mode = g_ASTCQuantModes[quantMode];
+    std::uint32_t numBits = mode.bits * count;
+    if (mode.trits != 0)
+        numBits += (count * 8 + 4) / 5;
+    else if (mode.quints != 0)
+        numBits += (count * 7 + 2) / 3;
+    return numBits;
+}
+
+
+/* ----- Tables ----- */
+
+// Decoded block mode of the 11-bit block mode field.
+struct ASTCBlockMode
+{
+    std::uint8_t    weightsX;
+    std::uint8_t    weightsY;
+    std::uint8_t    quantMode;
+    std::uint8_t    weightBits;
+    bool            isDualPlane;
+    bool            isValid;
+};
+
+// Returns the unquantized color endpoint value in the range [0, 255].
+static std::uint8_t UnquantizeASTCColorValue(std::uint32_t value, std::uint32_t quantMode)
+{
+    const ASTCQuantMode& mode = g_ASTCQuantModes[quantMode];
+
+    if (mode.trits == 0 && mode.quints == 0)
+    {
+        /* Replicate bits to 8 bit */
+        std::uint32_t result = 0;
+        for (int shift = 8 - mode.bits; shift > -static_cast<int>(mode.bits); shift -= mode.bits)
+            result |= (shift >= 0 ? value << shift : value >> -shift);
+        return static_cast<std::uint8_t>(result & 0xFF);
+    }
+
+    const std::uint32_t m  = value & ((1u << mode.bits) - 1u);
+    const std::uint32_t d  = value >> mode.bits;
+    const std::uint32_t a  = (m & 0x1) * 0x1FF;
+    const std::uint32_t m1 = (m >> 1) & 0x1;
+    const std::uint32_t m2 = (m >> 2) & 0x1;
+    const std::uint32_t m3 = (m >> 3) & 0x1;
+    const std::uint32_t m4 = (m >> 4) & 0x1;
+    const std::uint32_t m5 = (m >> 5) & 0x1;
+
+    std::uint32_t B = 0, C = 0;
+    if (mode.trits != 0)
+    {
+        switch (mode.bits)
+        {
+            case 1: B = 0;                                                          C = 204; break;
+            case 2: B = m1*0x116;                                                   C = 93;  break;
+            case 3: B = m2*0x10A + m1*0x085;                                        C = 44;  break;
+            case 4: B = m3*0x104 + m2*0x082 + m1*0x041;                             C = 22;  break;
+            case 5: B = m4*0x102 + m3*0x081 + m2*0x040 + m1*0x020;                  C = 11;  break;
+            case 6: B = m5*0x101 + m4*0x080 + m3*0x040 + m2*0x020 + m1*0x010;       C = 5;   break;
+        }
+    }
+    else
+    {
+        switch (mode.bits)
+        {
+            case 1: B = 0;                                                          C = 113; break;
+            case 2: B = m1*0x10C;                                                   C = 54;  break;
+            case 3: B = m2*0x105 + m1*0x082;                                        C = 26;  break;
+            case 4: B = m3*0x102 + m2*0x081 + m1*0x040;                             C = 13;  break;
+            case 5: B = m4*0x101 + m3*0x080 + m2*0x040 + m1*0x020;                  C = 6;   break;
+        }
+    }
+
+    const std::uint32_t t = (d * C + B) ^ a;
+    return static_cast<std::uint8_t>((a & 0x80) | (t >> 2));
+}
+
+// Returns the unquantized weight value in the range [0, 64].
+static std::uint8_t UnquantizeASTCWeightValue(std::uint32_t value, std::uint32_t quantMode)
+{
+    const ASTCQuantMode& mode = g_ASTCQuantModes[quantMode];
+
+    std::uint32_t result = 0;
+
+    if (mode.trits == 0 && mode.quints == 0)
+    {
+        /* Replicate bits to 6 bit */
+        for (int shift = 6 - mode.bits; shift > -static_cast<int>(mode.bits); shift -= mode.bits)
+            result |= (shift >= 0 ? value << shift : value >> -shift);
+        result &= 0x3F;
+    }
+    else if (mode.bits == 0)
+    {
+        static const std::uint8_t tritValues[3]   = { 0, 32, 63 };
+        static const std::uint8_t quintValues[5]  = { 0, 16, 32, 47, 63 };
+        result = (mode.trits != 0 ? tritValues[value] : quintValues[value]);
+    }
+    else
+    {
+        const std::uint32_t m  = value & ((1u << mode.bits) - 1u);
+        const std::uint32_t d  = value >> mode.bits;
+        const std::uint32_t a  = (m & 0x1) * 0x7F;
+        const std::uint32_t m1 = (m >> 1) & 0x1;
+        const std::uint32_t m2 = (m >> 2) & 0x1;
+
+        std::uint32_t B = 0, C = 0;
+        if (mode.trits != 0)
+        {
+            switch (mode.bits)
+            {
+                case 1: B = 0;                      C = 50; break;
+                case 2: B = m1*0x45;                C = 23; break;
+                case 3: B = m2*0x42 + m1*0x21;      C = 11; break;
+            }
+        }
+        else
+        {
+            switch (mode.bits)
+            {
+                case 1: B = 0;                      C = 28; break;
+                case 2: B = m1*0x42;                C = 13; break;
+            }
+        }
+
+        const std::uint32_t t = (d * C + B) ^ a;
+        result = (a & 0x20) | (t >> 2);
+    }
+
+    /* Map [0, 63] to [0, 64] */
+    return static_cast<std::uint8_t>(result > 32 ? result + 1 : result);
+}
+
+// Decodes the 11-bit block mode field for 2D blocks.
+static ASTCBlockMode DecodeASTCBlockMode(std::uint32_t blockMode)
+{
+    ASTCBlockMode mode = {};
+
+    std::uint32_t   baseQuant   = (blockMode >> 4) & 0x1;
+    std::uint32_t   h           = (blockMode >> 9) & 0x1;
+    std::uint32_t   d           = (blockMode >> 10) & 0x1;
+    std::uint32_t   a           = (blockMode >> 5) & 0x3;
+    std::uint32_t   wx          = 0;
+    std::uint32_t   wy          = 0;
+
+    if ((blockMode & 0x3) != 0)
+    {
+        baseQuant |= (blockMode & 0x3) << 1;
+        std::uint32_t b = (blockMode >> 7) & 0x3;
+        switch ((blockMode >> 2) & 0x3)
+        {
+            case 0: wx = b + 4; wy = a + 2; break;
+            case 1: wx = b + 8; wy = a + 2; break;
+            case 2: wx = a + 2; wy = b + 8; break;
+            case 3:
+                b &= 0x1;
+                if ((blockMode & 0x100) != 0)
+                {
+                    wx = b + 2;
+                    wy = a + 2;
+                }
+                else
+                {
+                    wx = a + 2;
+                    wy = b + 6;
+                }
+                break;
+        }
+    }
+    else
+    {
+        baseQuant |= ((blockMode >> 2) & 0x3) << 1;
+        if (((blockMode >> 2) & 0x3) == 0)
+            return mode;
+
+        const std::uint32_t b = (blockMode >> 9) & 0x3;
+        switch ((blockMode >> 7) & 0x3)
+        {
+            case 0: wx = 12;    wy = a + 2; break;
+            case 1: wx = a + 2; wy = 12;    break;
+            case 2: wx = a + 6; wy = b + 6; d = 0; h = 0; break;
+            case 3:
+                switch (a)
+                {
+                    case 0: wx = 6;  wy = 10; break;
+                    case 1: wx = 10; wy = 6;  break;
+                    default: return mode;
+                }
+                break;
+        }
+    }
+
+    const std::uint32_t numWeights = wx * wy * (d + 1);
+    if (numWeights > g_ASTCMaxWeights)
+        return mode;
+
+    const std::uint32_t quantMode   = (baseQuant - 2) + 6 * h;
+    const std::uint32_t weightBits  = GetASTCIntegerSequenceBitCount(numWeights, quantMode);
+    if (weightBits < 24 || weightBits > 96)
+        return mode;
+
+    mode.weightsX       = static_cast<std::uint8_t>(wx);
+    mode.weightsY       = static_cast<std::uint8_t>(wy);
+    mode.quantMode      = static_cast<std::uint8_t>(quantMode);
+    mode.weightBits     = static_cast<std::uint8_t>(weightBits);
+    mode.isDualPlane    = (d != 0);
+    mode.isValid        = true;
+
+    return mode;
+}
+
+// Static lookup tables shared by all ASTC decoders.
+struct ASTCDecoderTables
+{
+    ASTCDecoderTables()
+    {
+        /* Generate trit table for all 8-bit encodings of five trits */
+        for_range(i, 256u)
+        {
+            auto Bits = [i](std::uint32_t hi, std::uint32_t lo) -> std::uint32_t
+            {
+                return (i >> lo) & ((1u << (hi - lo + 1)) - 1);
+            };
+
+            std::uint32_t c, t[5];
+            if (Bits(4, 2) == 0x7)
+            {
+                c = (Bits(7, 5) << 2) | Bits(1, 0);
+                t[4] = 2;
+                t[3] = 2;
+            }
+            else
+            {
+                c = Bits(4, 0);
+                if (Bits(6, 5) == 0x3)
+                {
+                    t[4] = 2;
+                    t[3] = Bits(7, 7);
+                }
+                else
+                {
+                    t[4] = Bits(7, 7);
+                    t[3] = Bits(6, 5);
+                }
+            }
+
+            if ((c & 0x3) == 0x3)
+            {
+                t[2] = 2;
+                t[1] = (c >> 4) & 0x1;
+                t[0] = (((c >> 3) & 0x1) << 1) | (((c >> 2) & 0x1) & ~((c >> 3) & 0x1));
+            }
+            else if (((c >> 2) & 0x3) == 0x3)
+            {
+                t[2] = 2;
+                t[1] = 2;
+                t[0] = c & 0x3;
+            }
+            else
+            {
+                t[2] = (c >> 4) & 0x1;
+                t[1] = (c >> 2) & 0x3;
+                t[0] = (((c >> 1) & 0x1) << 1) | ((c & 0x1) & ~((c >> 1) & 0x1));
+            }
+
+            for_range(j, 5)
+                trits[i][j] = static_cast<std::uint8_t>(t[j]);
+        }
+
+        /* Generate quint table for all 7-bit encodings of three quints */
+        for_range(i, 128u)
+        {
+            auto Bits = [i](std::uint32_t hi, std::uint32_t lo) -> std::uint32_t
+            {
+                return (i >> lo) & ((1u << (hi - lo + 1)) - 1);
+            };
+
+            std::uint32_t q[3];
+            if (Bits(2, 1) == 0x3 && Bits(6, 5) == 0x0)
+            {
+                const std::uint32_t q0 = Bits(0, 0);
+                q[2] = (q0 << 2) | ((Bits(4, 4) & ~q0 & 0x1) << 1) | (Bits(3, 3) & ~q0 & 0x1);
+                q[1] = 4;
+                q[0] = 4;
+            }
+            else
+            {
+                std::uint32_t c;
+                if (Bits(2, 1) == 0x3)
+                {
+                    q[2] = 4;
+                    c = (Bits(4, 3) << 3) | ((~Bits(6, 5) & 0x3) << 1) | Bits(0, 0);
+                }
+                else
+                {
+                    q[2] = Bits(6, 5);
+                    c = Bits(4, 0);
+                }
+
+                if ((c & 0x7) == 0x5)
+                {
+                    q[1] = 4;
+                    q[0] = (c >> 3) & 0x3;
+                }
+                else
+                {
+                    q[1] = (c >> 3) & 0x3;
+                    q[0] = c & 0x7;
+                }
+            }
+
+            for_range(j, 3)
+                quints[i][j] = static_cast<std::uint8_t>(q[j]);
+        }
+
+        /* Generate unquantization tables */
+        for_range(quantMode, g_ASTCNumQuantModes)
+        {
+            const ASTCQuantMode& mode = g_ASTCQuantModes[quantMode];
+            const std::uint32_t numLevels = (mode.trits != 0 ? 3u : mode.quints != 0 ? 5u : 1u) << mode.bits;
+            for_range(value, numLevels)
+            {
+                if (quantMode >= g_ASTCMinColorQuantMode)
+                    colorUnquant[quantMode][value] = UnquantizeASTCColorValue(value, quantMode);
+                if (quantMode < g_ASTCNumWeightModes)
+                    weightUnquant[quantMode][value] = UnquantizeASTCWeightValue(value, quantMode);
+            }
+        }
+
+        /* Decode all block modes */
+        for_range(i, 2048u)
+            blockModes[i] = DecodeASTCBlockMode(i);
+
+        /* Find the highest color quantization mode that fits into the remaining bits for each number of color values */
+        for_range(pairs, g_ASTCMaxColorValues / 2)
+        {
+            for_range(bits, 128u)
+            {
+                colorQuantModes[pairs][bits] = -1;
+                for_subrange_reverse(quantMode, 0u, g_ASTCNumQuantModes)
+                {
+                    if (GetASTCIntegerSequenceBitCount((pairs + 1) * 2, quantMode) <= bits)
+                    {
+                        colorQuantModes[pairs][bits] = static_cast<std::int8_t>(quantMode);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    static const ASTCDecoderTables& Get()
+    {
+        static const ASTCDecoderTables instance;
+        return instance;
+    }
+
+    std::uint8_t    trits[256][5];
+    std::uint8_t    quints[128][3];
+    std::uint8_t    colorUnquant[g_ASTCNumQuantModes][256];
+    std::uint8_t    weightUnquant[g_ASTCNumWeightModes][32];
+    ASTCBlockMode   blockModes[2048];
+    std::int8_t     colorQuantModes[g_ASTCMaxColorValues / 2][128];
+};
+
+
+/* ----- Bit reading ----- */
+
+// 128-bit ASTC block with little-endian bit order.
+struct ASTCBlockBits
+{
+    std::uint64_t words[2];
+
+    // Returns the specified range of bits. Bits beyond 'limit' are read as zero.
+    std::uint32_t Read(std::uint32_t offset, std::uint32_t count, std::uint32_t limit = 128) const
+    {
+        if (offset >= limit || count == 0)
+            return 0;
+        count = std::min(count, limit - offset);
+
+        std::uint64_t bits = words[offset / 64] >> (offset % 64);
+        if (offset % 64 + count > 64)
+            bits |= words[1] << (64 - offset % 64);
+
+        return static_cast<std::uint32_t>(bits & ((std::uint64_t(1) << count) - 1));
+    }
+};
+
+static std::uint64_t ReverseBits64(std::uint64_t x)
+{
+    x = ((x >>  1) & 0x5555555555555555ull) | ((x & 0x5555555555555555ull) <<  1);
+    x = ((x >>  2) & 0x3333333333333333ull) | ((x & 0x3333333333333333ull) <<  2);
+    x = ((x >>  4) & 0x0F0F0F0F0F0F0F0Full) | ((x & 0x0F0F0F0F0F0F0F0Full) <<  4);
+    x = ((x >>  8) & 0x00FF00FF00FF00FFull) | ((x & 0x00FF00FF00FF00FFull) <<  8);
+    x = ((x >> 16) & 0x0000FFFF0000FFFFull) | ((x & 0x0000FFFF0000FFFFull) << 16);
+    return (x >> 32) | (x << 32);
+}
+
+// Decodes a bounded integer sequence (ISE) of 'count' values starting at the specified bit offset.
+static void DecodeASTCIntegerSequence(
+    const ASTCDecoderTables&    tables,
+    const ASTCBlockBits&        block,
+    std::uint32_t               offset,
+    std::uint32_t               count,
+    std::uint32_t               quantMode,
+    std::uint8_t*               outValues)
+{
+    const ASTCQuantMode&    mode    = g_ASTCQuantModes[quantMode];
+    const std::uint32_t     limit   = offset + GetASTCIntegerSequenceBitCount(count, quantMode);
+    const std::uint32_t     n       = mode.bits;
+
+    if (mode.trits != 0)
+    {
+        /* Blocks of five values share 8 bits of trit information interleaved with the value bits */
+        static const std::uint32_t tritBitCounts[5] = { 2, 2, 1, 2, 1 };
+        for (std::uint32_t i = 0; i < count; i += 5)
+        {
+            std::uint32_t m[5], t = 0, tShift = 0;
+            for_range(j, 5u)
+            {
+                m[j] = block.Read(offset, n, limit);
+                offset += n;
+                t |= block.Read(offset, tritBitCounts[j], limit) << tShift;
+                offset += tritBitCounts[j];
+                tShift += tritBitCounts[j];
+            }
+            for_range(j, std::min(5u, count - i))
+                outValues[i + j] = static_cast<std::uint8_t>((tables.trits[t][j] << n) | m[j]);
+        }
+    }
+    else if (mode.quints != 0)
+    {
+        /* Blocks of three values share 7 bits of quint information interleaved with the value bits */
+        static const std::uint32_t quintBitCounts[3] = { 3, 2, 2 };
+        for (std::uint32_t i = 0; i < count; i += 3)
+        {
+            std::uint32_t m[3], q = 0, qShift = 0;
+            for_range(j, 3u)
+            {
+                m[j] = block.Read(offset, n, limit);
+                offset += n;
+                q |= block.Read(offset, quintBitCounts[j], limit) << qShift;
+                offset += quintBitCounts[j];
+                qShift += quintBitCounts[j];
+            }
+            for_range(j, std::min(3u, count - i))
+                outValues[i + j] = static_cast<std::uint8_t>((tables.quints[q][j] << n) | m[j]);
+        }
+    }
+    else
+    {
+        for_range(i, count)
+        {
+            outValues[i] = static_cast<std::uint8_t>(block.Read(offset, n, limit));
+            offset += n;
+        }
+    }
+}
+
+
+/* ----- Color endpoints ----- */
+
+static inline int ClampASTCColor(int x)
+{
+    return std::max(0, std::min(x, 255));
+}
+
+static void TransferASTCBitsSigned(int& a, int& b)
+{
+    b = (b >> 1) | (a & 0x80);
+    a = (a >> 1) & 0x3F;
+    if ((a & 0x20) != 0)
+        a -= 0x40;
+}
+
+static void SetASTCEndpoint(int (&dst)[4], int r, int g, int b, int a)
+{
+    dst[0] = r;
+    dst[1] = g;
+    dst[2] = b;
+    dst[3] = a;
+}
+
+static void SetASTCEndpointBlueContract(int (&dst)[4], int r, int g, int b, int a)
+{
+    dst[0] = (r + b) >> 1;
+    dst[1] = (g + b) >> 1;
+    dst[2] = b;
+    dst[3] = a;
+}
+
+// Returns true if the specified color endpoint mode is an HDR mode, which is illegal in the LDR profile.
+static bool IsASTCColorEndpointModeHDR(std::uint32_t cem)
+{
+    return (cem == 2 || cem == 3 || cem == 7 || cem == 11 || cem == 14 || cem == 15);
+}
+
+// Decodes the LDR color endpoint pair from the unquantized color values in the range [0, 255].
+static void DecodeASTCColorEndpoints(std::uint32_t cem, const std::uint8_t* values, int (&e0)[4], int (&e1)[4])
+{
+    int v[8];
+    for_range(i, (cem / 4 + 1) * 2)
+        v[i] = values[i];
+
+    switch (cem)
+    {
+        case 0: // Luminance, direct
+        {
+            SetASTCEndpoint(e0, v[0], v[0], v[0], 0xFF);
+            SetASTCEndpoint(e1, v[1], v[1], v[1], 0xFF);
+        }
+        break;
+
+        case 1: // Luminance, base+offset
+        {
+            const int l0 = (v[0] >> 2) | (v[1] & 0xC0);
+            const int l1 = l0 + (v[1] & 0x3F);
+            SetASTCEndpoint(e0, l0, l0, l0, 0xFF);
+            SetASTCEndpoint(e1, l1, l1, l1, 0xFF);
+        }
+        break;
+
+        case 4: // Luminance-alpha, direct
+        {
+            SetASTCEndpoint(e0, v[0], v[0], v[0], v[2]);
+            SetASTCEndpoint(e1, v[1], v[1], v[1], v[3]);
+        }
+        break;
+
+        case 5: // Luminance-alpha, base+offset
+        {
+            TransferASTCBitsSigned(v[1], v[0]);
+            TransferASTCBitsSigned(v[3], v[2]);
+            SetASTCEndpoint(e0, v[0], v[0], v[0], v[2]);
+            SetASTCEndpoint(e1, v[0] + v[1], v[0] + v[1], v[0] + v[1], v[2] + v[3]);
+        }
+        break;
+
+        case 6: // RGB, base+scale
+        {
+            SetASTCEndpoint(e0, (v[0] * v[3]) >> 8, (v[1] * v[3]) >> 8, (v[2] * v[3]) >> 8, 0xFF);
+            SetASTCEndpoint(e1, v[0], v[1], v[2], 0xFF);
+        }
+        break;
+
+        case 8: // RGB, direct
+        case 12: // RGBA, direct
+        {
+            const int a0 = (cem == 12 ? v[6] : 0xFF);
+            const int a1 = (cem == 12 ? v[7] : 0xFF);
+            if (v[1] + v[3] + v[5] >= v[0] + v[2] + v[4])
+            {
+                SetASTCEndpoint(e0, v[0], v[2], v[4], a0);
+                SetASTCEndpoint(e1, v[1], v[3], v[5], a1);
+            }
+            else
+            {
+                SetASTCEndpointBlueContract(e0, v[1], v[3], v[5], a1);
+                SetASTCEndpointBlueContract(e1, v[0], v[2], v[4], a0);
+            }
+        }
+        break;
+
+        case 9: // RGB, base+offset
+        case 13: // RGBA, base+offset
+        {
+            TransferASTCBitsSigned(v[1], v[0]);
+            TransferASTCBitsSigned(v[3], v[2]);
+            TransferASTCBitsSigned(v[5], v[4]);
+            if (cem == 13)
+                TransferASTCBitsSigned(v[7], v[6]);
+            else
+            {
+                v[6] = 0xFF;
+                v[7] = 0;
+            }
+
+            if (v[1] + v[3] + v[5] >= 0)
+            {
+                SetASTCEndpoint(e0, v[0], v[2], v[4], v[6]);
+                SetASTCEndpoint(e1, v[0] + v[1], v[2] + v[3], v[4] + v[5], v[6] + v[7]);
+            }
+            else
+            {
+                SetASTCEndpointBlueContract(e0, v[0] + v[1], v[2] + v[3], v[4] + v[5], v[6] + v[7]);
+                SetASTCEndpointBlueContract(e1, v[0], v[2], v[4], v[6]);
+            }
+        }
+        break;
+
+        case 10: // RGB, base+scale plus two alpha
+        {
+            SetASTCEndpoint(e0, (v[0] * v[3]) >> 8, (v[1] * v[3]) >> 8, (v[2] * v[3]) >> 8, v[4]);
+            SetASTCEndpoint(e1, v[0], v[1], v[2], v[5]);
+        }
+        break;
+
+        default:
+        break;
+    }
+
+    /* Clamp endpoints after the offsets have been applied and the blue channel has been contracted */
+    for_range(c, 4)
+    {
+        e0[c] = ClampASTCColor(e0[c]);
+        e1[c] = ClampASTCColor(e1[c]);
+    }
+}
+
+
+/* ----- Partitions and weight infill ----- */
+
+static std::uint32_t HashASTCPartitionSeed(std::uint32_t x)
+{
+    x ^= x >> 15;
+    x *= 0xEEDE0891;
+    x ^= x >> 5;
+    x += x << 16;
+    x ^= x >> 7;
+    x ^= x >> 3;
+    x ^= x << 6;
+    x ^= x >> 17;
+    return x;
+}
+
+// Returns the partition index of the specified texel with the partition pattern generator of the ASTC specification.
+static std::uint32_t SelectASTCPartition(std::uint32_t seed, std::uint32_t x, std::uint32_t y, std::uint32_t numPartitions, bool isSmallBlock)
+{
+    if (isSmallBlock)
+    {
+        x <<= 1;
+        y <<= 1;
+    }
+
+    seed += (numPartitions - 1) * 1024;
+
+    const std::uint32_t rnum = HashASTCPartitionSeed(seed);
+
+    std::uint32_t seeds[8];
+    for_range(i, 8u)
+    {
+        seeds[i] = (rnum >> (i * 4)) & 0xF;
+        seeds[i] *= seeds[i];
+    }
+
+    std::uint32_t sh1, sh2;
+    if ((seed & 1) != 0)
+    {
+        sh1 = ((seed & 2) != 0 ? 4 : 5);
+        sh2 = (numPartitions == 3 ? 6 : 5);
+    }
+    else
+    {
+        sh1 = (numPartitions == 3 ? 6 : 5);
+        sh2 = ((seed & 2) != 0 ? 4 : 5);
+    }
+
+    const std::uint32_t a = ((seeds[0] >> sh1) * x + (seeds[1] >> sh2) * y + (rnum >> 14)) & 0x3F;
+    const std::uint32_t b = ((seeds[2] >> sh1) * x + (seeds[3] >> sh2) * y + (rnum >> 10)) & 0x3F;
+    const std::uint32_t c = (numPartitions < 3 ? 0 : ((seeds[4] >> sh1) * x + (seeds[5] >> sh2) * y + (rnum >>  6)) & 0x3F);
+    const std::uint32_t d = (numPartitions < 4 ? 0 : ((seeds[6] >> sh1) * x + (seeds[7] >> sh2) * y + (rnum >>  2)) & 0x3F);
+
+    if (a >= b && a >= c && a >= d)
+        return 0;
+    if (b >= c && b >= d)
+        return 1;
+    if (c >= d)
+        return 2;
+    return 3;
+}
+
+// Bilinear infill of a texel from the weight grid: four grid indices and their weighting factors.
+struct ASTCInfillTexel
+{
+    std::uint8_t indices[4];
+    std::uint8_t factors[4];
+};
+
+// Per-thread decoder state with lazily generated partition and weight infill tables for a single block footprint.
+class ASTCDecoderContext
+{
+
+    public:
+
+        ASTCDecoderContext(const Extent2D& blockExtent, bool isSRGB) :
+            blockWidth_   { blockExtent.width                        },
+            blockHeight_  { blockExtent.height                       },
+            numTexels_    { blockExtent.width * blockExtent.height   },
+            isSRGB_       { isSRGB                                   }
+        {
+        }
+
+        void DecodeBlock(const ASTCDecoderTables& tables, const std::uint8_t* src, std::uint8_t (&dst)[g_ASTCMaxTexels][4]);
+
+    private:
+
+        const std::uint8_t* GetPartitionTable(std::uint32_t numPartitions, std::uint32_t seed);
+        const ASTCInfillTexel* GetInfillTable(std::uint32_t weightsX, std::uint32_t weightsY);
+
+        void WriteErrorColor(std::uint8_t (&dst)[g_ASTCMaxTexels][4]) const;
+
+    private:
+
+        const std::uint32_t                 blockWidth_;
+        const std::uint32_t                 blockHeight_;
+        const std::uint32_t                 numTexels_;
+        const bool                          isSRGB_;
+
+        std::vector<std::uint8_t>           partitionTables_;
+        std::vector<bool>                   partitionTablesReady_;
+        std::vector<ASTCInfillTexel>        infillTables_[(g_ASTCMaxBlockDim - 1) * (g_ASTCMaxBlockDim - 1)];
+
+};
+
+const std::uint8_t* ASTCDecoderContext::GetPartitionTable(std::uint32_t numPartitions, std::uint32_t seed)
+{
+    if (partitionTables_.empty())
+    {
+        partitionTables_.resize(3 * g_ASTCNumPartitionSeeds * numTexels_);
+        partitionTablesReady_.resize(3 * g_ASTCNumPartitionSeeds, false);
+    }
+
+    const std::uint32_t tableIndex = (numPartitions - 2) * g_ASTCNumPartitionSeeds + seed;
+    std::uint8_t* table = &partitionTables_[tableIndex * numTexels_];
+
+    if (!partitionTablesReady_[tableIndex])
+    {
+        const bool isSmallBlock = (numTexels_ < 31);
+        for_range(y, blockHeight_)
+        {
+            for_range(x, blockWidth_)
+                table[y * blockWidth_ + x] = static_cast<std::uint8_t>(SelectASTCPartition(seed, x, y, numPartitions, isSmallBlock));
+        }
+        partitionTablesReady_[tableIndex] = true;
+    }
+
+    return table;
+}
+
+const ASTCInfillTexel* ASTCDecoderContext::GetInfillTable(std::uint32_t weightsX, std::uint32_t weightsY)
+{
+    std::vector<ASTCInfillTexel>& table = infillTables_[(weightsY - 2) * (g_ASTCMaxBlockDim - 1) + (weightsX - 2)];
+
+    if (table.empty())
+    {
+        table.resize(numTexels_);
+
+        const std::uint32_t ds = (1024 + blockWidth_  / 2) / (blockWidth_  - 1);
+        const std::uint32_t dt = (1024 + blockHeight_ / 2) / (blockHeight_ - 1);
+
+        for_range(t, blockHeight_)
+        {
+            for_range(s, blockWidth_)
+            {
+                const std::uint32_t gs  = (ds * s * (weightsX - 1) + 32) >> 6;
+                const std::uint32_t gt  = (dt * t * (weightsY - 1) + 32) >> 6;
+                const std::uint32_t js  = gs >> 4;
+                const std::uint32_t fs  = gs & 0xF;
+                const std::uint32_t jt  = gt >> 4;
+                const std::uint32_t ft  = gt & 0xF;
+                const std::uint32_t v0  = js + jt * weightsX;
+                const std::uint32_t w11 = (fs * ft + 8) >> 4;
+
+                ASTCInfillTexel& texel = table[t * blockWidth_ + s];
+                texel.indices[0] = static_cast<std::uint8_t>(v0);
+                texel.indices[1] = static_cast<std::uint8_t>(v0 + 1);
+                texel.indices[2] = static_cast<std::uint8_t>(v0 + weightsX);
+                texel.indices[3] = static_cast<std::uint8_t>(v0 + weightsX + 1);
+                texel.factors[0] = static_cast<std::uint8_t>(16 - fs - ft + w11);
+                texel.factors[1] = static_cast<std::uint8_t>(fs - w11);
+                texel.factors[2] = static_cast<std::uint8_t>(ft - w11);
+                texel.factors[3] = static_cast<std::uint8_t>(w11);
+            }
+        }
+    }
+
+    return table.data();
+}
+
+void ASTCDecoderContext::WriteErrorColor(std::uint8_t (&dst)[g_ASTCMaxTexels][4]) const
+{
+    for_range(i, numTexels_)
+    {
+        dst[i][0] = 0xFF;
+        dst[i][1] = 0x00;
+        dst[i][2] = 0xFF;
+        dst[i][3] = 0xFF;
+    }
+}
+
+void ASTCDecoderContext::DecodeBlock(const ASTCDecoderTables& tables, const std::uint8_t* src, std::uint8_t (&dst)[g_ASTCMaxTexels][4])
+{
+    ASTCBlockBits block;
+    ::memcpy(block.words, src, sizeof(block.words));
+
+    const std::uint32_t blockModeBits = block.Read(0, 11);
+
+    /* Decode void-extent block with a constant color */
+    if ((blockModeBits & 0x1FF) == 0x1FC)
+    {
+        /* HDR void-extent blocks are illegal in the LDR profile */
+        if ((blockModeBits & 0x200) != 0)
+            return WriteErrorColor(dst);
+
+        const std::uint32_t minS = block.Read(12, 13);
+        const std::uint32_t maxS = block.Read(25, 13);
+        const std::uint32_t minT = block.Read(38, 13);
+        const std::uint32_t maxT = block.Read(51, 13);
+        const bool allOnes = (minS == 0x1FFF && maxS == 0x1FFF && minT == 0x1FFF && maxT == 0x1FFF);
+
+        if (!allOnes && (minS >= maxS || minT >= maxT))
+            return WriteErrorColor(dst);
+
+        std::uint8_t color[4];
+        for_range(c, 4u)
+            color[c] = static_cast<std::uint8_t>(block.Read(64 + c * 16 + 8, 8));
+
+        for_range(i, numTexels_)
+            ::memcpy(dst[i], color, sizeof(color));
+
+        return;
+    }
+
+    /* Decode block mode and validate weight grid against block footprint */
+    const ASTCBlockMode& blockMode = tables.blockModes[blockModeBits];
+    if (!blockMode.isValid || blockMode.weightsX > blockWidth_ || blockMode.weightsY > blockHeight_)
+        return WriteErrorColor(dst);
+
+    const std::uint32_t numPartitions = block.Read(11, 2) + 1;
+    if (blockMode.isDualPlane && numPartitions == 4)
+        return WriteErrorColor(dst);
+
+    /* Decode color endpoint modes (CEM) */
+    std::uint32_t cems[4]           = {};
+    std::uint32_t partitionSeed     = 0;
+    std::uint32_t configEnd         = 128 - blockMode.weightBits;
+    std::uint32_t colorOffset       = 0;
+
+    if (numPartitions == 1)
+    {
+        cems[0]     = block.Read(13, 4);
+        colorOffset = 17;
+    }
+    else
+    {
+        partitionSeed = block.Read(13, 10);
+        colorOffset = 29;
+
+        std::uint32_t encodedCEM = block.Read(23, 6);
+        if ((encodedCEM & 0x3) == 0)
+        {
+            /* All partitions share the same CEM */
+            for_range(i, numPartitions)
+                cems[i] = encodedCEM >> 2;
+        }
+        else
+        {
+            /* Additional CEM bits are stored below the weights */
+            const std::uint32_t numExtraBits = 3 * numPartitions - 4;
+            configEnd -= numExtraBits;
+            encodedCEM |= block.Read(configEnd, numExtraBits) << 6;
+
+            const std::uint32_t baseClass = (encodedCEM & 0x3) - 1;
+            std::uint32_t bitPos = 2;
+            for_range(i, numPartitions)
+                cems[i] = (((encodedCEM >> bitPos++) & 0x1) + baseClass) << 2;
+            for_range(i, numPartitions)
+            {
+                cems[i] |= (encodedCEM >> bitPos) & 0x3;
+                bitPos += 2;
+            }
+        }
+    }
+
+    /* Decode color component selector (CCS) for dual-plane blocks */
+    std::uint32_t dualPlaneComponent = 4;
+    if (blockMode.isDualPlane)
+    {
+        configEnd -= 2;
+        dualPlaneComponent = block.Read(configEnd, 2);
+    }
+
+    /* Determine color quantization mode from the remaining bits */
+    std::uint32_t numColorValues = 0;
+    for_range(i, numPartitions)
+    {
+        if (IsASTCColorEndpointModeHDR(cems[i]))
+            return WriteErrorColor(dst);
+        numColorValues += (cems[i] / 4 + 1) * 2;
+    }
+
+    if (numColorValues > g_ASTCMaxColorValues || configEnd < colorOffset)
+        return WriteErrorColor(dst);
+
+    const int colorQuantMode = tables.colorQuantModes[numColorValues / 2 - 1][configEnd - colorOffset];
+    if (colorQuantMode < static_cast<int>(g_ASTCMinColorQuantMode))
+        return WriteErrorColor(dst);
+
+    /* Decode and unquantize color values */
+    std::uint8_t colorValues[g_ASTCMaxColorValues];
+    DecodeASTCIntegerSequence(tables, block, colorOffset, numColorValues, static_cast<std::uint32_t>(colorQuantMode), colorValues);
+    for_range(i, numColorValues)
+        colorValues[i] = tables.colorUnquant[colorQuantMode][colorValues[i]];
+
+    /* Decode color endpoints and expand them to 16 bit */
+    std::uint32_t endpoints[4][2][4];
+    {
+        const std::uint8_t* values = colorValues;
+        for_range(i, numPartitions)
+        {
+            int e0[4], e1[4];
+            DecodeASTCColorEndpoints(cems[i], values, e0, e1);
+            values += (cems[i] / 4 + 1) * 2;
+
+            for_range(c, 4)
+            {
+                if (isSRGB_)
+                {
+                    endpoints[i][0][c] = (static_cast<std::uint32_t>(e0[c]) << 8) | 0x80;
+                    endpoints[i][1][c] = (static_cast<std::uint32_t>(e1[c]) << 8) | 0x80;
+                }
+                else
+                {
+                    endpoints[i][0][c] = static_cast<std::uint32_t>(e0[c]) * 257;
+                    endpoints[i][1][c] = static_cast<std::uint32_t>(e1[c]) * 257;
+                }
+            }
+        }
+    }
+
+    /* Decode weights, which are stored in reverse bit order from the end of the block */
+    const std::uint32_t numGridWeights  = blockMode.weightsX * blockMode.weightsY;
+    const std::uint32_t numPlanes       = (blockMode.isDualPlane ? 2 : 1);
+
+    std::uint8_t encodedWeights[g_ASTCMaxWeights];
+    {
+        ASTCBlockBits reversedBlock;
+        reversedBlock.words[0] = ReverseBits64(block.words[1]);
+        reversedBlock.words[1] = ReverseBits64(block.words[0]);
+        DecodeASTCIntegerSequence(tables, reversedBlock, 0, numGridWeights * numPlanes, blockMode.quantMode, encodedWeights);
+    }
+
+    /* Unquantize weights into separate planes; the padding is only accessed with a zero infill factor */
+    std::uint8_t gridWeights[2][g_ASTCMaxWeights + g_ASTCMaxBlockDim + 1] = {};
+    for_range(i, numGridWeights)
+    {
+        for_range(plane, numPlanes)
+            gridWeights[plane][i] = tables.weightUnquant[blockMode.quantMode][encodedWeights[i * numPlanes + plane]];
+    }
+
+    /* Interpolate color endpoints for each texel */
+    const ASTCInfillTexel*  infillTable     = GetInfillTable(blockMode.weightsX, blockMode.weightsY);
+    const std::uint8_t*     partitionTable  = (numPartitions > 1 ? GetPartitionTable(numPartitions, partitionSeed) : nullptr);
+
+    for_range(i, numTexels_)
+    {
+        const ASTCInfillTexel& infill = infillTable[i];
+
+        std::uint32_t weights[2] = {};
+        for_range(plane, numPlanes)
+        {
+            const std::uint8_t* planeWeights = gridWeights[plane];
+            weights[plane] =
+            (
+                planeWeights[infill.indices[0]] * infill.factors[0] +
+                planeWeights[infill.indices[1]] * infill.factors[1] +
+                planeWeights[infill.indices[2]] * infill.factors[2] +
+                planeWeights[infill.indices[3]] * infill.factors[3] +
+                8
+            ) >> 4;
+        }
+
+        const std::uint32_t partition = (partitionTable != nullptr ? partitionTable[i] : 0);
+        for_range(c, 4u)
+        {
+            const std::uint32_t w   = weights[c == dualPlaneComponent ? 1 : 0];
+            const std::uint32_t c0  = endpoints[partition][0][c];
+            const std::uint32_t c1  = endpoints[partition][1][c];
+            dst[i][c] = static_cast<std::uint8_t>(((c0 * (64 - w) + c1 * w + 32) >> 6) >> 8);
+        }
+    }
+}
+
+
+/* ----- Functions ----- */
+
+static void DecompressASTCBlockRows(
+    const Extent2D&     extent,
+    const Extent2D&     blockExtent,
+    bool                isSRGB,
+    const std::uint8_t* src,
+    std::uint8_t*       dst,
+    std::size_t         blockRowBegin,
+    std::size_t         blockRowEnd)
+{
+    const ASTCDecoderTables& tables = ASTCDecoderTables::Get();
+
+    ASTCDecoderContext context{ blockExtent, isSRGB };
+
+    const std::uint32_t numBlocksX      = (extent.width + blockExtent.width - 1) / blockExtent.width;
+    const std::size_t   dstRowStride    = extent.width * 4;
+
+    std::uint8_t block[g_ASTCMaxTexels][4];
+
+    for_subrange(blockY, blockRowBegin, blockRowEnd)
+    {
+        const std::uint8_t* srcBlock    = src + blockY * numBlocksX * 16;
+        const std::uint32_t pixelY      = static_cast<std::uint32_t>(blockY) * blockExtent.height;
+        const std::uint32_t numRows     = std::min(blockExtent.height, extent.height - pixelY);
+
+        for_range(blockX, numBlocksX)
+        {
+            context.DecodeBlock(tables, srcBlock, block);
+
+            /* Copy decoded block into destination image and clip partial blocks at the image border */
+            const std::uint32_t pixelX      = blockX * blockExtent.width;
+            const std::uint32_t numColumns  = std::min(blockExtent.width, extent.width - pixelX);
+            std::uint8_t*       dstBlock    = dst + pixelY * dstRowStride + pixelX * 4;
+
+            for_range(y, numRows)
+                ::memcpy(dstBlock + y * dstRowStride, block[y * blockExtent.width], numColumns * 4);
+
+            srcBlock += 16;
+        }
+    }
+}
+
+bool DecompressASTCToRGBA8UNorm(
+    const Extent2D&         extent,
+    const Extent2D&         blockExtent,
+    bool                    isSRGB,
+    const char*             data,
+    std::size_t             dataSize,
+    const MutableImageView& dstImageView,
+    unsigned                threadCount)
+{
+    /* Return false on invalid arguments */
+    if (blockExtent.width < 4 || blockExtent.width > g_ASTCMaxBlockDim || blockExtent.height < 4 || blockExtent.height > g_ASTCMaxBlockDim)
+        return false;
+
+    const std::uint32_t numBlocksY  = (extent.height + blockExtent.height - 1) / blockExtent.height;
+    const std::size_t   numBlocks   = static_cast<std::size_t>((extent.width + blockExtent.width - 1) / blockExtent.width) * numBlocksY;
+    if (data == nullptr || dataSize < numBlocks * 16)
+        return false;
+
+    DoConcurrentRange(
+        [&extent, &blockExtent, isSRGB, data, &dstImageView](std::size_t begin, std::size_t end)
+        {
+            DecompressASTCBlockRows(
+                extent,
+                blockExtent,
+                isSRGB,
+                reinterpret_cast<const std::uint8_t*>(data),
+                reinterpret_cast<std::uint8_t*>(dstImageView.data),
+                begin,
+                end
+            );
+        },
+        numBlocksY,
+        threadCount,
+        /*threadMinWorkSize:*/ 4
+    );
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,49 @@
+/*
+ * ASTCDecompressor.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_ASTC_DECOMPRESSOR_H
+#define LLGL_ASTC_DECOMPRESSOR_H
+
+
+#include <LLGL/ImageFlags.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+struct Extent2D;
+
+/* ----- Functions ----- */
+
+/*
+Decompresses the specified ASTC encoded data with LDR profile into the destination image view in the Format::RGBA8UNorm format.
+The block footprint must be one of the 2D footprints from 4x4 to 12x12. Blocks that are illegal in the LDR profile decode to the error color magenta.
+If 'isSRGB' is true, endpoints are expanded for sRGB formats and the color components are returned in non-linear sRGB color space.
+Width and height of the input image don't need to be a multiple of the block footprint; partial blocks are clipped.
+Returns false if the source data is too small. The destination image view must be ImageFormat::RGBA with DataType::UInt8.
+*/
+bool DecompressASTCToRGBA8UNorm(
+    const Extent2D&         extent,
+    const Extent2D&         blockExtent,
+    bool                    isSRGB,
+    const char*             data,
+    std::size_t             dataSize,
+    const MutableImageView& dstImageView,
+    unsigned                threadCount = 0
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,567 @@
+/*
+ * Allocator.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Allocator.h>
+#include <LLGL/Trap.h>
+#include "MemoryAllocation.h"
+#include "CoreUtils.h"
+#include "Assertion.h"
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <stdlib.h>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Default heap allocation
+ */
+
+static bool IsOverAligned(std::size_t alignment)
+{
+    return (alignment > alignof(std::max_align_t));
+}
+
+// Allocates memory from the C heap. Over-aligned memory blocks store the address of the underlying heap block right in front of the aligned address.
+static void* HeapAllocate(std::size_t size, std::size_t alignment)
+{
+    if (!IsOverAligned(alignment))
+        return ::malloc(size);
+
+    void* mem = ::malloc(size + alignment - 1 + sizeof(void*));
+    if (mem == nullptr)
+        return nullptr;
+
+    const std::uintptr_t addr = GetAlignedSize<std::uintptr_t>(reinterpret_cast<std::uintptr_t>(mem) + sizeof(void*), alignment);
+    reinterpret_cast<void**>(addr)[-1] = mem;
+    return reinterpret_cast<void*>(addr);
+}
+
+static void HeapFree(void* ptr, std::size_t alignment)
+{
+    if (!IsOverAligned(alignment))
+        ::free(ptr);
+    else
+        ::free(reinterpret_cast<void**>(ptr)[-1]);
+}
+
+// Copies the memory block into a new one and frees the old memory block. The old memory block remains valid if the allocation failed.
+static void* CopyReallocate(Allocator* allocator, void* ptr, std::size_t oldSize, std::size_t newSize, std::size_t alignment, AllocationCategory category)
+{
+    void* newPtr = (allocator != nullptr ? allocator->Allocate(newSize, alignment, category) : HeapAllocate(newSize, alignment));
+    if (newPtr != nullptr)
+    {
+        ::memcpy(newPtr, ptr, std::min(oldSize, newSize));
+        if (allocator != nullptr)
+            allocator->Free(ptr, oldSize, alignment, category);
+        else
+            HeapFree(ptr, alignment);
+    }
+    return newPtr;
+}
+
+static void* HeapReallocate(void* ptr, std::size_t oldSize, std::size_t newSize, std::size_t alignment)
+{
+    if (!IsOverAligned(alignment))
+        return ::realloc(ptr, newSize);
+    else
+        return CopyReallocate(nullptr, ptr, oldSize, newSize, alignment, AllocationCategory::Object);
+}
+
+
+/*
+ * Allocator class
+ */
+
+void* Allocator::Reallocate(void* ptr, std::size_t oldSize, std::size_t newSize, std::size_t alignment, AllocationCategory category)
+{
+    return CopyReallocate(this, ptr, oldSize, newSize, alignment, category);
+}
+
+
+/*
+ * Allocation routing
+ */
+
+struct AllocationUsageCounters
+{
+    std::atomic<std::uint64_t> currentSize;
+    std::atomic<std::uint64_t> peakSize;
+    std::atomic<std::uint64_t> numAllocations;
+    std::atomic<std::uint64_t> totalAllocations;
+};
+
+static constexpr std::size_t g_numAllocationCategories = static_cast<std::size_t>(AllocationCategory::Native) + 1;
+
+static AllocationUsageCounters  g_allocationUsage[g_numAllocationCategories];
+
+// Active allocator of all living render systems; null refers to the default heap allocation.
+static std::atomic<Allocator*>  g_activeAllocator{ nullptr };
+static std::mutex               g_activeAllocatorMutex;
+static std::size_t              g_activeAllocatorRefCount = 0;
+
+static AllocationUsageCounters& GetAllocationUsageCounters(AllocationCategory category)
+{
+    const std::size_t index = static_cast<std::size_t>(category);
+    LLGL_ASSERT(index < g_numAllocationCategories);
+    return g_allocationUsage[index];
+}
+
+// Adds the specified number of bytes to the current size and updates the peak size.
+static void RecordAllocationSize(AllocationUsageCounters& usage, std::size_t size)
+{
+    const std::uint64_t newSize = usage.currentSize.fetch_add(size) + size;
+    std::uint64_t peakSize = usage.peakSize.load();
+    while (newSize > peakSize && !usage.peakSize.compare_exchange_weak(peakSize, newSize))
+    {
+        /* Retry with updated peak size */
+    }
+}
+
+LLGL_EXPORT void* TryAllocateMemory(std::size_t size, std::size_t alignment, AllocationCategory category)
+{
+    Allocator* allocator = g_activeAllocator.load(std::memory_order_acquire);
+    void* ptr = (allocator != nullptr ? allocator->Allocate(size, alignment, category) : HeapAllocate(size, alignment));
+    if (ptr == nullptr)
+        return nullptr;
+
+    AllocationUsageCounters& usage = GetAllocationUsageCounters(category);
+    RecordAllocationSize(usage, size);
+    usage.numAllocations.fetch_add(1);
+    usage.totalAllocations.fetch_add(1);
+
+    return ptr;
+}
+
+LLGL_EXPORT void* AllocateMemory(std::size_t size, std::size_t alignment, AllocationCategory category)
+{
+    void* ptr = TryAllocateMemory(size, alignment, category);
+    if (ptr == nullptr)
+        LLGL_THROW_RUNTIME_ERROR("failed to allocate %zu bytes with alignment %zu", size, alignment);
+    return ptr;
+}
+
+LLGL_EXPORT void* ReallocateMemory(void* ptr, std::size_t oldSize, std::size_t newSize, std::size_t alignment, AllocationCategory category)
+{
+    Allocator* allocator = g_activeAllocator.load(std::memory_order_acquire);
+    void* newPtr = (allocator != nullptr ? allocator->Reallocate(ptr, oldSize, newSize, alignment, category) : HeapReallocate(ptr, oldSize, newSize, alignment));
+    if (newPtr == nullptr)
+        return nullptr;
+
+    AllocationUsageCounters& usage = GetAllocationUsageCounters(category);
+    if (newSize > oldSize)
+        RecordAllocationSize(usage, newSize - oldSize);
+    else
+        usage.currentSize.fetch_sub(oldSize - newSize);
+
+    return newPtr;
+}
+
+LLGL_EXPORT void FreeMemory(void* ptr, std::size_t size, std::size_t alignment, AllocationCategory category)
+{
+    if (ptr == nullptr)
+        return;
+
+    Allocator* allocator = g_activeAllocator.load(std::memory_order_acquire);
+    if (allocator != nullptr)
+        allocator->Free(ptr, size, alignment, category);
+    else
+        HeapFree(ptr, alignment);
+
+    AllocationUsageCounters& usage = GetAllocationUsageCounters(category);
+    usage.currentSize.fetch_sub(size);
+    usage.numAllocations.fetch_sub(1);
+}
+
+LLGL_EXPORT bool AcquireAllocator(Allocator* allocator)
+{
+    std::lock_guard<std::mutex> guard{ g_activeAllocatorMutex };
+    if (g_activeAllocatorRefCount > 0 && g_activeAllocator.load() != allocator)
+        return false;
+    g_activeAllocator.store(allocator, std::memory_order_release);
+    ++g_activeAllocatorRefCount;
+    return true;
+}
+
+LLGL_EXPORT void ReleaseAllocator()
+{
+    std::lock_guard<std::mutex> guard{ g_activeAllocatorMutex };
+    LLGL_ASSERT(g_activeAllocatorRefCount > 0);
+    if (--g_activeAllocatorRefCount == 0)
+        g_activeAllocator.store(nullptr, std::memory_order_release);
+}
+
+LLGL_EXPORT AllocationUsage GetAllocationUsage(const AllocationCategory category)
+{
+    const AllocationUsageCounters& counters = GetAllocationUsageCounters(category);
+    AllocationUsage usage;
+    {
+        usage.currentSize       = counters.currentSize.load();
+        usage.peakSize          = counters.peakSize.load();
+        usage.numAllocations    = counters.numAllocations.load();
+        usage.totalAllocations  = counters.totalAllocations.load();
+    }
+    return usage;
+}
+
+
+/*
+ * FrameArenaAllocator class
+ */
+
+// Minimum alignment of each arena block.
+static constexpr std::size_t g_arenaBlockAlignment = alignof(std::max_align_t);
+
+struct FrameArenaAllocator::Pimpl
+{
+    struct Block
+    {
+        char*       data;
+        std::size_t size;
+    };
+
+    // Range of freed memory within a block that is not at the top of the arena.
+    struct FreeRange
+    {
+        std::size_t block;
+        char*       data;
+        std::size_t size;
+    };
+
+    // Linear memory arena for a single allocation category.
+    struct Arena
+    {
+        mutable std::mutex      mutex;
+        AllocationCategory      category        = AllocationCategory::Transient;
+        std::vector<Block>      blocks;
+        std::vector<FreeRange>  freeRanges;                 // Sorted by block index and address.
+        std::size_t             blockIndex      = 0;
+        std::size_t             blockOffset     = 0;
+        std::size_t             numAllocations  = 0;
+    };
+
+    std::size_t blockSize       = 0;
+    Allocator*  upstream        = nullptr;
+    Arena       transientArena;
+    Arena       commandBufferArena;
+
+    Arena* GetArena(AllocationCategory category)
+    {
+        switch (category)
+        {
+            case AllocationCategory::Transient:     return &transientArena;
+            case AllocationCategory::CommandBuffer: return &commandBufferArena;
+            default:                                return nullptr;
+        }
+    }
+
+    void* AllocateUpstream(std::size_t size, std::size_t alignment, AllocationCategory category)
+    {
+        return (upstream != nullptr ? upstream->Allocate(size, alignment, category) : HeapAllocate(size, alignment));
+    }
+
+    void FreeUpstream(void* ptr, std::size_t size, std::size_t alignment, AllocationCategory category)
+    {
+        if (upstream != nullptr)
+            upstream->Free(ptr, size, alignment, category);
+        else
+            HeapFree(ptr, alignment);
+    }
+
+    void* ReallocateUpstream(void* ptr, std::size_t oldSize, std::size_t newSize, std::size_t alignment, AllocationCategory category)
+    {
+        return (upstream != nullptr ? upstream->Reallocate(ptr, oldSize, newSize, alignment, category) : HeapReallocate(ptr, oldSize, newSize, alignment));
+    }
+
+    bool AllocateBlock(Arena& arena, std::size_t size)
+    {
+        char* data = static_cast<char*>(AllocateUpstream(size, g_arenaBlockAlignment, arena.category));
+        if (data == nullptr)
+            return false;
+        arena.blocks.push_back(Block{ data, size });
+        return true;
+    }
+
+    void ReleaseBlocks(Arena& arena)
+    {
+        for (const Block& block : arena.blocks)
+            FreeUpstream(block.data, block.size, g_arenaBlockAlignment, arena.category);
+        arena.blocks.clear();
+    }
+
+    // Rewinds the arena and merges all blocks into a single one, so the next frame fits into one consecutive block.
+    void Reset(Arena& arena)
+    {
+        if (arena.blocks.size() > 1)
+        {
+            std::size_t totalSize = 0;
+            for (const Block& block : arena.blocks)
+                totalSize += block.size;
+            ReleaseBlocks(arena);
+            AllocateBlock(arena, totalSize);
+        }
+        arena.freeRanges.clear();
+        arena.blockIndex  = 0;
+        arena.blockOffset = 0;
+    }
+
+    // Returns the index of the block that contains the specified memory.
+    std::size_t FindBlock(const Arena& arena, const void* ptr) const
+    {
+        for (std::size_t i = 0; i < arena.blocks.size(); ++i)
+        {
+            const Block& block = arena.blocks[i];
+            if (static_cast<const char*>(ptr) >= block.data && static_cast<const char*>(ptr) < block.data + block.size)
+                return i;
+        }
+        LLGL_TRAP("memory does not belong to any block of the arena");
+    }
+
+    // Inserts the specified range into the free list and merges it with adjacent ranges of the same block.
+    void InsertFreeRange(Arena& arena, std::size_t blockIndex, char* data, std::size_t size)
+    {
+        if (size == 0)
+            return;
+
+        auto it = std::lower_bound(
+            arena.freeRanges.begin(), arena.freeRanges.end(), FreeRange{ blockIndex, data, size },
+            [](const FreeRange& lhs, const FreeRange& rhs) -> bool
+            {
+                return (lhs.block < rhs.block || (lhs.block == rhs.block && lhs.data < rhs.data));
+            }
+        );
+
+        /* Merge with next range */
+        if (it != arena.freeRanges.end() && it->block == blockIndex && data + size == it->data)
+        {
+            it->data  = data;
+            it->size += size;
+        }
+        else
+            it = arena.freeRanges.insert(it, FreeRange{ blockIndex, data, size });
+
+        /* Merge with previous range */
+        if (it != arena.freeRanges.begin())
+        {
+            auto prev = it - 1;
+            if (prev->block == blockIndex && prev->data + prev->size == it->data)
+            {
+                prev->size += it->size;
+                arena.freeRanges.erase(it);
+            }
+        }
+    }
+
+    // Takes the best fitting range from the free list and splits off the unused memory before and after the allocation.
+    void* AllocateFromFreeRanges(Arena& arena, std::size_t size, std::size_t alignment)
+    {
+        auto        bestIt      = arena.freeRanges.end();
+        char*       bestAddr    = nullptr;
+
+        for (auto it = arena.freeRanges.begin(); it != arena.freeRanges.end(); ++it)
+        {
+            const std::uintptr_t rangeAddr = reinterpret_cast<std::uintptr_t>(it->data);
+            char* addr = reinterpret_cast<char*>(GetAlignedSize<std::uintptr_t>(rangeAddr, alignment));
+            if (addr + size <= it->data + it->size && (bestIt == arena.freeRanges.end() || it->size < bestIt->size))
+            {
+                bestIt   = it;
+                bestAddr = addr;
+            }
+        }
+
+        if (bestIt == arena.freeRanges.end())
+            return nullptr;
+
+        const FreeRange range = *bestIt;
+        arena.freeRanges.erase(bestIt);
+
+        InsertFreeRange(arena, range.block, range.data, static_cast<std::size_t>(bestAddr - range.data));
+        InsertFreeRange(arena, range.block, bestAddr + size, static_cast<std::size_t>((range.data + range.size) - (bestAddr + size)));
+
+        ++arena.numAllocations;
+        return bestAddr;
+    }
+
+    // Rewinds the top of the arena over all free ranges that end at the current offset.
+    void RewindFreeRanges(Arena& arena)
+    {
+        while (!arena.freeRanges.empty())
+        {
+            const FreeRange& range = arena.freeRanges.back();
+            if (range.block != arena.blockIndex || range.data + range.size != arena.blocks[arena.blockIndex].data + arena.blockOffset)
+                break;
+            arena.blockOffset -= range.size;
+            arena.freeRanges.pop_back();
+        }
+    }
+
+    // Returns true if the specified memory block is the most recent allocation of the arena, i.e. it ends at the current offset.
+    bool IsTopAllocation(const Arena& arena, const void* ptr, std::size_t size) const
+    {
+        if (arena.blockIndex < arena.blocks.size())
+        {
+            const Block& block = arena.blocks[arena.blockIndex];
+            return (static_cast<const char*>(ptr) + size == block.data + arena.blockOffset);
+        }
+        return false;
+    }
+
+    void* ArenaAllocate(Arena& arena, std::size_t size, std::size_t alignment)
+    {
+        /* Reuse memory that has been freed out of order before the arena grows */
+        if (void* ptr = AllocateFromFreeRanges(arena, size, alignment))
+            return ptr;
+
+        /* Find next block with enough space left, starting at the current block */
+        for (; arena.blockIndex < arena.blocks.size(); ++arena.blockIndex, arena.blockOffset = 0)
+        {
+            const Block& block = arena.blocks[arena.blockIndex];
+            const std::uintptr_t blockAddr = reinterpret_cast<std::uintptr_t>(block.data);
+            const std::size_t offset = static_cast<std::size_t>(GetAlignedSize<std::uintptr_t>(blockAddr + arena.blockOffset, alignment) - blockAddr);
+            if (offset + size <= block.size)
+            {
+                InsertFreeRange(arena, arena.blockIndex, block.data + arena.blockOffset, offset - arena.blockOffset);
+                arena.blockOffset = offset + size;
+                ++arena.numAllocations;
+                return block.data + offset;
+            }
+
+            /* Keep remaining space of skipped block for later allocations */
+            InsertFreeRange(arena, arena.blockIndex, block.data + arena.blockOffset, block.size - arena.blockOffset);
+        }
+
+        /* Append new block that is large enough for this allocation; blocks are aligned to at least max_align_t */
+        const std::size_t blockAlignmentPadding = (IsOverAligned(alignment) ? alignment - 1 : 0);
+        if (!AllocateBlock(arena, std::max(blockSize, size + blockAlignmentPadding)))
+            return nullptr;
+
+        const Block& block = arena.blocks.back();
+        const std::uintptr_t addr = GetAlignedSize<std::uintptr_t>(reinterpret_cast<std::uintptr_t>(block.data), alignment);
+        arena.blockIndex  = arena.blocks.size() - 1;
+        arena.blockOffset = static_cast<std::size_t>(addr - reinterpret_cast<std::uintptr_t>(block.data)) + size;
+        ++arena.numAllocations;
+
+        return reinterpret_cast<void*>(addr);
+    }
+
+    void ArenaFree(Arena& arena, void* ptr, std::size_t size)
+    {
+        LLGL_ASSERT(arena.numAllocations > 0);
+        if (--arena.numAllocations == 0)
+        {
+            Reset(arena);
+            return;
+        }
+
+        /* Give memory of the most recent allocation back to the arena; all other memory is kept in the free list for reuse */
+        if (IsTopAllocation(arena, ptr, size))
+        {
+            arena.blockOffset = static_cast<std::size_t>(static_cast<char*>(ptr) - arena.blocks[arena.blockIndex].data);
+            RewindFreeRanges(arena);
+        }
+        else
+            InsertFreeRange(arena, FindBlock(arena, ptr), static_cast<char*>(ptr), size);
+    }
+
+    void* ArenaReallocate(Arena& arena, void* ptr, std::size_t oldSize, std::size_t newSize, std::size_t alignment)
+    {
+        /* Grow or shrink the most recent allocation in place if it still fits into its block */
+        if (IsTopAllocation(arena, ptr, oldSize))
+        {
+            const Block& block = arena.blocks[arena.blockIndex];
+            const std::size_t offset = static_cast<std::size_t>(static_cast<char*>(ptr) - block.data);
+            if (offset + newSize <= block.size)
+            {
+                arena.blockOffset = offset + newSize;
+                return ptr;
+            }
+        }
+
+        /* Otherwise, move the content into a new allocation */
+        void* newPtr = ArenaAllocate(arena, newSize, alignment);
+        if (newPtr != nullptr)
+        {
+            ::memcpy(newPtr, ptr, std::min(oldSize, newSize));
+            ArenaFree(arena, ptr, oldSize);
+        }
+        return newPtr;
+    }
+};
+
+FrameArenaAllocator::FrameArenaAllocator(std::size_t blockSize, Allocator* upstream) :
+    pimpl_ { new Pimpl{} }
+{
+    pimpl_->blockSize                   = std::max<std::size_t>(blockSize, g_arenaBlockAlignment);
+    pimpl_->upstream                    = upstream;
+    pimpl_->transientArena.category     = AllocationCategory::Transient;
+    pimpl_->commandBufferArena.category = AllocationCategory::CommandBuffer;
+}
+
+FrameArenaAllocator::~FrameArenaAllocator()
+{
+    LLGL_ASSERT(pimpl_->transientArena.numAllocations == 0, "transient allocations still in use");
+    LLGL_ASSERT(pimpl_->commandBufferArena.numAllocations == 0, "command buffer allocations still in use");
+    pimpl_->ReleaseBlocks(pimpl_->transientArena);
+    pimpl_->ReleaseBlocks(pimpl_->commandBufferArena);
+    delete pimpl_;
+}
+
+void* FrameArenaAllocator::Allocate(std::size_t size, std::size_t alignment, AllocationCategory category)
+{
+    if (Pimpl::Arena* arena = pimpl_->GetArena(category))
+    {
+        std::lock_guard<std::mutex> guard{ arena->mutex };
+        return pimpl_->ArenaAllocate(*arena, size, alignment);
+    }
+    return pimpl_->AllocateUpstream(size, alignment, category);
+}
+
+void FrameArenaAllocator::Free(void* ptr, std::size_t size, std::size_t alignment, AllocationCategory category)
+{
+    if (Pimpl::Arena* arena = pimpl_->GetArena(category))
+    {
+        std::lock_guard<std::mutex> guard{ arena->mutex };
+        pimpl_->ArenaFree(*arena, ptr, size);
+    }
+    else
+        pimpl_->FreeUpstream(ptr, size, alignment, category);
+}
+
+void* FrameArenaAllocator::Reallocate(void* ptr, std::size_t oldSize, std::size_t newSize, std::size_t alignment, AllocationCategory category)
+{
+    if (Pimpl::Arena* arena = pimpl_->GetArena(category))
+    {
+        std::lock_guard<std::mutex> guard{ arena->mutex };
+        return pimpl_->ArenaReallocate(*arena, ptr, oldSize, newSize, alignment);
+    }
+    return pimpl_->ReallocateUpstream(ptr, oldSize, newSize, alignment, category);
+}
+
+std::size_t FrameArenaAllocator::GetCapacity(const AllocationCategory category) const
+{
+    if (const Pimpl::Arena* arena = pimpl_->GetArena(category))
+    {
+        std::lock_guard<std::mutex> guard{ arena->mutex };
+        std::size_t capacity = 0;
+        for (const Pimpl::Block& block : arena->blocks)
+            capacity += block.size;
+        return capacity;
+    }
+    return 0;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,799 @@
+/*
+ * BCCompressor.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "BCCompressor.h"
+#include "Threading.h"
+#include <LLGL/Types.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+#include <cfloat>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Source pixels of a single 4x4 block in RGBA8 format.
+struct BCSourceBlock
+{
+    std::uint8_t rgba[16][4];
+};
+
+// Encoded BC1 color block with its squared error against the source block.
+struct BCColorBlock
+{
+    std::uint16_t color0;
+    std::uint16_t color1;
+    std::uint32_t indices;
+    std::uint32_t error;
+};
+
+// Encoded BC4 channel block with its squared error against the source block.
+struct BCChannelBlock
+{
+    std::uint8_t  value0;
+    std::uint8_t  value1;
+    std::uint64_t indices;
+    std::uint32_t error;
+};
+
+static void FetchSourceBlock(
+    BCSourceBlock&      block,
+    const std::uint8_t* src,
+    std::size_t         srcRowStride,
+    const Extent2D&     extent,
+    std::uint32_t       blockX,
+    std::uint32_t       blockY)
+{
+    /* Clamp coordinates to the image border to pad partial blocks */
+    for_range(y, 4u)
+    {
+        const std::uint32_t srcY = std::min(blockY * 4 + y, extent.height - 1);
+        const std::uint8_t* srcRow = src + srcY * srcRowStride;
+        for_range(x, 4u)
+        {
+            const std::uint32_t srcX = std::min(blockX * 4 + x, extent.width - 1);
+            ::memcpy(block.rgba[y * 4 + x], srcRow + srcX * 4, 4);
+        }
+    }
+}
+
+
+/*
+ * Color block encoding (BC1, BC3)
+ */
+
+static int QuantizeComponent(float value, int maxValue)
+{
+    const int quantized = static_cast<int>(value * static_cast<float>(maxValue) / 255.0f + 0.5f);
+    return std::max(0, std::min(quantized, maxValue));
+}
+
+static std::uint16_t QuantizeRGB565(const float (&color)[3])
+{
+    return static_cast<std::uint16_t>(
+        (QuantizeComponent(color[0], 31) << 11) |
+        (QuantizeComponent(color[1], 63) <<  5) |
+        (QuantizeComponent(color[2], 31)      )
+    );
+}
+
+// Expands an RGB565 color like the decoder does, i.e. by replicating the upper bits into the lower bits.
+static void ExpandRGB565(std::uint16_t color, int (&rgb)[3])
+{
+    const int r = (color >> 11) & 0x1F;
+    const int g = (color >>  5) & 0x3F;
+    const int b = (color      ) & 0x1F;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+// Lookup tables to snap a color component in the range [0, 255] to the nearest value that is representable with 5 or 6 bits.
+struct RGB565GridTables
+{
+    RGB565GridTables()
+    {
+        for_range(i, 256)
+        {
+            const int quantized5 = QuantizeComponent(static_cast<float>(i), 31);
+            const int quantized6 = QuantizeComponent(static_cast<float>(i), 63);
+            grid[0][i] = static_cast<float>((quantized5 << 3) | (quantized5 >> 2));
+            grid[1][i] = static_cast<float>((quantized6 << 2) | (quantized6 >> 4));
+        }
+    }
+
+    float grid[2][256];
+};
+
+static const RGB565GridTables g_RGB565GridTables;
+
+// Snaps a color component to the nearest value that is representable in the RGB565 format.
+static float SnapComponentToGrid(float value, std::uint32_t component)
+{
+    const int index = static_cast<int>(std::max(0.0f, std::min(value, 255.0f)) + 0.5f);
+    return g_RGB565GridTables.grid[component == 1 ? 1 : 0][index];
+}
+
+static void BuildColorPalette(int (&palette)[4][3], std::uint16_t color0, std::uint16_t color1, bool threeColorMode)
+{
+    ExpandRGB565(color0, palette[0]);
+    ExpandRGB565(color1, palette[1]);
+
+    if (threeColorMode)
+    {
+        for_range(c, 3)
+        {
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+        }
+    }
+    else
+    {
+        for_range(c, 3)
+        {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c] + 1) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c] + 1) / 3;
+        }
+    }
+}
+
+// Selects the nearest palette entry for each opaque pixel; pixels in 'transparentMask' always select index 3 (three-color mode only).
+static void FindColorIndices(BCColorBlock& result, const BCSourceBlock& block, const int (&palette)[4][3], std::uint32_t numColors, std::uint32_t transparentMask)
+{
+    result.indices  = 0;
+    result.error    = 0;
+
+    for_range(i, 16u)
+    {
+        std::uint32_t bestIndex = 3;
+
+        if ((transparentMask & (1u << i)) == 0)
+        {
+            std::uint32_t bestError = UINT32_MAX;
+            for_range(j, numColors)
+            {
+                const int dr = static_cast<int>(block.rgba[i][0]) - palette[j][0];
+                const int dg = static_cast<int>(block.rgba[i][1]) - palette[j][1];
+                const int db = static_cast<int>(block.rgba[i][2]) - palette[j][2];
+                const std::uint32_t error = static_cast<std::uint32_t>(dr*dr + dg*dg + db*db);
+                if (error < bestError)
+                {
+                    bestError = error;
+                    bestIndex = j;
+                }
+            }
+            result.error += bestError;
+        }
+
+        result.indices |= (bestIndex << (i * 2));
+    }
+}
+
+// Encodes the color block for the two specified endpoints. The endpoints are swapped as required by the respective color mode.
+static BCColorBlock EncodeColorEndpoints(const BCSourceBlock& block, const float (&endpointA)[3], const float (&endpointB)[3], std::uint32_t transparentMask)
+{
+    const bool threeColorMode = (transparentMask != 0);
+
+    BCColorBlock result;
+    result.color0 = QuantizeRGB565(endpointA);
+    result.color1 = QuantizeRGB565(endpointB);
+
+    /* Four-color mode requires color0 > color1, three-color mode requires color0 <= color1 */
+    if (threeColorMode ? (result.color0 > result.color1) : (result.color0 < result.color1))
+        std::swap(result.color0, result.color1);
+
+    int palette[4][3];
+    BuildColorPalette(palette, result.color0, result.color1, threeColorMode);
+
+    if (!threeColorMode && result.color0 == result.color1)
+    {
+        /* Identical endpoints are decoded in three-color mode, so only the first palette entry is reliable */
+        FindColorIndices(result, block, palette, 1, 0);
+    }
+    else
+        FindColorIndices(result, block, palette, (threeColorMode ? 3 : 4), transparentMask);
+
+    return result;
+}
+
+// Computes the mean and the principal axis (i.e. the eigenvector with the largest eigenvalue of the covariance matrix) via power iteration.
+static void ComputePrincipalAxis(const float (*points)[3], std::uint32_t numPoints, float (&mean)[3], float (&axis)[3])
+{
+    mean[0] = mean[1] = mean[2] = 0.0f;
+    for_range(i, numPoints)
+    {
+        for_range(c, 3)
+            mean[c] += points[i][c];
+    }
+    for_range(c, 3)
+        mean[c] /= static_cast<float>(numPoints);
+
+    /* Build symmetric covariance matrix */
+    float cov[6] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+    for_range(i, numPoints)
+    {
+        const float r = points[i][0] - mean[0];
+        const float g = points[i][1] - mean[1];
+        const float b = points[i][2] - mean[2];
+        cov[0] += r*r;
+        cov[1] += r*g;
+        cov[2] += r*b;
+        cov[3] += g*g;
+        cov[4] += g*b;
+        cov[5] += b*b;
+    }
+
+    /* Start power iteration with the covariance column of the largest variance, which cannot be orthogonal to the principal axis */
+    if (cov[0] >= cov[3] && cov[0] >= cov[5])
+    {
+        axis[0] = cov[0];
+        axis[1] = cov[1];
+        axis[2] = cov[2];
+    }
+    else if (cov[3] >= cov[5])
+    {
+        axis[0] = cov[1];
+        axis[1] = cov[3];
+        axis[2] = cov[4];
+    }
+    else
+    {
+        axis[0] = cov[2];
+        axis[1] = cov[4];
+        axis[2] = cov[5];
+    }
+
+    if (std::max(std::abs(axis[0]), std::max(std::abs(axis[1]), std::abs(axis[2]))) < FLT_EPSILON)
+        axis[0] = axis[1] = axis[2] = 1.0f;
+
+    for_range(iteration, 8)
+    {
+        const float x = axis[0]*cov[0] + axis[1]*cov[1] + axis[2]*cov[2];
+        const float y = axis[0]*cov[1] + axis[1]*cov[3] + axis[2]*cov[4];
+        const float z = axis[0]*cov[2] + axis[1]*cov[4] + axis[2]*cov[5];
+        const float maxComponent = std::max(std::abs(x), std::max(std::abs(y), std::abs(z)));
+        if (maxComponent < FLT_EPSILON)
+            break;
+        axis[0] = x / maxComponent;
+        axis[1] = y / maxComponent;
+        axis[2] = z / maxComponent;
+    }
+
+    const float length = std::sqrt(axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2]);
+    if (length > FLT_EPSILON)
+    {
+        for_range(c, 3)
+            axis[c] /= length;
+    }
+}
+
+// Least squares factors for every partition of 16 ordered points into four consecutive clusters (weighted 1, 2/3, 1/3, and 0 towards endpoint A).
+struct ClusterFitTables
+{
+    struct Partition
+    {
+        std::uint8_t    end0;       // End of first cluster
+        std::uint8_t    end1;       // End of second cluster
+        std::uint8_t    end2;       // End of third cluster
+        float           alpha2;     // Sum of squared weights for endpoint A
+        float           beta2;      // Sum of squared weights for endpoint B
+        float           alphaBeta;  // Sum of mixed weights
+        float           invDet;     // Inverse determinant of the 2x2 normal equations
+    };
+
+    ClusterFitTables()
+    {
+        for_range(i, 17)
+        {
+            for_subrange(j, i, 17)
+            {
+                for_subrange(k, j, 17)
+                {
+                    const float n0 = static_cast<float>(i);
+                    const float n1 = static_cast<float>(j - i);
+                    const float n2 = static_cast<float>(k - j);
+                    const float n3 = static_cast<float>(16 - k);
+
+                    Partition& partition = partitions[numPartitions];
+                    {
+                        partition.end0      = static_cast<std::uint8_t>(i);
+                        partition.end1      = static_cast<std::uint8_t>(j);
+                        partition.end2      = static_cast<std::uint8_t>(k);
+                        partition.alpha2    = n0 + n1 * (4.0f/9.0f) + n2 * (1.0f/9.0f);
+                        partition.beta2     = n3 + n2 * (4.0f/9.0f) + n1 * (1.0f/9.0f);
+                        partition.alphaBeta = (n1 + n2) * (2.0f/9.0f);
+                    }
+
+                    /* Skip degenerate partitions, i.e. where all points are in a single cluster */
+                    const float det = partition.alpha2 * partition.beta2 - partition.alphaBeta * partition.alphaBeta;
+                    if (std::abs(det) >= FLT_EPSILON)
+                    {
+                        partition.invDet = 1.0f / det;
+                        ++numPartitions;
+                    }
+                }
+            }
+        }
+    }
+
+    Partition       partitions[969];
+    std::uint32_t   numPartitions = 0;
+};
+
+static const ClusterFitTables g_clusterFitTables;
+
+/*
+Cluster fit: the points are sorted along the principal axis and every partition into four consecutive clusters
+is evaluated with a least squares solve for both endpoints. The endpoints are snapped to the RGB565 grid before the error is estimated.
+Only solutions with a squared error less than 'maxError' are considered, which allows partitions to be skipped early.
+*/
+static bool ClusterFitColorEndpoints(
+    const float (&points)[16][3],
+    const float (&mean)[3],
+    const float (&axis)[3],
+    float       maxError,
+    float       (&outEndpointA)[3],
+    float       (&outEndpointB)[3])
+{
+    /* Sort points by their projection onto the principal axis (descending, so that the first cluster is closest to endpoint A) */
+    std::uint32_t order[16];
+    float projections[16];
+
+    for_range(i, 16u)
+    {
+        order[i] = i;
+        projections[i] =
+        (
+            (points[i][0] - mean[0]) * axis[0] +
+            (points[i][1] - mean[1]) * axis[1] +
+            (points[i][2] - mean[2]) * axis[2]
+        );
+    }
+
+    std::sort(
+        order,
+        order + 16,
+        [&projections](std::uint32_t lhs, std::uint32_t rhs)
+        {
+            return (projections[lhs] > projections[rhs]);
+        }
+    );
+
+    /* Build prefix sums of sorted points */
+    float prefixSums[17][3];
+    prefixSums[0][0] = prefixSums[0][1] = prefixSums[0][2] = 0.0f;
+
+    for_range(i, 16u)
+    {
+        for_range(c, 3)
+            prefixSums[i + 1][c] = prefixSums[i][c] + points[order[i]][c];
+    }
+
+    /* Errors are compared without the constant term of the squared source colors */
+    float sumSquares = 0.0f;
+    for_range(i, 16u)
+        sumSquares += points[i][0]*points[i][0] + points[i][1]*points[i][1] + points[i][2]*points[i][2];
+
+    float bestError = maxError - sumSquares;
+    bool hasSolution = false;
+
+    for_range(partitionIndex, g_clusterFitTables.numPartitions)
+    {
+        const ClusterFitTables::Partition& partition = g_clusterFitTables.partitions[partitionIndex];
+
+        float alphaX[3], betaX[3], a[3], b[3];
+
+        /* Solve least squares for unconstrained endpoints */
+        float minError = 0.0f;
+
+        for_range(c, 3)
+        {
+            const float sum0 = prefixSums[partition.end0][c];
+            const float sum1 = prefixSums[partition.end1][c] - sum0;
+            const float sum2 = prefixSums[partition.end2][c] - prefixSums[partition.end1][c];
+            const float sum3 = prefixSums[16][c] - prefixSums[partition.end2][c];
+
+            alphaX[c]   = sum0 + sum1 * (2.0f/3.0f) + sum2 * (1.0f/3.0f);
+            betaX[c]    = sum3 + sum2 * (2.0f/3.0f) + sum1 * (1.0f/3.0f);
+
+            a[c] = (alphaX[c] * partition.beta2 - betaX[c] * partition.alphaBeta) * partition.invDet;
+            b[c] = (betaX[c] * partition.alpha2 - alphaX[c] * partition.alphaBeta) * partition.invDet;
+
+            minError -= a[c] * alphaX[c] + b[c] * betaX[c];
+        }
+
+        /* The unconstrained solution is a lower bound for the error, so this partition can be skipped if it cannot improve the result */
+        if (minError >= bestError)
+            continue;
+
+        /* Snap endpoints to RGB565 grid and determine squared error without the constant term */
+        float error = 0.0f;
+
+        for_range(c, 3)
+        {
+            a[c] = SnapComponentToGrid(a[c], c);
+            b[c] = SnapComponentToGrid(b[c], c);
+
+            error +=
+            (
+                a[c]*a[c]*partition.alpha2 + b[c]*b[c]*partition.beta2 +
+                2.0f*(a[c]*b[c]*partition.alphaBeta - a[c]*alphaX[c] - b[c]*betaX[c])
+            );
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            hasSolution = true;
+            for_range(c, 3)
+            {
+                outEndpointA[c] = a[c];
+                outEndpointB[c] = b[c];
+            }
+        }
+    }
+
+    return hasSolution;
+}
+
+static void EncodeColorBlock(std::uint8_t* dst, const BCSourceBlock& block, bool allowThreeColorMode, ImageCompressionQuality quality)
+{
+    /* Gather opaque pixels; in BC1 pixels with alpha less than 128 are encoded as transparent black in three-color mode */
+    float points[16][3];
+    std::uint32_t numPoints = 0;
+    std::uint32_t transparentMask = 0;
+
+    for_range(i, 16u)
+    {
+        if (allowThreeColorMode && block.rgba[i][3] < 128)
+            transparentMask |= (1u << i);
+        else
+        {
+            for_range(c, 3)
+                points[numPoints][c] = static_cast<float>(block.rgba[i][c]);
+            ++numPoints;
+        }
+    }
+
+    BCColorBlock result = { 0, 0, 0xFFFFFFFF, 0 };
+
+    if (numPoints > 0)
+    {
+        /* Range fit: endpoints at the extremes of the projections onto the principal axis */
+        float mean[3], axis[3];
+        ComputePrincipalAxis(points, numPoints, mean, axis);
+
+        float minProjection = FLT_MAX, maxProjection = -FLT_MAX;
+        for_range(i, numPoints)
+        {
+            const float projection = (points[i][0] - mean[0]) * axis[0] + (points[i][1] - mean[1]) * axis[1] + (points[i][2] - mean[2]) * axis[2];
+            minProjection = std::min(minProjection, projection);
+            maxProjection = std::max(maxProjection, projection);
+        }
+
+        float endpointA[3], endpointB[3];
+        for_range(c, 3)
+        {
+            endpointA[c] = mean[c] + axis[c] * maxProjection;
+            endpointB[c] = mean[c] + axis[c] * minProjection;
+        }
+
+        result = EncodeColorEndpoints(block, endpointA, endpointB, transparentMask);
+
+        /* Cluster fit is only applied to four-color mode, i.e. when all 16 points are opaque */
+        if (quality == ImageCompressionQuality::High && transparentMask == 0 && result.error > 0)
+        {
+            if (ClusterFitColorEndpoints(points, mean, axis, static_cast<float>(result.error), endpointA, endpointB))
+            {
+                const BCColorBlock clusterFitResult = EncodeColorEndpoints(block, endpointA, endpointB, transparentMask);
+                if (clusterFitResult.error < result.error)
+                    result = clusterFitResult;
+            }
+        }
+    }
+
+    ::memcpy(dst + 0, &result.color0, sizeof(result.color0));
+    ::memcpy(dst + 2, &result.color1, sizeof(result.color1));
+    ::memcpy(dst + 4, &result.indices, sizeof(result.indices));
+}
+
+
+/*
+ * Channel block encoding (BC3 alpha, BC4, BC5)
+ */
+
+static void BuildChannelPalette(int (&palette)[8], int value0, int value1)
+{
+    palette[0] = value0;
+    palette[1] = value1;
+
+    if (value0 > value1)
+    {
+        for_subrange(i, 1, 7)
+            palette[i + 1] = ((7 - i) * value0 + i * value1 + 3) / 7;
+    }
+    else
+    {
+        for_subrange(i, 1, 5)
+            palette[i + 1] = ((5 - i) * value0 + i * value1 + 2) / 5;
+        palette[6] = 0x00;
+        palette[7] = 0xFF;
+    }
+}
+
+static BCChannelBlock EncodeChannelEndpoints(const std::uint8_t (&values)[16], int value0, int value1)
+{
+    BCChannelBlock result;
+    result.value0   = static_cast<std::uint8_t>(value0);
+    result.value1   = static_cast<std::uint8_t>(value1);
+    result.indices  = 0;
+    result.error    = 0;
+
+    int palette[8];
+    BuildChannelPalette(palette, value0, value1);
+
+    for_range(i, 16u)
+    {
+        std::uint32_t bestIndex = 0, bestError = UINT32_MAX;
+        for_range(j, 8u)
+        {
+            const int delta = static_cast<int>(values[i]) - palette[j];
+            const std::uint32_t error = static_cast<std::uint32_t>(delta * delta);
+            if (error < bestError)
+            {
+                bestError = error;
+                bestIndex = j;
+            }
+        }
+        result.error    += bestError;
+        result.indices  |= (static_cast<std::uint64_t>(bestIndex) << (i * 3));
+    }
+
+    return result;
+}
+
+// Returns the interpolation weight towards the second endpoint for the specified index in eight-value mode.
+static float GetChannelIndexWeight(std::uint32_t index)
+{
+    static const float weights[8] = { 0.0f, 1.0f, 1.0f/7.0f, 2.0f/7.0f, 3.0f/7.0f, 4.0f/7.0f, 5.0f/7.0f, 6.0f/7.0f };
+    return weights[index];
+}
+
+static void EncodeChannelBlock(std::uint8_t* dst, const BCSourceBlock& block, std::uint32_t component, ImageCompressionQuality quality)
+{
+    std::uint8_t values[16];
+    int minValue = 255, maxValue = 0;
+
+    for_range(i, 16u)
+    {
+        values[i] = block.rgba[i][component];
+        minValue = std::min(minValue, static_cast<int>(values[i]));
+        maxValue = std::max(maxValue, static_cast<int>(values[i]));
+    }
+
+    /* Range fit: eight-value mode between the extremes */
+    BCChannelBlock result = EncodeChannelEndpoints(values, maxValue, minValue);
+
+    if (quality == ImageCompressionQuality::High && result.error > 0)
+    {
+        /* Six-value mode between the inner extremes, since 0 and 255 are represented explicitly */
+        int minInnerValue = 255, maxInnerValue = 0;
+        for_range(i, 16u)
+        {
+            if (values[i] > 0 && values[i] < 255)
+            {
+                minInnerValue = std::min(minInnerValue, static_cast<int>(values[i]));
+                maxInnerValue = std::max(maxInnerValue, static_cast<int>(values[i]));
+            }
+        }
+
+        if (minInnerValue <= maxInnerValue)
+        {
+            const BCChannelBlock sixValueResult = EncodeChannelEndpoints(values, minInnerValue, maxInnerValue);
+            if (sixValueResult.error < result.error)
+                result = sixValueResult;
+        }
+
+        /* Refine eight-value mode endpoints with a least squares fit to the current indices */
+        BCChannelBlock refinedResult = EncodeChannelEndpoints(values, maxValue, minValue);
+
+        for_range(iteration, 2)
+        {
+            float alpha2 = 0.0f, beta2 = 0.0f, alphaBeta = 0.0f, alphaX = 0.0f, betaX = 0.0f;
+            for_range(i, 16u)
+            {
+                const float beta    = GetChannelIndexWeight(static_cast<std::uint32_t>((refinedResult.indices >> (i * 3)) & 0x7));
+                const float alpha   = 1.0f - beta;
+                const float x       = static_cast<float>(values[i]);
+                alpha2      += alpha * alpha;
+                beta2       += beta * beta;
+                alphaBeta   += alpha * beta;
+                alphaX      += alpha * x;
+                betaX       += beta * x;
+            }
+
+            const float det = alpha2 * beta2 - alphaBeta * alphaBeta;
+            if (std::abs(det) < FLT_EPSILON)
+                break;
+
+            const int value0 = std::max(0, std::min(255, static_cast<int>((alphaX * beta2 - betaX * alphaBeta) / det + 0.5f)));
+            const int value1 = std::max(0, std::min(255, static_cast<int>((betaX * alpha2 - alphaX * alphaBeta) / det + 0.5f)));
+            if (value0 <= value1)
+                break;
+
+            refinedResult = EncodeChannelEndpoints(values, value0, value1);
+            if (refinedResult.error < result.error)
+                result = refinedResult;
+        }
+    }
+
+    dst[0] = result.value0;
+    dst[1] = result.value1;
+    for_range(i, 6u)
+        dst[2 + i] = static_cast<std::uint8_t>((result.indices >> (i * 8)) & 0xFF);
+}
+
+
+/*
+ * Image encoding
+ */
+
+enum class BCCompressionType
+{
+    BC1,
+    BC3,
+    BC4,
+    BC5,
+};
+
+static std::size_t GetCompressedBlockSize(BCCompressionType type)
+{
+    return (type == BCCompressionType::BC1 || type == BCCompressionType::BC4 ? 8 : 16);
+}
+
+static void CompressBlockRows(
+    BCCompressionType             type,
+    const Extent2D&         extent,
+    const std::uint8_t*     src,
+    std::size_t             srcRowStride,
+    std::uint8_t*           dst,
+    ImageCompressionQuality quality,
+    std::size_t             blockRowBegin,
+    std::size_t             blockRowEnd)
+{
+    const std::uint32_t numBlocksX  = (extent.width + 3) / 4;
+    const std::size_t   blockSize   = GetCompressedBlockSize(type);
+
+    BCSourceBlock block;
+
+    for_subrange(blockY, blockRowBegin, blockRowEnd)
+    {
+        std::uint8_t* dstBlock = dst + blockY * numBlocksX * blockSize;
+
+        for_range(blockX, numBlocksX)
+        {
+            FetchSourceBlock(block, src, srcRowStride, extent, blockX, static_cast<std::uint32_t>(blockY));
+
+            switch (type)
+            {
+                case BCCompressionType::BC1:
+                    EncodeColorBlock(dstBlock, block, /*allowThreeColorMode:*/ true, quality);
+                    break;
+
+                case BCCompressionType::BC3:
+                    EncodeChannelBlock(dstBlock, block, 3, quality);
+                    EncodeColorBlock(dstBlock + 8, block, /*allowThreeColorMode:*/ false, quality);
+                    break;
+
+                case BCCompressionType::BC4:
+                    EncodeChannelBlock(dstBlock, block, 0, quality);
+                    break;
+
+                case BCCompressionType::BC5:
+                    EncodeChannelBlock(dstBlock, block, 0, quality);
+                    EncodeChannelBlock(dstBlock + 8, block, 1, quality);
+                    break;
+            }
+
+            dstBlock += blockSize;
+        }
+    }
+}
+
+static DynamicByteArray CompressRGBA8UNormToBC(
+    BCCompressionType             type,
+    const Extent2D&         extent,
+    const char*             data,
+    std::size_t             srcRowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount)
+{
+    /* Return null on invalid arguments */
+    if (extent.width == 0 || extent.height == 0 || data == nullptr || srcRowStride < extent.width * 4)
+        return nullptr;
+
+    const std::size_t numBlocksX = (extent.width  + 3) / 4;
+    const std::size_t numBlocksY = (extent.height + 3) / 4;
+
+    DynamicByteArray dstImage{ numBlocksX * numBlocksY * GetCompressedBlockSize(type), UninitializeTag{} };
+
+    /* Distribute block rows across worker threads */
+    DoConcurrentRange(
+        [type, &extent, data, srcRowStride, &dstImage, quality](std::size_t begin, std::size_t end)
+        {
+            CompressBlockRows(
+                type,
+                extent,
+                reinterpret_cast<const std::uint8_t*>(data),
+                srcRowStride,
+                reinterpret_cast<std::uint8_t*>(dstImage.get()),
+                quality,
+                begin,
+                end
+            );
+        },
+        numBlocksY,
+        threadCount,
+        /*threadMinWorkSize:*/ 4
+    );
+
+    return dstImage;
+}
+
+DynamicByteArray CompressRGBA8UNormToBC1(
+    const Extent2D&         extent,
+    const char*             data,
+    std::size_t             srcRowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount)
+{
+    return CompressRGBA8UNormToBC(BCCompressionType::BC1, extent, data, srcRowStride, quality, threadCount);
+}
+
+DynamicByteArray CompressRGBA8UNormToBC3(
+    const Extent2D&         extent,
+    const char*             data,
+    std::size_t             srcRowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount)
+{
+    return CompressRGBA8UNormToBC(BCCompressionType::BC3, extent, data, srcRowStride, quality, threadCount);
+}
+
+DynamicByteArray CompressRGBA8UNormToBC4(
+    const Extent2D&         extent,
+    const char*             data,
+    std::size_t             srcRowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount)
+{
+    return CompressRGBA8UNormToBC(BCCompressionType::BC4, extent, data, srcRowStride, quality, threadCount);
+}
+
+DynamicByteArray CompressRGBA8UNormToBC5(
+    const Extent2D&         extent,
+    const char*             data,
+    std::size_t             srcRowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount)
+{
+    return CompressRGBA8UNormToBC(BCCompressionType::BC5, extent, data, srcRowStride, quality, threadCount);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,80 @@
+/*
+ * BCCompressor.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_BC_COMPRESSOR_H
+#define LLGL_BC_COMPRESSOR_H
+
+
+#include <LLGL/Types.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Container/DynamicArray.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+struct Extent2D;
+
+/* ----- Functions ----- */
+
+/*
+Returns an image buffer with BC1 encoded blocks for the specified source image in the Format::RGBA8UNorm format, or null on failure.
+Pixels with an alpha value less than 128 are encoded as transparent black. Partial blocks at the image border are padded by clamping.
+'srcRowStride' specifies the number of bytes between two rows of the source image.
+*/
+DynamicByteArray CompressRGBA8UNormToBC1(
+    const Extent2D&         extent,
+    const char*             data,
+    std::size_t             srcRowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount = 0
+);
+
+/*
+Returns an image buffer with BC3 encoded blocks for the specified source image in the Format::RGBA8UNorm format, or null on failure.
+*/
+DynamicByteArray CompressRGBA8UNormToBC3(
+    const Extent2D&         extent,
+    const char*             data,
+    std::size_t             srcRowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount = 0
+);
+
+/*
+Returns an image buffer with BC4 encoded blocks of the red component for the specified source image in the Format::RGBA8UNorm format, or null on failure.
+*/
+DynamicByteArray CompressRGBA8UNormToBC4(
+    const Extent2D&         extent,
+    const char*             data,
+    std::size_t             srcRowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount = 0
+);
+
+/*
+Returns an image buffer with BC5 encoded blocks of the red and green components for the specified source image in the Format::RGBA8UNorm format, or null on failure.
+*/
+DynamicByteArray CompressRGBA8UNormToBC5(
+    const Extent2D&         extent,
+    const char*             data,
+    std::size_t             srcRowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount = 0
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
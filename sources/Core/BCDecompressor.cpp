@@ -6,6 +6,7 @@
  */
 
 #include "BCDecompressor.h"
+#include "Threading.h"
 #include <LLGL/Types.h>
 #include <LLGL/Utils/ForRange.h>
 #include <cstring>
@@ -15,110 +16,264 @@ namespace LLGL
 {
 
 
+// Expands an RGB565 color to 8 bits per component by replicating the upper bits into the lower bits.
 static void DecompressRGBColor16Bit(std::uint8_t* dst, std::uint16_t src)
 {
-    dst[0] = ((src >> 12) & 0x000F) * 0xFF / 0x0F;
-    dst[1] = ((src >>  6) & 0x001F) * 0xFF / 0x1F;
-    dst[2] = ((src >>  1) & 0x000F) * 0xFF / 0x0F;
+    const std::uint32_t r = (src >> 11) & 0x1F;
+    const std::uint32_t g = (src >>  5) & 0x3F;
+    const std::uint32_t b = (src      ) & 0x1F;
+    dst[0] = static_cast<std::uint8_t>((r << 3) | (r >> 2));
+    dst[1] = static_cast<std::uint8_t>((g << 2) | (g >> 4));
+    dst[2] = static_cast<std::uint8_t>((b << 3) | (b >> 2));
 }
 
-#if 0 //UNUSED
-static void DecompressRGBAColor16Bit(std::uint8_t* dst, std::uint16_t src)
+// Generates the 4-entry color palette of a BC1 color block. Three-color mode with transparent black is only allowed for BC1.
+static void DecompressColorPalette(std::uint8_t (&palette)[4][4], const std::uint8_t* src, bool allowThreeColorMode)
 {
-    DecompressRGBColor16Bit(dst, src);
-    dst[3] = (src & 0x0001) * 0xFF;
+    std::uint16_t color0, color1;
+    ::memcpy(&color0, src + 0, sizeof(color0));
+    ::memcpy(&color1, src + 2, sizeof(color1));
+
+    DecompressRGBColor16Bit(palette[0], color0);
+    DecompressRGBColor16Bit(palette[1], color1);
+    palette[0][3] = 0xFF;
+    palette[1][3] = 0xFF;
+
+    if (color0 > color1 || !allowThreeColorMode)
+    {
+        /* Four-color mode: two interpolated colors at 1/3 and 2/3 */
+        for_range(c, 3)
+        {
+            palette[2][c] = static_cast<std::uint8_t>((2 * palette[0][c] + palette[1][c] + 1) / 3);
+            palette[3][c] = static_cast<std::uint8_t>((palette[0][c] + 2 * palette[1][c] + 1) / 3);
+        }
+        palette[2][3] = 0xFF;
+        palette[3][3] = 0xFF;
+    }
+    else
+    {
+        /* Three-color mode: one interpolated color at 1/2 and transparent black */
+        for_range(c, 3)
+            palette[2][c] = static_cast<std::uint8_t>((palette[0][c] + palette[1][c]) / 2);
+        palette[2][3] = 0xFF;
+        ::memset(palette[3], 0, sizeof(palette[3]));
+    }
 }
 
-static std::uint8_t DecompressAlphaChannel4Bit(std::uint32_t& src)
+// Generates the 8-entry palette of a BC4 channel block.
+static void DecompressChannelPalette(std::uint8_t (&palette)[8], const std::uint8_t* src)
 {
-    auto alpha = static_cast<std::uint8_t >((src & 0x0000000F) * 0xFF / 0x0F);
-    src >>= 4;
-    return alpha;
+    const std::uint32_t value0 = src[0];
+    const std::uint32_t value1 = src[1];
+
+    palette[0] = src[0];
+    palette[1] = src[1];
+
+    if (value0 > value1)
+    {
+        /* Eight-value mode: six interpolated values */
+        for_subrange(i, 1u, 7u)
+            palette[i + 1] = static_cast<std::uint8_t>(((7 - i) * value0 + i * value1 + 3) / 7);
+    }
+    else
+    {
+        /* Six-value mode: four interpolated values plus 0 and 255 */
+        for_subrange(i, 1u, 5u)
+            palette[i + 1] = static_cast<std::uint8_t>(((5 - i) * value0 + i * value1 + 2) / 5);
+        palette[6] = 0x00;
+        palette[7] = 0xFF;
+    }
 }
 
-static void Decompress16AlphaChannels4Bit(std::uint8_t* dst, std::uint32_t src0, std::uint32_t src1)
+// Decompresses a 64-bit BC1 color block into the RGB(A) components of a 4x4 pixel block.
+static void DecompressColorBlock(std::uint8_t* dst, std::size_t dstRowStride, const std::uint8_t* src, bool allowThreeColorMode, bool writeAlpha)
 {
-    for (int i = 0; i < 8; ++i)
+    std::uint8_t palette[4][4];
+    DecompressColorPalette(palette, src, allowThreeColorMode);
+
+    std::uint32_t indices;
+    ::memcpy(&indices, src + 4, sizeof(indices));
+
+    for_range(y, 4u)
     {
-        dst[i    ] = DecompressAlphaChannel4Bit(src0);
-        dst[i + 8] = DecompressAlphaChannel4Bit(src1);
+        std::uint8_t* dstRow = dst + y * dstRowStride;
+        for_range(x, 4u)
+        {
+            const std::uint8_t* color = palette[indices & 0x3];
+            indices >>= 2;
+            dstRow[x*4 + 0] = color[0];
+            dstRow[x*4 + 1] = color[1];
+            dstRow[x*4 + 2] = color[2];
+            if (writeAlpha)
+                dstRow[x*4 + 3] = color[3];
+        }
     }
 }
-#endif
 
-static std::uint8_t InterpolateColorComponent(std::uint16_t a, std::uint16_t b)
+// Decompresses a 64-bit BC4 channel block into the specified component of a 4x4 pixel block.
+static void DecompressChannelBlock(std::uint8_t* dst, std::size_t dstRowStride, const std::uint8_t* src, std::uint32_t component)
 {
-    if (a > b)
-        return static_cast<std::uint8_t>((2 * a + b + 1) / 3);
-    else
-        return static_cast<std::uint8_t>((a + b) / 2);
+    std::uint8_t palette[8];
+    DecompressChannelPalette(palette, src);
+
+    /* Read 48-bit index field */
+    std::uint64_t indices = 0;
+    for_range(i, 6u)
+        indices |= (static_cast<std::uint64_t>(src[2 + i]) << (i * 8));
+
+    for_range(y, 4u)
+    {
+        std::uint8_t* dstRow = dst + y * dstRowStride;
+        for_range(x, 4u)
+        {
+            dstRow[x*4 + component] = palette[indices & 0x7];
+            indices >>= 3;
+        }
+    }
 }
 
-static void InterpolateColor(std::uint8_t* dst, const std::uint8_t* src0, const std::uint8_t* src1)
+enum class BCDecompressionType
+{
+    BC1,
+    BC3,
+    BC4,
+    BC5,
+};
+
+static std::size_t GetCompressedBlockSize(BCDecompressionType type)
 {
-    dst[0] = InterpolateColorComponent(src0[0], src1[0]);
-    dst[1] = InterpolateColorComponent(src0[1], src1[1]);
-    dst[2] = InterpolateColorComponent(src0[2], src1[2]);
+    return (type == BCDecompressionType::BC1 || type == BCDecompressionType::BC4 ? 8 : 16);
 }
 
-DynamicByteArray DecompressBC1ToRGBA8UNorm(
+static void DecompressBlockRows(
+    BCDecompressionType         type,
+    const Extent2D&     extent,
+    const std::uint8_t* src,
+    std::uint8_t*       dst,
+    std::size_t         blockRowBegin,
+    std::size_t         blockRowEnd)
+{
+    const std::size_t numBlocksX    = extent.width / 4;
+    const std::size_t blockSize     = GetCompressedBlockSize(type);
+    const std::size_t dstRowStride  = extent.width * 4;
+
+    for_subrange(blockY, blockRowBegin, blockRowEnd)
+    {
+        const std::uint8_t* srcBlock = src + blockY * numBlocksX * blockSize;
+
+        for_range(blockX, numBlocksX)
+        {
+            std::uint8_t* dstBlock = dst + (blockY * 4 * dstRowStride) + blockX * 16;
+
+            switch (type)
+            {
+                case BCDecompressionType::BC1:
+                    DecompressColorBlock(dstBlock, dstRowStride, srcBlock, /*allowThreeColorMode:*/ true, /*writeAlpha:*/ true);
+                    break;
+
+                case BCDecompressionType::BC3:
+                    DecompressChannelBlock(dstBlock, dstRowStride, srcBlock, 3);
+                    DecompressColorBlock(dstBlock, dstRowStride, srcBlock + 8, /*allowThreeColorMode:*/ false, /*writeAlpha:*/ false);
+                    break;
+
+                case BCDecompressionType::BC4:
+                    DecompressChannelBlock(dstBlock, dstRowStride, srcBlock, 0);
+                    break;
+
+                case BCDecompressionType::BC5:
+                    DecompressChannelBlock(dstBlock, dstRowStride, srcBlock, 0);
+                    DecompressChannelBlock(dstBlock, dstRowStride, srcBlock + 8, 1);
+                    break;
+            }
+
+            srcBlock += blockSize;
+        }
+    }
+}
+
+static DynamicByteArray DecompressBCToRGBA8UNorm(
+    BCDecompressionType     type,
     const Extent2D& extent,
     const char*     data,
     std::size_t     dataSize,
-    unsigned        /*threadCount*/)
+    unsigned        threadCount)
 {
     /* Return null on invalid arguments */
-    if (extent.width % 4 != 0 || extent.height % 4 != 0 || data == nullptr || dataSize < extent.width * extent.height / 2)
+    const std::size_t numBlocks = (extent.width / 4) * (extent.height / 4);
+    if (extent.width % 4 != 0 || extent.height % 4 != 0 || data == nullptr || dataSize < numBlocks * GetCompressedBlockSize(type))
         return nullptr;
 
     DynamicByteArray dstImage{ extent.width * extent.height * 4, UninitializeTag{} };
 
-    std::uint8_t* output = reinterpret_cast<std::uint8_t*>(dstImage.get());
-    std::uint16_t compressedColor[2];
-    std::uint8_t decompressedColor[4][3];
-
-    const std::size_t formatByteSize = 4;
-
-    for_range(y, extent.height / 4u)
+    /* Initialize components that are not covered by the compressed channels */
+    if (type == BCDecompressionType::BC4 || type == BCDecompressionType::BC5)
     {
-        for_range(x, extent.width / 4u)
+        std::uint8_t* dst = reinterpret_cast<std::uint8_t*>(dstImage.get());
+        for_range(i, extent.width * extent.height)
         {
-            /* Decompress two 16 bit colors */
-            for_range(i, 2)
-            {
-                compressedColor[i] = *reinterpret_cast<const std::uint16_t*>(data);
-                DecompressRGBColor16Bit(decompressedColor[i], compressedColor[i]);
-                data += 2;
-            }
-
-            /* Generate two more colors by interpolating the previous two */
-            InterpolateColor(decompressedColor[2], decompressedColor[0], decompressedColor[1]);
-            InterpolateColor(decompressedColor[3], decompressedColor[1], decompressedColor[0]);
-
-            /* Read palette bitfield */
-            std::uint32_t palette = *reinterpret_cast<const std::uint32_t*>(data);
-            data += 4;
-
-            /* Generate 4x4 pixel block from palette bitmask */
-            for_range(i, 16u)
-            {
-                /* Get palette index from last two bits */
-                const std::uint32_t paletteIndex = palette & 0x00000003;
-                palette >>= 2;
-
-                /* Write out image color */
-                const std::size_t outputOffset = (((y * 4 + i/4) * extent.width) + (x*4 + i%4)) * formatByteSize;
-                output[outputOffset + 0] = decompressedColor[paletteIndex][0];
-                output[outputOffset + 1] = decompressedColor[paletteIndex][1];
-                output[outputOffset + 2] = decompressedColor[paletteIndex][2];
-                output[outputOffset + 3] = 0xFF;
-            }
+            dst[i*4 + 0] = 0x00;
+            dst[i*4 + 1] = 0x00;
+            dst[i*4 + 2] = 0x00;
+            dst[i*4 + 3] = 0xFF;
         }
     }
 
+    DoConcurrentRange(
+        [type, &extent, data, &dstImage](std::size_t begin, std::size_t end)
+        {
+            DecompressBlockRows(
+                type,
+                extent,
+                reinterpret_cast<const std::uint8_t*>(data),
+                reinterpret_cast<std::uint8_t*>(dstImage.get()),
+                begin,
+                end
+            );
+        },
+        extent.height / 4,
+        threadCount,
+        /*threadMinWorkSize:*/ 16
+    );
+
     return dstImage;
 }
 
+DynamicByteArray DecompressBC1ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount)
+{
+    return DecompressBCToRGBA8UNorm(BCDecompressionType::BC1, extent, data, dataSize, threadCount);
+}
+
+DynamicByteArray DecompressBC3ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount)
+{
+    return DecompressBCToRGBA8UNorm(BCDecompressionType::BC3, extent, data, dataSize, threadCount);
+}
+
+DynamicByteArray DecompressBC4ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount)
+{
+    return DecompressBCToRGBA8UNorm(BCDecompressionType::BC4, extent, data, dataSize, threadCount);
+}
+
+DynamicByteArray DecompressBC5ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount)
+{
+    return DecompressBCToRGBA8UNorm(BCDecompressionType::BC5, extent, data, dataSize, threadCount);
+}
+
 
 } // /namespace LLGL
 
@@ -33,6 +33,41 @@ DynamicByteArray DecompressBC1ToRGBA8UNorm(
     unsigned        threadCount = 0
 );
 
+/*
+Returns an image buffer in the Format::RGBA8UNorm format for the specified BC3 encoded data, or null on failure
+Width and height of the input image must be a multiple of 4.
+*/
+DynamicByteArray DecompressBC3ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount = 0
+);
+
+/*
+Returns an image buffer in the Format::RGBA8UNorm format for the specified BC4 encoded data, or null on failure.
+The single channel is written to the red component; green and blue are zero and alpha is one.
+Width and height of the input image must be a multiple of 4.
+*/
+DynamicByteArray DecompressBC4ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount = 0
+);
+
+/*
+Returns an image buffer in the Format::RGBA8UNorm format for the specified BC5 encoded data, or null on failure.
+The two channels are written to the red and green components; blue is zero and alpha is one.
+Width and height of the input image must be a multiple of 4.
+*/
+DynamicByteArray DecompressBC5ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount = 0
+);
+
 
 } // /namespace LLGL
 
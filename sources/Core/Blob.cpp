@@ -8,6 +8,7 @@
 #include <LLGL/Blob.h>
 #include <fstream>
 #include "CoreUtils.h"
+#include "../Platform/FileMapping.h"
 
 
 namespace LLGL
@@ -112,6 +113,26 @@ struct InternalUnmanagedBlob final : Blob::Pimpl
     std::size_t size;
 };
 
+struct InternalMappedFileBlob final : Blob::Pimpl
+{
+    InternalMappedFileBlob(std::unique_ptr<FileMapping>&& mapping) :
+        mapping { std::forward<std::unique_ptr<FileMapping>>(mapping) }
+    {
+    }
+
+    const void* GetData() const override
+    {
+        return mapping->GetData();
+    }
+
+    std::size_t GetSize() const override
+    {
+        return mapping->GetSize();
+    }
+
+    std::unique_ptr<FileMapping> mapping;
+};
+
 static Blob::Pimpl* MakeInternalBlob(const void* data, std::size_t size, bool isWeakRef)
 {
     if (isWeakRef)
@@ -238,6 +259,23 @@ Blob Blob::CreateFromFile(const std::string& filename)
     return CreateFromFile(filename.c_str());
 }
 
+Blob Blob::CreateFromMappedFile(const char* filename)
+{
+    /* Fall back to reading the entire file if it cannot be mapped into memory */
+    std::unique_ptr<FileMapping> mapping = FileMapping::Map(filename);
+    if (!mapping)
+        return CreateFromFile(filename);
+
+    Blob blob;
+    blob.pimpl_ = new InternalMappedFileBlob{ std::move(mapping) };
+    return blob;
+}
+
+Blob Blob::CreateFromMappedFile(const std::string& filename)
+{
+    return CreateFromMappedFile(filename.c_str());
+}
+
 const void* Blob::GetData() const
 {
     return (pimpl_ != nullptr ? pimpl_->GetData() : nullptr);
@@ -0,0 +1,311 @@
+/*
+ * ETCDecompressor.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ETCDecompressor.h"
+#include "Threading.h"
+#include <LLGL/Types.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+// Intensity modifier tables for individual and differential mode, indexed by table codeword and pixel index.
+static const int g_ETCModifierTables[8][4] =
+{
+    {  2,   8,  -2,   -8 },
+    {  5,  17,  -5,  -17 },
+    {  9,  29,  -9,  -29 },
+    { 13,  42, -13,  -42 },
+    { 18,  60, -18,  -60 },
+    { 24,  80, -24,  -80 },
+    { 33, 106, -33, -106 },
+    { 47, 183, -47, -183 },
+};
+
+// Distance table for T and H mode.
+static const int g_ETCDistanceTable[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+// Sign extension of the 3-bit color deltas in differential mode.
+static const int g_ETCDeltaTable[8] = { 0, 1, 2, 3, -4, -3, -2, -1 };
+
+static inline int ExtendETC4Bit(int x)
+{
+    return (x << 4) | x;
+}
+
+static inline int ExtendETC5Bit(int x)
+{
+    return (x << 3) | (x >> 2);
+}
+
+static inline int ExtendETC6Bit(int x)
+{
+    return (x << 2) | (x >> 4);
+}
+
+static inline int ExtendETC7Bit(int x)
+{
+    return (x << 1) | (x >> 6);
+}
+
+static inline std::uint8_t ClampETCColor(int x)
+{
+    return static_cast<std::uint8_t>(std::max(0, std::min(x, 255)));
+}
+
+// Returns the 2-bit index of the specified pixel. Indices are stored in column-major order, MSBs in the upper and LSBs in the lower 16 bits.
+static inline std::uint32_t GetETCPixelIndex(std::uint32_t pixelIndices, std::uint32_t x, std::uint32_t y)
+{
+    const std::uint32_t bit = x * 4 + y;
+    return ((pixelIndices >> (15 + bit)) & 0x2) | ((pixelIndices >> bit) & 0x1);
+}
+
+// Writes the 4x4 pixels of a T or H mode block by selecting one of the four paint colors per pixel.
+static void WritePaintColors(std::uint8_t (&dst)[4][4][4], std::uint8_t (&paintColors)[4][4], std::uint32_t pixelIndices)
+{
+    for_range(i, 4)
+        paintColors[i][3] = 0xFF;
+
+    for_range(y, 4u)
+    {
+        for_range(x, 4u)
+            ::memcpy(dst[y][x], paintColors[GetETCPixelIndex(pixelIndices, x, y)], 4);
+    }
+}
+
+// Decodes a 64-bit ETC2 RGB block into a 4x4 block of RGBA8 pixels in row-major order.
+static void DecompressETC2Block(std::uint8_t (&dst)[4][4][4], const std::uint8_t* src)
+{
+    const std::uint32_t pixelIndices =
+    (
+        (static_cast<std::uint32_t>(src[4]) << 24) |
+        (static_cast<std::uint32_t>(src[5]) << 16) |
+        (static_cast<std::uint32_t>(src[6]) <<  8) |
+        (static_cast<std::uint32_t>(src[7])      )
+    );
+
+    const bool  diffBit = ((src[3] & 0x2) != 0);
+    const int   r       = (src[0] >> 3) + g_ETCDeltaTable[src[0] & 0x7];
+    const int   g       = (src[1] >> 3) + g_ETCDeltaTable[src[1] & 0x7];
+    const int   b       = (src[2] >> 3) + g_ETCDeltaTable[src[2] & 0x7];
+
+    if (diffBit && (r < 0 || r > 31))
+    {
+        /* T mode: two base colors in 4-bit precision with three paint colors around the second one */
+        const int base0[3] =
+        {
+            ExtendETC4Bit((((src[0] >> 3) & 0x3) << 2) | (src[0] & 0x3)),
+            ExtendETC4Bit(src[1] >> 4),
+            ExtendETC4Bit(src[1] & 0xF),
+        };
+        const int base1[3] =
+        {
+            ExtendETC4Bit(src[2] >> 4),
+            ExtendETC4Bit(src[2] & 0xF),
+            ExtendETC4Bit(src[3] >> 4),
+        };
+        const int distance = g_ETCDistanceTable[(((src[3] >> 2) & 0x3) << 1) | (src[3] & 0x1)];
+
+        std::uint8_t paintColors[4][4];
+        for_range(c, 3)
+        {
+            paintColors[0][c] = ClampETCColor(base0[c]);
+            paintColors[1][c] = ClampETCColor(base1[c] + distance);
+            paintColors[2][c] = ClampETCColor(base1[c]);
+            paintColors[3][c] = ClampETCColor(base1[c] - distance);
+        }
+
+        WritePaintColors(dst, paintColors, pixelIndices);
+    }
+    else if (diffBit && (g < 0 || g > 31))
+    {
+        /* H mode: two base colors in 4-bit precision with two paint colors around each of them */
+        const int base0[3] =
+        {
+            ExtendETC4Bit((src[0] >> 3) & 0xF),
+            ExtendETC4Bit(((src[0] & 0x7) << 1) | ((src[1] >> 4) & 0x1)),
+            ExtendETC4Bit((src[1] & 0x8) | ((src[1] & 0x3) << 1) | (src[2] >> 7)),
+        };
+        const int base1[3] =
+        {
+            ExtendETC4Bit((src[2] >> 3) & 0xF),
+            ExtendETC4Bit(((src[2] & 0x7) << 1) | (src[3] >> 7)),
+            ExtendETC4Bit((src[3] >> 3) & 0xF),
+        };
+
+        /* The LSB of the distance index is implied by the order of the base colors */
+        const int value0 = (base0[0] << 16) | (base0[1] << 8) | base0[2];
+        const int value1 = (base1[0] << 16) | (base1[1] << 8) | base1[2];
+        const int distance = g_ETCDistanceTable[(src[3] & 0x4) | ((src[3] & 0x1) << 1) | (value0 >= value1 ? 1 : 0)];
+
+        std::uint8_t paintColors[4][4];
+        for_range(c, 3)
+        {
+            paintColors[0][c] = ClampETCColor(base0[c] + distance);
+            paintColors[1][c] = ClampETCColor(base0[c] - distance);
+            paintColors[2][c] = ClampETCColor(base1[c] + distance);
+            paintColors[3][c] = ClampETCColor(base1[c] - distance);
+        }
+
+        WritePaintColors(dst, paintColors, pixelIndices);
+    }
+    else if (diffBit && (b < 0 || b > 31))
+    {
+        /* Planar mode: three colors (origin, horizontal, vertical) are interpolated over the block */
+        const int colorO[3] =
+        {
+            ExtendETC6Bit((src[0] >> 1) & 0x3F),
+            ExtendETC7Bit(((src[0] & 0x1) << 6) | ((src[1] >> 1) & 0x3F)),
+            ExtendETC6Bit(((src[1] & 0x1) << 5) | (src[2] & 0x18) | ((src[2] & 0x3) << 1) | (src[3] >> 7)),
+        };
+        const int colorH[3] =
+        {
+            ExtendETC6Bit((((src[3] >> 2) & 0x1F) << 1) | (src[3] & 0x1)),
+            ExtendETC7Bit((src[4] >> 1) & 0x7F),
+            ExtendETC6Bit(((src[4] & 0x1) << 5) | ((src[5] >> 3) & 0x1F)),
+        };
+        const int colorV[3] =
+        {
+            ExtendETC6Bit(((src[5] & 0x7) << 3) | ((src[6] >> 5) & 0x7)),
+            ExtendETC7Bit(((src[6] & 0x1F) << 2) | ((src[7] >> 6) & 0x3)),
+            ExtendETC6Bit(src[7] & 0x3F),
+        };
+
+        for_range(y, 4)
+        {
+            for_range(x, 4)
+            {
+                for_range(c, 3)
+                    dst[y][x][c] = ClampETCColor((x * (colorH[c] - colorO[c]) + y * (colorV[c] - colorO[c]) + 4 * colorO[c] + 2) >> 2);
+                dst[y][x][3] = 0xFF;
+            }
+        }
+    }
+    else
+    {
+        /* Individual or differential mode: two sub-blocks with one base color and modifier table each */
+        int baseColors[2][3];
+        if (diffBit)
+        {
+            for_range(c, 3)
+            {
+                const int base = (src[c] >> 3);
+                baseColors[0][c] = ExtendETC5Bit(base);
+                baseColors[1][c] = ExtendETC5Bit(base + g_ETCDeltaTable[src[c] & 0x7]);
+            }
+        }
+        else
+        {
+            for_range(c, 3)
+            {
+                baseColors[0][c] = ExtendETC4Bit(src[c] >> 4);
+                baseColors[1][c] = ExtendETC4Bit(src[c] & 0xF);
+            }
+        }
+
+        /* Generate four paint colors for each sub-block */
+        const int* modifiers[2] = { g_ETCModifierTables[(src[3] >> 5) & 0x7], g_ETCModifierTables[(src[3] >> 2) & 0x7] };
+
+        std::uint8_t paintColors[2][4][4];
+        for_range(subBlock, 2)
+        {
+            for_range(i, 4)
+            {
+                for_range(c, 3)
+                    paintColors[subBlock][i][c] = ClampETCColor(baseColors[subBlock][c] + modifiers[subBlock][i]);
+                paintColors[subBlock][i][3] = 0xFF;
+            }
+        }
+
+        /* Sub-blocks are split vertically (2x4) if the flip bit is zero, and horizontally (4x2) otherwise */
+        const std::uint32_t flipBit = (src[3] & 0x1);
+
+        for_range(y, 4u)
+        {
+            for_range(x, 4u)
+            {
+                const std::uint32_t subBlock = (flipBit != 0 ? y : x) >> 1;
+                ::memcpy(dst[y][x], paintColors[subBlock][GetETCPixelIndex(pixelIndices, x, y)], 4);
+            }
+        }
+    }
+}
+
+static void DecompressETC2BlockRows(
+    const Extent2D&     extent,
+    const std::uint8_t* src,
+    std::uint8_t*       dst,
+    std::size_t         blockRowBegin,
+    std::size_t         blockRowEnd)
+{
+    const std::uint32_t numBlocksX      = (extent.width + 3) / 4;
+    const std::size_t   dstRowStride    = extent.width * 4;
+
+    std::uint8_t block[4][4][4];
+
+    for_subrange(blockY, blockRowBegin, blockRowEnd)
+    {
+        const std::uint8_t* srcBlock    = src + blockY * numBlocksX * 8;
+        const std::uint32_t numRows     = std::min(4u, extent.height - static_cast<std::uint32_t>(blockY) * 4u);
+
+        for_range(blockX, numBlocksX)
+        {
+            DecompressETC2Block(block, srcBlock);
+
+            /* Copy decoded block into destination image and clip partial blocks at the image border */
+            const std::uint32_t numColumns  = std::min(4u, extent.width - blockX * 4u);
+            std::uint8_t*       dstBlock    = dst + (blockY * 4 * dstRowStride) + blockX * 16;
+
+            for_range(y, numRows)
+                ::memcpy(dstBlock + y * dstRowStride, block[y], numColumns * 4);
+
+            srcBlock += 8;
+        }
+    }
+}
+
+bool DecompressETC2ToRGBA8UNorm(
+    const Extent2D&         extent,
+    const char*             data,
+    std::size_t             dataSize,
+    const MutableImageView& dstImageView,
+    unsigned                threadCount)
+{
+    /* Return false on invalid arguments */
+    const std::size_t numBlocks = static_cast<std::size_t>((extent.width + 3) / 4) * ((extent.height + 3) / 4);
+    if (data == nullptr || dataSize < numBlocks * 8)
+        return false;
+
+    DoConcurrentRange(
+        [&extent, data, &dstImageView](std::size_t begin, std::size_t end)
+        {
+            DecompressETC2BlockRows(
+                extent,
+                reinterpret_cast<const std::uint8_t*>(data),
+                reinterpret_cast<std::uint8_t*>(dstImageView.data),
+                begin,
+                end
+            );
+        },
+        (extent.height + 3) / 4,
+        threadCount,
+        /*threadMinWorkSize:*/ 16
+    );
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
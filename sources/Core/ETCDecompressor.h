@@ -0,0 +1,46 @@
+/*
+ * ETCDecompressor.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_ETC_DECOMPRESSOR_H
+#define LLGL_ETC_DECOMPRESSOR_H
+
+
+#include <LLGL/ImageFlags.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+struct Extent2D;
+
+/* ----- Functions ----- */
+
+/*
+Decompresses the specified ETC2 RGB encoded data into the destination image view in the Format::RGBA8UNorm format.
+Since ETC2 is a superset of ETC1, this also decodes ETC1 data. Alpha is always one.
+Width and height of the input image don't need to be a multiple of 4; partial blocks are clipped.
+Returns false if the source data is too small. The destination image view must be ImageFormat::RGBA with DataType::UInt8.
+*/
+bool DecompressETC2ToRGBA8UNorm(
+    const Extent2D&         extent,
+    const char*             data,
+    std::size_t             dataSize,
+    const MutableImageView& dstImageView,
+    unsigned                threadCount = 0
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
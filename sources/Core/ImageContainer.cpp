@@ -0,0 +1,891 @@
+/*
+ * ImageContainer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/ImageContainer.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/Format.h>
+#include <algorithm>
+#include <utility>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+static constexpr std::uint32_t g_DDSMagic           = 0x20534444; // "DDS "
+static constexpr std::uint32_t g_DDSFlagDepth       = 0x00800000; // DDSD_DEPTH
+static constexpr std::uint32_t g_DDSFlagMipMapCount = 0x00020000; // DDSD_MIPMAPCOUNT
+static constexpr std::uint32_t g_DDSPixelFormatAlpha        = 0x00000002; // DDPF_ALPHA
+static constexpr std::uint32_t g_DDSPixelFormatFourCC       = 0x00000004; // DDPF_FOURCC
+static constexpr std::uint32_t g_DDSPixelFormatRGB          = 0x00000040; // DDPF_RGB
+static constexpr std::uint32_t g_DDSPixelFormatLuminance    = 0x00020000; // DDPF_LUMINANCE
+static constexpr std::uint32_t g_DDSCaps2Cubemap    = 0x00000200; // DDSCAPS2_CUBEMAP
+static constexpr std::uint32_t g_DDSCaps2Volume     = 0x00200000; // DDSCAPS2_VOLUME
+static constexpr std::uint32_t g_DDSMiscTextureCube = 0x00000004; // D3D11_RESOURCE_MISC_TEXTURECUBE
+
+static constexpr std::uint8_t g_KTX2Identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+// Upper bounds of header values, so that subresource sizes cannot overflow before they are checked against the container size.
+static constexpr std::uint32_t g_maxContainerExtent         = 65536;
+static constexpr std::uint32_t g_maxContainerArrayLayers    = 2048; // D3D11_REQ_TEXTURE2D_ARRAY_AXIS_DIMENSION
+
+struct DDSPixelFormat
+{
+    std::uint32_t size;
+    std::uint32_t flags;
+    std::uint32_t fourCC;
+    std::uint32_t rgbBitCount;
+    std::uint32_t rBitMask;
+    std::uint32_t gBitMask;
+    std::uint32_t bBitMask;
+    std::uint32_t aBitMask;
+};
+
+struct DDSHeader
+{
+    std::uint32_t   size;
+    std::uint32_t   flags;
+    std::uint32_t   height;
+    std::uint32_t   width;
+    std::uint32_t   pitchOrLinearSize;
+    std::uint32_t   depth;
+    std::uint32_t   mipMapCount;
+    std::uint32_t   reserved1[11];
+    DDSPixelFormat  pixelFormat;
+    std::uint32_t   caps;
+    std::uint32_t   caps2;
+    std::uint32_t   caps3;
+    std::uint32_t   caps4;
+    std::uint32_t   reserved2;
+};
+
+struct DDSHeaderDX10
+{
+    std::uint32_t dxgiFormat;
+    std::uint32_t resourceDimension;
+    std::uint32_t miscFlag;
+    std::uint32_t arraySize;
+    std::uint32_t miscFlags2;
+};
+
+struct KTX2Header
+{
+    std::uint8_t    identifier[12];
+    std::uint32_t   vkFormat;
+    std::uint32_t   typeSize;
+    std::uint32_t   pixelWidth;
+    std::uint32_t   pixelHeight;
+    std::uint32_t   pixelDepth;
+    std::uint32_t   layerCount;
+    std::uint32_t   faceCount;
+    std::uint32_t   levelCount;
+    std::uint32_t   supercompressionScheme;
+    std::uint32_t   dfdByteOffset;
+    std::uint32_t   dfdByteLength;
+    std::uint32_t   kvdByteOffset;
+    std::uint32_t   kvdByteLength;
+    std::uint64_t   sgdByteOffset;
+    std::uint64_t   sgdByteLength;
+};
+
+struct KTX2LevelIndex
+{
+    std::uint64_t byteOffset;
+    std::uint64_t byteLength;
+    std::uint64_t uncompressedByteLength;
+};
+
+static_assert(sizeof(DDSHeader) == 124, "DDSHeader must be 124 bytes");
+static_assert(sizeof(DDSHeaderDX10) == 20, "DDSHeaderDX10 must be 20 bytes");
+static_assert(sizeof(KTX2Header) == 80, "KTX2Header must be 80 bytes");
+static_assert(sizeof(KTX2LevelIndex) == 24, "KTX2LevelIndex must be 24 bytes");
+
+static constexpr std::uint32_t MakeFourCC(char c0, char c1, char c2, char c3)
+{
+    return
+    (
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c0))      ) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c1)) <<  8) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c2)) << 16) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c3)) << 24)
+    );
+}
+
+template <typename... TArgs>
+static bool ErrorImageContainer(Report* report, const char* format, TArgs&&... args)
+{
+    if (report != nullptr)
+        report->Errorf(format, std::forward<TArgs>(args)...);
+    return false;
+}
+
+// Reads a plain structure from the specified byte offset. Returns false if the structure exceeds the data range.
+template <typename T>
+static bool ReadStruct(const Blob& blob, std::size_t offset, T& outData)
+{
+    if (offset + sizeof(T) > blob.GetSize())
+        return false;
+    ::memcpy(&outData, static_cast<const char*>(blob.GetData()) + offset, sizeof(T));
+    return true;
+}
+
+// Returns the size (in bytes) of a single subresource, including all depth slices. Partial blocks are rounded up.
+static std::uint64_t GetSubresourceSize(const FormatAttributes& formatAttribs, const Extent3D& extent)
+{
+    const std::uint64_t numBlocksX = (static_cast<std::uint64_t>(extent.width)  + formatAttribs.blockWidth  - 1) / formatAttribs.blockWidth;
+    const std::uint64_t numBlocksY = (static_cast<std::uint64_t>(extent.height) + formatAttribs.blockHeight - 1) / formatAttribs.blockHeight;
+    return (numBlocksX * numBlocksY * extent.depth * formatAttribs.bitSize / 8);
+}
+
+// Returns the size of the specified dimension at the specified MIP-map level. Shifting by 32 or more bits is undefined, so such levels are clamped to 1.
+static std::uint32_t GetMipDimension(std::uint32_t size, std::uint32_t mipLevel)
+{
+    return (mipLevel < 32 ? std::max(1u, size >> mipLevel) : 1u);
+}
+
+// Returns the extent of the specified MIP-map without array layers.
+static Extent3D GetMipSpatialExtent(const TextureDescriptor& desc, std::uint32_t mipLevel)
+{
+    Extent3D extent
+    {
+        GetMipDimension(desc.extent.width,  mipLevel),
+        GetMipDimension(desc.extent.height, mipLevel),
+        GetMipDimension(desc.extent.depth,  mipLevel),
+    };
+    if (desc.type != TextureType::Texture3D)
+        extent.depth = 1;
+    if (desc.type == TextureType::Texture1D || desc.type == TextureType::Texture1DArray)
+        extent.height = 1;
+    return extent;
+}
+
+// Returns the size (in bytes) of the entire MIP-map chain of a single array layer.
+static std::uint64_t GetMipChainSize(const FormatAttributes& formatAttribs, const TextureDescriptor& desc)
+{
+    std::uint64_t size = 0;
+    for_range(mipLevel, desc.mipLevels)
+        size += GetSubresourceSize(formatAttribs, GetMipSpatialExtent(desc, mipLevel));
+    return size;
+}
+
+// Returns true if the texture dimensions and number of array layers are within the limits of image containers.
+static bool IsContainerTextureDescValid(const TextureDescriptor& desc)
+{
+    return
+    (
+        desc.extent.width   <= g_maxContainerExtent &&
+        desc.extent.height  <= g_maxContainerExtent &&
+        desc.extent.depth   <= g_maxContainerExtent &&
+        desc.arrayLayers    >= 1                    &&
+        desc.arrayLayers    <= g_maxContainerArrayLayers
+    );
+}
+
+// Maps the legacy FourCC code or D3DFORMAT enumeration of a DDS pixel format to the LLGL format.
+static Format MapDDSFourCC(std::uint32_t fourCC)
+{
+    switch (fourCC)
+    {
+        case MakeFourCC('D', 'X', 'T', '1'): return Format::BC1UNorm;
+        case MakeFourCC('D', 'X', 'T', '2'): /*pass*/
+        case MakeFourCC('D', 'X', 'T', '3'): return Format::BC2UNorm;
+        case MakeFourCC('D', 'X', 'T', '4'): /*pass*/
+        case MakeFourCC('D', 'X', 'T', '5'): return Format::BC3UNorm;
+        case MakeFourCC('A', 'T', 'I', '1'): /*pass*/
+        case MakeFourCC('B', 'C', '4', 'U'): return Format::BC4UNorm;
+        case MakeFourCC('B', 'C', '4', 'S'): return Format::BC4SNorm;
+        case MakeFourCC('A', 'T', 'I', '2'): /*pass*/
+        case MakeFourCC('B', 'C', '5', 'U'): return Format::BC5UNorm;
+        case MakeFourCC('B', 'C', '5', 'S'): return Format::BC5SNorm;
+        case 36:  return Format::RGBA16UNorm;   // D3DFMT_A16B16G16R16
+        case 110: return Format::RGBA16SNorm;   // D3DFMT_Q16W16V16U16
+        case 111: return Format::R16Float;      // D3DFMT_R16F
+        case 112: return Format::RG16Float;     // D3DFMT_G16R16F
+        case 113: return Format::RGBA16Float;   // D3DFMT_A16B16G16R16F
+        case 114: return Format::R32Float;      // D3DFMT_R32F
+        case 115: return Format::RG32Float;     // D3DFMT_G32R32F
+        case 116: return Format::RGBA32Float;   // D3DFMT_A32B32G32R32F
+        default:  return Format::Undefined;
+    }
+}
+
+// Maps uncompressed DDS pixel formats that are described by bit masks.
+static Format MapDDSBitMasks(const DDSPixelFormat& pixelFormat)
+{
+    if ((pixelFormat.flags & g_DDSPixelFormatRGB) != 0)
+    {
+        if (pixelFormat.rgbBitCount == 32)
+        {
+            if (pixelFormat.rBitMask == 0x000000FF && pixelFormat.gBitMask == 0x0000FF00 && pixelFormat.bBitMask == 0x00FF0000)
+                return Format::RGBA8UNorm;
+            if (pixelFormat.rBitMask == 0x00FF0000 && pixelFormat.gBitMask == 0x0000FF00 && pixelFormat.bBitMask == 0x000000FF)
+                return Format::BGRA8UNorm;
+            if (pixelFormat.rBitMask == 0x0000FFFF && pixelFormat.gBitMask == 0xFFFF0000)
+                return Format::RG16UNorm;
+            if (pixelFormat.rBitMask == 0xFFFFFFFF)
+                return Format::R32Float;
+        }
+        else if (pixelFormat.rgbBitCount == 16)
+        {
+            if (pixelFormat.rBitMask == 0x00FF && pixelFormat.gBitMask == 0xFF00)
+                return Format::RG8UNorm;
+        }
+    }
+    else if ((pixelFormat.flags & g_DDSPixelFormatLuminance) != 0)
+    {
+        if (pixelFormat.rgbBitCount == 8)
+            return Format::R8UNorm;
+        if (pixelFormat.rgbBitCount == 16)
+            return Format::R16UNorm;
+    }
+    else if ((pixelFormat.flags & g_DDSPixelFormatAlpha) != 0)
+    {
+        if (pixelFormat.rgbBitCount == 8)
+            return Format::A8UNorm;
+    }
+    return Format::Undefined;
+}
+
+// Maps the DXGI_FORMAT enumeration of the DDS DX10 header extension to the LLGL format.
+static Format MapDXGIFormat(std::uint32_t dxgiFormat)
+{
+    switch (dxgiFormat)
+    {
+        case 2:  return Format::RGBA32Float;        // DXGI_FORMAT_R32G32B32A32_FLOAT
+        case 3:  return Format::RGBA32UInt;         // DXGI_FORMAT_R32G32B32A32_UINT
+        case 4:  return Format::RGBA32SInt;         // DXGI_FORMAT_R32G32B32A32_SINT
+        case 6:  return Format::RGB32Float;         // DXGI_FORMAT_R32G32B32_FLOAT
+        case 7:  return Format::RGB32UInt;          // DXGI_FORMAT_R32G32B32_UINT
+        case 8:  return Format::RGB32SInt;          // DXGI_FORMAT_R32G32B32_SINT
+        case 10: return Format::RGBA16Float;        // DXGI_FORMAT_R16G16B16A16_FLOAT
+        case 11: return Format::RGBA16UNorm;        // DXGI_FORMAT_R16G16B16A16_UNORM
+        case 12: return Format::RGBA16UInt;         // DXGI_FORMAT_R16G16B16A16_UINT
+        case 13: return Format::RGBA16SNorm;        // DXGI_FORMAT_R16G16B16A16_SNORM
+        case 14: return Format::RGBA16SInt;         // DXGI_FORMAT_R16G16B16A16_SINT
+        case 16: return Format::RG32Float;          // DXGI_FORMAT_R32G32_FLOAT
+        case 17: return Format::RG32UInt;           // DXGI_FORMAT_R32G32_UINT
+        case 18: return Format::RG32SInt;           // DXGI_FORMAT_R32G32_SINT
+        case 20: return Format::D32FloatS8X24UInt;  // DXGI_FORMAT_D32_FLOAT_S8X24_UINT
+        case 24: return Format::RGB10A2UNorm;       // DXGI_FORMAT_R10G10B10A2_UNORM
+        case 25: return Format::RGB10A2UInt;        // DXGI_FORMAT_R10G10B10A2_UINT
+        case 26: return Format::RG11B10Float;       // DXGI_FORMAT_R11G11B10_FLOAT
+        case 28: return Format::RGBA8UNorm;         // DXGI_FORMAT_R8G8B8A8_UNORM
+        case 29: return Format::RGBA8UNorm_sRGB;    // DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+        case 30: return Format::RGBA8UInt;          // DXGI_FORMAT_R8G8B8A8_UINT
+        case 31: return Format::RGBA8SNorm;         // DXGI_FORMAT_R8G8B8A8_SNORM
+        case 32: return Format::RGBA8SInt;          // DXGI_FORMAT_R8G8B8A8_SINT
+        case 34: return Format::RG16Float;          // DXGI_FORMAT_R16G16_FLOAT
+        case 35: return Format::RG16UNorm;          // DXGI_FORMAT_R16G16_UNORM
+        case 36: return Format::RG16UInt;           // DXGI_FORMAT_R16G16_UINT
+        case 37: return Format::RG16SNorm;          // DXGI_FORMAT_R16G16_SNORM
+        case 38: return Format::RG16SInt;           // DXGI_FORMAT_R16G16_SINT
+        case 40: return Format::D32Float;           // DXGI_FORMAT_D32_FLOAT
+        case 41: return Format::R32Float;           // DXGI_FORMAT_R32_FLOAT
+        case 42: return Format::R32UInt;            // DXGI_FORMAT_R32_UINT
+        case 43: return Format::R32SInt;            // DXGI_FORMAT_R32_SINT
+        case 45: return Format::D24UNormS8UInt;     // DXGI_FORMAT_D24_UNORM_S8_UINT
+        case 49: return Format::RG8UNorm;           // DXGI_FORMAT_R8G8_UNORM
+        case 50: return Format::RG8UInt;            // DXGI_FORMAT_R8G8_UINT
+        case 51: return Format::RG8SNorm;           // DXGI_FORMAT_R8G8_SNORM
+        case 52: return Format::RG8SInt;            // DXGI_FORMAT_R8G8_SINT
+        case 54: return Format::R16Float;           // DXGI_FORMAT_R16_FLOAT
+        case 55: return Format::D16UNorm;           // DXGI_FORMAT_D16_UNORM
+        case 56: return Format::R16UNorm;           // DXGI_FORMAT_R16_UNORM
+        case 57: return Format::R16UInt;            // DXGI_FORMAT_R16_UINT
+        case 58: return Format::R16SNorm;           // DXGI_FORMAT_R16_SNORM
+        case 59: return Format::R16SInt;            // DXGI_FORMAT_R16_SINT
+        case 61: return Format::R8UNorm;            // DXGI_FORMAT_R8_UNORM
+        case 62: return Format::R8UInt;             // DXGI_FORMAT_R8_UINT
+        case 63: return Format::R8SNorm;            // DXGI_FORMAT_R8_SNORM
+        case 64: return Format::R8SInt;             // DXGI_FORMAT_R8_SINT
+        case 65: return Format::A8UNorm;            // DXGI_FORMAT_A8_UNORM
+        case 67: return Format::RGB9E5Float;        // DXGI_FORMAT_R9G9B9E5_SHAREDEXP
+        case 71: return Format::BC1UNorm;           // DXGI_FORMAT_BC1_UNORM
+        case 72: return Format::BC1UNorm_sRGB;      // DXGI_FORMAT_BC1_UNORM_SRGB
+        case 74: return Format::BC2UNorm;           // DXGI_FORMAT_BC2_UNORM
+        case 75: return Format::BC2UNorm_sRGB;      // DXGI_FORMAT_BC2_UNORM_SRGB
+        case 77: return Format::BC3UNorm;           // DXGI_FORMAT_BC3_UNORM
+        case 78: return Format::BC3UNorm_sRGB;      // DXGI_FORMAT_BC3_UNORM_SRGB
+        case 80: return Format::BC4UNorm;           // DXGI_FORMAT_BC4_UNORM
+        case 81: return Format::BC4SNorm;           // DXGI_FORMAT_BC4_SNORM
+        case 83: return Format::BC5UNorm;           // DXGI_FORMAT_BC5_UNORM
+        case 84: return Format::BC5SNorm;           // DXGI_FORMAT_BC5_SNORM
+        case 86: return Format::BGR5A1UNorm;        // DXGI_FORMAT_B5G5R5A1_UNORM
+        case 87: return Format::BGRA8UNorm;         // DXGI_FORMAT_B8G8R8A8_UNORM
+        case 91: return Format::BGRA8UNorm_sRGB;    // DXGI_FORMAT_B8G8R8A8_UNORM_SRGB
+        default: return Format::Undefined;
+    }
+}
+
+// Maps the VkFormat enumeration of the KTX2 header to the LLGL format.
+static Format MapKTX2VkFormat(std::uint32_t vkFormat)
+{
+    switch (vkFormat)
+    {
+        case 7:   return Format::BGR5A1UNorm;       // VK_FORMAT_B5G5R5A1_UNORM_PACK16
+        case 9:   return Format::R8UNorm;           // VK_FORMAT_R8_UNORM
+        case 10:  return Format::R8SNorm;           // VK_FORMAT_R8_SNORM
+        case 13:  return Format::R8UInt;            // VK_FORMAT_R8_UINT
+        case 14:  return Format::R8SInt;            // VK_FORMAT_R8_SINT
+        case 16:  return Format::RG8UNorm;          // VK_FORMAT_R8G8_UNORM
+        case 17:  return Format::RG8SNorm;          // VK_FORMAT_R8G8_SNORM
+        case 20:  return Format::RG8UInt;           // VK_FORMAT_R8G8_UINT
+        case 21:  return Format::RG8SInt;           // VK_FORMAT_R8G8_SINT
+        case 23:  return Format::RGB8UNorm;         // VK_FORMAT_R8G8B8_UNORM
+        case 24:  return Format::RGB8SNorm;         // VK_FORMAT_R8G8B8_SNORM
+        case 27:  return Format::RGB8UInt;          // VK_FORMAT_R8G8B8_UINT
+        case 28:  return Format::RGB8SInt;          // VK_FORMAT_R8G8B8_SINT
+        case 29:  return Format::RGB8UNorm_sRGB;    // VK_FORMAT_R8G8B8_SRGB
+        case 37:  return Format::RGBA8UNorm;        // VK_FORMAT_R8G8B8A8_UNORM
+        case 38:  return Format::RGBA8SNorm;        // VK_FORMAT_R8G8B8A8_SNORM
+        case 41:  return Format::RGBA8UInt;         // VK_FORMAT_R8G8B8A8_UINT
+        case 42:  return Format::RGBA8SInt;         // VK_FORMAT_R8G8B8A8_SINT
+        case 43:  return Format::RGBA8UNorm_sRGB;   // VK_FORMAT_R8G8B8A8_SRGB
+        case 44:  return Format::BGRA8UNorm;        // VK_FORMAT_B8G8R8A8_UNORM
+        case 45:  return Format::BGRA8SNorm;        // VK_FORMAT_B8G8R8A8_SNORM
+        case 48:  return Format::BGRA8UInt;         // VK_FORMAT_B8G8R8A8_UINT
+        case 49:  return Format::BGRA8SInt;         // VK_FORMAT_B8G8R8A8_SINT
+        case 50:  return Format::BGRA8UNorm_sRGB;   // VK_FORMAT_B8G8R8A8_SRGB
+        case 64:  return Format::RGB10A2UNorm;      // VK_FORMAT_A2B10G10R10_UNORM_PACK32
+        case 68:  return Format::RGB10A2UInt;       // VK_FORMAT_A2B10G10R10_UINT_PACK32
+        case 70:  return Format::R16UNorm;          // VK_FORMAT_R16_UNORM
+        case 71:  return Format::R16SNorm;          // VK_FORMAT_R16_SNORM
+        case 74:  return Format::R16UInt;           // VK_FORMAT_R16_UINT
+        case 75:  return Format::R16SInt;           // VK_FORMAT_R16_SINT
+        case 76:  return Format::R16Float;          // VK_FORMAT_R16_SFLOAT
+        case 77:  return Format::RG16UNorm;         // VK_FORMAT_R16G16_UNORM
+        case 78:  return Format::RG16SNorm;         // VK_FORMAT_R16G16_SNORM
+        case 81:  return Format::RG16UInt;          // VK_FORMAT_R16G16_UINT
+        case 82:  return Format::RG16SInt;          // VK_FORMAT_R16G16_SINT
+        case 83:  return Format::RG16Float;         // VK_FORMAT_R16G16_SFLOAT
+        case 84:  return Format::RGB16UNorm;        // VK_FORMAT_R16G16B16_UNORM
+        case 85:  return Format::RGB16SNorm;        // VK_FORMAT_R16G16B16_SNORM
+        case 88:  return Format::RGB16UInt;         // VK_FORMAT_R16G16B16_UINT
+        case 89:  return Format::RGB16SInt;         // VK_FORMAT_R16G16B16_SINT
+        case 90:  return Format::RGB16Float;        // VK_FORMAT_R16G16B16_SFLOAT
+        case 91:  return Format::RGBA16UNorm;       // VK_FORMAT_R16G16B16A16_UNORM
+        case 92:  return Format::RGBA16SNorm;       // VK_FORMAT_R16G16B16A16_SNORM
+        case 95:  return Format::RGBA16UInt;        // VK_FORMAT_R16G16B16A16_UINT
+        case 96:  return Format::RGBA16SInt;        // VK_FORMAT_R16G16B16A16_SINT
+        case 97:  return Format::RGBA16Float;       // VK_FORMAT_R16G16B16A16_SFLOAT
+        case 98:  return Format::R32UInt;           // VK_FORMAT_R32_UINT
+        case 99:  return Format::R32SInt;           // VK_FORMAT_R32_SINT
+        case 100: return Format::R32Float;          // VK_FORMAT_R32_SFLOAT
+        case 101: return Format::RG32UInt;          // VK_FORMAT_R32G32_UINT
+        case 102: return Format::RG32SInt;          // VK_FORMAT_R32G32_SINT
+        case 103: return Format::RG32Float;         // VK_FORMAT_R32G32_SFLOAT
+        case 104: return Format::RGB32UInt;         // VK_FORMAT_R32G32B32_UINT
+        case 105: return Format::RGB32SInt;         // VK_FORMAT_R32G32B32_SINT
+        case 106: return Format::RGB32Float;        // VK_FORMAT_R32G32B32_SFLOAT
+        case 107: return Format::RGBA32UInt;        // VK_FORMAT_R32G32B32A32_UINT
+        case 108: return Format::RGBA32SInt;        // VK_FORMAT_R32G32B32A32_SINT
+        case 109: return Format::RGBA32Float;       // VK_FORMAT_R32G32B32A32_SFLOAT
+        case 112: return Format::R64Float;          // VK_FORMAT_R64_SFLOAT
+        case 115: return Format::RG64Float;         // VK_FORMAT_R64G64_SFLOAT
+        case 118: return Format::RGB64Float;        // VK_FORMAT_R64G64B64_SFLOAT
+        case 121: return Format::RGBA64Float;       // VK_FORMAT_R64G64B64A64_SFLOAT
+        case 122: return Format::RG11B10Float;      // VK_FORMAT_B10G11R11_UFLOAT_PACK32
+        case 123: return Format::RGB9E5Float;       // VK_FORMAT_E5B9G9R9_UFLOAT_PACK32
+        case 124: return Format::D16UNorm;          // VK_FORMAT_D16_UNORM
+        case 126: return Format::D32Float;          // VK_FORMAT_D32_SFLOAT
+        case 129: return Format::D24UNormS8UInt;    // VK_FORMAT_D24_UNORM_S8_UINT
+        case 130: return Format::D32FloatS8X24UInt; // VK_FORMAT_D32_SFLOAT_S8_UINT
+        case 131: /*pass*/                          // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+        case 133: return Format::BC1UNorm;          // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+        case 132: /*pass*/                          // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+        case 134: return Format::BC1UNorm_sRGB;     // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+        case 135: return Format::BC2UNorm;          // VK_FORMAT_BC2_UNORM_BLOCK
+        case 136: return Format::BC2UNorm_sRGB;     // VK_FORMAT_BC2_SRGB_BLOCK
+        case 137: return Format::BC3UNorm;          // VK_FORMAT_BC3_UNORM_BLOCK
+        case 138: return Format::BC3UNorm_sRGB;     // VK_FORMAT_BC3_SRGB_BLOCK
+        case 139: return Format::BC4UNorm;          // VK_FORMAT_BC4_UNORM_BLOCK
+        case 140: return Format::BC4SNorm;          // VK_FORMAT_BC4_SNORM_BLOCK
+        case 141: return Format::BC5UNorm;          // VK_FORMAT_BC5_UNORM_BLOCK
+        case 142: return Format::BC5SNorm;          // VK_FORMAT_BC5_SNORM_BLOCK
+        case 147: return Format::ETC2UNorm;         // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+        case 148: return Format::ETC2UNorm_sRGB;    // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+        case 157: return Format::ASTC4x4;           // VK_FORMAT_ASTC_4x4_UNORM_BLOCK
+        case 158: return Format::ASTC4x4_sRGB;      // VK_FORMAT_ASTC_4x4_SRGB_BLOCK
+        case 159: return Format::ASTC5x4;           // VK_FORMAT_ASTC_5x4_UNORM_BLOCK
+        case 160: return Format::ASTC5x4_sRGB;      // VK_FORMAT_ASTC_5x4_SRGB_BLOCK
+        case 161: return Format::ASTC5x5;           // VK_FORMAT_ASTC_5x5_UNORM_BLOCK
+        case 162: return Format::ASTC5x5_sRGB;      // VK_FORMAT_ASTC_5x5_SRGB_BLOCK
+        case 163: return Format::ASTC6x5;           // VK_FORMAT_ASTC_6x5_UNORM_BLOCK
+        case 164: return Format::ASTC6x5_sRGB;      // VK_FORMAT_ASTC_6x5_SRGB_BLOCK
+        case 165: return Format::ASTC6x6;           // VK_FORMAT_ASTC_6x6_UNORM_BLOCK
+        case 166: return Format::ASTC6x6_sRGB;      // VK_FORMAT_ASTC_6x6_SRGB_BLOCK
+        case 167: return Format::ASTC8x5;           // VK_FORMAT_ASTC_8x5_UNORM_BLOCK
+        case 168: return Format::ASTC8x5_sRGB;      // VK_FORMAT_ASTC_8x5_SRGB_BLOCK
+        case 169: return Format::ASTC8x6;           // VK_FORMAT_ASTC_8x6_UNORM_BLOCK
+        case 170: return Format::ASTC8x6_sRGB;      // VK_FORMAT_ASTC_8x6_SRGB_BLOCK
+        case 171: return Format::ASTC8x8;           // VK_FORMAT_ASTC_8x8_UNORM_BLOCK
+        case 172: return Format::ASTC8x8_sRGB;      // VK_FORMAT_ASTC_8x8_SRGB_BLOCK
+        case 173: return Format::ASTC10x5;          // VK_FORMAT_ASTC_10x5_UNORM_BLOCK
+        case 174: return Format::ASTC10x5_sRGB;     // VK_FORMAT_ASTC_10x5_SRGB_BLOCK
+        case 175: return Format::ASTC10x6;          // VK_FORMAT_ASTC_10x6_UNORM_BLOCK
+        case 176: return Format::ASTC10x6_sRGB;     // VK_FORMAT_ASTC_10x6_SRGB_BLOCK
+        case 177: return Format::ASTC10x8;          // VK_FORMAT_ASTC_10x8_UNORM_BLOCK
+        case 178: return Format::ASTC10x8_sRGB;     // VK_FORMAT_ASTC_10x8_SRGB_BLOCK
+        case 179: return Format::ASTC10x10;         // VK_FORMAT_ASTC_10x10_UNORM_BLOCK
+        case 180: return Format::ASTC10x10_sRGB;    // VK_FORMAT_ASTC_10x10_SRGB_BLOCK
+        case 181: return Format::ASTC12x10;         // VK_FORMAT_ASTC_12x10_UNORM_BLOCK
+        case 182: return Format::ASTC12x10_sRGB;    // VK_FORMAT_ASTC_12x10_SRGB_BLOCK
+        case 183: return Format::ASTC12x12;         // VK_FORMAT_ASTC_12x12_UNORM_BLOCK
+        case 184: return Format::ASTC12x12_sRGB;    // VK_FORMAT_ASTC_12x12_SRGB_BLOCK
+        default:  return Format::Undefined;
+    }
+}
+
+
+/*
+ * ImageContainer class
+ */
+
+ImageContainer::ImageContainer(ImageContainer&& rhs) noexcept :
+    blob_               { std::move(rhs.blob_)         },
+    type_               { rhs.type_                    },
+    desc_               { rhs.desc_                    },
+    imageFormat_        { rhs.imageFormat_             },
+    dataType_           { rhs.dataType_                },
+    subresources_       { std::move(rhs.subresources_) },
+    layersContiguous_   { rhs.layersContiguous_        }
+{
+    rhs.Reset();
+}
+
+ImageContainer& ImageContainer::operator = (ImageContainer&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        blob_               = std::move(rhs.blob_);
+        type_               = rhs.type_;
+        desc_               = rhs.desc_;
+        imageFormat_        = rhs.imageFormat_;
+        dataType_           = rhs.dataType_;
+        subresources_       = std::move(rhs.subresources_);
+        layersContiguous_   = rhs.layersContiguous_;
+        rhs.Reset();
+    }
+    return *this;
+}
+
+bool ImageContainer::LoadFromFile(const char* filename, Report* report)
+{
+    Blob blob = Blob::CreateFromMappedFile(filename);
+    if (!blob)
+    {
+        Reset();
+        return ErrorImageContainer(report, "failed to read image container: %s\n", (filename != nullptr ? filename : "<null>"));
+    }
+    return LoadFromBlob(std::move(blob), report);
+}
+
+bool ImageContainer::LoadFromBlob(Blob&& blob, Report* report)
+{
+    Reset();
+
+    blob_ = std::move(blob);
+
+    /* Determine container type by its magic number */
+    bool result = false;
+
+    std::uint32_t magic = 0;
+    std::uint8_t identifier[sizeof(g_KTX2Identifier)] = {};
+
+    if (ReadStruct(blob_, 0, identifier) && ::memcmp(identifier, g_KTX2Identifier, sizeof(g_KTX2Identifier)) == 0)
+        result = ParseKTX2(report);
+    else if (ReadStruct(blob_, 0, magic) && magic == g_DDSMagic)
+        result = ParseDDS(report);
+    else
+        ErrorImageContainer(report, "unknown image container type; only DDS and KTX2 are supported\n");
+
+    if (result)
+        result = ValidateSubresources(report);
+
+    if (!result)
+        Reset();
+
+    return result;
+}
+
+void ImageContainer::Reset()
+{
+    blob_               = Blob{};
+    type_               = ImageContainerType::Undefined;
+    desc_               = TextureDescriptor{};
+    desc_.bindFlags     = 0;
+    desc_.miscFlags     = 0;
+    imageFormat_        = ImageFormat::RGBA;
+    dataType_           = DataType::UInt8;
+    layersContiguous_   = false;
+    subresources_.clear();
+}
+
+ImageView ImageContainer::GetSubresourceView(std::uint32_t mipLevel, std::uint32_t arrayLayer) const
+{
+    if (mipLevel >= desc_.mipLevels || arrayLayer >= desc_.arrayLayers)
+        return ImageView{};
+
+    const Subresource& subresource = subresources_[arrayLayer * desc_.mipLevels + mipLevel];
+    return ImageView
+    {
+        imageFormat_,
+        dataType_,
+        static_cast<const char*>(blob_.GetData()) + subresource.offset,
+        subresource.size
+    };
+}
+
+Texture* ImageContainer::CreateTexture(RenderSystem& renderSystem, long bindFlags) const
+{
+    if (type_ == ImageContainerType::Undefined)
+        return nullptr;
+
+    TextureDescriptor texDesc = desc_;
+    {
+        texDesc.bindFlags   = bindFlags;
+        texDesc.miscFlags   = 0;
+    }
+
+    const char* blobData = static_cast<const char*>(blob_.GetData());
+
+    if (layersContiguous_)
+    {
+        /* Pass first MIP-map of all array layers directly as initial image */
+        const Subresource& baseSubresource = subresources_[0];
+        const ImageView initialImage{ imageFormat_, dataType_, blobData + baseSubresource.offset, baseSubresource.size * desc_.arrayLayers };
+
+        Texture* texture = renderSystem.CreateTexture(texDesc, &initialImage);
+        if (texture == nullptr)
+            return nullptr;
+
+        /* Write remaining MIP-maps for all array layers at once */
+        for_subrange(mipLevel, 1u, desc_.mipLevels)
+        {
+            const Subresource& subresource = subresources_[mipLevel];
+            const ImageView mipImage{ imageFormat_, dataType_, blobData + subresource.offset, subresource.size * desc_.arrayLayers };
+            const TextureRegion region
+            {
+                TextureSubresource{ 0, desc_.arrayLayers, mipLevel, 1 },
+                Offset3D{},
+                GetMipSpatialExtent(desc_, mipLevel)
+            };
+            renderSystem.WriteTexture(*texture, region, mipImage);
+        }
+
+        return texture;
+    }
+    else
+    {
+        /* Array layers are interleaved with their MIP-map chains, so each subresource must be written individually */
+        texDesc.miscFlags |= MiscFlags::NoInitialData;
+
+        Texture* texture = renderSystem.CreateTexture(texDesc);
+        if (texture == nullptr)
+            return nullptr;
+
+        for_range(arrayLayer, desc_.arrayLayers)
+        {
+            for_range(mipLevel, desc_.mipLevels)
+            {
+                const TextureRegion region
+                {
+                    TextureSubresource{ arrayLayer, mipLevel },
+                    Offset3D{},
+                    GetMipSpatialExtent(desc_, mipLevel)
+                };
+                renderSystem.WriteTexture(*texture, region, GetSubresourceView(mipLevel, arrayLayer));
+            }
+        }
+
+        return texture;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool ImageContainer::ParseDDS(Report* report)
+{
+    /* Read DDS header and optional DX10 header extension */
+    DDSHeader header;
+    if (!ReadStruct(blob_, sizeof(std::uint32_t), header) || header.size != sizeof(DDSHeader))
+        return ErrorImageContainer(report, "invalid DDS header\n");
+
+    std::size_t dataOffset = sizeof(std::uint32_t) + sizeof(DDSHeader);
+
+    const std::uint32_t width   = std::max(1u, header.width);
+    const std::uint32_t height  = std::max(1u, header.height);
+    const std::uint32_t depth   = ((header.flags & g_DDSFlagDepth) != 0 ? std::max(1u, header.depth) : 1u);
+
+    desc_.mipLevels = ((header.flags & g_DDSFlagMipMapCount) != 0 ? std::max(1u, header.mipMapCount) : 1u);
+
+    if ((header.pixelFormat.flags & g_DDSPixelFormatFourCC) != 0 && header.pixelFormat.fourCC == MakeFourCC('D', 'X', '1', '0'))
+    {
+        DDSHeaderDX10 headerDX10;
+        if (!ReadStruct(blob_, dataOffset, headerDX10))
+            return ErrorImageContainer(report, "invalid DDS DX10 header extension\n");
+
+        dataOffset += sizeof(DDSHeaderDX10);
+
+        desc_.format = MapDXGIFormat(headerDX10.dxgiFormat);
+        if (desc_.format == Format::Undefined)
+            return ErrorImageContainer(report, "unsupported DXGI format in DDS container: %u\n", headerDX10.dxgiFormat);
+
+        /* Bound array size before it is multiplied by the number of cube faces */
+        if (headerDX10.arraySize > g_maxContainerArrayLayers)
+            return ErrorImageContainer(report, "invalid array size in DDS DX10 header extension: %u\n", headerDX10.arraySize);
+
+        const std::uint32_t arraySize = std::max(1u, headerDX10.arraySize);
+
+        switch (headerDX10.resourceDimension)
+        {
+            case 2: // D3D10_RESOURCE_DIMENSION_TEXTURE1D
+                desc_.type          = (arraySize > 1 ? TextureType::Texture1DArray : TextureType::Texture1D);
+                desc_.extent        = Extent3D{ width, 1, 1 };
+                desc_.arrayLayers   = arraySize;
+                break;
+
+            case 3: // D3D10_RESOURCE_DIMENSION_TEXTURE2D
+                if ((headerDX10.miscFlag & g_DDSMiscTextureCube) != 0)
+                {
+                    desc_.type          = (arraySize > 1 ? TextureType::TextureCubeArray : TextureType::TextureCube);
+                    desc_.arrayLayers   = arraySize * 6;
+                }
+                else
+                {
+                    desc_.type          = (arraySize > 1 ? TextureType::Texture2DArray : TextureType::Texture2D);
+                    desc_.arrayLayers   = arraySize;
+                }
+                desc_.extent = Extent3D{ width, height, 1 };
+                break;
+
+            case 4: // D3D10_RESOURCE_DIMENSION_TEXTURE3D
+                desc_.type          = TextureType::Texture3D;
+                desc_.extent        = Extent3D{ width, height, depth };
+                desc_.arrayLayers   = 1;
+                break;
+
+            default:
+                return ErrorImageContainer(report, "invalid resource dimension in DDS DX10 header extension: %u\n", headerDX10.resourceDimension);
+        }
+    }
+    else
+    {
+        /* Map legacy pixel format */
+        if ((header.pixelFormat.flags & g_DDSPixelFormatFourCC) != 0)
+            desc_.format = MapDDSFourCC(header.pixelFormat.fourCC);
+        else
+            desc_.format = MapDDSBitMasks(header.pixelFormat);
+
+        if (desc_.format == Format::Undefined)
+            return ErrorImageContainer(report, "unsupported pixel format in DDS container\n");
+
+        if ((header.caps2 & g_DDSCaps2Cubemap) != 0)
+        {
+            /* Partial cube maps are not supported, all six faces are expected */
+            desc_.type          = TextureType::TextureCube;
+            desc_.extent        = Extent3D{ width, height, 1 };
+            desc_.arrayLayers   = 6;
+        }
+        else if ((header.caps2 & g_DDSCaps2Volume) != 0)
+        {
+            desc_.type          = TextureType::Texture3D;
+            desc_.extent        = Extent3D{ width, height, depth };
+            desc_.arrayLayers   = 1;
+        }
+        else
+        {
+            desc_.type          = TextureType::Texture2D;
+            desc_.extent        = Extent3D{ width, height, 1 };
+            desc_.arrayLayers   = 1;
+        }
+    }
+
+    if (!IsContainerTextureDescValid(desc_))
+        return ErrorImageContainer(report, "invalid dimensions in DDS header\n");
+
+    /* Clamp number of MIP-maps to the full MIP-map chain */
+    desc_.mipLevels = std::min(desc_.mipLevels, NumMipLevels(desc_.type, desc_.extent));
+
+    /* DDS stores each array layer with its entire MIP-map chain consecutively; check the total size before any subresource is allocated */
+    const FormatAttributes& formatAttribs = GetFormatAttribs(desc_.format);
+
+    const std::uint64_t mipChainSize    = GetMipChainSize(formatAttribs, desc_);
+    const std::uint64_t remainingSize   = blob_.GetSize() - dataOffset;
+    if (mipChainSize > remainingSize / desc_.arrayLayers)
+    {
+        return ErrorImageContainer(
+            report, "image container is truncated: expected %llu bytes per array layer but got only %llu bytes for %u layers\n",
+            static_cast<unsigned long long>(mipChainSize), static_cast<unsigned long long>(remainingSize), desc_.arrayLayers
+        );
+    }
+
+    subresources_.reserve(static_cast<std::size_t>(desc_.arrayLayers) * desc_.mipLevels);
+
+    for_range(arrayLayer, desc_.arrayLayers)
+    {
+        for_range(mipLevel, desc_.mipLevels)
+        {
+            const std::size_t size = static_cast<std::size_t>(GetSubresourceSize(formatAttribs, GetMipSpatialExtent(desc_, mipLevel)));
+            AppendSubresource(dataOffset, size);
+            dataOffset += size;
+        }
+    }
+
+    type_ = ImageContainerType::DDS;
+
+    return true;
+}
+
+bool ImageContainer::ParseKTX2(Report* report)
+{
+    KTX2Header header;
+    if (!ReadStruct(blob_, 0, header))
+        return ErrorImageContainer(report, "invalid KTX2 header\n");
+
+    if (header.supercompressionScheme != 0)
+        return ErrorImageContainer(report, "supercompressed KTX2 containers are not supported (scheme %u)\n", header.supercompressionScheme);
+
+    desc_.format = MapKTX2VkFormat(header.vkFormat);
+    if (desc_.format == Format::Undefined)
+        return ErrorImageContainer(report, "unsupported VkFormat in KTX2 container: %u\n", header.vkFormat);
+
+    if (header.pixelWidth == 0 || (header.faceCount != 1 && header.faceCount != 6))
+        return ErrorImageContainer(report, "invalid dimensions in KTX2 header\n");
+
+    /* Bound layer count before it is multiplied by the number of cube faces */
+    if (header.layerCount > g_maxContainerArrayLayers)
+        return ErrorImageContainer(report, "invalid layer count in KTX2 header: %u\n", header.layerCount);
+
+    const std::uint32_t numLayers = std::max(1u, header.layerCount);
+    const std::uint32_t numFaces  = header.faceCount;
+
+    /* Determine texture type */
+    desc_.extent        = Extent3D{ header.pixelWidth, std::max(1u, header.pixelHeight), std::max(1u, header.pixelDepth) };
+    desc_.arrayLayers   = numLayers * numFaces;
+    desc_.mipLevels     = std::max(1u, header.levelCount);
+
+    if (!IsContainerTextureDescValid(desc_))
+        return ErrorImageContainer(report, "invalid dimensions in KTX2 header\n");
+
+    if (header.pixelDepth > 0)
+        desc_.type = TextureType::Texture3D;
+    else if (numFaces == 6)
+        desc_.type = (header.layerCount > 0 ? TextureType::TextureCubeArray : TextureType::TextureCube);
+    else if (header.pixelHeight == 0)
+        desc_.type = (header.layerCount > 0 ? TextureType::Texture1DArray : TextureType::Texture1D);
+    else
+        desc_.type = (header.layerCount > 0 ? TextureType::Texture2DArray : TextureType::Texture2D);
+
+    /* Clamp number of MIP-maps to the full MIP-map chain */
+    desc_.mipLevels = std::min(desc_.mipLevels, NumMipLevels(desc_.type, desc_.extent));
+
+    /* Read level index; each MIP-map level stores all array layers, cube faces, and depth slices consecutively */
+    const FormatAttributes& formatAttribs = GetFormatAttribs(desc_.format);
+    const std::size_t blobSize = blob_.GetSize();
+
+    if (sizeof(KTX2Header) + desc_.mipLevels * sizeof(KTX2LevelIndex) > blobSize)
+        return ErrorImageContainer(report, "invalid KTX2 level index\n");
+
+    DynamicVector<KTX2LevelIndex> levels;
+    levels.resize(desc_.mipLevels);
+
+    for_range(mipLevel, desc_.mipLevels)
+    {
+        if (!ReadStruct(blob_, sizeof(KTX2Header) + mipLevel * sizeof(KTX2LevelIndex), levels[mipLevel]))
+            return ErrorImageContainer(report, "invalid KTX2 level index\n");
+    }
+
+    /* Check all levels against the container size before any subresource is allocated */
+    for_range(mipLevel, desc_.mipLevels)
+    {
+        const KTX2LevelIndex&   level   = levels[mipLevel];
+        const std::uint64_t     size    = GetSubresourceSize(formatAttribs, GetMipSpatialExtent(desc_, mipLevel));
+
+        if (level.byteOffset > blobSize || level.byteLength > blobSize - level.byteOffset)
+            return ErrorImageContainer(report, "KTX2 level index %u exceeds the container size of %zu bytes\n", mipLevel, blobSize);
+
+        if (size > level.byteLength / desc_.arrayLayers)
+            return ErrorImageContainer(report, "KTX2 level index %u is too small for its subresources\n", mipLevel);
+    }
+
+    subresources_.resize(static_cast<std::size_t>(desc_.arrayLayers) * desc_.mipLevels);
+
+    for_range(mipLevel, desc_.mipLevels)
+    {
+        const KTX2LevelIndex&   level   = levels[mipLevel];
+        const std::size_t       size    = static_cast<std::size_t>(GetSubresourceSize(formatAttribs, GetMipSpatialExtent(desc_, mipLevel)));
+
+        for_range(arrayLayer, desc_.arrayLayers)
+        {
+            Subresource& subresource = subresources_[arrayLayer * desc_.mipLevels + mipLevel];
+            subresource.offset  = static_cast<std::size_t>(level.byteOffset) + arrayLayer * size;
+            subresource.size    = size;
+        }
+    }
+
+    type_ = ImageContainerType::KTX2;
+
+    return true;
+}
+
+void ImageContainer::AppendSubresource(std::size_t offset, std::size_t size)
+{
+    subresources_.push_back(Subresource{ offset, size });
+}
+
+bool ImageContainer::ValidateSubresources(Report* report)
+{
+    /* Ensure all subresources are within the container range */
+    const std::size_t blobSize = blob_.GetSize();
+
+    for (const Subresource& subresource : subresources_)
+    {
+        if (subresource.offset > blobSize || subresource.size > blobSize - subresource.offset)
+            return ErrorImageContainer(report, "image container is truncated: expected %zu bytes but got only %zu\n", subresource.offset + subresource.size, blobSize);
+    }
+
+    /* Set image format and data type for the image views */
+    const FormatAttributes& formatAttribs = GetFormatAttribs(desc_.format);
+    imageFormat_    = formatAttribs.format;
+    dataType_       = formatAttribs.dataType;
+
+    /* Determine whether all array layers of each MIP-map are stored consecutively */
+    layersContiguous_ = true;
+
+    for_range(mipLevel, desc_.mipLevels)
+    {
+        const Subresource& baseSubresource = subresources_[mipLevel];
+        for_subrange(arrayLayer, 1u, desc_.arrayLayers)
+        {
+            const Subresource& subresource = subresources_[arrayLayer * desc_.mipLevels + mipLevel];
+            if (subresource.offset != baseSubresource.offset + arrayLayer * baseSubresource.size)
+            {
+                layersContiguous_ = false;
+                return true;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -18,6 +18,9 @@
 #include "../Core/Threading.h"
 #include "Float16Compressor.h"
 #include "BCDecompressor.h"
+#include "BCCompressor.h"
+#include "ETCDecompressor.h"
+#include "ASTCDecompressor.h"
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -886,6 +889,80 @@ LLGL_EXPORT DynamicByteArray ConvertImageBuffer(
     return ConvertImageBuffer(srcImageView, dstFormat, dstDataType, extent1D, threadCount);
 }
 
+// Returns the decompressed image for BC formats or null if the format is not a supported BC format.
+static DynamicByteArray DecompressBCImageBufferToRGBA8UNorm(
+    Format              compressedFormat,
+    const ImageView&    srcImageView,
+    const Extent2D&     extent,
+    unsigned            threadCount)
+{
+    const char* srcData = static_cast<const char*>(srcImageView.data);
+    switch (compressedFormat)
+    {
+        case Format::BC1UNorm:
+        case Format::BC1UNorm_sRGB:
+            return DecompressBC1ToRGBA8UNorm(extent, srcData, srcImageView.dataSize, threadCount);
+        case Format::BC3UNorm:
+        case Format::BC3UNorm_sRGB:
+            return DecompressBC3ToRGBA8UNorm(extent, srcData, srcImageView.dataSize, threadCount);
+        case Format::BC4UNorm:
+            return DecompressBC4ToRGBA8UNorm(extent, srcData, srcImageView.dataSize, threadCount);
+        case Format::BC5UNorm:
+            return DecompressBC5ToRGBA8UNorm(extent, srcData, srcImageView.dataSize, threadCount);
+        default:
+            return nullptr;
+    }
+}
+
+static bool IsETCFormat(Format format)
+{
+    return (format == Format::ETC1UNorm || format == Format::ETC2UNorm || format == Format::ETC2UNorm_sRGB);
+}
+
+// Returns true if the specified format is an ASTC format and stores whether it is in sRGB color space.
+static bool IsASTCFormat(Format format, bool& isSRGB)
+{
+    switch (format)
+    {
+        case Format::ASTC4x4:
+        case Format::ASTC5x4:
+        case Format::ASTC5x5:
+        case Format::ASTC6x5:
+        case Format::ASTC6x6:
+        case Format::ASTC8x5:
+        case Format::ASTC8x6:
+        case Format::ASTC8x8:
+        case Format::ASTC10x5:
+        case Format::ASTC10x6:
+        case Format::ASTC10x8:
+        case Format::ASTC10x10:
+        case Format::ASTC12x10:
+        case Format::ASTC12x12:
+            isSRGB = false;
+            return true;
+
+        case Format::ASTC4x4_sRGB:
+        case Format::ASTC5x4_sRGB:
+        case Format::ASTC5x5_sRGB:
+        case Format::ASTC6x5_sRGB:
+        case Format::ASTC6x6_sRGB:
+        case Format::ASTC8x5_sRGB:
+        case Format::ASTC8x6_sRGB:
+        case Format::ASTC8x8_sRGB:
+        case Format::ASTC10x5_sRGB:
+        case Format::ASTC10x6_sRGB:
+        case Format::ASTC10x8_sRGB:
+        case Format::ASTC10x10_sRGB:
+        case Format::ASTC12x10_sRGB:
+        case Format::ASTC12x12_sRGB:
+            isSRGB = true;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
 LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
     Format              compressedFormat,
     const ImageView&    srcImageView,
@@ -897,12 +974,119 @@ LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
     if (threadCount == LLGL_MAX_THREAD_COUNT)
         threadCount = std::thread::hardware_concurrency();
 
+    /* Decompress ETC and ASTC formats directly into a new image buffer */
+    bool isSRGB = false;
+    if (IsETCFormat(compressedFormat) || IsASTCFormat(compressedFormat, isSRGB))
+    {
+        DynamicByteArray dstImage{ static_cast<std::size_t>(extent.width) * extent.height * 4, UninitializeTag{} };
+        const MutableImageView dstImageView{ ImageFormat::RGBA, DataType::UInt8, dstImage.get(), dstImage.size() };
+
+        if (!DecompressImageBufferToRGBA8UNorm(compressedFormat, srcImageView, dstImageView, extent, threadCount))
+            return nullptr;
+
+        return dstImage;
+    }
+
+    /* Check for BC compression */
+    return DecompressBCImageBufferToRGBA8UNorm(compressedFormat, srcImageView, extent, threadCount);
+}
+
+LLGL_EXPORT bool DecompressImageBufferToRGBA8UNorm(
+    Format                  compressedFormat,
+    const ImageView&        srcImageView,
+    const MutableImageView& dstImageView,
+    const Extent2D&         extent,
+    unsigned                threadCount)
+{
+    LLGL_ASSERT(srcImageView.rowStride == 0, "row stride not supported for compressed formats");
+    LLGL_ASSERT_PTR(dstImageView.data);
+    LLGL_ASSERT(
+        dstImageView.format == ImageFormat::RGBA && dstImageView.dataType == DataType::UInt8,
+        "destination image view must have format ImageFormat::RGBA and data type DataType::UInt8"
+    );
+
+    const std::size_t dstImageSize = static_cast<std::size_t>(extent.width) * extent.height * 4;
+    LLGL_ASSERT(
+        dstImageView.dataSize >= dstImageSize,
+        "destination image data size is too small: %zu specified but %zu required", dstImageView.dataSize, dstImageSize
+    );
+
+    if (threadCount == LLGL_MAX_THREAD_COUNT)
+        threadCount = std::thread::hardware_concurrency();
+
+    const char* srcData = static_cast<const char*>(srcImageView.data);
+
+    /* Check for ETC compression */
+    if (IsETCFormat(compressedFormat))
+        return DecompressETC2ToRGBA8UNorm(extent, srcData, srcImageView.dataSize, dstImageView, threadCount);
+
+    /* Check for ASTC compression */
+    bool isSRGB = false;
+    if (IsASTCFormat(compressedFormat, isSRGB))
+    {
+        const FormatAttributes& formatAttribs = GetFormatAttribs(compressedFormat);
+        const Extent2D blockExtent{ formatAttribs.blockWidth, formatAttribs.blockHeight };
+        return DecompressASTCToRGBA8UNorm(extent, blockExtent, isSRGB, srcData, srcImageView.dataSize, dstImageView, threadCount);
+    }
+
+    /* Decompress BC formats with intermediate buffer */
+    DynamicByteArray intermediateImage = DecompressBCImageBufferToRGBA8UNorm(compressedFormat, srcImageView, extent, threadCount);
+    if (!intermediateImage)
+        return false;
+
+    ::memcpy(dstImageView.data, intermediateImage.get(), dstImageSize);
+    return true;
+}
+
+LLGL_EXPORT DynamicByteArray CompressImageBuffer(
+    Format                  compressedFormat,
+    const ImageView&        srcImageView,
+    const Extent2D&         extent,
+    ImageCompressionQuality quality,
+    unsigned                threadCount)
+{
+    if (threadCount == LLGL_MAX_THREAD_COUNT)
+        threadCount = std::thread::hardware_concurrency();
+
+    /* Convert source image to RGBA8UNorm if necessary */
+    DynamicByteArray intermediateImage;
+    const char* srcData = static_cast<const char*>(srcImageView.data);
+    std::size_t srcRowStride = (srcImageView.rowStride > 0 ? srcImageView.rowStride : extent.width * 4);
+
+    if (srcImageView.format != ImageFormat::RGBA || srcImageView.dataType != DataType::UInt8)
+    {
+        intermediateImage = ConvertImageBuffer(srcImageView, ImageFormat::RGBA, DataType::UInt8, Extent3D{ extent.width, extent.height, 1 }, threadCount);
+        srcData         = intermediateImage.get();
+        srcRowStride    = extent.width * 4;
+    }
+    else
+    {
+        /* Source image is read directly, so validate its size against the row stride */
+        LLGL_ASSERT_PTR(srcImageView.data);
+        LLGL_ASSERT(
+            srcRowStride >= extent.width * 4,
+            "source image row stride is too small: %zu specified but %zu required", srcRowStride, static_cast<std::size_t>(extent.width) * 4
+        );
+        const std::size_t srcImageSize = srcRowStride * extent.height;
+        LLGL_ASSERT(
+            srcImageView.dataSize >= srcImageSize,
+            "source image data size is too small: %zu specified but %zu required", srcImageView.dataSize, srcImageSize
+        );
+    }
+
     /* Check for BC compression */
     switch (compressedFormat)
     {
         case Format::BC1UNorm:
         case Format::BC1UNorm_sRGB:
-            return DecompressBC1ToRGBA8UNorm(extent, static_cast<const char*>(srcImageView.data), srcImageView.dataSize, threadCount);
+            return CompressRGBA8UNormToBC1(extent, srcData, srcRowStride, quality, threadCount);
+        case Format::BC3UNorm:
+        case Format::BC3UNorm_sRGB:
+            return CompressRGBA8UNormToBC3(extent, srcData, srcRowStride, quality, threadCount);
+        case Format::BC4UNorm:
+            return CompressRGBA8UNormToBC4(extent, srcData, srcRowStride, quality, threadCount);
+        case Format::BC5UNorm:
+            return CompressRGBA8UNormToBC5(extent, srcData, srcRowStride, quality, threadCount);
         default:
             return nullptr;
     }
@@ -47,6 +47,7 @@ LLGL_IMPLEMENT_INTERFACE( CommandBuffer,            RenderSystemChild )
 LLGL_IMPLEMENT_INTERFACE( CommandBufferTier1,       CommandBuffer     )
 LLGL_IMPLEMENT_INTERFACE( CommandQueue,             RenderSystemChild )
 LLGL_IMPLEMENT_INTERFACE( Fence,                    RenderSystemChild )
+LLGL_IMPLEMENT_INTERFACE( MemoryHeap,               RenderSystemChild )
 LLGL_IMPLEMENT_INTERFACE( PipelineLayout,           RenderSystemChild )
 LLGL_IMPLEMENT_INTERFACE( PipelineCache,            RenderSystemChild )
 LLGL_IMPLEMENT_INTERFACE( PipelineState,            RenderSystemChild )
@@ -0,0 +1,149 @@
+/*
+ * MemoryAllocation.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MEMORY_ALLOCATION_H
+#define LLGL_MEMORY_ALLOCATION_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Allocator.h>
+#include <type_traits>
+#include <vector>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+// Allocates memory with the active allocator and records its usage. Traps if the allocation failed.
+LLGL_EXPORT void* AllocateMemory(std::size_t size, std::size_t alignment, AllocationCategory category);
+
+// Allocates memory with the active allocator and records its usage. Returns null if the allocation failed.
+LLGL_EXPORT void* TryAllocateMemory(std::size_t size, std::size_t alignment, AllocationCategory category);
+
+/*
+Changes the size of memory that was allocated with AllocateMemory() or TryAllocateMemory() and records the new usage.
+Returns null if the reallocation failed, in which case the input memory remains valid.
+*/
+LLGL_EXPORT void* ReallocateMemory(void* ptr, std::size_t oldSize, std::size_t newSize, std::size_t alignment, AllocationCategory category);
+
+// Frees memory that was allocated with AllocateMemory() with the same size, alignment, and category.
+LLGL_EXPORT void FreeMemory(void* ptr, std::size_t size, std::size_t alignment, AllocationCategory category);
+
+/*
+Makes the specified allocator the active one for a new render system; null specifies the default heap allocation.
+Returns false if a render system with a different allocator is still alive.
+*/
+LLGL_EXPORT bool AcquireAllocator(Allocator* allocator);
+
+// Releases the allocator of a render system that has been destroyed. Must be called once for each successful call to AcquireAllocator().
+LLGL_EXPORT void ReleaseAllocator();
+
+// Temporary array of trivial elements that is allocated with AllocationCategory::Transient.
+template <typename T>
+class TransientArray
+{
+
+        static_assert(std::is_trivial<T>::value, "TransientArray<T>: T must be a trivial type");
+
+    public:
+
+        TransientArray(const TransientArray&) = delete;
+        TransientArray& operator = (const TransientArray&) = delete;
+
+        explicit TransientArray(std::size_t count) :
+            data_  { count > 0 ? static_cast<T*>(AllocateMemory(sizeof(T) * count, alignof(T), AllocationCategory::Transient)) : nullptr },
+            count_ { count                                                                                                             }
+        {
+        }
+
+        ~TransientArray()
+        {
+            if (data_ != nullptr)
+                FreeMemory(data_, sizeof(T) * count_, alignof(T), AllocationCategory::Transient);
+        }
+
+        T* get() const
+        {
+            return data_;
+        }
+
+        T& operator [] (std::size_t index) const
+        {
+            return data_[index];
+        }
+
+    private:
+
+        T*          data_   = nullptr;
+        std::size_t count_  = 0;
+
+};
+
+
+// STL compatible allocator that routes the memory of standard containers through the active allocator with the specified category.
+template <typename T, AllocationCategory Category = AllocationCategory::Internal>
+class STLAllocator
+{
+
+    public:
+
+        using value_type = T;
+
+        template <typename TOther>
+        struct rebind
+        {
+            using other = STLAllocator<TOther, Category>;
+        };
+
+    public:
+
+        STLAllocator() = default;
+
+        template <typename TOther>
+        STLAllocator(const STLAllocator<TOther, Category>&) noexcept
+        {
+        }
+
+        T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(AllocateMemory(sizeof(T) * count, alignof(T), Category));
+        }
+
+        void deallocate(T* ptr, std::size_t count)
+        {
+            FreeMemory(ptr, sizeof(T) * count, alignof(T), Category);
+        }
+
+        template <typename TOther>
+        bool operator == (const STLAllocator<TOther, Category>&) const noexcept
+        {
+            return true;
+        }
+
+        template <typename TOther>
+        bool operator != (const STLAllocator<TOther, Category>&) const noexcept
+        {
+            return false;
+        }
+
+};
+
+// Vector for internal backend data whose memory is routed through the active allocator with AllocationCategory::Internal.
+template <typename T>
+using InternalVector = std::vector<T, STLAllocator<T>>;
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,120 @@
+/*
+ * FileMapping.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "FileMapping.h"
+#include <LLGL/Platform/Platform.h>
+
+#if defined LLGL_OS_WIN32
+#   include "Win32/Win32LeanAndMean.h"
+#   include <Windows.h>
+#elif !defined LLGL_OS_UWP && !defined LLGL_OS_ANDROID && !defined LLGL_OS_WASM
+#   define LLGL_FILE_MAPPING_POSIX
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+FileMapping::~FileMapping()
+{
+    #if defined LLGL_OS_WIN32
+    if (data_ != nullptr)
+        ::UnmapViewOfFile(data_);
+    if (handle_ != nullptr)
+        ::CloseHandle(reinterpret_cast<HANDLE>(handle_));
+    if (file_ != nullptr)
+        ::CloseHandle(reinterpret_cast<HANDLE>(file_));
+    #elif defined LLGL_FILE_MAPPING_POSIX
+    if (data_ != nullptr)
+        ::munmap(const_cast<void*>(data_), size_);
+    #endif
+}
+
+std::unique_ptr<FileMapping> FileMapping::Map(const char* filename)
+{
+    if (filename == nullptr || *filename == '\0')
+        return nullptr;
+
+    #if defined LLGL_OS_WIN32
+
+    std::unique_ptr<FileMapping> mapping{ new FileMapping{} };
+
+    /* Open file for shared read access */
+    HANDLE file = ::CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    mapping->file_ = file;
+
+    /* Empty files cannot be mapped */
+    LARGE_INTEGER fileSize;
+    if (!::GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        return nullptr;
+
+    HANDLE handle = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (handle == nullptr)
+        return nullptr;
+
+    mapping->handle_ = handle;
+
+    const void* data = ::MapViewOfFile(handle, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr)
+        return nullptr;
+
+    mapping->data_ = data;
+    mapping->size_ = static_cast<std::size_t>(fileSize.QuadPart);
+
+    return mapping;
+
+    #elif defined LLGL_FILE_MAPPING_POSIX
+
+    /* Open file and determine its size */
+    const int fd = ::open(filename, O_RDONLY);
+    if (fd == -1)
+        return nullptr;
+
+    struct stat fileStat;
+    if (::fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        ::close(fd);
+        return nullptr;
+    }
+
+    /* Map entire file; the file descriptor is no longer needed once the mapping has been established */
+    const std::size_t fileSize = static_cast<std::size_t>(fileStat.st_size);
+    void* data = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (data == MAP_FAILED)
+        return nullptr;
+
+    std::unique_ptr<FileMapping> mapping{ new FileMapping{} };
+    {
+        mapping->data_ = data;
+        mapping->size_ = fileSize;
+    }
+    return mapping;
+
+    #else
+
+    /* Memory mapped files are not supported on this platform */
+    return nullptr;
+
+    #endif
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,71 @@
+/*
+ * FileMapping.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_FILE_MAPPING_H
+#define LLGL_FILE_MAPPING_H
+
+
+#include <LLGL/NonCopyable.h>
+#include <LLGL/Platform/Platform.h>
+#include <memory>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+// Read-only memory mapping of an entire file.
+class FileMapping final : public NonCopyable
+{
+
+    public:
+
+        ~FileMapping();
+
+        // Maps the specified file into memory for read access. Returns null if the file could not be opened or memory mapping is not supported on this platform.
+        static std::unique_ptr<FileMapping> Map(const char* filename);
+
+    public:
+
+        // Returns a pointer to the start of the mapped file content.
+        inline const void* GetData() const
+        {
+            return data_;
+        }
+
+        // Returns the size (in bytes) of the mapped file content.
+        inline std::size_t GetSize() const
+        {
+            return size_;
+        }
+
+    private:
+
+        FileMapping() = default;
+
+    private:
+
+        const void* data_   = nullptr;
+        std::size_t size_   = 0;
+
+        #if defined LLGL_OS_WIN32
+        void*       file_   = nullptr;
+        void*       handle_ = nullptr;
+        #endif
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -17,14 +17,21 @@ namespace LLGL
 
 static std::vector<std::unique_ptr<LinuxDisplay>>   g_displayList;
 static std::vector<Display*>                        g_displayRefList;
-static Display*                                     g_primaryDisplay    = nullptr;
+static Display*                                     g_primaryDisplay        = nullptr;
+static bool                                         g_hasSharedX11Display   = false;
 
 LinuxSharedX11DisplaySPtr LinuxSharedX11Display::GetShared()
 {
     static LinuxSharedX11DisplaySPtr sharedX11Display = std::make_shared<LinuxSharedX11Display>();
+    g_hasSharedX11Display = true;
     return sharedX11Display;
 }
 
+bool LinuxSharedX11Display::HasShared()
+{
+    return g_hasSharedX11Display;
+}
+
 static bool UpdateDisplayList()
 {
     LinuxSharedX11DisplaySPtr sharedX11Display = LinuxSharedX11Display::GetShared();
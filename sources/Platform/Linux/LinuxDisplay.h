@@ -34,6 +34,9 @@ class LinuxSharedX11Display
         // Returns a shared instance of the X11 display.
         static LinuxSharedX11DisplaySPtr GetShared();
 
+        // Returns true if the shared instance of the X11 display has already been opened, i.e. GetShared() has been called before.
+        static bool HasShared();
+
         // Notify to retain a reference to libGL.so for the shared X11 display connection.
         static void RetainLibGL();
 
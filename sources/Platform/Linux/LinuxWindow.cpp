@@ -79,6 +79,10 @@ LinuxX11Context& LinuxX11Context::Get()
 
 bool Surface::ProcessEvents()
 {
+    /* Don't connect to the X server if no window has been created yet, e.g. when only headless GL contexts are used */
+    if (!LinuxSharedX11Display::HasShared())
+        return true;
+
     ::Display* display = LinuxSharedX11Display::GetShared()->GetNative();
 
     XEvent event;
@@ -11,12 +11,14 @@
 
 #include "../Core/CoreUtils.h"
 #include "../Core/Assertion.h"
+#include "../Core/MemoryAllocation.h"
 #include "CheckedCast.h"
 #include <memory>
 #include <vector>
 #include <utility>
 #include <type_traits>
 #include <unordered_set>
+#include <functional>
 #include <cstdint>
 
 
@@ -28,8 +30,8 @@ namespace LLGL
  * Global function templates
  */
 
-template <typename T, typename TBase>
-void RemoveFromUniqueSet(std::unordered_set<std::unique_ptr<T>>& cont, const TBase* entry)
+template <typename T, typename THash, typename TEqual, typename TAlloc, typename TBase>
+void RemoveFromUniqueSet(std::unordered_set<std::unique_ptr<T>, THash, TEqual, TAlloc>& cont, const TBase* entry)
 {
     if (entry)
     {
@@ -43,8 +45,8 @@ void RemoveFromUniqueSet(std::unordered_set<std::unique_ptr<T>>& cont, const TBa
     }
 }
 
-template <typename BaseType, typename SubType>
-SubType* TakeOwnership(std::unordered_set<std::unique_ptr<BaseType>>& objectSet, std::unique_ptr<SubType>&& object)
+template <typename BaseType, typename THash, typename TEqual, typename TAlloc, typename SubType>
+SubType* TakeOwnership(std::unordered_set<std::unique_ptr<BaseType>, THash, TEqual, TAlloc>& objectSet, std::unique_ptr<SubType>&& object)
 {
     auto ref = object.get();
     objectSet.emplace(std::forward<std::unique_ptr<SubType>>(object));
@@ -117,9 +119,9 @@ class PayloadUniquePtr final
             {
                 if (mem_ != nullptr)
                 {
-                    /* Call destructor and free memory including payload */
+                    /* Call destructor and free memory including payload; the allocation size is stored at the beginning of the memory block */
                     get()->~T();
-                    ::delete [] mem_;
+                    FreeMemory(mem_, *reinterpret_cast<const std::size_t*>(mem_), alignof(std::max_align_t), AllocationCategory::Object);
                 }
                 mem_ = mem;
             }
@@ -167,9 +169,10 @@ class PayloadUniquePtr final
         template <typename... Args>
         static PayloadUniquePtr<T, Payload> Alloc(const Payload& payload, Args&&... args)
         {
-            /* Allocate memory for payload and object with enough padding to have pointer alignment of <T> */
-            constexpr auto payloadAndPaddingSize = sizeof(Payload) + Alignment - 1;
-            char* mem = ::new char[sizeof(T) + payloadAndPaddingSize];
+            /* Allocate memory for allocation size, payload, and object with enough padding to have pointer alignment of <T> */
+            constexpr std::size_t allocSize = sizeof(std::size_t) + sizeof(Payload) + Alignment - 1 + sizeof(T);
+            char* mem = static_cast<char*>(AllocateMemory(allocSize, alignof(std::max_align_t), AllocationCategory::Object));
+            *reinterpret_cast<std::size_t*>(mem) = allocSize;
 
             /* Construct unique pointer with payload */
             PayloadUniquePtr<T, Payload> ptr{ mem };
@@ -190,7 +193,7 @@ class PayloadUniquePtr final
         std::uintptr_t addr() const
         {
             auto addr = reinterpret_cast<std::uintptr_t>(mem_);
-            return GetAlignedSize(addr + sizeof(Payload), Alignment);
+            return GetAlignedSize(addr + sizeof(std::size_t) + sizeof(Payload), Alignment);
         }
 
     private:
@@ -215,7 +218,7 @@ class UnorderedUniquePtrVector
 
     public:
 
-        using container_type    = std::vector<IndexedUniquePtr<T>>;
+        using container_type    = InternalVector<IndexedUniquePtr<T>>;
         using iterator          = typename container_type::iterator;
         using const_iterator    = typename container_type::const_iterator;
 
@@ -313,7 +316,7 @@ class UnorderedUniquePtrSet
 
     public:
 
-        using container_type    = std::unordered_set<std::unique_ptr<T>>;
+        using container_type    = std::unordered_set<std::unique_ptr<T>, std::hash<std::unique_ptr<T>>, std::equal_to<std::unique_ptr<T>>, STLAllocator<std::unique_ptr<T>>>;
         using iterator          = typename container_type::iterator;
         using const_iterator    = typename container_type::const_iterator;
 
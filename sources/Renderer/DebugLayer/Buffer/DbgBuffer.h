@@ -18,6 +18,8 @@ namespace LLGL
 {
 
 
+class DbgMemoryHeap;
+
 class DbgBuffer final : public Buffer
 {
 
@@ -51,6 +53,7 @@ class DbgBuffer final : public Buffer
         std::string                     label;
         std::uint64_t                   elements    = 0;
         bool                            initialized = false;
+        DbgMemoryHeap*                  memoryHeap  = nullptr; // Memory heap this buffer is placed in (only for placed buffers).
 
     private:
 
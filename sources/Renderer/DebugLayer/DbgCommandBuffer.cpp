@@ -21,6 +21,7 @@
 #include "RenderState/DbgPipelineState.h"
 #include "RenderState/DbgPipelineLayout.h"
 #include "RenderState/DbgResourceHeap.h"
+#include "RenderState/DbgMemoryHeap.h"
 #include "Shader/DbgShader.h"
 #include "Texture/DbgTexture.h"
 #include "Texture/DbgRenderTarget.h"
@@ -106,6 +107,42 @@ static const char* GetLabelOrDefault(const char* label, const char* defaultLabel
     return (label != nullptr ? label : defaultLabel);
 }
 
+// Returns the wrapped instance of the specified debug buffer or texture, or null if the resource is null.
+static Resource* GetPlacedResourceInstance(Resource* resource)
+{
+    if (resource != nullptr)
+    {
+        switch (resource->GetResourceType())
+        {
+            case ResourceType::Buffer:
+                return &(LLGL_CAST(DbgBuffer*, resource)->instance);
+            case ResourceType::Texture:
+                return &(LLGL_CAST(DbgTexture*, resource)->instance);
+            default:
+                break;
+        }
+    }
+    return nullptr;
+}
+
+// Returns the memory heap the specified debug buffer or texture is placed in, or null if the resource is not a placed resource.
+static DbgMemoryHeap* GetPlacedResourceMemoryHeap(const Resource* resource)
+{
+    if (resource != nullptr)
+    {
+        switch (resource->GetResourceType())
+        {
+            case ResourceType::Buffer:
+                return LLGL_CAST(const DbgBuffer*, resource)->memoryHeap;
+            case ResourceType::Texture:
+                return LLGL_CAST(const DbgTexture*, resource)->memoryHeap;
+            default:
+                break;
+        }
+    }
+    return nullptr;
+}
+
 static const char* GetResourceLabel(const Resource& resource)
 {
     switch (resource.GetResourceType())
@@ -152,6 +189,7 @@ DbgCommandBuffer::DbgCommandBuffer(
     limits_         { caps.limits                                                       },
     queryTimerPool_ { renderSystemInstance, commandQueueInstance, commandBufferInstance }
 {
+    InvalidateDirtyBits();
 }
 
 void DbgCommandBuffer::SetDebugName(const char* name)
@@ -191,8 +229,8 @@ void DbgCommandBuffer::End()
     LLGL_DBG_END_TIMER();
     instance.End();
 
-    /* Resolve timer query results for performance profiler */
-    if (perfProfilerEnabled_)
+    /* Take timer query results of previous encodings that are available by now; this continues after time recording has been disabled */
+    if (perfProfilerEnabled_ || queryTimerPool_.HasPendingRecords())
         queryTimerPool_.TakeRecords(profile_.timeRecords);
 
     if ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
@@ -580,6 +618,8 @@ void DbgCommandBuffer::BindVertexBuffer(DbgBuffer& bufferDbg)
     bindings_.vertexBufferStore[0]  = (&bufferDbg);
     bindings_.vertexBuffers         = bindings_.vertexBufferStore;
     bindings_.numVertexBuffers      = 1;
+
+    dirtyBits_.vertexLayout = 1;
 }
 
 void DbgCommandBuffer::SetVertexBuffer(Buffer& buffer)
@@ -625,6 +665,8 @@ void DbgCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 
         bindings_.vertexBuffers     = bufferArrayDbg.buffers.data();
         bindings_.numVertexBuffers  = static_cast<std::uint32_t>(bufferArrayDbg.buffers.size());
+
+        dirtyBits_.vertexLayout = 1;
     }
 
     LLGL_DBG_COMMAND( instance.SetVertexBufferArray(bufferArrayDbg.instance), "SetVertexBufferArray()" );
@@ -702,6 +744,7 @@ void DbgCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t
         AssertRecording();
         ValidateDescriptorSetIndex(descriptorSet, resourceHeapDbg.GetNumDescriptorSets(), resourceHeapDbg.label.c_str());
         bindings_.bindingTable.resourceHeap = &resourceHeap;
+        dirtyBits_.bindingTable = 1;
     }
 
     LLGL_DBG_COMMAND_EXT(
@@ -729,7 +772,10 @@ void DbgCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
             LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot bind resource without pipeline state");
 
         if (descriptor < bindings_.bindingTable.resources.size())
+        {
             bindings_.bindingTable.resources[descriptor] = &resource;
+            dirtyBits_.bindingTable = 1;
+        }
     }
 
     switch (resource.GetResourceType())
@@ -884,6 +930,32 @@ void DbgCommandBuffer::ResourceBarrier(
     );
 }
 
+void DbgCommandBuffer::AliasingBarrier(Resource* resourceBefore, Resource* resourceAfter)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        if (states_.insideRenderPass)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot insert aliasing barrier inside a render pass");
+
+        for (Resource* resource : { resourceBefore, resourceAfter })
+        {
+            if (resource != nullptr && resource->GetResourceType() != ResourceType::Buffer && resource->GetResourceType() != ResourceType::Texture)
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "aliasing barrier can only be inserted for placed buffers and textures");
+        }
+
+        /* Make the new resource the active one among all placed resources that overlap its memory */
+        if (DbgMemoryHeap* memoryHeapDbg = GetPlacedResourceMemoryHeap(resourceAfter))
+            memoryHeapDbg->ActivatePlacement(resourceAfter);
+    }
+
+    LLGL_DBG_COMMAND_EXT(
+        instance.AliasingBarrier(GetPlacedResourceInstance(resourceBefore), GetPlacedResourceInstance(resourceAfter)),
+        "AliasingBarrier(%s, %s)",
+        (resourceBefore != nullptr ? GetResourceLabel(*resourceBefore) : "null"),
+        (resourceAfter != nullptr ? GetResourceLabel(*resourceAfter) : "null")
+    );
+}
+
 /* ----- Render Passes ----- */
 
 void DbgCommandBuffer::BeginRenderPass(
@@ -1075,6 +1147,9 @@ void DbgCommandBuffer::SetPipelineState(PipelineState& pipelineState)
         }
 
         ResetBindingTable(bindings_.pipelineState->pipelineLayout);
+
+        /* New PSO invalidates all draw-time validations */
+        InvalidateDirtyBits();
     }
 
     /* Store primitive topology used in graphics pipeline */
@@ -1895,6 +1970,12 @@ void DbgCommandBuffer::ValidateAttachmentClear(const AttachmentClear& attachment
 
 void DbgCommandBuffer::ValidateVertexLayout()
 {
+    /* Vertex layout only has to be validated again if PSO or vertex buffers have changed */
+    if (!dirtyBits_.vertexLayout)
+        return;
+
+    dirtyBits_.vertexLayout = 0;
+
     if (auto pso = bindings_.pipelineState)
     {
         if (pso->isGraphicsPSO && bindings_.numVertexBuffers > 0)
@@ -2276,11 +2357,28 @@ void DbgCommandBuffer::ValidateBindFlags(long resourceFlags, long bindFlags, lon
 void DbgCommandBuffer::ValidateBindBufferFlags(DbgBuffer& bufferDbg, long bindFlags)
 {
     ValidateBindFlags(bufferDbg.desc.bindFlags, bindFlags, bindFlags, GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer"));
+    ValidatePlacedResourceAliasing(bufferDbg);
 }
 
 void DbgCommandBuffer::ValidateBindTextureFlags(DbgTexture& textureDbg, long bindFlags)
 {
     ValidateBindFlags(textureDbg.desc.bindFlags, bindFlags, bindFlags, GetLabelOrDefault(textureDbg.label, "LLGL::Texture"));
+    ValidatePlacedResourceAliasing(textureDbg);
+}
+
+void DbgCommandBuffer::ValidatePlacedResourceAliasing(const Resource& resource)
+{
+    if (DbgMemoryHeap* memoryHeapDbg = GetPlacedResourceMemoryHeap(&resource))
+    {
+        if (const Resource* activeResource = memoryHeapDbg->FindActiveOverlappingPlacement(&resource))
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidState,
+                "placed resource '%s' is used while it overlaps the memory of active resource '%s' without an aliasing barrier in between",
+                GetResourceLabel(resource), GetResourceLabel(*activeResource)
+            );
+        }
+    }
 }
 
 void DbgCommandBuffer::ValidateTextureRegion(DbgTexture& textureDbg, const TextureRegion& region)
@@ -2747,12 +2845,13 @@ void DbgCommandBuffer::ValidateBindingTable()
 {
     auto ValidateBindingTableWithLayout = [this](const DbgPipelineState& pso, const BindingTable& table, const PipelineLayoutDescriptor& layoutDesc)
     {
-        const std::string psoLabel = (!pso.label.empty() ? " \'" + pso.label + '\'' : "");
         LLGL_ASSERT(table.resources.size() == layoutDesc.bindings.size());
         for_range(i, table.resources.size())
         {
             if (table.resources[i] == nullptr)
             {
+                /* Only build labels on the error path to keep the common path free of allocations */
+                const std::string psoLabel = (!pso.label.empty() ? " \'" + pso.label + '\'' : "");
                 const BindingDescriptor& binding = layoutDesc.bindings[i];
                 const std::string bindingSetLabel = (binding.slot.set != 0 ? ", set " + std::to_string(binding.slot.set) : "");
                 const std::string bindingNameLabel = (!binding.name.empty() ? ", name '" + std::string(binding.name.c_str()) + '\'' : "");
@@ -2765,6 +2864,12 @@ void DbgCommandBuffer::ValidateBindingTable()
         }
     };
 
+    /* Binding table only has to be validated again if PSO or resource bindings have changed */
+    if (!dirtyBits_.bindingTable)
+        return;
+
+    dirtyBits_.bindingTable = 0;
+
     if (auto* pso = bindings_.pipelineState)
     {
         if (auto* pipelineLayout = pso->pipelineLayout)
@@ -2774,6 +2879,12 @@ void DbgCommandBuffer::ValidateBindingTable()
 
 void DbgCommandBuffer::ValidateBlendStates()
 {
+    /* Blend states only depend on the PSO, so they only have to be validated once per PSO binding */
+    if (!dirtyBits_.blendStates)
+        return;
+
+    dirtyBits_.blendStates = 0;
+
     if (auto* pso = bindings_.pipelineState)
     {
         /* If 'sampleMask' is zero, check if this might have been unintentional */
@@ -2945,6 +3056,7 @@ void DbgCommandBuffer::ResetStates()
     profile_    = {};
     bindings_   = {};
     states_     = {};
+    InvalidateDirtyBits();
 }
 
 void DbgCommandBuffer::ResetRecords()
@@ -2952,6 +3064,13 @@ void DbgCommandBuffer::ResetRecords()
     records_.swapChainFrames.clear();
 }
 
+void DbgCommandBuffer::InvalidateDirtyBits()
+{
+    dirtyBits_.vertexLayout = 1;
+    dirtyBits_.bindingTable = 1;
+    dirtyBits_.blendStates  = 1;
+}
+
 void DbgCommandBuffer::ResetBindingTable(const DbgPipelineLayout* pipelineLayoutDbg)
 {
     auto ResetBindingTableWithLayout = [](BindingTable& table, const PipelineLayoutDescriptor& layoutDesc)
@@ -124,6 +124,14 @@ class DbgCommandBuffer final : public CommandBufferTier1
             std::vector<SwapChainFramePair> swapChainFrames;
         };
 
+        // Bitmask of validation passes that must be re-run at the next draw or dispatch command.
+        struct DirtyBits
+        {
+            std::uint32_t vertexLayout  : 1;
+            std::uint32_t bindingTable  : 1;
+            std::uint32_t blendStates   : 1;
+        };
+
     private:
 
         void ValidateBeginOfRecording();
@@ -154,6 +162,7 @@ class DbgCommandBuffer final : public CommandBufferTier1
         void ValidateBindFlags(long resourceFlags, long bindFlags, long validFlags, const char* resourceName = nullptr);
         void ValidateBindBufferFlags(DbgBuffer& bufferDbg, long bindFlags);
         void ValidateBindTextureFlags(DbgTexture& textureDbg, long bindFlags);
+        void ValidatePlacedResourceAliasing(const Resource& resource);
         void ValidateTextureRegion(DbgTexture& textureDbg, const TextureRegion& region);
         void ValidateTextureRegionForFramebuffer(const TextureRegion& region, const Offset2D& offset);
         void ValidateIndexType(const Format format);
@@ -206,6 +215,7 @@ class DbgCommandBuffer final : public CommandBufferTier1
 
         void ResetStates();
         void ResetRecords();
+        void InvalidateDirtyBits();
         void ResetBindingTable(const DbgPipelineLayout* pipelineLayoutDbg);
 
         void StartTimer(StringLiteral annotation);
@@ -240,6 +250,7 @@ class DbgCommandBuffer final : public CommandBufferTier1
         Bindings                    bindings_;
         States                      states_;
         Records                     records_;
+        DirtyBits                   dirtyBits_;
 
 };
 
@@ -12,14 +12,15 @@
 #include <LLGL/QueryHeap.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Timer.h>
-#include <thread>
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
-static constexpr std::uint32_t g_queryTimerHeapSize = 64;
+// Number of queries per heap. Heaps are large, so thousands of timer scopes per frame only need a few heaps.
+static constexpr std::uint32_t g_queryTimerHeapSize = 1024;
 
 struct DbgQueryTimerIndices
 {
@@ -36,6 +37,12 @@ static DbgQueryTimerIndices GetQueryForRecord(std::size_t recordIndex)
     };
 }
 
+static void AppendRecords(DynamicVector<ProfileTimeRecord>& dst, DynamicVector<ProfileTimeRecord>& src)
+{
+    dst.insert(dst.end(), src.begin(), src.end());
+    src.clear();
+}
+
 DbgQueryTimerPool::DbgQueryTimerPool(
     RenderSystem&   renderSystemInstance,
     CommandQueue&   commandQueueInstance,
@@ -50,15 +57,29 @@ DbgQueryTimerPool::DbgQueryTimerPool(
 void DbgQueryTimerPool::Reset()
 {
     LLGL_ASSERT(pendingRecordStack_.empty(), "unbalanced calls to Start()/Stop() in query timer pool");
-    records_.clear();
-    currentQuery_       = 0;
-    currentQueryHeap_   = 0;
-    cpuTicksBase_       = Timer::Tick();
+
+    /* Move on to next frame in the ring buffer */
+    currentFrame_ = (currentFrame_ + 1) % maxNumFrames;
+    Frame& frame = frames_[currentFrame_];
+
+    if (frame.state == FrameState::Pending)
+    {
+        /* All frames are still in flight, so the oldest frame must be resolved before its queries can be reused */
+        ResolveQueryResults(frame, true);
+        AppendRecords(resolvedRecords_, frame.records);
+    }
+
+    frame.records.clear();
+    frame.state     = FrameState::Recording;
+    cpuTicksBase_   = Timer::Tick();
 }
 
 void DbgQueryTimerPool::Start(StringLiteral annotation)
 {
-    pendingRecordStack_.push(records_.size());
+    Frame& frame = frames_[currentFrame_];
+
+    const std::size_t recordIndex = frame.records.size();
+    pendingRecordStack_.push(recordIndex);
 
     /* Store annotation only first */
     ProfileTimeRecord record;
@@ -66,50 +87,77 @@ void DbgQueryTimerPool::Start(StringLiteral annotation)
         record.annotation       = std::move(annotation);
         record.cpuTicksStart    = Timer::Tick() - cpuTicksBase_;
     }
-    records_.push_back(record);
-
-    /* Check if end of query heap has been reached */
-    if (currentQuery_ == g_queryTimerHeapSize)
-    {
-        currentQuery_ = 0;
-        ++currentQueryHeap_;
-    }
+    frame.records.push_back(record);
 
     /* Check if new query heap must be created */
-    if (currentQueryHeap_ == queryHeaps_.size())
+    const DbgQueryTimerIndices indices = GetQueryForRecord(recordIndex);
+    if (indices.heapIndex == frame.queryHeaps.size())
     {
         QueryHeapDescriptor queryDesc;
         {
             queryDesc.type          = QueryType::TimeElapsed;
             queryDesc.numQueries    = g_queryTimerHeapSize;
         }
-        queryHeaps_.push_back(renderSystem_.CreateQueryHeap(queryDesc));
+        frame.queryHeaps.push_back(renderSystem_.CreateQueryHeap(queryDesc));
     }
 
     /* Begin timer query */
-    commandBuffer_.BeginQuery(*queryHeaps_[currentQueryHeap_], currentQuery_);
-    ++currentQuery_;
+    commandBuffer_.BeginQuery(*frame.queryHeaps[indices.heapIndex], indices.queryIndex);
 }
 
 void DbgQueryTimerPool::Stop()
 {
+    Frame& frame = frames_[currentFrame_];
+
     /* Get index to the current pending record */
     const std::size_t recordIndex = pendingRecordStack_.top();
     pendingRecordStack_.pop();
-    ProfileTimeRecord& rec = records_[recordIndex];
+
+    ProfileTimeRecord& rec = frame.records[recordIndex];
 
     /* Record CPU ticks at end */
     rec.cpuTicksEnd = Timer::Tick() - cpuTicksBase_;
 
     /* Stop timer query */
     const DbgQueryTimerIndices indices = GetQueryForRecord(recordIndex);
-    commandBuffer_.EndQuery(*queryHeaps_[indices.heapIndex], indices.queryIndex);
+    commandBuffer_.EndQuery(*frame.queryHeaps[indices.heapIndex], indices.queryIndex);
 }
 
 void DbgQueryTimerPool::TakeRecords(DynamicVector<ProfileTimeRecord>& outRecords)
 {
-    ResolveQueryResults();
-    outRecords = std::move(records_);
+    if (frames_[currentFrame_].state == FrameState::Recording)
+        frames_[currentFrame_].state = FrameState::Pending;
+
+    /* Take records that had to be resolved before their frame was reused */
+    AppendRecords(outRecords, resolvedRecords_);
+
+    /* Take records of all pending frames from oldest to newest until the first frame whose results are not yet available */
+    for_range(i, maxNumFrames)
+    {
+        Frame& frame = frames_[(currentFrame_ + 1 + i) % maxNumFrames];
+        if (frame.state != FrameState::Pending)
+            continue;
+
+        if (!ResolveQueryResults(frame, false))
+            break;
+
+        AppendRecords(outRecords, frame.records);
+        frame.state = FrameState::Idle;
+    }
+}
+
+bool DbgQueryTimerPool::HasPendingRecords() const
+{
+    if (!resolvedRecords_.empty())
+        return true;
+
+    for (const Frame& frame : frames_)
+    {
+        if (frame.state == FrameState::Pending)
+            return true;
+    }
+
+    return false;
 }
 
 
@@ -117,23 +165,40 @@ void DbgQueryTimerPool::TakeRecords(DynamicVector<ProfileTimeRecord>& outRecords
  * ======= Private: =======
  */
 
-void DbgQueryTimerPool::ResolveQueryResults()
+bool DbgQueryTimerPool::ResolveQueryResults(Frame& frame, bool wait)
 {
-    constexpr int maxAttempts = 100;
+    /* Query all results of each heap at once */
+    const std::size_t numRecords = frame.records.size();
 
-    for_range(i, records_.size())
+    for (std::size_t firstRecord = 0; firstRecord < numRecords; firstRecord += g_queryTimerHeapSize)
     {
-        ProfileTimeRecord& rec = records_[i];
-        const DbgQueryTimerIndices indices = GetQueryForRecord(i);
+        const std::uint32_t heapIndex   = GetQueryForRecord(firstRecord).heapIndex;
+        const std::uint32_t numQueries  = static_cast<std::uint32_t>(std::min<std::size_t>(numRecords - firstRecord, g_queryTimerHeapSize));
+
+        queryResults_.resize(numQueries);
+        const std::size_t resultsSize = numQueries * sizeof(std::uint64_t);
+
+        bool available = commandQueue_.QueryResult(*frame.queryHeaps[heapIndex], 0, numQueries, queryResults_.data(), resultsSize);
 
-        for_range(i, maxAttempts)
+        if (!available)
         {
-            if (!commandQueue_.QueryResult(*queryHeaps_[indices.heapIndex], indices.queryIndex, 1, &(rec.elapsedTime), sizeof(rec.elapsedTime)))
-                std::this_thread::yield();
-            else
-                break;
+            if (!wait)
+                return false;
+
+            /* Block until the GPU has finished all submitted work, then the results must be available */
+            commandQueue_.WaitIdle();
+            available = commandQueue_.QueryResult(*frame.queryHeaps[heapIndex], 0, numQueries, queryResults_.data(), resultsSize);
+
+            /* Only results of command buffers that have never been submitted can still be unavailable */
+            if (!available)
+                std::fill(queryResults_.begin(), queryResults_.end(), 0);
         }
+
+        for_range(i, numQueries)
+            frame.records[firstRecord + i].elapsedTime = queryResults_[i];
     }
+
+    return true;
 }
 
 
@@ -19,6 +19,10 @@ namespace LLGL
 {
 
 
+/*
+Allocates timer queries from large query heaps and resolves their results asynchronously.
+Each encoding uses the next frame of a ring buffer, so results are handed out a few encodings later without waiting for the GPU.
+*/
 class DbgQueryTimerPool
 {
 
@@ -30,7 +34,7 @@ class DbgQueryTimerPool
             CommandBuffer&  commandBufferInstance
         );
 
-        // Resets all records in this timer manager.
+        // Begins recording the next frame of records.
         void Reset();
 
         // Starts measuring the time with the specified annotation.
@@ -39,13 +43,34 @@ class DbgQueryTimerPool
         // Stops measing the time and stores the current record.
         void Stop();
 
-        // Moves the internal records to the specified output container.
+        // Marks the current frame as pending and appends the records of all frames whose results are already available to the output container.
         void TakeRecords(DynamicVector<ProfileTimeRecord>& outRecords);
 
+        // Returns true if there are frames whose records have not been taken yet.
+        bool HasPendingRecords() const;
+
+    private:
+
+        static constexpr std::uint32_t maxNumFrames = 3;
+
+        enum class FrameState
+        {
+            Idle,
+            Recording,
+            Pending,
+        };
+
+        struct Frame
+        {
+            std::vector<QueryHeap*>             queryHeaps;
+            DynamicVector<ProfileTimeRecord>    records;
+            FrameState                          state       = FrameState::Idle;
+        };
+
     private:
 
-        // Resolves all timer values into the output records.
-        void ResolveQueryResults();
+        // Resolves all timer values of the specified frame into its records. Returns false if the results are not yet available and 'wait' is false, otherwise blocks until the queue is idle.
+        bool ResolveQueryResults(Frame& frame, bool wait);
 
     private:
 
@@ -53,12 +78,13 @@ class DbgQueryTimerPool
         CommandQueue&                       commandQueue_;
         CommandBuffer&                      commandBuffer_;
 
-        std::vector<QueryHeap*>             queryHeaps_;
+        Frame                               frames_[maxNumFrames];
+        std::uint32_t                       currentFrame_       = 0;
+
         std::stack<std::size_t>             pendingRecordStack_;
-        std::uint32_t                       currentQuery_       = 0;
-        std::uint32_t                       currentQueryHeap_   = 0;
+        DynamicVector<ProfileTimeRecord>    resolvedRecords_;
+        std::vector<std::uint64_t>          queryResults_;
 
-        DynamicVector<ProfileTimeRecord>    records_;
         std::uint64_t                       cpuTicksBase_       = 0;
 
 };
@@ -111,6 +111,9 @@ void DbgRenderSystem::Release(CommandBuffer& commandBuffer)
 
 Buffer* DbgRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
+    MemoryRequirements requirements;
+    const bool hasRequirements = instance_->GetMemoryRequirements(bufferDesc, requirements);
+
     /* Validate and store format size (if supported) */
     std::uint32_t formatSize = 0;
 
@@ -148,6 +151,9 @@ BufferArray* DbgRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer
 
 void DbgRenderSystem::Release(Buffer& buffer)
 {
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+    if (bufferDbg.memoryHeap != nullptr)
+        bufferDbg.memoryHeap->RemovePlacement(&bufferDbg);
     ReleaseDbg(buffers_, buffer);
 }
 
@@ -262,6 +268,9 @@ Texture* DbgRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, co
 
 void DbgRenderSystem::Release(Texture& texture)
 {
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+    if (textureDbg.memoryHeap != nullptr)
+        textureDbg.memoryHeap->RemovePlacement(&textureDbg);
     ReleaseDbg(textures_, texture);
 }
 
@@ -309,6 +318,113 @@ void DbgRenderSystem::Release(Sampler& sampler)
     //ReleaseDbg(samplers_, sampler);
 }
 
+/* ----- Memory Heaps ----- */
+
+MemoryHeap* DbgRenderSystem::CreateMemoryHeap(const MemoryHeapDescriptor& memoryHeapDesc)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertPlacedResources();
+        ValidateMemoryHeapDesc(memoryHeapDesc);
+    }
+
+    MemoryHeap* memoryHeap = instance_->CreateMemoryHeap(memoryHeapDesc);
+    if (memoryHeap == nullptr)
+        return nullptr;
+
+    return memoryHeaps_.emplace<DbgMemoryHeap>(*memoryHeap, memoryHeapDesc);
+}
+
+void DbgRenderSystem::Release(MemoryHeap& memoryHeap)
+{
+    /* Reject release of memory heap while resources are still placed in it, since they would reference released memory */
+    auto& memoryHeapDbg = LLGL_CAST(DbgMemoryHeap&, memoryHeap);
+    if (memoryHeapDbg.GetNumPlacements() > 0)
+    {
+        if (LLGL_DBG_SOURCE())
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidState,
+                "cannot release memory heap while %zu placed resource(s) are still alive",
+                memoryHeapDbg.GetNumPlacements()
+            );
+        }
+        return;
+    }
+    ReleaseDbg(memoryHeaps_, memoryHeap);
+}
+
+bool DbgRenderSystem::GetMemoryRequirements(const TextureDescriptor& textureDesc, MemoryRequirements& outRequirements)
+{
+    return instance_->GetMemoryRequirements(textureDesc, outRequirements);
+}
+
+bool DbgRenderSystem::GetMemoryRequirements(const BufferDescriptor& bufferDesc, MemoryRequirements& outRequirements)
+{
+    return instance_->GetMemoryRequirements(bufferDesc, outRequirements);
+}
+
+Texture* DbgRenderSystem::CreatePlacedTexture(MemoryHeap& memoryHeap, std::uint64_t offset, const TextureDescriptor& textureDesc)
+{
+    auto& memoryHeapDbg = LLGL_CAST(DbgMemoryHeap&, memoryHeap);
+
+    MemoryRequirements requirements;
+    const bool hasRequirements = instance_->GetMemoryRequirements(textureDesc, requirements);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        ValidateTextureDesc(textureDesc, nullptr);
+        ValidateMemoryHeapResources(memoryHeapDbg, GetMemoryHeapResourceFlags(textureDesc), "texture");
+        if (hasRequirements)
+            ValidateMemoryPlacement(memoryHeapDbg, offset, requirements, "texture");
+    }
+
+    Texture* texture = instance_->CreatePlacedTexture(memoryHeapDbg.instance, offset, textureDesc);
+    if (texture == nullptr)
+        return nullptr;
+
+    auto* textureDbg = textures_.emplace<DbgTexture>(*texture, textureDesc);
+    {
+        textureDbg->memoryHeap = &memoryHeapDbg;
+        memoryHeapDbg.AddPlacement(textureDbg, offset, requirements.size);
+    }
+    return textureDbg;
+}
+
+Buffer* DbgRenderSystem::CreatePlacedBuffer(MemoryHeap& memoryHeap, std::uint64_t offset, const BufferDescriptor& bufferDesc)
+{
+    auto& memoryHeapDbg = LLGL_CAST(DbgMemoryHeap&, memoryHeap);
+
+    MemoryRequirements requirements;
+    const bool hasRequirements = instance_->GetMemoryRequirements(bufferDesc, requirements);
+
+    /* Validate and store format size (if supported) */
+    std::uint32_t formatSize = 0;
+
+    if (LLGL_DBG_SOURCE())
+    {
+        ValidateBufferDesc(bufferDesc, &formatSize);
+        if (bufferDesc.cpuAccessFlags != 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "placed buffers must not have any CPU access flags");
+        ValidateMemoryHeapResources(memoryHeapDbg, MemoryHeapResourceFlags::Buffers, "buffer");
+        if (hasRequirements)
+            ValidateMemoryPlacement(memoryHeapDbg, offset, requirements, "buffer");
+    }
+
+    Buffer* buffer = instance_->CreatePlacedBuffer(memoryHeapDbg.instance, offset, bufferDesc);
+    if (buffer == nullptr)
+        return nullptr;
+
+    auto* bufferDbg = buffers_.emplace<DbgBuffer>(*buffer, bufferDesc);
+    {
+        bufferDbg->elements     = (formatSize > 0 ? bufferDesc.size / formatSize : 0);
+        bufferDbg->initialized  = false;
+        bufferDbg->memoryHeap   = &memoryHeapDbg;
+    }
+    memoryHeapDbg.AddPlacement(bufferDbg, offset, requirements.size);
+    return bufferDbg;
+}
+
 /* ----- Resource Views ----- */
 
 // private
@@ -377,9 +493,15 @@ ResourceHeap* DbgRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor&
         auto pipelineLayoutDbg = LLGL_CAST(DbgPipelineLayout*, resourceHeapDesc.pipelineLayout);
         instanceDesc.pipelineLayout = &(pipelineLayoutDbg->instance);
     }
+
+    /* Determine number of resource views from initial resource views if not specified, so subsequent heap writes are validated against the actual size */
+    auto heapDesc = resourceHeapDesc;
+    if (heapDesc.numResourceViews == 0)
+        heapDesc.numResourceViews = static_cast<std::uint32_t>(initialResourceViews.size());
+
     return resourceHeaps_.emplace<DbgResourceHeap>(
         *instance_->CreateResourceHeap(instanceDesc, instanceResourceViews),
-        resourceHeapDesc
+        heapDesc
     );
 }
 
@@ -399,6 +521,44 @@ std::uint32_t DbgRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std
     return instance_->WriteResourceHeap(resourceHeapDbg.instance, firstDescriptor, instanceResourceViews);
 }
 
+void DbgRenderSystem::BeginResourceHeapUpdate(ResourceHeap& resourceHeap)
+{
+    auto& resourceHeapDbg = LLGL_CAST(DbgResourceHeap&, resourceHeap);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        if (resourceHeapDbg.isUpdatePending)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidState,
+                "cannot begin update of resource heap while another update is still pending"
+            );
+        }
+    }
+
+    resourceHeapDbg.isUpdatePending = true;
+    instance_->BeginResourceHeapUpdate(resourceHeapDbg.instance);
+}
+
+std::uint32_t DbgRenderSystem::CommitResourceHeapUpdate(ResourceHeap& resourceHeap)
+{
+    auto& resourceHeapDbg = LLGL_CAST(DbgResourceHeap&, resourceHeap);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        if (!resourceHeapDbg.isUpdatePending)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidState,
+                "cannot commit update of resource heap without a pending update"
+            );
+        }
+    }
+
+    resourceHeapDbg.isUpdatePending = false;
+    return instance_->CommitResourceHeapUpdate(resourceHeapDbg.instance);
+}
+
 /* ----- Render Passes ----- */
 
 RenderPass* DbgRenderSystem::CreateRenderPass(const RenderPassDescriptor& renderPassDesc)
@@ -1729,6 +1889,50 @@ void DbgRenderSystem::ValidatePipelineLayoutDesc(const PipelineLayoutDescriptor&
                 bindingLabel.c_str(), binding.arraySize
             );
         }
+        if ((binding.flags & BindingFlags::DescriptorIndexing) != 0)
+        {
+            const std::string bindingLabel = GetBindingDescLabel(binding);
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "individual binding %s has BindingFlags::DescriptorIndexing, but only heap-bindings can be descriptor indexed",
+                bindingLabel.c_str()
+            );
+        }
+    }
+
+    /* Validate descriptor indexed heap bindings */
+    for (const BindingDescriptor& binding : pipelineLayoutDesc.heapBindings)
+    {
+        if ((binding.flags & BindingFlags::DescriptorIndexing) == 0)
+            continue;
+
+        const std::string bindingLabel = GetBindingDescLabel(binding);
+        const RenderingCapabilities& caps = GetRenderingCaps();
+
+        if (!caps.features.hasDescriptorIndexing)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::UnsupportedFeature,
+                "heap binding %s has BindingFlags::DescriptorIndexing, but descriptor indexing is not supported",
+                bindingLabel.c_str()
+            );
+        }
+        else if (binding.arraySize == 0)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "heap binding %s has BindingFlags::DescriptorIndexing, but array size is zero",
+                bindingLabel.c_str()
+            );
+        }
+        else if (binding.arraySize > caps.limits.maxDescriptorIndexingArraySize)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "heap binding %s has array size of %u, but limit for descriptor indexing is %u",
+                bindingLabel.c_str(), binding.arraySize, caps.limits.maxDescriptorIndexingArraySize
+            );
+        }
     }
 }
 
@@ -1936,6 +2140,49 @@ void DbgRenderSystem::ValidateBlendTargetDescriptor(const BlendTargetDescriptor&
     }
 }
 
+void DbgRenderSystem::ValidateMemoryHeapDesc(const MemoryHeapDescriptor& memoryHeapDesc)
+{
+    if (memoryHeapDesc.size == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create memory heap of size zero");
+    if (memoryHeapDesc.resources == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create memory heap without any resource flags");
+    else if ((memoryHeapDesc.resources & ~MemoryHeapResourceFlags::All) != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "unknown memory heap resource flags: 0x%08X", static_cast<unsigned>(memoryHeapDesc.resources & ~MemoryHeapResourceFlags::All));
+}
+
+void DbgRenderSystem::ValidateMemoryHeapResources(const DbgMemoryHeap& memoryHeapDbg, long resources, const char* resourceName)
+{
+    if ((memoryHeapDbg.desc.resources & resources) != resources)
+    {
+        const char* resourceKind = "buffers";
+        if (resources == MemoryHeapResourceFlags::Textures)
+            resourceKind = "textures without attachment bindings";
+        else if (resources == MemoryHeapResourceFlags::AttachmentTextures)
+            resourceKind = "textures with attachment bindings";
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot place %s in memory heap that was not created for %s", resourceName, resourceKind);
+    }
+}
+
+void DbgRenderSystem::ValidateMemoryPlacement(const DbgMemoryHeap& memoryHeapDbg, std::uint64_t offset, const MemoryRequirements& requirements, const char* resourceName)
+{
+    if (requirements.alignment > 0 && offset % requirements.alignment != 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "offset of placed %s (%" PRIu64 ") is not a multiple of its required alignment (%" PRIu64 ")",
+            resourceName, offset, requirements.alignment
+        );
+    }
+    if (offset > memoryHeapDbg.GetSize() || requirements.size > memoryHeapDbg.GetSize() - offset)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "placed %s exceeds memory heap: offset (%" PRIu64 ") + size (%" PRIu64 ") > heap size (%" PRIu64 ")",
+            resourceName, offset, requirements.size, memoryHeapDbg.GetSize()
+        );
+    }
+}
+
 void DbgRenderSystem::ValidateInputAssemblyDescriptor(const GraphicsPipelineDescriptor& pipelineStateDesc)
 {
     const Format indexFormat = pipelineStateDesc.indexFormat;
@@ -2541,6 +2788,13 @@ void DbgRenderSystem::Assert3DTextures()
         LLGL_DBG_ERROR_NOT_SUPPORTED("3D textures");
 }
 
+void DbgRenderSystem::AssertPlacedResources()
+{
+    const RenderingFeatures& features = GetRenderingCaps().features;
+    if (!features.hasPlacedResources)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("placed resources");
+}
+
 void DbgRenderSystem::AssertCubeTextures()
 {
     const RenderingFeatures& features = GetRenderingCaps().features;
@@ -18,6 +18,7 @@
 
 #include "Buffer/DbgBuffer.h"
 #include "Buffer/DbgBufferArray.h"
+#include "RenderState/DbgMemoryHeap.h"
 #include "RenderState/DbgPipelineLayout.h"
 #include "RenderState/DbgPipelineState.h"
 #include "RenderState/DbgQueryHeap.h"
@@ -42,6 +43,18 @@ class DbgRenderSystem final : public RenderSystem
 
         #include <LLGL/Backend/RenderSystem.inl>
 
+    public:
+
+        void BeginResourceHeapUpdate(ResourceHeap& resourceHeap) override;
+        std::uint32_t CommitResourceHeapUpdate(ResourceHeap& resourceHeap) override;
+
+        MemoryHeap* CreateMemoryHeap(const MemoryHeapDescriptor& memoryHeapDesc) override;
+        void Release(MemoryHeap& memoryHeap) override;
+        bool GetMemoryRequirements(const TextureDescriptor& textureDesc, MemoryRequirements& outRequirements) override;
+        bool GetMemoryRequirements(const BufferDescriptor& bufferDesc, MemoryRequirements& outRequirements) override;
+        Texture* CreatePlacedTexture(MemoryHeap& memoryHeap, std::uint64_t offset, const TextureDescriptor& textureDesc) override;
+        Buffer* CreatePlacedBuffer(MemoryHeap& memoryHeap, std::uint64_t offset, const BufferDescriptor& bufferDesc) override;
+
     public:
 
         DbgRenderSystem(RenderSystemPtr&& instance, RenderingDebugger* debugger);
@@ -101,6 +114,10 @@ class DbgRenderSystem final : public RenderSystem
         void ValidateBufferForBinding(const DbgBuffer& bufferDbg, const BindingDescriptor& bindingDesc);
         void ValidateTextureForBinding(const DbgTexture& textureDbg, const BindingDescriptor& bindingDesc);
 
+        void ValidateMemoryHeapDesc(const MemoryHeapDescriptor& memoryHeapDesc);
+        void ValidateMemoryHeapResources(const DbgMemoryHeap& memoryHeapDbg, long resources, const char* resourceName);
+        void ValidateMemoryPlacement(const DbgMemoryHeap& memoryHeapDbg, std::uint64_t offset, const MemoryRequirements& requirements, const char* resourceName);
+
         void ValidateInputAssemblyDescriptor(const GraphicsPipelineDescriptor& pipelineStateDesc);
         void ValidateBlendTargetDescriptor(const BlendTargetDescriptor& blendTargetDesc, std::size_t idx);
         void ValidateBlendDescriptor(const BlendDescriptor& blendDesc, bool hasFragmentShader, bool hasDualSourceBlend);
@@ -117,6 +134,7 @@ class DbgRenderSystem final : public RenderSystem
         void AssertArrayTextures();
         void AssertCubeArrayTextures();
         void AssertMultiSampleTextures();
+        void AssertPlacedResources();
 
         template <typename T, typename TBase>
         void ReleaseDbg(HWObjectContainer<T>& cont, TBase& entry);
@@ -148,6 +166,7 @@ class DbgRenderSystem final : public RenderSystem
         HWObjectContainer<DbgResourceHeap>      resourceHeaps_;
         //HWObjectContainer<DbgSampler>           samplers_;
         HWObjectContainer<DbgQueryHeap>         queryHeaps_;
+        HWObjectContainer<DbgMemoryHeap>        memoryHeaps_;
 
 };
 
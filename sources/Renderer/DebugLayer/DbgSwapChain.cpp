@@ -95,6 +95,11 @@ bool DbgSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
     return instance.SetVsyncInterval(vsyncInterval);
 }
 
+bool DbgSwapChain::GetFrameTimings(SwapChainFrameTimings& outTimings) const
+{
+    return instance.GetFrameTimings(outTimings);
+}
+
 const RenderPass* DbgSwapChain::GetRenderPass() const
 {
     return renderPass_.get();
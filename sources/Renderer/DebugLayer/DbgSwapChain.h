@@ -38,6 +38,8 @@ class DbgSwapChain final : public SwapChain
 
         void SetDebugName(const char* name) override;
 
+        bool GetFrameTimings(SwapChainFrameTimings& outTimings) const override;
+
     public:
 
         DbgSwapChain(SwapChain& instance, const SwapChainDescriptor& desc, const PresentCallback& presentCallback);
@@ -0,0 +1,107 @@
+/*
+ * DbgMemoryHeap.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "DbgMemoryHeap.h"
+#include "../DbgCore.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+DbgMemoryHeap::DbgMemoryHeap(MemoryHeap& instance, const MemoryHeapDescriptor& desc) :
+    MemoryHeap { desc.size            },
+    instance   { instance             },
+    desc       { desc                 },
+    label      { LLGL_DBG_LABEL(desc) }
+{
+}
+
+void DbgMemoryHeap::SetDebugName(const char* name)
+{
+    DbgSetObjectName(*this, name);
+}
+
+void DbgMemoryHeap::AddPlacement(const Resource* resource, std::uint64_t offset, std::uint64_t size)
+{
+    Placement newPlacement{ resource, offset, size, true };
+    for (const Placement& placement : placements_)
+    {
+        if (IsOverlapping(placement, newPlacement))
+        {
+            newPlacement.active = false;
+            break;
+        }
+    }
+    placements_.push_back(newPlacement);
+}
+
+void DbgMemoryHeap::RemovePlacement(const Resource* resource)
+{
+    placements_.erase(
+        std::remove_if(
+            placements_.begin(),
+            placements_.end(),
+            [resource](const Placement& placement) -> bool
+            {
+                return (placement.resource == resource);
+            }
+        ),
+        placements_.end()
+    );
+}
+
+void DbgMemoryHeap::ActivatePlacement(const Resource* resource)
+{
+    if (const Placement* activePlacement = FindPlacement(resource))
+    {
+        for (Placement& placement : placements_)
+            placement.active = (&placement == activePlacement || (placement.active && !IsOverlapping(placement, *activePlacement)));
+    }
+}
+
+const Resource* DbgMemoryHeap::FindActiveOverlappingPlacement(const Resource* resource) const
+{
+    const Placement* resourcePlacement = FindPlacement(resource);
+    if (resourcePlacement != nullptr && !resourcePlacement->active)
+    {
+        for (const Placement& placement : placements_)
+        {
+            if (placement.active && IsOverlapping(placement, *resourcePlacement))
+                return placement.resource;
+        }
+    }
+    return nullptr;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+const DbgMemoryHeap::Placement* DbgMemoryHeap::FindPlacement(const Resource* resource) const
+{
+    for (const Placement& placement : placements_)
+    {
+        if (placement.resource == resource)
+            return &placement;
+    }
+    return nullptr;
+}
+
+bool DbgMemoryHeap::IsOverlapping(const Placement& lhs, const Placement& rhs)
+{
+    return (lhs.offset < rhs.offset + rhs.size && rhs.offset < lhs.offset + lhs.size);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,90 @@
+/*
+ * DbgMemoryHeap.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_MEMORY_HEAP_H
+#define LLGL_DBG_MEMORY_HEAP_H
+
+
+#include <LLGL/MemoryHeap.h>
+#include <LLGL/MemoryHeapFlags.h>
+#include <string>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class Resource;
+
+class DbgMemoryHeap final : public MemoryHeap
+{
+
+    public:
+
+        void SetDebugName(const char* name) override;
+
+    public:
+
+        DbgMemoryHeap(MemoryHeap& instance, const MemoryHeapDescriptor& desc);
+
+        // Records the placement of the specified resource. The placement is only active if it doesn't overlap any other placement.
+        void AddPlacement(const Resource* resource, std::uint64_t offset, std::uint64_t size);
+
+        // Removes the placement of the specified resource.
+        void RemovePlacement(const Resource* resource);
+
+        // Activates the placement of the specified resource and deactivates all placements that overlap it (see CommandBuffer::AliasingBarrier).
+        void ActivatePlacement(const Resource* resource);
+
+        // Returns the active placed resource that overlaps the memory of the specified resource, or null if there is none.
+        const Resource* FindActiveOverlappingPlacement(const Resource* resource) const;
+
+        // Returns the number of resources that are currently placed inside this heap.
+        inline std::size_t GetNumPlacements() const
+        {
+            return placements_.size();
+        }
+
+    public:
+
+        MemoryHeap&                 instance;
+        const MemoryHeapDescriptor  desc;
+        std::string                 label;
+
+    private:
+
+        struct Placement
+        {
+            const Resource* resource;
+            std::uint64_t   offset;
+            std::uint64_t   size;
+            bool            active;
+        };
+
+    private:
+
+        const Placement* FindPlacement(const Resource* resource) const;
+
+        // Returns true if the memory ranges of the two placements intersect.
+        static bool IsOverlapping(const Placement& lhs, const Placement& rhs);
+
+    private:
+
+        std::vector<Placement> placements_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -39,7 +39,8 @@ class DbgResourceHeap final : public ResourceHeap
         ResourceHeap&                   instance;
         const ResourceHeapDescriptor    desc;
         std::string                     label;
-        const std::uint32_t             numBindings = 1;
+        const std::uint32_t             numBindings     = 1;
+        bool                            isUpdatePending = false;   // Set between RenderSystem::BeginResourceHeapUpdate and RenderSystem::CommitResourceHeapUpdate.
 
 };
 
@@ -37,6 +37,11 @@ bool DbgShader::Reflect(ShaderReflection& reflection) const
     return instance.Reflect(reflection);
 }
 
+Blob DbgShader::GetBinary() const
+{
+    return instance.GetBinary();
+}
+
 const char* DbgShader::GetVertexID() const
 {
     return (vertexID_.empty() ? nullptr : vertexID_.c_str());
@@ -29,6 +29,8 @@ class DbgShader final : public Shader
 
         void SetDebugName(const char* name) override;
 
+        Blob GetBinary() const override;
+
     public:
 
         DbgShader(Shader& instance, const ShaderDescriptor& desc);
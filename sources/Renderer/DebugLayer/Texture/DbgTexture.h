@@ -18,6 +18,8 @@ namespace LLGL
 {
 
 
+class DbgMemoryHeap;
+
 class DbgTexture final : public Texture
 {
 
@@ -43,6 +45,7 @@ class DbgTexture final : public Texture
         std::uint32_t           mipLevels           = 1;        // Actual number of MIP-map levels.
         std::string             label;
         const bool              isTextureView       = false;
+        DbgMemoryHeap*          memoryHeap          = nullptr;  // Memory heap this texture is placed in (only for placed textures).
 
     private:
 
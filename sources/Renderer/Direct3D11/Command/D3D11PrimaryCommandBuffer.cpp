@@ -815,6 +815,11 @@ void D3D11PrimaryCommandBuffer::ResourceBarrier(
     // dummy
 }
 
+void D3D11PrimaryCommandBuffer::AliasingBarrier(Resource* /*resourceBefore*/, Resource* /*resourceAfter*/)
+{
+    // dummy
+}
+
 /* ----- Render Passes ----- */
 
 void D3D11PrimaryCommandBuffer::BeginRenderPass(
@@ -235,6 +235,11 @@ void D3D11SecondaryCommandBuffer::ResourceBarrier(
     // dummy
 }
 
+void D3D11SecondaryCommandBuffer::AliasingBarrier(Resource* /*resourceBefore*/, Resource* /*resourceAfter*/)
+{
+    // dummy
+}
+
 /* ----- Render Passes ----- */
 
 void D3D11SecondaryCommandBuffer::BeginRenderPass(
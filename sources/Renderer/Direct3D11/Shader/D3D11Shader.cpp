@@ -47,6 +47,14 @@ bool D3D11Shader::Reflect(ShaderReflection& reflection) const
         return false;
 }
 
+Blob D3D11Shader::GetBinary() const
+{
+    if (byteCode_)
+        return Blob::CreateCopy(byteCode_->GetBufferPointer(), byteCode_->GetBufferSize());
+    else
+        return Blob{};
+}
+
 HRESULT D3D11Shader::ReflectAndCacheConstantBuffers(const std::vector<D3D11ConstantBufferReflection>** outConstantBuffers)
 {
     if (cbufferReflectionResult_ == S_FALSE)
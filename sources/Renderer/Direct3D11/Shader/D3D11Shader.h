@@ -49,6 +49,8 @@ class D3D11Shader : public Shader
 
         void SetDebugName(const char* name) override final;
 
+        Blob GetBinary() const override final;
+
     public:
 
         D3D11Shader(const ShaderType type);
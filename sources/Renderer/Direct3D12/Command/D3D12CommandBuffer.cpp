@@ -716,6 +716,11 @@ void D3D12CommandBuffer::ResourceBarrier(
     }
 }
 
+void D3D12CommandBuffer::AliasingBarrier(Resource* /*resourceBefore*/, Resource* /*resourceAfter*/)
+{
+    // dummy
+}
+
 /* ----- Render Passes ----- */
 
 void D3D12CommandBuffer::BeginRenderPass(
@@ -1583,6 +1588,11 @@ void D3D12CommandBuffer::SubmitTransitionResource(Resource& resource, D3D12_RESO
 
 } // /namespace LLGL
 
+#ifdef LLGL_STATIC_BACKEND_DIRECT3D12
+#define LLGL_STATIC_COMMAND_BUFFER D3D12CommandBuffer
+#include "../../StaticCommandBuffer.inl"
+#endif // /LLGL_STATIC_BACKEND_DIRECT3D12
+
 
 
 // ================================================================================
@@ -58,6 +58,14 @@ bool D3D12Shader::Reflect(ShaderReflection& reflection) const
         return false;
 }
 
+Blob D3D12Shader::GetBinary() const
+{
+    if (byteCode_)
+        return Blob::CreateCopy(byteCode_->GetBufferPointer(), byteCode_->GetBufferSize());
+    else
+        return Blob{};
+}
+
 D3D12_SHADER_BYTECODE D3D12Shader::GetByteCode() const
 {
     D3D12_SHADER_BYTECODE byteCode = {};
@@ -47,6 +47,10 @@ class D3D12Shader final : public Shader
 
         #include <LLGL/Backend/Shader.inl>
 
+    public:
+
+        Blob GetBinary() const override;
+
     public:
 
         D3D12Shader(D3D12RenderSystem& renderSystem, const ShaderDescriptor& desc);
@@ -0,0 +1,25 @@
+/*
+ * MemoryHeap.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/MemoryHeap.h>
+
+
+namespace LLGL
+{
+
+
+MemoryHeap::MemoryHeap(std::uint64_t size) :
+    size_ { size }
+{
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -500,6 +500,11 @@ void MTDirectCommandBuffer::ResourceBarrier(
     // dummy
 }
 
+void MTDirectCommandBuffer::AliasingBarrier(Resource* /*resourceBefore*/, Resource* /*resourceAfter*/)
+{
+    // dummy
+}
+
 /* ----- Render Passes ----- */
 
 void MTDirectCommandBuffer::BeginRenderPass(
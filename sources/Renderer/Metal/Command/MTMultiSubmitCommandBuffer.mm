@@ -465,6 +465,11 @@ void MTMultiSubmitCommandBuffer::ResourceBarrier(
     // dummy
 }
 
+void MTMultiSubmitCommandBuffer::AliasingBarrier(Resource* /*resourceBefore*/, Resource* /*resourceAfter*/)
+{
+    // dummy
+}
+
 /* ----- Render Passes ----- */
 
 void MTMultiSubmitCommandBuffer::BeginRenderPass(
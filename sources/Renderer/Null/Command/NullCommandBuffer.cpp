@@ -329,6 +329,11 @@ void NullCommandBuffer::ResourceBarrier(
     // dummy
 }
 
+void NullCommandBuffer::AliasingBarrier(Resource* /*resourceBefore*/, Resource* /*resourceAfter*/)
+{
+    // dummy
+}
+
 /* ----- Render Passes ----- */
 
 void NullCommandBuffer::BeginRenderPass(
@@ -667,6 +672,11 @@ void NullCommandBuffer::AllocDrawIndexedCommand(const DrawIndexedIndirectArgumen
 
 } // /namespace LLGL
 
+#ifdef LLGL_STATIC_BACKEND_NULL
+#define LLGL_STATIC_COMMAND_BUFFER NullCommandBuffer
+#include "../../StaticCommandBuffer.inl"
+#endif // /LLGL_STATIC_BACKEND_NULL
+
 
 
 // ================================================================================
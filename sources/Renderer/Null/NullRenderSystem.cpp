@@ -6,8 +6,10 @@
  */
 
 #include "NullRenderSystem.h"
+#include "../TextureUtils.h"
 #include "../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 #include <limits.h>
 
 
@@ -64,6 +66,8 @@ static void InitNullRendererFeatures(RenderingFeatures& features)
     features.hasLogicOp                     = true;
     features.hasPipelineStatistics          = true;
     features.hasRenderCondition             = true;
+    features.hasDescriptorIndexing          = true;
+    features.hasPlacedResources             = true;
 }
 
 static void InitNullRendererLimits(RenderingLimits& limits)
@@ -96,6 +100,7 @@ static void InitNullRendererLimits(RenderingLimits& limits)
     limits.maxDepthBufferSamples            = 1;
     limits.maxStencilBufferSamples          = 1;
     limits.maxNoAttachmentSamples           = 1;
+    limits.maxDescriptorIndexingArraySize   = (1u << 20);
 }
 
 static void GetNullRenderingCaps(RenderingCapabilities& caps)
@@ -167,6 +172,7 @@ BufferArray* NullRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffe
 
 void NullRenderSystem::Release(Buffer& buffer)
 {
+    RemovePlacement(&buffer);
     buffers_.erase(&buffer);
 }
 
@@ -214,6 +220,7 @@ Texture* NullRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, c
 
 void NullRenderSystem::Release(Texture& texture)
 {
+    RemovePlacement(&texture);
     textures_.erase(&texture);
 }
 
@@ -241,6 +248,80 @@ void NullRenderSystem::Release(Sampler& sampler)
     samplers_.erase(&sampler);
 }
 
+/* ----- Memory Heaps ----- */
+
+// Null backend emulates the alignment of common hardware, so placement errors are caught on any platform.
+static constexpr std::uint64_t g_nullBufferPlacementAlignment   = 256;
+static constexpr std::uint64_t g_nullTexturePlacementAlignment  = 64*1024;
+
+MemoryHeap* NullRenderSystem::CreateMemoryHeap(const MemoryHeapDescriptor& memoryHeapDesc)
+{
+    return memoryHeaps_.emplace<NullMemoryHeap>(memoryHeapDesc);
+}
+
+void NullRenderSystem::Release(MemoryHeap& memoryHeap)
+{
+    /* Placed resources must be released before their memory heap */
+    auto& memoryHeapNull = LLGL_CAST(NullMemoryHeap&, memoryHeap);
+    if (memoryHeapNull.GetNumPlacements() > 0)
+        return;
+    memoryHeaps_.erase(&memoryHeap);
+}
+
+bool NullRenderSystem::GetMemoryRequirements(const TextureDescriptor& textureDesc, MemoryRequirements& outRequirements)
+{
+    const std::uint64_t footprint = GetMemoryFootprint(textureDesc.format, NumMipTexels(textureDesc));
+    outRequirements.alignment   = g_nullTexturePlacementAlignment;
+    outRequirements.size        = GetAlignedSize(std::max<std::uint64_t>(footprint, 1), g_nullTexturePlacementAlignment);
+    return true;
+}
+
+bool NullRenderSystem::GetMemoryRequirements(const BufferDescriptor& bufferDesc, MemoryRequirements& outRequirements)
+{
+    outRequirements.alignment   = g_nullBufferPlacementAlignment;
+    outRequirements.size        = GetAlignedSize(std::max<std::uint64_t>(bufferDesc.size, 1), g_nullBufferPlacementAlignment);
+    return true;
+}
+
+Texture* NullRenderSystem::CreatePlacedTexture(MemoryHeap& memoryHeap, std::uint64_t offset, const TextureDescriptor& textureDesc)
+{
+    auto& memoryHeapNull = LLGL_CAST(NullMemoryHeap&, memoryHeap);
+
+    if ((memoryHeapNull.GetResources() & GetMemoryHeapResourceFlags(textureDesc)) == 0)
+        return nullptr;
+
+    MemoryRequirements requirements;
+    GetMemoryRequirements(textureDesc, requirements);
+    if (!memoryHeapNull.IsValidPlacement(offset, requirements))
+        return nullptr;
+
+    /* Placed textures have no initial data */
+    TextureDescriptor placedTextureDesc = textureDesc;
+    placedTextureDesc.miscFlags |= MiscFlags::NoInitialData;
+
+    NullTexture* textureNull = textures_.emplace<NullTexture>(placedTextureDesc);
+    memoryHeapNull.AddPlacement(textureNull, offset, requirements.size);
+    return textureNull;
+}
+
+Buffer* NullRenderSystem::CreatePlacedBuffer(MemoryHeap& memoryHeap, std::uint64_t offset, const BufferDescriptor& bufferDesc)
+{
+    auto& memoryHeapNull = LLGL_CAST(NullMemoryHeap&, memoryHeap);
+
+    /* Placed buffers reside in device local memory only */
+    if (bufferDesc.cpuAccessFlags != 0 || (memoryHeapNull.GetResources() & MemoryHeapResourceFlags::Buffers) == 0)
+        return nullptr;
+
+    MemoryRequirements requirements;
+    GetMemoryRequirements(bufferDesc, requirements);
+    if (!memoryHeapNull.IsValidPlacement(offset, requirements))
+        return nullptr;
+
+    NullBuffer* bufferNull = buffers_.emplace<NullBuffer>(bufferDesc, nullptr);
+    memoryHeapNull.AddPlacement(bufferNull, offset, requirements.size);
+    return bufferNull;
+}
+
 /* ----- Resource Views ----- */
 
 ResourceHeap* NullRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
@@ -259,6 +340,18 @@ std::uint32_t NullRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, st
     return resourceHeapNull.WriteResourceViews(firstDescriptor, resourceViews);
 }
 
+void NullRenderSystem::BeginResourceHeapUpdate(ResourceHeap& resourceHeap)
+{
+    auto& resourceHeapNull = LLGL_CAST(NullResourceHeap&, resourceHeap);
+    resourceHeapNull.BeginUpdate();
+}
+
+std::uint32_t NullRenderSystem::CommitResourceHeapUpdate(ResourceHeap& resourceHeap)
+{
+    auto& resourceHeapNull = LLGL_CAST(NullResourceHeap&, resourceHeap);
+    return resourceHeapNull.CommitUpdate();
+}
+
 /* ----- Render Passes ----- */
 
 RenderPass* NullRenderSystem::CreateRenderPass(const RenderPassDescriptor& renderPassDesc)
@@ -386,6 +479,15 @@ bool NullRenderSystem::QueryRendererDetails(RendererInfo* outInfo, RenderingCapa
     return true;
 }
 
+void NullRenderSystem::RemovePlacement(Resource* resource)
+{
+    for (const auto& memoryHeap : memoryHeaps_)
+    {
+        if (memoryHeap->RemovePlacement(resource))
+            break;
+    }
+}
+
 
 } // /namespace LLGL
 
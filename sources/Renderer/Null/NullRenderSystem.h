@@ -16,6 +16,7 @@
 #include "Buffer/NullBuffer.h"
 #include "Buffer/NullBufferArray.h"
 #include "RenderState/NullFence.h"
+#include "RenderState/NullMemoryHeap.h"
 #include "RenderState/NullPipelineLayout.h"
 #include "RenderState/NullPipelineState.h"
 #include "RenderState/NullQueryHeap.h"
@@ -41,6 +42,18 @@ class NullRenderSystem final : public RenderSystem
 
         #include <LLGL/Backend/RenderSystem.inl>
 
+    public:
+
+        void BeginResourceHeapUpdate(ResourceHeap& resourceHeap) override;
+        std::uint32_t CommitResourceHeapUpdate(ResourceHeap& resourceHeap) override;
+
+        MemoryHeap* CreateMemoryHeap(const MemoryHeapDescriptor& memoryHeapDesc) override;
+        void Release(MemoryHeap& memoryHeap) override;
+        bool GetMemoryRequirements(const TextureDescriptor& textureDesc, MemoryRequirements& outRequirements) override;
+        bool GetMemoryRequirements(const BufferDescriptor& bufferDesc, MemoryRequirements& outRequirements) override;
+        Texture* CreatePlacedTexture(MemoryHeap& memoryHeap, std::uint64_t offset, const TextureDescriptor& textureDesc) override;
+        Buffer* CreatePlacedBuffer(MemoryHeap& memoryHeap, std::uint64_t offset, const BufferDescriptor& bufferDesc) override;
+
     public:
 
         NullRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
@@ -49,6 +62,9 @@ class NullRenderSystem final : public RenderSystem
 
         #include <LLGL/Backend/RenderSystem.Internal.inl>
 
+        // Removes the placement of the specified resource from the memory heap it was placed in, if any.
+        void RemovePlacement(Resource* resource);
+
     private:
 
         /* ----- Common objects ----- */
@@ -71,6 +87,7 @@ class NullRenderSystem final : public RenderSystem
         HWObjectContainer<NullPipelineState>    pipelineStates_;
         HWObjectContainer<NullResourceHeap>     resourceHeaps_;
         HWObjectContainer<NullSampler>          samplers_;
+        HWObjectContainer<NullMemoryHeap>       memoryHeaps_;
         HWObjectContainer<NullQueryHeap>        queryHeaps_;
         HWObjectContainer<NullFence>            fences_;
 
@@ -0,0 +1,67 @@
+/*
+ * NullMemoryHeap.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "NullMemoryHeap.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+NullMemoryHeap::NullMemoryHeap(const MemoryHeapDescriptor& desc) :
+    MemoryHeap { desc.size      },
+    resources_ { desc.resources }
+{
+    if (desc.debugName != nullptr)
+        SetDebugName(desc.debugName);
+}
+
+void NullMemoryHeap::SetDebugName(const char* name)
+{
+    if (name != nullptr)
+        label_ = name;
+    else
+        label_.clear();
+}
+
+bool NullMemoryHeap::IsValidPlacement(std::uint64_t offset, const MemoryRequirements& requirements) const
+{
+    if (requirements.alignment == 0 || offset % requirements.alignment != 0)
+        return false;
+    return (offset <= GetSize() && requirements.size <= GetSize() - offset);
+}
+
+void NullMemoryHeap::AddPlacement(Resource* resource, std::uint64_t offset, std::uint64_t size)
+{
+    placements_.push_back(Placement{ resource, offset, size });
+}
+
+bool NullMemoryHeap::RemovePlacement(Resource* resource)
+{
+    auto it = std::find_if(
+        placements_.begin(),
+        placements_.end(),
+        [resource](const Placement& placement) -> bool
+        {
+            return (placement.resource == resource);
+        }
+    );
+    if (it != placements_.end())
+    {
+        placements_.erase(it);
+        return true;
+    }
+    return false;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,81 @@
+/*
+ * NullMemoryHeap.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_NULL_MEMORY_HEAP_H
+#define LLGL_NULL_MEMORY_HEAP_H
+
+
+#include <LLGL/MemoryHeap.h>
+#include <LLGL/MemoryHeapFlags.h>
+#include <vector>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+class Resource;
+
+class NullMemoryHeap final : public MemoryHeap
+{
+
+    public:
+
+        void SetDebugName(const char* name) override;
+
+    public:
+
+        NullMemoryHeap(const MemoryHeapDescriptor& desc);
+
+        // Returns true if a resource with the specified requirements fits into this heap at the specified offset.
+        bool IsValidPlacement(std::uint64_t offset, const MemoryRequirements& requirements) const;
+
+        // Records the placement of the specified resource.
+        void AddPlacement(Resource* resource, std::uint64_t offset, std::uint64_t size);
+
+        // Removes the placement of the specified resource. Returns true if the resource was placed inside this heap.
+        bool RemovePlacement(Resource* resource);
+
+        // Returns the number of resources that are currently placed inside this heap.
+        inline std::size_t GetNumPlacements() const
+        {
+            return placements_.size();
+        }
+
+        // Returns the resource kinds that can be placed inside this heap. See MemoryHeapResourceFlags.
+        inline long GetResources() const
+        {
+            return resources_;
+        }
+
+    private:
+
+        struct Placement
+        {
+            Resource*       resource;
+            std::uint64_t   offset;
+            std::uint64_t   size;
+        };
+
+    private:
+
+        long                    resources_  = 0;
+        std::string             label_;
+        std::vector<Placement>  placements_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -6,6 +6,7 @@
  */
 
 #include "NullPipelineLayout.h"
+#include "../../ResourceUtils.h"
 
 
 namespace LLGL
@@ -29,7 +30,8 @@ void NullPipelineLayout::SetDebugName(const char* name)
 
 std::uint32_t NullPipelineLayout::GetNumHeapBindings() const
 {
-    return static_cast<std::uint32_t>(desc.heapBindings.size());
+    /* Each array element of a heap binding occupies its own descriptor, including descriptor indexed bindings */
+    return GetNumExpandedHeapDescriptors(desc.heapBindings);
 }
 
 std::uint32_t NullPipelineLayout::GetNumBindings() const
@@ -20,7 +20,7 @@ namespace LLGL
 static std::uint32_t GetNumPipelineLayoutBindings(const PipelineLayout* pipelineLayout)
 {
     auto pipelineLayoutNull = LLGL_CAST(const NullPipelineLayout*, pipelineLayout);
-    return std::max(1u, static_cast<std::uint32_t>(pipelineLayoutNull->desc.heapBindings.size()));
+    return std::max(1u, pipelineLayoutNull->GetNumHeapBindings());
 }
 
 NullResourceHeap::NullResourceHeap(const ResourceHeapDescriptor& desc, const ArrayView<ResourceViewDescriptor>& initialResourceViews) :
@@ -40,20 +40,33 @@ NullResourceHeap::NullResourceHeap(const ResourceHeapDescriptor& desc, const Arr
 
 std::uint32_t NullResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews)
 {
-    /* Copy input resource views into resource heap via STL copy algorithm, since the descriptors are non-POD structs */
+    if (updateBatch_.IsActive())
+        return updateBatch_.Record(firstDescriptor, resourceViews, static_cast<std::uint32_t>(resourceViews_.size()));
+    else
+        return WriteResourceViewsImmediate(firstDescriptor, resourceViews);
+}
+
+void NullResourceHeap::BeginUpdate()
+{
+    updateBatch_.Begin();
+}
+
+std::uint32_t NullResourceHeap::CommitUpdate()
+{
+    std::vector<ResourceHeapUpdateBatch::Range> ranges;
+    std::vector<ResourceViewDescriptor> resourceViews;
+    updateBatch_.Resolve(ranges, resourceViews);
+
+    /* Write each contiguous range of resource views */
     std::uint32_t numWritten = 0;
-    if (resourceViews.size() + firstDescriptor < resourceViews_.size())
+    const ResourceViewDescriptor* resourceViewsPtr = resourceViews.data();
+
+    for (const ResourceHeapUpdateBatch::Range& range : ranges)
     {
-        for_range(i, resourceViews.size())
-        {
-            const auto& resourceView = resourceViews[i];
-            if (resourceView.resource != nullptr)
-            {
-                resourceViews_[firstDescriptor + i] = resourceView;
-                ++numWritten;
-            }
-        }
+        numWritten += WriteResourceViewsImmediate(range.firstDescriptor, ArrayView<ResourceViewDescriptor>{ resourceViewsPtr, range.numDescriptors });
+        resourceViewsPtr += range.numDescriptors;
     }
+
     return numWritten;
 }
 
@@ -71,6 +84,30 @@ std::uint32_t NullResourceHeap::GetNumDescriptorSets() const
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+std::uint32_t NullResourceHeap::WriteResourceViewsImmediate(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews)
+{
+    /* Copy input resource views into resource heap via STL copy algorithm, since the descriptors are non-POD structs */
+    std::uint32_t numWritten = 0;
+    if (resourceViews.size() + firstDescriptor <= resourceViews_.size())
+    {
+        for_range(i, resourceViews.size())
+        {
+            const auto& resourceView = resourceViews[i];
+            if (resourceView.resource != nullptr)
+            {
+                resourceViews_[firstDescriptor + i] = resourceView;
+                ++numWritten;
+            }
+        }
+    }
+    return numWritten;
+}
+
+
 } // /namespace LLGL
 
 
@@ -12,6 +12,7 @@
 #include <LLGL/ResourceHeap.h>
 #include <LLGL/ResourceHeapFlags.h>
 #include <LLGL/Container/ArrayView.h>
+#include "../../ResourceHeapUpdateBatch.h"
 #include <string>
 #include <vector>
 
@@ -35,11 +36,22 @@ class NullResourceHeap final : public ResourceHeap
 
         std::uint32_t WriteResourceViews(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews);
 
+        // Starts recording all writes into this resource heap until CommitUpdate is called.
+        void BeginUpdate();
+
+        // Writes all recorded resource views into this resource heap and returns the number of updated descriptors.
+        std::uint32_t CommitUpdate();
+
+    private:
+
+        std::uint32_t WriteResourceViewsImmediate(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews);
+
     private:
 
         std::string                         label_;
         const std::uint32_t                 numBindings_    = 1;
         std::vector<ResourceViewDescriptor> resourceViews_;
+        ResourceHeapUpdateBatch             updateBatch_;
 
 };
 
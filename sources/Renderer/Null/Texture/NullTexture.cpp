@@ -32,7 +32,9 @@ NullTexture::NullTexture(const TextureDescriptor& desc, const ImageView* initial
 
     if (initialImage != nullptr)
     {
-        Write(TextureRegion{ Offset3D{}, extent_ }, *initialImage);
+        /* Write initial image to all array layers of the first MIP-map */
+        const TextureSubresource subresource{ 0, desc.arrayLayers, 0, 1 };
+        Write(TextureRegion{ subresource, Offset3D{}, desc.extent }, *initialImage);
         if ((desc.miscFlags & MiscFlags::GenerateMips) != 0)
             GenerateMips();
     }
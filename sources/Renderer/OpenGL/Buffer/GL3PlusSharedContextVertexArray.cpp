@@ -43,7 +43,7 @@ void GL3PlusSharedContextVertexArray::Finalize()
 
 void GL3PlusSharedContextVertexArray::Bind(GLStateManager& stateMngr)
 {
-    stateMngr.BindVertexArray(GetVAOForCurrentContext().GetID());
+    GetVAOForCurrentContext().Bind(stateMngr, inputLayout_);
 }
 
 void GL3PlusSharedContextVertexArray::SetDebugName(const char* name)
@@ -65,45 +65,46 @@ void GL3PlusSharedContextVertexArray::SetDebugName(const char* name)
  * ======= Private: =======
  */
 
-GLVertexArrayObject& GL3PlusSharedContextVertexArray::GetVAOForCurrentContext()
+GLCachedVertexArray& GL3PlusSharedContextVertexArray::GetVAOForCurrentContext()
 {
     /* Check if there's already an entry for the current context */
-    const unsigned contextIndex = GLContext::GetCurrentGlobalIndex();
+    GLContext* context = GLContext::GetCurrent();
+    LLGL_ASSERT_PTR(context);
+
+    const unsigned contextIndex = context->GetGlobalIndex();
     LLGL_ASSERT(contextIndex > 0);
 
     const std::size_t vaoIndex = static_cast<std::size_t>(contextIndex) - 1;
     if (vaoIndex >= contextDependentVAOs_.size())
-    {
-        /* Resize container and fill new entry */
         contextDependentVAOs_.resize(vaoIndex + 1);
-        contextDependentVAOs_[vaoIndex].vao.BuildVertexLayout(inputLayout_);
-        if (!debugName_.empty())
-            contextDependentVAOs_[vaoIndex].SetObjectLabel(debugName_.c_str());
-    }
-    else if (contextDependentVAOs_[vaoIndex].vao.GetID() == 0)
+
+    GLContextVAO& contextVAO = contextDependentVAOs_[vaoIndex];
+    GLVertexArrayCache& vertexArrayCache = context->GetVertexArrayCache();
+    if (contextVAO.vertexArray == nullptr ||
+        contextVAO.inputLayoutHash != inputLayout_.GetHash() ||
+        contextVAO.cacheGeneration != vertexArrayCache.GetGeneration())
     {
-        /* Fill empty entry in container */
-        contextDependentVAOs_[vaoIndex].vao.BuildVertexLayout(inputLayout_);
-        if (!debugName_.empty())
-            contextDependentVAOs_[vaoIndex].SetObjectLabel(debugName_.c_str());
+        /*
+        Fetch VAO from cache of current context if there is no entry yet, the input layout has changed (i.e. hashes don't match anymore),
+        or the cache has removed any of its VAOs since the last fetch, in which case the previous pointer might refer to a deleted VAO
+        */
+        contextVAO.vertexArray          = vertexArrayCache.FindOrCreate(inputLayout_);
+        contextVAO.inputLayoutHash      = inputLayout_.GetHash();
+        contextVAO.cacheGeneration      = vertexArrayCache.GetGeneration();
+        contextVAO.isObjectLabelDirty   = true;
     }
-    else
+
+    if (contextVAO.isObjectLabelDirty)
     {
-        if (inputLayout_.GetHash() != contextDependentVAOs_[vaoIndex].vao.GetInputLayoutHash())
-        {
-            /* Update vertex attributes if the input layout has changed (i.e. hashes don't match anymore) */
-            contextDependentVAOs_[vaoIndex].vao.BuildVertexLayout(inputLayout_);
-        }
-        if (contextDependentVAOs_[vaoIndex].isObjectLabelDirty)
-        {
-            /* Udpate debug label if it has been invalidated */
-            if (!debugName_.empty())
-                contextDependentVAOs_[vaoIndex].SetObjectLabel(debugName_.c_str());
-        }
+        /* Udpate debug label if it has been invalidated; VAOs that are shared by vertex format don't get a label of an individual vertex array */
+        if (!debugName_.empty() && !contextVAO.vertexArray->HasVertexFormat())
+            contextVAO.SetObjectLabel(debugName_.c_str());
+        else
+            contextVAO.isObjectLabelDirty = false;
     }
 
     /* Return VAO for current context */
-    return contextDependentVAOs_[vaoIndex].vao;
+    return *contextVAO.vertexArray;
 }
 
 
@@ -114,7 +115,7 @@ GLVertexArrayObject& GL3PlusSharedContextVertexArray::GetVAOForCurrentContext()
 void GL3PlusSharedContextVertexArray::GLContextVAO::SetObjectLabel(const char* label)
 {
     /* Set label for VAO */
-    GLSetObjectLabel(GL_VERTEX_ARRAY, vao.GetID(), label);
+    GLSetObjectLabel(GL_VERTEX_ARRAY, vertexArray->GetVAO().GetID(), label);
     isObjectLabelDirty = false;
 }
 
@@ -14,7 +14,7 @@
 #include <LLGL/Container/SmallVector.h>
 #include <LLGL/Container/StringLiteral.h>
 #include "GLVertexInputLayout.h"
-#include "GLVertexArrayObject.h"
+#include "GLVertexArrayCache.h"
 #include <vector>
 
 
@@ -24,7 +24,10 @@ namespace LLGL
 
 class GLStateManager;
 
-// This class manages a vertex-array-object (VAO) across one or more GL contexts.
+/*
+This class manages a vertex-array-object (VAO) across one or more GL contexts.
+VAOs are not owned by this class but shared via the GLVertexArrayCache of each GL context.
+*/
 class GL3PlusSharedContextVertexArray
 {
 
@@ -50,16 +53,18 @@ class GL3PlusSharedContextVertexArray
 
         struct GLContextVAO
         {
-            GLVertexArrayObject vao;
-            bool                isObjectLabelDirty = false;
+            GLCachedVertexArray*    vertexArray         = nullptr;
+            std::size_t             inputLayoutHash     = 0;
+            std::uint64_t           cacheGeneration     = 0;    // Generation of the VAO cache when 'vertexArray' was fetched; the pointer is stale if it differs.
+            bool                    isObjectLabelDirty  = false;
 
             void SetObjectLabel(const char* label);
         };
 
     private:
 
-        // Returns the VAO for the current GL context and creates it on demand.
-        GLVertexArrayObject& GetVAOForCurrentContext();
+        // Returns the VAO for the current GL context and retrieves it from the context's VAO cache on demand.
+        GLCachedVertexArray& GetVAOForCurrentContext();
 
     private:
 
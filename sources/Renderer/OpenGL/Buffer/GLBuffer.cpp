@@ -6,14 +6,17 @@
  */
 
 #include "GLBuffer.h"
+#include "GLVertexArrayCache.h"
 #include "../Profile/GLProfile.h"
 #include "../GLObjectUtils.h"
 #include "../Ext/GLExtensions.h"
 #include "../GLTypes.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../../Core/MemoryAllocation.h"
 #include <LLGL/Backend/OpenGL/NativeHandle.h>
 #include <memory>
+#include <algorithm>
 
 
 namespace LLGL
@@ -64,6 +67,10 @@ GLBuffer::~GLBuffer()
     glDeleteBuffers(1, &id_);
     GLStateManager::Get().NotifyBufferRelease(*this);
 
+    /* Invalidate all VAOs that reference this buffer */
+    if ((GetBindFlags() & BindFlags::VertexBuffer) != 0)
+        GLVertexArrayCache::NotifyBufferRelease(id_);
+
     /* Delete texture if this was a texture-buffer and notify state manager */
     if (texID_ != 0)
         GLStateManager::Get().DeleteTexture(texID_, GLTextureTarget::TextureBuffer);
@@ -212,10 +219,12 @@ void GLBuffer::ClearBufferData(std::uint32_t data)
         glGetBufferParameteriv(bufferTarget, GL_BUFFER_SIZE, &bufferSize);
 
         /* Allocate intermediate buffer to fill the GPU buffer with */
-        std::vector<std::uint32_t> intermediateBuffer(static_cast<std::size_t>(bufferSize + 3) / 4, data);
+        const std::size_t numWords = static_cast<std::size_t>(bufferSize + 3) / 4;
+        TransientArray<std::uint32_t> intermediateBuffer{ numWords };
+        std::fill(intermediateBuffer.get(), intermediateBuffer.get() + numWords, data);
 
         /* Submit intermeidate buffer to GPU buffer */
-        glBufferSubData(bufferTarget, 0, static_cast<GLintptr>(bufferSize), intermediateBuffer.data());
+        glBufferSubData(bufferTarget, 0, static_cast<GLintptr>(bufferSize), intermediateBuffer.get());
     }
 }
 
@@ -243,10 +252,12 @@ void GLBuffer::ClearBufferSubData(GLintptr offset, GLsizeiptr size, std::uint32_
         GLStateManager::Get().BindGLBuffer(*this);
 
         /* Allocate intermediate buffer to fill the GPU buffer with */
-        std::vector<std::uint32_t> intermediateBuffer(static_cast<std::size_t>(size + 3) / 4, data);
+        const std::size_t numWords = static_cast<std::size_t>(size + 3) / 4;
+        TransientArray<std::uint32_t> intermediateBuffer{ numWords };
+        std::fill(intermediateBuffer.get(), intermediateBuffer.get() + numWords, data);
 
         /* Submit intermeidate buffer to GPU buffer */
-        glBufferSubData(GetGLTarget(), offset, size, intermediateBuffer.data());
+        glBufferSubData(GetGLTarget(), offset, size, intermediateBuffer.get());
     }
 }
 
@@ -272,7 +283,7 @@ void GLBuffer::CopyBufferSubData(const GLBuffer& readBuffer, GLintptr readOffset
     #endif // /GL_ARB_copy_buffer
     {
         /* Emulate buffer copy operation */
-        auto intermediateBuffer = MakeUniqueArray<char>(size);
+        TransientArray<char> intermediateBuffer{ static_cast<std::size_t>(size) };
 
         /* Read source buffer data */
         GLStateManager::Get().BindGLBuffer(readBuffer);
@@ -0,0 +1,233 @@
+/*
+ * GLVertexArrayCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLVertexArrayCache.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Platform/GLContext.h"
+#include "../../../Core/Assertion.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/MacroUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+static int CompareGLVertexAttribSWO(const GLVertexAttribute& lhs, const GLVertexAttribute& rhs)
+{
+    LLGL_COMPARE_MEMBER_SWO     ( buffer         );
+    LLGL_COMPARE_MEMBER_SWO     ( index          );
+    LLGL_COMPARE_MEMBER_SWO     ( size           );
+    LLGL_COMPARE_MEMBER_SWO     ( type           );
+    LLGL_COMPARE_MEMBER_SWO     ( normalized     );
+    LLGL_COMPARE_MEMBER_SWO     ( stride         );
+    LLGL_COMPARE_MEMBER_SWO     ( offsetPtrSized );
+    LLGL_COMPARE_MEMBER_SWO     ( divisor        );
+    LLGL_COMPARE_BOOL_MEMBER_SWO( isInteger      );
+    return 0;
+}
+
+
+/*
+ * GLCachedVertexArray class
+ */
+
+GLCachedVertexArray::GLCachedVertexArray(const GLVertexInputLayout& inputLayout, bool useVertexFormat) :
+    attribs_         { useVertexFormat ? inputLayout.GetFormatAttribs() : inputLayout.GetAttribs() },
+    hash_            { useVertexFormat ? inputLayout.GetFormatHash()    : inputLayout.GetHash()    },
+    hasVertexFormat_ { useVertexFormat                                                            }
+{
+    if (useVertexFormat)
+    {
+        /* Build vertex format only; vertex buffers are bound the first time this VAO is bound */
+        vao_.BuildVertexFormat(inputLayout);
+        boundBindings_.resize(inputLayout.GetBindings().size(), GLVertexBinding{ 0, 0, 0 });
+    }
+    else
+        vao_.BuildVertexLayout(inputLayout);
+}
+
+void GLCachedVertexArray::Bind(GLStateManager& stateMngr, const GLVertexInputLayout& inputLayout)
+{
+    stateMngr.BindVertexArray(vao_.GetID());
+
+    #if LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+
+    if (hasVertexFormat_)
+    {
+        /* Only re-bind vertex buffers that have changed since this VAO was bound the last time */
+        const std::vector<GLVertexBinding>& bindings = inputLayout.GetBindings();
+        LLGL_ASSERT(bindings.size() == boundBindings_.size());
+
+        for_range(i, bindings.size())
+        {
+            if (boundBindings_[i] != bindings[i])
+            {
+                glBindVertexBuffer(static_cast<GLuint>(i), bindings[i].buffer, bindings[i].offset, bindings[i].stride);
+                boundBindings_[i] = bindings[i];
+            }
+        }
+    }
+
+    #endif // /LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+}
+
+void GLCachedVertexArray::InvalidateBuffer(GLuint buffer)
+{
+    for (GLVertexBinding& binding : boundBindings_)
+    {
+        if (binding.buffer == buffer)
+            binding = GLVertexBinding{ 0, 0, 0 };
+    }
+}
+
+bool GLCachedVertexArray::ReferencesBuffer(GLuint buffer) const
+{
+    if (!hasVertexFormat_)
+    {
+        for (const GLVertexAttribute& attrib : attribs_)
+        {
+            if (attrib.buffer == buffer)
+                return true;
+        }
+    }
+    return false;
+}
+
+int GLCachedVertexArray::CompareSWO(const GLCachedVertexArray& lhs, const GLVertexInputLayout& rhs, bool useVertexFormat)
+{
+    LLGL_COMPARE_SEPARATE_BOOL_MEMBER_SWO(lhs.hasVertexFormat_, useVertexFormat);
+    LLGL_COMPARE_SEPARATE_MEMBERS_SWO(lhs.hash_, (useVertexFormat ? rhs.GetFormatHash() : rhs.GetHash()));
+
+    /* Compare attributes only if hashes are equal to resolve hash collisions */
+    const std::vector<GLVertexAttribute>& rhsAttribs = (useVertexFormat ? rhs.GetFormatAttribs() : rhs.GetAttribs());
+    LLGL_COMPARE_SEPARATE_MEMBERS_SWO(lhs.attribs_.size(), rhsAttribs.size());
+
+    for_range(i, rhsAttribs.size())
+        LLGL_COMPARE_SEPARATE_FUNC_SWO(CompareGLVertexAttribSWO, lhs.attribs_[i], rhsAttribs[i]);
+
+    return 0;
+}
+
+
+/*
+ * GLVertexArrayCache class
+ */
+
+// List of all VAO caches, one for each GL context.
+static std::vector<GLVertexArrayCache*> g_vertexArrayCaches;
+
+// Specifies whether VAOs are shared by vertex format; see RendererConfigurationOpenGL::shareVertexArraysByFormat.
+static bool g_vertexFormatSharing = false;
+
+GLVertexArrayCache::GLVertexArrayCache()
+{
+    g_vertexArrayCaches.push_back(this);
+}
+
+GLVertexArrayCache::~GLVertexArrayCache()
+{
+    /* VAOs are not released explicitly as they are destroyed together with their GL context */
+    RemoveFromList(g_vertexArrayCaches, this);
+}
+
+GLCachedVertexArray* GLVertexArrayCache::FindOrCreate(const GLVertexInputLayout& inputLayout)
+{
+    /* Release VAOs that have been invalidated while another GL context was current */
+    if (!pendingReleases_.empty())
+        ReleasePendingVertexArrays();
+
+    /* Share VAOs by vertex format only if vertex buffers can be bound independently */
+    bool useVertexFormat = false;
+
+    #if LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+    useVertexFormat = (g_vertexFormatSharing && HasExtension(GLExt::ARB_vertex_attrib_binding) && inputLayout.HasVertexFormat());
+    #endif
+
+    /* Try to find VAO with same input layout */
+    std::size_t insertionIndex = 0;
+    std::unique_ptr<GLCachedVertexArray>* entry = FindInSortedArray<std::unique_ptr<GLCachedVertexArray>>(
+        vertexArrays_.data(),
+        vertexArrays_.size(),
+        [&inputLayout, useVertexFormat](const std::unique_ptr<GLCachedVertexArray>& entry) -> int
+        {
+            return GLCachedVertexArray::CompareSWO(*entry, inputLayout, useVertexFormat);
+        },
+        &insertionIndex
+    );
+
+    if (entry != nullptr)
+        return entry->get();
+
+    /* Create new VAO with insertion sort */
+    auto it = vertexArrays_.insert(vertexArrays_.begin() + insertionIndex, MakeUnique<GLCachedVertexArray>(inputLayout, useVertexFormat));
+    return it->get();
+}
+
+void GLVertexArrayCache::NotifyBufferRelease(GLuint buffer)
+{
+    GLContext* currentContext = GLContext::GetCurrent();
+    for (GLVertexArrayCache* cache : g_vertexArrayCaches)
+    {
+        const bool isCurrentContext = (currentContext != nullptr && &(currentContext->GetVertexArrayCache()) == cache);
+        cache->ReleaseBufferReferences(buffer, isCurrentContext);
+    }
+}
+
+void GLVertexArrayCache::SetVertexFormatSharing(bool enabled)
+{
+    g_vertexFormatSharing = enabled;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLVertexArrayCache::ReleaseBufferReferences(GLuint buffer, bool isCurrentContext)
+{
+    for (auto it = vertexArrays_.begin(); it != vertexArrays_.end();)
+    {
+        GLCachedVertexArray& vertexArray = *(it->get());
+        if (vertexArray.HasVertexFormat())
+        {
+            /* Force vertex buffer to be re-bound as its ID might be reused */
+            vertexArray.InvalidateBuffer(buffer);
+            ++it;
+        }
+        else if (vertexArray.ReferencesBuffer(buffer))
+        {
+            /* Release VAO immediately if its GL context is current, otherwise defer release until the cache is used again */
+            if (isCurrentContext)
+                vertexArray.GetVAO().Release();
+            else
+                pendingReleases_.push_back(std::move(*it));
+            it = vertexArrays_.erase(it);
+            ++generation_;
+        }
+        else
+            ++it;
+    }
+}
+
+void GLVertexArrayCache::ReleasePendingVertexArrays()
+{
+    for (std::unique_ptr<GLCachedVertexArray>& vertexArray : pendingReleases_)
+        vertexArray->GetVAO().Release();
+    pendingReleases_.clear();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,135 @@
+/*
+ * GLVertexArrayCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_VERTEX_ARRAY_CACHE_H
+#define LLGL_GL_VERTEX_ARRAY_CACHE_H
+
+
+#include "GLVertexArrayObject.h"
+#include "GLVertexInputLayout.h"
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class GLStateManager;
+
+/*
+VAO that is shared between all vertex arrays with the same input layout within a single GL context.
+If GL_ARB_vertex_attrib_binding is supported, the VAO only stores the vertex format and vertex buffers are bound via glBindVertexBuffer.
+Otherwise, the vertex buffers are part of the VAO and it can only be shared between vertex arrays that reference the same buffers.
+*/
+class GLCachedVertexArray
+{
+
+    public:
+
+        GLCachedVertexArray(const GLVertexInputLayout& inputLayout, bool useVertexFormat);
+
+        // Binds this VAO and all vertex buffers of the specified input layout that are not already bound to this VAO.
+        void Bind(GLStateManager& stateMngr, const GLVertexInputLayout& inputLayout);
+
+        // Invalidates the vertex buffer bindings that refer to the specified GL buffer.
+        void InvalidateBuffer(GLuint buffer);
+
+        // Returns true if this VAO only stores the vertex format and can be shared between different vertex buffers.
+        inline bool HasVertexFormat() const
+        {
+            return hasVertexFormat_;
+        }
+
+        // Returns the input layout hash this VAO was created with.
+        inline std::size_t GetHash() const
+        {
+            return hash_;
+        }
+
+        // Returns the underlying GL vertex-array-object.
+        inline GLVertexArrayObject& GetVAO()
+        {
+            return vao_;
+        }
+
+        // Returns true if this VAO references the specified GL buffer in its attributes. Always false if this VAO only stores the vertex format.
+        bool ReferencesBuffer(GLuint buffer) const;
+
+    public:
+
+        // Compares the hash and attributes of the cached VAO with the specified input layout in a strict-weak-order (SWO).
+        static int CompareSWO(const GLCachedVertexArray& lhs, const GLVertexInputLayout& rhs, bool useVertexFormat);
+
+    private:
+
+        GLVertexArrayObject             vao_;
+        std::vector<GLVertexAttribute>  attribs_;
+        std::size_t                     hash_               = 0;
+        bool                            hasVertexFormat_    = false;
+        std::vector<GLVertexBinding>    boundBindings_;     // Vertex buffer bindings currently stored in the VAO; only used with vertex format.
+
+};
+
+// Per GL context cache of VAOs, so that vertex arrays with the same input layout share a single VAO.
+class GLVertexArrayCache
+{
+
+    public:
+
+        GLVertexArrayCache();
+        ~GLVertexArrayCache();
+
+        GLVertexArrayCache(const GLVertexArrayCache&) = delete;
+        GLVertexArrayCache& operator = (const GLVertexArrayCache&) = delete;
+
+        // Returns the VAO for the specified input layout and creates it on demand.
+        GLCachedVertexArray* FindOrCreate(const GLVertexInputLayout& inputLayout);
+
+        // Returns the number of VAOs in this cache.
+        inline std::size_t GetNumVertexArrays() const
+        {
+            return vertexArrays_.size();
+        }
+
+        // Returns the generation of this cache. This is incremented every time a VAO is removed from the cache, which invalidates all pointers returned by FindOrCreate().
+        inline std::uint64_t GetGeneration() const
+        {
+            return generation_;
+        }
+
+    public:
+
+        // Notifies all VAO caches of all GL contexts that the specified GL buffer has been deleted.
+        static void NotifyBufferRelease(GLuint buffer);
+
+        // Specifies whether VAOs are shared by vertex format only if GL_ARB_vertex_attrib_binding is supported. By default false.
+        static void SetVertexFormatSharing(bool enabled);
+
+    private:
+
+        void ReleaseBufferReferences(GLuint buffer, bool isCurrentContext);
+        void ReleasePendingVertexArrays();
+
+    private:
+
+        std::vector<std::unique_ptr<GLCachedVertexArray>>   vertexArrays_;
+        std::vector<std::unique_ptr<GLCachedVertexArray>>   pendingReleases_;   // VAOs to release the next time this cache is used with its GL context.
+        std::uint64_t                                       generation_         = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -12,6 +12,7 @@
 #include "../RenderState/GLStateManager.h"
 #include "../GLTypes.h"
 #include "../GLCore.h"
+#include "../../../Core/Assertion.h"
 #include "../../../Core/Exception.h"
 #include <LLGL/Utils/TypeNames.h>
 #include <algorithm>
@@ -83,6 +84,43 @@ void GLVertexArrayObject::BuildVertexLayout(const GLVertexInputLayout& inputLayo
 }
 
 
+void GLVertexArrayObject::BuildVertexFormat(const GLVertexInputLayout& inputLayout)
+{
+    #if LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+
+    LLGL_ASSERT_GL_EXT(ARB_vertex_attrib_binding);
+    LLGL_ASSERT(id_ == 0, "vertex format of VAO cannot be changed");
+
+    glGenVertexArrays(1, &id_);
+
+    GLStateManager::Get().BindVertexArray(id_);
+    {
+        for (const GLVertexAttribute& attrib : inputLayout.GetFormatAttribs())
+        {
+            glEnableVertexAttribArray(attrib.index);
+            glVertexAttribBinding(attrib.index, attrib.buffer);
+            glVertexBindingDivisor(attrib.buffer, attrib.divisor);
+
+            if (attrib.isInteger)
+                glVertexAttribIFormat(attrib.index, attrib.size, attrib.type, static_cast<GLuint>(attrib.offsetPtrSized));
+            else
+                glVertexAttribFormat(attrib.index, attrib.size, attrib.type, attrib.normalized, static_cast<GLuint>(attrib.offsetPtrSized));
+
+            attribIndexEnd_ = std::max<GLuint>(attribIndexEnd_, attrib.index);
+        }
+    }
+    GLStateManager::Get().BindVertexArray(0);
+
+    inputLayoutHash_ = inputLayout.GetFormatHash();
+
+    #else // LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+
+    LLGL_TRAP_FEATURE_NOT_SUPPORTED("GL_ARB_vertex_attrib_binding");
+
+    #endif // /LLGL_GLEXT_VERTEX_ATTRIB_BINDING
+}
+
+
 /*
  * ======= Private: =======
  */
@@ -33,6 +33,9 @@ class GLVertexArrayObject
         // Builds the specified attribute using a 'glVertexAttrib*Pointer' function.
         void BuildVertexLayout(const GLVertexInputLayout& inputLayout);
 
+        // Builds the format attributes of the specified input layout using 'glVertexAttrib*Format' functions. Vertex buffers must be bound separately.
+        void BuildVertexFormat(const GLVertexInputLayout& inputLayout);
+
         // Returns the ID of the hardware vertex-array-object (VAO)
         inline GLuint GetID() const
         {
@@ -7,16 +7,35 @@
 
 #include "GLVertexInputLayout.h"
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
+// Minimum value for GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET that is guaranteed by the GL specification.
+static constexpr GLsizeiptr g_minMaxVertexAttribRelativeOffset = 2047;
+
+bool operator == (const GLVertexBinding& lhs, const GLVertexBinding& rhs)
+{
+    return (lhs.buffer == rhs.buffer && lhs.offset == rhs.offset && lhs.stride == rhs.stride);
+}
+
+bool operator != (const GLVertexBinding& lhs, const GLVertexBinding& rhs)
+{
+    return !(lhs == rhs);
+}
+
+
 void GLVertexInputLayout::Reset()
 {
     attribs_.clear();
     attribsHash_.Reset();
+    formatAttribs_.clear();
+    formatAttribsHash_.Reset();
+    bindings_.clear();
+    hasVertexFormat_ = false;
 }
 
 void GLVertexInputLayout::Append(const ArrayView<GLVertexAttribute>& attributes)
@@ -38,6 +57,59 @@ void GLVertexInputLayout::Finalize()
 {
     /* Update vertex attributes hash */
     attribsHash_.Update(attribs_);
+
+    /* Separate vertex format from buffer bindings */
+    BuildVertexFormat();
+    formatAttribsHash_.Update(formatAttribs_);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLVertexInputLayout::BuildVertexFormat()
+{
+    formatAttribs_ = attribs_;
+    bindings_.clear();
+    hasVertexFormat_ = true;
+
+    /* Assign one binding to each unique combination of buffer, stride, and instance divisor */
+    std::vector<GLuint> bindingDivisors;
+
+    for (GLVertexAttribute& attrib : formatAttribs_)
+    {
+        GLuint bindingIndex = 0;
+        for (; bindingIndex < bindings_.size(); ++bindingIndex)
+        {
+            const GLVertexBinding& binding = bindings_[bindingIndex];
+            if (binding.buffer == attrib.buffer && binding.stride == attrib.stride && bindingDivisors[bindingIndex] == attrib.divisor)
+                break;
+        }
+
+        if (bindingIndex == bindings_.size())
+        {
+            bindings_.push_back(GLVertexBinding{ attrib.buffer, static_cast<GLintptr>(attrib.offsetPtrSized), attrib.stride });
+            bindingDivisors.push_back(attrib.divisor);
+        }
+        else
+        {
+            /* Binding offset is the lowest offset of all its attributes */
+            GLVertexBinding& binding = bindings_[bindingIndex];
+            binding.offset = std::min(binding.offset, static_cast<GLintptr>(attrib.offsetPtrSized));
+        }
+
+        attrib.buffer = bindingIndex;
+    }
+
+    /* Convert attribute offsets to be relative to their binding; strides are part of the binding, not the format */
+    for (GLVertexAttribute& attrib : formatAttribs_)
+    {
+        attrib.offsetPtrSized   -= static_cast<GLsizeiptr>(bindings_[attrib.buffer].offset);
+        attrib.stride           = 0;
+        if (attrib.offsetPtrSized > g_minMaxVertexAttribRelativeOffset)
+            hasVertexFormat_ = false;
+    }
 }
 
 
@@ -18,6 +18,17 @@ namespace LLGL
 {
 
 
+// Vertex buffer binding for use with glBindVertexBuffer().
+struct GLVertexBinding
+{
+    GLuint      buffer;
+    GLintptr    offset;
+    GLsizei     stride;
+};
+
+bool operator == (const GLVertexBinding& lhs, const GLVertexBinding& rhs);
+bool operator != (const GLVertexBinding& lhs, const GLVertexBinding& rhs);
+
 // Helpers class to manage the vertex shader input layout.
 class GLVertexInputLayout
 {
@@ -33,7 +44,7 @@ class GLVertexInputLayout
         void Append(const ArrayView<GLVertexAttribute>& attributes);
         void Append(GLuint bufferID, const ArrayView<VertexAttribute>& attributes);
 
-        // Finalizes the input layout by updating the hash.
+        // Finalizes the input layout by updating the hashes and vertex bindings.
         void Finalize();
 
         // Returns the array of input vertex attributes this shader was created with. This is a direct copy of the input attributes.
@@ -48,11 +59,47 @@ class GLVertexInputLayout
             return attribsHash_.Get();
         }
 
+        /*
+        Returns the vertex attributes without buffer specific information for GL_ARB_vertex_attrib_binding.
+        The 'buffer' field denotes the binding index, 'offsetPtrSized' the relative offset, and 'stride' is zero.
+        */
+        inline const std::vector<GLVertexAttribute>& GetFormatAttribs() const
+        {
+            return formatAttribs_;
+        }
+
+        // Returns the hash over all format attributes. Layouts with the same format hash can share a VAO when GL_ARB_vertex_attrib_binding is supported.
+        inline std::size_t GetFormatHash() const
+        {
+            return formatAttribsHash_.Get();
+        }
+
+        // Returns the vertex buffer bindings that belong to the format attributes.
+        inline const std::vector<GLVertexBinding>& GetBindings() const
+        {
+            return bindings_;
+        }
+
+        // Returns true if all relative offsets of the format attributes are within the minimum limit of GL_MAX_VERTEX_ATTRIB_RELATIVE_OFFSET.
+        inline bool HasVertexFormat() const
+        {
+            return hasVertexFormat_;
+        }
+
+    private:
+
+        void BuildVertexFormat();
+
     private:
 
         std::vector<GLVertexAttribute>  attribs_;
         GLVertexArrayHash               attribsHash_;
 
+        std::vector<GLVertexAttribute>  formatAttribs_;
+        GLVertexArrayHash               formatAttribsHash_;
+        std::vector<GLVertexBinding>    bindings_;
+        bool                            hasVertexFormat_    = false;
+
 };
 
 
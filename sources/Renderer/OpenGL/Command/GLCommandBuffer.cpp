@@ -45,6 +45,9 @@ void GLCommandBuffer::SetIndexFormat(bool indexType16Bits, std::uint64_t offset)
 
 void GLCommandBuffer::SetPipelineRenderState(const GLPipelineState& pipelineStateGL)
 {
+    /* Finalize PSO before its uniform and buffer interface maps are accessed while recording */
+    pipelineStateGL.FinalizeLink();
+
     /* Store pipeline state and layout */
     renderState_.boundPipelineLayout    = pipelineStateGL.GetPipelineLayout();
     renderState_.boundPipelineState     = &pipelineStateGL;
@@ -14,6 +14,7 @@
 #include "../GLCore.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
+#include "../Ext/GLProcProfiler.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Assertion.h"
 
@@ -48,6 +49,14 @@ namespace LLGL
 
 static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLStateManager*& stateMngr)
 {
+    #ifdef LLGL_GL_ENABLE_PROC_PROFILER
+    GLProcProfiler::SetCommand(opcode);
+    #endif
+
+    /* Flush deferred resource bindings before each draw and compute command, which are enumerated contiguously from DrawArrays to DispatchComputeIndirect */
+    if (opcode >= GLOpcodeDrawArrays && opcode <= GLOpcodeDispatchComputeIndirect)
+        stateMngr->FlushDeferredBindings();
+
     switch (opcode)
     {
         case GLOpcodeBufferSubData:
@@ -533,6 +542,11 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
 static void ExecuteGLCommandsEmulated(const GLVirtualCommandBuffer& virtualCmdBuffer, GLStateManager* stateMngr)
 {
     virtualCmdBuffer.Run(ExecuteGLCommand, stateMngr);
+
+    #ifdef LLGL_GL_ENABLE_PROC_PROFILER
+    /* Attribute all subsequent GL calls to no command until the next command buffer is executed */
+    GLProcProfiler::SetCommand(static_cast<GLOpcode>(0));
+    #endif
 }
 
 void ExecuteGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdBuffer, GLStateManager& stateMngr)
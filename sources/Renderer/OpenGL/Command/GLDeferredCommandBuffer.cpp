@@ -571,6 +571,11 @@ void GLDeferredCommandBuffer::ResourceBarrier(
     #endif
 }
 
+void GLDeferredCommandBuffer::AliasingBarrier(Resource* /*resourceBefore*/, Resource* /*resourceAfter*/)
+{
+    // dummy
+}
+
 /* ----- Render Passes ----- */
 
 void GLDeferredCommandBuffer::BeginRenderPass(
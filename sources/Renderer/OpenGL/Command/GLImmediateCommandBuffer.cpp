@@ -385,6 +385,11 @@ void GLImmediateCommandBuffer::ResourceBarrier(
     #endif
 }
 
+void GLImmediateCommandBuffer::AliasingBarrier(Resource* /*resourceBefore*/, Resource* /*resourceAfter*/)
+{
+    // dummy
+}
+
 // private
 void GLImmediateCommandBuffer::BindResource(GLResourceType type, GLuint slot, std::uint32_t descriptor, Resource& resource)
 {
@@ -715,16 +720,19 @@ In the following Draw* functions, 'indices' is from type <GLintptr> to have the
 The indices actually store the index start offset, but must be passed to GL as a void-pointer, due to an obsolete API.
 */
 
+// Flushes deferred resource bindings and pending memory barriers before each draw and compute command
 #if LLGL_GLEXT_MEMORY_BARRIERS
-#   define LLGL_FLUSH_MEMORY_BARRIERS() \
+#   define LLGL_FLUSH_PENDING_STATE()                                                       \
+        stateMngr_->FlushDeferredBindings();                                                \
         if (GLbitfield barriers = FlushAndGetMemoryBarriers()) { glMemoryBarrier(barriers); }
 #else
-#   define LLGL_FLUSH_MEMORY_BARRIERS()
+#   define LLGL_FLUSH_PENDING_STATE() \
+        stateMngr_->FlushDeferredBindings()
 #endif // /LLGL_GLEXT_MEMORY_BARRIERS
 
 void GLImmediateCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATE();
     glDrawArrays(
         GetDrawMode(),
         static_cast<GLint>(firstVertex),
@@ -734,7 +742,7 @@ void GLImmediateCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t fir
 
 void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATE();
     glDrawElements(
         GetDrawMode(),
         static_cast<GLsizei>(numIndices),
@@ -746,7 +754,7 @@ void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32
 void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
     #if LLGL_GLEXT_DRAW_ELEMENTS_BASE_VERTEX
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATE();
     glDrawElementsBaseVertex(
         GetDrawMode(),
         static_cast<GLsizei>(numIndices),
@@ -760,7 +768,7 @@ void GLImmediateCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32
 void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
 {
     #if LLGL_GLEXT_DRAW_INSTANCED
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATE();
     glDrawArraysInstanced(
         GetDrawMode(),
         static_cast<GLint>(firstVertex),
@@ -773,7 +781,7 @@ void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uin
 void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
     #if LLGL_GLEXT_BASE_INSTANCE
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATE();
     glDrawArraysInstancedBaseInstance(
         GetDrawMode(),
         static_cast<GLint>(firstVertex),
@@ -787,7 +795,7 @@ void GLImmediateCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uin
 void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
     #if LLGL_GLEXT_DRAW_INSTANCED
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATE();
     glDrawElementsInstanced(
         GetDrawMode(),
         static_cast<GLsizei>(numIndices),
@@ -801,7 +809,7 @@ void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, st
 void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
     #if LLGL_GLEXT_DRAW_ELEMENTS_BASE_VERTEX
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATE();
     glDrawElementsInstancedBaseVertex(
         GetDrawMode(),
         static_cast<GLsizei>(numIndices),
@@ -816,7 +824,7 @@ void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, st
 void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
     #if LLGL_GLEXT_BASE_INSTANCE
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATE();
     glDrawElementsInstancedBaseVertexBaseInstance(
         GetDrawMode(),
         static_cast<GLsizei>(numIndices),
@@ -832,7 +840,7 @@ void GLImmediateCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, st
 void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
     #if LLGL_GLEXT_DRAW_INDIRECT
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATE();
 
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, bufferGL.GetID());
@@ -848,7 +856,7 @@ void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset
 void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
     #if LLGL_GLEXT_DRAW_INDIRECT
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATE();
 
     /* Bind indirect argument buffer */
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
@@ -885,7 +893,7 @@ void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset
 void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
     #if LLGL_GLEXT_DRAW_INDIRECT
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATE();
 
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, bufferGL.GetID());
@@ -902,7 +910,7 @@ void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
 void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
     #if LLGL_GLEXT_DRAW_INDIRECT
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATE();
 
     /* Bind indirect argument buffer */
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
@@ -942,7 +950,7 @@ void GLImmediateCommandBuffer::DrawStreamOutput()
 {
     if (GLBufferWithXFB* bufferWithXfbGL = GetRenderState().boundBufferWithFxb)
     {
-        LLGL_FLUSH_MEMORY_BARRIERS();
+        LLGL_FLUSH_PENDING_STATE();
         #if LLGL_GLEXT_TRNASFORM_FEEDBACK2
         if (HasExtension(GLExt::ARB_transform_feedback2))
         {
@@ -963,7 +971,7 @@ void GLImmediateCommandBuffer::DrawStreamOutput()
 void GLImmediateCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
     #if LLGL_GLEXT_COMPUTE_SHADER
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATE();
     glDispatchCompute(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
     #endif
 }
@@ -971,7 +979,7 @@ void GLImmediateCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint3
 void GLImmediateCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
     #if LLGL_GLEXT_COMPUTE_SHADER
-    LLGL_FLUSH_MEMORY_BARRIERS();
+    LLGL_FLUSH_PENDING_STATE();
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DispatchIndirectBuffer, bufferGL.GetID());
     glDispatchComputeIndirect(static_cast<GLintptr>(offset));
@@ -1026,7 +1034,7 @@ bool GLImmediateCommandBuffer::IsImmediateCmdBuffer() const
 }
 
 
-#undef LLGL_FLUSH_MEMORY_BARRIERS
+#undef LLGL_FLUSH_PENDING_STATE
 
 
 } // /namespace LLGL
@@ -83,6 +83,7 @@ enum class GLExt
     ARB_transform_feedback3,
     ARB_uniform_buffer_object,
     ARB_vertex_array_object,
+    ARB_vertex_attrib_binding,          // GL 4.3
     ARB_vertex_buffer_object,
     ARB_vertex_shader,
     ARB_viewport_array,
@@ -94,6 +95,7 @@ enum class GLExt
 
     /* Khronos group extensions (KHR) */
     KHR_debug,
+    KHR_parallel_shader_compile,
 
     /* Multi-vendor extensions (EXT) */
     EXT_blend_color,
@@ -0,0 +1,167 @@
+/*
+ * GLProcProfiler.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+// This file defines the redirected GL procedures, so it must refer to the original ones
+#define LLGL_GL_DISABLE_STATIC_PROC_REDIRECTION
+
+#include "GLProcProfiler.h"
+
+#ifdef LLGL_GL_ENABLE_PROC_PROFILER
+
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Command names for all GL opcodes; the invalid opcode 0 denotes GL calls outside of deferred command buffers.
+static const char* const g_glOpcodeNames[] =
+{
+    "",
+    "BufferSubData",
+    "CopyBufferSubData",
+    "ClearBufferData",
+    "ClearBufferSubData",
+    "CopyImageSubData",
+    "CopyImageToBuffer",
+    "CopyImageFromBuffer",
+    "CopyFramebufferSubData",
+    "GenerateMipmap",
+    "GenerateMipmapSubresource",
+    "Execute",
+    "Viewport",
+    "ViewportArray",
+    "Scissor",
+    "ScissorArray",
+    "ClearColor",
+    "ClearDepth",
+    "ClearStencil",
+    "Clear",
+    "ClearAttachmentsWithRenderPass",
+    "ClearBuffers",
+    "ResolveRenderTarget",
+    "BindVertexArray",
+    "BuildVertexArray",
+    "BindElementArrayBufferToVAO",
+    "BindBufferBase",
+    "BindBuffersBase",
+    "BeginBufferXfb",
+    "EndBufferXfb",
+    "BeginTransformFeedback",
+    "BeginTransformFeedbackNV",
+    "EndTransformFeedback",
+    "EndTransformFeedbackNV",
+    "BindResourceHeap",
+    "BindRenderTarget",
+    "BindPipelineState",
+    "SetBlendColor",
+    "SetStencilRef",
+    "SetUniform",
+    "BeginQuery",
+    "EndQuery",
+    "BeginConditionalRender",
+    "EndConditionalRender",
+    "DrawArrays",
+    "DrawArraysInstanced",
+    "DrawArraysInstancedBaseInstance",
+    "DrawArraysIndirect",
+    "DrawElements",
+    "DrawElementsBaseVertex",
+    "DrawElementsInstanced",
+    "DrawElementsInstancedBaseVertex",
+    "DrawElementsInstancedBaseVertexBaseInstance",
+    "DrawElementsIndirect",
+    "DrawTransformFeedback",
+    "DrawEmulatedTransformFeedback",
+    "MultiDrawArraysIndirect",
+    "MultiDrawElementsIndirect",
+    "DispatchCompute",
+    "DispatchComputeIndirect",
+    "BindTexture",
+    "BindTextureNative",
+    "BindImageTexture",
+    "BindSampler",
+    "BindEmulatedSampler",
+    "MemoryBarrier",
+    "PushDebugGroup",
+    "PopDebugGroup",
+};
+
+static_assert(
+    sizeof(g_glOpcodeNames)/sizeof(g_glOpcodeNames[0]) == g_numGLProcProfilerOpcodes,
+    "number of GL opcode names does not match number of GL opcodes"
+);
+
+#if LLGL_OPENGL && !defined __APPLE__
+
+/* ~~~~~ Define profiling thunks for all statically linked GL procedures ~~~~~ */
+
+#define DECL_GLSTATICPROC(NAME)                                                                 \
+    decltype(&::NAME)   StaticProc_##NAME           = ::NAME;                                   \
+    GLProcCounter       StaticProcCounter_##NAME    = { #NAME, false, {}, {} };                 \
+    decltype(&::NAME)   ProfiledStaticProc_##NAME   =                                           \
+        GLProcThunk<decltype(&::NAME)>::Invoke<&StaticProc_##NAME, &StaticProcCounter_##NAME>
+
+#include "GLStaticProcsDecl.inl"
+
+#undef DECL_GLSTATICPROC
+
+#endif // /LLGL_OPENGL && !__APPLE__
+
+GLOpcode                    GLProcProfiler::command_ = static_cast<GLOpcode>(0);
+std::vector<GLProcCounter*> GLProcProfiler::activeCounters_;
+
+void GLProcProfiler::FlushProfile(DynamicVector<ProfileNativeCallRecord>& outRecords)
+{
+    const double ticksToNanosecs = 1.0e9 / static_cast<double>(Timer::Frequency());
+
+    for (GLProcCounter* counter : activeCounters_)
+    {
+        for (std::size_t opcode = 0; opcode < g_numGLProcProfilerOpcodes; ++opcode)
+        {
+            if (counter->calls[opcode] == 0)
+                continue;
+
+            ProfileNativeCallRecord record;
+            {
+                record.function     = counter->name;
+                record.command      = g_glOpcodeNames[opcode];
+                record.calls        = counter->calls[opcode];
+                record.elapsedTime  = static_cast<std::uint64_t>(static_cast<double>(counter->ticks[opcode]) * ticksToNanosecs);
+            }
+            outRecords.push_back(record);
+        }
+
+        /* Reset counter, so it's only activated again when it's called in the next frame */
+        counter->isActive = false;
+        ::memset(counter->calls, 0, sizeof(counter->calls));
+        ::memset(counter->ticks, 0, sizeof(counter->ticks));
+    }
+    activeCounters_.clear();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLProcProfiler::ActivateCounter(GLProcCounter& counter)
+{
+    counter.isActive = true;
+    activeCounters_.push_back(&counter);
+}
+
+
+} // /namespace LLGL
+
+
+#endif // /LLGL_GL_ENABLE_PROC_PROFILER
+
+
+
+// ================================================================================
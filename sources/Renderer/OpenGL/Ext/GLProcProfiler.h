@@ -0,0 +1,124 @@
+/*
+ * GLProcProfiler.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_PROC_PROFILER_H
+#define LLGL_GL_PROC_PROFILER_H
+
+
+#ifdef LLGL_GL_ENABLE_PROC_PROFILER
+
+#include "../OpenGL.h"
+#include "../Command/GLCommandOpcode.h"
+#include <LLGL/RenderingDebuggerFlags.h>
+#include <LLGL/Container/DynamicVector.h>
+#include <LLGL/Timer.h>
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// Number of GL opcodes including the invalid opcode 0, which is used for all GL calls outside of deferred command buffers.
+static constexpr std::size_t g_numGLProcProfilerOpcodes = GLOpcodePopDebugGroup + 1;
+
+// Call counters of a single GL procedure. Instances are declared for each entry in the GL extension declaration files.
+struct GLProcCounter
+{
+    const char*     name;
+    bool            isActive;
+    std::uint32_t   calls[g_numGLProcProfilerOpcodes];
+    std::uint64_t   ticks[g_numGLProcProfilerOpcodes];
+};
+
+/*
+Aggregates the calls of all loaded GL procedures per frame.
+GL 1.0 and 1.1 procedures that are linked statically on Windows and Linux are redirected to profiling thunks as well (see GLStaticProcProfiler.h).
+Statically linked procedures of GLES are not recorded.
+*/
+class GLProcProfiler
+{
+
+    public:
+
+        // Sets the opcode of the command that is currently executed from a deferred command buffer. GLOpcode 0 is used outside of command execution.
+        static inline void SetCommand(GLOpcode opcode)
+        {
+            command_ = opcode;
+        }
+
+        // Records a single call of the specified GL procedure.
+        static inline void RecordCall(GLProcCounter& counter, std::uint64_t ticks)
+        {
+            if (!counter.isActive)
+                ActivateCounter(counter);
+            counter.calls[command_]++;
+            counter.ticks[command_] += ticks;
+        }
+
+        // Appends one record for each pair of GL procedure and command that have been recorded since the last flush and resets all counters.
+        static void FlushProfile(DynamicVector<ProfileNativeCallRecord>& outRecords);
+
+    private:
+
+        static void ActivateCounter(GLProcCounter& counter);
+
+    private:
+
+        static GLOpcode                     command_;
+        static std::vector<GLProcCounter*>  activeCounters_;
+
+};
+
+// Thunk that is installed in place of a loaded GL procedure to record the number and CPU time of its calls.
+template <typename TProc>
+struct GLProcThunk;
+
+template <typename TRet, typename... TArgs>
+struct GLProcThunk<TRet (APIENTRY*)(TArgs...)>
+{
+    using ProcType = TRet (APIENTRY*)(TArgs...);
+
+    template <ProcType* Proc, GLProcCounter* Counter>
+    static TRet APIENTRY Invoke(TArgs... args)
+    {
+        struct ScopedRecord
+        {
+            ~ScopedRecord()
+            {
+                GLProcProfiler::RecordCall(*Counter, Timer::Tick() - startTick);
+            }
+            std::uint64_t startTick;
+        }
+        scopedRecord{ Timer::Tick() };
+        return (*Proc)(args...);
+    }
+};
+
+// Declares the counter and the storage for the actual procedure address of a GL procedure; used with the DECL_GLPROC macro.
+#define LLGL_DECL_GLPROC_PROFILER(PFNTYPE, NAME)                       \
+    PFNTYPE         ProfiledProc_##NAME     = nullptr;                  \
+    GLProcCounter   ProfiledCounter_##NAME  = { #NAME, false, {}, {} }
+
+// Replaces a loaded GL procedure by its profiling thunk.
+#define LLGL_INSTALL_GLPROC_PROFILER(NAME)  \
+    ProfiledProc_##NAME = NAME;             \
+    NAME = GLProcThunk<decltype(NAME)>::Invoke<&ProfiledProc_##NAME, &ProfiledCounter_##NAME>
+
+
+} // /namespace LLGL
+
+
+#endif // /LLGL_GL_ENABLE_PROC_PROFILER
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,105 @@
+/*
+ * GLStaticProcProfiler.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_STATIC_PROC_PROFILER_H
+#define LLGL_GL_STATIC_PROC_PROFILER_H
+
+
+/*
+GL 1.0 and 1.1 procedures are linked statically on Windows and Linux, so they cannot be replaced by a profiling thunk when they are loaded.
+Instead, their names are redirected to function pointers that are initialized with the respective profiling thunks (see GLProcProfiler.cpp).
+This header is included at the end of OpenGL.h, so every caller of these procedures is redirected.
+*/
+#if defined LLGL_GL_ENABLE_PROC_PROFILER && LLGL_OPENGL && !defined __APPLE__
+
+namespace LLGL
+{
+
+
+#define DECL_GLSTATICPROC(NAME) \
+    extern decltype(&::NAME) ProfiledStaticProc_##NAME
+
+#include "GLStaticProcsDecl.inl"
+
+#undef DECL_GLSTATICPROC
+
+
+} // /namespace LLGL
+
+// GLProcProfiler.cpp defines the function pointers, so it must refer to the original procedures.
+#ifndef LLGL_GL_DISABLE_STATIC_PROC_REDIRECTION
+
+#define glCullFace                               LLGL::ProfiledStaticProc_glCullFace
+#define glFrontFace                              LLGL::ProfiledStaticProc_glFrontFace
+#define glHint                                   LLGL::ProfiledStaticProc_glHint
+#define glLineWidth                              LLGL::ProfiledStaticProc_glLineWidth
+#define glPointSize                              LLGL::ProfiledStaticProc_glPointSize
+#define glPolygonMode                            LLGL::ProfiledStaticProc_glPolygonMode
+#define glScissor                                LLGL::ProfiledStaticProc_glScissor
+#define glTexParameterf                          LLGL::ProfiledStaticProc_glTexParameterf
+#define glTexParameterfv                         LLGL::ProfiledStaticProc_glTexParameterfv
+#define glTexParameteri                          LLGL::ProfiledStaticProc_glTexParameteri
+#define glTexParameteriv                         LLGL::ProfiledStaticProc_glTexParameteriv
+#define glTexImage1D                             LLGL::ProfiledStaticProc_glTexImage1D
+#define glTexImage2D                             LLGL::ProfiledStaticProc_glTexImage2D
+#define glDrawBuffer                             LLGL::ProfiledStaticProc_glDrawBuffer
+#define glClear                                  LLGL::ProfiledStaticProc_glClear
+#define glClearColor                             LLGL::ProfiledStaticProc_glClearColor
+#define glClearStencil                           LLGL::ProfiledStaticProc_glClearStencil
+#define glClearDepth                             LLGL::ProfiledStaticProc_glClearDepth
+#define glStencilMask                            LLGL::ProfiledStaticProc_glStencilMask
+#define glColorMask                              LLGL::ProfiledStaticProc_glColorMask
+#define glDepthMask                              LLGL::ProfiledStaticProc_glDepthMask
+#define glDisable                                LLGL::ProfiledStaticProc_glDisable
+#define glEnable                                 LLGL::ProfiledStaticProc_glEnable
+#define glFinish                                 LLGL::ProfiledStaticProc_glFinish
+#define glFlush                                  LLGL::ProfiledStaticProc_glFlush
+#define glBlendFunc                              LLGL::ProfiledStaticProc_glBlendFunc
+#define glLogicOp                                LLGL::ProfiledStaticProc_glLogicOp
+#define glStencilFunc                            LLGL::ProfiledStaticProc_glStencilFunc
+#define glStencilOp                              LLGL::ProfiledStaticProc_glStencilOp
+#define glDepthFunc                              LLGL::ProfiledStaticProc_glDepthFunc
+#define glPixelStoref                            LLGL::ProfiledStaticProc_glPixelStoref
+#define glPixelStorei                            LLGL::ProfiledStaticProc_glPixelStorei
+#define glReadBuffer                             LLGL::ProfiledStaticProc_glReadBuffer
+#define glReadPixels                             LLGL::ProfiledStaticProc_glReadPixels
+#define glGetBooleanv                            LLGL::ProfiledStaticProc_glGetBooleanv
+#define glGetDoublev                             LLGL::ProfiledStaticProc_glGetDoublev
+#define glGetError                               LLGL::ProfiledStaticProc_glGetError
+#define glGetFloatv                              LLGL::ProfiledStaticProc_glGetFloatv
+#define glGetIntegerv                            LLGL::ProfiledStaticProc_glGetIntegerv
+#define glGetString                              LLGL::ProfiledStaticProc_glGetString
+#define glGetTexImage                            LLGL::ProfiledStaticProc_glGetTexImage
+#define glGetTexParameterfv                      LLGL::ProfiledStaticProc_glGetTexParameterfv
+#define glGetTexParameteriv                      LLGL::ProfiledStaticProc_glGetTexParameteriv
+#define glIsEnabled                              LLGL::ProfiledStaticProc_glIsEnabled
+#define glDepthRange                             LLGL::ProfiledStaticProc_glDepthRange
+#define glViewport                               LLGL::ProfiledStaticProc_glViewport
+#define glDrawArrays                             LLGL::ProfiledStaticProc_glDrawArrays
+#define glDrawElements                           LLGL::ProfiledStaticProc_glDrawElements
+#define glPolygonOffset                          LLGL::ProfiledStaticProc_glPolygonOffset
+#define glCopyTexImage1D                         LLGL::ProfiledStaticProc_glCopyTexImage1D
+#define glCopyTexImage2D                         LLGL::ProfiledStaticProc_glCopyTexImage2D
+#define glCopyTexSubImage1D                      LLGL::ProfiledStaticProc_glCopyTexSubImage1D
+#define glCopyTexSubImage2D                      LLGL::ProfiledStaticProc_glCopyTexSubImage2D
+#define glTexSubImage1D                          LLGL::ProfiledStaticProc_glTexSubImage1D
+#define glTexSubImage2D                          LLGL::ProfiledStaticProc_glTexSubImage2D
+#define glBindTexture                            LLGL::ProfiledStaticProc_glBindTexture
+#define glDeleteTextures                         LLGL::ProfiledStaticProc_glDeleteTextures
+#define glGenTextures                            LLGL::ProfiledStaticProc_glGenTextures
+#define glIsTexture                              LLGL::ProfiledStaticProc_glIsTexture
+
+#endif // /LLGL_GL_DISABLE_STATIC_PROC_REDIRECTION
+
+#endif // /LLGL_GL_ENABLE_PROC_PROFILER
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,82 @@
+/*
+ * GLStaticProcsDecl.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+// THIS FILE MUST NOT HAVE A HEADER GUARD
+
+
+#ifndef DECL_GLSTATICPROC
+#error Missing definition of macro DECL_GLSTATICPROC(NAME)
+#endif
+
+/* GL 1.0 procedures that are linked statically */
+
+DECL_GLSTATICPROC( glCullFace );
+DECL_GLSTATICPROC( glFrontFace );
+DECL_GLSTATICPROC( glHint );
+DECL_GLSTATICPROC( glLineWidth );
+DECL_GLSTATICPROC( glPointSize );
+DECL_GLSTATICPROC( glPolygonMode );
+DECL_GLSTATICPROC( glScissor );
+DECL_GLSTATICPROC( glTexParameterf );
+DECL_GLSTATICPROC( glTexParameterfv );
+DECL_GLSTATICPROC( glTexParameteri );
+DECL_GLSTATICPROC( glTexParameteriv );
+DECL_GLSTATICPROC( glTexImage1D );
+DECL_GLSTATICPROC( glTexImage2D );
+DECL_GLSTATICPROC( glDrawBuffer );
+DECL_GLSTATICPROC( glClear );
+DECL_GLSTATICPROC( glClearColor );
+DECL_GLSTATICPROC( glClearStencil );
+DECL_GLSTATICPROC( glClearDepth );
+DECL_GLSTATICPROC( glStencilMask );
+DECL_GLSTATICPROC( glColorMask );
+DECL_GLSTATICPROC( glDepthMask );
+DECL_GLSTATICPROC( glDisable );
+DECL_GLSTATICPROC( glEnable );
+DECL_GLSTATICPROC( glFinish );
+DECL_GLSTATICPROC( glFlush );
+DECL_GLSTATICPROC( glBlendFunc );
+DECL_GLSTATICPROC( glLogicOp );
+DECL_GLSTATICPROC( glStencilFunc );
+DECL_GLSTATICPROC( glStencilOp );
+DECL_GLSTATICPROC( glDepthFunc );
+DECL_GLSTATICPROC( glPixelStoref );
+DECL_GLSTATICPROC( glPixelStorei );
+DECL_GLSTATICPROC( glReadBuffer );
+DECL_GLSTATICPROC( glReadPixels );
+DECL_GLSTATICPROC( glGetBooleanv );
+DECL_GLSTATICPROC( glGetDoublev );
+DECL_GLSTATICPROC( glGetError );
+DECL_GLSTATICPROC( glGetFloatv );
+DECL_GLSTATICPROC( glGetIntegerv );
+DECL_GLSTATICPROC( glGetString );
+DECL_GLSTATICPROC( glGetTexImage );
+DECL_GLSTATICPROC( glGetTexParameterfv );
+DECL_GLSTATICPROC( glGetTexParameteriv );
+DECL_GLSTATICPROC( glIsEnabled );
+DECL_GLSTATICPROC( glDepthRange );
+DECL_GLSTATICPROC( glViewport );
+
+/* GL 1.1 procedures that are linked statically */
+
+DECL_GLSTATICPROC( glDrawArrays );
+DECL_GLSTATICPROC( glDrawElements );
+DECL_GLSTATICPROC( glPolygonOffset );
+DECL_GLSTATICPROC( glCopyTexImage1D );
+DECL_GLSTATICPROC( glCopyTexImage2D );
+DECL_GLSTATICPROC( glCopyTexSubImage1D );
+DECL_GLSTATICPROC( glCopyTexSubImage2D );
+DECL_GLSTATICPROC( glTexSubImage1D );
+DECL_GLSTATICPROC( glTexSubImage2D );
+DECL_GLSTATICPROC( glBindTexture );
+DECL_GLSTATICPROC( glDeleteTextures );
+DECL_GLSTATICPROC( glGenTextures );
+DECL_GLSTATICPROC( glIsTexture );
+
+
+
+// ================================================================================
@@ -12,6 +12,7 @@
 #include "Texture/GLFramebufferCapture.h"
 #include "Ext/GLExtensions.h"
 #include "Ext/GLExtensionRegistry.h"
+#include "Ext/GLProcProfiler.h"
 #include "RenderState/GLStatePool.h"
 #include "../RenderSystemUtils.h"
 #include "GLTypes.h"
@@ -20,6 +21,7 @@
 #include "Buffer/GLBufferWithVAO.h"
 #include "Buffer/GLBufferWithXFB.h"
 #include "Buffer/GLBufferArrayWithVAO.h"
+#include "Buffer/GLVertexArrayCache.h"
 #include "../CheckedCast.h"
 #include "../BufferUtils.h"
 #include "../TextureUtils.h"
@@ -34,6 +36,8 @@
 #include "RenderState/GLGraphicsPSO.h"
 #include "RenderState/GLComputePSO.h"
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/RenderingDebugger.h>
+#include <algorithm>
 
 #ifdef LLGL_OPENGL
 #   include "Shader/GLSeparableShader.h"
@@ -65,8 +69,18 @@ GLRenderSystem::GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
     debugContext_
     {
         ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0)
+    },
+    debugger_
+    {
+        renderSystemDesc.debugger
     }
 {
+    /* Configure limit of unused texture views that are kept alive for reuse */
+    const RendererConfigurationOpenGL rendererConfigGL = GetGLProfileFromDesc(renderSystemDesc);
+    GLTextureViewPool::Get().SetMaxCachedTextureViews(rendererConfigGL.maxCachedTextureViews);
+
+    /* Configure whether VAOs are shared by vertex format across vertex arrays with different vertex buffers */
+    GLVertexArrayCache::SetVertexFormatSharing(rendererConfigGL.shareVertexArraysByFormat);
 }
 
 GLRenderSystem::~GLRenderSystem()
@@ -78,6 +92,18 @@ GLRenderSystem::~GLRenderSystem()
     GLStatePool::Get().Clear();
 }
 
+void GLRenderSystem::FlushProfile()
+{
+    /* Always flush pool statistics, so counters only cover the last frame even if no debugger is set */
+    FrameProfile profile;
+    GLTextureViewPool::Get().FlushProfile(profile.textureViewPoolRecord);
+    #ifdef LLGL_GL_ENABLE_PROC_PROFILER
+    GLProcProfiler::FlushProfile(profile.nativeCallRecords);
+    #endif
+    if (debugger_ != nullptr)
+        debugger_->RecordProfile(profile);
+}
+
 /* ----- Swap-chain ----- */
 
 SwapChain* GLRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
@@ -431,6 +457,18 @@ std::uint32_t GLRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std:
     return resourceHeapGL.WriteResourceViews(firstDescriptor, resourceViews);
 }
 
+void GLRenderSystem::BeginResourceHeapUpdate(ResourceHeap& resourceHeap)
+{
+    auto& resourceHeapGL = LLGL_CAST(GLResourceHeap&, resourceHeap);
+    resourceHeapGL.BeginUpdate();
+}
+
+std::uint32_t GLRenderSystem::CommitResourceHeapUpdate(ResourceHeap& resourceHeap)
+{
+    auto& resourceHeapGL = LLGL_CAST(GLResourceHeap&, resourceHeap);
+    return resourceHeapGL.CommitUpdate();
+}
+
 /* ----- Render Passes ----- */
 
 RenderPass* GLRenderSystem::CreateRenderPass(const RenderPassDescriptor& renderPassDesc)
@@ -561,6 +599,41 @@ void GLRenderSystem::Release(PipelineState& pipelineState)
     pipelineStates_.erase(&pipelineState);
 }
 
+std::uint32_t GLRenderSystem::CreatePipelineStates(std::uint32_t numPipelineStates, const GraphicsPipelineDescriptor* pipelineStateDescs, PipelineState** outPipelineStates)
+{
+    /* Create all PSOs first; Their shader pipelines are linked without querying the link status in between */
+    const std::uint32_t numCreated = RenderSystem::CreatePipelineStates(numPipelineStates, pipelineStateDescs, outPipelineStates);
+
+    std::vector<GLPipelineState*> pendingPSOs;
+    pendingPSOs.reserve(numCreated);
+    for_range(i, numPipelineStates)
+    {
+        if (outPipelineStates[i] != nullptr)
+            pendingPSOs.push_back(LLGL_CAST(GLPipelineState*, outPipelineStates[i]));
+    }
+
+    /* Finalize PSOs in the order the driver completes linking them; Without GL_KHR_parallel_shader_compile, all PSOs are reported as complete */
+    while (!pendingPSOs.empty())
+    {
+        auto it = std::find_if(
+            pendingPSOs.begin(), pendingPSOs.end(),
+            [](const GLPipelineState* pso) -> bool
+            {
+                return pso->IsLinkComplete();
+            }
+        );
+
+        /* If no PSO has completed yet, wait for the oldest one instead of spinning on the completion status */
+        if (it == pendingPSOs.end())
+            it = pendingPSOs.begin();
+
+        (*it)->FinalizeLink();
+        pendingPSOs.erase(it);
+    }
+
+    return numCreated;
+}
+
 /* ----- Queries ----- */
 
 QueryHeap* GLRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& quertHeapDesc)
@@ -610,6 +683,12 @@ void GLRenderSystem::RegisterNewGLContext(GLContext& /*context*/, const GLPixelF
     /* Enable debug callback function */
     if (debugContext_)
         EnableDebugCallback();
+
+    /* Let the driver compile and link shaders on as many background threads as it supports */
+    #if LLGL_GLEXT_PARALLEL_SHADER_COMPILE
+    if (HasExtension(GLExt::KHR_parallel_shader_compile))
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    #endif
 }
 
 #if LLGL_GLEXT_DEBUG
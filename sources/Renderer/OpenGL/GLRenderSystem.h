@@ -59,6 +59,13 @@ class GLRenderSystem final : public RenderSystem
 
         #include <LLGL/Backend/RenderSystem.inl>
 
+    public:
+
+        std::uint32_t CreatePipelineStates(std::uint32_t numPipelineStates, const GraphicsPipelineDescriptor* pipelineStateDescs, PipelineState** outPipelineStates) override;
+
+        void BeginResourceHeapUpdate(ResourceHeap& resourceHeap) override;
+        std::uint32_t CommitResourceHeapUpdate(ResourceHeap& resourceHeap) override;
+
     public:
 
         GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
@@ -71,6 +78,9 @@ class GLRenderSystem final : public RenderSystem
             return isBreakOnErrorEnabled_;
         }
 
+        // Records the backend specific frame profile into the rendering debugger (if set); called on GLSwapChain::Present().
+        void FlushProfile();
+
     private:
 
         #include <LLGL/Backend/RenderSystem.Internal.inl>
@@ -97,6 +107,7 @@ class GLRenderSystem final : public RenderSystem
         GLCommandQueue                          commandQueue_;
         bool                                    debugContext_           = false;
         bool                                    isBreakOnErrorEnabled_  = false;
+        RenderingDebugger*                      debugger_               = nullptr;
 
         HWObjectContainer<GLSwapChain>          swapChains_;
         HWObjectContainer<GLCommandBuffer>      commandBuffers_;
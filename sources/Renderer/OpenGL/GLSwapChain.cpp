@@ -9,6 +9,7 @@
 #include "GLRenderSystem.h"
 #include "../TextureUtils.h"
 #include "Platform/GLContextManager.h"
+#include "Platform/GLHeadlessSurface.h"
 #include <LLGL/TypeInfo.h>
 #include <LLGL/Platform/Platform.h>
 #include <LLGL/Display.h>
@@ -47,7 +48,8 @@ GLSwapChain::GLSwapChain(
     const std::shared_ptr<Surface>& surface,
     GLContextManager&               contextMngr)
 :
-    SwapChain { desc }
+    SwapChain     { desc         },
+    renderSystem_ { renderSystem }
 {
     /* Set up pixel format for GL context */
     GLPixelFormat pixelFormat;
@@ -56,6 +58,15 @@ GLSwapChain::GLSwapChain(
     pixelFormat.stencilBits = desc.stencilBits;
     pixelFormat.samples     = static_cast<int>(GetClampedSamples(desc.samples));
 
+    #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+    if (contextMngr.IsHeadless())
+    {
+        /* Set up surface without native window; only its size is used for the offscreen pbuffer */
+        SetOrCreateSurface((surface ? surface : std::make_shared<GLHeadlessSurface>(desc.resolution)), UTF8String{}, desc);
+    }
+    else
+    #endif
+    {
     #ifdef LLGL_OS_LINUX
         #if LLGL_OPENGL_WAYLAND
         NativeHandle nativeHandle = {};
@@ -84,6 +95,7 @@ GLSwapChain::GLSwapChain(
         /* Setup surface for the swap-chain */
         SetOrCreateSurface(surface, UTF8String{}, desc);
     #endif
+    }
 
     /*
     Cache resolution height after surface has been created,
@@ -100,7 +112,7 @@ GLSwapChain::GLSwapChain(
     GetStateManager().ResetFramebufferHeight(framebufferHeight_);
 
     /* Show default surface */
-    if (!surface)
+    if (!surface && !contextMngr.IsHeadless())
     {
         /* Build default surface title after surface creation so we have a valid GLContext with renderer information */
         BuildAndSetDefaultSurfaceTitle(renderSystem.GetRendererInfo());
@@ -116,6 +128,7 @@ bool GLSwapChain::IsPresentable() const
 void GLSwapChain::Present()
 {
     swapChainContext_->SwapBuffers();
+    renderSystem_.FlushProfile();
 }
 
 std::uint32_t GLSwapChain::GetCurrentSwapIndex() const
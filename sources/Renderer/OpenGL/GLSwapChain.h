@@ -67,6 +67,7 @@ class GLSwapChain final : public SwapChain
 
     private:
 
+        GLRenderSystem&                     renderSystem_;
         std::shared_ptr<GLContext>          context_;
         std::unique_ptr<GLSwapChainContext> swapChainContext_;
         GLint                               framebufferHeight_ = 0;
@@ -42,6 +42,10 @@
 #   define LLGL_GLEXT_VERTEX_ARRAY_OBJECT 1
 #endif
 
+#if GL_ARB_vertex_attrib_binding || GL_ES_VERSION_3_1
+#   define LLGL_GLEXT_VERTEX_ATTRIB_BINDING 1
+#endif
+
 #if GL_ARB_sampler_objects || GL_ES_VERSION_3_0
 #   define LLGL_GLEXT_SAMPLER_OBJECTS 1
 #endif
@@ -114,6 +118,10 @@
 #   define LLGL_GLEXT_DEBUG 1
 #endif
 
+#if GL_KHR_parallel_shader_compile && defined LLGL_OPENGL && !LLGL_GL_ENABLE_OPENGL2X
+#   define LLGL_GLEXT_PARALLEL_SHADER_COMPILE 1
+#endif
+
 //TODO: which extension?
 #if defined LLGL_OPENGL && !LLGL_GL_ENABLE_OPENGL2X
 #   define LLGL_GLEXT_CONDITIONAL_RENDER 1
@@ -220,6 +228,11 @@
 #   define LLGL_USE_NULL_FRAGMENT_SHADER 1
 #endif
 
+// Redirect statically linked GL procedures to their profiling thunks
+#ifdef LLGL_GL_ENABLE_PROC_PROFILER
+#   include "Ext/GLStaticProcProfiler.h"
+#endif
+
 #endif
 
 
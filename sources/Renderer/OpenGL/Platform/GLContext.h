@@ -14,6 +14,7 @@
 #include <LLGL/Container/ArrayView.h>
 #include <memory>
 #include "../RenderState/GLStateManager.h"
+#include "../Buffer/GLVertexArrayCache.h"
 
 
 namespace LLGL
@@ -74,6 +75,12 @@ class GLContext
             return stateMngr_;
         }
 
+        // Returns the cache of vertex-array-objects (VAO) for this context. VAOs cannot be shared between GL contexts.
+        inline GLVertexArrayCache& GetVertexArrayCache()
+        {
+            return vertexArrayCache_;
+        }
+
         // Returns the global index of this GL context. This is assigned when the context is created. The first index starts with 1. The invalid index is 0.
         inline unsigned GetGlobalIndex() const
         {
@@ -127,10 +134,11 @@ class GLContext
 
     private:
 
-        GLStateManager  stateMngr_;
-        Format          colorFormat_        = Format::Undefined;
-        Format          depthStencilFormat_ = Format::Undefined;
-        unsigned        globalIndex_        = 0;
+        GLStateManager      stateMngr_;
+        GLVertexArrayCache  vertexArrayCache_;
+        Format              colorFormat_        = Format::Undefined;
+        Format              depthStencilFormat_ = Format::Undefined;
+        unsigned            globalIndex_        = 0;
 
 };
 
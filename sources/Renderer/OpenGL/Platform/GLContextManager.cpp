@@ -10,6 +10,7 @@
 #include "../Ext/GLExtensionLoader.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../Profile/GLProfile.h"
+#include "GLHeadlessSurface.h"
 #include "../../../Core/CoreUtils.h"
 #include <LLGL/Window.h>
 #include <LLGL/Canvas.h>
@@ -58,6 +59,14 @@ std::shared_ptr<GLContext> GLContextManager::AllocContext(
 
 std::unique_ptr<Surface> GLContextManager::CreatePlaceholderSurface()
 {
+    #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+    /* Create surface without native window for headless GL contexts */
+    if (IsHeadless())
+        return MakeUnique<GLHeadlessSurface>(Extent2D{ 256, 256 });
+
+    #endif
+
     #ifdef LLGL_MOBILE_PLATFORM
 
     /* Create new canvas as placeholder surface */
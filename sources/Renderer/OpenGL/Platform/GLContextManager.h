@@ -69,6 +69,16 @@ class GLContextManager
             return profile_;
         }
 
+        // Returns true if GL contexts are created without a connection to a display server.
+        inline bool IsHeadless() const
+        {
+            #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+            return profile_.headless;
+            #else
+            return false;
+            #endif
+        }
+
     private:
 
         struct GLPixelFormatWithContext
@@ -0,0 +1,59 @@
+/*
+ * GLHeadlessSurface.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+#include "GLHeadlessSurface.h"
+
+
+namespace LLGL
+{
+
+
+GLHeadlessSurface::GLHeadlessSurface(const Extent2D& size) :
+    size_ { size }
+{
+}
+
+bool GLHeadlessSurface::GetNativeHandle(void* /*nativeHandle*/, std::size_t /*nativeHandleSize*/)
+{
+    return false;
+}
+
+Extent2D GLHeadlessSurface::GetContentSize() const
+{
+    return size_;
+}
+
+bool GLHeadlessSurface::AdaptForVideoMode(Extent2D* resolution, bool* fullscreen)
+{
+    /* Fullscreen mode is not supported without a display */
+    if (fullscreen != nullptr && *fullscreen)
+    {
+        *fullscreen = false;
+        return false;
+    }
+
+    if (resolution != nullptr)
+        size_ = *resolution;
+
+    return true;
+}
+
+Display* GLHeadlessSurface::FindResidentDisplay() const
+{
+    return nullptr;
+}
+
+
+} // /namespace LLGL
+
+#endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+
+
+
+// ================================================================================
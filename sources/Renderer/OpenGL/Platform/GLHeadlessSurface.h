@@ -0,0 +1,56 @@
+/*
+ * GLHeadlessSurface.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_HEADLESS_SURFACE_H
+#define LLGL_GL_HEADLESS_SURFACE_H
+
+
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+#include <LLGL/Surface.h>
+
+
+namespace LLGL
+{
+
+
+// Surface without a native window for headless GL contexts. This only keeps track of the content size for offscreen swap-chains.
+class GLHeadlessSurface final : public Surface
+{
+
+    public:
+
+        GLHeadlessSurface(const Extent2D& size);
+
+        // Returns false since there is no native window handle.
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
+
+        Extent2D GetContentSize() const override;
+
+        // Adopts the new resolution and rejects fullscreen mode.
+        bool AdaptForVideoMode(Extent2D* resolution, bool* fullscreen) override;
+
+        // Returns null since a headless surface is never resident in a display.
+        Display* FindResidentDisplay() const override;
+
+    private:
+
+        Extent2D size_;
+
+};
+
+
+} // /namespace LLGL
+
+#endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+
+
+#endif
+
+
+
+// ================================================================================
@@ -22,6 +22,7 @@
 
 #include "LinuxGLContextWayland.h"
 #include "LinuxGLContextX11.h"
+#include "LinuxGLContextHeadless.h"
 
 
 namespace LLGL
@@ -52,6 +53,24 @@ std::unique_ptr<GLContext> GLContext::Create(
     GLContext*                          sharedContext,
     const ArrayView<char>&              customNativeHandle)
 {
+    if (profile.headless)
+    {
+        #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+        LinuxGLContextHeadless* sharedContextEGL = (sharedContext != nullptr ? LLGL_CAST(LinuxGLContextHeadless*, sharedContext) : nullptr);
+
+        return MakeUnique<LinuxGLContextHeadless>(
+            pixelFormat, profile, sharedContextEGL,
+            GetRendererNativeHandle<OpenGL::RenderSystemNativeHandle>(customNativeHandle)
+        );
+
+        #else
+
+        LLGL_TRAP("Headless GL context requested but LLGL was built without LLGL_GL_ENABLE_EGL_HEADLESS");
+
+        #endif
+    }
+
     LLGL::NativeHandle nativeHandle = {};
     surface.GetNativeHandle(&nativeHandle, sizeof(nativeHandle));
 
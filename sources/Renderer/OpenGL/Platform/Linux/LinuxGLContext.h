@@ -26,6 +26,12 @@ class LinuxGLContext : public GLContext
         // Returns the native type of this GL context (GLX or EGL).
         virtual OpenGL::RenderSystemNativeType GetNativeType() const = 0;
 
+        // Returns true if this GL context has no connection to a display server. By default false.
+        virtual bool IsHeadless() const
+        {
+            return false;
+        }
+
 };
 
 
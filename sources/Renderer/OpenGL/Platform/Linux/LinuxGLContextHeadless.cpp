@@ -0,0 +1,270 @@
+/*
+ * LinuxGLContextHeadless.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+#include "LinuxGLContextHeadless.h"
+#include "../../../../Core/Assertion.h"
+#include "../../../../Core/Exception.h"
+#include <LLGL/Backend/OpenGL/NativeHandle.h>
+#include <LLGL/Log.h>
+#include <algorithm>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Number of alive headless contexts; the shared EGL display is terminated when the last one is deleted.
+static int g_numHeadlessEGLContexts = 0;
+
+// Returns true if the specified space separated list of EGL extensions contains the specified extension name.
+static bool HasEGLExtension(const char* extensions, const char* name)
+{
+    if (extensions == nullptr)
+        return false;
+
+    const std::size_t nameLen = ::strlen(name);
+    for (const char* s = extensions; (s = ::strstr(s, name)) != nullptr; s += nameLen)
+    {
+        if ((s == extensions || s[-1] == ' ') && (s[nameLen] == ' ' || s[nameLen] == '\0'))
+            return true;
+    }
+
+    return false;
+}
+
+static EGLDisplay InitializeEGLDisplay(EGLDisplay display)
+{
+    if (display != EGL_NO_DISPLAY && eglInitialize(display, nullptr, nullptr) == EGL_TRUE)
+        return display;
+    else
+        return EGL_NO_DISPLAY;
+}
+
+EGLDisplay LinuxGLContextHeadless::GetHeadlessEGLDisplay()
+{
+    /* Platform displays require EGL 1.5 or EGL_EXT_platform_base */
+    const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+
+    auto eglGetPlatformDisplayEXTProc = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (eglGetPlatformDisplayEXTProc == nullptr)
+        return EGL_NO_DISPLAY;
+
+    /* Prefer the first EGL device, which doesn't require any windowing system */
+    if (HasEGLExtension(clientExtensions, "EGL_EXT_platform_device"))
+    {
+        auto eglQueryDevicesEXTProc = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(eglGetProcAddress("eglQueryDevicesEXT"));
+
+        EGLDeviceEXT device = nullptr;
+        EGLint numDevices = 0;
+
+        if (eglQueryDevicesEXTProc != nullptr && eglQueryDevicesEXTProc(1, &device, &numDevices) == EGL_TRUE && numDevices > 0)
+        {
+            EGLDisplay display = InitializeEGLDisplay(eglGetPlatformDisplayEXTProc(EGL_PLATFORM_DEVICE_EXT, device, nullptr));
+            if (display != EGL_NO_DISPLAY)
+                return display;
+        }
+    }
+
+    /* Fall back to the surfaceless platform of Mesa */
+    if (HasEGLExtension(clientExtensions, "EGL_MESA_platform_surfaceless"))
+    {
+        EGLDisplay display = InitializeEGLDisplay(eglGetPlatformDisplayEXTProc(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr));
+        if (display != EGL_NO_DISPLAY)
+            return display;
+    }
+
+    return EGL_NO_DISPLAY;
+}
+
+void LinuxGLContextHeadless::CreateEGLContext(
+    const GLPixelFormat&                pixelFormat,
+    const RendererConfigurationOpenGL&  profile,
+    LinuxGLContextHeadless*             sharedContext)
+{
+    EGLContext glcShared = (sharedContext != nullptr ? sharedContext->context_ : EGL_NO_CONTEXT);
+
+    display_ = GetHeadlessEGLDisplay();
+    if (display_ == EGL_NO_DISPLAY)
+        LLGL_TRAP("failed to get headless EGL display; neither EGL_EXT_platform_device nor EGL_MESA_platform_surfaceless is supported");
+
+    if (eglBindAPI(EGL_OPENGL_API) != EGL_TRUE)
+        LLGL_TRAP("failed to bind OpenGL API for EGL");
+
+    ChooseEGLConfig(pixelFormat);
+
+    /* Create GL context with the requested profile */
+    if (profile.contextProfile == OpenGLContextProfile::CoreProfile)
+    {
+        if (profile.majorVersion == 0 && profile.minorVersion == 0)
+        {
+            /* Find highest GL version that is supported for the core profile */
+            static const int glVersions[][2] = { { 4, 6 }, { 4, 5 }, { 4, 4 }, { 4, 3 }, { 4, 2 }, { 4, 1 }, { 4, 0 }, { 3, 3 }, { 3, 2 } };
+            for (const auto& version : glVersions)
+            {
+                context_ = CreateEGLContextCoreProfile(glcShared, version[0], version[1]);
+                if (context_ != EGL_NO_CONTEXT)
+                    break;
+            }
+        }
+        else
+            context_ = CreateEGLContextCoreProfile(glcShared, profile.majorVersion, profile.minorVersion);
+    }
+    else
+        context_ = CreateEGLContextCompatibilityProfile(glcShared);
+
+    if (context_ == EGL_NO_CONTEXT)
+        LLGL_TRAP("failed to create headless EGL context (error code = 0x%04X)", static_cast<unsigned>(eglGetError()));
+
+    /* Make context current without a drawable; swap-chains provide pbuffer surfaces */
+    if (eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, context_) != EGL_TRUE)
+        LLGL_TRAP("failed to make headless EGL context current; EGL_KHR_surfaceless_context is required");
+
+    /* Deduce color and depth-stencil formats from chosen config */
+    EGLint depthBits = 0, stencilBits = 0;
+    eglGetConfigAttrib(display_, config_, EGL_DEPTH_SIZE, &depthBits);
+    eglGetConfigAttrib(display_, config_, EGL_STENCIL_SIZE, &stencilBits);
+
+    SetDefaultColorFormat();
+    DeduceDepthStencilFormat(depthBits, stencilBits);
+
+    ++g_numHeadlessEGLContexts;
+}
+
+void LinuxGLContextHeadless::DeleteEGLContext()
+{
+    eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(display_, context_);
+
+    /* All headless contexts share the same display, so only terminate it with the last context */
+    if (--g_numHeadlessEGLContexts == 0)
+        eglTerminate(display_);
+}
+
+void LinuxGLContextHeadless::ChooseEGLConfig(const GLPixelFormat& pixelFormat)
+{
+    /* Find suitable multi-sample format (for samples > 1) */
+    for (samples_ = std::max(1, pixelFormat.samples); samples_ > 0; --samples_)
+    {
+        const EGLint configAttribs[] =
+        {
+            EGL_SURFACE_TYPE,       EGL_PBUFFER_BIT,
+            EGL_RENDERABLE_TYPE,    EGL_OPENGL_BIT,
+            EGL_COLOR_BUFFER_TYPE,  EGL_RGB_BUFFER,
+            EGL_RED_SIZE,           8,
+            EGL_GREEN_SIZE,         8,
+            EGL_BLUE_SIZE,          8,
+            EGL_ALPHA_SIZE,         8,
+            EGL_DEPTH_SIZE,         pixelFormat.depthBits,
+            EGL_STENCIL_SIZE,       pixelFormat.stencilBits,
+            EGL_SAMPLE_BUFFERS,     (samples_ > 1 ? 1 : 0),
+            EGL_SAMPLES,            (samples_ > 1 ? samples_ : 0),
+            EGL_NONE
+        };
+
+        EGLint numConfigs = 0;
+        if (eglChooseConfig(display_, configAttribs, &config_, 1, &numConfigs) == EGL_TRUE && numConfigs == 1)
+            return;
+    }
+
+    LLGL_TRAP("failed to choose EGL config with pbuffer support");
+}
+
+EGLContext LinuxGLContextHeadless::CreateEGLContextCoreProfile(EGLContext glcShared, int major, int minor)
+{
+    const EGLint contextAttribs[] =
+    {
+        EGL_CONTEXT_MAJOR_VERSION,          major,
+        EGL_CONTEXT_MINOR_VERSION,          minor,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK,    EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    return eglCreateContext(display_, config_, glcShared, contextAttribs);
+}
+
+EGLContext LinuxGLContextHeadless::CreateEGLContextCompatibilityProfile(EGLContext glcShared)
+{
+    const EGLint contextAttribs[] =
+    {
+        EGL_CONTEXT_OPENGL_PROFILE_MASK,    EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT,
+        EGL_NONE
+    };
+    return eglCreateContext(display_, config_, glcShared, contextAttribs);
+}
+
+
+/*
+ * LinuxGLContextHeadless class
+ */
+
+LinuxGLContextHeadless::LinuxGLContextHeadless(
+    const GLPixelFormat&                    pixelFormat,
+    const RendererConfigurationOpenGL&      profile,
+    LinuxGLContextHeadless*                 sharedContext,
+    const OpenGL::RenderSystemNativeHandle* customNativeHandle)
+{
+    if (customNativeHandle != nullptr)
+        LLGL_TRAP_NOT_IMPLEMENTED("headless proxy EGL context");
+
+    CreateEGLContext(pixelFormat, profile, sharedContext);
+}
+
+LinuxGLContextHeadless::~LinuxGLContextHeadless()
+{
+    DeleteEGLContext();
+}
+
+int LinuxGLContextHeadless::GetSamples() const
+{
+    return samples_;
+}
+
+bool LinuxGLContextHeadless::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) const
+{
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(OpenGL::RenderSystemNativeHandle))
+    {
+        auto* nativeHandleGL = static_cast<OpenGL::RenderSystemNativeHandle*>(nativeHandle);
+
+        nativeHandleGL->egl = context_;
+        nativeHandleGL->type = OpenGL::RenderSystemNativeType::EGL;
+
+        return true;
+    }
+    return false;
+}
+
+OpenGL::RenderSystemNativeType LinuxGLContextHeadless::GetNativeType() const
+{
+    return OpenGL::RenderSystemNativeType::EGL;
+}
+
+bool LinuxGLContextHeadless::IsHeadless() const
+{
+    return true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool LinuxGLContextHeadless::SetSwapInterval(int /*interval*/)
+{
+    /* Pbuffers are never presented, so the swap interval is ignored */
+    return true;
+}
+
+
+} // /namespace LLGL
+
+#endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+
+
+
+// ================================================================================
@@ -0,0 +1,104 @@
+/*
+ * LinuxGLContextHeadless.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_LINUX_GL_CONTEXT_HEADLESS_H
+#define LLGL_LINUX_GL_CONTEXT_HEADLESS_H
+
+
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+#include "LinuxGLContext.h"
+#include "../../OpenGL.h"
+#include <LLGL/RendererConfiguration.h>
+
+
+namespace LLGL
+{
+
+// Implementation of the <LinuxGLContext> interface for GNU/Linux and wrapper for a native EGL context without a display server.
+class LinuxGLContextHeadless : public LinuxGLContext
+{
+
+    public:
+
+        LinuxGLContextHeadless(
+            const GLPixelFormat&                    pixelFormat,
+            const RendererConfigurationOpenGL&      profile,
+            LinuxGLContextHeadless*                 sharedContext,
+            const OpenGL::RenderSystemNativeHandle* customNativeHandle
+        );
+        ~LinuxGLContextHeadless();
+
+        int GetSamples() const override;
+
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) const override;
+
+        OpenGL::RenderSystemNativeType GetNativeType() const override;
+
+        bool IsHeadless() const override;
+
+    public:
+
+        inline EGLDisplay GetEGLDisplay() const
+        {
+            return display_;
+        }
+
+        inline EGLConfig GetEGLConfig() const
+        {
+            return config_;
+        }
+
+        inline EGLContext GetEGLContext() const
+        {
+            return context_;
+        }
+
+    private:
+
+        bool SetSwapInterval(int interval) override;
+
+    private:
+
+        // Returns an initialized EGL display of the first EGL device or the surfaceless platform.
+        static EGLDisplay GetHeadlessEGLDisplay();
+
+        void CreateEGLContext(
+            const GLPixelFormat&                pixelFormat,
+            const RendererConfigurationOpenGL&  profile,
+            LinuxGLContextHeadless*             sharedContext
+        );
+
+        // Deletes the EGL context and terminates the EGL display once the last headless context is deleted.
+        void DeleteEGLContext();
+
+        // Chooses an EGL config with pbuffer support and modifies the sample count depending on availability.
+        void ChooseEGLConfig(const GLPixelFormat& pixelFormat);
+
+        EGLContext CreateEGLContextCoreProfile(EGLContext glcShared, int major, int minor);
+        EGLContext CreateEGLContextCompatibilityProfile(EGLContext glcShared);
+
+    private:
+
+        EGLDisplay  display_    = EGL_NO_DISPLAY;
+        EGLContext  context_    = EGL_NO_CONTEXT;
+        EGLConfig   config_     = nullptr;
+        int         samples_    = 1;
+
+};
+
+
+} // /namespace LLGL
+
+#endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+
+
+#endif
+
+
+
+// ================================================================================
@@ -12,6 +12,11 @@
 #include "LinuxGLSwapChainContextWayland.h"
 #endif
 
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+#include "LinuxGLSwapChainContextHeadless.h"
+#endif
+
+#include "../../../CheckedCast.h"
 #include "../../../../Core/CoreUtils.h"
 #include <LLGL/Platform/NativeHandle.h>
 
@@ -26,6 +31,14 @@ namespace LLGL
 
 std::unique_ptr<GLSwapChainContext> GLSwapChainContext::Create(GLContext& context, Surface& surface)
 {
+    #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+    if (LLGL_CAST(LinuxGLContext&, context).IsHeadless())
+    {
+        /* Create EGL swap-chain context with offscreen pbuffer */
+        return MakeUnique<LinuxGLSwapChainContextHeadless>(static_cast<LinuxGLContextHeadless&>(context), surface);
+    }
+    #endif
+
     #if LLGL_LINUX_ENABLE_WAYLAND
     NativeHandle nativeHandle = {};
     surface.GetNativeHandle(&nativeHandle, sizeof(nativeHandle));
@@ -45,6 +58,19 @@ std::unique_ptr<GLSwapChainContext> GLSwapChainContext::Create(GLContext& contex
 
 bool GLSwapChainContext::MakeCurrentUnchecked(GLSwapChainContext* context)
 {
+    #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+    if (context != nullptr)
+    {
+        if (LLGL_CAST(LinuxGLContext&, context->GetGLContext()).IsHeadless())
+            return LinuxGLSwapChainContextHeadless::MakeCurrentEGLContext(static_cast<LinuxGLSwapChainContextHeadless*>(context));
+    }
+    else if (eglGetCurrentContext() != EGL_NO_CONTEXT && glXGetCurrentContext() == nullptr)
+    {
+        /* Unset headless EGL context */
+        return LinuxGLSwapChainContextHeadless::MakeCurrentEGLContext(nullptr);
+    }
+    #endif
+
     #if LLGL_LINUX_ENABLE_WAYLAND
     if (context != nullptr)
     {
@@ -0,0 +1,105 @@
+/*
+ * LinuxGLSwapChainContextHeadless.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+#include "LinuxGLSwapChainContextHeadless.h"
+#include "../../../../Core/Exception.h"
+#include <LLGL/Surface.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+LinuxGLSwapChainContextHeadless::LinuxGLSwapChainContextHeadless(LinuxGLContextHeadless& context, Surface& surface) :
+    GLSwapChainContext { context                  },
+    display_           { context.GetEGLDisplay()  },
+    config_            { context.GetEGLConfig()   },
+    context_           { context.GetEGLContext()  }
+{
+    CreatePbufferSurface(surface.GetContentSize());
+}
+
+LinuxGLSwapChainContextHeadless::~LinuxGLSwapChainContextHeadless()
+{
+    DestroyPbufferSurface();
+}
+
+bool LinuxGLSwapChainContextHeadless::HasDrawable() const
+{
+    return (surface_ != EGL_NO_SURFACE);
+}
+
+bool LinuxGLSwapChainContextHeadless::SwapBuffers()
+{
+    /* Pbuffers have no front buffer, so only submit the pending GL commands */
+    glFlush();
+    return true;
+}
+
+void LinuxGLSwapChainContextHeadless::Resize(const Extent2D& resolution)
+{
+    /* Pbuffers cannot be resized, so replace it by a new one and make it current again */
+    const bool isCurrent = (eglGetCurrentSurface(EGL_DRAW) == surface_);
+    if (isCurrent)
+        eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, context_);
+
+    DestroyPbufferSurface();
+    CreatePbufferSurface(resolution);
+
+    if (isCurrent)
+        eglMakeCurrent(display_, surface_, surface_, context_);
+}
+
+bool LinuxGLSwapChainContextHeadless::MakeCurrentEGLContext(LinuxGLSwapChainContextHeadless* context)
+{
+    if (context != nullptr)
+        return (eglMakeCurrent(context->display_, context->surface_, context->surface_, context->context_) == EGL_TRUE);
+    else if (EGLDisplay display = eglGetCurrentDisplay())
+        return (eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) == EGL_TRUE);
+    else
+        return true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void LinuxGLSwapChainContextHeadless::CreatePbufferSurface(const Extent2D& resolution)
+{
+    const EGLint surfaceAttribs[] =
+    {
+        EGL_WIDTH,  static_cast<EGLint>(std::max(1u, resolution.width)),
+        EGL_HEIGHT, static_cast<EGLint>(std::max(1u, resolution.height)),
+        EGL_NONE
+    };
+
+    surface_ = eglCreatePbufferSurface(display_, config_, surfaceAttribs);
+    if (surface_ == EGL_NO_SURFACE)
+        LLGL_TRAP("failed to create EGL pbuffer surface of size %ux%u (error code = 0x%04X)", resolution.width, resolution.height, static_cast<unsigned>(eglGetError()));
+}
+
+void LinuxGLSwapChainContextHeadless::DestroyPbufferSurface()
+{
+    if (surface_ != EGL_NO_SURFACE)
+    {
+        eglDestroySurface(display_, surface_);
+        surface_ = EGL_NO_SURFACE;
+    }
+}
+
+
+} // /namespace LLGL
+
+#endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+
+
+
+// ================================================================================
@@ -0,0 +1,64 @@
+/*
+ * LinuxGLSwapChainContextHeadless.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_LINUX_GL_SWAP_CHAIN_CONTEXT_HEADLESS_H
+#define LLGL_LINUX_GL_SWAP_CHAIN_CONTEXT_HEADLESS_H
+
+
+#ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+
+#include "LinuxGLContextHeadless.h"
+#include "../GLSwapChainContext.h"
+#include "../../OpenGL.h"
+
+
+namespace LLGL
+{
+
+
+// Swap-chain context that renders into an offscreen EGL pbuffer instead of a window.
+class LinuxGLSwapChainContextHeadless final : public GLSwapChainContext
+{
+
+    public:
+
+        LinuxGLSwapChainContextHeadless(LinuxGLContextHeadless& context, Surface& surface);
+        ~LinuxGLSwapChainContextHeadless();
+
+        bool HasDrawable() const override;
+        bool SwapBuffers() override;
+        void Resize(const Extent2D& resolution) override;
+
+    public:
+
+        static bool MakeCurrentEGLContext(LinuxGLSwapChainContextHeadless* context);
+
+    private:
+
+        void CreatePbufferSurface(const Extent2D& resolution);
+        void DestroyPbufferSurface();
+
+    private:
+
+        EGLDisplay display_ = EGL_NO_DISPLAY;
+        EGLConfig  config_  = nullptr;
+        EGLSurface surface_ = EGL_NO_SURFACE;
+        EGLContext context_ = EGL_NO_CONTEXT;
+
+};
+
+
+} // /namespace LLGL
+
+#endif // /LLGL_GL_ENABLE_EGL_HEADLESS
+
+
+#endif
+
+
+
+// ================================================================================
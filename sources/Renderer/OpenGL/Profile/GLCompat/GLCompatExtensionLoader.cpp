@@ -7,6 +7,7 @@
 
 #include "../../Ext/GLExtensionLoader.h"
 #include "../../Ext/GLExtensionRegistry.h"
+#include "../../Ext/GLProcProfiler.h"
 #include "../../../../Core/Exception.h"
 #include "GLCompatExtensions.h"
 #include <LLGL/Utils/ForRange.h>
@@ -34,6 +35,14 @@ bool LoadGLProc(T& procAddr, const char* procName)
     #if defined(_WIN32)
     procAddr = reinterpret_cast<T>(wglGetProcAddress(procName));
     #elif defined(__linux__)
+    #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+    /* Headless GL contexts are created with EGL and must not depend on GLX */
+    if (eglGetCurrentContext() != EGL_NO_CONTEXT)
+    {
+        procAddr = reinterpret_cast<T>(eglGetProcAddress(procName));
+        return (procAddr != nullptr);
+    }
+    #endif
     procAddr = reinterpret_cast<T>(glXGetProcAddress(reinterpret_cast<const GLubyte*>(procName)));
     #else
     LLGL_TRAP("platform not supported for loading OpenGL extensions");
@@ -59,6 +68,27 @@ static void ExtractExtensionsFromString(GLExtensionMap& extensions, const std::s
 
 #ifndef __APPLE__
 
+#ifdef LLGL_GL_ENABLE_PROC_PROFILER
+
+/* ~~~~~ Define profiling counters for all GL compatibility extension functions ~~~~~ */
+
+#define DECL_GLPROC(PFNTYPE, NAME, RTYPE, ARGS) \
+    LLGL_DECL_GLPROC_PROFILER(PFNTYPE, NAME)
+
+// Include inline header for profiling counter definitions
+#include "GLCompatExtensionsDecl.inl"
+
+#undef DECL_GLPROC
+
+#define PROFILE_GLPROC(NAME) \
+    LLGL_INSTALL_GLPROC_PROFILER(NAME)
+
+#else
+
+#define PROFILE_GLPROC(NAME)
+
+#endif // /LLGL_GL_ENABLE_PROC_PROFILER
+
 using LoadGLExtensionProc = std::function<bool(const char* extName, bool abortOnFailure, bool usePlaceholder)>;
 
 #define DECL_LOADGLEXT_PROC(EXTNAME) \
@@ -77,6 +107,10 @@ using LoadGLExtensionProc = std::function<bool(const char* extName, bool abortOn
         if (abortOnFailure)                                                         \
             LLGL_TRAP("failed to load OpenGL procedure: %s [%s]", #NAME, extName);  \
         return false;                                                               \
+    }                                                                               \
+    else                                                                            \
+    {                                                                               \
+        PROFILE_GLPROC(NAME);                                                       \
     }
 
 /* --- Common GL extensions --- */
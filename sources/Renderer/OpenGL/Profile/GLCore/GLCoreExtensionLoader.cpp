@@ -7,6 +7,7 @@
 
 #include "../../Ext/GLExtensionLoader.h"
 #include "../../Ext/GLExtensionRegistry.h"
+#include "../../Ext/GLProcProfiler.h"
 #include "../../../../Core/Exception.h"
 #include "GLCoreExtensions.h"
 #include <LLGL/Utils/ForRange.h>
@@ -34,6 +35,14 @@ bool LoadGLProc(T& procAddr, const char* procName)
     #if defined(_WIN32)
     procAddr = reinterpret_cast<T>(wglGetProcAddress(procName));
     #elif defined(__linux__)
+    #ifdef LLGL_GL_ENABLE_EGL_HEADLESS
+    /* Headless GL contexts are created with EGL and must not depend on GLX */
+    if (eglGetCurrentContext() != EGL_NO_CONTEXT)
+    {
+        procAddr = reinterpret_cast<T>(eglGetProcAddress(procName));
+        return (procAddr != nullptr);
+    }
+    #endif
     procAddr = reinterpret_cast<T>(glXGetProcAddress(reinterpret_cast<const GLubyte*>(procName)));
     #else
     LLGL_TRAP("platform not supported for loading OpenGL extensions");
@@ -59,6 +68,27 @@ static void ExtractExtensionsFromString(GLExtensionMap& extensions, const std::s
 
 #ifndef __APPLE__
 
+#ifdef LLGL_GL_ENABLE_PROC_PROFILER
+
+/* ~~~~~ Define profiling counters for all GL core extension functions ~~~~~ */
+
+#define DECL_GLPROC(PFNTYPE, NAME, RTYPE, ARGS) \
+    LLGL_DECL_GLPROC_PROFILER(PFNTYPE, NAME)
+
+// Include inline header for profiling counter definitions
+#include "GLCoreExtensionsDecl.inl"
+
+#undef DECL_GLPROC
+
+#define PROFILE_GLPROC(NAME) \
+    LLGL_INSTALL_GLPROC_PROFILER(NAME)
+
+#else
+
+#define PROFILE_GLPROC(NAME)
+
+#endif // /LLGL_GL_ENABLE_PROC_PROFILER
+
 using LoadGLExtensionProc = std::function<bool(const char* extName, bool abortOnFailure, bool usePlaceholder)>;
 
 #define DECL_LOADGLEXT_PROC(EXTNAME) \
@@ -77,6 +107,10 @@ using LoadGLExtensionProc = std::function<bool(const char* extName, bool abortOn
         if (abortOnFailure)                                                         \
             LLGL_TRAP("failed to load OpenGL procedure: %s [%s]", #NAME, extName);  \
         return false;                                                               \
+    }                                                                               \
+    else                                                                            \
+    {                                                                               \
+        PROFILE_GLPROC(NAME);                                                       \
     }
 
 /* --- Common GL extensions --- */
@@ -166,6 +200,16 @@ static bool DECL_LOADGLEXT_PROC(ARB_vertex_array_object)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(ARB_vertex_attrib_binding)
+{
+    LOAD_GLPROC( glBindVertexBuffer     );
+    LOAD_GLPROC( glVertexAttribFormat   );
+    LOAD_GLPROC( glVertexAttribIFormat  );
+    LOAD_GLPROC( glVertexAttribBinding  );
+    LOAD_GLPROC( glVertexBindingDivisor );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_vertex_shader)
 {
     LOAD_GLPROC( glEnableVertexAttribArray  );
@@ -618,6 +662,12 @@ static bool DECL_LOADGLEXT_PROC(KHR_debug)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(KHR_parallel_shader_compile)
+{
+    LOAD_GLPROC( glMaxShaderCompilerThreadsKHR );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_clip_control)
 {
     LOAD_GLPROC( glClipControl );
@@ -1150,6 +1200,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     LOAD_GLEXT( ARB_vertex_buffer_object         ); // Always required for GL 3+
     LOAD_GLEXT( ARB_vertex_array_object          ); // Always required for GL 3+
     LOAD_GLEXT( ARB_vertex_shader                ); // Always required for GL 3+
+    LOAD_GLEXT( ARB_vertex_attrib_binding        );
     LOAD_GLEXT( ARB_framebuffer_object           ); // Always required for GL 2.x & GL 3+
     LOAD_GLEXT( ARB_uniform_buffer_object        );
     LOAD_GLEXT( ARB_shader_storage_buffer_object );
@@ -1200,6 +1251,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     LOAD_GLEXT( ARB_multi_bind                   );
     LOAD_GLEXT( EXT_stencil_two_side             );
     LOAD_GLEXT( KHR_debug                        );
+    LOAD_GLEXT( KHR_parallel_shader_compile      );
     LOAD_GLEXT( ARB_clip_control                 );
     LOAD_GLEXT( ARB_draw_buffers                 );
     LOAD_GLEXT( EXT_draw_buffers2                );
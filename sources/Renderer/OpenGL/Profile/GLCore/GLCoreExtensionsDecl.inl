@@ -147,6 +147,14 @@ DECL_GLPROC(PFNGLBINDSAMPLERSPROC,                                  glBindSample
 DECL_GLPROC(PFNGLBINDIMAGETEXTURESPROC,                             glBindImageTextures,                            void,           (GLuint, GLsizei, const GLuint*));
 DECL_GLPROC(PFNGLBINDVERTEXBUFFERSPROC,                             glBindVertexBuffers,                            void,           (GLuint, GLsizei, const GLuint*, const GLintptr*, const GLsizei*));
 
+/* GL_ARB_vertex_attrib_binding */
+
+DECL_GLPROC(PFNGLBINDVERTEXBUFFERPROC,                              glBindVertexBuffer,                             void,           (GLuint, GLuint, GLintptr, GLsizei));
+DECL_GLPROC(PFNGLVERTEXATTRIBFORMATPROC,                            glVertexAttribFormat,                           void,           (GLuint, GLint, GLenum, GLboolean, GLuint));
+DECL_GLPROC(PFNGLVERTEXATTRIBIFORMATPROC,                           glVertexAttribIFormat,                          void,           (GLuint, GLint, GLenum, GLuint));
+DECL_GLPROC(PFNGLVERTEXATTRIBBINDINGPROC,                           glVertexAttribBinding,                          void,           (GLuint, GLuint));
+DECL_GLPROC(PFNGLVERTEXBINDINGDIVISORPROC,                          glVertexBindingDivisor,                         void,           (GLuint, GLuint));
+
 /* GL_ARB_vertex_buffer_object */
 
 DECL_GLPROC(PFNGLGENBUFFERSPROC,                                    glGenBuffers,                                   void,           (GLsizei, GLuint*));
@@ -460,6 +468,10 @@ DECL_GLPROC(PFNGLGETOBJECTLABELPROC,                                glGetObjectL
 DECL_GLPROC(PFNGLOBJECTPTRLABELPROC,                                glObjectPtrLabel,                               void,           (const void*, GLsizei, const GLchar*));
 DECL_GLPROC(PFNGLGETOBJECTPTRLABELPROC,                             glGetObjectPtrLabel,                            void,           (const void*, GLsizei, GLsizei*, GLchar*));
 
+/* GL_KHR_parallel_shader_compile */
+
+DECL_GLPROC(PFNGLMAXSHADERCOMPILERTHREADSKHRPROC,                   glMaxShaderCompilerThreadsKHR,                  void,           (GLuint));
+
 /* GL_ARB_clip_control */
 
 DECL_GLPROC(PFNGLCLIPCONTROLPROC,                                   glClipControl,                                  void,           (GLenum, GLenum));
@@ -22,7 +22,7 @@
 #   include <GL/glext.h>
 #   include <GL/glx.h>
 
-#   if LLGL_LINUX_ENABLE_WAYLAND
+#   if LLGL_LINUX_ENABLE_WAYLAND || defined LLGL_GL_ENABLE_EGL_HEADLESS
 #       include <EGL/egl.h>
 #       include <EGL/eglext.h>
 #   endif
@@ -7,6 +7,7 @@
 
 #include "../../Ext/GLExtensionLoader.h"
 #include "../../Ext/GLExtensionRegistry.h"
+#include "../../Ext/GLProcProfiler.h"
 #include "GLESExtensions.h"
 #include "OpenGLES.h"
 #include "../../GLCore.h"
@@ -39,6 +40,27 @@ bool LoadGLProc(T& procAddr, const char* procName)
 }
 
 
+#ifdef LLGL_GL_ENABLE_PROC_PROFILER
+
+/* ~~~~~ Define profiling counters for all GLES extension functions ~~~~~ */
+
+#define DECL_GLPROC(PFNTYPE, NAME, RTYPE, ARGS) \
+    LLGL_DECL_GLPROC_PROFILER(PFNTYPE, NAME)
+
+// Include inline header for profiling counter definitions
+#include "GLESExtensionsDecl.inl"
+
+#undef DECL_GLPROC
+
+#define PROFILE_GLPROC(NAME) \
+    LLGL_INSTALL_GLPROC_PROFILER(NAME)
+
+#else
+
+#define PROFILE_GLPROC(NAME)
+
+#endif // /LLGL_GL_ENABLE_PROC_PROFILER
+
 using LoadGLExtensionProc = std::function<bool(const char* versionStr, bool abortOnFailure)>;
 
 #define DECL_LOADGLEXT_PROC(EXTNAME) \
@@ -53,6 +75,10 @@ using LoadGLExtensionProc = std::function<bool(const char* versionStr, bool abor
         if (abortOnFailure)                                                             \
             LLGL_TRAP("failed to load OpenGLES procedure: %s [%s]", #NAME, versionStr); \
         return false;                                                                   \
+    }                                                                                   \
+    else                                                                                \
+    {                                                                                   \
+        PROFILE_GLPROC(NAME);                                                           \
     }
 
 /* --- Common GLES extensions --- */
@@ -305,6 +331,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
         ENABLE_GLEXT(ARB_program_interface_query);
         ENABLE_GLEXT(ARB_compute_shader);
         ENABLE_GLEXT(ARB_framebuffer_no_attachments);
+        ENABLE_GLEXT(ARB_vertex_attrib_binding);
     }
 
     if (version >= 320)
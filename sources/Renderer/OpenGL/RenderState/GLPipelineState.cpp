@@ -37,16 +37,8 @@ GLPipelineState::GLPipelineState(
         const GLShader::Permutation permutation = static_cast<GLShader::Permutation>(permutationIndex);
         if (GLShader::HasAnyShaderPermutation(permutation, shaders))
         {
-            /* Create shader pipeline for current permutation */
+            /* Create shader pipeline for current permutation; Link status is queried in FinalizeLink() */
             shaderPipelines_[permutation] = GLStatePool::Get().CreateShaderPipeline(shaders.size(), shaders.data(), permutation, pipelineCacheGL);
-
-            /* Query information log and stop linking shader pipelines if the default permutation has errors */
-            if (permutation == GLShader::PermutationDefault)
-            {
-                shaderPipelines_[GLShader::PermutationDefault]->QueryInfoLogs(report_);
-                if (report_.HasErrors())
-                    break;
-            }
         }
     }
 
@@ -58,28 +50,13 @@ GLPipelineState::GLPipelineState(
         if (pipelineLayout_->HasNamedBindings())
         {
             shaderBindingLayout_ = GLStatePool::Get().CreateShaderBindingLayout(*pipelineLayout_);
-            if (shaderBindingLayout_->HasBindings())
-            {
-                if (shaderBindingLayout_->HasShaderStorageBindings())
-                {
-                    /* Build map to distinguish resources between SSBOs, sampler buffers, and image buffers */
-                    bufferInterfaceMap_.BuildMap(*pipelineLayout_, *GetShaderPipeline());
-                }
-            }
-            else
+            if (!shaderBindingLayout_->HasBindings())
             {
                 /* If no bindings were created after all, release the binding layout immediately */
                 GLStatePool::Get().ReleaseShaderBindingLayout(std::move(shaderBindingLayout_));
             }
         }
 
-        /* Build uniform table */
-        for_range(permutationIndex, GLShader::PermutationCount)
-        {
-            const GLShader::Permutation permutation = static_cast<GLShader::Permutation>(permutationIndex);
-            BuildUniformMap(permutation, pipelineLayout_->GetUniforms());
-        }
-
         /* Cache barriers bitfield */
         barriers_ = pipelineLayout_->GetBarriersBitfield();
     }
@@ -94,11 +71,62 @@ GLPipelineState::~GLPipelineState()
 
 const Report* GLPipelineState::GetReport() const
 {
+    FinalizeLink();
     return (report_ ? &report_ : nullptr);
 }
 
+void GLPipelineState::FinalizeLink() const
+{
+    if (!isLinkPending_)
+        return;
+
+    isLinkPending_ = false;
+
+    /* Query information log of default permutation and keep errors that were reported during PSO creation */
+    if (const GLShaderPipeline* shaderPipeline = GetShaderPipeline())
+    {
+        Report linkReport;
+        shaderPipelines_[GLShader::PermutationDefault]->QueryInfoLogs(linkReport);
+        if (linkReport)
+        {
+            if (report_.HasErrors())
+                linkReport.Errorf("%s", report_.GetText());
+            else if (report_)
+                linkReport.Printf("%s", report_.GetText());
+            report_ = std::move(linkReport);
+        }
+
+        if (pipelineLayout_ != nullptr)
+        {
+            /* Build map to distinguish resources between SSBOs, sampler buffers, and image buffers */
+            if (shaderBindingLayout_ && shaderBindingLayout_->HasShaderStorageBindings())
+                bufferInterfaceMap_.BuildMap(*pipelineLayout_, *shaderPipeline);
+
+            /* Build uniform table */
+            for_range(permutationIndex, GLShader::PermutationCount)
+            {
+                const GLShader::Permutation permutation = static_cast<GLShader::Permutation>(permutationIndex);
+                BuildUniformMap(permutation, pipelineLayout_->GetUniforms());
+            }
+        }
+    }
+}
+
+bool GLPipelineState::IsLinkComplete() const
+{
+    for (const GLShaderPipelineSPtr& shaderPipeline : shaderPipelines_)
+    {
+        if (shaderPipeline && !shaderPipeline->IsLinkComplete())
+            return false;
+    }
+    return true;
+}
+
 void GLPipelineState::Bind(GLStateManager& stateMngr)
 {
+    /* Finalize linking before the shader pipeline is used for the first time */
+    FinalizeLink();
+
     /* Select shader pipeline permutation depending on what is needed for the current framebuffer */
     const GLShader::Permutation shaderPipelinePermutation =
     (
@@ -127,7 +155,7 @@ void GLPipelineState::Bind(GLStateManager& stateMngr)
  */
 
 //TODO: support separate shaders; each separable shader needs its own set of uniform locations
-void GLPipelineState::BuildUniformMap(GLShader::Permutation permutation, const std::vector<UniformDescriptor>& uniforms)
+void GLPipelineState::BuildUniformMap(GLShader::Permutation permutation, const std::vector<UniformDescriptor>& uniforms) const
 {
     if (shaderPipelines_[permutation].get() != nullptr && !uniforms.empty())
     {
@@ -159,7 +187,7 @@ static std::string GetActiveUniformNameAsIdent(const GLchar* uniformName)
     return ident;
 }
 
-void GLPipelineState::BuildNameToActiveUniformMap(GLuint program, GLNameToUniformMap& outNameToUniformMap)
+void GLPipelineState::BuildNameToActiveUniformMap(GLuint program, GLNameToUniformMap& outNameToUniformMap) const
 {
     /* Determine number of active GL uniforms */
     GLint numActiveUniforms = 0;
@@ -250,7 +278,7 @@ void GLPipelineState::BuildUniformLocation(
     GLuint                      program,
     GLUniformLocation&          outUniform,
     const UniformDescriptor&    inUniform,
-    const GLNameToUniformMap&   nameToUniformMap)
+    const GLNameToUniformMap&   nameToUniformMap) const
 {
     /* Initialize output with invalid uniform location */
     outUniform.type     = UniformType::Undefined;
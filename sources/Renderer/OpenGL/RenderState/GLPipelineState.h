@@ -59,6 +59,16 @@ class GLPipelineState : public PipelineState
         // Binds this pipeline state with the specified GL state manager.
         virtual void Bind(GLStateManager& stateMngr);
 
+        /*
+        Queries the link status and builds all reflection dependent state, i.e. the uniform and buffer interface maps.
+        This is deferred from the constructor until the PSO is used or its report is requested for the first time,
+        so the driver can link multiple PSOs concurrently (see GL_KHR_parallel_shader_compile). Does nothing if the PSO is already finalized.
+        */
+        void FinalizeLink() const;
+
+        // Returns true if the driver has finished linking all shader pipelines of this PSO, i.e. FinalizeLink() will not stall.
+        bool IsLinkComplete() const;
+
         // Returns true if this is a graphics PSO.
         inline bool IsGraphicsPSO() const
         {
@@ -117,10 +127,10 @@ class GLPipelineState : public PipelineState
     private:
 
         // Builds the index-to-uniform map.
-        void BuildUniformMap(GLShader::Permutation permutation, const std::vector<UniformDescriptor>& uniforms);
+        void BuildUniformMap(GLShader::Permutation permutation, const std::vector<UniformDescriptor>& uniforms) const;
 
         // Builds the container that maps a name to the index of its active GL uniform.
-        void BuildNameToActiveUniformMap(GLuint program, GLNameToUniformMap& outNameToUniformMap);
+        void BuildNameToActiveUniformMap(GLuint program, GLNameToUniformMap& outNameToUniformMap) const;
 
         // Builds the specified uniform location.
         void BuildUniformLocation(
@@ -128,7 +138,7 @@ class GLPipelineState : public PipelineState
             GLUniformLocation&          outUniform,
             const UniformDescriptor&    inUniform,
             const GLNameToUniformMap&   nameToUniformMap
-        );
+        ) const;
 
     private:
 
@@ -137,9 +147,12 @@ class GLPipelineState : public PipelineState
         const GLPipelineLayout*         pipelineLayout_                                 = nullptr;
         GLShaderPipelineSPtr            shaderPipelines_[GLShader::PermutationCount];
         GLShaderBindingLayoutSPtr       shaderBindingLayout_;
-        GLShaderBufferInterfaceMap      bufferInterfaceMap_;
-        std::vector<GLUniformLocation>  uniformMap_;
-        Report                          report_;
+
+        /* Members below are built lazily in FinalizeLink() */
+        mutable GLShaderBufferInterfaceMap      bufferInterfaceMap_;
+        mutable std::vector<GLUniformLocation>  uniformMap_;
+        mutable Report                          report_;
+        mutable bool                            isLinkPending_  = true;
 
 };
 
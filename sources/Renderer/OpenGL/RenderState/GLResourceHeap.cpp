@@ -188,6 +188,38 @@ GLResourceHeap::~GLResourceHeap()
 }
 
 std::uint32_t GLResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews)
+{
+    if (updateBatch_.IsActive())
+        return updateBatch_.Record(firstDescriptor, resourceViews, GetNumDescriptorSets() * numInputBindings_);
+    else
+        return WriteResourceViewsImmediate(firstDescriptor, resourceViews);
+}
+
+void GLResourceHeap::BeginUpdate()
+{
+    updateBatch_.Begin();
+}
+
+std::uint32_t GLResourceHeap::CommitUpdate()
+{
+    std::vector<ResourceHeapUpdateBatch::Range> ranges;
+    std::vector<ResourceViewDescriptor> resourceViews;
+    updateBatch_.Resolve(ranges, resourceViews);
+
+    /* Write contiguous ranges in ascending order, so the heap segments are traversed only once */
+    std::uint32_t numWritten = 0;
+    const ResourceViewDescriptor* resourceViewsPtr = resourceViews.data();
+
+    for (const ResourceHeapUpdateBatch::Range& range : ranges)
+    {
+        numWritten += WriteResourceViewsImmediate(range.firstDescriptor, ArrayView<ResourceViewDescriptor>{ resourceViewsPtr, range.numDescriptors });
+        resourceViewsPtr += range.numDescriptors;
+    }
+
+    return numWritten;
+}
+
+std::uint32_t GLResourceHeap::WriteResourceViewsImmediate(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews)
 {
     /* Quit if there's nothing to do */
     if (resourceViews.empty())
@@ -16,6 +16,7 @@
 #include <LLGL/Container/SmallVector.h>
 #include "../../BindingIterator.h"
 #include "../../SegmentedBuffer.h"
+#include "../../ResourceHeapUpdateBatch.h"
 #include "../OpenGL.h"
 #include <functional>
 
@@ -52,6 +53,12 @@ class GLResourceHeap final : public ResourceHeap
         // Writes the specified resource views to this resource heap and generates texture views as required.
         std::uint32_t WriteResourceViews(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews);
 
+        // Starts recording all writes into this resource heap until CommitUpdate is called.
+        void BeginUpdate();
+
+        // Writes all recorded resource views into the heap segments in a single pass and returns the number of updated descriptors.
+        std::uint32_t CommitUpdate();
+
         // Binds this resource heap with the specified GL state manager.
         void Bind(GLStateManager& stateMngr, std::uint32_t descriptorSet, const GLShaderBufferInterfaceMap* bufferInterfaceMap = nullptr);
 
@@ -90,6 +97,8 @@ class GLResourceHeap final : public ResourceHeap
 
     private:
 
+        std::uint32_t WriteResourceViewsImmediate(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews);
+
         void AllocTextureView(GLuint& texViewID, GLuint sourceTexID, const TextureViewDescriptor& textureViewDesc);
         bool FreeTextureView(GLuint& texViewID);
         void FreeAllSegmentSetTextureViews(const char* heapPtr);
@@ -169,6 +178,7 @@ class GLResourceHeap final : public ResourceHeap
         std::uint32_t                       numInputBindings_ = 0;  // Number of bindings written explicitly to a heap segment.
         BufferSegmentation                  segmentation_;
         SegmentedBuffer                     heap_;                  // Buffer with resource binding information and stride (in bytes) per descriptor set
+        ResourceHeapUpdateBatch             updateBatch_;           // Writes recorded between BeginUpdate and CommitUpdate
 
 };
 
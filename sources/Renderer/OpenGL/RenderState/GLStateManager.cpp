@@ -286,6 +286,11 @@ void GLStateManager::DetermineExtensionsAndLimits()
     #ifdef LLGL_GL_ENABLE_VENDOR_EXT
     DetermineVendorSpecificExtensions();
     #endif
+
+    #if LLGL_GLEXT_MULTI_BIND
+    /* Defer resource bindings until the next draw or compute command, so they can be flushed with a single call per contiguous range */
+    deferBindings_ = HasExtension(GLExt::ARB_multi_bind);
+    #endif // /LLGL_GLEXT_MULTI_BIND
 }
 
 void GLStateManager::ResetFramebufferHeight(GLint height)
@@ -326,6 +331,13 @@ void GLStateManager::ClearCache()
     boundRasterizerState_       = nullptr;
     boundBlendState_            = nullptr;
     frontFacingDirtyBit_        = false;
+
+    /* Indexed buffer bindings are not part of the queried context state, so they must be bound again */
+    for (auto& boundBuffers : boundIndexedBuffers_)
+    {
+        for (IndexedBufferBinding& boundBuffer : boundBuffers)
+            boundBuffer.buffer = k_invalidGLID;
+    }
 }
 
 void GLStateManager::Set(GLState state, bool value)
@@ -882,6 +894,17 @@ GLenum GLStateManager::ToGLBufferTarget(GLBufferTarget target)
     return g_bufferTargetsEnum[targetIdx];
 }
 
+// Returns the index into the deferred buffer bindings for the specified target, or -1 if bindings of this target are not deferred.
+static int GetDeferredBufferTargetIndex(GLBufferTarget target)
+{
+    switch (target)
+    {
+        case GLBufferTarget::UniformBuffer:         return 0;
+        case GLBufferTarget::ShaderStorageBuffer:   return 1;
+        default:                                    return -1;
+    }
+}
+
 void GLStateManager::BindBuffer(GLBufferTarget target, GLuint buffer)
 {
     /* Only bind buffer if the buffer has changed */
@@ -895,6 +918,14 @@ void GLStateManager::BindBuffer(GLBufferTarget target, GLuint buffer)
 
 void GLStateManager::BindBufferBase(GLBufferTarget target, GLuint index, GLuint buffer)
 {
+    /* Record binding into dirty range to be flushed before the next draw or compute command */
+    const int deferredTargetIdx = GetDeferredBufferTargetIndex(target);
+    if (deferBindings_ && deferredTargetIdx >= 0 && index < g_maxNumResourceSlots)
+    {
+        DeferBufferBinding(static_cast<std::size_t>(deferredTargetIdx), index, buffer, 0, 0);
+        return;
+    }
+
     #if LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
     /* Always bind buffer with a base index */
     auto targetIdx = static_cast<std::size_t>(target);
@@ -907,6 +938,15 @@ void GLStateManager::BindBufferBase(GLBufferTarget target, GLuint index, GLuint
 
 void GLStateManager::BindBuffersBase(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers)
 {
+    /* Record bindings into dirty range to be flushed before the next draw or compute command */
+    const int deferredTargetIdx = GetDeferredBufferTargetIndex(target);
+    if (deferBindings_ && deferredTargetIdx >= 0 && first + static_cast<GLuint>(count) <= g_maxNumResourceSlots)
+    {
+        for_range(i, count)
+            DeferBufferBinding(static_cast<std::size_t>(deferredTargetIdx), first + static_cast<GLuint>(i), buffers[i], 0, 0);
+        return;
+    }
+
     /* Always bind buffers with a base index */
     auto targetIdx = static_cast<std::size_t>(target);
     auto targetGL = g_bufferTargetsEnum[targetIdx];
@@ -938,6 +978,14 @@ void GLStateManager::BindBuffersBase(GLBufferTarget target, GLuint first, GLsize
 
 void GLStateManager::BindBufferRange(GLBufferTarget target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
 {
+    /* Record binding into dirty range to be flushed before the next draw or compute command */
+    const int deferredTargetIdx = GetDeferredBufferTargetIndex(target);
+    if (deferBindings_ && deferredTargetIdx >= 0 && index < g_maxNumResourceSlots)
+    {
+        DeferBufferBinding(static_cast<std::size_t>(deferredTargetIdx), index, buffer, offset, size);
+        return;
+    }
+
     #if GL_EXT_transform_feedback && !LLGL_GL_ENABLE_OPENGL2X
     /* Always bind buffer with a base index */
     auto targetIdx = static_cast<std::size_t>(target);
@@ -950,6 +998,15 @@ void GLStateManager::BindBufferRange(GLBufferTarget target, GLuint index, GLuint
 
 void GLStateManager::BindBuffersRange(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizeiptr* sizes)
 {
+    /* Record bindings into dirty range to be flushed before the next draw or compute command */
+    const int deferredTargetIdx = GetDeferredBufferTargetIndex(target);
+    if (deferBindings_ && deferredTargetIdx >= 0 && first + static_cast<GLuint>(count) <= g_maxNumResourceSlots)
+    {
+        for_range(i, count)
+            DeferBufferBinding(static_cast<std::size_t>(deferredTargetIdx), first + static_cast<GLuint>(i), buffers[i], offsets[i], sizes[i]);
+        return;
+    }
+
     /* Always bind buffers with a base index */
     auto targetIdx = static_cast<std::size_t>(target);
     auto targetGL = g_bufferTargetsEnum[targetIdx];
@@ -1128,6 +1185,18 @@ void GLStateManager::NotifyBufferRelease(GLuint buffer, GLBufferTarget target)
 {
     auto targetIdx = static_cast<std::size_t>(target);
     InvalidateBoundGLObject(contextState_.boundBuffers[targetIdx], buffer);
+
+    /* Invalidate indexed bindings and don't flush deferred bindings of the released buffer */
+    const int deferredTargetIdx = GetDeferredBufferTargetIndex(target);
+    if (deferredTargetIdx >= 0)
+    {
+        for_range(i, g_maxNumResourceSlots)
+        {
+            InvalidateBoundGLObject(boundIndexedBuffers_[deferredTargetIdx][i].buffer, buffer);
+            if (deferredBuffers_[deferredTargetIdx][i].buffer == buffer)
+                deferredBuffers_[deferredTargetIdx][i] = IndexedBufferBinding{ 0, 0, 0 };
+        }
+    }
 }
 
 void GLStateManager::NotifyBufferRelease(const GLBuffer& buffer)
@@ -1343,62 +1412,41 @@ void GLStateManager::BindTexture(GLuint layer, GLTextureTarget target, GLuint te
     LLGL_ASSERT_UPPER_BOUND(layer, GLContextState::numTextureLayers);
     #endif
 
-    /* Only bind texutre if the texture has changed */
-    auto targetIdx = static_cast<std::size_t>(target);
-    GLContextState::TextureLayer& textureLayer = contextState_.textureLayers[layer];
-    if (textureLayer.boundTextures[targetIdx] != texture)
-    {
-        textureLayer.boundTextures[targetIdx] = texture;
-
-        /* Activate specified texture layer and store reference to bound textures array */
-        if (contextState_.activeTexture != layer)
-        {
-            contextState_.activeTexture = layer;
-            glActiveTexture(g_textureLayersEnum[layer]);
-        }
-
-        /* Bind native GL texture to active layer */
-        glBindTexture(g_textureTargetsEnum[targetIdx], texture);
-    }
+    if (deferBindings_)
+        DeferTextureBinding(layer, target, texture);
+    else
+        BindTextureLayer(layer, target, texture);
 }
 
 void GLStateManager::BindTextures(GLuint first, GLsizei count, const GLTextureTarget* targets, const GLuint* textures)
 {
-    #if LLGL_GLEXT_MULTI_BIND
-    if (HasExtension(GLExt::ARB_multi_bind))
+    if (deferBindings_)
     {
-        /* Store bound textures */
+        /* Record bindings into dirty range; they are bound all at once with glBindTextures() before the next draw or compute command */
         for_range(i, count)
-        {
-            auto targetIdx = static_cast<std::size_t>(targets[i]);
-            contextState_.textureLayers[i + first].boundTextures[targetIdx] = textures[i];
-        }
-
-        /*
-        Bind all textures at once, but don't reset the currently active texture layer.
-        The spec. of GL_ARB_multi_bind states that the active texture slot is not modified by this function.
-        see https://www.khronos.org/registry/OpenGL/extensions/ARB/ARB_multi_bind.txt
-        */
-        glBindTextures(first, count, textures);
+            DeferTextureBinding(first + i, targets[i], textures[i]);
     }
     else
-    #endif // /LLGL_GLEXT_MULTI_BIND
     {
         /* Bind each texture layer individually */
         for_range(i, count)
-            BindTexture(first + i, targets[i], textures[i]);
+            BindTextureLayer(first + i, targets[i], textures[i]);
     }
 }
 
 void GLStateManager::UnbindTextures(GLuint first, GLsizei count)
 {
+    /* Discard deferred bindings that would otherwise overwrite the unbound layers */
+    for_range(i, count)
+        dirtyTextureLayers_ &= ~(1u << (first + i));
+
     #if LLGL_GLEXT_MULTI_BIND
     if (HasExtension(GLExt::ARB_multi_bind))
     {
         /* Reset bound textures */
         for_range(i, count)
         {
-            auto& boundTextures = contextState_.textureLayers[i].boundTextures;
+            auto& boundTextures = contextState_.textureLayers[first + i].boundTextures;
             ::memset(boundTextures, 0, sizeof(boundTextures));
         }
 
@@ -1416,7 +1464,7 @@ void GLStateManager::UnbindTextures(GLuint first, GLsizei count)
         for_range(i, count)
         {
             for_range(target, GLContextState::numTextureTargets)
-                BindTexture(first + i, static_cast<GLTextureTarget>(target), 0);
+                BindTextureLayer(first + i, static_cast<GLTextureTarget>(target), 0);
         }
     }
 }
@@ -1502,7 +1550,7 @@ void GLStateManager::PopBoundTexture()
     const auto& state = textureState_.top();
     {
         if (state.texture != k_invalidGLID)
-            BindTexture(state.layer, state.target, state.texture);
+            BindTextureLayer(state.layer, state.target, state.texture);
     }
     textureState_.pop();
 }
@@ -1560,7 +1608,9 @@ void GLStateManager::BindSampler(GLuint layer, GLuint sampler)
     LLGL_ASSERT_UPPER_BOUND(layer, GLContextState::numTextureLayers);
     #endif
 
-    if (contextState_.boundSamplers[layer] != sampler)
+    if (deferBindings_)
+        DeferSamplerBinding(layer, sampler);
+    else if (contextState_.boundSamplers[layer] != sampler)
     {
         contextState_.boundSamplers[layer] = sampler;
         glBindSampler(layer, sampler);
@@ -1569,18 +1619,13 @@ void GLStateManager::BindSampler(GLuint layer, GLuint sampler)
 
 void GLStateManager::BindSamplers(GLuint first, GLsizei count, const GLuint* samplers)
 {
-    #if LLGL_GLEXT_MULTI_BIND
-    if (count >= 2 && HasExtension(GLExt::ARB_multi_bind))
+    if (deferBindings_)
     {
-        /* Store bound samplers */
+        /* Record bindings into dirty range; they are bound all at once with glBindSamplers() before the next draw or compute command */
         for_range(i, count)
-            contextState_.boundSamplers[i + first] = samplers[i];
-
-        /* Bind all samplers at once */
-        glBindSamplers(first, count, samplers);
+            DeferSamplerBinding(first + static_cast<GLuint>(i), samplers[i]);
     }
     else
-    #endif // /LLGL_GLEXT_MULTI_BIND
     {
         /* Bind each sampler individually */
         for_range(i, count)
@@ -1592,6 +1637,13 @@ void GLStateManager::NotifySamplerRelease(GLuint sampler)
 {
     for (GLuint& boundSampler : contextState_.boundSamplers)
         InvalidateBoundGLObject(boundSampler, sampler);
+
+    /* Don't flush deferred bindings of the released sampler */
+    for (GLuint& deferredSampler : deferredSamplers_)
+    {
+        if (deferredSampler == sampler)
+            deferredSampler = 0;
+    }
 }
 
 #else // LLGL_GLEXT_SAMPLER_OBJECTS
@@ -1648,6 +1700,21 @@ void GLStateManager::BindCombinedEmulatedSampler(GLuint layer, const GLEmulatedS
     BindTexture(layer, GLStateManager::GetTextureTarget(texture.GetType()), texture.GetID());
 }
 
+/* ----- Deferred bindings ----- */
+
+void GLStateManager::FlushDeferredBindings()
+{
+    if (dirtyTextureLayers_ != 0)
+        FlushDeferredTextures();
+    if (dirtySamplerLayers_ != 0)
+        FlushDeferredSamplers();
+    for_range(i, numDeferredBufferTargets)
+    {
+        if (dirtyBufferSlots_[i] != 0)
+            FlushDeferredBuffers(i);
+    }
+}
+
 /* ----- Shader program ----- */
 
 void GLStateManager::BindShaderProgram(GLuint program)
@@ -1899,6 +1966,217 @@ void GLStateManager::NotifyTextureRelease(GLuint texture, GLTextureTarget target
         for (GLContextState::TextureLayer& layer : contextState_.textureLayers)
             InvalidateBoundGLObject(layer.boundTextures[targetIdx], texture);
     }
+
+    /* Don't flush deferred bindings of the released texture */
+    for (DeferredTextureBinding& deferredTexture : deferredTextures_)
+    {
+        if (deferredTexture.texture == texture)
+            deferredTexture.texture = 0;
+    }
+}
+
+void GLStateManager::BindTextureLayer(GLuint layer, GLTextureTarget target, GLuint texture)
+{
+    #ifdef LLGL_DEBUG
+    LLGL_ASSERT_UPPER_BOUND(layer, GLContextState::numTextureLayers);
+    #endif
+
+    /* Only bind texutre if the texture has changed */
+    auto targetIdx = static_cast<std::size_t>(target);
+    GLContextState::TextureLayer& textureLayer = contextState_.textureLayers[layer];
+    if (textureLayer.boundTextures[targetIdx] != texture)
+    {
+        textureLayer.boundTextures[targetIdx] = texture;
+
+        /* Activate specified texture layer and store reference to bound textures array */
+        if (contextState_.activeTexture != layer)
+        {
+            contextState_.activeTexture = layer;
+            glActiveTexture(g_textureLayersEnum[layer]);
+        }
+
+        /* Bind native GL texture to active layer */
+        glBindTexture(g_textureTargetsEnum[targetIdx], texture);
+    }
+}
+
+/* ----- Deferred bindings ----- */
+
+void GLStateManager::DeferTextureBinding(GLuint layer, GLTextureTarget target, GLuint texture)
+{
+    const std::uint32_t layerBit = (1u << layer);
+    if ((dirtyTextureLayers_ & layerBit) == 0)
+    {
+        /* Ignore redundant binding */
+        auto targetIdx = static_cast<std::size_t>(target);
+        if (contextState_.textureLayers[layer].boundTextures[targetIdx] == texture)
+            return;
+        dirtyTextureLayers_ |= layerBit;
+    }
+
+    /* Only the last binding per layer is flushed, since a texture layer can only be accessed with a single target */
+    deferredTextures_[layer] = DeferredTextureBinding{ target, texture };
+}
+
+void GLStateManager::DeferSamplerBinding(GLuint layer, GLuint sampler)
+{
+    const std::uint32_t layerBit = (1u << layer);
+    if ((dirtySamplerLayers_ & layerBit) == 0)
+    {
+        /* Ignore redundant binding */
+        if (contextState_.boundSamplers[layer] == sampler)
+            return;
+        dirtySamplerLayers_ |= layerBit;
+    }
+    deferredSamplers_[layer] = sampler;
+}
+
+void GLStateManager::DeferBufferBinding(std::size_t deferredTargetIdx, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    const std::uint64_t slotBit = (std::uint64_t(1) << index);
+    if ((dirtyBufferSlots_[deferredTargetIdx] & slotBit) == 0)
+    {
+        /* Ignore redundant binding */
+        const IndexedBufferBinding& bound = boundIndexedBuffers_[deferredTargetIdx][index];
+        if (bound.buffer == buffer && bound.offset == offset && bound.size == size)
+            return;
+        dirtyBufferSlots_[deferredTargetIdx] |= slotBit;
+    }
+    deferredBuffers_[deferredTargetIdx][index] = IndexedBufferBinding{ buffer, offset, size };
+}
+
+void GLStateManager::FlushDeferredTextures()
+{
+    #if LLGL_GLEXT_MULTI_BIND
+
+    const std::uint32_t dirtyLayers = dirtyTextureLayers_;
+    dirtyTextureLayers_ = 0;
+
+    /* Bind each contiguous range of changed texture layers with a single call; the extra iteration flushes the last range */
+    GLuint  textures[GLContextState::numTextureLayers];
+    GLsizei count = 0;
+
+    for (GLuint layer = 0; layer <= GLContextState::numTextureLayers; ++layer)
+    {
+        if (layer < GLContextState::numTextureLayers && (dirtyLayers & (1u << layer)) != 0)
+        {
+            const DeferredTextureBinding& deferredTexture = deferredTextures_[layer];
+            GLuint (&boundTextures)[GLContextState::numTextureTargets] = contextState_.textureLayers[layer].boundTextures;
+            auto targetIdx = static_cast<std::size_t>(deferredTexture.target);
+
+            if (boundTextures[targetIdx] != deferredTexture.texture)
+            {
+                /* Binding texture 0 with glBindTextures() unbinds all targets of that texture layer */
+                if (deferredTexture.texture == 0)
+                    ::memset(boundTextures, 0, sizeof(boundTextures));
+                else
+                    boundTextures[targetIdx] = deferredTexture.texture;
+
+                textures[count++] = deferredTexture.texture;
+                continue;
+            }
+        }
+
+        if (count > 0)
+        {
+            glBindTextures(layer - static_cast<GLuint>(count), count, textures);
+            count = 0;
+        }
+    }
+
+    #endif // /LLGL_GLEXT_MULTI_BIND
+}
+
+void GLStateManager::FlushDeferredSamplers()
+{
+    #if LLGL_GLEXT_MULTI_BIND
+
+    const std::uint32_t dirtyLayers = dirtySamplerLayers_;
+    dirtySamplerLayers_ = 0;
+
+    /* Bind each contiguous range of changed sampler layers with a single call; the extra iteration flushes the last range */
+    GLuint  samplers[GLContextState::numTextureLayers];
+    GLsizei count = 0;
+
+    for (GLuint layer = 0; layer <= GLContextState::numTextureLayers; ++layer)
+    {
+        if (layer < GLContextState::numTextureLayers && (dirtyLayers & (1u << layer)) != 0)
+        {
+            if (contextState_.boundSamplers[layer] != deferredSamplers_[layer])
+            {
+                contextState_.boundSamplers[layer] = deferredSamplers_[layer];
+                samplers[count++] = deferredSamplers_[layer];
+                continue;
+            }
+        }
+
+        if (count > 0)
+        {
+            glBindSamplers(layer - static_cast<GLuint>(count), count, samplers);
+            count = 0;
+        }
+    }
+
+    #endif // /LLGL_GLEXT_MULTI_BIND
+}
+
+void GLStateManager::FlushDeferredBuffers(std::size_t deferredTargetIdx)
+{
+    #if LLGL_GLEXT_MULTI_BIND
+
+    const GLenum        targetGL    = (deferredTargetIdx == 0 ? GL_UNIFORM_BUFFER : GL_SHADER_STORAGE_BUFFER);
+    const std::uint64_t dirtySlots  = dirtyBufferSlots_[deferredTargetIdx];
+    dirtyBufferSlots_[deferredTargetIdx] = 0;
+
+    /*
+    Bind each contiguous range of changed buffer slots with a single call; the extra iteration flushes the last range.
+    Ranges are split between base and range bindings, since glBindBuffersRange() requires a size for each buffer.
+    */
+    GLuint      buffers[g_maxNumResourceSlots];
+    GLintptr    offsets[g_maxNumResourceSlots];
+    GLsizeiptr  sizes[g_maxNumResourceSlots];
+    GLsizei     count       = 0;
+    bool        isRangeRun  = false;
+
+    auto FlushRange = [&](GLuint end)
+    {
+        if (count > 0)
+        {
+            const GLuint first = end - static_cast<GLuint>(count);
+            if (isRangeRun)
+                glBindBuffersRange(targetGL, first, count, buffers, offsets, sizes);
+            else
+                glBindBuffersBase(targetGL, first, count, buffers);
+            count = 0;
+        }
+    };
+
+    for (GLuint slot = 0; slot <= g_maxNumResourceSlots; ++slot)
+    {
+        if (slot < g_maxNumResourceSlots && (dirtySlots & (std::uint64_t(1) << slot)) != 0)
+        {
+            const IndexedBufferBinding& deferredBuffer = deferredBuffers_[deferredTargetIdx][slot];
+            IndexedBufferBinding& boundBuffer = boundIndexedBuffers_[deferredTargetIdx][slot];
+
+            if (boundBuffer.buffer != deferredBuffer.buffer || boundBuffer.offset != deferredBuffer.offset || boundBuffer.size != deferredBuffer.size)
+            {
+                const bool isRange = (deferredBuffer.size > 0);
+                if (count > 0 && isRange != isRangeRun)
+                    FlushRange(slot);
+
+                boundBuffer         = deferredBuffer;
+                isRangeRun          = isRange;
+                buffers[count]      = deferredBuffer.buffer;
+                offsets[count]      = deferredBuffer.offset;
+                sizes[count]        = deferredBuffer.size;
+                ++count;
+                continue;
+            }
+        }
+        FlushRange(slot);
+    }
+
+    #endif // /LLGL_GLEXT_MULTI_BIND
 }
 
 void GLStateManager::SetFrontFaceInternal(GLenum mode)
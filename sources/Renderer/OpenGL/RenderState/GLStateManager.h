@@ -255,6 +255,15 @@ class GLStateManager
         void BindEmulatedSampler(GLuint layer, const GLEmulatedSampler& sampler);
         void BindCombinedEmulatedSampler(GLuint layer, const GLEmulatedSampler& sampler, GLTexture& texture);
 
+        /* ----- Deferred bindings ----- */
+
+        /*
+        Flushes all texture, sampler, and indexed uniform/storage buffer bindings that have been deferred since the last call.
+        If GL_ARB_multi_bind is supported, these bindings are only recorded into dirty ranges when they are set,
+        so this must be called before any draw or compute command. Otherwise, this function has no effect.
+        */
+        void FlushDeferredBindings();
+
         /* ----- Shader program ----- */
 
         void BindShaderProgram(GLuint program);
@@ -331,6 +340,19 @@ class GLStateManager
         GLContextState::TextureLayer* GetActiveTextureLayer();
         void NotifyTextureRelease(GLuint texture, GLTextureTarget target, bool invalidateActiveLayerOnly);
 
+        // Binds the texture to the specified layer immediately, i.e. without deferring the binding.
+        void BindTextureLayer(GLuint layer, GLTextureTarget target, GLuint texture);
+
+        /* ----- Deferred bindings ----- */
+
+        void DeferTextureBinding(GLuint layer, GLTextureTarget target, GLuint texture);
+        void DeferSamplerBinding(GLuint layer, GLuint sampler);
+        void DeferBufferBinding(std::size_t deferredTargetIdx, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+
+        void FlushDeferredTextures();
+        void FlushDeferredSamplers();
+        void FlushDeferredBuffers(std::size_t deferredTargetIdx);
+
         void SetFrontFaceInternal(GLenum mode);
         void FlipFrontFacing(bool isFlipped);
 
@@ -395,6 +417,23 @@ class GLStateManager
             GLuint program;
         };
 
+        struct DeferredTextureBinding
+        {
+            GLTextureTarget target;
+            GLuint          texture;
+        };
+
+        // Indexed buffer binding; a size of zero denotes the entire buffer (i.e. glBindBufferBase).
+        struct IndexedBufferBinding
+        {
+            GLuint      buffer;
+            GLintptr    offset;
+            GLsizeiptr  size;
+        };
+
+        // Number of buffer targets whose indexed bindings can be deferred, i.e. GL_UNIFORM_BUFFER and GL_SHADER_STORAGE_BUFFER.
+        static constexpr std::size_t numDeferredBufferTargets = 2;
+
     private:
 
         static GLStateManager*  current_;
@@ -435,6 +474,18 @@ class GLStateManager
         std::stack<RenderbufferStackEntry>  renderbufferStack_;
         std::stack<ShaderProgramStackEntry> shaderProgramStack_;
 
+        bool                                deferBindings_              = false;
+
+        std::uint32_t                       dirtyTextureLayers_                                                     = 0;
+        DeferredTextureBinding              deferredTextures_[GLContextState::numTextureLayers]                     = {};
+
+        std::uint32_t                       dirtySamplerLayers_                                                     = 0;
+        GLuint                              deferredSamplers_[GLContextState::numTextureLayers]                     = {};
+
+        std::uint64_t                       dirtyBufferSlots_[numDeferredBufferTargets]                             = {};
+        IndexedBufferBinding                deferredBuffers_[numDeferredBufferTargets][g_maxNumResourceSlots]       = {};
+        IndexedBufferBinding                boundIndexedBuffers_[numDeferredBufferTargets][g_maxNumResourceSlots]   = {};
+
 };
 
 
@@ -93,11 +93,23 @@ GLuint GLLegacyShader::CreateShaderPermutation(Permutation permutation)
     return id;
 }
 
-bool GLLegacyShader::FinalizeShaderPermutation(Permutation permutation)
+bool GLLegacyShader::QueryPendingReport(std::string& log) const
 {
-    /* Query compile status and log */
-    const bool status = GLLegacyShader::GetCompileStatus(GetID());
-    ReportStatusAndLog(status, GLLegacyShader::GetGLShaderLog(GetID()));
+    /* Query compile status and log of default permutation */
+    bool status = GLLegacyShader::GetCompileStatus(GetID());
+    log = GLLegacyShader::GetGLShaderLog(GetID());
+
+    /* Only report the flipped Y-position permutation if it failed on its own */
+    if (status)
+    {
+        const GLuint permutationID = GetID(PermutationFlippedYPosition);
+        if (permutationID != GetID() && !GLLegacyShader::GetCompileStatus(permutationID))
+        {
+            log += GLLegacyShader::GetGLShaderLog(permutationID);
+            status = false;
+        }
+    }
+
     return status;
 }
 
@@ -111,7 +123,7 @@ void GLLegacyShader::BuildShader(const ShaderDescriptor& shaderDesc)
 
 void GLLegacyShader::CompileSource(const ShaderDescriptor& shaderDesc)
 {
-    auto CompileShaderPermutation = [this, &shaderDesc](Permutation permutation, long enabledFlags) -> bool
+    auto CompileShaderPermutation = [this, &shaderDesc](Permutation permutation, long enabledFlags) -> void
     {
         const GLuint shader = CreateShaderPermutation(permutation);
         auto sourceCallback = std::bind(GLLegacyShader::CompileShaderSource, shader, std::placeholders::_1);
@@ -123,17 +135,18 @@ void GLLegacyShader::CompileSource(const ShaderDescriptor& shaderDesc)
         }
         else
             GLShader::PatchShaderSource(sourceCallback, shaderDesc.source, shaderDesc, enabledFlags);
-
-        return FinalizeShaderPermutation(permutation);
     };
 
-    /* Compile and patch default shader permutation */
-    if (CompileShaderPermutation(PermutationDefault, ShaderCompileFlags::NoOptimization))
-    {
-        /* Compile and patch shader permutation for flipped Y-position */
-        if (GLShader::NeedsPermutationFlippedYPosition(shaderDesc.type, shaderDesc.flags))
-            CompileShaderPermutation(PermutationFlippedYPosition, ShaderCompileFlags::NoOptimization | ShaderCompileFlags::PatchClippingOrigin);
-    }
+    /*
+    Compile and patch all shader permutations without querying their status in between,
+    so the driver can compile them concurrently if GL_KHR_parallel_shader_compile is supported
+    */
+    CompileShaderPermutation(PermutationDefault, ShaderCompileFlags::NoOptimization);
+
+    if (GLShader::NeedsPermutationFlippedYPosition(shaderDesc.type, shaderDesc.flags))
+        CompileShaderPermutation(PermutationFlippedYPosition, ShaderCompileFlags::NoOptimization | ShaderCompileFlags::PatchClippingOrigin);
+
+    SetReportPending();
 }
 
 void GLLegacyShader::LoadBinary(const ShaderDescriptor& shaderDesc)
@@ -175,7 +188,7 @@ void GLLegacyShader::LoadBinary(const ShaderDescriptor& shaderDesc)
         LLGL_TRAP_FEATURE_NOT_SUPPORTED("loading binary shader");
     }
 
-    FinalizeShaderPermutation(PermutationDefault);
+    SetReportPending();
 }
 
 
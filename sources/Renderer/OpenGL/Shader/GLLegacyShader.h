@@ -43,8 +43,9 @@ class GLLegacyShader final : public GLShader
 
     private:
 
+        bool QueryPendingReport(std::string& log) const override;
+
         GLuint CreateShaderPermutation(Permutation permutation);
-        bool FinalizeShaderPermutation(Permutation permutation);
 
         void BuildShader(const ShaderDescriptor& shaderDesc);
         void CompileSource(const ShaderDescriptor& shaderDesc);
@@ -101,6 +101,20 @@ void GLProgramPipeline::QueryInfoLogs(Report& report)
     report.Reset(std::move(log), hasErrors);
 }
 
+bool GLProgramPipeline::IsLinkComplete() const
+{
+    for_range(i, GetSignature().GetNumShaders())
+    {
+        const GLSeparableShader* shader = separableShaders_[i];
+        if (!GLShaderProgram::GetCompletionStatus(shader->GetID()) ||
+            !GLShaderProgram::GetCompletionStatus(shader->GetID(GLShader::PermutationFlippedYPosition)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 void GLProgramPipeline::QueryTexBufferNames(std::set<std::string>& outSamplerBufferNames, std::set<std::string>& outImageBufferNames) const
 {
     outSamplerBufferNames.clear();
@@ -171,6 +185,11 @@ void GLProgramPipeline::QueryInfoLogs(Report& report)
     // dummy
 }
 
+bool GLProgramPipeline::IsLinkComplete() const
+{
+    return true; // dummy
+}
+
 #endif // /LLGL_GLEXT_SEPARATE_SHADER_OBJECTS
 
 
@@ -25,12 +25,12 @@ namespace LLGL
 GLSeparableShader::GLSeparableShader(const ShaderDescriptor& desc) :
     GLShader { /*isSeparable:*/ true, desc }
 {
+    /* Link all permutations before their status is queried; see SetReportPending() */
     GLLegacyShader intermediateShader{ desc };
-    if (CreateAndLinkSeparableGLProgram(intermediateShader, PermutationDefault))
-    {
-        if (intermediateShader.GetID(PermutationFlippedYPosition) != 0)
-            CreateAndLinkSeparableGLProgram(intermediateShader, PermutationFlippedYPosition);
-    }
+    CreateAndLinkSeparableGLProgram(intermediateShader, PermutationDefault);
+    if (intermediateShader.GetID(PermutationFlippedYPosition) != intermediateShader.GetID())
+        CreateAndLinkSeparableGLProgram(intermediateShader, PermutationFlippedYPosition);
+    SetReportPending();
 
     if (desc.debugName != nullptr)
         SetDebugName(desc.debugName);
@@ -75,6 +75,26 @@ void GLSeparableShader::QueryInfoLog(std::string& text, bool& hasErrors)
  * ======= Private: =======
  */
 
+bool GLSeparableShader::QueryPendingReport(std::string& log) const
+{
+    /* Query link status and log of default permutation */
+    bool status = GLShaderProgram::GetLinkStatus(GetID());
+    log = GLShaderProgram::GetGLProgramLog(GetID());
+
+    /* Only report the flipped Y-position permutation if it failed on its own */
+    if (status)
+    {
+        const GLuint permutationID = GetID(PermutationFlippedYPosition);
+        if (permutationID != GetID() && !GLShaderProgram::GetLinkStatus(permutationID))
+        {
+            log += GLShaderProgram::GetGLProgramLog(permutationID);
+            status = false;
+        }
+    }
+
+    return status;
+}
+
 static GLuint CreateSeparableGLProgram()
 {
     if (const GLuint program = glCreateProgram())
@@ -85,7 +105,7 @@ static GLuint CreateSeparableGLProgram()
     return 0;
 }
 
-bool GLSeparableShader::CreateAndLinkSeparableGLProgram(GLLegacyShader& intermediateShader, Permutation permutation)
+void GLSeparableShader::CreateAndLinkSeparableGLProgram(GLLegacyShader& intermediateShader, Permutation permutation)
 {
     /* Create new separable GL program for current permutation */
     const GLuint program = CreateSeparableGLProgram();
@@ -120,12 +140,6 @@ bool GLSeparableShader::CreateAndLinkSeparableGLProgram(GLLegacyShader& intermed
 
     /* Detach intermediate shader before it gets deleted */
     glDetachShader(program, shader);
-
-    /* Query link status and log */
-    const bool status = GLShaderProgram::GetLinkStatus(program);
-    ReportStatusAndLog(status, GLShaderProgram::GetGLProgramLog(program));
-
-    return status;
 }
 
 #else // LLGL_GLEXT_SEPARATE_SHADER_OBJECTS
@@ -156,6 +170,11 @@ void GLSeparableShader::QueryInfoLog(std::string& text, bool& hasErrors)
     // dummy
 }
 
+bool GLSeparableShader::QueryPendingReport(std::string& log) const
+{
+    return false; // dummy
+}
+
 #endif // /LLGL_GLEXT_SEPARATE_SHADER_OBJECTS
 
 
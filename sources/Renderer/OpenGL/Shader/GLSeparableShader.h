@@ -45,7 +45,9 @@ class GLSeparableShader final : public GLShader
 
     private:
 
-        bool CreateAndLinkSeparableGLProgram(GLLegacyShader& intermediateShader, Permutation permutation);
+        bool QueryPendingReport(std::string& log) const override;
+
+        void CreateAndLinkSeparableGLProgram(GLLegacyShader& intermediateShader, Permutation permutation);
 
     private:
 
@@ -70,6 +72,10 @@ class GLSeparableShader final : public GLShader
         void BindResourceSlots(const GLShaderBindingLayout& bindingLayout, const GLShaderBufferInterfaceMap* bufferInterfaceMap = nullptr);
         void QueryInfoLog(std::string& text, bool& hasErrors);
 
+    private:
+
+        bool QueryPendingReport(std::string& log) const override;
+
 };
 
 #endif // /LLGL_GLEXT_SEPARATE_SHADER_OBJECTS
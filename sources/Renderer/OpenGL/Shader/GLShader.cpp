@@ -36,6 +36,14 @@ GLShader::GLShader(const bool isSeparable, const ShaderDescriptor& desc) :
 
 const Report* GLShader::GetReport() const
 {
+    if (isReportPending_)
+    {
+        /* Query deferred compile/link status once the report is requested for the first time */
+        std::string log;
+        const bool status = QueryPendingReport(log);
+        ResetReportWithNewline(report_, std::move(log), !status);
+        isReportPending_ = false;
+    }
     return (report_ ? &report_ : nullptr);
 }
 
@@ -168,9 +176,9 @@ void GLShader::PatchShaderSourceWithOptions(
     }
 }
 
-void GLShader::ReportStatusAndLog(bool status, const std::string& log)
+void GLShader::SetReportPending()
 {
-    ResetReportWithNewline(report_, log.c_str(), !status);
+    isReportPending_ = true;
 }
 
 
@@ -114,8 +114,14 @@ class GLShader : public Shader
 
         GLShader(const bool isSeparable, const ShaderDescriptor& desc);
 
-        // Resets the report with the specified compile/link status and log.
-        void ReportStatusAndLog(bool status, const std::string& log);
+        /*
+        Defers querying the compile/link status until the report is requested.
+        This avoids stalling on the driver while it compiles shaders on background threads (see GL_KHR_parallel_shader_compile).
+        */
+        void SetReportPending();
+
+        // Queries the compile/link log of this shader and returns its status. Called on the first invocation of GetReport() after SetReportPending().
+        virtual bool QueryPendingReport(std::string& log) const = 0;
 
         // Stores the native shader ID.
         inline void SetID(GLuint id, Permutation permutation = PermutationDefault)
@@ -138,7 +144,8 @@ class GLShader : public Shader
         std::vector<GLShaderAttribute>  shaderAttribs_;
         std::size_t                     numVertexAttribs_           = 0;
         std::vector<const char*>        transformFeedbackVaryings_;
-        Report                          report_;
+        mutable Report                  report_;
+        mutable bool                    isReportPending_            = false;
 
 };
 
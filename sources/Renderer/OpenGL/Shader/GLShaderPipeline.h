@@ -45,6 +45,9 @@ class GLShaderPipeline
         // Resets the output report with the shader info logs.
         virtual void QueryInfoLogs(Report& report) = 0;
 
+        // Returns true if the driver has finished linking this pipeline, i.e. querying its status or reflection will not stall.
+        virtual bool IsLinkComplete() const = 0;
+
         // Returns the set of all texture buffer names (samplerBuffer/imageBuffer) in the entire shader pipeline.
         virtual void QueryTexBufferNames(std::set<std::string>& outSamplerBufferNames, std::set<std::string>& outImageBufferNames) const = 0;
 
@@ -137,6 +137,11 @@ void GLShaderProgram::QueryInfoLogs(Report& report)
     report.Reset(std::move(log), hasErrors);
 }
 
+bool GLShaderProgram::IsLinkComplete() const
+{
+    return GLShaderProgram::GetCompletionStatus(GetID());
+}
+
 void GLShaderProgram::QueryTexBufferNames(std::set<std::string>& outSamplerBufferNames, std::set<std::string>& outImageBufferNames) const
 {
     outSamplerBufferNames.clear();
@@ -151,6 +156,19 @@ bool GLShaderProgram::GetLinkStatus(GLuint program)
     return (status != GL_FALSE);
 }
 
+bool GLShaderProgram::GetCompletionStatus(GLuint program)
+{
+    #if LLGL_GLEXT_PARALLEL_SHADER_COMPILE
+    if (HasExtension(GLExt::KHR_parallel_shader_compile))
+    {
+        GLint status = 0;
+        glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &status);
+        return (status != GL_FALSE);
+    }
+    #endif // /LLGL_GLEXT_PARALLEL_SHADER_COMPILE
+    return true;
+}
+
 std::string GLShaderProgram::GetGLProgramLog(GLuint program)
 {
     /* Query info log length */
@@ -32,6 +32,7 @@ class GLShaderProgram final : public GLShaderPipeline
         void Bind(GLStateManager& stateMngr) override;
         void BindResourceSlots(const GLShaderBindingLayout& bindingLayout, const GLShaderBufferInterfaceMap* bufferInterfaceMap = nullptr) override;
         void QueryInfoLogs(Report& report) override;
+        bool IsLinkComplete() const override;
         void QueryTexBufferNames(std::set<std::string>& outSamplerBufferNames, std::set<std::string>& outImageBufferNames) const override;
 
     public:
@@ -49,6 +50,9 @@ class GLShaderProgram final : public GLShaderPipeline
         // Returns true if the native GL shader program was linked successfully.
         static bool GetLinkStatus(GLuint program);
 
+        // Returns false if the driver is still compiling or linking the specified program in the background. Always true without GL_KHR_parallel_shader_compile.
+        static bool GetCompletionStatus(GLuint program);
+
         // Returns the native GL shader program log.
         static std::string GetGLProgramLog(GLuint program);
 
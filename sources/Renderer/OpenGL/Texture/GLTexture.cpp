@@ -22,6 +22,7 @@
 #include "../../TextureUtils.h"
 #include "../../../Core/Exception.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../../Core/MemoryAllocation.h"
 #include <LLGL/Format.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Backend/OpenGL/NativeHandle.h>
@@ -971,7 +972,7 @@ static void GLGetTexImage(
         #if !LLGL_GL_ENABLE_OPENGL2X
 
         /* GL_STENCIL_INDEX can only be passed into glGetTexImage in GL 4.4+, so read GL_DEPTH_STENCIL and separate stencil manually */
-        std::unique_ptr<GLDepthStencilPair[]> intermediateDSData = MakeUniqueArray<GLDepthStencilPair>(numTexels);
+        TransientArray<GLDepthStencilPair> intermediateDSData{ numTexels };
 
         if (target == GLTextureTarget::TextureCubeMap)
         {
@@ -15,6 +15,7 @@
 #include "../../CheckedCast.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/MacroUtils.h"
+#include "../../../Core/Assertion.h"
 #include <algorithm>
 
 
@@ -22,8 +23,6 @@ namespace LLGL
 {
 
 
-static constexpr std::size_t g_maxNumReusableTextureViews = 16;
-
 GLTextureViewPool::~GLTextureViewPool()
 {
     Clear();
@@ -37,120 +36,13 @@ GLTextureViewPool& GLTextureViewPool::Get()
 
 void GLTextureViewPool::Clear()
 {
-    /* Delete all texture view GL objects and clear container */
-    for (const GLTextureView& texView : textureViews_)
-    {
-        if (texView.texID != 0)
-            glDeleteTextures(1, &(texView.texID));
-    }
+    /* Delete all texture view GL objects and clear containers */
+    for (const auto& it : textureViews_)
+        glDeleteTextures(1, &(it.first));
     textureViews_.clear();
-    numReusableEntries_ = 0;
-}
-
-GLuint GLTextureViewPool::CreateTextureView(GLuint sourceTexID, const TextureViewDescriptor& textureViewDesc, bool restoreBoundTexture)
-{
-    #if LLGL_GLEXT_TEXTURE_VIEW
-
-    if (!HasExtension(GLExt::ARB_texture_view))
-        return 0;
-
-    /* Compress texture view descriptor for faster comparison and sorting */
-    GLTextureView texView;
-    {
-        texView.sourceTexID = sourceTexID;
-    }
-    CompressTextureViewDesc(texView.view, textureViewDesc);
-
-    /* Try to find texture view with same parameters */
-    std::size_t insertionIndex = 0;
-    GLTextureView* sharedTexView = FindInSortedArray<GLTextureView>(
-        textureViews_.data(),
-        textureViews_.size(),
-        [&texView](const GLTextureView& rhs)
-        {
-            return GLTextureViewPool::CompareTextureViewSWO(texView, rhs);
-        },
-        &insertionIndex
-    );
-
-    if (sharedTexView != nullptr)
-    {
-        /* Create a shared GL texture view from the descriptor */
-        return CreateGLTextureView(*sharedTexView, textureViewDesc, true, restoreBoundTexture);
-    }
-    else
-    {
-        /* Create new GL texture view and store it with insertion sort */
-        GLuint texID = CreateGLTextureView(texView, textureViewDesc, false, restoreBoundTexture);
-        textureViews_.insert(textureViews_.begin() + insertionIndex, texView);
-        return texID;
-    }
-
-    #else
-
-    return 0;
-
-    #endif
-}
-
-void GLTextureViewPool::ReleaseTextureView(GLuint texID)
-{
-    /* Try to find texture by GL texture ID only */
-    std::size_t insertionIndex = 0;
-    GLTextureView* sharedTexView = FindInSortedArray<GLTextureView>(
-        textureViews_.data(),
-        textureViews_.size(),
-        [texID](const GLTextureView& rhs)
-        {
-            LLGL_COMPARE_SEPARATE_MEMBERS_SWO(texID, rhs.texID);
-            return 0;
-        },
-        &insertionIndex
-    );
-
-    if (sharedTexView != nullptr)
-    {
-        /* Delete GL texture view if the reference counter reaches 0 */
-        ReleaseSharedGLTextureView(*sharedTexView);
-
-        /* Remove unused entries in the array after a given amount has been freed */
-        if (numReusableEntries_ > g_maxNumReusableTextureViews)
-            FlushReusableTextureViews();
-    }
-}
-
-void GLTextureViewPool::NotifyTextureRelease(GLuint sourceTexID)
-{
-    /* Move all objects that are about to be removed at the end of the list using 'std::remove' */
-    auto it = std::remove_if(
-        textureViews_.begin(),
-        textureViews_.end(),
-        [sourceTexID](const GLTextureView& entry)
-        {
-            return (entry.texID == 0 || entry.sourceTexID == sourceTexID);
-        }
-    );
-
-    /* Iterate over all elements to be deleted */
-    for (; it != textureViews_.end(); ++it)
-        DeleteGLTextureView(*it);
-
-    /* Finally remove the entries from the list */
-    textureViews_.erase(it, textureViews_.end());
-
-    /* Reset reusable entries, since we just deleted all unused entries */
-    numReusableEntries_ = 0;
-}
-
-
-/*
- * ======= Private: =======
- */
-
-int GLTextureViewPool::CompareTextureViewSWO(const GLTextureView& lhs, const GLTextureView& rhs)
-{
-    LLGL_COMPARE_MEMBER_SWO( sourceTexID );
-    return CompareCompressedTexViewSWO(lhs.view, rhs.view);
+    textureViewKeys_.clear();
+    unusedTextureViews_.clear();
+    record_ = {};
 }
 
 #if LLGL_GLEXT_TEXTURE_VIEW
@@ -207,78 +99,164 @@ static GLuint GenGLTextureView(GLuint sourceTexID, const TextureViewDescriptor&
     return texID;
 }
 
-GLuint GLTextureViewPool::CreateGLTextureView(GLTextureView& texView, const TextureViewDescriptor& textureViewDesc, bool isSharedTex, bool restoreBoundTexture)
+GLuint GLTextureViewPool::CreateTextureView(GLuint sourceTexID, const TextureViewDescriptor& textureViewDesc, bool restoreBoundTexture)
 {
-    if (isSharedTex)
+    #if LLGL_GLEXT_TEXTURE_VIEW
+
+    if (!HasExtension(GLExt::ARB_texture_view))
+        return 0;
+
+    /* Compress texture view descriptor for faster hashing and comparison */
+    GLTextureViewKey key;
+    {
+        key.sourceTexID = sourceTexID;
+    }
+    CompressTextureViewDesc(key.view, textureViewDesc);
+
+    /* Try to find texture view with same parameters */
+    auto keyIt = textureViewKeys_.find(key);
+    if (keyIt != textureViewKeys_.end())
     {
-        if (texView.texID == 0)
+        auto texViewIt = textureViews_.find(keyIt->second);
+        if (texViewIt != textureViews_.end())
         {
-            /* Create new GL texture view if ID is invalid */
-            GLuint texID = GenGLTextureView(texView.sourceTexID, textureViewDesc, restoreBoundTexture);
-            RetainSharedGLTextureView(texView, texID);
+            /* Share existing GL texture view, which might have been kept alive in the LRU cache */
+            record_.textureViewReuses++;
+            return RetainTextureView(texViewIt->first, texViewIt->second);
         }
     }
-    else
+
+    /* Create new GL texture view */
+    GLuint texID = GenGLTextureView(sourceTexID, textureViewDesc, restoreBoundTexture);
+    if (texID == 0)
+        return 0;
+
+    GLTextureView& texView = textureViews_[texID];
     {
-        /* Create a new GL texture view and initialize reference counter */
-        texView.texID = GenGLTextureView(texView.sourceTexID, textureViewDesc, restoreBoundTexture);
+        texView.key         = key;
+        texView.refCount    = 1;
     }
+    textureViewKeys_[key] = texID;
+    record_.textureViewCreations++;
 
-    /* Increment reference counter for the shared texture view */
-    texView.refCount++;
+    return texID;
 
-    return texView.texID;
-}
+    #else
 
-// Uncompresses the specified 4-bit texture type to a 'GLTextureTarget' enum entry.
-static GLTextureTarget UncompressGLTextureTarget(std::uint32_t type)
-{
-    return GLStateManager::GetTextureTarget(static_cast<TextureType>(type));
-}
+    return 0;
 
-void GLTextureViewPool::DeleteGLTextureView(GLTextureView& texView)
-{
-    /* Delete GL texture and reset ID to ensure it's cleaned up in FlushReusableTextureViews() */
-    GLStateManager::Get().DeleteTexture(texView.texID, UncompressGLTextureTarget(texView.view.type));
-    texView.texID = 0;
+    #endif
 }
 
-void GLTextureViewPool::RetainSharedGLTextureView(GLTextureView& texView, GLuint texID)
+void GLTextureViewPool::ReleaseTextureView(GLuint texID)
 {
-    if (texView.texID == 0)
-    {
-        /* If this is shared texture view, reclaim one of the reusable entries */
-        texView.texID = texID;
-        if (numReusableEntries_ > 0)
-            --numReusableEntries_;
-    }
-}
+    auto it = textureViews_.find(texID);
+    if (it == textureViews_.end())
+        return;
 
-void GLTextureViewPool::ReleaseSharedGLTextureView(GLTextureView& texView)
-{
+    GLTextureView& texView = it->second;
     if (texView.refCount > 0)
     {
         texView.refCount--;
         if (texView.refCount == 0)
         {
-            DeleteGLTextureView(texView);
-            ++numReusableEntries_;
+            /* Keep unused texture view alive as most recently used entry and evict old entries if the limit is exceeded */
+            texView.lruEntry = unusedTextureViews_.insert(unusedTextureViews_.end(), texID);
+            EvictUnusedTextureViews();
         }
     }
 }
 
-void GLTextureViewPool::FlushReusableTextureViews()
+void GLTextureViewPool::NotifyTextureRelease(GLuint sourceTexID)
 {
-    if (numReusableEntries_ > 0)
+    /* Delete all texture views that were derived from the released texture, regardless of their reference counter */
+    for (auto it = textureViews_.begin(); it != textureViews_.end();)
     {
-        RemoveAllFromListIf(
-            textureViews_,
-            [](const GLTextureView& entry)
-            {
-                return (entry.texID == 0);
-            }
-        );
-        numReusableEntries_ = 0;
+        if (it->second.key.sourceTexID == sourceTexID)
+            it = DeleteTextureView(it);
+        else
+            ++it;
+    }
+}
+
+void GLTextureViewPool::SetMaxCachedTextureViews(std::size_t maxCachedTextureViews)
+{
+    maxCachedTextureViews_ = maxCachedTextureViews;
+    EvictUnusedTextureViews();
+}
+
+void GLTextureViewPool::FlushProfile(ProfileTextureViewPoolRecord& outRecord)
+{
+    /* Copy counters and current pool size into output record, then reset counters */
+    outRecord = record_;
+    outRecord.numTextureViews       = static_cast<std::uint32_t>(textureViews_.size());
+    outRecord.numCachedTextureViews = static_cast<std::uint32_t>(unusedTextureViews_.size());
+    record_ = {};
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::size_t GLTextureViewPool::GLTextureViewKeyHash::operator () (const GLTextureViewKey& key) const
+{
+    std::size_t seed = 0;
+    HashCombine(seed, key.sourceTexID);
+    HashCombine(seed, static_cast<std::uint32_t>(key.view.type));
+    HashCombine(seed, static_cast<std::uint32_t>(key.view.format));
+    HashCombine(seed, static_cast<std::uint32_t>(key.view.numMips));
+    HashCombine(seed, static_cast<std::uint32_t>(key.view.swizzle));
+    HashCombine(seed, key.view.firstMip);
+    HashCombine(seed, key.view.numLayers);
+    HashCombine(seed, key.view.firstLayer);
+    return seed;
+}
+
+bool GLTextureViewPool::GLTextureViewKeyEqual::operator () (const GLTextureViewKey& lhs, const GLTextureViewKey& rhs) const
+{
+    return (lhs.sourceTexID == rhs.sourceTexID && CompareCompressedTexViewSWO(lhs.view, rhs.view) == 0);
+}
+
+GLuint GLTextureViewPool::RetainTextureView(GLuint texID, GLTextureView& texView)
+{
+    /* Remove texture view from LRU list when it gets reclaimed from the cache */
+    if (texView.refCount == 0)
+        unusedTextureViews_.erase(texView.lruEntry);
+    texView.refCount++;
+    return texID;
+}
+
+// Uncompresses the specified 4-bit texture type to a 'GLTextureTarget' enum entry.
+static GLTextureTarget UncompressGLTextureTarget(std::uint32_t type)
+{
+    return GLStateManager::GetTextureTarget(static_cast<TextureType>(type));
+}
+
+GLTextureViewPool::GLTextureViewMap::iterator GLTextureViewPool::DeleteTextureView(GLTextureViewMap::iterator it)
+{
+    GLTextureView& texView = it->second;
+
+    /* Remove entry from lookup table and LRU list */
+    textureViewKeys_.erase(texView.key);
+    if (texView.refCount == 0)
+        unusedTextureViews_.erase(texView.lruEntry);
+
+    /* Delete GL texture view */
+    GLuint texID = it->first;
+    GLStateManager::Get().DeleteTexture(texID, UncompressGLTextureTarget(texView.key.view.type));
+
+    return textureViews_.erase(it);
+}
+
+void GLTextureViewPool::EvictUnusedTextureViews()
+{
+    while (unusedTextureViews_.size() > maxCachedTextureViews_)
+    {
+        auto it = textureViews_.find(unusedTextureViews_.front());
+        LLGL_ASSERT(it != textureViews_.end(), "texture view in LRU list is missing in texture view pool");
+        DeleteTextureView(it);
+        record_.textureViewEvictions++;
     }
 }
 
@@ -10,8 +10,11 @@
 
 
 #include <LLGL/TextureFlags.h>
+#include <LLGL/RenderingDebuggerFlags.h>
 #include <cstdint>
-#include <vector>
+#include <cstddef>
+#include <list>
+#include <unordered_map>
 #include "../OpenGL.h"
 #include "../../TextureUtils.h"
 
@@ -48,7 +51,7 @@ class GLTextureViewPool
         */
         GLuint CreateTextureView(GLuint sourceTexID, const TextureViewDescriptor& textureViewDesc, bool restoreBoundTexture = true);
 
-        // Release the texture view that was created with CreateTextureView.
+        // Release the texture view that was created with CreateTextureView. Unused texture views are kept alive up to the cache limit.
         void ReleaseTextureView(GLuint texID);
 
         /*
@@ -57,46 +60,73 @@ class GLTextureViewPool
         */
         void NotifyTextureRelease(GLuint sourceTexID);
 
+        // Sets the maximum number of unused texture views that are kept alive for reuse. Excess views are evicted immediately.
+        void SetMaxCachedTextureViews(std::size_t maxCachedTextureViews);
+
+        // Copies the current pool statistics into the output record and resets all counters.
+        void FlushProfile(ProfileTextureViewPoolRecord& outRecord);
+
     private:
 
         GLTextureViewPool() = default;
 
     private:
 
-        // Structure that stores a GL texture that was generated with 'glTextureView'; managed by <GLTextureViewPool>
-        struct GLTextureView
+        // Key to look up shared texture views by their source texture and compressed texture view descriptor.
+        struct GLTextureViewKey
         {
-            GLuint              texID       = 0;
             GLuint              sourceTexID = 0;
-            GLuint              refCount    = 0;
             CompressedTexView   view        = {};
         };
 
-        // Compares the two texture views in a strict-weak-order (SWO).
-        static int CompareTextureViewSWO(const GLTextureView& lhs, const GLTextureView& rhs);
+        struct GLTextureViewKeyHash
+        {
+            std::size_t operator () (const GLTextureViewKey& key) const;
+        };
 
-        // Creats a new GL texture view and stores it in the specified view entry.
-        GLuint CreateGLTextureView(GLTextureView& texView, const TextureViewDescriptor& textureViewDesc, bool isSharedTex, bool restoreBoundTexture);
+        struct GLTextureViewKeyEqual
+        {
+            bool operator () (const GLTextureViewKey& lhs, const GLTextureViewKey& rhs) const;
+        };
 
-        // Deletes the specified GL texture view.
-        void DeleteGLTextureView(GLTextureView& texView);
+        using GLTextureViewLRUList = std::list<GLuint>;
 
-        // Assignes the specified texture view a new GL texture ID and reclaims it as a reusable entry.
-        void RetainSharedGLTextureView(GLTextureView& texView, GLuint texID);
+        // Structure that stores a GL texture that was generated with 'glTextureView'; managed by <GLTextureViewPool>
+        struct GLTextureView
+        {
+            GLTextureViewKey                key;
+            GLuint                          refCount    = 0;
+            GLTextureViewLRUList::iterator  lruEntry;       // Only valid if 'refCount' is 0.
+        };
+
+        using GLTextureViewMap      = std::unordered_map<GLuint, GLTextureView>;
+        using GLTextureViewKeyMap   = std::unordered_map<GLTextureViewKey, GLuint, GLTextureViewKeyHash, GLTextureViewKeyEqual>;
 
-        // Release the specified GL texture object and marks the entry as reusable.
-        void ReleaseSharedGLTextureView(GLTextureView& texView);
+        // Increments the reference counter of the specified texture view and removes it from the LRU list if it was unused.
+        GLuint RetainTextureView(GLuint texID, GLTextureView& texView);
 
-        // Removes all empty entries from the texture view list.
-        void FlushReusableTextureViews();
+        // Deletes the GL texture view and removes it from all containers. Returns the iterator to the next texture view entry.
+        GLTextureViewMap::iterator DeleteTextureView(GLTextureViewMap::iterator it);
+
+        // Evicts the least recently used texture views until the number of unused views is within the limit.
+        void EvictUnusedTextureViews();
 
     private:
 
-        // Container of all managed texture views.
-        std::vector<GLTextureView>  textureViews_;
+        // Container of all managed texture views, indexed by their GL texture ID.
+        GLTextureViewMap                textureViews_;
+
+        // Hash map to find shared texture views by their source texture and descriptor.
+        GLTextureViewKeyMap             textureViewKeys_;
+
+        // List of all unused texture views in least-recently-used order, i.e. the first entry is evicted first.
+        GLTextureViewLRUList            unusedTextureViews_;
+
+        // Maximum number of unused texture views that are kept alive.
+        std::size_t                     maxCachedTextureViews_  = 64;
 
-        // Number of textures that are already freed, but not removed from the texture view array yet.
-        std::size_t                 numReusableEntries_ = 0;
+        // Statistics of this pool since the last call to FlushProfile().
+        ProfileTextureViewPoolRecord    record_;
 
 };
 
@@ -11,7 +11,9 @@
 #include "../Core/Assertion.h"
 #include "../Core/Exception.h"
 #include "../Core/StringUtils.h"
+#include "../Core/MemoryAllocation.h"
 #include "RenderTargetUtils.h"
+#include "ShaderVariantCache.h"
 #include <LLGL/Platform/Platform.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Format.h>
@@ -54,6 +56,8 @@ struct RenderSystem::Pimpl
     bool                    hasCaps     = false;
     RenderingCapabilities   caps;
     Report                  report;
+    ShaderVariantCache      shaderVariantCache;
+    bool                    ownsAllocator   = false;
 };
 
 
@@ -64,6 +68,9 @@ RenderSystem::RenderSystem() :
 
 RenderSystem::~RenderSystem()
 {
+    /* Release allocator after the derived render system has released all of its objects */
+    if (pimpl_->ownsAllocator)
+        ReleaseAllocator();
     delete pimpl_;
 }
 
@@ -85,12 +92,19 @@ RenderSystemPtr RenderSystem::Load(const RenderSystemDescriptor& renderSystemDes
 
     #endif
 
+    /* Make allocator active before the render system allocates its first objects */
+    if (!AcquireAllocator(renderSystemDesc.allocator))
+        return ReportException(report, "cannot load render system with a different allocator than the render systems that are still alive");
+
     #if LLGL_BUILD_STATIC_LIB
 
     /* Allocate render system */
     RenderSystemPtr renderSystem{ StaticModules::AllocRenderSystem(renderSystemDesc) };
     if (renderSystem == nullptr)
+    {
+        ReleaseAllocator();
         return ReportException(report, "failed to allocate render system from module: %s", renderSystemDesc.moduleName.c_str());
+    }
 
     if (renderSystemDesc.debugger != nullptr)
     {
@@ -109,6 +123,7 @@ RenderSystemPtr RenderSystem::Load(const RenderSystemDescriptor& renderSystemDes
 
     renderSystem->pimpl_->name          = StaticModules::GetRendererName(renderSystemDesc.moduleName);
     renderSystem->pimpl_->rendererID    = StaticModules::GetRendererID(renderSystemDesc.moduleName);
+    renderSystem->pimpl_->ownsAllocator = true;
 
     /* Return new render system and unique pointer */
     return renderSystem;
@@ -118,16 +133,24 @@ RenderSystemPtr RenderSystem::Load(const RenderSystemDescriptor& renderSystemDes
     /* Load render system module */
     RenderSystemModule* module = RenderSystemRegistry::Get().LoadModule(renderSystemDesc.moduleName.c_str(), report);
     if (module == nullptr)
+    {
+        ReleaseAllocator();
         return nullptr;
+    }
 
     /*
     Verify build ID from render system module to detect a module,
     that has compiled with a different compiler (type, version, debug/release mode etc.)
     */
     if (module->BuildID() != LLGL_BUILD_ID)
+    {
+        ReleaseAllocator();
         return ReportException(report, "build ID mismatch in render system module");
+    }
 
     #if LLGL_EXCEPTIONS_SUPPORTED
+    /* Allocator must be released by the exception handler until it is owned by the new render system */
+    bool hasPendingAllocator = true;
     try
     #endif
     {
@@ -156,16 +179,30 @@ RenderSystemPtr RenderSystem::Load(const RenderSystemDescriptor& renderSystemDes
 
             renderSystem->pimpl_->name          = module->RendererName();
             renderSystem->pimpl_->rendererID    = module->RendererID();
+            renderSystem->pimpl_->ownsAllocator = true;
+            #if LLGL_EXCEPTIONS_SUPPORTED
+            hasPendingAllocator = false;
+            #endif
 
             /* Link render system to module */
             RenderSystemRegistry::Get().RegisterRenderSystem(renderSystem.get(), module);
         }
+        else
+        {
+            #if LLGL_EXCEPTIONS_SUPPORTED
+            hasPendingAllocator = false;
+            #endif
+            ReleaseAllocator();
+        }
 
         return renderSystem;
     }
     #if LLGL_EXCEPTIONS_SUPPORTED
     catch (const std::exception& e)
     {
+        if (hasPendingAllocator)
+            ReleaseAllocator();
+
         /* Throw with new exception, otherwise the exception's v-table will be corrupted since it's part of the module */
         return ReportException(report, e.what());
     }
@@ -219,6 +256,100 @@ const Report* RenderSystem::GetReport() const
     return (pimpl_->report ? &(pimpl_->report) : nullptr);
 }
 
+std::uint32_t RenderSystem::CreateShaders(std::uint32_t numShaders, const ShaderDescriptor* shaderDescs, Shader** outShaders)
+{
+    LLGL_ASSERT(numShaders == 0 || (shaderDescs != nullptr && outShaders != nullptr));
+    std::uint32_t numCreated = 0;
+    for_range(i, numShaders)
+    {
+        outShaders[i] = CreateShader(shaderDescs[i]);
+        if (outShaders[i] != nullptr)
+            ++numCreated;
+    }
+    return numCreated;
+}
+
+std::uint32_t RenderSystem::CreatePipelineStates(std::uint32_t numPipelineStates, const GraphicsPipelineDescriptor* pipelineStateDescs, PipelineState** outPipelineStates)
+{
+    LLGL_ASSERT(numPipelineStates == 0 || (pipelineStateDescs != nullptr && outPipelineStates != nullptr));
+    std::uint32_t numCreated = 0;
+    for_range(i, numPipelineStates)
+    {
+        outPipelineStates[i] = CreatePipelineState(pipelineStateDescs[i]);
+        if (outPipelineStates[i] != nullptr)
+            ++numCreated;
+    }
+    return numCreated;
+}
+
+void RenderSystem::BeginResourceHeapUpdate(ResourceHeap& /*resourceHeap*/)
+{
+    // dummy
+}
+
+std::uint32_t RenderSystem::CommitResourceHeapUpdate(ResourceHeap& /*resourceHeap*/)
+{
+    return 0; // dummy
+}
+
+MemoryHeap* RenderSystem::CreateMemoryHeap(const MemoryHeapDescriptor& /*memoryHeapDesc*/)
+{
+    return nullptr; // dummy
+}
+
+void RenderSystem::Release(MemoryHeap& /*memoryHeap*/)
+{
+    // dummy
+}
+
+bool RenderSystem::GetMemoryRequirements(const TextureDescriptor& /*textureDesc*/, MemoryRequirements& /*outRequirements*/)
+{
+    return false; // dummy
+}
+
+bool RenderSystem::GetMemoryRequirements(const BufferDescriptor& /*bufferDesc*/, MemoryRequirements& /*outRequirements*/)
+{
+    return false; // dummy
+}
+
+Texture* RenderSystem::CreatePlacedTexture(MemoryHeap& /*memoryHeap*/, std::uint64_t /*offset*/, const TextureDescriptor& /*textureDesc*/)
+{
+    return nullptr; // dummy
+}
+
+Buffer* RenderSystem::CreatePlacedBuffer(MemoryHeap& /*memoryHeap*/, std::uint64_t /*offset*/, const BufferDescriptor& /*bufferDesc*/)
+{
+    return nullptr; // dummy
+}
+
+Shader* RenderSystem::CreateShaderVariant(const ShaderDescriptor& shaderDesc)
+{
+    RenderSystem::AssertCreateShader(shaderDesc);
+    return pimpl_->shaderVariantCache.FindOrCreate(*this, shaderDesc);
+}
+
+bool RenderSystem::ReleaseShaderVariant(Shader& shader)
+{
+    return pimpl_->shaderVariantCache.Release(*this, shader);
+}
+
+ShaderVariantCacheStatistics RenderSystem::GetShaderVariantCacheStatistics() const
+{
+    ShaderVariantCacheStatistics stats;
+    pimpl_->shaderVariantCache.GetStatistics(stats);
+    return stats;
+}
+
+Blob RenderSystem::GetShaderVariantCacheBlob() const
+{
+    return pimpl_->shaderVariantCache.GetBlob(GetRendererID());
+}
+
+bool RenderSystem::SetShaderVariantCacheBlob(const Blob& blob)
+{
+    return pimpl_->shaderVariantCache.SetBlob(blob, GetRendererID());
+}
+
 
 /*
  * ======= Protected: =======
@@ -100,6 +100,8 @@ LLGL_EXPORT bool ValidateRenderingCaps(
     LLGL_VALIDATE_FEATURE( hasLogicOp,                   "logic fragment operations"   );
     LLGL_VALIDATE_FEATURE( hasPipelineStatistics,        "query pipeline statistics"   );
     LLGL_VALIDATE_FEATURE( hasRenderCondition,           "conditional rendering"       );
+    LLGL_VALIDATE_FEATURE( hasDescriptorIndexing,        "descriptor indexing"         );
+    LLGL_VALIDATE_FEATURE( hasPlacedResources,           "placed resources"            );
 
     #undef LLGL_VALIDATE_FEATURE
 
@@ -166,6 +168,7 @@ LLGL_EXPORT bool ValidateRenderingCaps(
     LLGL_VALIDATE_LIMIT( maxConstantBufferSize,             "constant buffer size"                      );
     LLGL_VALIDATE_LIMIT( maxStreamOutputs,                  "stream outputs"                            );
     LLGL_VALIDATE_LIMIT( maxTessFactor,                     "tessellation factor"                       );
+    LLGL_VALIDATE_LIMIT( maxDescriptorIndexingArraySize,    "descriptor indexing array size"            );
 
     #undef LLGL_VALIDATE_LIMIT
     #undef LLGL_CONTINUE_VALIDATION_IF
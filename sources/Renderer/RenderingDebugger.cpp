@@ -12,6 +12,7 @@
 #include "../Core/StringUtils.h"
 #include "../Platform/Debug.h"
 #include <map>
+#include <algorithm>
 
 
 namespace LLGL
@@ -200,11 +201,87 @@ static void MergeProfileCommandBufferRecords(ProfileCommandBufferRecord& dst, co
     dst.meshCommands                += src.meshCommands             ;
 }
 
+static void MergeProfileTextureViewPoolRecords(ProfileTextureViewPoolRecord& dst, const ProfileTextureViewPoolRecord& src)
+{
+    LLGL_ASSERT_STRUCT_FIELDS(ProfileTextureViewPoolRecord, 5);
+    dst.textureViewCreations        += src.textureViewCreations     ;
+    dst.textureViewReuses           += src.textureViewReuses        ;
+    dst.textureViewEvictions        += src.textureViewEvictions     ;
+    dst.numTextureViews             = std::max(dst.numTextureViews, src.numTextureViews);
+    dst.numCachedTextureViews       = std::max(dst.numCachedTextureViews, src.numCachedTextureViews);
+}
+
+static void MergeProfileRenderPassCacheRecords(ProfileRenderPassCacheRecord& dst, const ProfileRenderPassCacheRecord& src)
+{
+    LLGL_ASSERT_STRUCT_FIELDS(ProfileRenderPassCacheRecord, 7);
+    dst.renderPassCreations         += src.renderPassCreations      ;
+    dst.renderPassReuses            += src.renderPassReuses         ;
+    dst.framebufferCreations        += src.framebufferCreations     ;
+    dst.framebufferReuses           += src.framebufferReuses        ;
+    dst.framebufferEvictions        += src.framebufferEvictions     ;
+    dst.numRenderPasses             = std::max(dst.numRenderPasses, src.numRenderPasses);
+    dst.numFramebuffers             = std::max(dst.numFramebuffers, src.numFramebuffers);
+}
+
+static void MergeProfileGraphicsPipelineRecords(ProfileGraphicsPipelineRecord& dst, const ProfileGraphicsPipelineRecord& src)
+{
+    LLGL_ASSERT_STRUCT_FIELDS(ProfileGraphicsPipelineRecord, 6);
+    dst.pipelineCreations           += src.pipelineCreations        ;
+    dst.pipelineLinks               += src.pipelineLinks            ;
+    dst.libraryCreations            += src.libraryCreations         ;
+    dst.libraryReuses               += src.libraryReuses            ;
+    dst.numLibraries                = std::max(dst.numLibraries, src.numLibraries);
+    dst.creationTime                += src.creationTime             ;
+}
+
+static void MergeProfileDeviceMemoryRecords(ProfileDeviceMemoryRecord& dst, const ProfileDeviceMemoryRecord& src)
+{
+    LLGL_ASSERT_STRUCT_FIELDS(ProfileDeviceMemoryRecord, 12);
+    dst.numChunks                   = std::max(dst.numChunks, src.numChunks);
+    dst.numEmptyChunks              = std::max(dst.numEmptyChunks, src.numEmptyChunks);
+    dst.numBlocks                   = std::max(dst.numBlocks, src.numBlocks);
+    dst.numFragments                = std::max(dst.numFragments, src.numFragments);
+    dst.allocatedSize               = std::max(dst.allocatedSize, src.allocatedSize);
+    dst.usedSize                    = std::max(dst.usedSize, src.usedSize);
+    dst.maxFragmentSize             = std::max(dst.maxFragmentSize, src.maxFragmentSize);
+    dst.budget                      = std::max(dst.budget, src.budget);
+    dst.usage                       = std::max(dst.usage, src.usage);
+    dst.chunkReleases               += src.chunkReleases            ;
+    dst.relocations                 += src.relocations              ;
+    dst.relocatedSize               += src.relocatedSize            ;
+}
+
+static void MergeProfileNativeCallRecords(DynamicVector<ProfileNativeCallRecord>& dst, const DynamicVector<ProfileNativeCallRecord>& src)
+{
+    for (const ProfileNativeCallRecord& srcRecord : src)
+    {
+        auto it = std::find_if(
+            dst.begin(), dst.end(),
+            [&srcRecord](const ProfileNativeCallRecord& dstRecord) -> bool
+            {
+                return (dstRecord.function.compare(srcRecord.function) == 0 && dstRecord.command.compare(srcRecord.command) == 0);
+            }
+        );
+        if (it != dst.end())
+        {
+            it->calls       += srcRecord.calls;
+            it->elapsedTime += srcRecord.elapsedTime;
+        }
+        else
+            dst.push_back(srcRecord);
+    }
+}
+
 void RenderingDebugger::MergeProfiles(FrameProfile& dst, const FrameProfile& src)
 {
     /* Accumulate counters */
     MergeProfileCommandQueueRecords(dst.commandQueueRecord, src.commandQueueRecord);
     MergeProfileCommandBufferRecords(dst.commandBufferRecord, src.commandBufferRecord);
+    MergeProfileTextureViewPoolRecords(dst.textureViewPoolRecord, src.textureViewPoolRecord);
+    MergeProfileRenderPassCacheRecords(dst.renderPassCacheRecord, src.renderPassCacheRecord);
+    MergeProfileGraphicsPipelineRecords(dst.graphicsPipelineRecord, src.graphicsPipelineRecord);
+    MergeProfileDeviceMemoryRecords(dst.deviceMemoryRecord, src.deviceMemoryRecord);
+    MergeProfileNativeCallRecords(dst.nativeCallRecords, src.nativeCallRecords);
 
     /* Append time records */
     dst.timeRecords.insert(dst.timeRecords.end(), src.timeRecords.begin(), src.timeRecords.end());
@@ -0,0 +1,97 @@
+/*
+ * ResourceHeapUpdateBatch.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ResourceHeapUpdateBatch.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+bool ResourceHeapUpdateBatch::Begin()
+{
+    if (isActive_)
+        return false;
+    isActive_ = true;
+    return true;
+}
+
+std::uint32_t ResourceHeapUpdateBatch::Record(
+    std::uint32_t                               firstDescriptor,
+    const ArrayView<ResourceViewDescriptor>&    resourceViews,
+    std::uint32_t                               numDescriptors)
+{
+    /* Silently quit on out of bounds; debug layer must report these errors */
+    if (firstDescriptor >= numDescriptors)
+        return 0;
+    if (firstDescriptor + resourceViews.size() > numDescriptors)
+        return 0;
+
+    std::uint32_t numRecorded = 0;
+
+    for (const ResourceViewDescriptor& resourceView : resourceViews)
+    {
+        /* Skip over empty resource descriptors */
+        if (resourceView.resource != nullptr)
+        {
+            entries_.push_back(Entry{ firstDescriptor, resourceView });
+            ++numRecorded;
+        }
+        ++firstDescriptor;
+    }
+
+    return numRecorded;
+}
+
+void ResourceHeapUpdateBatch::Resolve(std::vector<Range>& outRanges, std::vector<ResourceViewDescriptor>& outResourceViews)
+{
+    isActive_ = false;
+
+    outRanges.clear();
+    outResourceViews.clear();
+
+    if (entries_.empty())
+        return;
+
+    /* Sort entries by descriptor index; stable sort retains the recording order of writes to the same descriptor */
+    std::stable_sort(
+        entries_.begin(),
+        entries_.end(),
+        [](const Entry& lhs, const Entry& rhs) -> bool
+        {
+            return (lhs.descriptor < rhs.descriptor);
+        }
+    );
+
+    outResourceViews.reserve(entries_.size());
+
+    for (auto it = entries_.begin(); it != entries_.end(); ++it)
+    {
+        /* Only take the last write to each descriptor */
+        auto next = std::next(it);
+        if (next != entries_.end() && next->descriptor == it->descriptor)
+            continue;
+
+        /* Append to previous range if the descriptor is adjacent, otherwise start a new range */
+        if (!outRanges.empty() && outRanges.back().firstDescriptor + outRanges.back().numDescriptors == it->descriptor)
+            outRanges.back().numDescriptors++;
+        else
+            outRanges.push_back(Range{ it->descriptor, 1u });
+
+        outResourceViews.push_back(it->resourceView);
+    }
+
+    entries_.clear();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
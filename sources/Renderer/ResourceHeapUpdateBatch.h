@@ -0,0 +1,87 @@
+/*
+ * ResourceHeapUpdateBatch.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_RESOURCE_HEAP_UPDATE_BATCH_H
+#define LLGL_RESOURCE_HEAP_UPDATE_BATCH_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/ResourceHeapFlags.h>
+#include <LLGL/Container/ArrayView.h>
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Records resource heap writes between RenderSystem::BeginResourceHeapUpdate and RenderSystem::CommitResourceHeapUpdate.
+The recorded writes are coalesced into contiguous descriptor ranges, so backends can write them in a single pass.
+*/
+class LLGL_EXPORT ResourceHeapUpdateBatch
+{
+
+    public:
+
+        // Contiguous range of descriptors after the recorded writes have been resolved.
+        struct Range
+        {
+            std::uint32_t firstDescriptor;
+            std::uint32_t numDescriptors;
+        };
+
+    public:
+
+        // Starts recording writes. Returns false if the batch has already been started.
+        bool Begin();
+
+        // Records the non-empty resource views for the specified descriptor range and returns their number.
+        // Returns 0 if the range exceeds the specified number of descriptors, same as an immediate write.
+        std::uint32_t Record(
+            std::uint32_t                               firstDescriptor,
+            const ArrayView<ResourceViewDescriptor>&    resourceViews,
+            std::uint32_t                               numDescriptors
+        );
+
+        /*
+        Stops recording and resolves all recorded writes into contiguous ranges in ascending order.
+        Later writes to the same descriptor override earlier ones. The resource views of all ranges are stored consecutively in 'outResourceViews'.
+        */
+        void Resolve(std::vector<Range>& outRanges, std::vector<ResourceViewDescriptor>& outResourceViews);
+
+        // Returns true if this batch is currently recording writes.
+        inline bool IsActive() const
+        {
+            return isActive_;
+        }
+
+    private:
+
+        struct Entry
+        {
+            std::uint32_t           descriptor;
+            ResourceViewDescriptor  resourceView;
+        };
+
+    private:
+
+        std::vector<Entry>  entries_;
+        bool                isActive_   = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
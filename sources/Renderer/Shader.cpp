@@ -17,6 +17,11 @@ Shader::Shader(const ShaderType type) :
 {
 }
 
+Blob Shader::GetBinary() const
+{
+    return Blob{}; // dummy
+}
+
 
 } // /namespace LLGL
 
@@ -0,0 +1,528 @@
+/*
+ * ShaderVariantCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ShaderVariantCache.h"
+#include "../Core/CoreUtils.h"
+#include "../Core/StringUtils.h"
+#include <LLGL/RenderSystem.h>
+#include <LLGL/Shader.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+#include "../Core/PackStructPush.inl"
+
+struct ShaderVariantCacheHeader
+{
+    char            magic[4];
+    std::uint32_t   version;
+    std::int32_t    rendererID;
+    std::uint32_t   numEntries;
+}
+LLGL_PACK_STRUCT;
+
+struct ShaderVariantCacheEntry
+{
+    std::uint64_t   hash;
+    std::uint32_t   keySize;
+    std::uint32_t   binarySize;
+}
+LLGL_PACK_STRUCT;
+
+#include "../Core/PackStructPop.inl"
+
+static constexpr char           g_shaderVariantCacheMagic[4]    = { 'L', 'L', 'S', 'V' };
+static constexpr std::uint32_t  g_shaderVariantCacheVersion     = 1;
+
+
+/*
+ * Internal functions
+ */
+
+// 64-bit FNV-1a hash function.
+static std::uint64_t HashBytes(const void* data, std::size_t size, std::uint64_t hash = 0xCBF29CE484222325ull)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for_range(i, size)
+    {
+        hash ^= bytes[i];
+        hash *= 0x00000100000001B3ull;
+    }
+    return hash;
+}
+
+static void AppendKeyBytes(std::string& key, const void* data, std::size_t size)
+{
+    key.append(static_cast<const char*>(data), size);
+}
+
+template <typename T>
+static void AppendKeyValue(std::string& key, const T& value)
+{
+    AppendKeyBytes(key, &value, sizeof(value));
+}
+
+static void AppendKeyString(std::string& key, const char* str)
+{
+    /* Distinguish between null and empty strings by an invalid length */
+    if (str != nullptr)
+    {
+        const std::uint32_t len = static_cast<std::uint32_t>(::strlen(str));
+        AppendKeyValue(key, len);
+        AppendKeyBytes(key, str, len);
+    }
+    else
+        AppendKeyValue(key, ~0u);
+}
+
+static void AppendKeyVertexAttribs(std::string& key, const std::vector<VertexAttribute>& attribs)
+{
+    AppendKeyValue(key, static_cast<std::uint32_t>(attribs.size()));
+    for (const VertexAttribute& attrib : attribs)
+    {
+        AppendKeyString(key, attrib.name.c_str());
+        AppendKeyValue(key, attrib.format);
+        AppendKeyValue(key, attrib.location);
+        AppendKeyValue(key, attrib.semanticIndex);
+        AppendKeyValue(key, attrib.systemValue);
+        AppendKeyValue(key, attrib.slot);
+        AppendKeyValue(key, attrib.offset);
+        AppendKeyValue(key, attrib.stride);
+        AppendKeyValue(key, attrib.instanceDivisor);
+    }
+}
+
+static void AppendKeyFragmentAttribs(std::string& key, const std::vector<FragmentAttribute>& attribs)
+{
+    AppendKeyValue(key, static_cast<std::uint32_t>(attribs.size()));
+    for (const FragmentAttribute& attrib : attribs)
+    {
+        AppendKeyString(key, attrib.name.c_str());
+        AppendKeyValue(key, attrib.format);
+        AppendKeyValue(key, attrib.location);
+        AppendKeyValue(key, attrib.systemValue);
+    }
+}
+
+// Returns the sorted and null-terminated list of macros. If a macro is defined multiple times, the last definition takes precedence.
+static std::vector<ShaderMacro> GetNormalizedShaderMacros(const ShaderMacro* defines)
+{
+    std::vector<ShaderMacro> macros;
+
+    if (defines != nullptr)
+    {
+        for (; defines->name != nullptr; ++defines)
+            macros.push_back(*defines);
+
+        std::stable_sort(
+            macros.begin(),
+            macros.end(),
+            [](const ShaderMacro& lhs, const ShaderMacro& rhs) -> bool
+            {
+                return (::strcmp(lhs.name, rhs.name) < 0);
+            }
+        );
+
+        /* Remove duplicate macro names but keep their last definition */
+        std::size_t numMacros = 0;
+        for (const ShaderMacro& macro : macros)
+        {
+            if (numMacros > 0 && ::strcmp(macros[numMacros - 1].name, macro.name) == 0)
+                macros[numMacros - 1] = macro;
+            else
+                macros[numMacros++] = macro;
+        }
+        macros.resize(numMacros);
+    }
+
+    macros.push_back(ShaderMacro{ nullptr, nullptr });
+
+    return macros;
+}
+
+static void AppendKeySourceContent(std::string& key, const ShaderDescriptor& shaderDesc)
+{
+    std::uint64_t   contentHash = 0;
+    std::uint64_t   contentSize = 0;
+
+    switch (shaderDesc.sourceType)
+    {
+        case ShaderSourceType::CodeString:
+        {
+            const std::size_t len = (shaderDesc.sourceSize > 0 ? shaderDesc.sourceSize : ::strlen(shaderDesc.source));
+            contentHash = HashBytes(shaderDesc.source, len);
+            contentSize = len;
+        }
+        break;
+
+        case ShaderSourceType::CodeFile:
+        {
+            const std::string content = ReadFileString(shaderDesc.source);
+            contentHash = HashBytes(content.data(), content.size());
+            contentSize = content.size();
+        }
+        break;
+
+        case ShaderSourceType::BinaryBuffer:
+        {
+            contentHash = HashBytes(shaderDesc.source, shaderDesc.sourceSize);
+            contentSize = shaderDesc.sourceSize;
+        }
+        break;
+
+        case ShaderSourceType::BinaryFile:
+        {
+            const std::vector<char> content = ReadFileBuffer(shaderDesc.source);
+            contentHash = HashBytes(content.data(), content.size());
+            contentSize = content.size();
+        }
+        break;
+    }
+
+    AppendKeyValue(key, static_cast<std::uint32_t>(IsShaderSourceBinary(shaderDesc.sourceType) ? 1 : 0));
+    AppendKeyValue(key, contentHash);
+    AppendKeyValue(key, contentSize);
+}
+
+// Builds the shader variant key. Macros are expected to be normalized with GetNormalizedShaderMacros().
+static std::string BuildShaderVariantKey(const ShaderDescriptor& shaderDesc, const std::vector<ShaderMacro>& macros)
+{
+    std::string key;
+
+    AppendKeyValue(key, shaderDesc.type);
+    AppendKeySourceContent(key, shaderDesc);
+    AppendKeyString(key, shaderDesc.entryPoint);
+    AppendKeyString(key, shaderDesc.profile);
+
+    /* Macros are only considered for source code; the last entry is the null terminator */
+    if (IsShaderSourceCode(shaderDesc.sourceType))
+    {
+        AppendKeyValue(key, static_cast<std::uint32_t>(macros.size() - 1));
+        for_range(i, macros.size() - 1)
+        {
+            AppendKeyString(key, macros[i].name);
+            AppendKeyString(key, macros[i].definition);
+        }
+    }
+
+    AppendKeyValue(key, static_cast<std::int64_t>(shaderDesc.flags));
+    AppendKeyVertexAttribs(key, shaderDesc.vertex.inputAttribs);
+    AppendKeyVertexAttribs(key, shaderDesc.vertex.outputAttribs);
+    AppendKeyFragmentAttribs(key, shaderDesc.fragment.outputAttribs);
+    AppendKeyValue(key, shaderDesc.compute.workGroupSize);
+
+    return key;
+}
+
+
+/*
+ * ShaderVariantCache class
+ */
+
+Shader* ShaderVariantCache::FindOrCreate(RenderSystem& renderSystem, const ShaderDescriptor& shaderDesc)
+{
+    /* Build shader variant key from normalized descriptor */
+    const std::vector<ShaderMacro> macros = GetNormalizedShaderMacros(shaderDesc.defines);
+    std::string key = BuildShaderVariantKey(shaderDesc, macros);
+    const std::uint64_t hash = HashBytes(key.data(), key.size());
+
+    /* Try to find shader variant with same key */
+    std::size_t insertionIndex = 0;
+    std::unique_ptr<Entry>* entry = FindInSortedArray<std::unique_ptr<Entry>>(
+        entries_.data(),
+        entries_.size(),
+        [hash, &key](const std::unique_ptr<Entry>& entry) -> int
+        {
+            return ShaderVariantCache::CompareSWO(*entry, hash, key);
+        },
+        &insertionIndex
+    );
+
+    if (entry != nullptr)
+    {
+        ++numHits_;
+        ++(*entry)->refCount;
+        return (*entry)->shader;
+    }
+
+    ++numMisses_;
+
+    /* Forward normalized macros to the backend so the compiled shader always matches its key */
+    ShaderDescriptor variantDesc = shaderDesc;
+    variantDesc.defines = (macros.size() > 1 ? macros.data() : nullptr);
+
+    Shader* shader = nullptr;
+
+    /* Try to create shader from persistent binary first */
+    PersistentBinary* binary = FindInSortedArray<PersistentBinary>(
+        binaries_.data(),
+        binaries_.size(),
+        [hash, &key](const PersistentBinary& binary) -> int
+        {
+            return ShaderVariantCache::CompareSWO(binary, hash, key);
+        }
+    );
+
+    if (binary != nullptr)
+    {
+        ShaderDescriptor binaryDesc = variantDesc;
+        {
+            binaryDesc.source       = binary->data.get();
+            binaryDesc.sourceSize   = binary->data.size();
+            binaryDesc.sourceType   = ShaderSourceType::BinaryBuffer;
+            binaryDesc.defines      = nullptr;
+        }
+        shader = renderSystem.CreateShader(binaryDesc);
+
+        /* Fall back to regular compilation if the binary is no longer compatible, e.g. after a driver update */
+        const Report* report = (shader != nullptr ? shader->GetReport() : nullptr);
+        if (report != nullptr && report->HasErrors())
+        {
+            renderSystem.Release(*shader);
+            shader = nullptr;
+        }
+        else if (shader != nullptr)
+            ++numBinaryLoads_;
+    }
+
+    if (shader == nullptr)
+        shader = renderSystem.CreateShader(variantDesc);
+
+    if (shader == nullptr)
+        return nullptr;
+
+    /* Insert new entry with insertion sort */
+    auto newEntry = MakeUnique<Entry>();
+    {
+        newEntry->hash      = hash;
+        newEntry->key       = std::move(key);
+        newEntry->shader    = shader;
+        newEntry->refCount  = 1;
+    }
+    entries_.insert(entries_.begin() + insertionIndex, std::move(newEntry));
+
+    return shader;
+}
+
+bool ShaderVariantCache::Release(RenderSystem& renderSystem, Shader& shader)
+{
+    auto it = std::find_if(
+        entries_.begin(),
+        entries_.end(),
+        [&shader](const std::unique_ptr<Entry>& entry) -> bool
+        {
+            return (entry->shader == &shader);
+        }
+    );
+
+    if (it == entries_.end())
+        return false;
+
+    if (--(*it)->refCount == 0)
+    {
+        renderSystem.Release(shader);
+        entries_.erase(it);
+    }
+
+    return true;
+}
+
+void ShaderVariantCache::GetStatistics(ShaderVariantCacheStatistics& outStats) const
+{
+    outStats.numVariants    = static_cast<std::uint32_t>(entries_.size());
+    outStats.numHits        = numHits_;
+    outStats.numMisses      = numMisses_;
+    outStats.numBinaryLoads = numBinaryLoads_;
+
+    const std::uint64_t numLookups = numHits_ + numMisses_;
+    outStats.hitRate = (numLookups > 0 ? static_cast<float>(static_cast<double>(numHits_) / static_cast<double>(numLookups)) : 0.0f);
+}
+
+Blob ShaderVariantCache::GetBlob(int rendererID) const
+{
+    /* Gather binaries of all live shader variants that the backend can export */
+    std::vector<Blob> liveBinaries;
+    liveBinaries.reserve(entries_.size());
+
+    for (const std::unique_ptr<Entry>& entry : entries_)
+        liveBinaries.push_back(entry->shader->GetBinary());
+
+    /* Determine size of all cache entries */
+    ShaderVariantCacheHeader header = {};
+    ::memcpy(header.magic, g_shaderVariantCacheMagic, sizeof(header.magic));
+    header.version      = g_shaderVariantCacheVersion;
+    header.rendererID   = static_cast<std::int32_t>(rendererID);
+
+    std::size_t cacheSize = sizeof(header);
+
+    for_range(i, entries_.size())
+    {
+        if (liveBinaries[i].GetSize() > 0)
+        {
+            cacheSize += sizeof(ShaderVariantCacheEntry) + entries_[i]->key.size() + liveBinaries[i].GetSize();
+            ++header.numEntries;
+        }
+    }
+
+    /* Keep persistent binaries that have not been requested in this run */
+    std::vector<const PersistentBinary*> unusedBinaries;
+
+    for (const PersistentBinary& binary : binaries_)
+    {
+        auto it = std::find_if(
+            entries_.begin(),
+            entries_.end(),
+            [&binary](const std::unique_ptr<Entry>& entry) -> bool
+            {
+                return (entry->hash == binary.hash && entry->key == binary.key);
+            }
+        );
+        if (it == entries_.end())
+        {
+            cacheSize += sizeof(ShaderVariantCacheEntry) + binary.key.size() + binary.data.size();
+            unusedBinaries.push_back(&binary);
+            ++header.numEntries;
+        }
+    }
+
+    if (header.numEntries == 0)
+        return Blob{};
+
+    /* Allocate cache blob including header */
+    DynamicByteArray cache{ cacheSize, UninitializeTag{} };
+
+    char* bytes = cache.get();
+
+    auto WriteBytes = [&bytes](const void* src, std::size_t len) -> void
+    {
+        ::memcpy(bytes, src, len);
+        bytes += len;
+    };
+
+    auto WriteEntry = [&WriteBytes](std::uint64_t hash, const std::string& key, const void* binaryData, std::size_t binarySize) -> void
+    {
+        ShaderVariantCacheEntry entryHeader;
+        entryHeader.hash        = hash;
+        entryHeader.keySize     = static_cast<std::uint32_t>(key.size());
+        entryHeader.binarySize  = static_cast<std::uint32_t>(binarySize);
+        WriteBytes(&entryHeader, sizeof(entryHeader));
+        WriteBytes(key.data(), key.size());
+        WriteBytes(binaryData, binarySize);
+    };
+
+    WriteBytes(&header, sizeof(header));
+
+    for_range(i, entries_.size())
+    {
+        if (liveBinaries[i].GetSize() > 0)
+            WriteEntry(entries_[i]->hash, entries_[i]->key, liveBinaries[i].GetData(), liveBinaries[i].GetSize());
+    }
+
+    for (const PersistentBinary* binary : unusedBinaries)
+        WriteEntry(binary->hash, binary->key, binary->data.get(), binary->data.size());
+
+    return Blob::CreateStrongRef(std::move(cache));
+}
+
+bool ShaderVariantCache::SetBlob(const Blob& blob, int rendererID)
+{
+    binaries_.clear();
+
+    const char*         bytes       = static_cast<const char*>(blob.GetData());
+    const std::size_t   blobSize    = blob.GetSize();
+
+    /* Validate header */
+    if (bytes == nullptr || blobSize < sizeof(ShaderVariantCacheHeader))
+        return false;
+
+    ShaderVariantCacheHeader header;
+    ::memcpy(&header, bytes, sizeof(header));
+
+    if (::memcmp(header.magic, g_shaderVariantCacheMagic, sizeof(header.magic)) != 0 ||
+        header.version != g_shaderVariantCacheVersion ||
+        header.rendererID != static_cast<std::int32_t>(rendererID))
+    {
+        return false;
+    }
+
+    /* Read all entries and reject the entire blob if any of them exceeds the blob size */
+    std::size_t offset = sizeof(header);
+
+    binaries_.reserve(header.numEntries);
+
+    for_range(i, header.numEntries)
+    {
+        ShaderVariantCacheEntry entryHeader;
+        if (offset + sizeof(entryHeader) > blobSize)
+            break;
+
+        ::memcpy(&entryHeader, bytes + offset, sizeof(entryHeader));
+        offset += sizeof(entryHeader);
+
+        if (offset + entryHeader.keySize + entryHeader.binarySize > blobSize)
+            break;
+
+        PersistentBinary binary;
+        {
+            binary.hash = entryHeader.hash;
+            binary.key  = std::string{ bytes + offset, entryHeader.keySize };
+            offset += entryHeader.keySize;
+            binary.data = DynamicByteArray{ bytes + offset, bytes + offset + entryHeader.binarySize };
+            offset += entryHeader.binarySize;
+        }
+        binaries_.push_back(std::move(binary));
+    }
+
+    if (binaries_.size() != header.numEntries)
+    {
+        binaries_.clear();
+        return false;
+    }
+
+    /* Sort in the same order as FindInSortedArray() expects for CompareSWO() */
+    std::sort(
+        binaries_.begin(),
+        binaries_.end(),
+        [](const PersistentBinary& lhs, const PersistentBinary& rhs) -> bool
+        {
+            return (ShaderVariantCache::CompareSWO(lhs, rhs.hash, rhs.key) > 0);
+        }
+    );
+
+    return true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+template <typename T>
+int ShaderVariantCache::CompareSWO(const T& lhs, std::uint64_t hash, const std::string& key)
+{
+    if (lhs.hash < hash)
+        return -1;
+    if (lhs.hash > hash)
+        return +1;
+    return lhs.key.compare(key);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,99 @@
+/*
+ * ShaderVariantCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_SHADER_VARIANT_CACHE_H
+#define LLGL_SHADER_VARIANT_CACHE_H
+
+
+#include <LLGL/ShaderFlags.h>
+#include <LLGL/Blob.h>
+#include <LLGL/Container/DynamicArray.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class Shader;
+
+/*
+Cache of shared shader objects that are identified by their shader variant key.
+The key is built from the shader source content, the sorted and deduplicated macro set, entry point, profile, compile flags, and stage attributes.
+Compiled binaries can be exported into a blob and are used to create shaders without recompilation in subsequent runs.
+*/
+class ShaderVariantCache
+{
+
+    public:
+
+        ShaderVariantCache() = default;
+
+        ShaderVariantCache(const ShaderVariantCache&) = delete;
+        ShaderVariantCache& operator = (const ShaderVariantCache&) = delete;
+
+        // Returns the shared shader for the specified descriptor and creates it with the specified render system on a cache miss.
+        Shader* FindOrCreate(RenderSystem& renderSystem, const ShaderDescriptor& shaderDesc);
+
+        // Decrements the reference counter of the specified shader and releases it with the specified render system once it reaches zero.
+        bool Release(RenderSystem& renderSystem, Shader& shader);
+
+        // Returns the cache statistics.
+        void GetStatistics(ShaderVariantCacheStatistics& outStats) const;
+
+        // Returns a blob with all shader binaries the backend can export.
+        Blob GetBlob(int rendererID) const;
+
+        // Initializes the persistent shader binaries from the specified blob. Returns false if the blob is invalid or was created by another renderer.
+        bool SetBlob(const Blob& blob, int rendererID);
+
+    private:
+
+        struct Entry
+        {
+            std::uint64_t   hash        = 0;
+            std::string     key;
+            Shader*         shader      = nullptr;
+            std::uint32_t   refCount    = 0;
+        };
+
+        struct PersistentBinary
+        {
+            std::uint64_t       hash    = 0;
+            std::string         key;
+            DynamicByteArray    data;
+        };
+
+    private:
+
+        template <typename T>
+        static int CompareSWO(const T& lhs, std::uint64_t hash, const std::string& key);
+
+    private:
+
+        std::vector<std::unique_ptr<Entry>> entries_;   // Sorted by hash and key
+        std::vector<PersistentBinary>       binaries_;  // Sorted by hash and key
+
+        std::uint64_t                       numHits_        = 0;
+        std::uint64_t                       numMisses_      = 0;
+        std::uint64_t                       numBinaryLoads_ = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,182 @@
+/*
+ * StaticCommandBuffer.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/*
+Implements the StaticCommandBuffer interface for the statically linked backend.
+This file must be included by the backend's command buffer source file after LLGL_STATIC_COMMAND_BUFFER has been defined as the final command buffer class of that backend.
+Since that class is final, all calls below are resolved at compile time.
+*/
+
+#ifndef LLGL_STATIC_COMMAND_BUFFER
+#   error Missing definition of LLGL_STATIC_COMMAND_BUFFER before including StaticCommandBuffer.inl
+#endif
+
+#include <LLGL/StaticCommandBuffer.h>
+#include "CheckedCast.h"
+
+
+namespace LLGL
+{
+
+
+static inline LLGL_STATIC_COMMAND_BUFFER& GetStaticCommandBuffer(CommandBuffer& commandBuffer)
+{
+    return static_cast<LLGL_STATIC_COMMAND_BUFFER&>(commandBuffer);
+}
+
+StaticCommandBuffer::StaticCommandBuffer(CommandBuffer& commandBuffer) :
+    commandBuffer_ { *LLGL_CAST(LLGL_STATIC_COMMAND_BUFFER*, &commandBuffer) }
+{
+}
+
+/* ----- Encoding ----- */
+
+void StaticCommandBuffer::Begin()
+{
+    GetStaticCommandBuffer(commandBuffer_).Begin();
+}
+
+void StaticCommandBuffer::End()
+{
+    GetStaticCommandBuffer(commandBuffer_).End();
+}
+
+/* ----- Viewport and Scissor ----- */
+
+void StaticCommandBuffer::SetViewport(const Viewport& viewport)
+{
+    GetStaticCommandBuffer(commandBuffer_).SetViewport(viewport);
+}
+
+void StaticCommandBuffer::SetScissor(const Scissor& scissor)
+{
+    GetStaticCommandBuffer(commandBuffer_).SetScissor(scissor);
+}
+
+/* ----- Input Assembly ------ */
+
+void StaticCommandBuffer::SetVertexBuffer(Buffer& buffer)
+{
+    GetStaticCommandBuffer(commandBuffer_).SetVertexBuffer(buffer);
+}
+
+void StaticCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+{
+    GetStaticCommandBuffer(commandBuffer_).SetVertexBufferArray(bufferArray);
+}
+
+void StaticCommandBuffer::SetIndexBuffer(Buffer& buffer)
+{
+    GetStaticCommandBuffer(commandBuffer_).SetIndexBuffer(buffer);
+}
+
+void StaticCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
+{
+    GetStaticCommandBuffer(commandBuffer_).SetIndexBuffer(buffer, format, offset);
+}
+
+/* ----- Resources ----- */
+
+void StaticCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet)
+{
+    GetStaticCommandBuffer(commandBuffer_).SetResourceHeap(resourceHeap, descriptorSet);
+}
+
+void StaticCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
+{
+    GetStaticCommandBuffer(commandBuffer_).SetResource(descriptor, resource);
+}
+
+/* ----- Render Passes ----- */
+
+void StaticCommandBuffer::BeginRenderPass(
+    RenderTarget&       renderTarget,
+    const RenderPass*   renderPass,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues,
+    std::uint32_t       swapBufferIndex)
+{
+    GetStaticCommandBuffer(commandBuffer_).BeginRenderPass(renderTarget, renderPass, numClearValues, clearValues, swapBufferIndex);
+}
+
+void StaticCommandBuffer::EndRenderPass()
+{
+    GetStaticCommandBuffer(commandBuffer_).EndRenderPass();
+}
+
+void StaticCommandBuffer::Clear(long flags, const ClearValue& clearValue)
+{
+    GetStaticCommandBuffer(commandBuffer_).Clear(flags, clearValue);
+}
+
+/* ----- Pipeline States ----- */
+
+void StaticCommandBuffer::SetPipelineState(PipelineState& pipelineState)
+{
+    GetStaticCommandBuffer(commandBuffer_).SetPipelineState(pipelineState);
+}
+
+void StaticCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
+{
+    GetStaticCommandBuffer(commandBuffer_).SetUniforms(first, data, dataSize);
+}
+
+/* ----- Drawing ----- */
+
+void StaticCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
+{
+    GetStaticCommandBuffer(commandBuffer_).Draw(numVertices, firstVertex);
+}
+
+void StaticCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
+{
+    GetStaticCommandBuffer(commandBuffer_).DrawIndexed(numIndices, firstIndex);
+}
+
+void StaticCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    GetStaticCommandBuffer(commandBuffer_).DrawIndexed(numIndices, firstIndex, vertexOffset);
+}
+
+void StaticCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
+{
+    GetStaticCommandBuffer(commandBuffer_).DrawInstanced(numVertices, firstVertex, numInstances);
+}
+
+void StaticCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
+{
+    GetStaticCommandBuffer(commandBuffer_).DrawInstanced(numVertices, firstVertex, numInstances, firstInstance);
+}
+
+void StaticCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
+{
+    GetStaticCommandBuffer(commandBuffer_).DrawIndexedInstanced(numIndices, numInstances, firstIndex);
+}
+
+void StaticCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    GetStaticCommandBuffer(commandBuffer_).DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset);
+}
+
+void StaticCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
+{
+    GetStaticCommandBuffer(commandBuffer_).DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+}
+
+/* ----- Compute ----- */
+
+void StaticCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    GetStaticCommandBuffer(commandBuffer_).Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
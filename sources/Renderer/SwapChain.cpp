@@ -114,6 +114,11 @@ bool SwapChain::ResizeBuffers(const Extent2D& resolution, long flags)
     return false;
 }
 
+bool SwapChain::GetFrameTimings(SwapChainFrameTimings& /*outTimings*/) const
+{
+    return false; // dummy
+}
+
 /* ----- Configuration ----- */
 
 bool SwapChain::SwitchFullscreen(bool enable)
@@ -10,6 +10,7 @@
 
 
 #include <LLGL/TextureFlags.h>
+#include <LLGL/MemoryHeapFlags.h>
 
 
 namespace LLGL
@@ -99,6 +100,15 @@ LLGL_EXPORT void CompressTextureViewDesc(CompressedTexView& dst, const TextureVi
 // Compares the two texture views in a strict-weak-order (SWO).
 LLGL_EXPORT int CompareCompressedTexViewSWO(const CompressedTexView& lhs, const CompressedTexView& rhs);
 
+// Returns the kind of memory heap resource the specified texture is, i.e. either MemoryHeapResourceFlags::Textures or MemoryHeapResourceFlags::AttachmentTextures.
+inline long GetMemoryHeapResourceFlags(const TextureDescriptor& textureDesc)
+{
+    if ((textureDesc.bindFlags & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) != 0)
+        return MemoryHeapResourceFlags::AttachmentTextures;
+    else
+        return MemoryHeapResourceFlags::Textures;
+}
+
 // Returns true if the texture-view in the specified resource-view descriptor is enabled.
 inline bool IsTextureViewEnabled(const TextureViewDescriptor& textureViewDesc)
 {
@@ -11,6 +11,7 @@
 
 #include "../Core/Assertion.h"
 #include "../Core/CoreUtils.h"
+#include "../Core/MemoryAllocation.h"
 #include <cstddef>
 #include <algorithm>
 #include <iterator>
@@ -267,7 +268,7 @@ class VirtualCommandBuffer
         // Allocates a new memory chunk of the specified capacity plus sizeof(Chunk).
         static Chunk* AllocChunk(std::size_t capacity, Chunk* next = nullptr)
         {
-            Chunk* chunk = reinterpret_cast<Chunk*>(::new char[sizeof(Chunk) + capacity]);
+            Chunk* chunk = reinterpret_cast<Chunk*>(AllocateMemory(sizeof(Chunk) + capacity, alignof(std::max_align_t), AllocationCategory::CommandBuffer));
             {
                 chunk->capacity = capacity;
                 chunk->size     = 0;
@@ -280,10 +281,7 @@ class VirtualCommandBuffer
         static void FreeChunk(Chunk* chunk)
         {
             if (chunk != nullptr)
-            {
-                char* buf = reinterpret_cast<char*>(chunk);
-                delete [] buf;
-            }
+                FreeMemory(chunk, sizeof(Chunk) + chunk->capacity, alignof(std::max_align_t), AllocationCategory::CommandBuffer);
         }
 
         // Returns a raw pointer to the beginning of the chunk data.
@@ -14,6 +14,7 @@
 #include "../../ResourceUtils.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Exception.h"
+#include "../../../Core/Assertion.h"
 #include <LLGL/Backend/Vulkan/NativeHandle.h>
 
 
@@ -103,6 +104,22 @@ static VkAccessFlags GetBufferVkAccessFlags(long bindFlags)
     return accessFlags;
 }
 
+/*
+Returns true if the buffer can be moved to another memory region by the device memory defragmentation.
+Only buffers whose native handle is not stored in any descriptor set or other object, i.e. vertex, index, and indirect argument buffers,
+and buffers without a persistent staging buffer are relocatable.
+*/
+static bool IsVKBufferRelocatable(const BufferDescriptor& desc)
+{
+    constexpr long relocatableBindFlags = (BindFlags::VertexBuffer | BindFlags::IndexBuffer | BindFlags::IndirectBuffer | BindFlags::CopySrc | BindFlags::CopyDst);
+    return
+    (
+        (desc.bindFlags & ~relocatableBindFlags) == 0 &&
+        desc.cpuAccessFlags == 0 &&
+        (desc.miscFlags & MiscFlags::DynamicUsage) == 0
+    );
+}
+
 static std::uint32_t GetVKBufferStride(const BufferDescriptor& desc)
 {
     /* Just return first vertex attribute stride, since all attributes must have equal strides within the same buffer */
@@ -118,19 +135,22 @@ VKBuffer::VKBuffer(VkDevice device, const BufferDescriptor& desc) :
     size_             { desc.size                              },
     accessFlags_      { GetBufferVkAccessFlags(desc.bindFlags) },
     format_           { VKTypes::Map(desc.format)              },
-    stride_           { GetVKBufferStride(desc)                }
+    stride_           { GetVKBufferStride(desc)                },
+    isRelocatable_    { IsVKBufferRelocatable(desc)            }
 {
     if ((desc.bindFlags & BindFlags::IndexBuffer) != 0)
         indexType_ = VKTypes::ToVkIndexType(desc.format);
 
     /* Create native Vulkan buffer object */
+    usageFlags_ = GetVkBufferUsageFlags(desc);
+
     VkBufferCreateInfo createInfo;
     {
         createInfo.sType                    = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
         createInfo.pNext                    = nullptr;
         createInfo.flags                    = 0;
         createInfo.size                     = GetInternalSize();
-        createInfo.usage                    = GetVkBufferUsageFlags(desc);
+        createInfo.usage                    = usageFlags_;
         createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
         createInfo.queueFamilyIndexCount    = 0;
         createInfo.pQueueFamilyIndices      = nullptr;
@@ -143,6 +163,47 @@ void VKBuffer::SetStride(std::uint32_t stride)
     stride_ = std::max<std::uint32_t>(1u, stride);
 }
 
+void VKBuffer::DisableRelocation()
+{
+    isRelocatable_ = false;
+}
+
+VKDeviceBuffer VKBuffer::Relocate(VkDevice device, VKDeviceMemoryRegion* memoryRegion)
+{
+    LLGL_ASSERT(isRelocatable_, "cannot relocate Vulkan buffer that is not relocatable");
+    LLGL_ASSERT(persistentMapping_ == nullptr, "cannot relocate Vulkan buffer that is persistently mapped");
+
+    /* Create new native buffer with the same parameters, so it has the same memory requirements */
+    VkBufferCreateInfo createInfo;
+    {
+        createInfo.sType                    = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        createInfo.pNext                    = nullptr;
+        createInfo.flags                    = 0;
+        createInfo.size                     = GetInternalSize();
+        createInfo.usage                    = usageFlags_;
+        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
+        createInfo.queueFamilyIndexCount    = 0;
+        createInfo.pQueueFamilyIndices      = nullptr;
+    }
+    VKDeviceBuffer newBufferObj{ device };
+    newBufferObj.CreateVkBuffer(device, createInfo);
+    newBufferObj.BindMemoryRegion(device, memoryRegion);
+
+    /* Swap native buffers and recreate the buffer view for the new buffer */
+    VKDeviceBuffer oldBufferObj = std::move(bufferObj_);
+    bufferObj_ = std::move(newBufferObj);
+
+    if (bufferView_.Get() != VK_NULL_HANDLE)
+        CreateBufferView(device, bufferView_);
+
+    return oldBufferObj;
+}
+
+void VKBuffer::NotifyTimelineUse(std::uint64_t value)
+{
+    lastTimelineUse_ = value;
+}
+
 void VKBuffer::SetDebugName(const char* name)
 {
     #if VK_EXT_debug_marker
@@ -165,7 +226,7 @@ bool VKBuffer::CreateBufferView(VkDevice device, VKPtr<VkBufferView>& outBufferV
             viewCreateInfo.offset   = offset;
             viewCreateInfo.range    = length;
         }
-        VkResult result = vkCreateBufferView(device, &viewCreateInfo, nullptr, outBufferView.ReleaseAndGetAddressOf());
+        VkResult result = vkCreateBufferView(device, &viewCreateInfo, VKGetAllocationCallbacks(), outBufferView.ReleaseAndGetAddressOf());
         VKThrowIfFailed(result, "failed to create Vulkan buffer view");
         return true;
     }
@@ -176,6 +237,8 @@ bool VKBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
 {
     if (auto* nativeHandleVK = GetTypedNativeHandle<Vulkan::ResourceNativeHandle>(nativeHandle, nativeHandleSize))
     {
+        /* Native handle might be stored by the client, so this buffer must no longer be relocated */
+        DisableRelocation();
         nativeHandleVK->type            = Vulkan::ResourceNativeType::Buffer;
         nativeHandleVK->buffer.buffer   = GetVkBuffer();
         return true;
@@ -211,6 +274,10 @@ void VKBuffer::TakeStagingBuffer(VKDeviceBuffer&& deviceBuffer)
 
 void* VKBuffer::Map(VKDevice& device, const CPUAccess access, VkDeviceSize offset, VkDeviceSize length)
 {
+    /* Host visible device memory is accessed directly; the caller must ensure the GPU is no longer using this buffer */
+    if (persistentMapping_ != nullptr)
+        return static_cast<char*>(persistentMapping_) + offset;
+
     if (VkBuffer stagingBuffer = GetStagingVkBuffer())
     {
         /* Copy GPU local buffer into staging buffer for read accces */
@@ -248,6 +315,28 @@ void VKBuffer::Unmap(VKDevice& device)
     }
 }
 
+void VKBuffer::MapPersistent(VkDevice device)
+{
+    if (persistentMapping_ == nullptr)
+    {
+        persistentMapping_ = bufferObj_.Map(device);
+        if (persistentMapping_ == nullptr)
+            VKThrowIfFailed(VK_ERROR_MEMORY_MAP_FAILED, "failed to map host visible Vulkan buffer into CPU memory space");
+
+        /* Mapping points into the current memory region, so this buffer must no longer be relocated */
+        DisableRelocation();
+    }
+}
+
+void VKBuffer::UnmapPersistent(VkDevice device)
+{
+    if (persistentMapping_ != nullptr)
+    {
+        bufferObj_.Unmap(device);
+        persistentMapping_ = nullptr;
+    }
+}
+
 VkDeviceSize VKBuffer::GetInternalSize() const
 {
     return ((GetBindFlags() & BindFlags::StreamOutputBuffer) != 0 ? GetSize() + k_xfbCounterSize : GetSize());
@@ -41,6 +41,14 @@ class VKBuffer : public Buffer
         void* Map(VKDevice& device, const CPUAccess access, VkDeviceSize offset, VkDeviceSize length);
         void Unmap(VKDevice& device);
 
+        /*
+        Maps the entire hardware buffer into CPU memory space until UnmapPersistent() is called.
+        This must only be used for buffers in host visible device memory, which are then written without staging buffers.
+        Persistently mapped buffers are no longer relocatable.
+        */
+        void MapPersistent(VkDevice device);
+        void UnmapPersistent(VkDevice device);
+
         // Returns the actual size of this buffer.
         // This might be larger than GetSize() if the buffer has additional payload such as the transform-feedback counter.
         VkDeviceSize GetInternalSize() const;
@@ -54,6 +62,18 @@ class VKBuffer : public Buffer
         // Sets the buffer stride and clamps it to \c max(1, stride). This should only be called by VKCommandBuffer::SetVertexBuffer().
         void SetStride(std::uint32_t stride);
 
+        // Prevents this buffer from being relocated by the device memory defragmentation, e.g. because its native handle is referenced elsewhere.
+        void DisableRelocation();
+
+        /*
+        Creates a new native buffer that is bound to the specified memory region and replaces the current one.
+        Returns the previous device buffer, which must be kept alive until the GPU no longer uses it. The buffer content is not copied.
+        */
+        VKDeviceBuffer Relocate(VkDevice device, VKDeviceMemoryRegion* memoryRegion);
+
+        // Stores the queue timeline value of the last submission that references this buffer. Only used for persistently mapped buffers.
+        void NotifyTimelineUse(std::uint64_t value);
+
         // Returns the device buffer object.
         inline VKDeviceBuffer& GetDeviceBuffer()
         {
@@ -120,6 +140,24 @@ class VKBuffer : public Buffer
             return bufferView_.Get();
         }
 
+        // Returns the persistently mapped hardware buffer memory or null if this buffer is not host visible.
+        inline void* GetPersistentMapping() const
+        {
+            return persistentMapping_;
+        }
+
+        // Returns true if this buffer can be relocated by the device memory defragmentation.
+        inline bool IsRelocatable() const
+        {
+            return isRelocatable_;
+        }
+
+        // Returns the queue timeline value of the last submission that references this buffer or 0 if there is none.
+        inline std::uint64_t GetLastTimelineUse() const
+        {
+            return lastTimelineUse_;
+        }
+
     private:
 
         VkDevice            device_                 = VK_NULL_HANDLE;
@@ -131,12 +169,16 @@ class VKBuffer : public Buffer
 
         VkDeviceSize        size_                   = 0;
         VkDeviceSize        mappedWriteRange_[2]    = { 0, 0 };
+        void*               persistentMapping_      = nullptr;
+        std::uint64_t       lastTimelineUse_        = 0;
 
         VkIndexType         indexType_              = VK_INDEX_TYPE_MAX_ENUM;
 
+        VkBufferUsageFlags  usageFlags_             = 0;
         VkAccessFlags       accessFlags_            = 0;
         VkFormat            format_                 = VK_FORMAT_UNDEFINED;
         std::uint32_t       stride_                 = 0;
+        bool                isRelocatable_          = false;
 
 };
 
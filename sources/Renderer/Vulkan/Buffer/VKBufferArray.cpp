@@ -25,11 +25,20 @@ VKBufferArray::VKBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArr
 
     while (VKBuffer* next = NextArrayResource<VKBuffer>(numBuffers, bufferArray))
     {
+        /* Native handles are stored in this array, so the buffers must no longer be relocated */
+        next->DisableRelocation();
         buffers_.push_back(next->GetVkBuffer());
         offsets_.push_back(0);//next->GetOffset()
+        if (next->GetPersistentMapping() != nullptr)
+            mappedBuffers_.push_back(next);
     }
 }
 
+void VKBufferArray::RemoveMappedBuffer(const VKBuffer* bufferVK)
+{
+    RemoveAllFromList(mappedBuffers_, bufferVK);
+}
+
 
 } // /namespace LLGL
 
@@ -20,6 +20,7 @@ namespace LLGL
 
 
 class Buffer;
+class VKBuffer;
 
 class VKBufferArray final : public BufferArray
 {
@@ -40,10 +41,20 @@ class VKBufferArray final : public BufferArray
             return offsets_;
         }
 
+        // Returns the persistently mapped buffers of this array.
+        inline const std::vector<VKBuffer*>& GetMappedBuffers() const
+        {
+            return mappedBuffers_;
+        }
+
+        // Removes the specified buffer from the list of mapped buffers, because it is about to be released.
+        void RemoveMappedBuffer(const VKBuffer* bufferVK);
+
     private:
 
         std::vector<VkBuffer>       buffers_;
         std::vector<VkDeviceSize>   offsets_;
+        std::vector<VKBuffer*>      mappedBuffers_;
 
 };
 
@@ -75,9 +75,26 @@ void VKStagingBuffer::Reset()
     offset_ = 0;
 }
 
-bool VKStagingBuffer::Capacity(VkDeviceSize dataSize) const
+bool VKStagingBuffer::Capacity(VkDeviceSize dataSize, VkDeviceSize alignment) const
 {
-    return (offset_ + dataSize <= size_);
+    return (GetAlignedSize(offset_, alignment) + dataSize <= size_);
+}
+
+VkDeviceSize VKStagingBuffer::Allocate(VkDeviceSize dataSize, VkDeviceSize alignment)
+{
+    const VkDeviceSize offset = GetAlignedSize(offset_, alignment);
+    offset_ = offset + dataSize;
+    return offset;
+}
+
+void* VKStagingBuffer::Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size)
+{
+    return bufferObj_.Map(device, offset, size);
+}
+
+void VKStagingBuffer::Unmap(VkDevice device)
+{
+    bufferObj_.Unmap(device);
 }
 
 VkResult VKStagingBuffer::Write(
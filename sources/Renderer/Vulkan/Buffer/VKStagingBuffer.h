@@ -48,8 +48,17 @@ class VKStagingBuffer
         // Resets the writing offset.
         void Reset();
 
-        // Returns true if the remaining buffer size can fit the specified data size.
-        bool Capacity(VkDeviceSize dataSize) const;
+        // Returns true if the remaining buffer size can fit the specified data size at the next aligned offset.
+        bool Capacity(VkDeviceSize dataSize, VkDeviceSize alignment = 1) const;
+
+        // Reserves a region of the specified size at the next aligned offset and returns the start offset of that region.
+        VkDeviceSize Allocate(VkDeviceSize dataSize, VkDeviceSize alignment = 1);
+
+        // Maps the specified region of the upload buffer into CPU memory space.
+        void* Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size);
+
+        // Unmaps the upload buffer from CPU memory space.
+        void Unmap(VkDevice device);
 
         // Writes the specified data to the native Vulkan upload buffer.
         VkResult Write(
@@ -42,9 +42,28 @@ VkResult VKStagingBufferPool::WriteStaged(
     VkDeviceSize    dstOffset,
     const void*     data,
     VkDeviceSize    dataSize)
+{
+    /* Write data to current chunk */
+    VKStagingBuffer& chunk = FindOrAllocChunk(dataSize, 1);
+    return chunk.WriteAndIncrementOffset(deviceMemoryMngr_->GetVkDevice(), commandBuffer, dstBuffer, dstOffset, data, dataSize);
+}
+
+VKStagingBuffer& VKStagingBufferPool::AllocRegion(VkDeviceSize dataSize, VkDeviceSize alignment, VkDeviceSize& outOffset)
+{
+    VKStagingBuffer& chunk = FindOrAllocChunk(dataSize, alignment);
+    outOffset = chunk.Allocate(dataSize, alignment);
+    return chunk;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKStagingBuffer& VKStagingBufferPool::FindOrAllocChunk(VkDeviceSize dataSize, VkDeviceSize alignment)
 {
     /* Find a chunk that fits the requested data size or allocate a new chunk */
-    while (chunkIdx_ < chunks_.size() && !chunks_[chunkIdx_].Capacity(dataSize))
+    while (chunkIdx_ < chunks_.size() && !chunks_[chunkIdx_].Capacity(dataSize, alignment))
     {
         chunks_[chunkIdx_].Reset();
         ++chunkIdx_;
@@ -53,16 +72,9 @@ VkResult VKStagingBufferPool::WriteStaged(
     if (chunkIdx_ == chunks_.size())
         AllocChunk(dataSize);
 
-    /* Write data to current chunk */
-    VKStagingBuffer& chunk = chunks_[chunkIdx_];
-    return chunk.WriteAndIncrementOffset(deviceMemoryMngr_->GetVkDevice(), commandBuffer, dstBuffer, dstOffset, data, dataSize);
+    return chunks_[chunkIdx_];
 }
 
-
-/*
- * ======= Private: =======
- */
-
 void VKStagingBufferPool::AllocChunk(VkDeviceSize minChunkSize)
 {
     LLGL_ASSERT_PTR(deviceMemoryMngr_);
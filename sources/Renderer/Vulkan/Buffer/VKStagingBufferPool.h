@@ -43,8 +43,17 @@ class VKStagingBufferPool
             VkDeviceSize    dataSize
         );
 
+        /*
+        Reserves a region with the specified size and alignment in one of the chunks and returns that chunk.
+        The start offset of the region within the returned chunk is written to 'outOffset'.
+        */
+        VKStagingBuffer& AllocRegion(VkDeviceSize dataSize, VkDeviceSize alignment, VkDeviceSize& outOffset);
+
     private:
 
+        // Finds the next chunk that can fit the specified data size or allocates a new one.
+        VKStagingBuffer& FindOrAllocChunk(VkDeviceSize dataSize, VkDeviceSize alignment);
+
         // Allocates a new chunk with the specified minimal size.
         void AllocChunk(VkDeviceSize minChunkSize);
 
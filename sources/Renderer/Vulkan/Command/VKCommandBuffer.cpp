@@ -17,6 +17,7 @@
 #include "../RenderState/VKComputePSO.h"
 #include "../RenderState/VKResourceHeap.h"
 #include "../RenderState/VKPredicateQueryHeap.h"
+#include "../RenderState/VKHostQueryHeap.h"
 #include "../Texture/VKSampler.h"
 #include "../Texture/VKTexture.h"
 #include "../Texture/VKImageUtils.h"
@@ -40,6 +41,13 @@ namespace LLGL
 
 constexpr std::uint32_t VKCommandBuffer::maxNumCommandBuffers;
 
+// Returns the minimum size of each staging buffer pool
+static VkDeviceSize GetMinStagingPoolSize(const CommandBufferDescriptor& desc)
+{
+    constexpr VkDeviceSize minStagingChunkSize = 256;
+    return std::max(minStagingChunkSize, static_cast<VkDeviceSize>(desc.minStagingPoolSize));
+}
+
 // Returns the maximum for a indirect multi draw command
 static std::uint32_t GetMaxDrawIndirectCount(const VKPhysicalDevice& physicalDevice)
 {
@@ -55,18 +63,20 @@ VKCommandBuffer::VKCommandBuffer(
     VkQueue                         commandQueue,
     VKDeviceMemoryManager&          deviceMemoryMngr,
     const VKQueueFamilyIndices&     queueFamilyIndices,
-    const CommandBufferDescriptor&  desc)
+    const CommandBufferDescriptor&  desc,
+    VKCommandQueue*                 commandQueueVK)
 :
     device_                 { device                                        },
     commandQueue_           { commandQueue                                  },
-    commandPool_            { device, vkDestroyCommandPool                  },
-    recordingFenceArray_    { VKPtr<VkFence>{ device, vkDestroyFence },
-                              VKPtr<VkFence>{ device, vkDestroyFence },
-                              VKPtr<VkFence>{ device, vkDestroyFence }      },
+    submitQueue_            { commandQueueVK                                },
+    queueFamilyIndex_       { queueFamilyIndices.graphicsFamily             },
     numCommandBuffers_      { VKCommandBuffer::GetNumVkCommandBuffers(desc) },
+    deviceMemoryMngr_       { deviceMemoryMngr                              },
+    minStagingPoolSize_     { GetMinStagingPoolSize(desc)                   },
     queuePresentFamily_     { queueFamilyIndices.presentFamily              },
     maxDrawIndirectCount_   { GetMaxDrawIndirectCount(physicalDevice)       },
     descriptorSetPoolArray_ { device,
+                              device,
                               device,
                               device                                        }
 {
@@ -92,16 +102,21 @@ VKCommandBuffer::VKCommandBuffer(
             usageFlags_ |= VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
     }
 
+    /*
+    One-time submit command buffers whose number of native buffers is left to the backend allocate more native buffers on demand,
+    so encoding does not block on the GPU while the memory remains bounded by the maximum number of native buffers.
+    */
+    growOnDemand_ = (desc.numNativeBuffers == 0 && (usageFlags_ & VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) != 0);
+
     /* Create native command buffer objects */
-    CreateVkCommandPool(queueFamilyIndices.graphicsFamily);
-    CreateVkCommandBuffers();
-    CreateVkRecordingFences();
-    CreateStagingBufferPools(deviceMemoryMngr, static_cast<VkDeviceSize>(desc.minStagingPoolSize));
+    for_range(i, numCommandBuffers_)
+        CreateNativeBuffer(i);
 }
 
 VKCommandBuffer::~VKCommandBuffer()
 {
-    vkFreeCommandBuffers(device_, commandPool_, numCommandBuffers_, commandBufferArray_);
+    for_range(i, numCommandBuffers_)
+        vkFreeCommandBuffers(device_, commandPoolArray_[i], 1, &(commandBufferArray_[i]));
 }
 
 VkFence VKCommandBuffer::GetQueueSubmitFenceAndFlush()
@@ -116,6 +131,15 @@ VkFence VKCommandBuffer::GetQueueSubmitFenceAndFlush()
     return fence;
 }
 
+void VKCommandBuffer::NotifyTimelineSubmission(std::uint64_t value)
+{
+    recordingTimelineValues_[commandBufferIndex_] = value;
+
+    /* Persistently mapped buffers must not be written by the CPU until this submission has been completed */
+    for (VKBuffer* bufferVK : mappedBuffers_)
+        bufferVK->NotifyTimelineUse(value);
+}
+
 /* ----- Encoding ----- */
 
 void VKCommandBuffer::Begin()
@@ -160,10 +184,16 @@ void VKCommandBuffer::Begin()
     framebufferRenderArea_.extent.width     = static_cast<std::uint32_t>(INT32_MAX); // Must avoid int32 overflow
     framebufferRenderArea_.extent.height    = static_cast<std::uint32_t>(INT32_MAX); // Must avoid int32 overflow
     hasDynamicScissorRect_                  = false;
+    hostQueryRanges_.clear();
+    mappedBuffers_.clear();
 }
 
 void VKCommandBuffer::End()
 {
+    /* Resolve host queries while still recording; secondary command buffers pass their ranges to the primary command buffer in Execute() */
+    if (!IsSecondaryCmdBuffer())
+        FlushHostQueryRanges();
+
     /* End encoding of current command buffer */
     VkResult result = vkEndCommandBuffer(commandBuffer_);
     VKThrowIfFailed(result, "failed to end Vulkan command buffer");
@@ -174,8 +204,17 @@ void VKCommandBuffer::End()
     /* Execute command buffer right after encoding for immediate command buffers */
     if (IsImmediateCmdBuffer())
     {
-        VkResult result = VKSubmitCommandBuffer(commandQueue_, commandBuffer_, GetQueueSubmitFenceAndFlush());
-        VKThrowIfFailed(result, "failed to submit command buffer to Vulkan graphics queue");
+        if (submitQueue_ != nullptr)
+        {
+            /* Submit through command queue interface to keep the order with pending uploads and command buffers */
+            submitQueue_->SubmitCommandBuffer(*this);
+            submitQueue_->FlushSubmissions();
+        }
+        else
+        {
+            VkResult result = VKSubmitCommandBuffer(commandQueue_, commandBuffer_, GetQueueSubmitFenceAndFlush());
+            VKThrowIfFailed(result, "failed to submit command buffer to Vulkan graphics queue");
+        }
     }
 
     ResetBindingStates();
@@ -186,6 +225,13 @@ void VKCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
     auto& cmdBufferVK = LLGL_CAST(VKCommandBuffer&, secondaryCommandBuffer);
     VkCommandBuffer cmdBuffers[] = { cmdBufferVK.GetVkCommandBuffer() };
     vkCmdExecuteCommands(commandBuffer_, 1, cmdBuffers);
+
+    /* Inherit host query ranges, since they can only be resolved outside a render pass */
+    for (const HostQueryRange& range : cmdBufferVK.hostQueryRanges_)
+        AppendHostQueryRange(range.queryHeap, range.begin, range.end - range.begin);
+
+    /* Inherit mapped buffers, since secondary command buffers are only submitted as part of this command buffer */
+    mappedBuffers_.insert(mappedBuffers_.end(), cmdBufferVK.mappedBuffers_.begin(), cmdBufferVK.mappedBuffers_.end());
 }
 
 /* ----- Blitting ----- */
@@ -197,6 +243,7 @@ void VKCommandBuffer::UpdateBuffer(
     std::uint64_t   dataSize)
 {
     auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
+    TrackBufferUse(dstBufferVK);
 
     const VkDeviceSize size     = static_cast<VkDeviceSize>(dataSize);
     const VkDeviceSize offset   = static_cast<VkDeviceSize>(dstOffset);
@@ -234,6 +281,8 @@ void VKCommandBuffer::CopyBuffer(
 {
     auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
     auto& srcBufferVK = LLGL_CAST(VKBuffer&, srcBuffer);
+    TrackBufferUse(dstBufferVK);
+    TrackBufferUse(srcBufferVK);
 
     VkBufferCopy region;
     {
@@ -262,6 +311,7 @@ void VKCommandBuffer::CopyBufferFromTexture(
 {
     auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
     auto& srcTextureVK = LLGL_CAST(VKTexture&, srcTexture);
+    TrackBufferUse(dstBufferVK);
 
     VkBufferImageCopy region;
     {
@@ -299,6 +349,7 @@ void VKCommandBuffer::FillBuffer(
     std::uint64_t   fillSize)
 {
     auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
+    TrackBufferUse(dstBufferVK);
 
     /* Determine destination buffer range and ignore <dstOffset> if the whole buffer is meant to be filled */
     VkDeviceSize offset, size;
@@ -369,6 +420,7 @@ void VKCommandBuffer::CopyTextureFromBuffer(
 {
     auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
     auto& srcBufferVK = LLGL_CAST(VKBuffer&, srcBuffer);
+    TrackBufferUse(srcBufferVK);
 
     VkBufferImageCopy region;
     {
@@ -532,6 +584,7 @@ void VKCommandBuffer::BindVertexBuffer(VKBuffer& bufferVK)
     VkDeviceSize offsets[] = { 0 };
 
     vkCmdBindVertexBuffers(commandBuffer_, 0, 1, buffers, offsets);
+    TrackBufferUse(bufferVK);
 
     /* Store input-assembly state for slot 0 in case it's used for stream-output */
     if ((bufferVK.GetBindFlags() & BindFlags::StreamOutputBuffer) != 0)
@@ -542,6 +595,21 @@ void VKCommandBuffer::BindVertexBuffer(VKBuffer& bufferVK)
     }
 }
 
+//private
+void VKCommandBuffer::TrackBufferUse(VKBuffer& bufferVK)
+{
+    /*
+    Command buffers that can be submitted more than once (or executed by other command buffers) keep referring to the native buffer handle,
+    so the buffer must not be relocated by the device memory defragmentation after it has been recorded here
+    */
+    if ((usageFlags_ & VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) == 0 || IsSecondaryCmdBuffer())
+        bufferVK.DisableRelocation();
+
+    /* Skip consecutive duplicates, e.g. when the same constant buffer is bound for every draw call */
+    if (bufferVK.GetPersistentMapping() != nullptr && (mappedBuffers_.empty() || mappedBuffers_.back() != &bufferVK))
+        mappedBuffers_.push_back(&bufferVK);
+}
+
 void VKCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
@@ -568,18 +636,21 @@ void VKCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
         bufferArrayVK.GetBuffers().data(),
         bufferArrayVK.GetOffsets().data()
     );
+    mappedBuffers_.insert(mappedBuffers_.end(), bufferArrayVK.GetMappedBuffers().begin(), bufferArrayVK.GetMappedBuffers().end());
 }
 
 void VKCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     vkCmdBindIndexBuffer(commandBuffer_, bufferVK.GetVkBuffer(), 0, bufferVK.GetIndexType());
+    TrackBufferUse(bufferVK);
 }
 
 void VKCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     vkCmdBindIndexBuffer(commandBuffer_, bufferVK.GetVkBuffer(), offset, VKTypes::ToVkIndexType(format));
+    TrackBufferUse(bufferVK);
 }
 
 /* ----- Resources ----- */
@@ -595,6 +666,7 @@ void VKCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t
         return /*Descriptor set out of bounds*/;
 
     boundPipelineState_->BindHeapDescriptorSet(commandBuffer_, resourceHeapVK.GetVkDescriptorSets()[descriptorSet]);
+    mappedBuffers_.insert(mappedBuffers_.end(), resourceHeapVK.GetMappedBuffers().begin(), resourceHeapVK.GetMappedBuffers().end());
 
     if (boundPipelineBarrier_ != nullptr)
         resourceHeapVK.SetBarrierSlots(*boundPipelineBarrier_, descriptorSet);
@@ -611,6 +683,9 @@ void VKCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
     const VKLayoutBinding& binding = boundBindingTable_->dynamicBindings[descriptor];
     descriptorCache_->EmplaceDescriptor(resource, binding, descriptorSetWriter_);
 
+    if (resource.GetResourceType() == ResourceType::Buffer)
+        TrackBufferUse(LLGL_CAST(VKBuffer&, resource));
+
     /* Update pipeline barrier slot */
     if (boundPipelineBarrier_ != nullptr)
     {
@@ -700,6 +775,60 @@ void VKCommandBuffer::ResourceBarrier(
     );
 }
 
+void VKCommandBuffer::AliasingBarrier(Resource* /*resourceBefore*/, Resource* resourceAfter)
+{
+    /* Wait for all previous memory accesses, since Vulkan has no dedicated aliasing barrier to limit this to the previous resource */
+    context_.FlushBarriers();
+
+    VkMemoryBarrier memoryBarrier;
+    {
+        memoryBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.pNext         = nullptr;
+        memoryBarrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+        memoryBarrier.dstAccessMask = (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT);
+    }
+
+    /* Discard previous content of the activated image, so its tracked layout is valid for the aliased memory */
+    VkImageMemoryBarrier imageBarrier;
+    std::uint32_t numImageBarriers = 0;
+
+    if (resourceAfter != nullptr && resourceAfter->GetResourceType() == ResourceType::Texture)
+    {
+        auto* textureVK = LLGL_CAST(VKTexture*, resourceAfter);
+
+        imageBarrier.sType                              = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        imageBarrier.pNext                              = nullptr;
+        imageBarrier.srcAccessMask                      = 0;
+        imageBarrier.dstAccessMask                      = (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT);
+        imageBarrier.oldLayout                          = VK_IMAGE_LAYOUT_UNDEFINED;
+        imageBarrier.newLayout                          = textureVK->GetVkImageLayout();
+        imageBarrier.srcQueueFamilyIndex                = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.dstQueueFamilyIndex                = VK_QUEUE_FAMILY_IGNORED;
+        imageBarrier.image                              = textureVK->GetVkImage();
+        imageBarrier.subresourceRange.aspectMask        = VKImageUtils::GetInclusiveVkImageAspect(textureVK->GetVkFormat());
+        imageBarrier.subresourceRange.baseMipLevel      = 0;
+        imageBarrier.subresourceRange.levelCount        = textureVK->GetNumMipLevels();
+        imageBarrier.subresourceRange.baseArrayLayer    = 0;
+        imageBarrier.subresourceRange.layerCount        = textureVK->GetNumArrayLayers();
+
+        if (imageBarrier.newLayout != VK_IMAGE_LAYOUT_UNDEFINED)
+            numImageBarriers = 1;
+    }
+
+    vkCmdPipelineBarrier(
+        commandBuffer_,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        0, // VkDependencyFlags
+        1,
+        &memoryBarrier,
+        0,
+        nullptr,
+        numImageBarriers,
+        &imageBarrier
+    );
+}
+
 /* ----- Render Passes ----- */
 
 void VKCommandBuffer::BeginRenderPass(
@@ -919,6 +1048,10 @@ void VKCommandBuffer::SetPipelineState(PipelineState& pipelineState)
     {
         auto& graphicsPSO = LLGL_CAST(VKGraphicsPSO&, pipelineStateVK);
 
+        /* Set fixed-function states that are not compiled into the native PSO */
+        if (graphicsPSO.HasDynamicFixedFunctionStates())
+            graphicsPSO.SetDynamicFixedFunctionStates(commandBuffer_);
+
         /* Scissor rectangle must be updated (if scissor test is disabled) */
         scissorEnabled_ = graphicsPSO.IsScissorEnabled();
         if (!scissorEnabled_ && !hasDynamicScissorRect_ && graphicsPSO.HasDynamicScissor())
@@ -976,6 +1109,12 @@ void VKCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 
     query *= queryHeapVK.GetGroupSize();
 
+    if (queryHeapVK.HasHostResults())
+    {
+        /* Resolve this query at the end of encoding */
+        AppendHostQueryRange(LLGL_CAST(VKHostQueryHeap*, &queryHeapVK), query, queryHeapVK.GetGroupSize());
+    }
+
     if (queryHeapVK.GetType() == QueryType::TimeElapsed)
     {
         /* Record first timestamp */
@@ -1072,6 +1211,7 @@ void VKCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const
     for_range(i, xfbState_.numXfbBuffers)
     {
         VKBuffer* bufferVK = LLGL_CAST(VKBuffer*, buffers[i]);
+        TrackBufferUse(*bufferVK);
         xfbState_.xfbBuffers[i] = bufferVK->GetVkBuffer();
         xfbState_.xfbCounterOffsets[i] = bufferVK->GetXfbCounterOffset();
         xfbOffsets[i] = 0;
@@ -1168,6 +1308,7 @@ void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
     FlushDescriptorCache();
     SubmitAutoPipelineBarrier();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    TrackBufferUse(bufferVK);
     vkCmdDrawIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, 1, 0);
 }
 
@@ -1176,6 +1317,7 @@ void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::ui
     FlushDescriptorCache();
     SubmitAutoPipelineBarrier();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    TrackBufferUse(bufferVK);
     if (maxDrawIndirectCount_ < numCommands)
     {
         /* Encode multiple indirect draw commands if limit is exceeded */
@@ -1196,6 +1338,7 @@ void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
     FlushDescriptorCache();
     SubmitAutoPipelineBarrier();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    TrackBufferUse(bufferVK);
     vkCmdDrawIndexedIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, 1, 0);
 }
 
@@ -1204,6 +1347,7 @@ void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
     FlushDescriptorCache();
     SubmitAutoPipelineBarrier();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    TrackBufferUse(bufferVK);
     if (maxDrawIndirectCount_ < numCommands)
     {
         /* Encode multiple indirect draw commands if limit is exceeded */
@@ -1241,6 +1385,7 @@ void VKCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
     FlushDescriptorCache();
     SubmitAutoPipelineBarrier();
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    TrackBufferUse(bufferVK);
     vkCmdDispatchIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset);
 }
 
@@ -1293,61 +1438,76 @@ bool VKCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHand
  * ======= Private: =======
  */
 
-void VKCommandBuffer::CreateVkCommandPool(std::uint32_t queueFamilyIndex)
+void VKCommandBuffer::CreateNativeBuffer(std::uint32_t index)
 {
-    /* Create command pool */
-    VkCommandPoolCreateInfo createInfo;
+    /*
+    Create a command pool for each native buffer, so all of its memory can be recycled with a single vkResetCommandPool call.
+    Pools of one-time submit command buffers are transient, since they are reset every time the native buffer is reused.
+    */
+    VkCommandPoolCreateInfo poolCreateInfo;
     {
-        createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-        createInfo.pNext            = nullptr;
-        createInfo.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-        createInfo.queueFamilyIndex = queueFamilyIndex;
+        poolCreateInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolCreateInfo.pNext            = nullptr;
+        poolCreateInfo.flags            = ((usageFlags_ & VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) != 0 ? VK_COMMAND_POOL_CREATE_TRANSIENT_BIT : 0);
+        poolCreateInfo.queueFamilyIndex = queueFamilyIndex_;
     }
-    VkResult result = vkCreateCommandPool(device_, &createInfo, nullptr, commandPool_.ReleaseAndGetAddressOf());
+    commandPoolArray_[index] = VKPtr<VkCommandPool>{ device_, vkDestroyCommandPool };
+    VkResult result = vkCreateCommandPool(device_, &poolCreateInfo, VKGetAllocationCallbacks(), commandPoolArray_[index].ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan command pool");
-}
 
-void VKCommandBuffer::CreateVkCommandBuffers()
-{
-    /* Allocate command buffers */
+    /* Allocate command buffer */
     VkCommandBufferAllocateInfo allocInfo;
     {
         allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         allocInfo.pNext                 = nullptr;
-        allocInfo.commandPool           = commandPool_;
+        allocInfo.commandPool           = commandPoolArray_[index];
         allocInfo.level                 = bufferLevel_;
-        allocInfo.commandBufferCount    = numCommandBuffers_;
+        allocInfo.commandBufferCount    = 1;
     }
-    VkResult result = vkAllocateCommandBuffers(device_, &allocInfo, commandBufferArray_);
+    result = vkAllocateCommandBuffers(device_, &allocInfo, &(commandBufferArray_[index]));
     VKThrowIfFailed(result, "failed to allocate Vulkan command buffers");
-}
 
-void VKCommandBuffer::CreateVkRecordingFences()
-{
-    /* Create all recording fences with their initial state being signaled */
-    VkFenceCreateInfo createInfo;
+    /* Create fence for command buffer recording with its initial state being signaled */
+    VkFenceCreateInfo fenceCreateInfo;
     {
-        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-        createInfo.pNext = nullptr;
-        createInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+        fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fenceCreateInfo.pNext = nullptr;
+        fenceCreateInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
     }
+    recordingFenceArray_[index] = VKPtr<VkFence>{ device_, vkDestroyFence };
+    result = vkCreateFence(device_, &fenceCreateInfo, VKGetAllocationCallbacks(), recordingFenceArray_[index].ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan fence");
 
-    for_range(i, numCommandBuffers_)
-    {
-        /* Create fence for command buffer recording */
-        VkResult result = vkCreateFence(device_, &createInfo, nullptr, recordingFenceArray_[i].ReleaseAndGetAddressOf());
-        VKThrowIfFailed(result, "failed to create Vulkan fence");
-    }
+    /* Initialize staging buffer pool */
+    stagingBufferPools_[index].InitializeDevice(&deviceMemoryMngr_, minStagingPoolSize_);
 }
 
-void VKCommandBuffer::CreateStagingBufferPools(VKDeviceMemoryManager& deviceMemoryMngr, VkDeviceSize minStagingPoolSize)
+bool VKCommandBuffer::IsNativeBufferInFlight(std::uint32_t index) const
 {
-    /* Create command allocators and descriptor heap pools */
-    constexpr VkDeviceSize minStagingChunkSize = 256;
-    minStagingPoolSize = std::max(minStagingChunkSize, minStagingPoolSize);
+    if (recordingTimelineValues_[index] != 0)
+        return !submitQueue_->IsTimelineValueReached(recordingTimelineValues_[index]);
+    if (recordingFenceDirty_[index])
+        return (vkGetFenceStatus(device_, recordingFenceArray_[index]) == VK_NOT_READY);
+    return false;
+}
 
-    for_range(i, numCommandBuffers_)
-        stagingBufferPools_[i].InitializeDevice(&deviceMemoryMngr, minStagingPoolSize);
+void VKCommandBuffer::WaitForNativeBuffer(std::uint32_t index)
+{
+    /* Wait for timeline value of previous submission before using next command buffer */
+    if (recordingTimelineValues_[index] != 0)
+    {
+        submitQueue_->WaitTimelineValue(recordingTimelineValues_[index]);
+        recordingTimelineValues_[index] = 0;
+    }
+
+    /* Wait for fence before using next command buffer */
+    VkFence fence = recordingFenceArray_[index].Get();
+    if (recordingFenceDirty_[index])
+        vkWaitForFences(device_, 1, &fence, VK_TRUE, UINT64_MAX);
+
+    /* Reset fence state after it has been signaled by the command queue */
+    vkResetFences(device_, 1, &fence);
+    recordingFenceDirty_[index] = false;
 }
 
 void VKCommandBuffer::ClearFramebufferAttachments(std::uint32_t numAttachments, const VkClearAttachment* attachments)
@@ -1492,14 +1652,19 @@ void VKCommandBuffer::AcquireNextBuffer()
     /* Move to next command buffer index */
     commandBufferIndex_ = (commandBufferIndex_ + 1) % numCommandBuffers_;
 
-    /* Wait for fence before using next command buffer */
+    /* Allocate another native buffer instead of blocking if the next one is still in flight */
+    if (growOnDemand_ && numCommandBuffers_ < maxNumCommandBuffers && IsNativeBufferInFlight(commandBufferIndex_))
+    {
+        commandBufferIndex_ = numCommandBuffers_++;
+        CreateNativeBuffer(commandBufferIndex_);
+    }
+
+    WaitForNativeBuffer(commandBufferIndex_);
     recordingFence_ = recordingFenceArray_[commandBufferIndex_].Get();
-    if (recordingFenceDirty_[commandBufferIndex_])
-        vkWaitForFences(device_, 1, &recordingFence_, VK_TRUE, UINT64_MAX);
 
-    /* Reset fence state after it has been signaled by the command queue */
-    vkResetFences(device_, 1, &recordingFence_);
-    recordingFenceDirty_[commandBufferIndex_] = false;
+    /* Recycle all memory of the previous recording at once, since the GPU has completed it */
+    VkResult result = vkResetCommandPool(device_, commandPoolArray_[commandBufferIndex_], 0);
+    VKThrowIfFailed(result, "failed to reset Vulkan command pool");
 
     /* Make next command buffer current and reset pools and context */
     commandBuffer_      = commandBufferArray_[commandBufferIndex_];
@@ -1519,6 +1684,33 @@ void VKCommandBuffer::ResetBindingStates()
     descriptorCache_        = nullptr;
 }
 
+void VKCommandBuffer::AppendHostQueryRange(VKHostQueryHeap* queryHeap, std::uint32_t firstNativeQuery, std::uint32_t numNativeQueries)
+{
+    const std::uint32_t begin   = firstNativeQuery;
+    const std::uint32_t end     = firstNativeQuery + numNativeQueries;
+
+    /* Merge with the previous range if they overlap or are adjacent, which is the common case for sequentially allocated queries */
+    if (!hostQueryRanges_.empty())
+    {
+        HostQueryRange& prevRange = hostQueryRanges_.back();
+        if (prevRange.queryHeap == queryHeap && begin <= prevRange.end && end >= prevRange.begin)
+        {
+            prevRange.begin = std::min(prevRange.begin, begin);
+            prevRange.end   = std::max(prevRange.end, end);
+            return;
+        }
+    }
+
+    hostQueryRanges_.push_back(HostQueryRange{ queryHeap, begin, end });
+}
+
+void VKCommandBuffer::FlushHostQueryRanges()
+{
+    for (const HostQueryRange& range : hostQueryRanges_)
+        range.queryHeap->ResolveResults(commandBuffer_, range.begin, range.end - range.begin);
+    hostQueryRanges_.clear();
+}
+
 #if 0
 void VKCommandBuffer::ResetQueryPoolsInFlight()
 {
@@ -1557,6 +1749,11 @@ std::uint32_t VKCommandBuffer::GetNumVkCommandBuffers(const CommandBufferDescrip
 
 } // /namespace LLGL
 
+#ifdef LLGL_STATIC_BACKEND_VULKAN
+#define LLGL_STATIC_COMMAND_BUFFER VKCommandBuffer
+#include "../../StaticCommandBuffer.inl"
+#endif // /LLGL_STATIC_BACKEND_VULKAN
+
 
 
 // ================================================================================
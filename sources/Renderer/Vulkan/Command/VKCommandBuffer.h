@@ -30,9 +30,11 @@ class VKPhysicalDevice;
 class VKResourceHeap;
 class VKRenderPass;
 class VKQueryHeap;
+class VKHostQueryHeap;
 class VKSwapChain;
 class VKPipelineState;
 class VKPipelineBarrier;
+class VKCommandQueue;
 
 class VKCommandBuffer final : public CommandBuffer
 {
@@ -49,7 +51,8 @@ class VKCommandBuffer final : public CommandBuffer
             VkQueue                         commandQueue,
             VKDeviceMemoryManager&          deviceMemoryMngr,
             const VKQueueFamilyIndices&     queueFamilyIndices,
-            const CommandBufferDescriptor&  desc
+            const CommandBufferDescriptor&  desc,
+            VKCommandQueue*                 commandQueueVK      = nullptr
         );
 
         ~VKCommandBuffer();
@@ -60,6 +63,9 @@ class VKCommandBuffer final : public CommandBuffer
         // i.e. it won't need another signal for the next submission.
         VkFence GetQueueSubmitFenceAndFlush();
 
+        // Stores the timeline value the command queue signals once the current native command buffer has completed.
+        void NotifyTimelineSubmission(std::uint64_t value);
+
         // Returns the native VkCommandBuffer object.
         inline VkCommandBuffer GetVkCommandBuffer() const
         {
@@ -90,10 +96,14 @@ class VKCommandBuffer final : public CommandBuffer
 
     private:
 
-        void CreateVkCommandPool(std::uint32_t queueFamilyIndex);
-        void CreateVkCommandBuffers();
-        void CreateVkRecordingFences();
-        void CreateStagingBufferPools(VKDeviceMemoryManager& deviceMemoryMngr, VkDeviceSize minStagingPoolSize);
+        // Creates the command pool, command buffer, recording fence, and staging pool of the specified native buffer slot.
+        void CreateNativeBuffer(std::uint32_t index);
+
+        // Returns true if the specified native buffer slot has been submitted and is not yet completed by the GPU. This does not block.
+        bool IsNativeBufferInFlight(std::uint32_t index) const;
+
+        // Waits until the specified native buffer slot has been completed by the GPU.
+        void WaitForNativeBuffer(std::uint32_t index);
 
         void ClearFramebufferAttachments(std::uint32_t numAttachments, const VkClearAttachment* attachments);
 
@@ -128,6 +138,12 @@ class VKCommandBuffer final : public CommandBuffer
 
         void ResetBindingStates();
 
+        // Adds the specified native queries to the ranges that are resolved at the end of encoding.
+        void AppendHostQueryRange(VKHostQueryHeap* queryHeap, std::uint32_t firstNativeQuery, std::uint32_t numNativeQueries);
+
+        // Records the copy commands for all host query ranges. This must be called outside a render pass.
+        void FlushHostQueryRanges();
+
         #if 1//TODO: optimize
         void ResetQueryPoolsInFlight();
         void AppendQueryPoolInFlight(VKQueryHeap* queryHeap);
@@ -135,6 +151,10 @@ class VKCommandBuffer final : public CommandBuffer
 
         void BindVertexBuffer(VKBuffer& bufferVK);
 
+        // Keeps track of the specified buffer if it's persistently mapped, so the CPU can wait for this command buffer before it writes into that buffer.
+        // Also pins the buffer in memory if this command buffer can be submitted multiple times.
+        void TrackBufferUse(VKBuffer& bufferVK);
+
     private:
 
         // Returns the number of native Vulkan command buffers used for the specified descriptor.
@@ -157,27 +177,41 @@ class VKCommandBuffer final : public CommandBuffer
             std::uint32_t   numXfbBuffers                               = 0;
         };
 
+        // Range of native queries that must be resolved into their host query heap at the end of encoding.
+        struct HostQueryRange
+        {
+            VKHostQueryHeap*    queryHeap;
+            std::uint32_t       begin;
+            std::uint32_t       end;
+        };
+
     private:
 
-        static constexpr std::uint32_t maxNumCommandBuffers = 3;
+        static constexpr std::uint32_t maxNumCommandBuffers = 4;
 
         VkDevice                        device_                                         = VK_NULL_HANDLE;
 
         VkQueue                         commandQueue_                                   = VK_NULL_HANDLE;
+        VKCommandQueue*                 submitQueue_                                    = nullptr;
 
-        VKPtr<VkCommandPool>            commandPool_;
+        VKPtr<VkCommandPool>            commandPoolArray_[maxNumCommandBuffers];        // One pool per native buffer, so it can be reset as a whole
+        std::uint32_t                   queueFamilyIndex_                               = 0;
 
         VKPtr<VkFence>                  recordingFenceArray_[maxNumCommandBuffers];
         VkFence                         recordingFence_                                 = VK_NULL_HANDLE;
         bool                            recordingFenceDirty_[maxNumCommandBuffers]      = {};
+        std::uint64_t                   recordingTimelineValues_[maxNumCommandBuffers]  = {}; // Used instead of recording fences if the queue has a timeline semaphore
         VkCommandBuffer                 commandBufferArray_[maxNumCommandBuffers];
         VkCommandBuffer                 commandBuffer_                                  = VK_NULL_HANDLE;
         std::uint32_t                   commandBufferIndex_                             = 0;
         std::uint32_t                   numCommandBuffers_                              = 2;
+        bool                            growOnDemand_                                   = false; // Allocate more native buffers instead of waiting for the GPU
 
         VKCommandContext                context_;
 
         VKStagingBufferPool             stagingBufferPools_[maxNumCommandBuffers];
+        VKDeviceMemoryManager&          deviceMemoryMngr_;
+        VkDeviceSize                    minStagingPoolSize_                             = 0;
 
         RecordState                     recordState_                                    = RecordState::Undefined;
 
@@ -215,6 +249,9 @@ class VKCommandBuffer final : public CommandBuffer
         InputAssemblyState              iaState_;
         TransformFeedbackState          xfbState_;
 
+        std::vector<HostQueryRange>     hostQueryRanges_;
+        std::vector<VKBuffer*>          mappedBuffers_;                                 // Persistently mapped buffers referenced by the current native buffer
+
         #if 0//TODO: optimize usage of query pools
         std::vector<VKQueryHeap*>       queryHeapsInFlight_;
         std::size_t                     numQueryHeapsInFlight_                          = 0;
@@ -280,17 +280,18 @@ void VKCommandContext::CopyBufferToImage(
     const VkExtent3D&           extent,
     const TextureSubresource&   subresource,
     std::uint32_t               rowLength,
-    std::uint32_t               imageHeight)
+    std::uint32_t               imageHeight,
+    VkDeviceSize                bufferOffset)
 {
     /*
     VUID-VkBufferImageCopy-aspectMask-09103
     "The aspectMask member of imageSubresource must only have a single bit set"
     */
-    auto CopyBufferToImageWithSingleImageAspect = [this, srcBuffer, dstImage, rowLength, imageHeight, &subresource, &offset, &extent](VkImageAspectFlagBits aspectMask) -> void
+    auto CopyBufferToImageWithSingleImageAspect = [this, srcBuffer, dstImage, rowLength, imageHeight, bufferOffset, &subresource, &offset, &extent](VkImageAspectFlagBits aspectMask) -> void
     {
         VkBufferImageCopy region;
         {
-            region.bufferOffset                     = 0;
+            region.bufferOffset                     = bufferOffset;
             region.bufferRowLength                  = rowLength;
             region.bufferImageHeight                = imageHeight;
             region.imageSubresource.aspectMask      = aspectMask;
@@ -100,7 +100,8 @@ class VKCommandContext
             const VkExtent3D&           extent,
             const TextureSubresource&   subresource,
             std::uint32_t               rowLength       = 0,
-            std::uint32_t               imageHeight     = 0
+            std::uint32_t               imageHeight     = 0,
+            VkDeviceSize                bufferOffset    = 0
         );
 
         void CopyBufferToImage(
@@ -7,10 +7,12 @@
 
 #include "VKCommandQueue.h"
 #include "VKCommandBuffer.h"
+#include "VKUploadBatcher.h"
 #include "../RenderState/VKFence.h"
-#include "../RenderState/VKQueryHeap.h"
+#include "../RenderState/VKHostQueryHeap.h"
 #include "../VKCore.h"
 #include "../../CheckedCast.h"
+#include "../../../Core/Assertion.h"
 
 
 namespace LLGL
@@ -34,18 +36,30 @@ VkResult VKSubmitCommandBuffer(VkQueue commandQueue, VkCommandBuffer commandBuff
     return vkQueueSubmit(commandQueue, 1, &submitInfo, fence);
 }
 
-VKCommandQueue::VKCommandQueue(VkDevice device, VkQueue queue) :
-    device_ { device },
-    native_ { queue  }
+VKCommandQueue::VKCommandQueue(VkDevice device, VkQueue queue, bool useTimelineSemaphore, VKUploadBatcher* uploadBatcher) :
+    device_            { device                         },
+    native_            { queue                          },
+    uploadBatcher_     { uploadBatcher                  },
+    timelineSemaphore_ { device, vkDestroySemaphore     }
 {
+    if (useTimelineSemaphore)
+        VKCreateTimelineSemaphore(device, timelineSemaphore_);
 }
 
-/* ----- Command Buffers ----- */
-
-void VKCommandQueue::Submit(CommandBuffer& commandBuffer)
+void VKCommandQueue::SubmitCommandBuffer(VKCommandBuffer& commandBufferVK)
 {
-    auto& commandBufferVK = LLGL_CAST(VKCommandBuffer&, commandBuffer);
-    if (!commandBufferVK.IsImmediateCmdBuffer())
+    /* Submit pending uploads first, so the command buffer sees the written data */
+    if (uploadBatcher_ != nullptr)
+        uploadBatcher_->Submit();
+
+    if (HasTimelineSemaphore())
+    {
+        /* Defer submission until next fence or present; the command buffer waits on the timeline value before it is recorded again */
+        const std::uint64_t signalValue = ++timelineValue_;
+        pendingSubmissions_.push_back(PendingSubmission{ commandBufferVK.GetVkCommandBuffer(), timelineSemaphore_.Get(), signalValue });
+        commandBufferVK.NotifyTimelineSubmission(signalValue);
+    }
+    else
     {
         VkResult result = VKSubmitCommandBuffer(
             native_,
@@ -56,6 +70,96 @@ void VKCommandQueue::Submit(CommandBuffer& commandBuffer)
     }
 }
 
+void VKCommandQueue::FlushSubmissions(const VkSubmitInfo* finalSubmitInfo, VkFence fence)
+{
+    const std::size_t numSubmitInfos = pendingSubmissions_.size() + (finalSubmitInfo != nullptr ? 1 : 0);
+    if (numSubmitInfos == 0 && fence == VK_NULL_HANDLE)
+        return;
+
+    /* Build one batch per pending submission; reserve both arrays up front since batches point into them */
+    submitInfos_.clear();
+    submitInfos_.reserve(numSubmitInfos);
+    timelineSubmitInfos_.clear();
+    timelineSubmitInfos_.reserve(pendingSubmissions_.size());
+
+    for (const PendingSubmission& pending : pendingSubmissions_)
+    {
+        VkTimelineSemaphoreSubmitInfoKHR timelineSubmitInfo;
+        {
+            timelineSubmitInfo.sType                        = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+            timelineSubmitInfo.pNext                        = nullptr;
+            timelineSubmitInfo.waitSemaphoreValueCount      = 0;
+            timelineSubmitInfo.pWaitSemaphoreValues         = nullptr;
+            timelineSubmitInfo.signalSemaphoreValueCount    = 1;
+            timelineSubmitInfo.pSignalSemaphoreValues       = &(pending.signalValue);
+        }
+        timelineSubmitInfos_.push_back(timelineSubmitInfo);
+
+        VkSubmitInfo submitInfo;
+        {
+            submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.pNext                = &(timelineSubmitInfos_.back());
+            submitInfo.waitSemaphoreCount   = 0;
+            submitInfo.pWaitSemaphores      = nullptr;
+            submitInfo.pWaitDstStageMask    = nullptr;
+            submitInfo.commandBufferCount   = (pending.commandBuffer != VK_NULL_HANDLE ? 1 : 0);
+            submitInfo.pCommandBuffers      = &(pending.commandBuffer);
+            submitInfo.signalSemaphoreCount = 1;
+            submitInfo.pSignalSemaphores    = &(pending.signalSemaphore);
+        }
+        submitInfos_.push_back(submitInfo);
+    }
+
+    if (finalSubmitInfo != nullptr)
+        submitInfos_.push_back(*finalSubmitInfo);
+
+    VkResult result = vkQueueSubmit(native_, static_cast<std::uint32_t>(submitInfos_.size()), submitInfos_.data(), fence);
+    VKThrowIfFailed(result, "failed to submit command buffers to Vulkan graphics queue");
+
+    pendingSubmissions_.clear();
+    flushedTimelineValue_ = timelineValue_;
+}
+
+void VKCommandQueue::Flush()
+{
+    /* Uploads flush all pending submissions when they are submitted, otherwise flush them explicitly */
+    if (uploadBatcher_ != nullptr)
+        uploadBatcher_->Submit();
+    FlushSubmissions();
+}
+
+void VKCommandQueue::WaitTimelineValue(std::uint64_t value)
+{
+    LLGL_ASSERT(HasTimelineSemaphore());
+
+    /* Submit pending command buffers first, or the timeline would never reach this value */
+    if (value > flushedTimelineValue_)
+        FlushSubmissions();
+
+    VkResult result = VKWaitTimelineSemaphore(device_, timelineSemaphore_, value, UINT64_MAX);
+    VKThrowIfFailed(result, "failed to wait for Vulkan timeline semaphore");
+}
+
+bool VKCommandQueue::IsTimelineValueReached(std::uint64_t value) const
+{
+    LLGL_ASSERT(HasTimelineSemaphore());
+
+    /* Values of pending submissions cannot have been reached yet */
+    if (value > flushedTimelineValue_)
+        return false;
+
+    return (VKWaitTimelineSemaphore(device_, timelineSemaphore_, value, 0) == VK_SUCCESS);
+}
+
+/* ----- Command Buffers ----- */
+
+void VKCommandQueue::Submit(CommandBuffer& commandBuffer)
+{
+    auto& commandBufferVK = LLGL_CAST(VKCommandBuffer&, commandBuffer);
+    if (!commandBufferVK.IsImmediateCmdBuffer())
+        SubmitCommandBuffer(commandBufferVK);
+}
+
 /* ----- Queries ----- */
 
 bool VKCommandQueue::QueryResult(
@@ -67,8 +171,18 @@ bool VKCommandQueue::QueryResult(
 {
     auto& queryHeapVK = LLGL_CAST(VKQueryHeap&, queryHeap);
 
-    /* Store result directly into output parameter */
-    VkResult stateResult = GetQueryResults(queryHeapVK, firstQuery, numQueries, data, dataSize);
+    /* Submit deferred command buffers first, or the queries they contain would never become available */
+    FlushSubmissions();
+
+    /* Read resolved results from host memory if available, otherwise store result directly into output parameter */
+    VkResult stateResult = VK_NOT_READY;
+    if (queryHeapVK.HasHostResults())
+    {
+        auto& hostQueryHeapVK = LLGL_CAST(VKHostQueryHeap&, queryHeapVK);
+        stateResult = hostQueryHeapVK.ReadResults(device_, firstQuery, numQueries, data, dataSize);
+    }
+    else
+        stateResult = GetQueryResults(queryHeapVK, firstQuery, numQueries, data, dataSize);
     if (stateResult == VK_NOT_READY)
         return false;
 
@@ -103,8 +217,21 @@ bool VKCommandBuffer::QueryPipelineStatisticsResult(QueryHeap& queryHeap, QueryP
 void VKCommandQueue::Submit(Fence& fence)
 {
     auto& fenceVK = LLGL_CAST(VKFence&, fence);
-    fenceVK.Reset(device_);
-    vkQueueSubmit(native_, 0, nullptr, fenceVK.GetVkFence());
+    if (uploadBatcher_ != nullptr)
+        uploadBatcher_->Submit();
+
+    if (fenceVK.IsTimelineFence())
+    {
+        /* Signal next timeline value of the fence as last batch of all pending submissions */
+        pendingSubmissions_.push_back(PendingSubmission{ VK_NULL_HANDLE, fenceVK.GetVkSemaphore(), fenceVK.NextTimelineValue() });
+        FlushSubmissions();
+    }
+    else
+    {
+        /* Signal binary fence with the same submission as all pending command buffers */
+        fenceVK.Reset(device_);
+        FlushSubmissions(nullptr, fenceVK.GetVkFence());
+    }
 }
 
 bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
@@ -115,6 +242,7 @@ bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 
 void VKCommandQueue::WaitIdle()
 {
+    Flush();
     vkQueueWaitIdle(native_);
 }
 
@@ -14,6 +14,7 @@
 #include "../VKPtr.h"
 #include "../VKCore.h"
 #include "../RenderState/VKFence.h"
+#include <vector>
 
 
 namespace LLGL
@@ -21,6 +22,8 @@ namespace LLGL
 
 
 class VKQueryHeap;
+class VKCommandBuffer;
+class VKUploadBatcher;
 
 // Helper function to submit the specified Vulkan command buffer to a command queue.
 VkResult VKSubmitCommandBuffer(VkQueue commandQueue, VkCommandBuffer commandBuffer, VkFence fence);
@@ -34,7 +37,44 @@ class VKCommandQueue final : public CommandQueue
 
     public:
 
-        VKCommandQueue(VkDevice device, VkQueue queue);
+        VKCommandQueue(VkDevice device, VkQueue queue, bool useTimelineSemaphore = false, VKUploadBatcher* uploadBatcher = nullptr);
+
+        /*
+        Submits the specified primary command buffer after all pending uploads.
+        If timeline semaphores are supported, the submission is deferred until the next call to FlushSubmissions().
+        */
+        void SubmitCommandBuffer(VKCommandBuffer& commandBufferVK);
+
+        /*
+        Submits all pending command buffers with a single vkQueueSubmit call.
+        The optional submit info is appended as the last batch of the same submission and the optional fence is signaled when all batches have completed.
+        */
+        void FlushSubmissions(const VkSubmitInfo* finalSubmitInfo = nullptr, VkFence fence = VK_NULL_HANDLE);
+
+        // Submits all pending uploads and command buffers.
+        void Flush();
+
+        // Waits on the host until the queue timeline semaphore has reached the specified value. Pending submissions are flushed first if necessary.
+        void WaitTimelineValue(std::uint64_t value);
+
+        // Returns true if the queue timeline semaphore has reached the specified value. This does not block and does not flush pending submissions.
+        bool IsTimelineValueReached(std::uint64_t value) const;
+
+        // Returns true if this queue coalesces submissions and signals a timeline semaphore instead of binary fences.
+        inline bool HasTimelineSemaphore() const
+        {
+            return (timelineSemaphore_.Get() != VK_NULL_HANDLE);
+        }
+
+    private:
+
+        // Batch of the next queue submission that signals a timeline semaphore.
+        struct PendingSubmission
+        {
+            VkCommandBuffer commandBuffer;
+            VkSemaphore     signalSemaphore;
+            std::uint64_t   signalValue;
+        };
 
     private:
 
@@ -66,8 +106,17 @@ class VKCommandQueue final : public CommandQueue
 
     private:
 
-        VkDevice    device_ = VK_NULL_HANDLE;
-        VkQueue     native_ = VK_NULL_HANDLE;
+        VkDevice                                        device_                 = VK_NULL_HANDLE;
+        VkQueue                                         native_                 = VK_NULL_HANDLE;
+        VKUploadBatcher*                                uploadBatcher_          = nullptr;
+
+        VKPtr<VkSemaphore>                              timelineSemaphore_;
+        std::uint64_t                                   timelineValue_          = 0; // Last value that has been assigned to a submission
+        std::uint64_t                                   flushedTimelineValue_   = 0; // Last value that has been submitted to the queue
+
+        std::vector<PendingSubmission>                  pendingSubmissions_;
+        std::vector<VkSubmitInfo>                       submitInfos_;
+        std::vector<VkTimelineSemaphoreSubmitInfoKHR>   timelineSubmitInfos_;
 
 };
 
@@ -0,0 +1,328 @@
+/*
+ * VKUploadBatcher.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKUploadBatcher.h"
+#include "VKCommandQueue.h"
+#include "../VKDevice.h"
+#include "../VKCore.h"
+#include "../VKTypes.h"
+#include "../Texture/VKTexture.h"
+#include "../Memory/VKDeviceMemoryManager.h"
+#include "../../../Core/ImageUtils.h"
+#include "../../../Core/Assertion.h"
+#include "../../../Core/CoreUtils.h"
+#include <LLGL/Format.h>
+#include <LLGL/TextureFlags.h>
+#include <algorithm>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Minimum size of each staging chunk, so small batch sizes don't allocate a new chunk for every write.
+static constexpr VkDeviceSize g_minStagingChunkSize = 64*1024;
+
+VKUploadBatcher::~VKUploadBatcher()
+{
+    if (device_ != nullptr)
+    {
+        /* Wait for all batches in flight before their command buffers are freed */
+        for (Batch& batch : batches_)
+        {
+            WaitForBatch(batch);
+            if (batch.commandBuffer != VK_NULL_HANDLE)
+                vkFreeCommandBuffers(*device_, device_->GetVkCommandPool(), 1, &(batch.commandBuffer));
+        }
+    }
+}
+
+void VKUploadBatcher::InitializeDevice(VKDevice& device, VKDeviceMemoryManager& deviceMemoryMngr, VKCommandQueue& commandQueue, VkDeviceSize batchSize)
+{
+    device_         = &device;
+    commandQueue_   = &commandQueue;
+    batchSize_      = batchSize;
+
+    for (Batch& batch : batches_)
+    {
+        /* Allocate command buffer once, it will be reset every time a new batch is recorded */
+        batch.commandBuffer = device.AllocCommandBuffer(false);
+
+        /* Create fence that is signaled when the batch has been completed */
+        VkFenceCreateInfo createInfo;
+        {
+            createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            createInfo.pNext = nullptr;
+            createInfo.flags = 0;
+        }
+        batch.fence = VKPtr<VkFence>{ device.GetVkDevice(), vkDestroyFence };
+        VkResult result = vkCreateFence(device, &createInfo, VKGetAllocationCallbacks(), batch.fence.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan fence for upload batch");
+
+        batch.stagingPool.InitializeDevice(&deviceMemoryMngr, std::max(batchSize, g_minStagingChunkSize));
+    }
+}
+
+void VKUploadBatcher::WriteBuffer(VkBuffer dstBuffer, VkDeviceSize dstOffset, const void* data, VkDeviceSize dataSize)
+{
+    BeginBatch();
+
+    /* Copy data into staging pool of current batch and record copy command */
+    Batch& batch = batches_[batchIndex_];
+    VkResult result = batch.stagingPool.WriteStaged(batch.commandBuffer, dstBuffer, dstOffset, data, dataSize);
+    VKThrowIfFailed(result, "failed to write data into Vulkan staging buffer");
+
+    if (!Contains(batch.buffers, dstBuffer))
+        batch.buffers.push_back(dstBuffer);
+
+    SubmitIfFull(dataSize);
+}
+
+void VKUploadBatcher::WriteTexture(
+    VKTexture&              dstTexture,
+    const TextureRegion&    textureRegion,
+    const Extent3D&         extent,
+    const void*             data,
+    VkDeviceSize            dataSize,
+    std::uint32_t           srcRowStride,
+    std::uint32_t           bpp)
+{
+    BeginBatch();
+
+    /*
+    Buffer offsets for image copies must be a multiple of the texel block size (and 4 for depth-stencil formats),
+    so align uncompressed formats to a multiple of both, and compressed formats to the largest block size.
+    */
+    const bool          isCompressed    = IsCompressedFormat(VKTypes::Unmap(dstTexture.GetVkFormat()));
+    const VkDeviceSize  alignment       = (isCompressed ? 16 : static_cast<VkDeviceSize>(bpp) * 4);
+
+    /* Copy image data into staging pool of current batch */
+    Batch& batch = batches_[batchIndex_];
+    VkDeviceSize srcOffset = 0;
+    VKStagingBuffer& stagingBuffer = batch.stagingPool.AllocRegion(dataSize, alignment, srcOffset);
+
+    if (!Contains(batch.images, dstTexture.GetVkImage()))
+        batch.images.push_back(dstTexture.GetVkImage());
+
+    void* memory = stagingBuffer.Map(*device_, srcOffset, dataSize);
+    if (memory == nullptr)
+        VKThrowIfFailed(VK_ERROR_MEMORY_MAP_FAILED, "failed to map Vulkan staging buffer for texture upload");
+
+    const std::uint32_t dstRowStride = extent.width * bpp;
+    if (isCompressed || srcRowStride == dstRowStride)
+        ::memcpy(memory, data, static_cast<std::size_t>(dataSize));
+    else
+        BitBlit(extent, bpp, static_cast<char*>(memory), dstRowStride, extent.height * dstRowStride, static_cast<const char*>(data), srcRowStride, extent.height * srcRowStride);
+
+    stagingBuffer.Unmap(*device_);
+
+    /* Copy staging region into texture and restore previous image layout afterwards */
+    const TextureSubresource& subresource = textureRegion.subresource;
+    VkImageLayout oldLayout = dstTexture.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresource, true);
+    {
+        /* Use input offset and extent (instead of transient dimensions) because copy operation takes subresource parameters into account */
+        context_.CopyBufferToImage(
+            stagingBuffer.GetVkBuffer(),
+            dstTexture.GetVkImage(),
+            dstTexture.GetVkFormat(),
+            VkOffset3D{ textureRegion.offset.x, textureRegion.offset.y, textureRegion.offset.z },
+            VkExtent3D{ textureRegion.extent.width, textureRegion.extent.height, textureRegion.extent.depth },
+            subresource,
+            0,
+            0,
+            srcOffset
+        );
+    }
+    dstTexture.TransitionImageLayout(context_, oldLayout, subresource, true);
+
+    SubmitIfFull(dataSize);
+}
+
+void VKUploadBatcher::CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size)
+{
+    BeginBatch();
+
+    /* Wait for all previous writes to the source buffer, e.g. by copy commands of submitted command buffers */
+    Batch& batch = batches_[batchIndex_];
+    context_.FlushBarriers();
+
+    VkMemoryBarrier barrier;
+    {
+        barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.pNext           = nullptr;
+        barrier.srcAccessMask   = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask   = VK_ACCESS_TRANSFER_READ_BIT;
+    }
+    vkCmdPipelineBarrier(
+        batch.commandBuffer,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        0, // VkDependencyFlags
+        1,
+        &barrier,
+        0,
+        nullptr,
+        0,
+        nullptr
+    );
+
+    /* Visibility of the copied data for subsequent commands is ensured by the barrier at the end of the batch */
+    context_.CopyBuffer(srcBuffer, dstBuffer, size);
+
+    if (!Contains(batch.buffers, srcBuffer))
+        batch.buffers.push_back(srcBuffer);
+    if (!Contains(batch.buffers, dstBuffer))
+        batch.buffers.push_back(dstBuffer);
+
+    SubmitIfFull(size);
+}
+
+void VKUploadBatcher::Submit()
+{
+    if (!isRecording_)
+        return;
+
+    Batch& batch = batches_[batchIndex_];
+
+    /* Make all transfer writes of this batch visible to every subsequent command in the same queue */
+    context_.FlushBarriers();
+
+    VkMemoryBarrier barrier;
+    {
+        barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.pNext           = nullptr;
+        barrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask   = (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT);
+    }
+    vkCmdPipelineBarrier(
+        batch.commandBuffer,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        0, // VkDependencyFlags
+        1,
+        &barrier,
+        0,
+        nullptr,
+        0,
+        nullptr
+    );
+
+    VkResult result = vkEndCommandBuffer(batch.commandBuffer);
+    VKThrowIfFailed(result, "failed to end recording Vulkan upload batch");
+
+    /*
+    Submit batch without waiting for it; the fence is only waited on when this batch is reused.
+    Pending command buffers of the queue are submitted within the same call, so the uploads don't overtake them.
+    */
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = nullptr;
+        submitInfo.waitSemaphoreCount   = 0;
+        submitInfo.pWaitSemaphores      = nullptr;
+        submitInfo.pWaitDstStageMask    = nullptr;
+        submitInfo.commandBufferCount   = 1;
+        submitInfo.pCommandBuffers      = &(batch.commandBuffer);
+        submitInfo.signalSemaphoreCount = 0;
+        submitInfo.pSignalSemaphores    = nullptr;
+    }
+    commandQueue_->FlushSubmissions(&submitInfo, batch.fence);
+
+    batch.inFlight  = true;
+    isRecording_    = false;
+    recordedSize_   = 0;
+
+    /* Move to next batch in the ring buffer */
+    batchIndex_ = (batchIndex_ + 1) % maxNumBatches;
+}
+
+void VKUploadBatcher::WaitForBuffer(VkBuffer buffer)
+{
+    for (Batch& batch : batches_)
+    {
+        if (Contains(batch.buffers, buffer))
+            SubmitAndWaitForBatch(batch);
+    }
+}
+
+void VKUploadBatcher::WaitForImage(VkImage image)
+{
+    for (Batch& batch : batches_)
+    {
+        if (Contains(batch.images, image))
+            SubmitAndWaitForBatch(batch);
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKUploadBatcher::BeginBatch()
+{
+    if (isRecording_)
+        return;
+
+    LLGL_ASSERT_PTR(device_);
+
+    /* Wait until previous submission of this batch has been completed before its staging memory is overwritten */
+    Batch& batch = batches_[batchIndex_];
+    WaitForBatch(batch);
+    batch.stagingPool.Reset();
+
+    /* Begin recording the reused command buffer */
+    VkResult result = vkResetCommandBuffer(batch.commandBuffer, 0);
+    VKThrowIfFailed(result, "failed to reset Vulkan upload batch");
+
+    VkCommandBufferBeginInfo beginInfo;
+    {
+        beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.pNext             = nullptr;
+        beginInfo.flags             = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        beginInfo.pInheritanceInfo  = nullptr;
+    }
+    result = vkBeginCommandBuffer(batch.commandBuffer, &beginInfo);
+    VKThrowIfFailed(result, "failed to begin recording Vulkan upload batch");
+
+    context_.Reset(batch.commandBuffer);
+    isRecording_ = true;
+}
+
+void VKUploadBatcher::WaitForBatch(Batch& batch)
+{
+    if (batch.inFlight)
+    {
+        vkWaitForFences(*device_, 1, batch.fence.GetAddressOf(), VK_TRUE, UINT64_MAX);
+        vkResetFences(*device_, 1, batch.fence.GetAddressOf());
+        batch.inFlight = false;
+        batch.buffers.clear();
+        batch.images.clear();
+    }
+}
+
+void VKUploadBatcher::SubmitAndWaitForBatch(Batch& batch)
+{
+    if (isRecording_ && &batch == &batches_[batchIndex_])
+        Submit();
+    WaitForBatch(batch);
+}
+
+void VKUploadBatcher::SubmitIfFull(VkDeviceSize dataSize)
+{
+    recordedSize_ += dataSize;
+    if (recordedSize_ >= batchSize_)
+        Submit();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,139 @@
+/*
+ * VKUploadBatcher.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_UPLOAD_BATCHER_H
+#define LLGL_VK_UPLOAD_BATCHER_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include "VKCommandContext.h"
+#include "../Buffer/VKStagingBufferPool.h"
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+struct Extent3D;
+struct TextureRegion;
+class VKDevice;
+class VKCommandQueue;
+class VKTexture;
+class VKDeviceMemoryManager;
+
+/*
+Accumulates buffer and texture uploads from the render system into batches that are recorded into reused command buffers.
+Each batch owns its own staging pool and the batches are used as a ring buffer,
+so the CPU only waits for a batch when its staging memory is about to be reused.
+*/
+class VKUploadBatcher
+{
+
+    public:
+
+        VKUploadBatcher() = default;
+
+        VKUploadBatcher(const VKUploadBatcher&) = delete;
+        VKUploadBatcher& operator = (const VKUploadBatcher&) = delete;
+
+        ~VKUploadBatcher();
+
+        /*
+        Allocates the command buffers and fences for all batches. 'batchSize' specifies the number of bytes after which a batch is submitted.
+        Batches are submitted through the specified command queue, so they keep their order with pending command buffers.
+        */
+        void InitializeDevice(VKDevice& device, VKDeviceMemoryManager& deviceMemoryMngr, VKCommandQueue& commandQueue, VkDeviceSize batchSize);
+
+        // Records an upload of the specified data into the destination buffer.
+        void WriteBuffer(VkBuffer dstBuffer, VkDeviceSize dstOffset, const void* data, VkDeviceSize dataSize);
+
+        // Records an upload of the specified image data into the destination texture. 'extent' must include the array layers.
+        void WriteTexture(
+            VKTexture&              dstTexture,
+            const TextureRegion&    textureRegion,
+            const Extent3D&         extent,
+            const void*             data,
+            VkDeviceSize            dataSize,
+            std::uint32_t           srcRowStride,
+            std::uint32_t           bpp
+        );
+
+        // Records a copy of the entire source buffer into the destination buffer after all previous commands in the queue have finished accessing it.
+        void CopyBuffer(VkBuffer srcBuffer, VkBuffer dstBuffer, VkDeviceSize size);
+
+        /*
+        Submits the current batch to the graphics queue without waiting for its completion.
+        This must be called before any other submission to the graphics queue that depends on the uploaded data.
+        */
+        void Submit();
+
+        /*
+        Waits until all batches that reference the specified buffer or image have been completed.
+        The current batch is only submitted if it references the resource, so releasing unrelated resources doesn't stall the CPU.
+        */
+        void WaitForBuffer(VkBuffer buffer);
+        void WaitForImage(VkImage image);
+
+        // Returns true if there are any recorded uploads that have not been submitted yet.
+        inline bool HasPendingUploads() const
+        {
+            return isRecording_;
+        }
+
+    private:
+
+        static constexpr std::uint32_t maxNumBatches = 3;
+
+        struct Batch
+        {
+            VkCommandBuffer         commandBuffer   = VK_NULL_HANDLE;
+            VKPtr<VkFence>          fence;
+            VKStagingBufferPool     stagingPool;
+            bool                    inFlight        = false;
+            std::vector<VkBuffer>   buffers;                    // Buffers referenced by this batch until it has been completed.
+            std::vector<VkImage>    images;                     // Images referenced by this batch until it has been completed.
+        };
+
+    private:
+
+        // Begins recording the current batch if it's not already recording. Waits for the previous submission of this batch if necessary.
+        void BeginBatch();
+
+        // Waits until the specified batch has been completed by the GPU and clears its resource references.
+        void WaitForBatch(Batch& batch);
+
+        // Submits the specified batch if it's currently recording and waits until it has been completed.
+        void SubmitAndWaitForBatch(Batch& batch);
+
+        // Adds the specified size to the recorded data and submits the batch if the threshold has been reached.
+        void SubmitIfFull(VkDeviceSize dataSize);
+
+    private:
+
+        VKDevice*           device_         = nullptr;
+        VKCommandQueue*     commandQueue_   = nullptr;
+        VKCommandContext    context_;
+        Batch               batches_[maxNumBatches];
+        std::uint32_t       batchIndex_     = 0;
+        bool                isRecording_    = false;
+        VkDeviceSize        recordedSize_   = 0;
+        VkDeviceSize        batchSize_      = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
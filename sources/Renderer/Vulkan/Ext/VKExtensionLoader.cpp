@@ -126,6 +126,27 @@ static bool DECL_LOADVKEXT_PROC(EXT_conditional_rendering)
     return true;
 }
 
+static bool DECL_LOADVKEXT_PROC(EXT_extended_dynamic_state)
+{
+    LOAD_VKPROC( vkCmdSetCullModeEXT          );
+    LOAD_VKPROC( vkCmdSetFrontFaceEXT         );
+    LOAD_VKPROC( vkCmdSetPrimitiveTopologyEXT );
+    LOAD_VKPROC( vkCmdSetDepthTestEnableEXT   );
+    LOAD_VKPROC( vkCmdSetDepthWriteEnableEXT  );
+    LOAD_VKPROC( vkCmdSetDepthCompareOpEXT    );
+    LOAD_VKPROC( vkCmdSetStencilTestEnableEXT );
+    LOAD_VKPROC( vkCmdSetStencilOpEXT         );
+    return true;
+}
+
+static bool DECL_LOADVKEXT_PROC(EXT_extended_dynamic_state2)
+{
+    LOAD_VKPROC( vkCmdSetDepthBiasEnableEXT         );
+    LOAD_VKPROC( vkCmdSetPrimitiveRestartEnableEXT  );
+    LOAD_VKPROC( vkCmdSetRasterizerDiscardEnableEXT );
+    return true;
+}
+
 static bool DECL_LOADVKEXT_PROC(KHR_get_physical_device_properties2)
 {
     LOAD_VKPROC( vkGetPhysicalDeviceFeatures2KHR                    );
@@ -138,6 +159,14 @@ static bool DECL_LOADVKEXT_PROC(KHR_get_physical_device_properties2)
     return true;
 }
 
+static bool DECL_LOADVKEXT_PROC(KHR_timeline_semaphore)
+{
+    LOAD_VKPROC( vkGetSemaphoreCounterValueKHR );
+    LOAD_VKPROC( vkWaitSemaphoresKHR           );
+    LOAD_VKPROC( vkSignalSemaphoreKHR          );
+    return true;
+}
+
 static bool DECL_LOADVKEXT_PROC(EXT_transform_feedback)
 {
     LOAD_VKPROC( vkCmdBindTransformFeedbackBuffersEXT );
@@ -246,10 +275,18 @@ bool VKLoadDeviceExtensions(VkDevice device, const ArrayView<const char*>& suppo
     LOAD_VKEXT( KHR_get_physical_device_properties2 );
     LOAD_VKEXT( EXT_conditional_rendering           );
     LOAD_VKEXT( EXT_transform_feedback              );
+    LOAD_VKEXT( KHR_timeline_semaphore              );
+    LOAD_VKEXT( EXT_extended_dynamic_state          );
+    LOAD_VKEXT( EXT_extended_dynamic_state2         );
 
     ENABLE_VKEXT( EXT_conservative_rasterization );
+    ENABLE_VKEXT( EXT_descriptor_indexing        );
+    ENABLE_VKEXT( EXT_graphics_pipeline_library  );
+    ENABLE_VKEXT( EXT_memory_budget              );
     ENABLE_VKEXT( EXT_nested_command_buffer      );
     ENABLE_VKEXT( KHR_imageless_framebuffer      );
+    ENABLE_VKEXT( KHR_maintenance3               );
+    ENABLE_VKEXT( KHR_pipeline_library           );
 
     #undef LOAD_VKEXT
 
@@ -34,18 +34,42 @@ static const char* g_VKOptionalExtensions[] =
     #if VK_EXT_debug_utils
     VK_EXT_DEBUG_UTILS_EXTENSION_NAME,
     #endif
+    #if VK_EXT_descriptor_indexing
+    VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME,
+    #endif
+    #if VK_EXT_extended_dynamic_state
+    VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME,
+    #endif
+    #if VK_EXT_extended_dynamic_state2
+    VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME,
+    #endif
+    #if VK_EXT_graphics_pipeline_library
+    VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME,
+    #endif
+    #if VK_EXT_memory_budget
+    VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,
+    #endif
     #if VK_KHR_get_physical_device_properties2
     VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME,
     #endif
     #if VK_KHR_imageless_framebuffer
     VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME,
     #endif
+    #if VK_KHR_maintenance3
+    VK_KHR_MAINTENANCE_3_EXTENSION_NAME,
+    #endif
+    #if VK_KHR_pipeline_library
+    VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME,
+    #endif
     #if VK_KHR_portability_enumeration
     VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME,
     #endif
     #if VK_KHR_sampler_mirror_clamp_to_edge
     VK_KHR_SAMPLER_MIRROR_CLAMP_TO_EDGE_EXTENSION_NAME,
     #endif
+    #if VK_KHR_timeline_semaphore
+    VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME,
+    #endif
     #if VK_EXT_transform_feedback
     VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME,
     #endif
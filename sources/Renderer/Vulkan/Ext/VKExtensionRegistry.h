@@ -31,14 +31,22 @@ enum class VKExt
 
     /* Khronos extensions */
     KHR_maintenance1,
+    KHR_maintenance3,
     KHR_get_physical_device_properties2,
     KHR_imageless_framebuffer,
+    KHR_pipeline_library,
+    KHR_timeline_semaphore,
 
     /* Multivendor extensions */
     EXT_conditional_rendering,
     EXT_conservative_rasterization,
     EXT_debug_marker,
     EXT_debug_utils,
+    EXT_descriptor_indexing,
+    EXT_extended_dynamic_state,
+    EXT_extended_dynamic_state2,
+    EXT_graphics_pipeline_library,
+    EXT_memory_budget,
     EXT_nested_command_buffer,
     EXT_transform_feedback,
 
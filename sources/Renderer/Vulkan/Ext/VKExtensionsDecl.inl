@@ -69,6 +69,23 @@ DECL_VKPROC( vkSetDebugUtilsObjectNameEXT    );
 DECL_VKPROC( vkSetDebugUtilsObjectTagEXT     );
 DECL_VKPROC( vkSubmitDebugUtilsMessageEXT    );
 
+/* VK_EXT_extended_dynamic_state */
+
+DECL_VKPROC( vkCmdSetCullModeEXT          );
+DECL_VKPROC( vkCmdSetFrontFaceEXT         );
+DECL_VKPROC( vkCmdSetPrimitiveTopologyEXT );
+DECL_VKPROC( vkCmdSetDepthTestEnableEXT   );
+DECL_VKPROC( vkCmdSetDepthWriteEnableEXT  );
+DECL_VKPROC( vkCmdSetDepthCompareOpEXT    );
+DECL_VKPROC( vkCmdSetStencilTestEnableEXT );
+DECL_VKPROC( vkCmdSetStencilOpEXT         );
+
+/* VK_EXT_extended_dynamic_state2 */
+
+DECL_VKPROC( vkCmdSetDepthBiasEnableEXT         );
+DECL_VKPROC( vkCmdSetPrimitiveRestartEnableEXT  );
+DECL_VKPROC( vkCmdSetRasterizerDiscardEnableEXT );
+
 /* VK_KHR_get_physical_device_properties2 */
 
 DECL_VKPROC( vkGetPhysicalDeviceFeatures2KHR                    );
@@ -79,6 +96,12 @@ DECL_VKPROC( vkGetPhysicalDeviceQueueFamilyProperties2KHR       );
 DECL_VKPROC( vkGetPhysicalDeviceMemoryProperties2KHR            );
 DECL_VKPROC( vkGetPhysicalDeviceSparseImageFormatProperties2KHR );
 
+/* VK_KHR_timeline_semaphore */
+
+DECL_VKPROC( vkGetSemaphoreCounterValueKHR );
+DECL_VKPROC( vkWaitSemaphoresKHR           );
+DECL_VKPROC( vkSignalSemaphoreKHR          );
+
 
 
 // ================================================================================
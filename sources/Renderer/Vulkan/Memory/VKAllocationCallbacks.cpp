@@ -0,0 +1,122 @@
+/*
+ * VKAllocationCallbacks.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKAllocationCallbacks.h"
+#include "../../../Core/MemoryAllocation.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/Assertion.h"
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+The free callback of Vulkan does not provide the size and alignment of the memory block, but LLGL::Allocator requires them.
+Hence, each memory block is prefixed by a header that stores these values right in front of the address that is returned to the driver.
+*/
+struct VKAllocationHeader
+{
+    std::size_t size;
+    std::size_t alignment;
+};
+
+// Returns the offset from the beginning of the memory block to the address that is returned to the driver.
+static std::size_t GetAllocationHeaderOffset(std::size_t alignment)
+{
+    return GetAlignedSize(sizeof(VKAllocationHeader), alignment);
+}
+
+static VKAllocationHeader* GetAllocationHeader(void* ptr)
+{
+    return reinterpret_cast<VKAllocationHeader*>(ptr) - 1;
+}
+
+static std::size_t GetAllocationAlignment(std::size_t alignment)
+{
+    return (alignment > alignof(VKAllocationHeader) ? alignment : alignof(VKAllocationHeader));
+}
+
+static void* VKAPI_PTR VKAllocationFunction(void* /*userData*/, std::size_t size, std::size_t alignment, VkSystemAllocationScope /*scope*/)
+{
+    alignment = GetAllocationAlignment(alignment);
+    const std::size_t headerOffset = GetAllocationHeaderOffset(alignment);
+
+    /* Vulkan expects null on failure, so allocations must not throw across the driver */
+    char* mem = static_cast<char*>(TryAllocateMemory(headerOffset + size, alignment, AllocationCategory::Native));
+    if (mem == nullptr)
+        return nullptr;
+
+    void* ptr = mem + headerOffset;
+    *GetAllocationHeader(ptr) = VKAllocationHeader{ size, alignment };
+    return ptr;
+}
+
+static void VKAPI_PTR VKFreeFunction(void* /*userData*/, void* ptr)
+{
+    if (ptr != nullptr)
+    {
+        const VKAllocationHeader header = *GetAllocationHeader(ptr);
+        const std::size_t headerOffset = GetAllocationHeaderOffset(header.alignment);
+        FreeMemory(static_cast<char*>(ptr) - headerOffset, headerOffset + header.size, header.alignment, AllocationCategory::Native);
+    }
+}
+
+static void* VKAPI_PTR VKReallocationFunction(void* userData, void* original, std::size_t size, std::size_t alignment, VkSystemAllocationScope scope)
+{
+    if (original == nullptr)
+        return VKAllocationFunction(userData, size, alignment, scope);
+
+    if (size == 0)
+    {
+        VKFreeFunction(userData, original);
+        return nullptr;
+    }
+
+    /* Vulkan requires the same alignment as the original allocation, so the header offset does not change */
+    const VKAllocationHeader header = *GetAllocationHeader(original);
+    LLGL_ASSERT(GetAllocationAlignment(alignment) == header.alignment, "Vulkan reallocation with different alignment");
+
+    const std::size_t headerOffset = GetAllocationHeaderOffset(header.alignment);
+    char* mem = static_cast<char*>(
+        ReallocateMemory(
+            static_cast<char*>(original) - headerOffset,
+            headerOffset + header.size,
+            headerOffset + size,
+            header.alignment,
+            AllocationCategory::Native
+        )
+    );
+    if (mem == nullptr)
+        return nullptr;
+
+    void* ptr = mem + headerOffset;
+    GetAllocationHeader(ptr)->size = size;
+    return ptr;
+}
+
+const VkAllocationCallbacks* VKGetAllocationCallbacks()
+{
+    static const VkAllocationCallbacks allocationCallbacks
+    {
+        /*pUserData:*/              nullptr,
+        /*pfnAllocation:*/          VKAllocationFunction,
+        /*pfnReallocation:*/        VKReallocationFunction,
+        /*pfnFree:*/                VKFreeFunction,
+        /*pfnInternalAllocation:*/  nullptr,
+        /*pfnInternalFree:*/        nullptr,
+    };
+    return &allocationCallbacks;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
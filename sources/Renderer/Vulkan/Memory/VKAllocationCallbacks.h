@@ -0,0 +1,33 @@
+/*
+ * VKAllocationCallbacks.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_ALLOCATION_CALLBACKS_H
+#define LLGL_VK_ALLOCATION_CALLBACKS_H
+
+
+#include <vulkan/vulkan.h>
+
+
+namespace LLGL
+{
+
+
+/*
+Returns the host allocation callbacks that route all host memory allocations of the Vulkan driver through the active LLGL allocator.
+These allocations are recorded with AllocationCategory::Native. The same callbacks must be passed to the vkCreate* and vkDestroy* functions of an object.
+*/
+const VkAllocationCallbacks* VKGetAllocationCallbacks();
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -30,7 +30,7 @@ VKDeviceMemory::VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t
         allocInfo.allocationSize    = size;
         allocInfo.memoryTypeIndex   = memoryTypeIndex;
     }
-    VkResult result = vkAllocateMemory(device, &allocInfo, nullptr, deviceMemory_.ReleaseAndGetAddressOf());
+    VkResult result = vkAllocateMemory(device, &allocInfo, VKGetAllocationCallbacks(), deviceMemory_.ReleaseAndGetAddressOf());
 
     if (result != VK_SUCCESS)
     {
@@ -41,17 +41,25 @@ VKDeviceMemory::VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t
 
 void* VKDeviceMemory::Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size)
 {
-    void* data = nullptr;
+    if (mappedData_ == nullptr)
+    {
+        /* Map entire chunk once, since Vulkan does not allow a memory object to be mapped more than once at a time */
+        VkResult result = vkMapMemory(device, deviceMemory_, 0, VK_WHOLE_SIZE, 0, &mappedData_);
+        VKThrowIfFailed(result, "failed to map Vulkan buffer into CPU memory space");
+    }
 
-    VkResult result = vkMapMemory(device, deviceMemory_, offset, size, 0, &data);
-    VKThrowIfFailed(result, "failed to map Vulkan buffer into CPU memory space");
+    ++mapRefCount_;
 
-    return data;
+    return static_cast<char*>(mappedData_) + offset;
 }
 
 void VKDeviceMemory::Unmap(VkDevice device)
 {
-    vkUnmapMemory(device, deviceMemory_);
+    if (mapRefCount_ > 0 && --mapRefCount_ == 0)
+    {
+        vkUnmapMemory(device, deviceMemory_);
+        mappedData_ = nullptr;
+    }
 }
 
 VKDeviceMemoryRegion* VKDeviceMemory::Allocate(VkDeviceSize size, VkDeviceSize alignment, bool reduceFragmentation)
@@ -114,6 +122,22 @@ bool VKDeviceMemory::IsEmpty() const
     return blocks_.empty();
 }
 
+void VKDeviceMemory::ResetEmpty()
+{
+    LLGL_ASSERT(IsEmpty(), "cannot reset device memory chunk with allocated blocks");
+    fragmentedBlocks_.clear();
+    maxFragmentedBlockSize_ = 0;
+    maxNewBlockSize_        = GetSize();
+}
+
+VkDeviceSize VKDeviceMemory::GetUsedSize() const
+{
+    VkDeviceSize size = 0;
+    for (const auto& block : blocks_)
+        size += block->GetSize();
+    return size;
+}
+
 VkDeviceSize VKDeviceMemory::GetMaxAllocationSize() const
 {
     return std::max(maxNewBlockSize_, maxFragmentedBlockSize_);
@@ -122,8 +146,11 @@ VkDeviceSize VKDeviceMemory::GetMaxAllocationSize() const
 void VKDeviceMemory::AccumDetails(VKDeviceMemoryDetails& details) const
 {
     details.numChunks               += 1;
+    details.numEmptyChunks          += (IsEmpty() ? 1 : 0);
     details.numBlocks               += blocks_.size();
     details.numFragments            += fragmentedBlocks_.size();
+    details.allocatedSize           += GetSize();
+    details.usedSize                += GetUsedSize();
     details.maxNewBlockSize         = std::max(details.maxNewBlockSize, maxNewBlockSize_);
     details.maxFragmentedBlockSize  = std::max(details.maxFragmentedBlockSize, maxFragmentedBlockSize_);
 }
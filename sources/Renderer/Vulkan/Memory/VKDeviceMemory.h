@@ -25,12 +25,15 @@ namespace LLGL
 {
 
 
-// Details structure of VKDeviceMemory for debugging.
+// Details structure of VKDeviceMemory for debugging and profiling.
 struct VKDeviceMemoryDetails
 {
     std::size_t     numChunks               = 0;
+    std::size_t     numEmptyChunks          = 0;
     std::size_t     numBlocks               = 0;
     std::size_t     numFragments            = 0;
+    VkDeviceSize    allocatedSize           = 0;
+    VkDeviceSize    usedSize                = 0;
     VkDeviceSize    maxNewBlockSize         = 0;
     VkDeviceSize    maxFragmentedBlockSize  = 0;
 };
@@ -49,6 +52,11 @@ class VKDeviceMemory
         VKDeviceMemory(VKDeviceMemory&&) = default;
         VKDeviceMemory& operator = (VKDeviceMemory&&) = default;
 
+        /*
+        Maps the specified range of this device memory chunk into CPU memory space.
+        The entire chunk is mapped on the first call and stays mapped until each call has been matched by Unmap(),
+        so blocks of the same chunk can be mapped simultaneously and persistently mapped blocks don't conflict with temporary mappings.
+        */
         void* Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size);
         void Unmap(VkDevice device);
 
@@ -61,6 +69,12 @@ class VKDeviceMemory
         // Returns true if this device memory has no more blocks.
         bool IsEmpty() const;
 
+        // Discards all fragmented blocks of an empty device memory chunk, so it can be reused from the start.
+        void ResetEmpty();
+
+        // Returns the sum of the sizes of all allocated blocks.
+        VkDeviceSize GetUsedSize() const;
+
         // Returns the maximal size that can be allocated for a device memory region within this device memory chunk.
         VkDeviceSize GetMaxAllocationSize() const;
 
@@ -92,6 +106,18 @@ class VKDeviceMemory
             return memoryTypeIndex_;
         }
 
+        // Stores the frame in which this device memory chunk has become empty.
+        inline void SetEmptyFrame(std::uint64_t frame)
+        {
+            emptyFrame_ = frame;
+        }
+
+        // Returns the frame in which this device memory chunk has become empty.
+        inline std::uint64_t GetEmptyFrame() const
+        {
+            return emptyFrame_;
+        }
+
     private:
 
         // Returns the next offset after the last block.
@@ -145,6 +171,11 @@ class VKDeviceMemory
         VkDeviceSize                            maxFragmentedBlockSize_ = 0;
         std::vector<VKDeviceMemoryRegionPtr>    fragmentedBlocks_;
 
+        std::uint64_t                           emptyFrame_             = 0;
+
+        void*                                   mappedData_             = nullptr;
+        std::uint32_t                           mapRefCount_            = 0;
+
 };
 
 
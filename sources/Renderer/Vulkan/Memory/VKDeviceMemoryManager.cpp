@@ -8,6 +8,10 @@
 #include "VKDeviceMemoryManager.h"
 #include "../VKCore.h"
 #include "../../ContainerTypes.h"
+#include <LLGL/RenderingDebuggerFlags.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
+#include <algorithm>
 
 
 namespace LLGL
@@ -25,6 +29,22 @@ VKDeviceMemoryManager::VKDeviceMemoryManager(
     minAllocationSize_   { minAllocationSize   },
     reduceFragmentation_ { reduceFragmentation }
 {
+    /*
+    Find memory types that can be written by the CPU directly into device local memory.
+    Without resizable BAR, such memory is limited to a small window (typically 256 MB) that is shared with the driver,
+    so those heaps are ignored and buffers keep using staging buffers instead.
+    */
+    constexpr VkDeviceSize minDirectWriteHeapSize = 256ull*1024ull*1024ull;
+
+    for_range(i, memoryProperties_.memoryTypeCount)
+    {
+        const VkMemoryType& memoryType = memoryProperties_.memoryTypes[i];
+        if ((memoryType.propertyFlags & directWriteMemoryProperties) == directWriteMemoryProperties &&
+            memoryProperties_.memoryHeaps[memoryType.heapIndex].size > minDirectWriteHeapSize)
+        {
+            directWriteMemoryTypeBits_ |= (1u << i);
+        }
+    }
 }
 
 VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
@@ -37,6 +57,8 @@ VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
     const VkDeviceSize  allocationSize  = std::max(minAllocationSize_, alignedSize);
     const std::uint32_t memoryTypeIndex = FindMemoryType(memoryTypeBits, properties);
 
+    hasAllocatedInFrame_ = true;
+
     if (VKDeviceMemory* chunk = FindOrAllocChunk(allocationSize, memoryTypeIndex, alignedSize))
         return chunk->Allocate(size, alignment);
     else
@@ -64,9 +86,17 @@ void VKDeviceMemoryManager::Release(VKDeviceMemoryRegion* region)
             /* Release block in chunk */
             chunk->Release(region);
 
-            /* Release chunk if it's empty */
+            /* Release chunk if it's empty or keep it alive for reuse */
             if (chunk->IsEmpty())
-                chunks_.erase(chunk);
+            {
+                if (chunkLifetime_ > 0)
+                {
+                    chunk->ResetEmpty();
+                    chunk->SetEmptyFrame(frame_);
+                }
+                else
+                    ReleaseChunk(chunk);
+            }
         }
     }
 }
@@ -81,6 +111,171 @@ VKDeviceMemoryDetails VKDeviceMemoryManager::QueryDetails() const
     return details;
 }
 
+void VKDeviceMemoryManager::SetChunkLifetime(std::uint32_t numFrames)
+{
+    chunkLifetime_ = numFrames;
+}
+
+void VKDeviceMemoryManager::SetBudgetCallback(VulkanMemoryBudgetCallback callback, void* userData, float threshold)
+{
+    budgetCallback_     = callback;
+    budgetUserData_     = userData;
+    budgetThreshold_    = threshold;
+}
+
+void VKDeviceMemoryManager::NextFrame()
+{
+    /* Gather empty chunks that have exceeded their lifetime first, since releasing a chunk reorders the container */
+    std::vector<VKDeviceMemory*> expiredChunks;
+    for (const auto& chunk : chunks_)
+    {
+        if (chunk->IsEmpty() && frame_ - chunk->GetEmptyFrame() >= chunkLifetime_)
+            expiredChunks.push_back(chunk.get());
+    }
+
+    for (VKDeviceMemory* chunk : expiredChunks)
+        ReleaseChunk(chunk);
+
+    ++frame_;
+    hasAllocatedInFrame_ = false;
+}
+
+void VKDeviceMemoryManager::UpdateBudget(const VkDeviceSize* heapBudgets, const VkDeviceSize* heapUsages)
+{
+    for_range(i, memoryProperties_.memoryHeapCount)
+    {
+        /* Fall back to heap size and allocations of this manager if the budget is unknown */
+        heapBudgets_[i] = (heapBudgets != nullptr ? heapBudgets[i] : memoryProperties_.memoryHeaps[i].size);
+        heapUsages_[i]  = (heapUsages  != nullptr ? heapUsages[i]  : heapAllocatedSizes_[i]);
+
+        /* Only invoke callback when the usage crosses the threshold, not every frame it stays above it */
+        const bool isOverBudget = (static_cast<double>(heapUsages_[i]) > static_cast<double>(heapBudgets_[i]) * budgetThreshold_);
+        if (isOverBudget != heapsOverBudget_[i])
+        {
+            heapsOverBudget_[i] = isOverBudget;
+            if (isOverBudget && budgetCallback_ != nullptr)
+                budgetCallback_(i, heapUsages_[i], heapBudgets_[i], budgetUserData_);
+        }
+    }
+}
+
+VKDeviceMemory* VKDeviceMemoryManager::FindDefragmentationSource() const
+{
+    VKDeviceMemory* source      = nullptr;
+    VkDeviceSize    minUsedSize = 0;
+
+    for (const auto& chunk : chunks_)
+    {
+        if (chunk->IsEmpty())
+            continue;
+
+        /* Only consider chunks that are used by less than half */
+        const VkDeviceSize usedSize = chunk->GetUsedSize();
+        if (usedSize * 2 >= chunk->GetSize())
+            continue;
+
+        /* Compare utilization relative to chunk size */
+        if (source != nullptr && usedSize * source->GetSize() >= minUsedSize * chunk->GetSize())
+            continue;
+
+        /*
+        Blocks can only be relocated into another non-empty chunk of the same memory type with enough free space for all of them.
+        Empty chunks are excluded, since they are only kept alive until their lifetime expires and
+        relocating into them would only swap the roles of source and destination in the next pass.
+        */
+        const bool hasOtherChunk = std::any_of(
+            chunks_.begin(), chunks_.end(),
+            [&chunk, usedSize](const IndexedUniquePtr<VKDeviceMemory>& other)
+            {
+                return
+                (
+                    other.get() != chunk.get()                                  &&
+                    !other->IsEmpty()                                           &&
+                    other->GetMemoryTypeIndex() == chunk->GetMemoryTypeIndex()  &&
+                    other->GetSize() - other->GetUsedSize() >= usedSize
+                );
+            }
+        );
+
+        if (hasOtherChunk)
+        {
+            source      = chunk.get();
+            minUsedSize = usedSize;
+        }
+    }
+
+    return source;
+}
+
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateInExistingChunk(
+    const VkMemoryRequirements& requirements,
+    std::uint32_t               memoryTypeIndex,
+    const VKDeviceMemory*       excludedChunk)
+{
+    const VkDeviceSize alignedSize = GetAlignedSize(requirements.size, requirements.alignment);
+
+    /* Gather non-empty chunks of the same memory type that might fit the block */
+    SmallVector<VKDeviceMemory*, 8> candidates;
+    for (const auto& chunk : chunks_)
+    {
+        if (chunk.get() != excludedChunk && !chunk->IsEmpty() && chunk->GetMemoryTypeIndex() == memoryTypeIndex && chunk->GetMaxAllocationSize() >= alignedSize)
+            candidates.push_back(chunk.get());
+    }
+
+    /* Prefer the fullest chunk, so blocks are packed together and sparse chunks can be emptied */
+    std::sort(
+        candidates.begin(), candidates.end(),
+        [](const VKDeviceMemory* lhs, const VKDeviceMemory* rhs) -> bool
+        {
+            return (lhs->GetUsedSize() > rhs->GetUsedSize());
+        }
+    );
+
+    for (VKDeviceMemory* chunk : candidates)
+    {
+        if (VKDeviceMemoryRegion* region = chunk->Allocate(requirements.size, requirements.alignment, reduceFragmentation_))
+            return region;
+    }
+
+    return nullptr;
+}
+
+void VKDeviceMemoryManager::RecordRelocation(VkDeviceSize size)
+{
+    ++numRelocations_;
+    relocatedSize_ += size;
+}
+
+void VKDeviceMemoryManager::FlushProfile(ProfileDeviceMemoryRecord& outRecord)
+{
+    const VKDeviceMemoryDetails details = QueryDetails();
+
+    outRecord.numChunks         = details.numChunks;
+    outRecord.numEmptyChunks    = details.numEmptyChunks;
+    outRecord.numBlocks         = details.numBlocks;
+    outRecord.numFragments      = details.numFragments;
+    outRecord.allocatedSize     = details.allocatedSize;
+    outRecord.usedSize          = details.usedSize;
+    outRecord.maxFragmentSize   = details.maxFragmentedBlockSize;
+    outRecord.budget            = 0;
+    outRecord.usage             = 0;
+
+    for_range(i, memoryProperties_.memoryHeapCount)
+    {
+        outRecord.budget    += heapBudgets_[i];
+        outRecord.usage     += heapUsages_[i];
+    }
+
+    outRecord.chunkReleases     = numChunkReleases_;
+    outRecord.relocations       = numRelocations_;
+    outRecord.relocatedSize     = relocatedSize_;
+
+    /* Reset counters for next frame */
+    numChunkReleases_   = 0;
+    numRelocations_     = 0;
+    relocatedSize_      = 0;
+}
+
 #ifdef LLGL_DEBUG
 
 void VKDeviceMemoryManager::PrintBlocks(std::ostream& s, const std::string& title) const
@@ -121,7 +316,9 @@ std::uint32_t VKDeviceMemoryManager::FindMemoryType(std::uint32_t memoryTypeBits
 
 VKDeviceMemory* VKDeviceMemoryManager::AllocChunk(VkDeviceSize size, std::uint32_t memoryTypeIndex)
 {
-    return chunks_.emplace<VKDeviceMemory>(device_, size, memoryTypeIndex);
+    VKDeviceMemory* chunk = chunks_.emplace<VKDeviceMemory>(device_, size, memoryTypeIndex);
+    heapAllocatedSizes_[GetHeapIndex(memoryTypeIndex)] += size;
+    return chunk;
 }
 
 VKDeviceMemory* VKDeviceMemoryManager::FindOrAllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, VkDeviceSize minFreeBlockSize)
@@ -137,6 +334,18 @@ VKDeviceMemory* VKDeviceMemoryManager::FindOrAllocChunk(VkDeviceSize allocationS
     return AllocChunk(allocationSize, memoryTypeIndex);
 }
 
+void VKDeviceMemoryManager::ReleaseChunk(VKDeviceMemory* chunk)
+{
+    heapAllocatedSizes_[GetHeapIndex(chunk->GetMemoryTypeIndex())] -= chunk->GetSize();
+    ++numChunkReleases_;
+    chunks_.erase(chunk);
+}
+
+std::uint32_t VKDeviceMemoryManager::GetHeapIndex(std::uint32_t memoryTypeIndex) const
+{
+    return memoryProperties_.memoryTypes[memoryTypeIndex].heapIndex;
+}
+
 
 } // /namespace LLGL
 
@@ -15,6 +15,7 @@
 #include "../../ContainerTypes.h"
 #include "VKDeviceMemory.h"
 #include "VKDeviceMemoryRegion.h"
+#include <LLGL/RendererConfiguration.h>
 #include <vector>
 #include <memory>
 
@@ -23,6 +24,8 @@ namespace LLGL
 {
 
 
+struct ProfileDeviceMemoryRecord;
+
 /*
 Vulkan device memory manager. Memory allocations are stored in a small hierarchy:
  - Chunk: denotes a single Vulkan memory allocation of type VkDeviceMemory
@@ -32,6 +35,14 @@ Vulkan device memory manager. Memory allocations are stored in a small hierarchy
 class VKDeviceMemoryManager
 {
 
+    public:
+
+        // Memory properties for buffers that are written by the CPU directly without staging buffers.
+        static constexpr VkMemoryPropertyFlags directWriteMemoryProperties =
+        (
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+        );
+
     public:
 
         VKDeviceMemoryManager(
@@ -64,6 +75,44 @@ class VKDeviceMemoryManager
         // Queries the memory details of all chunks.
         VKDeviceMemoryDetails QueryDetails() const;
 
+        // Sets the number of frames empty chunks are kept alive for reuse. If this is 0, empty chunks are released immediately.
+        void SetChunkLifetime(std::uint32_t numFrames);
+
+        // Sets the callback that is invoked when the usage of a memory heap crosses the specified fraction of its budget.
+        void SetBudgetCallback(VulkanMemoryBudgetCallback callback, void* userData, float threshold);
+
+        // Releases all empty chunks that have exceeded their lifetime and begins a new frame.
+        void NextFrame();
+
+        /*
+        Updates the memory heap budgets and invokes the budget callback for each heap that has crossed the threshold.
+        If the input arrays are null, the heap sizes and the memory allocated by this manager are used instead.
+        */
+        void UpdateBudget(const VkDeviceSize* heapBudgets, const VkDeviceSize* heapUsages);
+
+        /*
+        Returns the chunk that is the best candidate to be emptied by relocating its blocks, or null if there is none.
+        This is the non-empty chunk with the lowest utilization below 50% that shares its memory type with at least one other non-empty chunk
+        that has enough free space for all blocks of the source chunk.
+        */
+        VKDeviceMemory* FindDefragmentationSource() const;
+
+        /*
+        Allocates a new device memory block only within existing non-empty chunks of the specified memory type, except the excluded chunk.
+        The fullest chunk that fits the block is preferred. Returns null if no such chunk has enough space.
+        */
+        VKDeviceMemoryRegion* AllocateInExistingChunk(
+            const VkMemoryRequirements& requirements,
+            std::uint32_t               memoryTypeIndex,
+            const VKDeviceMemory*       excludedChunk
+        );
+
+        // Records that a block of the specified size has been relocated for the memory statistics.
+        void RecordRelocation(VkDeviceSize size);
+
+        // Flushes the memory statistics into the specified profile record and resets the counters.
+        void FlushProfile(ProfileDeviceMemoryRecord& outRecord);
+
         #ifdef LLGL_DEBUG
 
         void PrintBlocks(std::ostream& s, const std::string& title = "") const;
@@ -76,6 +125,27 @@ class VKDeviceMemoryManager
             return device_;
         }
 
+        /*
+        Returns true if any of the specified memory types is device local and host visible in a heap that is large enough for direct writes,
+        i.e. the device has resizable BAR (ReBAR) or unified memory (UMA).
+        */
+        inline bool HasDirectWriteMemory(std::uint32_t memoryTypeBits) const
+        {
+            return ((directWriteMemoryTypeBits_ & memoryTypeBits) != 0);
+        }
+
+        // Returns the bitmask of memory types that are suitable for direct writes (see HasDirectWriteMemory).
+        inline std::uint32_t GetDirectWriteMemoryTypeBits() const
+        {
+            return directWriteMemoryTypeBits_;
+        }
+
+        // Returns true if any new block has been allocated since the last call to NextFrame().
+        inline bool HasAllocatedInFrame() const
+        {
+            return hasAllocatedInFrame_;
+        }
+
     private:
 
         // Finds a memory type index for the specified attributes.
@@ -87,6 +157,12 @@ class VKDeviceMemoryManager
         // Finds a suitable device memory chunk or allocates a new one.
         VKDeviceMemory* FindOrAllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, VkDeviceSize minFreeBlockSize);
 
+        // Releases the specified chunk and removes its size from the allocated size of its memory heap.
+        void ReleaseChunk(VKDeviceMemory* chunk);
+
+        // Returns the index of the memory heap the specified memory type is allocated from.
+        std::uint32_t GetHeapIndex(std::uint32_t memoryTypeIndex) const;
+
     private:
 
         VkDevice                                    device_;
@@ -94,9 +170,27 @@ class VKDeviceMemoryManager
 
         VkDeviceSize                                minAllocationSize_      = 1024*1024;
         bool                                        reduceFragmentation_    = false;
+        std::uint32_t                               directWriteMemoryTypeBits_ = 0;
 
         UnorderedUniquePtrVector<VKDeviceMemory>    chunks_;
 
+        std::uint64_t                               frame_                                   = 0;
+        std::uint32_t                               chunkLifetime_                           = 0;
+        bool                                        hasAllocatedInFrame_                     = false;
+
+        VkDeviceSize                                heapAllocatedSizes_[VK_MAX_MEMORY_HEAPS] = {};
+        VkDeviceSize                                heapBudgets_[VK_MAX_MEMORY_HEAPS]        = {};
+        VkDeviceSize                                heapUsages_[VK_MAX_MEMORY_HEAPS]         = {};
+        bool                                        heapsOverBudget_[VK_MAX_MEMORY_HEAPS]    = {};
+
+        VulkanMemoryBudgetCallback                  budgetCallback_                          = nullptr;
+        void*                                       budgetUserData_                          = nullptr;
+        float                                       budgetThreshold_                         = 1.0f;
+
+        std::uint64_t                               numChunkReleases_                        = 0;
+        std::uint64_t                               numRelocations_                          = 0;
+        VkDeviceSize                                relocatedSize_                           = 0;
+
 };
 
 
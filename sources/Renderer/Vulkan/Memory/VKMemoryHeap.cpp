@@ -0,0 +1,78 @@
+/*
+ * VKMemoryHeap.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKMemoryHeap.h"
+#include "../VKCore.h"
+#include "../../../Core/CoreUtils.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+VKMemoryHeap::VKMemoryHeap(
+    VkDevice                    device,
+    std::uint32_t               memoryTypeIndex,
+    const MemoryHeapDescriptor& desc)
+:
+    MemoryHeap    { desc.size                                                     },
+    device_       { device                                                        },
+    resources_    { desc.resources                                                },
+    deviceMemory_ { device, static_cast<VkDeviceSize>(desc.size), memoryTypeIndex }
+{
+    if (desc.debugName != nullptr)
+        SetDebugName(desc.debugName);
+}
+
+void VKMemoryHeap::SetDebugName(const char* name)
+{
+    #if VK_EXT_debug_marker
+    VKSetDebugName(device_, VK_OBJECT_TYPE_DEVICE_MEMORY, reinterpret_cast<std::uint64_t>(GetVkDeviceMemory()), name);
+    #endif
+}
+
+VKDeviceMemoryRegion* VKMemoryHeap::AllocPlacedRegion(VkDeviceSize offset, const VkMemoryRequirements& requirements)
+{
+    /* Validate memory type, alignment, and bounds of the placement */
+    const std::uint32_t memoryTypeIndex = deviceMemory_.GetMemoryTypeIndex();
+    if ((requirements.memoryTypeBits & (1u << memoryTypeIndex)) == 0)
+        return nullptr;
+    if (requirements.alignment > 0 && offset % requirements.alignment != 0)
+        return nullptr;
+    if (offset > deviceMemory_.GetSize() || requirements.size > deviceMemory_.GetSize() - offset)
+        return nullptr;
+
+    /* Regions of a memory heap are not tracked by the device memory chunk, so they are allowed to overlap */
+    placedRegions_.emplace_back(MakeUnique<VKDeviceMemoryRegion>(&deviceMemory_, requirements.size, offset, memoryTypeIndex));
+    return placedRegions_.back().get();
+}
+
+bool VKMemoryHeap::ReleasePlacedRegion(VKDeviceMemoryRegion* region)
+{
+    auto it = std::find_if(
+        placedRegions_.begin(),
+        placedRegions_.end(),
+        [region](const VKDeviceMemoryRegionPtr& entry) -> bool
+        {
+            return (entry.get() == region);
+        }
+    );
+    if (it != placedRegions_.end())
+    {
+        placedRegions_.erase(it);
+        return true;
+    }
+    return false;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,87 @@
+/*
+ * VKMemoryHeap.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_MEMORY_HEAP_H
+#define LLGL_VK_MEMORY_HEAP_H
+
+
+#include <LLGL/MemoryHeap.h>
+#include <LLGL/MemoryHeapFlags.h>
+#include "VKDeviceMemory.h"
+#include "VKDeviceMemoryRegion.h"
+#include "../Vulkan.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Memory heap that holds a single VkDeviceMemory allocation in device local memory.
+Unlike VKDeviceMemoryManager, regions are placed at explicit offsets and may overlap, so resources can alias the same memory.
+*/
+class VKMemoryHeap final : public MemoryHeap
+{
+
+    public:
+
+        void SetDebugName(const char* name) override;
+
+    public:
+
+        VKMemoryHeap(
+            VkDevice                    device,
+            std::uint32_t               memoryTypeIndex,
+            const MemoryHeapDescriptor& desc
+        );
+
+        /*
+        Returns a new region at the specified offset for a resource with the specified requirements,
+        or null if the offset is misaligned, the region exceeds this heap, or the heap's memory type is not supported by the resource.
+        */
+        VKDeviceMemoryRegion* AllocPlacedRegion(VkDeviceSize offset, const VkMemoryRequirements& requirements);
+
+        // Releases the specified region. Returns false if the region was not allocated by this heap.
+        bool ReleasePlacedRegion(VKDeviceMemoryRegion* region);
+
+        // Returns true if resources of the specified kind (MemoryHeapResourceFlags) can be placed inside this heap.
+        inline bool SupportsResources(long resources) const
+        {
+            return ((resources_ & resources) == resources);
+        }
+
+        // Returns true if any resources are still placed inside this heap.
+        inline bool HasPlacedRegions() const
+        {
+            return !placedRegions_.empty();
+        }
+
+        // Returns the native VkDeviceMemory handle.
+        inline VkDeviceMemory GetVkDeviceMemory() const
+        {
+            return deviceMemory_.GetVkDeviceMemory();
+        }
+
+    private:
+
+        VkDevice                                device_         = VK_NULL_HANDLE;
+        long                                    resources_      = 0;
+        VKDeviceMemory                          deviceMemory_;
+        std::vector<VKDeviceMemoryRegionPtr>    placedRegions_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -24,11 +24,21 @@ VKDescriptorSetLayout::VKDescriptorSetLayout(VkDevice device) :
 }
 
 VKDescriptorSetLayout::VKDescriptorSetLayout(VKDescriptorSetLayout&& rhs) noexcept :
-    setLayout_         { std::move(rhs.setLayout_)         },
-    setLayoutBindings_ { std::move(rhs.setLayoutBindings_) }
+    setLayout_              { std::move(rhs.setLayout_)              },
+    setLayoutBindings_      { std::move(rhs.setLayoutBindings_)      },
+    setLayoutBindingFlags_  { std::move(rhs.setLayoutBindingFlags_)  }
 {
 }
 
+static bool IsUpdateAfterBindFlag(VkFlags bindingFlags)
+{
+    #if VK_EXT_descriptor_indexing
+    return ((bindingFlags & VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT) != 0);
+    #else
+    return false;
+    #endif
+}
+
 void VKDescriptorSetLayout::GetLayoutBindings(std::vector<VKLayoutBinding>& outBindings) const
 {
     /* Create list of binding points (for later pass to 'VkWriteDescriptorSet::dstBinding') */
@@ -45,20 +55,37 @@ void VKDescriptorSetLayout::GetLayoutBindings(std::vector<VKLayoutBinding>& outB
                     /*dstArrayElement:*/    arrayElement,
                     /*barrierSlot:*/        ~0u,
                     /*descriptorType:*/     setLayoutBindings_[i].descriptorType,
-                    /*stageFlags:*/         setLayoutBindings_[i].stageFlags
+                    /*stageFlags:*/         setLayoutBindings_[i].stageFlags,
+                    /*bindFlags:*/          0,
+                    /*updateAfterBind:*/    IsUpdateAfterBindFlag(GetBindingFlags(i)),
                 }
             );
         }
     }
 }
 
-void VKDescriptorSetLayout::Initialize(VkDevice device, std::vector<VkDescriptorSetLayoutBinding>&& setLayoutBindings)
+void VKDescriptorSetLayout::Initialize(
+    VkDevice                                    device,
+    std::vector<VkDescriptorSetLayoutBinding>&& setLayoutBindings,
+    std::vector<VkFlags>&&                      setLayoutBindingFlags)
 {
-    setLayoutBindings_ = std::move(setLayoutBindings);
+    LLGL_ASSERT(setLayoutBindingFlags.empty() || setLayoutBindingFlags.size() == setLayoutBindings.size());
+    setLayoutBindings_      = std::move(setLayoutBindings);
+    setLayoutBindingFlags_  = std::move(setLayoutBindingFlags);
     SanitizeBindingSlots();
     CreateVkDescriptorSetLayout(device);
 }
 
+bool VKDescriptorSetLayout::HasUpdateAfterBindBindings() const
+{
+    for (VkFlags bindingFlags : setLayoutBindingFlags_)
+    {
+        if (IsUpdateAfterBindFlag(bindingFlags))
+            return true;
+    }
+    return false;
+}
+
 void VKDescriptorSetLayout::UpdateLayoutBindingType(std::uint32_t descriptorIndex, VkDescriptorType descriptorType)
 {
     LLGL_ASSERT(descriptorIndex < setLayoutBindings_.size());
@@ -81,7 +108,8 @@ void VKDescriptorSetLayout::FinalizeUpdateLayoutBindingTypes(VkDevice device)
 void VKDescriptorSetLayout::CreateVkDescriptorSetLayout(
     VkDevice                                        device,
     const ArrayView<VkDescriptorSetLayoutBinding>&  setLayoutBindings,
-    VKPtr<VkDescriptorSetLayout>&                   outDescriptorSetLayout)
+    VKPtr<VkDescriptorSetLayout>&                   outDescriptorSetLayout,
+    const ArrayView<VkFlags>&                       setLayoutBindingFlags)
 {
     VkDescriptorSetLayoutCreateInfo createInfo;
     {
@@ -91,7 +119,29 @@ void VKDescriptorSetLayout::CreateVkDescriptorSetLayout(
         createInfo.bindingCount = static_cast<std::uint32_t>(setLayoutBindings.size());
         createInfo.pBindings    = setLayoutBindings.data();
     }
-    VkResult result = vkCreateDescriptorSetLayout(device, &createInfo, nullptr, outDescriptorSetLayout.ReleaseAndGetAddressOf());
+
+    #if VK_EXT_descriptor_indexing
+    VkDescriptorSetLayoutBindingFlagsCreateInfoEXT bindingFlagsCreateInfo;
+    if (!setLayoutBindingFlags.empty())
+    {
+        LLGL_ASSERT(setLayoutBindingFlags.size() == setLayoutBindings.size());
+
+        bindingFlagsCreateInfo.sType            = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+        bindingFlagsCreateInfo.pNext            = nullptr;
+        bindingFlagsCreateInfo.bindingCount     = static_cast<std::uint32_t>(setLayoutBindingFlags.size());
+        bindingFlagsCreateInfo.pBindingFlags    = setLayoutBindingFlags.data();
+        createInfo.pNext = &bindingFlagsCreateInfo;
+
+        /* Descriptor sets with update-after-bind bindings must be allocated from pools with the same flag */
+        for (VkFlags bindingFlags : setLayoutBindingFlags)
+        {
+            if (IsUpdateAfterBindFlag(bindingFlags))
+                createInfo.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT;
+        }
+    }
+    #endif // /VK_EXT_descriptor_indexing
+
+    VkResult result = vkCreateDescriptorSetLayout(device, &createInfo, VKGetAllocationCallbacks(), outDescriptorSetLayout.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan descriptor set layout");
 }
 
@@ -213,9 +263,14 @@ void VKDescriptorSetLayout::SanitizeBindingSlots()
     }
 }
 
+VkFlags VKDescriptorSetLayout::GetBindingFlags(std::size_t bindingIndex) const
+{
+    return (bindingIndex < setLayoutBindingFlags_.size() ? setLayoutBindingFlags_[bindingIndex] : 0);
+}
+
 void VKDescriptorSetLayout::CreateVkDescriptorSetLayout(VkDevice device)
 {
-    VKDescriptorSetLayout::CreateVkDescriptorSetLayout(device, setLayoutBindings_, setLayout_);
+    VKDescriptorSetLayout::CreateVkDescriptorSetLayout(device, setLayoutBindings_, setLayout_, setLayoutBindingFlags_);
 }
 
 
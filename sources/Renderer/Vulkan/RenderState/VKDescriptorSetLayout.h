@@ -28,6 +28,7 @@ struct VKLayoutBinding
     VkDescriptorType        descriptorType;
     VkPipelineStageFlags    stageFlags;
     long                    bindFlags;
+    bool                    updateAfterBind;    // Descriptor can be updated while the descriptor set is bound in a pending command buffer.
 };
 
 // Wrapper to manager native Vulkan descriptor set layouts.
@@ -45,7 +46,12 @@ class VKDescriptorSetLayout
 
     public:
 
-        void Initialize(VkDevice device, std::vector<VkDescriptorSetLayoutBinding>&& setLayoutBindings);
+        // Initializes the descriptor set layout. Binding flags are optional and must otherwise have the same size as the layout bindings.
+        void Initialize(
+            VkDevice                                    device,
+            std::vector<VkDescriptorSetLayoutBinding>&& setLayoutBindings,
+            std::vector<VkFlags>&&                      setLayoutBindingFlags = {}
+        );
 
         void UpdateLayoutBindingType(std::uint32_t descriptorIndex, VkDescriptorType descriptorType);
         void FinalizeUpdateLayoutBindingTypes(VkDevice device);
@@ -63,12 +69,22 @@ class VKDescriptorSetLayout
             return setLayoutBindings_;
         }
 
+        // Returns the binding flags (VkDescriptorBindingFlagsEXT) for each layout binding or an empty list if there are none.
+        inline const std::vector<VkFlags>& GetVkLayoutBindingFlags() const
+        {
+            return setLayoutBindingFlags_;
+        }
+
+        // Returns true if any of the layout bindings can be updated after it has been bound.
+        bool HasUpdateAfterBindBindings() const;
+
     public:
 
         static void CreateVkDescriptorSetLayout(
             VkDevice                                        device,
             const ArrayView<VkDescriptorSetLayoutBinding>&  setLayoutBindings,
-            VKPtr<VkDescriptorSetLayout>&                   outDescriptorSetLayout
+            VKPtr<VkDescriptorSetLayout>&                   outDescriptorSetLayout,
+            const ArrayView<VkFlags>&                       setLayoutBindingFlags   = {}
         );
 
         static int CompareSWO(const VKDescriptorSetLayout& lhs, const VKDescriptorSetLayout& rhs);
@@ -79,12 +95,16 @@ class VKDescriptorSetLayout
         // Modifies binding slots that overlap with others since Vulkan needs to have unique binding slots within the same descriptor set.
         void SanitizeBindingSlots();
 
+        // Returns the binding flags for the specified layout binding or 0 if there are none.
+        VkFlags GetBindingFlags(std::size_t bindingIndex) const;
+
         void CreateVkDescriptorSetLayout(VkDevice device);
 
     private:
 
         VKPtr<VkDescriptorSetLayout>                setLayout_;
         std::vector<VkDescriptorSetLayoutBinding>   setLayoutBindings_;
+        std::vector<VkFlags>                        setLayoutBindingFlags_;
         bool                                        isAnyDescriptorTypeDirty_   = false;
 
 };
@@ -103,6 +103,45 @@ VkCopyDescriptorSet* VKDescriptorSetWriter::NextCopyDescriptor()
     return &(copies_.back());
 }
 
+template <typename T>
+static bool IsAdjacentInfo(const T* prev, std::uint32_t prevCount, const T* next)
+{
+    return (prev == nullptr ? next == nullptr : prev + prevCount == next);
+}
+
+bool VKDescriptorSetWriter::CoalesceLastWrite()
+{
+    if (writes_.size() < 2)
+        return false;
+
+    VkWriteDescriptorSet& prev = writes_[writes_.size() - 2];
+    const VkWriteDescriptorSet& next = writes_.back();
+
+    /* Descriptor infos must be consecutive in memory, which is the case when they are allocated one after another */
+    if (prev.dstSet == next.dstSet &&
+        prev.dstBinding == next.dstBinding &&
+        prev.descriptorType == next.descriptorType &&
+        prev.dstArrayElement + prev.descriptorCount == next.dstArrayElement &&
+        IsAdjacentInfo(prev.pImageInfo, prev.descriptorCount, next.pImageInfo) &&
+        IsAdjacentInfo(prev.pBufferInfo, prev.descriptorCount, next.pBufferInfo) &&
+        IsAdjacentInfo(prev.pTexelBufferView, prev.descriptorCount, next.pTexelBufferView))
+    {
+        prev.descriptorCount += next.descriptorCount;
+        writes_.pop_back();
+        return true;
+    }
+
+    return false;
+}
+
+std::uint32_t VKDescriptorSetWriter::GetNumDescriptors() const
+{
+    std::uint32_t numDescriptors = 0;
+    for (const VkWriteDescriptorSet& write : writes_)
+        numDescriptors += write.descriptorCount;
+    return numDescriptors;
+}
+
 void VKDescriptorSetWriter::UpdateDescriptorSets(VkDevice device)
 {
     if (!writes_.empty() || !copies_.empty())
@@ -46,6 +46,12 @@ class VKDescriptorSetWriter
         VkWriteDescriptorSet* NextWriteDescriptor();
         VkCopyDescriptorSet* NextCopyDescriptor();
 
+        // Merges the last write descriptor into the previous one if both refer to adjacent array elements of the same binding.
+        bool CoalesceLastWrite();
+
+        // Returns the number of descriptors across all write descriptors.
+        std::uint32_t GetNumDescriptors() const;
+
         // Returns the number of written descritpors.
         inline std::uint32_t GetNumWrites() const
         {
@@ -7,33 +7,102 @@
 
 #include "VKFence.h"
 #include "../VKCore.h"
+#include "../Ext/VKExtensions.h"
 
 
 namespace LLGL
 {
 
 
-VKFence::VKFence(VkDevice device) :
-    fence_ { device, vkDestroyFence }
+void VKCreateTimelineSemaphore(VkDevice device, VKPtr<VkSemaphore>& outSemaphore, std::uint64_t initialValue)
 {
-    VkFenceCreateInfo createInfo;
+    #if VK_KHR_timeline_semaphore
+
+    VkSemaphoreTypeCreateInfoKHR typeCreateInfo;
+    {
+        typeCreateInfo.sType            = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+        typeCreateInfo.pNext            = nullptr;
+        typeCreateInfo.semaphoreType    = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+        typeCreateInfo.initialValue     = initialValue;
+    }
+    VkSemaphoreCreateInfo createInfo;
     {
-        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-        createInfo.pNext = nullptr;
-        createInfo.flags = 0;
+        createInfo.sType                = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        createInfo.pNext                = &typeCreateInfo;
+        createInfo.flags                = 0;
+    }
+    outSemaphore = VKPtr<VkSemaphore>{ device, vkDestroySemaphore };
+    VkResult result = vkCreateSemaphore(device, &createInfo, VKGetAllocationCallbacks(), outSemaphore.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan timeline semaphore");
+
+    #else
+
+    VKThrowIfFailed(VK_ERROR_FEATURE_NOT_PRESENT, "failed to create Vulkan timeline semaphore: VK_KHR_timeline_semaphore not supported");
+
+    #endif
+}
+
+VkResult VKWaitTimelineSemaphore(VkDevice device, VkSemaphore semaphore, std::uint64_t value, std::uint64_t timeout)
+{
+    #if VK_KHR_timeline_semaphore
+
+    VkSemaphoreWaitInfoKHR waitInfo;
+    {
+        waitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+        waitInfo.pNext          = nullptr;
+        waitInfo.flags          = 0;
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores    = &semaphore;
+        waitInfo.pValues        = &value;
+    }
+    return vkWaitSemaphoresKHR(device, &waitInfo, timeout);
+
+    #else
+
+    return VK_ERROR_FEATURE_NOT_PRESENT;
+
+    #endif
+}
+
+VKFence::VKFence(VkDevice device, bool useTimelineSemaphore) :
+    fence_             { device, vkDestroyFence     },
+    timelineSemaphore_ { device, vkDestroySemaphore }
+{
+    if (useTimelineSemaphore)
+    {
+        /* Create timeline semaphore; its counter starts at zero, which is considered signaled before the first submission */
+        VKCreateTimelineSemaphore(device, timelineSemaphore_);
+    }
+    else
+    {
+        VkFenceCreateInfo createInfo;
+        {
+            createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            createInfo.pNext = nullptr;
+            createInfo.flags = 0;
+        }
+        VkResult result = vkCreateFence(device, &createInfo, VKGetAllocationCallbacks(), fence_.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan fence");
     }
-    VkResult result = vkCreateFence(device, &createInfo, nullptr, fence_.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan fence");
 }
 
 void VKFence::Reset(VkDevice device)
 {
-    vkResetFences(device, 1, fence_.GetAddressOf());
+    if (!IsTimelineFence())
+        vkResetFences(device, 1, fence_.GetAddressOf());
 }
 
 bool VKFence::Wait(VkDevice device, std::uint64_t timeout)
 {
-    return (vkWaitForFences(device, 1, fence_.GetAddressOf(), VK_TRUE, timeout) == VK_SUCCESS);
+    if (IsTimelineFence())
+        return (VKWaitTimelineSemaphore(device, timelineSemaphore_, timelineValue_, timeout) == VK_SUCCESS);
+    else
+        return (vkWaitForFences(device, 1, fence_.GetAddressOf(), VK_TRUE, timeout) == VK_SUCCESS);
+}
+
+std::uint64_t VKFence::NextTimelineValue()
+{
+    return ++timelineValue_;
 }
 
 
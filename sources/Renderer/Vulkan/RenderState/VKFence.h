@@ -19,25 +19,56 @@ namespace LLGL
 {
 
 
+// Helper function to create a Vulkan timeline semaphore with the specified initial value. Requires VK_KHR_timeline_semaphore.
+void VKCreateTimelineSemaphore(VkDevice device, VKPtr<VkSemaphore>& outSemaphore, std::uint64_t initialValue = 0);
+
+// Helper function to wait on the host until the specified timeline semaphore has reached the specified value.
+VkResult VKWaitTimelineSemaphore(VkDevice device, VkSemaphore semaphore, std::uint64_t value, std::uint64_t timeout);
+
+/*
+Fence implementation that is either backed by a timeline semaphore (VK_KHR_timeline_semaphore) or a binary VkFence.
+A timeline fence is signaled with a monotonically increasing value each time it is submitted,
+so it never has to be reset and can be signaled within the same queue submission as the command buffers.
+*/
 class VKFence final : public Fence
 {
 
     public:
 
-        VKFence(VkDevice device);
+        VKFence(VkDevice device, bool useTimelineSemaphore = false);
 
+        // Resets the binary fence. This has no effect for timeline fences.
         void Reset(VkDevice device);
+
+        // Waits until the fence has been signaled for its most recent submission.
         bool Wait(VkDevice device, std::uint64_t timeout);
 
-        // Returns the native VkFence handle.
+        // Increments the timeline value and returns it. This must be signaled in the next queue submission of a timeline fence.
+        std::uint64_t NextTimelineValue();
+
+        // Returns the native VkFence handle. This is VK_NULL_HANDLE for timeline fences.
         inline VkFence GetVkFence() const
         {
             return fence_;
         }
 
+        // Returns the native VkSemaphore handle of a timeline fence. This is VK_NULL_HANDLE for binary fences.
+        inline VkSemaphore GetVkSemaphore() const
+        {
+            return timelineSemaphore_;
+        }
+
+        // Returns true if this fence is backed by a timeline semaphore.
+        inline bool IsTimelineFence() const
+        {
+            return (timelineSemaphore_.Get() != VK_NULL_HANDLE);
+        }
+
     private:
 
-        VKPtr<VkFence> fence_;
+        VKPtr<VkFence>      fence_;
+        VKPtr<VkSemaphore>  timelineSemaphore_;
+        std::uint64_t       timelineValue_      = 0;
 
 };
 
@@ -0,0 +1,188 @@
+/*
+ * VKFramebufferCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKFramebufferCache.h"
+#include "../VKCore.h"
+#include <LLGL/RenderingDebuggerFlags.h>
+#include <algorithm>
+#include <tuple>
+
+
+namespace LLGL
+{
+
+
+bool VKFramebufferCache::Key::operator < (const Key& rhs) const
+{
+    return
+    (
+        std::tie(renderPass, flags, width, height, layers, attachments) <
+        std::tie(rhs.renderPass, rhs.flags, rhs.width, rhs.height, rhs.layers, rhs.attachments)
+    );
+}
+
+VKFramebufferCache& VKFramebufferCache::Get()
+{
+    static VKFramebufferCache instance;
+    return instance;
+}
+
+void VKFramebufferCache::Clear()
+{
+    handles_.clear();
+    keys_.clear();
+    entries_.clear();
+    numUnused_ = 0;
+}
+
+VkFramebuffer VKFramebufferCache::AcquireFramebuffer(VkDevice device, const VkFramebufferCreateInfo& createInfo)
+{
+    /* Find existing framebuffer with the same render pass, attachments, and extent */
+    keyCache_.renderPass    = createInfo.renderPass;
+    keyCache_.flags         = createInfo.flags;
+    keyCache_.width         = createInfo.width;
+    keyCache_.height        = createInfo.height;
+    keyCache_.layers        = createInfo.layers;
+    keyCache_.attachments.assign(createInfo.pAttachments, createInfo.pAttachments + createInfo.attachmentCount);
+
+    auto keyIt = keys_.find(keyCache_);
+    if (keyIt != keys_.end())
+    {
+        Entry& entry = *(keyIt->second);
+        if (entry.refCount == 0)
+            --numUnused_;
+        ++(entry.refCount);
+        ++numReuses_;
+        return entry.framebuffer.Get();
+    }
+
+    /* Create new framebuffer */
+    VKPtr<VkFramebuffer> framebuffer{ device, vkDestroyFramebuffer };
+    VkResult result = vkCreateFramebuffer(device, &createInfo, VKGetAllocationCallbacks(), framebuffer.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan framebuffer");
+    ++numCreations_;
+
+    entries_.emplace_back();
+    auto entryIt = std::prev(entries_.end());
+    {
+        entryIt->key            = keyCache_;
+        entryIt->framebuffer    = std::move(framebuffer);
+        entryIt->refCount       = 1;
+    }
+    keys_[keyCache_] = entryIt;
+    handles_[entryIt->framebuffer.Get()] = entryIt;
+
+    return entryIt->framebuffer.Get();
+}
+
+void VKFramebufferCache::ReleaseFramebuffer(VkFramebuffer framebuffer)
+{
+    auto handleIt = handles_.find(framebuffer);
+    if (handleIt == handles_.end())
+        return;
+
+    EntryList::iterator entryIt = handleIt->second;
+    if (entryIt->refCount > 0 && --(entryIt->refCount) == 0)
+    {
+        if (entryIt->invalidated)
+        {
+            /* Destroy invalidated framebuffer immediately, since it can never be reused */
+            DestroyEntry(entryIt);
+        }
+        else
+        {
+            /* Move framebuffer to the end of the LRU order and evict old ones if the limit is exceeded */
+            entries_.splice(entries_.end(), entries_, entryIt);
+            ++numUnused_;
+            EvictUnusedFramebuffers();
+        }
+    }
+}
+
+void VKFramebufferCache::InvalidateImageView(VkImageView imageView)
+{
+    for (auto entryIt = entries_.begin(); entryIt != entries_.end();)
+    {
+        auto nextIt = std::next(entryIt);
+
+        if (!entryIt->invalidated)
+        {
+            const std::vector<VkImageView>& attachments = entryIt->key.attachments;
+            if (std::find(attachments.begin(), attachments.end(), imageView) != attachments.end())
+            {
+                if (entryIt->refCount == 0)
+                {
+                    /* Destroy unreferenced framebuffer right away */
+                    --numUnused_;
+                    DestroyEntry(entryIt);
+                }
+                else
+                {
+                    /* Remove key of referenced framebuffer so it's destroyed when it's released */
+                    keys_.erase(entryIt->key);
+                    entryIt->invalidated = true;
+                }
+            }
+        }
+
+        entryIt = nextIt;
+    }
+}
+
+void VKFramebufferCache::SetMaxCachedFramebuffers(std::uint32_t maxCachedFramebuffers)
+{
+    maxCachedFramebuffers_ = maxCachedFramebuffers;
+    EvictUnusedFramebuffers();
+}
+
+void VKFramebufferCache::FlushProfile(ProfileRenderPassCacheRecord& outProfile)
+{
+    outProfile.framebufferCreations = numCreations_;
+    outProfile.framebufferReuses    = numReuses_;
+    outProfile.framebufferEvictions = numEvictions_;
+    outProfile.numFramebuffers      = static_cast<std::uint32_t>(entries_.size());
+
+    numCreations_   = 0;
+    numReuses_      = 0;
+    numEvictions_   = 0;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKFramebufferCache::DestroyEntry(EntryList::iterator entryIt)
+{
+    if (!entryIt->invalidated)
+        keys_.erase(entryIt->key);
+    handles_.erase(entryIt->framebuffer.Get());
+    entries_.erase(entryIt);
+}
+
+void VKFramebufferCache::EvictUnusedFramebuffers()
+{
+    /* Unreferenced framebuffers are in LRU order, so the first unreferenced entry is the least recently used one */
+    for (auto entryIt = entries_.begin(); numUnused_ > maxCachedFramebuffers_ && entryIt != entries_.end();)
+    {
+        auto nextIt = std::next(entryIt);
+        if (entryIt->refCount == 0)
+        {
+            DestroyEntry(entryIt);
+            --numUnused_;
+            ++numEvictions_;
+        }
+        entryIt = nextIt;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,122 @@
+/*
+ * VKFramebufferCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_FRAMEBUFFER_CACHE_H
+#define LLGL_VK_FRAMEBUFFER_CACHE_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <cstdint>
+#include <vector>
+#include <list>
+#include <map>
+#include <unordered_map>
+
+
+namespace LLGL
+{
+
+
+struct ProfileRenderPassCacheRecord;
+
+/*
+Device-wide cache of native Vulkan framebuffers, keyed by render pass, attachment image views, and extent.
+Framebuffers that are no longer referenced are kept alive in least-recently-used (LRU) order,
+so render targets that are recreated with the same attachments can reuse them.
+All framebuffers that refer to an image view must be invalidated before that image view is destroyed.
+*/
+class VKFramebufferCache
+{
+
+    public:
+
+        VKFramebufferCache(const VKFramebufferCache&) = delete;
+        VKFramebufferCache& operator = (const VKFramebufferCache&) = delete;
+
+        static VKFramebufferCache& Get();
+
+        // Clear all resource containers of this cache (used by VKRenderSystem).
+        void Clear();
+
+        // Returns a framebuffer for the specified create info and increments its reference counter. A new framebuffer is only created if no equal one is cached.
+        VkFramebuffer AcquireFramebuffer(VkDevice device, const VkFramebufferCreateInfo& createInfo);
+
+        // Decrements the reference counter of the specified framebuffer. Unreferenced framebuffers are kept alive until they are evicted.
+        void ReleaseFramebuffer(VkFramebuffer framebuffer);
+
+        // Destroys all unreferenced framebuffers that use the specified image view and prevents referenced ones from being reused.
+        void InvalidateImageView(VkImageView imageView);
+
+        // Sets the maximum number of unreferenced framebuffers that are kept alive. Excess framebuffers are evicted immediately.
+        void SetMaxCachedFramebuffers(std::uint32_t maxCachedFramebuffers);
+
+        // Writes the framebuffer statistics into the output profile record and resets the counters.
+        void FlushProfile(ProfileRenderPassCacheRecord& outProfile);
+
+    private:
+
+        VKFramebufferCache() = default;
+
+    private:
+
+        struct Key
+        {
+            VkRenderPass                renderPass  = VK_NULL_HANDLE;
+            VkFramebufferCreateFlags    flags       = 0;
+            std::uint32_t               width       = 0;
+            std::uint32_t               height      = 0;
+            std::uint32_t               layers      = 0;
+            std::vector<VkImageView>    attachments;
+
+            bool operator < (const Key& rhs) const;
+        };
+
+        struct Entry
+        {
+            Key                     key;
+            VKPtr<VkFramebuffer>    framebuffer;
+            std::uint32_t           refCount    = 0;
+            bool                    invalidated = false; // Invalidated entries are no longer in the key map
+        };
+
+        using EntryList = std::list<Entry>;
+        using EntryMap  = std::map<Key, EntryList::iterator>;
+
+    private:
+
+        // Destroys the specified entry and removes it from all containers.
+        void DestroyEntry(EntryList::iterator entryIt);
+
+        // Evicts the least recently used unreferenced framebuffers until the limit is no longer exceeded.
+        void EvictUnusedFramebuffers();
+
+    private:
+
+        EntryList                                               entries_;       // Ordered from least recently to most recently released
+        EntryMap                                                keys_;          // Only contains valid entries
+        std::unordered_map<VkFramebuffer, EntryList::iterator>  handles_;
+        Key                                                     keyCache_;
+
+        std::uint32_t                                           numUnused_              = 0;
+        std::uint32_t                                           maxCachedFramebuffers_  = 64;
+
+        std::uint32_t                                           numCreations_           = 0;
+        std::uint32_t                                           numReuses_              = 0;
+        std::uint32_t                                           numEvictions_           = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -9,6 +9,7 @@
 #include "VKPipelineLayout.h"
 #include "VKRenderPass.h"
 #include "VKPipelineCache.h"
+#include "VKPipelineLibraryCache.h"
 #include "../Ext/VKExtensionRegistry.h"
 #include "../Shader/VKShader.h"
 #include "../VKTypes.h"
@@ -16,6 +17,8 @@
 #include "../../CheckedCast.h"
 #include "../../PipelineStateUtils.h"
 #include <cstddef>
+#include <chrono>
+#include <string.h>
 #include <LLGL/PipelineStateFlags.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Utils/TypeNames.h>
@@ -33,11 +36,15 @@ VKGraphicsPSO::VKGraphicsPSO(
     const RenderPass*                   defaultRenderPass,
     const GraphicsPipelineDescriptor&   desc,
     const VKGraphicsPipelineLimits&     limits,
+    const VKGraphicsPipelineOptions&    options,
     PipelineCache*                      pipelineCache)
 :
-    VKPipelineState    { device, VK_PIPELINE_BIND_POINT_GRAPHICS, GetShadersAsArray(desc), desc.pipelineLayout },
-    scissorEnabled_    { desc.rasterizer.scissorTestEnabled                                                    },
-    hasDynamicScissor_ { desc.scissors.empty()                                                                 }
+    VKPipelineState          { device, VK_PIPELINE_BIND_POINT_GRAPHICS, GetShadersAsArray(desc), desc.pipelineLayout },
+    scissorEnabled_          { desc.rasterizer.scissorTestEnabled                                                    },
+    hasDynamicScissor_       { desc.scissors.empty()                                                                 },
+    dynamicState_            { options.dynamicState                                                                  },
+    dynamicState2_           { options.dynamicState && options.dynamicState2                                         },
+    stencilReferenceDynamic_ { desc.stencil.referenceDynamic                                                         }
 {
     /* Get render pass from descriptor or default render pass */
     const RenderPass* renderPass = (desc.renderPass != nullptr ? desc.renderPass : defaultRenderPass);
@@ -46,9 +53,68 @@ VKGraphicsPSO::VKGraphicsPSO(
     /* Create Vulkan graphics pipeline object */
     const VKRenderPass* renderPassVK = LLGL_CAST(const VKRenderPass*, renderPass);
     if (VKPipelineCache* pipelineCacheVK = (pipelineCache != nullptr ? LLGL_CAST(VKPipelineCache*, pipelineCache) : nullptr))
-        CreateVkPipeline(device, *renderPassVK, limits, desc, pipelineCacheVK->GetNative());
+        CreateVkPipeline(device, *renderPassVK, limits, options, desc, pipelineCacheVK->GetNative());
     else
-        CreateVkPipeline(device, *renderPassVK, limits, desc);
+        CreateVkPipeline(device, *renderPassVK, limits, options, desc);
+}
+
+VKGraphicsPSO::~VKGraphicsPSO()
+{
+    for (VkPipeline library : libraries_)
+        VKPipelineLibraryCache::Get().ReleaseLibrary(library);
+}
+
+static void SetDynamicStencilFaceState(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, const VkStencilOpState& state, bool setReference)
+{
+    #if VK_EXT_extended_dynamic_state
+    vkCmdSetStencilOpEXT(commandBuffer, faceMask, state.failOp, state.passOp, state.depthFailOp, state.compareOp);
+    #endif
+    vkCmdSetStencilCompareMask(commandBuffer, faceMask, state.compareMask);
+    vkCmdSetStencilWriteMask(commandBuffer, faceMask, state.writeMask);
+    if (setReference)
+        vkCmdSetStencilReference(commandBuffer, faceMask, state.reference);
+}
+
+void VKGraphicsPSO::SetDynamicFixedFunctionStates(VkCommandBuffer commandBuffer) const
+{
+    #if VK_EXT_extended_dynamic_state
+
+    /* Set states of VK_EXT_extended_dynamic_state */
+    vkCmdSetCullModeEXT(commandBuffer, rasterizerState_.cullMode);
+    vkCmdSetFrontFaceEXT(commandBuffer, rasterizerState_.frontFace);
+    vkCmdSetPrimitiveTopologyEXT(commandBuffer, inputAssemblyState_.topology);
+    vkCmdSetDepthTestEnableEXT(commandBuffer, depthStencilState_.depthTestEnable);
+    vkCmdSetDepthWriteEnableEXT(commandBuffer, depthStencilState_.depthWriteEnable);
+    vkCmdSetDepthCompareOpEXT(commandBuffer, depthStencilState_.depthCompareOp);
+    vkCmdSetStencilTestEnableEXT(commandBuffer, depthStencilState_.stencilTestEnable);
+
+    /* Set stencil states for both faces at once if they are equal; the reference is not overridden if the client sets it dynamically */
+    const bool setStencilReference = !stencilReferenceDynamic_;
+    if (::memcmp(&(depthStencilState_.front), &(depthStencilState_.back), sizeof(VkStencilOpState)) == 0)
+        SetDynamicStencilFaceState(commandBuffer, VK_STENCIL_FACE_FRONT_AND_BACK, depthStencilState_.front, setStencilReference);
+    else
+    {
+        SetDynamicStencilFaceState(commandBuffer, VK_STENCIL_FACE_FRONT_BIT, depthStencilState_.front, setStencilReference);
+        SetDynamicStencilFaceState(commandBuffer, VK_STENCIL_FACE_BACK_BIT, depthStencilState_.back, setStencilReference);
+    }
+
+    /* Set core dynamic states that are declared together with the extended states */
+    vkCmdSetDepthBias(commandBuffer, rasterizerState_.depthBiasConstantFactor, rasterizerState_.depthBiasClamp, rasterizerState_.depthBiasSlopeFactor);
+    vkCmdSetLineWidth(commandBuffer, rasterizerState_.lineWidth);
+
+    #endif // /VK_EXT_extended_dynamic_state
+
+    #if VK_EXT_extended_dynamic_state2
+
+    /* Set states of VK_EXT_extended_dynamic_state2 */
+    if (dynamicState2_)
+    {
+        vkCmdSetDepthBiasEnableEXT(commandBuffer, rasterizerState_.depthBiasEnable);
+        vkCmdSetPrimitiveRestartEnableEXT(commandBuffer, inputAssemblyState_.primitiveRestartEnable);
+        vkCmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerState_.rasterizerDiscardEnable);
+    }
+
+    #endif // /VK_EXT_extended_dynamic_state2
 }
 
 
@@ -274,6 +340,7 @@ static void CreateColorBlendState(
 
 static void CreateDynamicState(
     const GraphicsPipelineDescriptor&   desc,
+    const VKGraphicsPipelineOptions&    options,
     VkPipelineDynamicStateCreateInfo&   createInfo,
     std::vector<VkDynamicState>&        dynamicStatesVK)
 {
@@ -283,9 +350,47 @@ static void CreateDynamicState(
         dynamicStatesVK.push_back(VK_DYNAMIC_STATE_SCISSOR);
     if (desc.blend.blendFactorDynamic)
         dynamicStatesVK.push_back(VK_DYNAMIC_STATE_BLEND_CONSTANTS);
-    if (desc.stencil.referenceDynamic)
+    if (desc.stencil.referenceDynamic || options.dynamicState)
         dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_REFERENCE);
 
+    #if VK_EXT_extended_dynamic_state
+    if (options.dynamicState)
+    {
+        /* Declare fixed-function states as dynamic; they are set when the PSO is bound (see VKGraphicsPSO::SetDynamicFixedFunctionStates) */
+        dynamicStatesVK.insert(
+            dynamicStatesVK.end(),
+            {
+                VK_DYNAMIC_STATE_CULL_MODE_EXT,
+                VK_DYNAMIC_STATE_FRONT_FACE_EXT,
+                VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT,
+                VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT,
+                VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT,
+                VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT,
+                VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE_EXT,
+                VK_DYNAMIC_STATE_STENCIL_OP_EXT,
+                VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK,
+                VK_DYNAMIC_STATE_STENCIL_WRITE_MASK,
+                VK_DYNAMIC_STATE_DEPTH_BIAS,
+                VK_DYNAMIC_STATE_LINE_WIDTH,
+            }
+        );
+    }
+    #endif
+
+    #if VK_EXT_extended_dynamic_state2
+    if (options.dynamicState && options.dynamicState2)
+    {
+        dynamicStatesVK.insert(
+            dynamicStatesVK.end(),
+            {
+                VK_DYNAMIC_STATE_DEPTH_BIAS_ENABLE_EXT,
+                VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE_EXT,
+                VK_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE_EXT,
+            }
+        );
+    }
+    #endif
+
     createInfo.sType                = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
     createInfo.pNext                = nullptr;
     createInfo.flags                = 0;
@@ -297,6 +402,7 @@ bool VKGraphicsPSO::CreateVkPipeline(
     VkDevice                            device,
     const VKRenderPass&                 renderPass,
     const VKGraphicsPipelineLimits&     limits,
+    const VKGraphicsPipelineOptions&    options,
     const GraphicsPipelineDescriptor&   desc,
     VkPipelineCache                     pipelineCache)
 {
@@ -382,7 +488,16 @@ bool VKGraphicsPSO::CreateVkPipeline(
     /* Initialize dynamic state */
     std::vector<VkDynamicState> dynamicStatesVK;
     VkPipelineDynamicStateCreateInfo dynamicState;
-    CreateDynamicState(desc, dynamicState, dynamicStatesVK);
+    CreateDynamicState(desc, options, dynamicState, dynamicStatesVK);
+
+    /* Store fixed-function states that are set when this PSO is bound */
+    if (dynamicState_)
+    {
+        inputAssemblyState_         = inputAssembly;
+        rasterizerState_            = rasterizerState;
+        rasterizerState_.pNext      = nullptr;
+        depthStencilState_          = depthStencilState;
+    }
 
     /* Create graphics pipeline state object */
     VkGraphicsPipelineCreateInfo createInfo;
@@ -407,12 +522,427 @@ bool VKGraphicsPSO::CreateVkPipeline(
         createInfo.basePipelineHandle   = VK_NULL_HANDLE;
         createInfo.basePipelineIndex    = 0;
     }
-    VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &createInfo, nullptr, ReleaseAndGetAddressOfVkPipeline());
-    VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline");
+
+    const auto creationStartTime = std::chrono::steady_clock::now();
+
+    #if VK_EXT_graphics_pipeline_library
+    if (options.pipelineLibraries)
+        CreateVkPipelineFromLibraries(device, desc, createInfo, pipelineCache);
+    else
+    #endif
+    {
+        VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &createInfo, VKGetAllocationCallbacks(), ReleaseAndGetAddressOfVkPipeline());
+        VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline");
+    }
+
+    const auto creationTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - creationStartTime);
+    VKPipelineLibraryCache::Get().RecordPipelineCreation(options.pipelineLibraries, static_cast<std::uint32_t>(creationTime.count()));
 
     return true;
 }
 
+#if VK_EXT_graphics_pipeline_library
+
+using VKPipelineLibraryKey = VKPipelineLibraryCache::Key;
+
+static void AppendFloat(VKPipelineLibraryKey& key, float value)
+{
+    std::uint32_t bits = 0;
+    ::memcpy(&bits, &value, sizeof(bits));
+    key.push_back(bits);
+}
+
+static void AppendUInt64(VKPipelineLibraryKey& key, std::uint64_t value)
+{
+    key.push_back(static_cast<std::uint32_t>(value & 0xFFFFFFFFu));
+    key.push_back(static_cast<std::uint32_t>(value >> 32));
+}
+
+// Appends a non-dispatchable Vulkan handle, which is either a pointer or a 64-bit integer depending on the platform.
+template <typename THandle>
+static void AppendHandle(VKPipelineLibraryKey& key, THandle handle)
+{
+    std::uint64_t value = 0;
+    ::memcpy(&value, &handle, sizeof(handle));
+    AppendUInt64(key, value);
+}
+
+// Appends the unique ID of the specified shader, since shader module handles can be reused after a shader has been released.
+static void AppendShader(VKPipelineLibraryKey& key, const Shader* shader)
+{
+    if (shader != nullptr)
+    {
+        const VKShader* shaderVK = LLGL_CAST(const VKShader*, shader);
+        key.push_back(static_cast<std::uint32_t>(shaderVK->GetType()));
+        AppendUInt64(key, shaderVK->GetUniqueID());
+    }
+    else
+        key.push_back(~0u);
+}
+
+static bool IsDynamicState(const VkPipelineDynamicStateCreateInfo* createInfo, VkDynamicState state)
+{
+    if (createInfo != nullptr)
+    {
+        for_range(i, createInfo->dynamicStateCount)
+        {
+            if (createInfo->pDynamicStates[i] == state)
+                return true;
+        }
+    }
+    return false;
+}
+
+// Returns the topology class, since only the class must match the pipeline topology if the topology is dynamic.
+static VkPrimitiveTopology GetPrimitiveTopologyClass(VkPrimitiveTopology topology)
+{
+    switch (topology)
+    {
+        case VK_PRIMITIVE_TOPOLOGY_POINT_LIST:
+            return VK_PRIMITIVE_TOPOLOGY_POINT_LIST;
+        case VK_PRIMITIVE_TOPOLOGY_LINE_LIST:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_LIST_WITH_ADJACENCY:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP_WITH_ADJACENCY:
+            return VK_PRIMITIVE_TOPOLOGY_LINE_LIST;
+        case VK_PRIMITIVE_TOPOLOGY_PATCH_LIST:
+            return VK_PRIMITIVE_TOPOLOGY_PATCH_LIST;
+        default:
+            return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    }
+}
+
+static void AppendDynamicStates(VKPipelineLibraryKey& key, const VkPipelineDynamicStateCreateInfo* createInfo)
+{
+    if (createInfo != nullptr)
+    {
+        key.push_back(createInfo->dynamicStateCount);
+        for_range(i, createInfo->dynamicStateCount)
+            key.push_back(static_cast<std::uint32_t>(createInfo->pDynamicStates[i]));
+    }
+    else
+        key.push_back(0);
+}
+
+static void AppendMultisampleState(VKPipelineLibraryKey& key, const VkPipelineMultisampleStateCreateInfo& createInfo)
+{
+    key.push_back(static_cast<std::uint32_t>(createInfo.rasterizationSamples));
+    key.push_back(createInfo.pSampleMask != nullptr ? createInfo.pSampleMask[0] : ~0u);
+    key.push_back(createInfo.alphaToCoverageEnable);
+}
+
+static void AppendStencilOpState(VKPipelineLibraryKey& key, const VkStencilOpState& state)
+{
+    key.push_back(static_cast<std::uint32_t>(state.failOp));
+    key.push_back(static_cast<std::uint32_t>(state.passOp));
+    key.push_back(static_cast<std::uint32_t>(state.depthFailOp));
+    key.push_back(static_cast<std::uint32_t>(state.compareOp));
+    key.push_back(state.compareMask);
+    key.push_back(state.writeMask);
+    key.push_back(state.reference);
+}
+
+static void BuildVertexInputLibraryKey(VKPipelineLibraryKey& key, const VkGraphicsPipelineCreateInfo& createInfo)
+{
+    key.clear();
+    key.push_back(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT);
+    AppendDynamicStates(key, createInfo.pDynamicState);
+
+    /* Serialize input assembly; only the topology class matters if the topology is dynamic */
+    const VkPipelineInputAssemblyStateCreateInfo& inputAssembly = *(createInfo.pInputAssemblyState);
+    if (IsDynamicState(createInfo.pDynamicState, VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT))
+        key.push_back(static_cast<std::uint32_t>(GetPrimitiveTopologyClass(inputAssembly.topology)));
+    else
+        key.push_back(static_cast<std::uint32_t>(inputAssembly.topology));
+
+    #if VK_EXT_extended_dynamic_state2
+    if (!IsDynamicState(createInfo.pDynamicState, VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE_EXT))
+    #endif
+        key.push_back(inputAssembly.primitiveRestartEnable);
+
+    /* Serialize vertex bindings and attributes */
+    const VkPipelineVertexInputStateCreateInfo& vertexInput = *(createInfo.pVertexInputState);
+    key.push_back(vertexInput.vertexBindingDescriptionCount);
+    for_range(i, vertexInput.vertexBindingDescriptionCount)
+    {
+        const VkVertexInputBindingDescription& binding = vertexInput.pVertexBindingDescriptions[i];
+        key.push_back(binding.binding);
+        key.push_back(binding.stride);
+        key.push_back(static_cast<std::uint32_t>(binding.inputRate));
+    }
+
+    key.push_back(vertexInput.vertexAttributeDescriptionCount);
+    for_range(i, vertexInput.vertexAttributeDescriptionCount)
+    {
+        const VkVertexInputAttributeDescription& attribute = vertexInput.pVertexAttributeDescriptions[i];
+        key.push_back(attribute.location);
+        key.push_back(attribute.binding);
+        key.push_back(static_cast<std::uint32_t>(attribute.format));
+        key.push_back(attribute.offset);
+    }
+}
+
+static void BuildPreRasterizationLibraryKey(
+    VKPipelineLibraryKey&               key,
+    const VkGraphicsPipelineCreateInfo& createInfo,
+    const GraphicsPipelineDescriptor&   desc)
+{
+    key.clear();
+    key.push_back(VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT);
+    AppendDynamicStates(key, createInfo.pDynamicState);
+    AppendHandle(key, createInfo.layout);
+    AppendHandle(key, createInfo.renderPass);
+
+    /* Serialize shaders by their unique IDs; the layout determines the shader module permutations */
+    AppendShader(key, desc.vertexShader);
+    AppendShader(key, desc.tessControlShader);
+    AppendShader(key, desc.tessEvaluationShader);
+    AppendShader(key, desc.geometryShader);
+
+    if (createInfo.pTessellationState != nullptr)
+        key.push_back(createInfo.pTessellationState->patchControlPoints);
+
+    /* Serialize static viewports and scissors */
+    const VkPipelineViewportStateCreateInfo& viewportState = *(createInfo.pViewportState);
+    key.push_back(viewportState.viewportCount);
+    if (viewportState.pViewports != nullptr)
+    {
+        for_range(i, viewportState.viewportCount)
+        {
+            const VkViewport& viewport = viewportState.pViewports[i];
+            AppendFloat(key, viewport.x);
+            AppendFloat(key, viewport.y);
+            AppendFloat(key, viewport.width);
+            AppendFloat(key, viewport.height);
+            AppendFloat(key, viewport.minDepth);
+            AppendFloat(key, viewport.maxDepth);
+        }
+    }
+
+    key.push_back(viewportState.scissorCount);
+    if (viewportState.pScissors != nullptr)
+    {
+        for_range(i, viewportState.scissorCount)
+        {
+            const VkRect2D& scissor = viewportState.pScissors[i];
+            key.push_back(static_cast<std::uint32_t>(scissor.offset.x));
+            key.push_back(static_cast<std::uint32_t>(scissor.offset.y));
+            key.push_back(scissor.extent.width);
+            key.push_back(scissor.extent.height);
+        }
+    }
+
+    /* Serialize rasterizer state without the states that are dynamic */
+    const VkPipelineRasterizationStateCreateInfo& rasterizer = *(createInfo.pRasterizationState);
+    key.push_back(rasterizer.depthClampEnable);
+    key.push_back(static_cast<std::uint32_t>(rasterizer.polygonMode));
+    key.push_back(rasterizer.pNext != nullptr ? 1u : 0u); // Conservative rasterization
+
+    if (!IsDynamicState(createInfo.pDynamicState, VK_DYNAMIC_STATE_CULL_MODE_EXT))
+    {
+        key.push_back(rasterizer.cullMode);
+        key.push_back(static_cast<std::uint32_t>(rasterizer.frontFace));
+    }
+
+    if (!IsDynamicState(createInfo.pDynamicState, VK_DYNAMIC_STATE_DEPTH_BIAS))
+    {
+        AppendFloat(key, rasterizer.depthBiasConstantFactor);
+        AppendFloat(key, rasterizer.depthBiasClamp);
+        AppendFloat(key, rasterizer.depthBiasSlopeFactor);
+    }
+
+    if (!IsDynamicState(createInfo.pDynamicState, VK_DYNAMIC_STATE_LINE_WIDTH))
+        AppendFloat(key, rasterizer.lineWidth);
+
+    #if VK_EXT_extended_dynamic_state2
+    if (!IsDynamicState(createInfo.pDynamicState, VK_DYNAMIC_STATE_DEPTH_BIAS_ENABLE_EXT))
+    #endif
+    {
+        key.push_back(rasterizer.depthBiasEnable);
+        key.push_back(rasterizer.rasterizerDiscardEnable);
+    }
+}
+
+static void BuildFragmentShaderLibraryKey(
+    VKPipelineLibraryKey&               key,
+    const VkGraphicsPipelineCreateInfo& createInfo,
+    const GraphicsPipelineDescriptor&   desc)
+{
+    key.clear();
+    key.push_back(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT);
+    AppendDynamicStates(key, createInfo.pDynamicState);
+    AppendHandle(key, createInfo.layout);
+    AppendHandle(key, createInfo.renderPass);
+    AppendShader(key, desc.fragmentShader);
+    AppendMultisampleState(key, *(createInfo.pMultisampleState));
+
+    /* Serialize depth-stencil state unless it is entirely dynamic */
+    if (!IsDynamicState(createInfo.pDynamicState, VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT))
+    {
+        const VkPipelineDepthStencilStateCreateInfo& depthStencil = *(createInfo.pDepthStencilState);
+        key.push_back(depthStencil.depthTestEnable);
+        key.push_back(depthStencil.depthWriteEnable);
+        key.push_back(static_cast<std::uint32_t>(depthStencil.depthCompareOp));
+        key.push_back(depthStencil.stencilTestEnable);
+        AppendStencilOpState(key, depthStencil.front);
+        AppendStencilOpState(key, depthStencil.back);
+    }
+}
+
+static void BuildFragmentOutputLibraryKey(VKPipelineLibraryKey& key, const VkGraphicsPipelineCreateInfo& createInfo)
+{
+    key.clear();
+    key.push_back(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT);
+    AppendDynamicStates(key, createInfo.pDynamicState);
+    AppendHandle(key, createInfo.renderPass);
+    AppendMultisampleState(key, *(createInfo.pMultisampleState));
+
+    /* Serialize color blend state */
+    const VkPipelineColorBlendStateCreateInfo& colorBlend = *(createInfo.pColorBlendState);
+    key.push_back(colorBlend.logicOpEnable);
+    key.push_back(static_cast<std::uint32_t>(colorBlend.logicOp));
+    key.push_back(colorBlend.attachmentCount);
+    for_range(i, colorBlend.attachmentCount)
+    {
+        const VkPipelineColorBlendAttachmentState& attachment = colorBlend.pAttachments[i];
+        key.push_back(attachment.blendEnable);
+        key.push_back(static_cast<std::uint32_t>(attachment.srcColorBlendFactor));
+        key.push_back(static_cast<std::uint32_t>(attachment.dstColorBlendFactor));
+        key.push_back(static_cast<std::uint32_t>(attachment.colorBlendOp));
+        key.push_back(static_cast<std::uint32_t>(attachment.srcAlphaBlendFactor));
+        key.push_back(static_cast<std::uint32_t>(attachment.dstAlphaBlendFactor));
+        key.push_back(static_cast<std::uint32_t>(attachment.alphaBlendOp));
+        key.push_back(attachment.colorWriteMask);
+    }
+
+    if (!IsDynamicState(createInfo.pDynamicState, VK_DYNAMIC_STATE_BLEND_CONSTANTS))
+    {
+        for (float blendConstant : colorBlend.blendConstants)
+            AppendFloat(key, blendConstant);
+    }
+}
+
+static void InitializeLibraryCreateInfo(
+    VkGraphicsPipelineCreateInfo&           createInfo,
+    VkGraphicsPipelineLibraryCreateInfoEXT& libraryCreateInfo,
+    VkGraphicsPipelineLibraryFlagsEXT       libraryFlags,
+    const VkGraphicsPipelineCreateInfo&     pipelineCreateInfo)
+{
+    libraryCreateInfo.sType     = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+    libraryCreateInfo.pNext     = nullptr;
+    libraryCreateInfo.flags     = libraryFlags;
+
+    /* Only copy the dynamic states here; each library type copies its own subset of states from the complete create info */
+    createInfo                  = {};
+    createInfo.sType            = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    createInfo.pNext            = &libraryCreateInfo;
+    createInfo.flags            = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR;
+    createInfo.pDynamicState    = pipelineCreateInfo.pDynamicState;
+}
+
+void VKGraphicsPSO::CreateVkPipelineFromLibraries(
+    VkDevice                            device,
+    const GraphicsPipelineDescriptor&   desc,
+    const VkGraphicsPipelineCreateInfo& pipelineCreateInfo,
+    VkPipelineCache                     pipelineCache)
+{
+    VKPipelineLibraryCache& libraryCache = VKPipelineLibraryCache::Get();
+    VKPipelineLibraryKey key;
+
+    VkGraphicsPipelineCreateInfo createInfo;
+    VkGraphicsPipelineLibraryCreateInfoEXT libraryCreateInfo;
+
+    /* Split shader stages into pre-rasterization stages and fragment stage */
+    SmallVector<VkPipelineShaderStageCreateInfo, 4> preRasterizationStages;
+    SmallVector<VkPipelineShaderStageCreateInfo, 1> fragmentStages;
+    for_range(i, pipelineCreateInfo.stageCount)
+    {
+        const VkPipelineShaderStageCreateInfo& stage = pipelineCreateInfo.pStages[i];
+        if (stage.stage == VK_SHADER_STAGE_FRAGMENT_BIT)
+            fragmentStages.push_back(stage);
+        else
+            preRasterizationStages.push_back(stage);
+    }
+
+    /* Acquire vertex input interface library */
+    InitializeLibraryCreateInfo(createInfo, libraryCreateInfo, VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT, pipelineCreateInfo);
+    {
+        createInfo.pVertexInputState    = pipelineCreateInfo.pVertexInputState;
+        createInfo.pInputAssemblyState  = pipelineCreateInfo.pInputAssemblyState;
+    }
+    BuildVertexInputLibraryKey(key, pipelineCreateInfo);
+    libraries_[0] = libraryCache.AcquireLibrary(device, key, createInfo, pipelineCache);
+
+    /* Acquire pre-rasterization shaders library */
+    InitializeLibraryCreateInfo(createInfo, libraryCreateInfo, VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT, pipelineCreateInfo);
+    {
+        createInfo.stageCount           = static_cast<std::uint32_t>(preRasterizationStages.size());
+        createInfo.pStages              = preRasterizationStages.data();
+        createInfo.pTessellationState   = pipelineCreateInfo.pTessellationState;
+        createInfo.pViewportState       = pipelineCreateInfo.pViewportState;
+        createInfo.pRasterizationState  = pipelineCreateInfo.pRasterizationState;
+        createInfo.layout               = pipelineCreateInfo.layout;
+        createInfo.renderPass           = pipelineCreateInfo.renderPass;
+        createInfo.subpass              = pipelineCreateInfo.subpass;
+    }
+    BuildPreRasterizationLibraryKey(key, pipelineCreateInfo, desc);
+    libraries_[1] = libraryCache.AcquireLibrary(device, key, createInfo, pipelineCache);
+
+    /* Acquire fragment shader library; this library is also required without a fragment shader */
+    InitializeLibraryCreateInfo(createInfo, libraryCreateInfo, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT, pipelineCreateInfo);
+    {
+        createInfo.stageCount           = static_cast<std::uint32_t>(fragmentStages.size());
+        createInfo.pStages              = fragmentStages.data();
+        createInfo.pMultisampleState    = pipelineCreateInfo.pMultisampleState;
+        createInfo.pDepthStencilState   = pipelineCreateInfo.pDepthStencilState;
+        createInfo.layout               = pipelineCreateInfo.layout;
+        createInfo.renderPass           = pipelineCreateInfo.renderPass;
+        createInfo.subpass              = pipelineCreateInfo.subpass;
+    }
+    BuildFragmentShaderLibraryKey(key, pipelineCreateInfo, desc);
+    libraries_[2] = libraryCache.AcquireLibrary(device, key, createInfo, pipelineCache);
+
+    /* Acquire fragment output interface library */
+    InitializeLibraryCreateInfo(createInfo, libraryCreateInfo, VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT, pipelineCreateInfo);
+    {
+        createInfo.pMultisampleState    = pipelineCreateInfo.pMultisampleState;
+        createInfo.pColorBlendState     = pipelineCreateInfo.pColorBlendState;
+        createInfo.renderPass           = pipelineCreateInfo.renderPass;
+        createInfo.subpass              = pipelineCreateInfo.subpass;
+    }
+    BuildFragmentOutputLibraryKey(key, pipelineCreateInfo);
+    libraries_[3] = libraryCache.AcquireLibrary(device, key, createInfo, pipelineCache);
+
+    /* Link final pipeline without link-time optimization, so linking remains fast */
+    VkPipelineLibraryCreateInfoKHR linkCreateInfo;
+    {
+        linkCreateInfo.sType        = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+        linkCreateInfo.pNext        = nullptr;
+        linkCreateInfo.libraryCount = maxNumLibraries;
+        linkCreateInfo.pLibraries   = libraries_;
+    }
+    createInfo          = {};
+    createInfo.sType    = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    createInfo.pNext    = &linkCreateInfo;
+    createInfo.layout   = pipelineCreateInfo.layout;
+
+    VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &createInfo, VKGetAllocationCallbacks(), ReleaseAndGetAddressOfVkPipeline());
+    VKThrowIfFailed(result, "failed to link Vulkan graphics pipeline from libraries");
+}
+
+#else // VK_EXT_graphics_pipeline_library
+
+void VKGraphicsPSO::CreateVkPipelineFromLibraries(
+    VkDevice                            /*device*/,
+    const GraphicsPipelineDescriptor&   /*desc*/,
+    const VkGraphicsPipelineCreateInfo& /*pipelineCreateInfo*/,
+    VkPipelineCache                     /*pipelineCache*/)
+{
+    // dummy
+}
+
+#endif // /VK_EXT_graphics_pipeline_library
+
 
 } // /namespace LLGL
 
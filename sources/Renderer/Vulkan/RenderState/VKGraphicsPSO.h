@@ -23,6 +23,14 @@ struct VKGraphicsPipelineLimits
     float lineWidthGranularity;
 };
 
+// Vulkan graphics pipeline creation options. These depend on the renderer configuration and the features of the physical device.
+struct VKGraphicsPipelineOptions
+{
+    bool dynamicState       = false; // Declare fixed-function states of VK_EXT_extended_dynamic_state as dynamic.
+    bool dynamicState2      = false; // Declare fixed-function states of VK_EXT_extended_dynamic_state2 as dynamic. Requires 'dynamicState'.
+    bool pipelineLibraries  = false; // Link graphics pipelines from libraries of VK_EXT_graphics_pipeline_library.
+};
+
 struct GraphicsPipelineDescriptor;
 class RenderPass;
 class VKRenderPass;
@@ -38,9 +46,12 @@ class VKGraphicsPSO final : public VKPipelineState
             const RenderPass*                   defaultRenderPass,
             const GraphicsPipelineDescriptor&   desc,
             const VKGraphicsPipelineLimits&     limits,
+            const VKGraphicsPipelineOptions&    options,
             PipelineCache*                      pipelineCache       = nullptr
         );
 
+        ~VKGraphicsPSO();
+
         // Returns true if scissors are enabled.
         inline bool IsScissorEnabled() const
         {
@@ -53,20 +64,51 @@ class VKGraphicsPSO final : public VKPipelineState
             return hasDynamicScissor_;
         }
 
+        // Returns true if this graphics pipeline has declared its fixed-function states as dynamic.
+        inline bool HasDynamicFixedFunctionStates() const
+        {
+            return dynamicState_;
+        }
+
+        // Sets all fixed-function states this graphics pipeline has declared as dynamic. Must be called after the pipeline has been bound.
+        void SetDynamicFixedFunctionStates(VkCommandBuffer commandBuffer) const;
+
     private:
 
         bool CreateVkPipeline(
             VkDevice                            device,
             const VKRenderPass&                 renderPass,
             const VKGraphicsPipelineLimits&     limits,
+            const VKGraphicsPipelineOptions&    options,
             const GraphicsPipelineDescriptor&   desc,
             VkPipelineCache                     pipelineCache   = VK_NULL_HANDLE
         );
 
+        // Links the native pipeline from shared pipeline libraries with the states of the specified complete pipeline create info.
+        void CreateVkPipelineFromLibraries(
+            VkDevice                            device,
+            const GraphicsPipelineDescriptor&   desc,
+            const VkGraphicsPipelineCreateInfo& pipelineCreateInfo,
+            VkPipelineCache                     pipelineCache
+        );
+
+    private:
+
+        static constexpr std::uint32_t maxNumLibraries = 4;
+
     private:
 
-        bool scissorEnabled_    = false;
-        bool hasDynamicScissor_ = false;
+        bool                                    scissorEnabled_             = false;
+        bool                                    hasDynamicScissor_          = false;
+
+        bool                                    dynamicState_               = false;
+        bool                                    dynamicState2_              = false;
+        bool                                    stencilReferenceDynamic_    = false;
+        VkPipelineInputAssemblyStateCreateInfo  inputAssemblyState_         = {};
+        VkPipelineRasterizationStateCreateInfo  rasterizerState_            = {};
+        VkPipelineDepthStencilStateCreateInfo   depthStencilState_          = {};
+
+        VkPipeline                              libraries_[maxNumLibraries] = {};
 
 };
 
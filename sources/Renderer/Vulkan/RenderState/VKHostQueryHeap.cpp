@@ -0,0 +1,193 @@
+/*
+ * VKHostQueryHeap.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKHostQueryHeap.h"
+#include "../Memory/VKDeviceMemoryManager.h"
+#include "../VKCore.h"
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Each native query result is stored as 64-bit value followed by its 64-bit availability.
+struct VKHostQueryResult
+{
+    std::uint64_t value;
+    std::uint64_t availability;
+};
+
+VKHostQueryHeap::VKHostQueryHeap(
+    VkDevice                    device,
+    VKDeviceMemoryManager&      deviceMemoryManager,
+    const QueryHeapDescriptor&  desc)
+:
+    VKQueryHeap   { device, desc, false, true },
+    resultBuffer_ { device                    },
+    memoryMngr_   { deviceMemoryManager       }
+{
+    /* Create result buffer in host visible memory, so results can be read without querying the pool */
+    VkBufferCreateInfo createInfo;
+    {
+        createInfo.sType                    = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        createInfo.pNext                    = nullptr;
+        createInfo.flags                    = 0;
+        createInfo.size                     = GetNumQueries() * sizeof(VKHostQueryResult);
+        createInfo.usage                    = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
+        createInfo.queueFamilyIndexCount    = 0;
+        createInfo.pQueueFamilyIndices      = nullptr;
+    }
+    resultBuffer_.CreateVkBufferAndMemoryRegion(
+        device,
+        createInfo,
+        memoryMngr_,
+        (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+    );
+}
+
+VKHostQueryHeap::~VKHostQueryHeap()
+{
+    resultBuffer_.ReleaseMemoryRegion(memoryMngr_);
+}
+
+bool VKHostQueryHeap::IsSupported(const QueryHeapDescriptor& desc)
+{
+    /* Only queries with a single result value per native query can be resolved with the availability layout of the result buffer */
+    if (desc.renderCondition)
+        return false;
+
+    switch (desc.type)
+    {
+        case QueryType::SamplesPassed:
+        case QueryType::AnySamplesPassed:
+        case QueryType::AnySamplesPassedConservative:
+        case QueryType::TimeElapsed:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void VKHostQueryHeap::ResetAll(VkCommandBuffer commandBuffer)
+{
+    vkCmdResetQueryPool(commandBuffer, GetVkQueryPool(), 0, GetNumQueries());
+    vkCmdFillBuffer(commandBuffer, resultBuffer_.GetVkBuffer(), 0, VK_WHOLE_SIZE, 0);
+}
+
+void VKHostQueryHeap::ResolveResults(VkCommandBuffer commandBuffer, std::uint32_t firstNativeQuery, std::uint32_t numNativeQueries)
+{
+    const VkDeviceSize offset   = firstNativeQuery * sizeof(VKHostQueryResult);
+    const VkDeviceSize size     = numNativeQueries * sizeof(VKHostQueryResult);
+
+    /*
+    Wait for the results on the GPU, since the queries are reset right after this copy and unavailable results would be lost otherwise.
+    This cannot stall indefinitely, because the range only covers queries that have been written in this command buffer.
+    */
+    vkCmdCopyQueryPoolResults(
+        commandBuffer,
+        GetVkQueryPool(),
+        firstNativeQuery,
+        numNativeQueries,
+        resultBuffer_.GetVkBuffer(),
+        offset,
+        sizeof(VKHostQueryResult),
+        (VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT)
+    );
+
+    /* Make results visible to the host and finish the copy before the queries are reset */
+    VkBufferMemoryBarrier barrier;
+    {
+        barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+        barrier.pNext               = nullptr;
+        barrier.srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask       = VK_ACCESS_HOST_READ_BIT;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.buffer              = resultBuffer_.GetVkBuffer();
+        barrier.offset              = offset;
+        barrier.size                = size;
+    }
+    vkCmdPipelineBarrier(
+        commandBuffer,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        (VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_HOST_BIT),
+        0, // VkDependencyFlags
+        0,
+        nullptr,
+        1,
+        &barrier,
+        0,
+        nullptr
+    );
+
+    /* Reset queries so they can be reused without another reset inside a render pass */
+    vkCmdResetQueryPool(commandBuffer, GetVkQueryPool(), firstNativeQuery, numNativeQueries);
+}
+
+VkResult VKHostQueryHeap::ReadResults(
+    VkDevice        device,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    void*           data,
+    std::size_t     dataSize)
+{
+    /* Determine stride of output values */
+    std::size_t stride = 0;
+    if (dataSize == numQueries * sizeof(std::uint64_t))
+        stride = sizeof(std::uint64_t);
+    else if (dataSize == numQueries * sizeof(std::uint32_t))
+        stride = sizeof(std::uint32_t);
+    else
+        return VK_ERROR_VALIDATION_FAILED_EXT;
+
+    const std::uint32_t groupSize           = GetGroupSize();
+    const std::uint32_t numNativeQueries    = numQueries * groupSize;
+
+    /* Map range of results into CPU memory space */
+    auto results = static_cast<const VKHostQueryResult*>(
+        resultBuffer_.Map(device, firstQuery * groupSize * sizeof(VKHostQueryResult), numNativeQueries * sizeof(VKHostQueryResult))
+    );
+    if (results == nullptr)
+        return VK_ERROR_MEMORY_MAP_FAILED;
+
+    VkResult result = VK_SUCCESS;
+    auto dst = static_cast<char*>(data);
+
+    for (std::uint32_t i = 0; i < numNativeQueries; i += groupSize)
+    {
+        /* Abort if any result of this query group is not yet available */
+        const VKHostQueryResult& first  = results[i];
+        const VKHostQueryResult& last   = results[i + groupSize - 1];
+        if (first.availability == 0 || last.availability == 0)
+        {
+            result = VK_NOT_READY;
+            break;
+        }
+
+        /* Time queries are stored as start and end timestamps */
+        const std::uint64_t value = (GetType() == QueryType::TimeElapsed ? last.value - first.value : first.value);
+        if (stride == sizeof(std::uint64_t))
+            *reinterpret_cast<std::uint64_t*>(dst) = value;
+        else
+            *reinterpret_cast<std::uint32_t*>(dst) = static_cast<std::uint32_t>(value);
+
+        dst += stride;
+    }
+
+    resultBuffer_.Unmap(device);
+
+    return result;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,73 @@
+/*
+ * VKHostQueryHeap.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_HOST_QUERY_HEAP_H
+#define LLGL_VK_HOST_QUERY_HEAP_H
+
+
+#include "VKQueryHeap.h"
+#include "../Buffer/VKDeviceBuffer.h"
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+
+
+namespace LLGL
+{
+
+
+class VKDeviceMemoryManager;
+
+/*
+Query heap whose results are copied into a host visible buffer with vkCmdCopyQueryPoolResults at the end of each command buffer.
+This allows CommandQueue::QueryResult to read all queries of a range from mapped memory instead of polling vkGetQueryPoolResults per query.
+*/
+class VKHostQueryHeap final : public VKQueryHeap
+{
+
+    public:
+
+        VKHostQueryHeap(
+            VkDevice                    device,
+            VKDeviceMemoryManager&      deviceMemoryManager,
+            const QueryHeapDescriptor&  desc
+        );
+        ~VKHostQueryHeap();
+
+        // Returns true if queries of the specified descriptor can be resolved into host visible memory.
+        static bool IsSupported(const QueryHeapDescriptor& desc);
+
+        // Resets all queries and clears the availability of their results. This must be called once before the heap is used.
+        void ResetAll(VkCommandBuffer commandBuffer);
+
+        // Copies the results of the specified range of native queries into the result buffer, then resets these queries for their next use.
+        void ResolveResults(VkCommandBuffer commandBuffer, std::uint32_t firstNativeQuery, std::uint32_t numNativeQueries);
+
+        // Reads the results of the specified range of queries from the result buffer. Returns VK_NOT_READY if any of the results is not yet available.
+        VkResult ReadResults(
+            VkDevice        device,
+            std::uint32_t   firstQuery,
+            std::uint32_t   numQueries,
+            void*           data,
+            std::size_t     dataSize
+        );
+
+    private:
+
+        VKDeviceBuffer          resultBuffer_;
+        VKDeviceMemoryManager&  memoryMngr_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
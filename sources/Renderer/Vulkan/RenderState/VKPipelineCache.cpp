@@ -26,7 +26,7 @@ VKPipelineCache::VKPipelineCache(VkDevice device, const Blob& initialBlob)
         createInfo.initialDataSize  = initialBlob.GetSize();
         createInfo.pInitialData     = initialBlob.GetData();
     }
-    vkCreatePipelineCache(device, &createInfo, nullptr, cache_.ReleaseAndGetAddressOf());
+    vkCreatePipelineCache(device, &createInfo, VKGetAllocationCallbacks(), cache_.ReleaseAndGetAddressOf());
 }
 
 Blob VKPipelineCache::GetBlob() const
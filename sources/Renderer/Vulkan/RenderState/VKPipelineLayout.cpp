@@ -11,6 +11,7 @@
 #include "../VKTypes.h"
 #include "../VKCore.h"
 #include "../VKStaticLimits.h"
+#include "../VKPhysicalDevice.h"
 #include "../Texture/VKSampler.h"
 #include "../Shader/VKShader.h"
 #include "../Shader/VKShaderModulePool.h"
@@ -28,7 +29,7 @@ namespace LLGL
 
 VKPtr<VkPipelineLayout> VKPipelineLayout::defaultPipelineLayout_;
 
-VKPipelineLayout::VKPipelineLayout(VkDevice device, const PipelineLayoutDescriptor& desc) :
+VKPipelineLayout::VKPipelineLayout(const VKPhysicalDevice& physicalDevice, VkDevice device, const PipelineLayoutDescriptor& desc) :
     pipelineLayout_             { device, vkDestroyPipelineLayout      },
     setLayoutHeapBindings_      { device                               },
     setLayoutDynamicBindings_   { device                               },
@@ -40,9 +41,9 @@ VKPipelineLayout::VKPipelineLayout(VkDevice device, const PipelineLayoutDescript
 {
     /* Create Vulkan descriptor set layouts */
     if (!desc.heapBindings.empty())
-        CreateDescriptorSetLayout(device, desc.heapBindings, bindingTable_.heapBindings, setLayoutHeapBindings_);
+        CreateDescriptorSetLayout(physicalDevice, device, desc.heapBindings, bindingTable_.heapBindings, setLayoutHeapBindings_);
     if (!desc.bindings.empty())
-        CreateDescriptorSetLayout(device, desc.bindings, bindingTable_.dynamicBindings, setLayoutDynamicBindings_);
+        CreateDescriptorSetLayout(physicalDevice, device, desc.bindings, bindingTable_.dynamicBindings, setLayoutDynamicBindings_);
     if (!desc.staticSamplers.empty())
         CreateImmutableSamplers(device, desc.staticSamplers);
 
@@ -301,7 +302,7 @@ void VKPipelineLayout::CreateDefault(VkDevice device)
         layoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
     }
     VKPipelineLayout::defaultPipelineLayout_ = VKPtr<VkPipelineLayout>{ device, vkDestroyPipelineLayout };
-    VkResult result = vkCreatePipelineLayout(device, &layoutCreateInfo, nullptr, VKPipelineLayout::defaultPipelineLayout_.ReleaseAndGetAddressOf());
+    VkResult result = vkCreatePipelineLayout(device, &layoutCreateInfo, VKGetAllocationCallbacks(), VKPipelineLayout::defaultPipelineLayout_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan default pipeline layout");
 }
 
@@ -382,12 +383,31 @@ static void ConvertBindingDesc(VkDescriptorSetLayoutBinding& dst, const BindingD
     dst.pImmutableSamplers  = nullptr;
 }
 
+/*
+Returns the native descriptor binding flags (VkDescriptorBindingFlagsEXT) for the specified binding descriptor.
+Update-after-bind is only enabled for descriptor types whose respective feature is supported by the physical device.
+*/
+static VkFlags GetVkDescriptorBindingFlags(const VKPhysicalDevice& physicalDevice, const BindingDescriptor& bindingDesc, VkDescriptorType descriptorType)
+{
+    #if VK_EXT_descriptor_indexing
+    if ((bindingDesc.flags & BindingFlags::DescriptorIndexing) != 0)
+    {
+        VkFlags bindingFlags = (VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT);
+        if (physicalDevice.SupportsUpdateAfterBind(descriptorType))
+            bindingFlags |= VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT;
+        return bindingFlags;
+    }
+    #endif
+    return 0;
+}
+
 static bool IsNonUniformBufferBinding(const BindingDescriptor& bindingDesc)
 {
     return (bindingDesc.type == ResourceType::Buffer && (bindingDesc.bindFlags & (BindFlags::Sampled | BindFlags::Storage)) != 0);
 }
 
 void VKPipelineLayout::CreateDescriptorSetLayout(
+    const VKPhysicalDevice&                 physicalDevice,
     VkDevice                                device,
     const std::vector<BindingDescriptor>&   inBindings,
     std::vector<VKLayoutBinding>&           outBindings,
@@ -396,6 +416,7 @@ void VKPipelineLayout::CreateDescriptorSetLayout(
     /* Convert heap bindings to native descriptor set layout bindings and create Vulkan descriptor set layout */
     const std::size_t numBindings = inBindings.size();
     std::vector<VkDescriptorSetLayoutBinding> setLayoutBindings(numBindings);
+    std::vector<VkFlags> setLayoutBindingFlags;
 
     for_range(i, numBindings)
     {
@@ -403,9 +424,16 @@ void VKPipelineLayout::CreateDescriptorSetLayout(
 
         if (IsNonUniformBufferBinding(inBindings[i]))
             flags_ |= PSOLayoutFlag_HasNonUniformBuffers;
+
+        /* Only allocate binding flags if at least one binding is descriptor indexed */
+        if (VkFlags bindingFlags = GetVkDescriptorBindingFlags(physicalDevice, inBindings[i], setLayoutBindings[i].descriptorType))
+        {
+            setLayoutBindingFlags.resize(numBindings, 0);
+            setLayoutBindingFlags[i] = bindingFlags;
+        }
     }
 
-    outDescriptorSetLayout.Initialize(device, std::move(setLayoutBindings));
+    outDescriptorSetLayout.Initialize(device, std::move(setLayoutBindings), std::move(setLayoutBindingFlags));
     outDescriptorSetLayout.GetLayoutBindings(outBindings);
 
     /* Allocate slots for automatic */
@@ -506,7 +534,7 @@ VKPtr<VkPipelineLayout> VKPipelineLayout::CreateVkPipelineLayout(VkDevice device
         }
     }
     VKPtr<VkPipelineLayout> pipelineLayout{ device, vkDestroyPipelineLayout };
-    VkResult result = vkCreatePipelineLayout(device, &layoutCreateInfo, nullptr, pipelineLayout.ReleaseAndGetAddressOf());
+    VkResult result = vkCreatePipelineLayout(device, &layoutCreateInfo, VKGetAllocationCallbacks(), pipelineLayout.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan pipeline layout");
     return pipelineLayout;
 }
@@ -534,7 +562,7 @@ void VKPipelineLayout::CreateDescriptorPool(VkDevice device)
         poolCreateInfo.poolSizeCount    = poolSizeAccum.Size();
         poolCreateInfo.pPoolSizes       = poolSizeAccum.Data();
     }
-    VkResult result = vkCreateDescriptorPool(device, &poolCreateInfo, nullptr, descriptorPool_.ReleaseAndGetAddressOf());
+    VkResult result = vkCreateDescriptorPool(device, &poolCreateInfo, VKGetAllocationCallbacks(), descriptorPool_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan descriptor pool for static samplers");
 }
 
@@ -26,6 +26,8 @@ namespace LLGL
 {
 
 
+class VKPhysicalDevice;
+
 // Implementation of the PipelineLayout interface for the Vulkan backend.
 // This class acts as a template for permutations of pipeline layouts rather than wrapping the native VkPipelineLayout directly (see VKPipelineLayoutPermutation).
 class VKPipelineLayout final : public PipelineLayout
@@ -37,7 +39,7 @@ class VKPipelineLayout final : public PipelineLayout
 
     public:
 
-        VKPipelineLayout(VkDevice device, const PipelineLayoutDescriptor& desc);
+        VKPipelineLayout(const VKPhysicalDevice& physicalDevice, VkDevice device, const PipelineLayoutDescriptor& desc);
         ~VKPipelineLayout();
 
         // Returns true if this pipeline layout can have permutations, i.e. if this layout contains uniforms or non-uniform buffers.
@@ -71,6 +73,12 @@ class VKPipelineLayout final : public PipelineLayout
             return setLayoutHeapBindings_.GetVkDescriptorSetLayout();
         }
 
+        // Returns the native binding flags of the heap bindings. See VKDescriptorSetLayout::GetVkLayoutBindingFlags.
+        inline const std::vector<VkFlags>& GetHeapBindingFlags() const
+        {
+            return setLayoutHeapBindings_.GetVkLayoutBindingFlags();
+        }
+
         // Returns the native VkDescriptorSetLayout object for dynamic bindings.
         inline VkDescriptorSetLayout GetSetLayoutForDynamicBindings() const
         {
@@ -172,6 +180,7 @@ class VKPipelineLayout final : public PipelineLayout
     private:
 
         void CreateDescriptorSetLayout(
+            const VKPhysicalDevice&                 physicalDevice,
             VkDevice                                device,
             const std::vector<BindingDescriptor>&   inBindings,
             std::vector<VKLayoutBinding>&           outBindings,
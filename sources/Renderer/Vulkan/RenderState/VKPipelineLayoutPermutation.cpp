@@ -49,7 +49,8 @@ VKPipelineLayoutPermutation::VKPipelineLayoutPermutation(
             owner->GetBindingTable().heapBindings,
             permutationParams.setLayoutHeapBindings,
             bindingTable_.heapBindings,
-            setLayoutHeapBindings_
+            setLayoutHeapBindings_,
+            owner->GetHeapBindingFlags()
         );
     }
     if (!permutationParams.setLayoutDynamicBindings.empty())
@@ -105,9 +106,10 @@ void VKPipelineLayoutPermutation::CreateBindingSetLayout(
     const ArrayView<VKLayoutBinding>&           inBindings,
     std::vector<VkDescriptorSetLayoutBinding>   setLayoutBindings,
     std::vector<VKLayoutBinding>&               outBindings,
-    VKDescriptorSetLayout&                      outSetLayout)
+    VKDescriptorSetLayout&                      outSetLayout,
+    std::vector<VkFlags>                        setLayoutBindingFlags)
 {
-    outSetLayout.Initialize(device, std::move(setLayoutBindings));
+    outSetLayout.Initialize(device, std::move(setLayoutBindings), std::move(setLayoutBindingFlags));
     outSetLayout.GetLayoutBindings(outBindings);
     LLGL_ASSERT(inBindings.size() == outBindings.size());
     for_range(i, inBindings.size())
@@ -146,7 +148,7 @@ VKPtr<VkPipelineLayout> VKPipelineLayoutPermutation::CreateVkPipelineLayout(VkDe
         }
     }
     VKPtr<VkPipelineLayout> pipelineLayout{ device, vkDestroyPipelineLayout };
-    VkResult result = vkCreatePipelineLayout(device, &layoutCreateInfo, nullptr, pipelineLayout.ReleaseAndGetAddressOf());
+    VkResult result = vkCreatePipelineLayout(device, &layoutCreateInfo, VKGetAllocationCallbacks(), pipelineLayout.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan pipeline layout");
     return pipelineLayout;
 }
@@ -174,7 +176,7 @@ void VKPipelineLayoutPermutation::CreateDescriptorPool(VkDevice device, std::uin
         poolCreateInfo.poolSizeCount    = poolSizeAccum.Size();
         poolCreateInfo.pPoolSizes       = poolSizeAccum.Data();
     }
-    VkResult result = vkCreateDescriptorPool(device, &poolCreateInfo, nullptr, descriptorPool_.ReleaseAndGetAddressOf());
+    VkResult result = vkCreateDescriptorPool(device, &poolCreateInfo, VKGetAllocationCallbacks(), descriptorPool_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan descriptor pool for static samplers");
 }
 
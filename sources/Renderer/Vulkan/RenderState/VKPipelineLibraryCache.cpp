@@ -0,0 +1,108 @@
+/*
+ * VKPipelineLibraryCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKPipelineLibraryCache.h"
+#include "../VKCore.h"
+#include <LLGL/RenderingDebuggerFlags.h>
+
+
+namespace LLGL
+{
+
+
+VKPipelineLibraryCache& VKPipelineLibraryCache::Get()
+{
+    static VKPipelineLibraryCache instance;
+    return instance;
+}
+
+void VKPipelineLibraryCache::Clear()
+{
+    libraries_.clear();
+    entries_.clear();
+}
+
+VkPipeline VKPipelineLibraryCache::AcquireLibrary(
+    VkDevice                            device,
+    const Key&                          key,
+    const VkGraphicsPipelineCreateInfo& createInfo,
+    VkPipelineCache                     pipelineCache)
+{
+    /* Find existing library with the same states */
+    auto it = entries_.find(key);
+    if (it != entries_.end())
+    {
+        ++numLibraryReuses_;
+        ++(it->second.refCount);
+        return it->second.library.Get();
+    }
+
+    /* Compile new pipeline library */
+    Entry entry;
+    {
+        entry.library = VKPtr<VkPipeline>{ device, vkDestroyPipeline };
+        VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &createInfo, VKGetAllocationCallbacks(), entry.library.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline library");
+        entry.refCount = 1;
+    }
+    ++numLibraryCreations_;
+
+    VkPipeline library = entry.library.Get();
+    libraries_[library] = entries_.emplace(key, std::move(entry)).first;
+    return library;
+}
+
+void VKPipelineLibraryCache::ReleaseLibrary(VkPipeline library)
+{
+    if (library == VK_NULL_HANDLE)
+        return;
+
+    auto it = libraries_.find(library);
+    if (it != libraries_.end())
+    {
+        Entry& entry = it->second->second;
+        if (entry.refCount > 0)
+            --(entry.refCount);
+        if (entry.refCount == 0)
+        {
+            entries_.erase(it->second);
+            libraries_.erase(it);
+        }
+    }
+}
+
+void VKPipelineLibraryCache::RecordPipelineCreation(bool linked, std::uint32_t creationTime)
+{
+    if (linked)
+        ++numPipelineLinks_;
+    else
+        ++numPipelineCreations_;
+    creationTime_ += creationTime;
+}
+
+void VKPipelineLibraryCache::FlushProfile(ProfileGraphicsPipelineRecord& outProfile)
+{
+    outProfile.pipelineCreations    = numPipelineCreations_;
+    outProfile.pipelineLinks        = numPipelineLinks_;
+    outProfile.libraryCreations     = numLibraryCreations_;
+    outProfile.libraryReuses        = numLibraryReuses_;
+    outProfile.numLibraries         = static_cast<std::uint32_t>(entries_.size());
+    outProfile.creationTime         = creationTime_;
+
+    numPipelineCreations_   = 0;
+    numPipelineLinks_       = 0;
+    numLibraryCreations_    = 0;
+    numLibraryReuses_       = 0;
+    creationTime_           = 0;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,106 @@
+/*
+ * VKPipelineLibraryCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_PIPELINE_LIBRARY_CACHE_H
+#define LLGL_VK_PIPELINE_LIBRARY_CACHE_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <cstdint>
+#include <vector>
+#include <map>
+#include <unordered_map>
+
+
+namespace LLGL
+{
+
+
+struct ProfileGraphicsPipelineRecord;
+
+/*
+Device-wide cache of graphics pipeline libraries (VK_EXT_graphics_pipeline_library).
+Graphics PSOs with equal vertex input, pre-rasterization, fragment shader, or fragment output states share the same library,
+so only the missing libraries have to be compiled and the final pipeline is linked from them.
+Libraries are destroyed as soon as they are no longer referenced, because their keys refer to pipeline layouts and render passes by handle.
+This also tracks the statistics of all graphics pipeline creations for the frame profile.
+*/
+class VKPipelineLibraryCache
+{
+
+    public:
+
+        // Key of a pipeline library with all its states serialized as 32-bit words.
+        using Key = std::vector<std::uint32_t>;
+
+    public:
+
+        VKPipelineLibraryCache(const VKPipelineLibraryCache&) = delete;
+        VKPipelineLibraryCache& operator = (const VKPipelineLibraryCache&) = delete;
+
+        static VKPipelineLibraryCache& Get();
+
+        // Clear all resource containers of this cache (used by VKRenderSystem).
+        void Clear();
+
+        /*
+        Returns the pipeline library for the specified key and increments its reference counter.
+        A new library is only compiled with the specified create info if no library with an equal key is cached.
+        */
+        VkPipeline AcquireLibrary(
+            VkDevice                            device,
+            const Key&                          key,
+            const VkGraphicsPipelineCreateInfo& createInfo,
+            VkPipelineCache                     pipelineCache = VK_NULL_HANDLE
+        );
+
+        // Decrements the reference counter of the specified library and destroys it once it is no longer referenced. This has no effect for VK_NULL_HANDLE.
+        void ReleaseLibrary(VkPipeline library);
+
+        // Records the creation of a native graphics pipeline. 'linked' specifies whether it was linked from libraries. 'creationTime' is specified in microseconds.
+        void RecordPipelineCreation(bool linked, std::uint32_t creationTime);
+
+        // Writes the graphics pipeline statistics into the output profile record and resets the counters.
+        void FlushProfile(ProfileGraphicsPipelineRecord& outProfile);
+
+    private:
+
+        VKPipelineLibraryCache() = default;
+
+    private:
+
+        struct Entry
+        {
+            VKPtr<VkPipeline>   library;
+            std::uint32_t       refCount    = 0;
+        };
+
+        using EntryMap = std::map<Key, Entry>;
+
+    private:
+
+        EntryMap                                            entries_;
+        std::unordered_map<VkPipeline, EntryMap::iterator>  libraries_;
+
+        std::uint32_t                                       numPipelineCreations_   = 0;
+        std::uint32_t                                       numPipelineLinks_       = 0;
+        std::uint32_t                                       numLibraryCreations_    = 0;
+        std::uint32_t                                       numLibraryReuses_       = 0;
+        std::uint32_t                                       creationTime_           = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -52,13 +52,14 @@ static VkQueryControlFlags GetQueryControlFlags(const QueryHeapDescriptor& desc)
     return flags;
 }
 
-VKQueryHeap::VKQueryHeap(VkDevice device, const QueryHeapDescriptor& desc, bool hasPredicates) :
-    QueryHeap      { desc.type                    },
-    queryPool_     { device, vkDestroyQueryPool   },
-    controlFlags_  { GetQueryControlFlags(desc)   },
-    hasPredicates_ { hasPredicates                },
-    groupSize_     { GetQueryGroupSize(desc)      },
-    numQueries_    { desc.numQueries * groupSize_ }
+VKQueryHeap::VKQueryHeap(VkDevice device, const QueryHeapDescriptor& desc, bool hasPredicates, bool hasHostResults) :
+    QueryHeap       { desc.type                    },
+    queryPool_      { device, vkDestroyQueryPool   },
+    controlFlags_   { GetQueryControlFlags(desc)   },
+    hasPredicates_  { hasPredicates                },
+    hasHostResults_ { hasHostResults               },
+    groupSize_      { GetQueryGroupSize(desc)      },
+    numQueries_     { desc.numQueries * groupSize_ }
 {
     /* Create query pool object */
     VkQueryPoolCreateInfo createInfo;
@@ -70,7 +71,7 @@ VKQueryHeap::VKQueryHeap(VkDevice device, const QueryHeapDescriptor& desc, bool
         createInfo.queryCount           = numQueries_;
         createInfo.pipelineStatistics   = GetPipelineStatisticsFlags(desc);
     }
-    VkResult result = vkCreateQueryPool(device, &createInfo, nullptr, queryPool_.ReleaseAndGetAddressOf());
+    VkResult result = vkCreateQueryPool(device, &createInfo, VKGetAllocationCallbacks(), queryPool_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan query pool");
 }
 
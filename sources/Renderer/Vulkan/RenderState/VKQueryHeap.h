@@ -18,13 +18,13 @@ namespace LLGL
 {
 
 
-// Base class for Vulkan query heaps (sub class: VKPredicateQueryHeap).
+// Base class for Vulkan query heaps (sub classes: VKPredicateQueryHeap, VKHostQueryHeap).
 class VKQueryHeap : public QueryHeap
 {
 
     public:
 
-        VKQueryHeap(VkDevice device, const QueryHeapDescriptor& desc, bool hasPredicates = false);
+        VKQueryHeap(VkDevice device, const QueryHeapDescriptor& desc, bool hasPredicates = false, bool hasHostResults = false);
 
         // Returns the Vulkan VkQueryPool object.
         inline VkQueryPool GetVkQueryPool() const
@@ -56,11 +56,18 @@ class VKQueryHeap : public QueryHeap
             return hasPredicates_;
         }
 
+        // Returns true if this query heap resolves its results into host visible memory, i.e. it can be casted to <VKHostQueryHeap>.
+        inline bool HasHostResults() const
+        {
+            return hasHostResults_;
+        }
+
     private:
 
         VKPtr<VkQueryPool>  queryPool_;
         VkQueryControlFlags controlFlags_   = 0;
         const bool          hasPredicates_  = false;
+        const bool          hasHostResults_ = false;
         std::uint32_t       groupSize_      = 1;
         std::uint32_t       numQueries_     = 0;
 
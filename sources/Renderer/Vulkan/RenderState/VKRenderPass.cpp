@@ -6,6 +6,7 @@
  */
 
 #include "VKRenderPass.h"
+#include "VKRenderPassCache.h"
 #include "../VKCore.h"
 #include "../VKTypes.h"
 #include "../../RenderPassUtils.h"
@@ -18,8 +19,7 @@ namespace LLGL
 {
 
 
-VKRenderPass::VKRenderPass(VkDevice device) :
-    renderPass_ { device, vkDestroyRenderPass }
+VKRenderPass::VKRenderPass(VkDevice /*device*/)
 {
 }
 
@@ -29,6 +29,11 @@ VKRenderPass::VKRenderPass(VkDevice device, const RenderPassDescriptor& desc) :
     CreateVkRenderPass(device, desc);
 }
 
+VKRenderPass::~VKRenderPass()
+{
+    VKRenderPassCache::Get().ReleaseRenderPass(renderPass_);
+}
+
 static void InitColorVkAttachmentDesc(
     VkAttachmentDescription&    dst,
     Format                      format,
@@ -263,7 +268,7 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
         subpassDep.dependencyFlags  = 0;
     }
 
-    /* Create swap-chain render pass */
+    /* Acquire compatible render pass from cache, or create a new one */
     VkRenderPassCreateInfo createInfo;
     {
         createInfo.sType            = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
@@ -276,8 +281,11 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
         createInfo.dependencyCount  = 1;
         createInfo.pDependencies    = (&subpassDep);
     }
-    VkResult result = vkCreateRenderPass(device, &createInfo, nullptr, renderPass_.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan render pass");
+    VkRenderPass renderPass = VKRenderPassCache::Get().AcquireRenderPass(device, createInfo);
+
+    /* Release previous render pass when it's replaced, e.g. when a swap-chain is resized */
+    VKRenderPassCache::Get().ReleaseRenderPass(renderPass_);
+    renderPass_ = renderPass;
 }
 
 
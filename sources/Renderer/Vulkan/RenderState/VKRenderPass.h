@@ -29,6 +29,11 @@ class VKRenderPass final : public RenderPass
         VKRenderPass(VkDevice device);
         VKRenderPass(VkDevice device, const RenderPassDescriptor& desc);
 
+        VKRenderPass(const VKRenderPass&) = delete;
+        VKRenderPass& operator = (const VKRenderPass&) = delete;
+
+        ~VKRenderPass();
+
         // (Re-)creates the render pass object.
         void CreateVkRenderPass(
             VkDevice                    device,
@@ -84,7 +89,7 @@ class VKRenderPass final : public RenderPass
 
     private:
 
-        VKPtr<VkRenderPass>     renderPass_;
+        VkRenderPass            renderPass_             = VK_NULL_HANDLE; // Shared by VKRenderPassCache
 
         std::uint64_t           clearValuesMask_        = 0;
         std::uint8_t            depthStencilIndex_      = 0xFFu;
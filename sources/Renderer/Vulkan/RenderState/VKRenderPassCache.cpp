@@ -0,0 +1,165 @@
+/*
+ * VKRenderPassCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKRenderPassCache.h"
+#include "../VKCore.h"
+#include <LLGL/RenderingDebuggerFlags.h>
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+VKRenderPassCache& VKRenderPassCache::Get()
+{
+    static VKRenderPassCache instance;
+    return instance;
+}
+
+void VKRenderPassCache::Clear()
+{
+    entries_.clear();
+}
+
+VkRenderPass VKRenderPassCache::AcquireRenderPass(VkDevice device, const VkRenderPassCreateInfo& createInfo)
+{
+    /* Find existing entry with the same create info */
+    BuildKey(keyCache_, createInfo);
+    auto it = entries_.find(keyCache_);
+    if (it != entries_.end())
+    {
+        ++numReuses_;
+        ++(it->second.refCount);
+        return it->second.renderPass.Get();
+    }
+
+    /* Create new render pass */
+    Entry entry;
+    {
+        entry.renderPass = VKPtr<VkRenderPass>{ device, vkDestroyRenderPass };
+        VkResult result = vkCreateRenderPass(device, &createInfo, VKGetAllocationCallbacks(), entry.renderPass.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan render pass");
+        entry.refCount = 1;
+    }
+    ++numCreations_;
+
+    VkRenderPass renderPass = entry.renderPass.Get();
+    entries_.emplace(keyCache_, std::move(entry));
+    return renderPass;
+}
+
+void VKRenderPassCache::ReleaseRenderPass(VkRenderPass renderPass)
+{
+    if (renderPass == VK_NULL_HANDLE)
+        return;
+
+    /* Only decrement reference counter; the render pass is kept alive for later reuse */
+    for (auto& it : entries_)
+    {
+        if (it.second.renderPass.Get() == renderPass)
+        {
+            if (it.second.refCount > 0)
+                --(it.second.refCount);
+            return;
+        }
+    }
+}
+
+void VKRenderPassCache::FlushProfile(ProfileRenderPassCacheRecord& outProfile)
+{
+    outProfile.renderPassCreations  = numCreations_;
+    outProfile.renderPassReuses     = numReuses_;
+    outProfile.numRenderPasses      = static_cast<std::uint32_t>(entries_.size());
+
+    numCreations_   = 0;
+    numReuses_      = 0;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+static void AppendAttachmentReference(std::vector<std::uint32_t>& key, const VkAttachmentReference* ref)
+{
+    if (ref != nullptr)
+    {
+        key.push_back(ref->attachment);
+        key.push_back(static_cast<std::uint32_t>(ref->layout));
+    }
+    else
+        key.push_back(VK_ATTACHMENT_UNUSED);
+}
+
+void VKRenderPassCache::BuildKey(Key& outKey, const VkRenderPassCreateInfo& createInfo)
+{
+    outKey.clear();
+
+    /* Serialize attachment descriptions */
+    outKey.push_back(createInfo.flags);
+    outKey.push_back(createInfo.attachmentCount);
+    for_range(i, createInfo.attachmentCount)
+    {
+        const VkAttachmentDescription& attachment = createInfo.pAttachments[i];
+        outKey.push_back(attachment.flags);
+        outKey.push_back(static_cast<std::uint32_t>(attachment.format));
+        outKey.push_back(static_cast<std::uint32_t>(attachment.samples));
+        outKey.push_back(static_cast<std::uint32_t>(attachment.loadOp));
+        outKey.push_back(static_cast<std::uint32_t>(attachment.storeOp));
+        outKey.push_back(static_cast<std::uint32_t>(attachment.stencilLoadOp));
+        outKey.push_back(static_cast<std::uint32_t>(attachment.stencilStoreOp));
+        outKey.push_back(static_cast<std::uint32_t>(attachment.initialLayout));
+        outKey.push_back(static_cast<std::uint32_t>(attachment.finalLayout));
+    }
+
+    /* Serialize sub-pass descriptions */
+    outKey.push_back(createInfo.subpassCount);
+    for_range(i, createInfo.subpassCount)
+    {
+        const VkSubpassDescription& subpass = createInfo.pSubpasses[i];
+        outKey.push_back(subpass.flags);
+        outKey.push_back(static_cast<std::uint32_t>(subpass.pipelineBindPoint));
+
+        outKey.push_back(subpass.inputAttachmentCount);
+        for_range(j, subpass.inputAttachmentCount)
+            AppendAttachmentReference(outKey, &(subpass.pInputAttachments[j]));
+
+        outKey.push_back(subpass.colorAttachmentCount);
+        for_range(j, subpass.colorAttachmentCount)
+        {
+            AppendAttachmentReference(outKey, &(subpass.pColorAttachments[j]));
+            AppendAttachmentReference(outKey, (subpass.pResolveAttachments != nullptr ? &(subpass.pResolveAttachments[j]) : nullptr));
+        }
+
+        AppendAttachmentReference(outKey, subpass.pDepthStencilAttachment);
+
+        outKey.push_back(subpass.preserveAttachmentCount);
+        outKey.insert(outKey.end(), subpass.pPreserveAttachments, subpass.pPreserveAttachments + subpass.preserveAttachmentCount);
+    }
+
+    /* Serialize sub-pass dependencies */
+    outKey.push_back(createInfo.dependencyCount);
+    for_range(i, createInfo.dependencyCount)
+    {
+        const VkSubpassDependency& dependency = createInfo.pDependencies[i];
+        outKey.push_back(dependency.srcSubpass);
+        outKey.push_back(dependency.dstSubpass);
+        outKey.push_back(dependency.srcStageMask);
+        outKey.push_back(dependency.dstStageMask);
+        outKey.push_back(dependency.srcAccessMask);
+        outKey.push_back(dependency.dstAccessMask);
+        outKey.push_back(dependency.dependencyFlags);
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,91 @@
+/*
+ * VKRenderPassCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_RENDER_PASS_CACHE_H
+#define LLGL_VK_RENDER_PASS_CACHE_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <cstdint>
+#include <vector>
+#include <map>
+
+
+namespace LLGL
+{
+
+
+struct ProfileRenderPassCacheRecord;
+
+/*
+Device-wide cache of native Vulkan render passes.
+Render passes with identical attachment descriptions, sub-passes, and dependencies share the same VkRenderPass object,
+so all render targets, swap-chains, and RenderPass objects with compatible attachments use the same native object.
+Unreferenced render passes are kept alive until the cache is cleared, since they are small and are likely to be requested again,
+e.g. when render targets are recreated after a resolution change.
+*/
+class VKRenderPassCache
+{
+
+    public:
+
+        VKRenderPassCache(const VKRenderPassCache&) = delete;
+        VKRenderPassCache& operator = (const VKRenderPassCache&) = delete;
+
+        static VKRenderPassCache& Get();
+
+        // Clear all resource containers of this cache (used by VKRenderSystem).
+        void Clear();
+
+        // Returns a native render pass for the specified create info and increments its reference counter. A new render pass is only created if no equal one is cached.
+        VkRenderPass AcquireRenderPass(VkDevice device, const VkRenderPassCreateInfo& createInfo);
+
+        // Decrements the reference counter of the specified render pass. This has no effect for VK_NULL_HANDLE.
+        void ReleaseRenderPass(VkRenderPass renderPass);
+
+        // Writes the render pass statistics into the output profile record and resets the counters.
+        void FlushProfile(ProfileRenderPassCacheRecord& outProfile);
+
+    private:
+
+        VKRenderPassCache() = default;
+
+    private:
+
+        struct Entry
+        {
+            VKPtr<VkRenderPass> renderPass;
+            std::uint32_t       refCount    = 0;
+        };
+
+        // Key of a render pass with all fields of its create info serialized as 32-bit words.
+        using Key = std::vector<std::uint32_t>;
+
+    private:
+
+        static void BuildKey(Key& outKey, const VkRenderPassCreateInfo& createInfo);
+
+    private:
+
+        std::map<Key, Entry>    entries_;
+        Key                     keyCache_;
+
+        std::uint32_t           numCreations_   = 0;
+        std::uint32_t           numReuses_      = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -79,6 +79,10 @@ std::uint32_t VKResourceHeap::WriteResourceViews(
     const std::uint32_t numBindings     = static_cast<std::uint32_t>(bindings_.size());
     const std::uint32_t numDescriptors  = numSets * numBindings;
 
+    /* Only record resource views while a batched update is pending */
+    if (updateBatch_.IsActive())
+        return updateBatch_.Record(firstDescriptor, resourceViews, numDescriptors);
+
     /* Silently quit on out of bounds; debug layer must report these errors */
     if (firstDescriptor >= numDescriptors)
         return 0;
@@ -88,57 +92,40 @@ std::uint32_t VKResourceHeap::WriteResourceViews(
     const std::uint32_t numResourceViewWrites = static_cast<std::uint32_t>(resourceViews.size());
     VKDescriptorSetWriter setWriter{ numResourceViewWrites, numResourceViewWrites };
 
-    for (const ResourceViewDescriptor& desc : resourceViews)
-    {
-        /* Skip over empty resource descriptors */
-        if (desc.resource == nullptr)
-            continue;
-
-        /* Get resource view information */
-        const VKLayoutHeapBinding& binding = bindings_[firstDescriptor % numBindings];
-
-        const std::uint32_t descriptorSet = firstDescriptor / numBindings;
-
-        switch (binding.descriptorType)
-        {
-            case VK_DESCRIPTOR_TYPE_SAMPLER:
-                FillWriteDescriptorWithSampler(desc, descriptorSet, binding, setWriter);
-                break;
+    const bool isAllUpdateAfterBind = FillWriteDescriptors(device, firstDescriptor, resourceViews, setWriter);
+    return FlushWriteDescriptors(device, setWriter, isAllUpdateAfterBind);
+}
 
-            #if 0
-            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
-                FillWriteDescriptorWithCombinedImageSampler(device, desc, descriptorSet, binding, setWriter);
-                break;
-            #endif
+void VKResourceHeap::BeginUpdate()
+{
+    updateBatch_.Begin();
+}
 
-            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
-            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
-                FillWriteDescriptorWithImageView(device, desc, descriptorSet, binding, setWriter);
-                break;
+std::uint32_t VKResourceHeap::CommitUpdate(VkDevice device)
+{
+    std::vector<ResourceHeapUpdateBatch::Range> ranges;
+    std::vector<ResourceViewDescriptor> resourceViews;
+    updateBatch_.Resolve(ranges, resourceViews);
 
-            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
-            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
-            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
-            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-                FillWriteDescriptorWithBufferRange(device, desc, descriptorSet, binding, setWriter);
-                break;
+    if (resourceViews.empty())
+        return 0;
 
-            default:
-                LLGL_TRAP("invalid descriptor type in Vulkan descriptor set: 0x%08X", static_cast<unsigned>(binding.descriptorType));
-                break;
-        }
+    /* Fill descriptor writes for all contiguous ranges into the same writer, so they are submitted at once */
+    const std::uint32_t numResourceViewWrites = static_cast<std::uint32_t>(resourceViews.size());
+    VKDescriptorSetWriter setWriter{ numResourceViewWrites, numResourceViewWrites };
 
-        ++firstDescriptor;
-    }
+    bool isAllUpdateAfterBind = true;
+    const ResourceViewDescriptor* resourceViewsPtr = resourceViews.data();
 
-    if (setWriter.GetNumWrites() > 0)
+    for (const ResourceHeapUpdateBatch::Range& range : ranges)
     {
-        /* All command buffers must have finished execution before any affected descriptor set can be updated */
-        vkDeviceWaitIdle(device);
-        setWriter.UpdateDescriptorSets(device);
+        const ArrayView<ResourceViewDescriptor> rangeResourceViews{ resourceViewsPtr, range.numDescriptors };
+        if (!FillWriteDescriptors(device, range.firstDescriptor, rangeResourceViews, setWriter))
+            isAllUpdateAfterBind = false;
+        resourceViewsPtr += range.numDescriptors;
     }
 
-    return setWriter.GetNumWrites();
+    return FlushWriteDescriptors(device, setWriter, isAllUpdateAfterBind);
 }
 
 void VKResourceHeap::SetBarrierSlots(VKPipelineBarrier& barrier, std::uint32_t descriptorSet)
@@ -166,6 +153,11 @@ void VKResourceHeap::SetBarrierSlots(VKPipelineBarrier& barrier, std::uint32_t d
     }
 }
 
+void VKResourceHeap::RemoveMappedBuffer(const VKBuffer* bufferVK)
+{
+    RemoveFromList(mappedBuffers_, bufferVK);
+}
+
 
 /*
  * ======= Private: =======
@@ -193,6 +185,85 @@ static bool IsDescriptorTypeBufferView(VkDescriptorType type)
     );
 }
 
+bool VKResourceHeap::FillWriteDescriptors(
+    VkDevice                                    device,
+    std::uint32_t                               firstDescriptor,
+    const ArrayView<ResourceViewDescriptor>&    resourceViews,
+    VKDescriptorSetWriter&                      setWriter)
+{
+    const std::uint32_t numBindings = static_cast<std::uint32_t>(bindings_.size());
+
+    /* Descriptor indexed bindings can be written while their descriptor sets are in use by pending command buffers */
+    bool isAllUpdateAfterBind = true;
+
+    for (const ResourceViewDescriptor& desc : resourceViews)
+    {
+        /* Skip over empty resource descriptors */
+        if (desc.resource == nullptr)
+        {
+            ++firstDescriptor;
+            continue;
+        }
+
+        /* Get resource view information */
+        const VKLayoutHeapBinding& binding = bindings_[firstDescriptor % numBindings];
+
+        const std::uint32_t descriptorSet = firstDescriptor / numBindings;
+
+        if (!binding.updateAfterBind)
+            isAllUpdateAfterBind = false;
+
+        switch (binding.descriptorType)
+        {
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+                FillWriteDescriptorWithSampler(desc, descriptorSet, binding, setWriter);
+                break;
+
+            #if 0
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                FillWriteDescriptorWithCombinedImageSampler(device, desc, descriptorSet, binding, setWriter);
+                break;
+            #endif
+
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                FillWriteDescriptorWithImageView(device, desc, descriptorSet, binding, setWriter);
+                break;
+
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                FillWriteDescriptorWithBufferRange(device, desc, descriptorSet, binding, setWriter);
+                break;
+
+            default:
+                LLGL_TRAP("invalid descriptor type in Vulkan descriptor set: 0x%08X", static_cast<unsigned>(binding.descriptorType));
+                break;
+        }
+
+        /* Merge adjacent array elements of the same binding into a single write */
+        setWriter.CoalesceLastWrite();
+
+        ++firstDescriptor;
+    }
+
+    return isAllUpdateAfterBind;
+}
+
+std::uint32_t VKResourceHeap::FlushWriteDescriptors(VkDevice device, VKDescriptorSetWriter& setWriter, bool isAllUpdateAfterBind)
+{
+    const std::uint32_t numDescriptors = setWriter.GetNumDescriptors();
+    if (numDescriptors > 0)
+    {
+        /* All command buffers must have finished execution before any affected descriptor set can be updated */
+        if (!isAllUpdateAfterBind)
+            vkDeviceWaitIdle(device);
+        setWriter.UpdateDescriptorSets(device);
+    }
+    return numDescriptors;
+}
+
 void VKResourceHeap::ConvertAllLayoutBindings(const ArrayView<VKLayoutBinding>& layoutBindings)
 {
     bindings_.resize(layoutBindings.size());
@@ -207,6 +278,8 @@ void VKResourceHeap::ConvertLayoutBinding(VKLayoutHeapBinding& dst, const VKLayo
     dst.barrierSlot     = src.barrierSlot;
     dst.descriptorType  = src.descriptorType;
     dst.stageFlags      = src.stageFlags;
+    dst.bindFlags       = src.bindFlags;
+    dst.updateAfterBind = src.updateAfterBind;
     dst.imageViewIndex  = (IsDescriptorTypeImageView(src.descriptorType) ? numImageViewsPerSet_++ : VKResourceHeap::invalidViewIndex);
     dst.bufferViewIndex = (IsDescriptorTypeBufferView(src.descriptorType) ? numBufferViewsPerSet_++ : VKResourceHeap::invalidViewIndex);
 }
@@ -215,8 +288,12 @@ void VKResourceHeap::CreateDescriptorPool(VkDevice device, std::uint32_t numDesc
 {
     /* Accumulate descriptor pool sizes */
     VKPoolSizeAccumulator poolSizeAccum;
+    bool hasUpdateAfterBind = false;
     for (const VKLayoutHeapBinding& binding : bindings_)
     {
+        if (binding.updateAfterBind)
+            hasUpdateAfterBind = true;
+
         if (binding.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER)
         {
             poolSizeAccum.Accumulate(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, numDescriptorSets);
@@ -238,7 +315,13 @@ void VKResourceHeap::CreateDescriptorPool(VkDevice device, std::uint32_t numDesc
         poolCreateInfo.poolSizeCount    = poolSizeAccum.Size();
         poolCreateInfo.pPoolSizes       = poolSizeAccum.Data();
     }
-    VkResult result = vkCreateDescriptorPool(device, &poolCreateInfo, nullptr, descriptorPool_.ReleaseAndGetAddressOf());
+
+    #if VK_EXT_descriptor_indexing
+    if (hasUpdateAfterBind)
+        poolCreateInfo.flags |= VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT;
+    #endif
+
+    VkResult result = vkCreateDescriptorPool(device, &poolCreateInfo, VKGetAllocationCallbacks(), descriptorPool_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan descriptor pool");
 }
 
@@ -410,6 +493,10 @@ void VKResourceHeap::FillWriteDescriptorWithBufferRange(
                 break;
         }
     }
+
+    /* Keep track of persistently mapped buffers, so command buffers can tell the CPU when it must wait before writing into them */
+    if (bufferVK->GetPersistentMapping() != nullptr && !Contains(mappedBuffers_, bufferVK))
+        mappedBuffers_.push_back(bufferVK);
 }
 
 VkImageView VKResourceHeap::GetOrCreateImageView(
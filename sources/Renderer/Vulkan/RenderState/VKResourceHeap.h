@@ -16,6 +16,7 @@
 #include "VKPipelineLayout.h"
 #include "../Vulkan.h"
 #include "../VKPtr.h"
+#include "../../ResourceHeapUpdateBatch.h"
 #include <vector>
 
 
@@ -53,9 +54,18 @@ class VKResourceHeap final : public ResourceHeap
             const ArrayView<ResourceViewDescriptor>&    resourceViews
         );
 
+        // Starts recording all writes into this resource heap until CommitUpdate is called.
+        void BeginUpdate();
+
+        // Writes all recorded resource views with a single call to vkUpdateDescriptorSets and returns the number of updated descriptors.
+        std::uint32_t CommitUpdate(VkDevice device);
+
         // Sets all the barrier slots in the specified pipeline barrier.
         void SetBarrierSlots(VKPipelineBarrier& barrier, std::uint32_t descriptorSet);
 
+        // Removes the specified buffer from the list of mapped buffers, because it is about to be released.
+        void RemoveMappedBuffer(const VKBuffer* bufferVK);
+
         // Returns the native Vulkan descritpor pool.
         inline VkDescriptorPool GetVkDescriptorPool() const
         {
@@ -68,6 +78,12 @@ class VKResourceHeap final : public ResourceHeap
             return descriptorSets_;
         }
 
+        // Returns the persistently mapped buffers that have been written to any descriptor set of this heap.
+        inline const std::vector<VKBuffer*>& GetMappedBuffers() const
+        {
+            return mappedBuffers_;
+        }
+
     private:
 
         static constexpr std::uint32_t invalidViewIndex = 0xFFFF;
@@ -104,6 +120,17 @@ class VKResourceHeap final : public ResourceHeap
 
     private:
 
+        // Fills the descriptor writes for the specified resource views. Returns false if any write targets a binding without update-after-bind.
+        bool FillWriteDescriptors(
+            VkDevice                                    device,
+            std::uint32_t                               firstDescriptor,
+            const ArrayView<ResourceViewDescriptor>&    resourceViews,
+            VKDescriptorSetWriter&                      setWriter
+        );
+
+        // Submits all descriptor writes and waits for the device to be idle unless all writes are update-after-bind.
+        std::uint32_t FlushWriteDescriptors(VkDevice device, VKDescriptorSetWriter& setWriter, bool isAllUpdateAfterBind);
+
         void ConvertAllLayoutBindings(const ArrayView<VKLayoutBinding>& layoutBindings);
         void ConvertLayoutBinding(VKLayoutHeapBinding& dst, const VKLayoutBinding& src);
 
@@ -173,6 +200,10 @@ class VKResourceHeap final : public ResourceHeap
         SmallVector<std::uint32_t, 2>       barrierSlots_;
         std::vector<VKBarrierResource>      barrierResources_;
 
+        std::vector<VKBuffer*>              mappedBuffers_;
+
+        ResourceHeapUpdateBatch             updateBatch_;
+
 };
 
 
@@ -19,6 +19,7 @@
 #include <LLGL/Utils/ForRange.h>
 #include <string.h>
 #include <algorithm>
+#include <atomic>
 #include <set>
 
 #if LLGL_VK_ENABLE_SPIRV_REFLECT
@@ -30,6 +31,8 @@ namespace LLGL
 {
 
 
+static std::atomic<std::uint64_t> g_VKShaderUniqueIDCounter{ 0 };
+
 static VKPtr<VkShaderModule> CreateVkShaderModule(VkDevice device, const std::vector<std::uint32_t>& shaderCode)
 {
     VkShaderModuleCreateInfo createInfo;
@@ -41,14 +44,15 @@ static VKPtr<VkShaderModule> CreateVkShaderModule(VkDevice device, const std::ve
         createInfo.pCode    = shaderCode.data();
     }
     VKPtr<VkShaderModule> shaderModule{ device, vkDestroyShaderModule };
-    VkResult result = vkCreateShaderModule(device, &createInfo, nullptr, shaderModule.ReleaseAndGetAddressOf());
+    VkResult result = vkCreateShaderModule(device, &createInfo, VKGetAllocationCallbacks(), shaderModule.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan shader module");
     return shaderModule;
 }
 
 VKShader::VKShader(VkDevice device, const ShaderDescriptor& desc) :
-    Shader  { desc.type },
-    device_ { device    }
+    Shader    { desc.type                   },
+    device_   { device                      },
+    uniqueID_ { ++g_VKShaderUniqueIDCounter }
 {
     BuildShader(desc);
     BuildInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
@@ -78,6 +78,15 @@ class VKShader final : public Shader
         */
         VKPtr<VkShaderModule> CreateVkShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc);
 
+        /*
+        Returns the unique ID of this shader. IDs are never reused, even after a shader has been released,
+        so they can identify a shader in cache keys that outlive the shader itself (unlike its VkShaderModule handle).
+        */
+        inline std::uint64_t GetUniqueID() const
+        {
+            return uniqueID_;
+        }
+
         // Returns the Vulkan shader module.
         inline const VKPtr<VkShaderModule>& GetShaderModule() const
         {
@@ -129,6 +138,7 @@ class VKShader final : public Shader
     private:
 
         VkDevice                device_             = VK_NULL_HANDLE;
+        std::uint64_t           uniqueID_           = 0;
 
         VKPtr<VkShaderModule>   shaderModule_;
         VKShaderCode            shaderCode_;
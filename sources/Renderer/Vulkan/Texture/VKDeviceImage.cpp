@@ -82,6 +82,11 @@ void VKDeviceImage::BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memo
     }
 }
 
+void VKDeviceImage::QueryMemoryRequirements(VkDevice device)
+{
+    vkGetImageMemoryRequirements(device, image_, &memoryRequirements_);
+}
+
 void VKDeviceImage::CreateVkImage(
     VkDevice                device,
     VkImageType             imageType,
@@ -112,7 +117,7 @@ void VKDeviceImage::CreateVkImage(
         createInfo.pQueueFamilyIndices      = nullptr;
         createInfo.initialLayout            = VK_IMAGE_LAYOUT_UNDEFINED; // must be UNDEFINED or PREINITIALIZED
     }
-    VkResult result = vkCreateImage(device, &createInfo, nullptr, image_.ReleaseAndGetAddressOf());
+    VkResult result = vkCreateImage(device, &createInfo, VKGetAllocationCallbacks(), image_.ReleaseAndGetAddressOf());
     VKThrowIfCreateFailed(result, "VkImage");
 }
 
@@ -150,7 +155,7 @@ void VKDeviceImage::CreateVkImageView(
         else
             createInfo.components = *components;
     }
-    VkResult result = vkCreateImageView(device, &createInfo, nullptr, outImageView.ReleaseAndGetAddressOf());
+    VkResult result = vkCreateImageView(device, &createInfo, VKGetAllocationCallbacks(), outImageView.ReleaseAndGetAddressOf());
     VKThrowIfCreateFailed(result, "VkImageView");
 }
 
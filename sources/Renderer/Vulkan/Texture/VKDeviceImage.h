@@ -46,6 +46,9 @@ class VKDeviceImage
 
         void BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion);
 
+        // Queries the memory requirements without allocating memory, e.g. for images that are placed inside a memory heap.
+        void QueryMemoryRequirements(VkDevice device);
+
         void CreateVkImage(
             VkDevice                device,
             VkImageType             imageType,
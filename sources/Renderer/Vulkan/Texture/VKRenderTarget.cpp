@@ -10,6 +10,7 @@
 #include "../Command/VKCommandContext.h"
 #include "../Ext/VKExtensionRegistry.h"
 #include "../Memory/VKDeviceMemoryManager.h"
+#include "../RenderState/VKFramebufferCache.h"
 #include "../../CheckedCast.h"
 #include "../../RenderTargetUtils.h"
 #include "../../../Core/CoreUtils.h"
@@ -31,7 +32,6 @@ VKRenderTarget::VKRenderTarget(
     const RenderTargetDescriptor&   desc)
 :
     resolution_          { desc.resolution                            },
-    framebuffer_         { device, vkDestroyFramebuffer               },
     defaultRenderPass_   { device                                     },
     secondaryRenderPass_ { device                                     },
     depthStencilBuffer_  { device                                     },
@@ -53,6 +53,17 @@ VKRenderTarget::VKRenderTarget(
     CreateFramebuffer(device, deviceMemoryMngr, desc);
 }
 
+VKRenderTarget::~VKRenderTarget()
+{
+    /* Return framebuffer to cache, but invalidate it if it refers to internal buffers that are destroyed with this render target */
+    VKFramebufferCache& framebufferCache = VKFramebufferCache::Get();
+    framebufferCache.ReleaseFramebuffer(framebuffer_);
+    for (const VKColorBufferPtr& colorBuffer : colorBuffers_)
+        framebufferCache.InvalidateImageView(colorBuffer->GetVkImageView());
+    if (depthStencilBuffer_.GetVkImageView() != VK_NULL_HANDLE)
+        framebufferCache.InvalidateImageView(depthStencilBuffer_.GetVkImageView());
+}
+
 Extent2D VKRenderTarget::GetResolution() const
 {
     return resolution_;
@@ -209,7 +220,7 @@ void VKRenderTarget::CreateSecondaryRenderPass(VkDevice device, const RenderTarg
     CreateRenderPass(device, desc, secondaryRenderPass_, VK_ATTACHMENT_LOAD_OP_LOAD);
 }
 
-VkImageView VKRenderTarget::CreateAttachmentImageView(
+VkImageView VKRenderTarget::GetAttachmentImageView(
     VkDevice                    device,
     VKTexture*                  textureVK,
     Format                      format,
@@ -218,15 +229,11 @@ VkImageView VKRenderTarget::CreateAttachmentImageView(
     /* Validate texture resolution to render target (to validate correlation between attachments) */
     ValidateMipResolution(*textureVK, attachmentDesc.mipLevel);
 
-    /* Create new image view for MIP-level and array layer specified in attachment descriptor */
+    /* Get image view for MIP-level and array layer specified in attachment descriptor; it's shared with other render targets of the same texture */
     const VkImageLayout renderPassImageLayout = (IsDepthOrStencilFormat(format) ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL : VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
-    VKPtr<VkImageView> imageView{ device, vkDestroyImageView };
-    {
-        textureVK->CreateImageView(device, TextureSubresource{ attachmentDesc.arrayLayer, attachmentDesc.mipLevel }, format, imageView);
-    }
-    attachmentViews_.emplace_back(textureVK, renderPassImageLayout, std::move(imageView));
+    attachmentViews_.push_back(AttachmentView{ textureVK, renderPassImageLayout });
 
-    return attachmentViews_.back().imageView.Get();
+    return textureVK->GetOrCreateAttachmentView(device, attachmentDesc.mipLevel, attachmentDesc.arrayLayer, format);
 }
 
 VkImageView VKRenderTarget::CreateColorBuffer(VKDeviceMemoryManager& deviceMemoryMngr, Format format)
@@ -272,7 +279,7 @@ void VKRenderTarget::CreateFramebuffer(
             /* Use attachment texture for color buffer view */
             auto* textureVK = LLGL_CAST(VKTexture*, texture);
             const Format colorFormat = GetAttachmentFormat(colorAttachment);
-            attachmentImageViews[i] = CreateAttachmentImageView(device, textureVK, colorFormat, colorAttachment);
+            attachmentImageViews[i] = GetAttachmentImageView(device, textureVK, colorFormat, colorAttachment);
         }
         else
         {
@@ -290,7 +297,7 @@ void VKRenderTarget::CreateFramebuffer(
         {
             /* Use attachment texture for depth-stencil view */
             auto* textureVK = LLGL_CAST(VKTexture*, texture);
-            attachmentImageViews[numColorAttachments_] = CreateAttachmentImageView(device, textureVK, depthStencilFormat_, depthStencilAttachment);
+            attachmentImageViews[numColorAttachments_] = GetAttachmentImageView(device, textureVK, depthStencilFormat_, depthStencilAttachment);
         }
         else
         {
@@ -312,7 +319,7 @@ void VKRenderTarget::CreateFramebuffer(
                 /* Use attachment texture for color buffer view */
                 auto* textureVK = LLGL_CAST(VKTexture*, texture);
                 const Format colorFormat = GetAttachmentFormat(resolveAttachment);
-                attachmentImageViews[attachmentCount++] = CreateAttachmentImageView(device, textureVK, colorFormat, resolveAttachment);
+                attachmentImageViews[attachmentCount++] = GetAttachmentImageView(device, textureVK, colorFormat, resolveAttachment);
             }
         }
     }
@@ -331,7 +338,7 @@ void VKRenderTarget::CreateFramebuffer(
 
     #endif // /VK_KHR_imageless_framebuffer
 
-    /* Create framebuffer object */
+    /* Acquire framebuffer object from cache, or create a new one */
     const Extent2D resolution = GetResolution();
     VkFramebufferCreateInfo createInfo;
     {
@@ -365,8 +372,7 @@ void VKRenderTarget::CreateFramebuffer(
         createInfo.height           = resolution.height;
         createInfo.layers           = 1;
     }
-    VkResult result = vkCreateFramebuffer(device, &createInfo, nullptr, framebuffer_.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan framebuffer");
+    framebuffer_ = VKFramebufferCache::Get().AcquireFramebuffer(device, createInfo);
 }
 
 
@@ -40,6 +40,8 @@ class VKRenderTarget final : public RenderTarget
             const RenderTargetDescriptor&   desc
         );
 
+        ~VKRenderTarget();
+
     public:
 
         // Returns true if this render target has multi-sampling enabled.
@@ -84,7 +86,7 @@ class VKRenderTarget final : public RenderTarget
         void CreateDefaultRenderPass(VkDevice device, const RenderTargetDescriptor& desc);
         void CreateSecondaryRenderPass(VkDevice device, const RenderTargetDescriptor& desc);
 
-        VkImageView CreateAttachmentImageView(
+        VkImageView GetAttachmentImageView(
             VkDevice                    device,
             VKTexture*                  textureVK,
             Format                      format,
@@ -102,33 +104,11 @@ class VKRenderTarget final : public RenderTarget
 
     private:
 
+        // Attachment texture and its image layout within the render pass. The image view itself is owned by the texture.
         struct AttachmentView
         {
-            inline AttachmentView(VkDevice device) :
-                imageView { device, vkDestroyImageView }
-            {
-            }
-
-            inline AttachmentView(AttachmentView&& rhs) noexcept :
-                texture   { rhs.texture              },
-                layout    { rhs.layout               },
-                imageView { std::move(rhs.imageView) }
-            {
-            }
-
-            inline AttachmentView(VKTexture* texture, VkImageLayout layout, VKPtr<VkImageView>&& imageView) :
-                texture   { texture              },
-                layout    { layout               },
-                imageView { std::move(imageView) }
-            {
-            }
-
-            AttachmentView(const AttachmentView&) = delete;
-            AttachmentView& operator = (const AttachmentView&) = delete;
-
             VKTexture*          texture     = nullptr;
             VkImageLayout       layout      = VK_IMAGE_LAYOUT_UNDEFINED;
-            VKPtr<VkImageView>  imageView;
         };
 
     private:
@@ -137,7 +117,7 @@ class VKRenderTarget final : public RenderTarget
 
         Extent2D                        resolution_;
 
-        VKPtr<VkFramebuffer>            framebuffer_;
+        VkFramebuffer                   framebuffer_            = VK_NULL_HANDLE;  // Shared by VKFramebufferCache
         const VKRenderPass*             renderPass_             = nullptr;
         VKRenderPass                    defaultRenderPass_;
         VKRenderPass                    secondaryRenderPass_;
@@ -105,7 +105,7 @@ VKPtr<VkSampler> VKSampler::CreateVkSampler(VkDevice device, const SamplerDescri
     {
         VkSamplerCreateInfo createInfo;
         VKSampler::ConvertDesc(createInfo, desc);
-        VkResult result = vkCreateSampler(device, &createInfo, nullptr, sampler.ReleaseAndGetAddressOf());
+        VkResult result = vkCreateSampler(device, &createInfo, VKGetAllocationCallbacks(), sampler.ReleaseAndGetAddressOf());
         VKThrowIfFailed(result, "failed to create Vulkan sampler");
     }
     return sampler;
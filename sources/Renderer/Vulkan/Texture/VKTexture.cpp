@@ -9,6 +9,7 @@
 #include "VKImageUtils.h"
 #include "../Memory/VKDeviceMemory.h"
 #include "../Command/VKCommandContext.h"
+#include "../RenderState/VKFramebufferCache.h"
 #include "../../TextureUtils.h"
 #include "../../../Core/CoreUtils.h"
 #include <LLGL/Backend/Vulkan/NativeHandle.h>
@@ -49,6 +50,28 @@ VKTexture::VKTexture(
         SetDebugName(desc.debugName);
 }
 
+VKTexture::VKTexture(VkDevice device, const TextureDescriptor& desc) :
+    Texture        { desc.type, desc.bindFlags         },
+    device_        { device                            },
+    image_         { device                            },
+    imageView_     { device, vkDestroyImageView        },
+    format_        { VKTypes::Map(desc.format)         },
+    swizzleFormat_ { MapToVKSwizzleFormat(desc.format) }
+{
+    /* Create Vulkan image and only query its memory requirements */
+    CreateImage(device, desc);
+    image_.QueryMemoryRequirements(device);
+    if (desc.debugName != nullptr)
+        SetDebugName(desc.debugName);
+}
+
+VKTexture::~VKTexture()
+{
+    /* Framebuffers must not be reused once their attachment views have been destroyed */
+    for (const AttachmentView& attachmentView : attachmentViews_)
+        VKFramebufferCache::Get().InvalidateImageView(attachmentView.imageView.Get());
+}
+
 bool VKTexture::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
 {
     if (auto* nativeHandleVK = GetTypedNativeHandle<Vulkan::ResourceNativeHandle>(nativeHandle, nativeHandleSize))
@@ -67,6 +90,11 @@ bool VKTexture::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize
     return false;
 }
 
+void VKTexture::BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion)
+{
+    image_.BindMemoryRegion(device, memoryRegion);
+}
+
 Extent3D VKTexture::GetMipExtent(std::uint32_t mipLevel) const
 {
     switch (GetType())
@@ -264,6 +292,22 @@ void VKTexture::CreateImageView(
     );
 }
 
+VkImageView VKTexture::GetOrCreateAttachmentView(VkDevice device, std::uint32_t mipLevel, std::uint32_t arrayLayer, Format format)
+{
+    /* Find cached image view for this attachment */
+    for (const AttachmentView& attachmentView : attachmentViews_)
+    {
+        if (attachmentView.mipLevel == mipLevel && attachmentView.arrayLayer == arrayLayer && attachmentView.format == format)
+            return attachmentView.imageView.Get();
+    }
+
+    /* Create new image view for MIP-level and array layer */
+    VKPtr<VkImageView> imageView{ device, vkDestroyImageView };
+    CreateImageView(device, TextureSubresource{ arrayLayer, mipLevel }, format, imageView);
+    attachmentViews_.push_back(AttachmentView{ mipLevel, arrayLayer, format, std::move(imageView) });
+    return attachmentViews_.back().imageView.Get();
+}
+
 static bool UsageFlagsAllowImageViews(VkImageUsageFlags flags)
 {
     /* Vulkan only alows image views on images that were created with these usage flags */
@@ -14,6 +14,7 @@
 #include "../Vulkan.h"
 #include "../VKPtr.h"
 #include <cstdint>
+#include <vector>
 
 
 namespace LLGL
@@ -46,12 +47,20 @@ class VKTexture final : public Texture
             const TextureDescriptor&    desc
         );
 
+        // Creates the Vulkan image without memory. The memory must be bound with BindMemoryRegion before the texture is used.
+        VKTexture(VkDevice device, const TextureDescriptor& desc);
+
+        ~VKTexture();
+
     public:
 
         void SetDebugName(const char* name) override;
 
     public:
 
+        // Binds the image of a texture that was created without memory to the specified region.
+        void BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion);
+
         // Creates an additional texture view of the specified texture range and uses the same format as this texture object.
         void CreateImageView(
             VkDevice                    device,
@@ -67,6 +76,12 @@ class VKTexture final : public Texture
             VKPtr<VkImageView>&             outImageView
         );
 
+        /*
+        Returns an image view of a single MIP-level and array layer to be used as framebuffer attachment.
+        These image views are cached within this texture, so framebuffers with the same attachments can be shared between render targets.
+        */
+        VkImageView GetOrCreateAttachmentView(VkDevice device, std::uint32_t mipLevel, std::uint32_t arrayLayer, Format format);
+
         // Creates the primary image view that is stored within this texture object.
         // If this texture was not created with a valid image view usage flag,
         // this function call has no effect and GetVkImageView() returns a null handle.
@@ -147,6 +162,12 @@ class VKTexture final : public Texture
             return image_.GetMemoryRegion();
         }
 
+        // Returns the Vulkan memory requirements for this texture.
+        inline const VkMemoryRequirements& GetMemoryRequirements() const
+        {
+            return image_.GetMemoryRequirements();
+        }
+
         // Overrides the image layout. This is not called a setter to indicate that this should only be called
         // by classes that need to override this value, such as VKRenderTarget.
         inline void OverrideVkImageLayout(VkImageLayout layout)
@@ -154,6 +175,16 @@ class VKTexture final : public Texture
             image_.OverrideVkImageLayout(layout);
         }
 
+    private:
+
+        struct AttachmentView
+        {
+            std::uint32_t       mipLevel;
+            std::uint32_t       arrayLayer;
+            Format              format;
+            VKPtr<VkImageView>  imageView;
+        };
+
     private:
 
         void CreateImage(VkDevice device, const TextureDescriptor& desc);
@@ -172,6 +203,8 @@ class VKTexture final : public Texture
         VkImageUsageFlags       usageFlags_         = 0;
         const VKSwizzleFormat   swizzleFormat_      = VKSwizzleFormat::RGBA;
 
+        std::vector<AttachmentView> attachmentViews_;
+
 };
 
 
@@ -334,14 +334,25 @@ VkFormat VKFindSupportedImageFormat(VkPhysicalDevice device, const VkFormat* can
     LLGL_TRAP("failed to find suitable image format");
 }
 
-std::uint32_t VKFindMemoryType(const VkPhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties)
+bool VKTryFindMemoryType(const VkPhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties, std::uint32_t& outMemoryTypeIndex)
 {
     for_range(i, memoryProperties.memoryTypeCount)
     {
         if ((memoryTypeBits & (1 << i)) != 0 && (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties)
-            return i;
+        {
+            outMemoryTypeIndex = i;
+            return true;
+        }
     }
-    LLGL_TRAP("failed to find suitable Vulkan memory type");
+    return false;
+}
+
+std::uint32_t VKFindMemoryType(const VkPhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties)
+{
+    std::uint32_t memoryTypeIndex = 0;
+    if (!VKTryFindMemoryType(memoryProperties, memoryTypeBits, properties, memoryTypeIndex))
+        LLGL_TRAP("failed to find suitable Vulkan memory type");
+    return memoryTypeIndex;
 }
 
 
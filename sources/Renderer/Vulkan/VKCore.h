@@ -98,6 +98,9 @@ VKSurfaceSupportDetails VKQuerySurfaceSupport(VkPhysicalDevice device, VkSurface
 VKQueueFamilyIndices VKFindQueueFamilies(VkPhysicalDevice device, const VkQueueFlags flags, VkSurfaceKHR* surface = nullptr);
 VkFormat VKFindSupportedImageFormat(VkPhysicalDevice device, const VkFormat* candidates, std::size_t numCandidates, VkImageTiling tiling, VkFormatFeatureFlags features);
 
+// Finds the memory type index that supports the specified type bits and properties. Returns false if there is no such memory type.
+bool VKTryFindMemoryType(const VkPhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties, std::uint32_t& outMemoryTypeIndex);
+
 // Returns the memory type index that supports the specified type bits and properties, or traps program execution on failure.
 std::uint32_t VKFindMemoryType(const VkPhysicalDeviceMemoryProperties& memoryProperties, std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties);
 
@@ -109,7 +109,7 @@ void VKDevice::CreateLogicalDevice(
             createInfo.pEnabledFeatures     = &(features->features);
         }
     }
-    VkResult result = vkCreateDevice(physicalDevice, &createInfo, nullptr, device_.ReleaseAndGetAddressOf());
+    VkResult result = vkCreateDevice(physicalDevice, &createInfo, VKGetAllocationCallbacks(), device_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan logical device");
 
     /* Query device graphics queue */
@@ -146,7 +146,7 @@ VKPtr<VkCommandPool> VKDevice::CreateCommandPool()
         createInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
         createInfo.queueFamilyIndex = queueFamilyIndices_.graphicsFamily;
     }
-    VkResult result = vkCreateCommandPool(device_, &createInfo, nullptr, commandPool.ReleaseAndGetAddressOf());
+    VkResult result = vkCreateCommandPool(device_, &createInfo, VKGetAllocationCallbacks(), commandPool.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan command pool");
 
     return commandPool;
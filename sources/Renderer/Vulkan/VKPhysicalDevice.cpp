@@ -13,6 +13,7 @@
 #include "../../Core/Vendor.h"
 #include "../../Core/Assertion.h"
 #include <LLGL/Constants.h>
+#include <LLGL/Utils/ForRange.h>
 #include <string>
 #include <cstring>
 #include <set>
@@ -310,6 +311,7 @@ void VKPhysicalDevice::QueryRenderingCaps(RenderingCapabilities& caps)
     caps.features.hasPipelineStatistics             = (features.pipelineStatisticsQuery != VK_FALSE);
     caps.features.hasRenderCondition                = SupportsExtension(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME);
     caps.features.hasPipelineCaching                = true;
+    caps.features.hasPlacedResources                = true;
 
     /* Query limits */
     caps.limits.lineWidthRange[0]                   = limits.lineWidthRange[0];
@@ -343,6 +345,21 @@ void VKPhysicalDevice::QueryRenderingCaps(RenderingCapabilities& caps)
     caps.limits.maxStencilBufferSamples             = VKTypes::GetMaxVkSampleCounts(limits.framebufferStencilSampleCounts);
     caps.limits.maxNoAttachmentSamples              = VKTypes::GetMaxVkSampleCounts(limits.framebufferNoAttachmentsSampleCounts);
     caps.limits.storageResourceStageFlags           = StageFlags::AllStages;
+
+    #if VK_EXT_descriptor_indexing
+    if (SupportsDescriptorIndexing())
+    {
+        /* Use the smallest per-stage update-after-bind limit, since a descriptor indexed heap binding can be of any resource type */
+        caps.features.hasDescriptorIndexing             = true;
+        caps.limits.maxDescriptorIndexingArraySize      = std::min({
+            descriptorIndexingProps_.maxPerStageDescriptorUpdateAfterBindSamplers,
+            descriptorIndexingProps_.maxPerStageDescriptorUpdateAfterBindUniformBuffers,
+            descriptorIndexingProps_.maxPerStageDescriptorUpdateAfterBindStorageBuffers,
+            descriptorIndexingProps_.maxPerStageDescriptorUpdateAfterBindSampledImages,
+            descriptorIndexingProps_.maxPerStageDescriptorUpdateAfterBindStorageImages,
+        });
+    }
+    #endif
 }
 
 void VKPhysicalDevice::QueryPipelineLimits(VKGraphicsPipelineLimits& pipelineLimits)
@@ -390,6 +407,116 @@ bool VKPhysicalDevice::SupportsExtension(const char* extension) const
     return (it != supportedExtensionNames_.end());
 }
 
+bool VKPhysicalDevice::SupportsDescriptorIndexing() const
+{
+    #if VK_EXT_descriptor_indexing
+    return
+    (
+        descriptorIndexingFeatures_.runtimeDescriptorArray                          != VK_FALSE &&
+        descriptorIndexingFeatures_.descriptorBindingPartiallyBound                 != VK_FALSE &&
+        descriptorIndexingFeatures_.descriptorBindingUpdateUnusedWhilePending       != VK_FALSE &&
+        descriptorIndexingFeatures_.descriptorBindingSampledImageUpdateAfterBind    != VK_FALSE &&
+        descriptorIndexingFeatures_.descriptorBindingStorageImageUpdateAfterBind    != VK_FALSE &&
+        descriptorIndexingFeatures_.descriptorBindingStorageBufferUpdateAfterBind   != VK_FALSE
+    );
+    #else
+    return false;
+    #endif
+}
+
+bool VKPhysicalDevice::SupportsUpdateAfterBind(VkDescriptorType descriptorType) const
+{
+    #if VK_EXT_descriptor_indexing
+    switch (descriptorType)
+    {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            return (descriptorIndexingFeatures_.descriptorBindingSampledImageUpdateAfterBind != VK_FALSE);
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            return (descriptorIndexingFeatures_.descriptorBindingStorageImageUpdateAfterBind != VK_FALSE);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            return (descriptorIndexingFeatures_.descriptorBindingUniformTexelBufferUpdateAfterBind != VK_FALSE);
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            return (descriptorIndexingFeatures_.descriptorBindingStorageTexelBufferUpdateAfterBind != VK_FALSE);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            return (descriptorIndexingFeatures_.descriptorBindingUniformBufferUpdateAfterBind != VK_FALSE);
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            return (descriptorIndexingFeatures_.descriptorBindingStorageBufferUpdateAfterBind != VK_FALSE);
+        default:
+            return false;
+    }
+    #else
+    return false;
+    #endif
+}
+
+bool VKPhysicalDevice::SupportsTimelineSemaphore() const
+{
+    #if VK_KHR_timeline_semaphore
+    return (timelineSemaphoreFeatures_.timelineSemaphore != VK_FALSE);
+    #else
+    return false;
+    #endif
+}
+
+bool VKPhysicalDevice::SupportsExtendedDynamicState() const
+{
+    #if VK_EXT_extended_dynamic_state
+    return (extDynamicStateFeatures_.extendedDynamicState != VK_FALSE);
+    #else
+    return false;
+    #endif
+}
+
+bool VKPhysicalDevice::SupportsExtendedDynamicState2() const
+{
+    #if VK_EXT_extended_dynamic_state2
+    return (extDynamicState2Features_.extendedDynamicState2 != VK_FALSE);
+    #else
+    return false;
+    #endif
+}
+
+bool VKPhysicalDevice::SupportsGraphicsPipelineLibrary() const
+{
+    #if VK_EXT_graphics_pipeline_library
+    return
+    (
+        pipelineLibraryFeatures_.graphicsPipelineLibrary            != VK_FALSE &&
+        pipelineLibraryProps_.graphicsPipelineLibraryFastLinking    != VK_FALSE
+    );
+    #else
+    return false;
+    #endif
+}
+
+bool VKPhysicalDevice::QueryMemoryBudget(VkDeviceSize* outHeapBudgets, VkDeviceSize* outHeapUsages) const
+{
+    #if VK_EXT_memory_budget
+    if (HasExtension(VKExt::EXT_memory_budget))
+    {
+        VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProps = {};
+        budgetProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+        VkPhysicalDeviceMemoryProperties2 memoryProps = {};
+        {
+            memoryProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+            memoryProps.pNext = &budgetProps;
+        }
+        vkGetPhysicalDeviceMemoryProperties2(physicalDevice_, &memoryProps);
+
+        for_range(i, memoryProps.memoryProperties.memoryHeapCount)
+        {
+            outHeapBudgets[i]   = budgetProps.heapBudget[i];
+            outHeapUsages[i]    = budgetProps.heapUsage[i];
+        }
+        return true;
+    }
+    #endif
+    return false;
+}
+
 
 /*
  * ======= Private: =======
@@ -466,6 +593,31 @@ void VKPhysicalDevice::QueryDeviceFeatures()
         AppendFeaturesDesc(&imagelessFramebufferFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES_KHR);
     #endif
 
+    #if VK_EXT_descriptor_indexing
+    if (SupportsExtension(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME))
+        AppendFeaturesDesc(&descriptorIndexingFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT);
+    #endif
+
+    #if VK_KHR_timeline_semaphore
+    if (SupportsExtension(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME))
+        AppendFeaturesDesc(&timelineSemaphoreFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR);
+    #endif
+
+    #if VK_EXT_extended_dynamic_state
+    if (SupportsExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME))
+        AppendFeaturesDesc(&extDynamicStateFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT);
+    #endif
+
+    #if VK_EXT_extended_dynamic_state2
+    if (SupportsExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME))
+        AppendFeaturesDesc(&extDynamicState2Features_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT);
+    #endif
+
+    #if VK_EXT_graphics_pipeline_library
+    if (SupportsExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME) && SupportsExtension(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME))
+        AppendFeaturesDesc(&pipelineLibraryFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT);
+    #endif
+
     vkGetPhysicalDeviceFeatures2(physicalDevice_, &features_);
 
     #else // VK_KHR_get_physical_device_properties2
@@ -508,6 +660,16 @@ void VKPhysicalDevice::QueryDeviceProperties()
         ChainDescriptor(&transformFeedbackProps_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT);
     #endif
 
+    #if VK_EXT_descriptor_indexing
+    if (SupportsExtension(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME))
+        ChainDescriptor(&descriptorIndexingProps_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT);
+    #endif
+
+    #if VK_EXT_graphics_pipeline_library
+    if (SupportsExtension(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME))
+        ChainDescriptor(&pipelineLibraryProps_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT);
+    #endif
+
     /* Query device properties with extension "VK_KHR_get_physical_device_properties2" */
     vkGetPhysicalDeviceProperties2(physicalDevice_, &propertiesExt);
 
@@ -80,6 +80,30 @@ class VKPhysicalDevice
             return memoryProperties_;
         }
 
+        // Returns true if descriptor indexing with partially bound and update-after-bind descriptors is supported.
+        bool SupportsDescriptorIndexing() const;
+
+        // Returns true if descriptors of the specified type can be updated after they have been bound (VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT).
+        bool SupportsUpdateAfterBind(VkDescriptorType descriptorType) const;
+
+        // Returns true if timeline semaphores are supported, i.e. semaphores with a monotonically increasing 64-bit counter.
+        bool SupportsTimelineSemaphore() const;
+
+        // Returns true if the cull mode, front face, primitive topology, and depth-stencil states can be dynamic (VK_EXT_extended_dynamic_state).
+        bool SupportsExtendedDynamicState() const;
+
+        // Returns true if the primitive restart, rasterizer discard, and depth bias enable states can be dynamic (VK_EXT_extended_dynamic_state2).
+        bool SupportsExtendedDynamicState2() const;
+
+        // Returns true if graphics pipelines can be linked from pipeline libraries without link-time optimization (VK_EXT_graphics_pipeline_library).
+        bool SupportsGraphicsPipelineLibrary() const;
+
+        /*
+        Queries the current budget and usage (in bytes) of each memory heap with VK_EXT_memory_budget.
+        Both output arrays must have at least VK_MAX_MEMORY_HEAPS elements. Returns false if the extension is not supported.
+        */
+        bool QueryMemoryBudget(VkDeviceSize* outHeapBudgets, VkDeviceSize* outHeapUsages) const;
+
         // Returns the list of names of all supported and enabled extensions.
         inline const std::vector<const char*>& GetExtensionNames() const
         {
@@ -135,6 +159,28 @@ class VKPhysicalDevice
         VkPhysicalDeviceImagelessFramebufferFeaturesKHR         imagelessFramebufferFeatures_   = {};
         #endif
 
+        #if VK_EXT_descriptor_indexing
+        VkPhysicalDeviceDescriptorIndexingPropertiesEXT         descriptorIndexingProps_        = {};
+        VkPhysicalDeviceDescriptorIndexingFeaturesEXT           descriptorIndexingFeatures_     = {};
+        #endif
+
+        #if VK_KHR_timeline_semaphore
+        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR            timelineSemaphoreFeatures_      = {};
+        #endif
+
+        #if VK_EXT_extended_dynamic_state
+        VkPhysicalDeviceExtendedDynamicStateFeaturesEXT         extDynamicStateFeatures_        = {};
+        #endif
+
+        #if VK_EXT_extended_dynamic_state2
+        VkPhysicalDeviceExtendedDynamicState2FeaturesEXT        extDynamicState2Features_       = {};
+        #endif
+
+        #if VK_EXT_graphics_pipeline_library
+        VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT    pipelineLibraryProps_           = {};
+        VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT      pipelineLibraryFeatures_        = {};
+        #endif
+
 };
 
 
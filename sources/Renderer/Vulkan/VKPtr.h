@@ -9,6 +9,7 @@
 #define LLGL_VK_PTR_H
 
 
+#include "Memory/VKAllocationCallbacks.h"
 #include <functional>
 #include <vulkan/vulkan.h>
 
@@ -29,44 +30,44 @@ class VKPtr
 
         // Default constructor with dummy deleter.
         VKPtr() :
-            VKPtr { [](T, VkAllocationCallbacks*) {} }
+            VKPtr { [](T, const VkAllocationCallbacks*) {} }
         {
         }
 
         // Constructs a default VKPtr object when initialized with a VK_NULL_HANDLE.
         VKPtr(std::nullptr_t) :
-            VKPtr { [](T, VkAllocationCallbacks*) {} }
+            VKPtr { [](T, const VkAllocationCallbacks*) {} }
         {
         }
 
         // Constructs the handler with the specified deleter function.
-        VKPtr(const std::function<void(T, VkAllocationCallbacks*)>& deleter)
+        VKPtr(const std::function<void(T, const VkAllocationCallbacks*)>& deleter)
         {
             deleter_ = [=](T obj)
             {
-                deleter(obj, nullptr);
+                deleter(obj, VKGetAllocationCallbacks());
             };
         }
 
         // Constructs the handler with the specified deleter function and the Vulkan instance.
         VKPtr(
-            VkInstance                                                          instance,
-            const std::function<void(VkInstance, T, VkAllocationCallbacks*)>&   deleter)
+            VkInstance                                                                  instance,
+            const std::function<void(VkInstance, T, const VkAllocationCallbacks*)>&     deleter)
         {
             deleter_ = [instance, deleter](T obj)
             {
-                deleter(instance, obj, nullptr);
+                deleter(instance, obj, VKGetAllocationCallbacks());
             };
         }
 
         // Constructs the handler with the specified deleter function and the Vulkan device.
         VKPtr(
-            VkDevice                                                        device,
-            const std::function<void(VkDevice, T, VkAllocationCallbacks*)>& deleter)
+            VkDevice                                                                device,
+            const std::function<void(VkDevice, T, const VkAllocationCallbacks*)>&   deleter)
         {
             deleter_ = [device, deleter](T obj)
             {
-                deleter(device, obj, nullptr);
+                deleter(device, obj, VKGetAllocationCallbacks());
             };
         }
 
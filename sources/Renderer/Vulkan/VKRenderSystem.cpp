@@ -22,12 +22,19 @@
 #include "VKTypes.h"
 #include "VKInitializers.h"
 #include "RenderState/VKPredicateQueryHeap.h"
+#include "RenderState/VKHostQueryHeap.h"
 #include "RenderState/VKComputePSO.h"
 #include "RenderState/VKPipelineLayoutPermutationPool.h"
+#include "RenderState/VKRenderPassCache.h"
+#include "RenderState/VKFramebufferCache.h"
+#include "RenderState/VKPipelineLibraryCache.h"
 #include "Shader/VKShaderModulePool.h"
 #include "../../Platform/Debug.h"
 #include <LLGL/ImageFlags.h>
+#include <LLGL/RenderingDebugger.h>
+#include <LLGL/Utils/ForRange.h>
 #include <limits>
+#include <string.h>
 
 #include <LLGL/Backend/Vulkan/NativeHandle.h>
 
@@ -50,7 +57,8 @@ static bool IsDebugBreakOnErrorEnabled(long flags)
 VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
     instance_              { vkDestroyInstance                                        },
     isDebugLayerEnabled_   { LLGL::IsDebugLayerEnabled(renderSystemDesc.flags)        },
-    isBreakOnErrorEnabled_ { LLGL::IsDebugBreakOnErrorEnabled(renderSystemDesc.flags) }
+    isBreakOnErrorEnabled_ { LLGL::IsDebugBreakOnErrorEnabled(renderSystemDesc.flags) },
+    debugger_              { renderSystemDesc.debugger                                }
 {
     /* Extract optional renderer configuartion */
     auto* rendererConfigVK = GetRendererConfiguration<RendererConfigurationVulkan>(renderSystemDesc);
@@ -83,6 +91,30 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         CreateLogicalDevice();
     }
 
+    /* Select optional graphics pipeline features; each one is only used if the device supports it */
+    if (rendererConfigVK != nullptr)
+    {
+        graphicsPipelineOptions_.dynamicState =
+        (
+            rendererConfigVK->enableDynamicPipelineState &&
+            physicalDevice_.SupportsExtendedDynamicState() &&
+            HasExtension(VKExt::EXT_extended_dynamic_state)
+        );
+        graphicsPipelineOptions_.dynamicState2 =
+        (
+            graphicsPipelineOptions_.dynamicState &&
+            physicalDevice_.SupportsExtendedDynamicState2() &&
+            HasExtension(VKExt::EXT_extended_dynamic_state2)
+        );
+        graphicsPipelineOptions_.pipelineLibraries =
+        (
+            rendererConfigVK->enablePipelineLibraries &&
+            physicalDevice_.SupportsGraphicsPipelineLibrary() &&
+            HasExtension(VKExt::EXT_graphics_pipeline_library) &&
+            HasExtension(VKExt::KHR_pipeline_library)
+        );
+    }
+
     /* Create default resources */
     VKPipelineLayout::CreateDefault(device_);
 
@@ -93,27 +125,84 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         (rendererConfigVK != nullptr ? rendererConfigVK->minDeviceMemoryAllocationSize : 1024*1024),
         (rendererConfigVK != nullptr ? rendererConfigVK->reduceDeviceMemoryFragmentation : false)
     );
+
+    /* Configure lifetime of empty device memory chunks, defragmentation, and budget tracking */
+    if (rendererConfigVK != nullptr)
+    {
+        deviceMemoryMngr_->SetChunkLifetime(rendererConfigVK->deviceMemoryChunkLifetime);
+        deviceMemoryMngr_->SetBudgetCallback(
+            rendererConfigVK->memoryBudgetCallback,
+            rendererConfigVK->memoryBudgetUserData,
+            rendererConfigVK->memoryBudgetThreshold
+        );
+        defragmentationSize_ = rendererConfigVK->deviceMemoryDefragmentationSize;
+    }
+    else
+        deviceMemoryMngr_->SetChunkLifetime(60);
+
+    /* Create upload batcher for WriteBuffer() and WriteTexture() */
+    uploadBatcher_.InitializeDevice(
+        device_,
+        *deviceMemoryMngr_,
+        *commandQueue_,
+        (rendererConfigVK != nullptr ? rendererConfigVK->uploadBatchSize : 4*1024*1024)
+    );
+
+    /* Configure limit of unused framebuffers that are kept alive for reuse */
+    VKFramebufferCache::Get().SetMaxCachedFramebuffers(rendererConfigVK != nullptr ? rendererConfigVK->maxCachedFramebuffers : 64);
 }
 
 VKRenderSystem::~VKRenderSystem()
 {
     device_.WaitIdle();
+    ReleaseRetiredBuffers(true);
     VKShaderModulePool::Get().Clear();
     VKPipelineLayoutPermutationPool::Get().Clear();
+    VKPipelineLibraryCache::Get().Clear();
+    VKFramebufferCache::Get().Clear();
+    VKRenderPassCache::Get().Clear();
     VKPipelineLayout::ReleaseDefault();
 }
 
+void VKRenderSystem::NextFrame(const VKSwapChain& swapChain)
+{
+    /* A new frame begins when a swap-chain presents that already presented in the current frame */
+    if (Contains(presentedSwapChains_, &swapChain))
+        presentedSwapChains_.clear();
+    presentedSwapChains_.push_back(&swapChain);
+    if (presentedSwapChains_.size() > 1)
+        return;
+
+    /* Update memory budget with VK_EXT_memory_budget if supported, otherwise with the allocations of the device memory manager */
+    VkDeviceSize heapBudgets[VK_MAX_MEMORY_HEAPS], heapUsages[VK_MAX_MEMORY_HEAPS];
+    if (physicalDevice_.QueryMemoryBudget(heapBudgets, heapUsages))
+        deviceMemoryMngr_->UpdateBudget(heapBudgets, heapUsages);
+    else
+        deviceMemoryMngr_->UpdateBudget(nullptr, nullptr);
+
+    /* Only defragment in frames without new allocations, so relocations don't compete with loading new resources */
+    if (defragmentationSize_ > 0 && !deviceMemoryMngr_->HasAllocatedInFrame())
+        DefragmentDeviceMemory(defragmentationSize_);
+
+    ReleaseRetiredBuffers(false);
+    deviceMemoryMngr_->NextFrame();
+    ++frame_;
+
+    FlushProfile();
+}
+
 /* ----- Swap-chain ----- */
 
 SwapChain* VKRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
 {
     return swapChains_.emplace<VKSwapChain>(
-        instance_, physicalDevice_, device_, *deviceMemoryMngr_, swapChainDesc, surface, GetRendererInfo()
+        *this, instance_, physicalDevice_, device_, *deviceMemoryMngr_, swapChainDesc, surface, GetRendererInfo(), commandQueue_.get()
     );
 }
 
 void VKRenderSystem::Release(SwapChain& swapChain)
 {
+    RemoveFromList(presentedSwapChains_, LLGL_CAST(const VKSwapChain*, &swapChain));
     swapChains_.erase(&swapChain);
 }
 
@@ -129,12 +218,14 @@ CommandQueue* VKRenderSystem::GetCommandQueue()
 CommandBuffer* VKRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
 {
     return commandBuffers_.emplace<VKCommandBuffer>(
-        physicalDevice_, device_, device_.GetVkQueue(), *deviceMemoryMngr_, device_.GetQueueFamilyIndices(), commandBufferDesc
+        physicalDevice_, device_, device_.GetVkQueue(), *deviceMemoryMngr_, device_.GetQueueFamilyIndices(), commandBufferDesc, commandQueue_.get()
     );
 }
 
 void VKRenderSystem::Release(CommandBuffer& commandBuffer)
 {
+    /* Pending submissions must not refer to a command buffer that has been freed */
+    commandQueue_->FlushSubmissions();
     commandBuffers_.erase(&commandBuffer);
 }
 
@@ -145,10 +236,46 @@ static VkBufferUsageFlags GetStagingVkBufferUsageFlags(long /*cpuAccessFlags*/)
     return VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
 }
 
+// Returns true if the specified buffer is expected to be written by the CPU frequently.
+static bool IsFrequentlyWrittenBuffer(const BufferDescriptor& bufferDesc)
+{
+    return ((bufferDesc.cpuAccessFlags & CPUAccessFlags::Write) != 0 || (bufferDesc.miscFlags & MiscFlags::DynamicUsage) != 0);
+}
+
 Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
     RenderSystem::AssertCreateBuffer(bufferDesc, static_cast<uint64_t>(std::numeric_limits<VkDeviceSize>::max()));
 
+    /* Create primary buffer object */
+    VKBuffer* bufferVK = buffers_.emplace<VKBuffer>(device_, bufferDesc);
+    const VkMemoryRequirements& requirements = bufferVK->GetDeviceBuffer().GetRequirements();
+
+    if (IsFrequentlyWrittenBuffer(bufferDesc) &&
+        commandQueue_->HasTimelineSemaphore() &&
+        deviceMemoryMngr_->HasDirectWriteMemory(requirements.memoryTypeBits))
+    {
+        /*
+        Allocate host visible device memory (ReBAR/UMA), so this buffer can be written directly without staging buffer.
+        This requires the queue timeline semaphore, so the CPU only waits for the submissions that reference this buffer.
+        */
+        /*
+        Restrict allocation to the memory types that were detected for direct writes.
+        Otherwise, a memory type with the same properties in the small legacy BAR heap could be chosen.
+        */
+        VkMemoryRequirements directWriteRequirements = requirements;
+        directWriteRequirements.memoryTypeBits &= deviceMemoryMngr_->GetDirectWriteMemoryTypeBits();
+
+        VKDeviceMemoryRegion* memoryRegion = deviceMemoryMngr_->Allocate(directWriteRequirements, VKDeviceMemoryManager::directWriteMemoryProperties);
+        bufferVK->BindMemoryRegion(device_, memoryRegion);
+        bufferVK->MapPersistent(device_);
+
+        /* Copy initial data directly into buffer memory */
+        if (initialData != nullptr)
+            ::memcpy(bufferVK->GetPersistentMapping(), initialData, static_cast<std::size_t>(bufferDesc.size));
+
+        return bufferVK;
+    }
+
     /* Create staging buffer */
     VkBufferCreateInfo stagingCreateInfo;
     BuildVkBufferCreateInfo(
@@ -159,14 +286,8 @@ Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const v
 
     VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, initialData, bufferDesc.size);
 
-    /* Create primary buffer object */
-    VKBuffer* bufferVK = buffers_.emplace<VKBuffer>(device_, bufferDesc);
-
     /* Allocate device memory */
-    VKDeviceMemoryRegion* memoryRegion = deviceMemoryMngr_->Allocate(
-        bufferVK->GetDeviceBuffer().GetRequirements(),
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
-    );
+    VKDeviceMemoryRegion* memoryRegion = deviceMemoryMngr_->Allocate(requirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
     bufferVK->BindMemoryRegion(device_, memoryRegion);
 
     /* Copy staging buffer into hardware buffer */
@@ -194,9 +315,21 @@ BufferArray* VKRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
 
 void VKRenderSystem::Release(Buffer& buffer)
 {
-    /* Release device memory regions for primary buffer and internal staging buffer, then release buffer object */
+    /* Only wait for the upload batches that still refer to this buffer */
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
-    bufferVK.GetDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
+    uploadBatcher_.WaitForBuffer(bufferVK.GetVkBuffer());
+
+    /* Release device memory regions for primary buffer and internal staging buffer, then release buffer object */
+    if (bufferVK.GetPersistentMapping() != nullptr)
+    {
+        /* Remove buffer from the resource heaps and buffer arrays that keep track of it */
+        for (const auto& resourceHeap : resourceHeaps_)
+            resourceHeap->RemoveMappedBuffer(&bufferVK);
+        for (const auto& bufferArray : bufferArrays_)
+            bufferArray->RemoveMappedBuffer(&bufferVK);
+        bufferVK.UnmapPersistent(device_);
+    }
+    ReleaseMemoryRegion(bufferVK.GetDeviceBuffer().GetMemoryRegion());
     bufferVK.GetStagingDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
     buffers_.erase(&buffer);
 }
@@ -210,31 +343,25 @@ void VKRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const voi
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
 
-    if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
+    if (void* mappedData = bufferVK.GetPersistentMapping())
+    {
+        /* Wait until all command buffers that reference this buffer are done with it, then write input data directly */
+        WaitForMappedBuffer(bufferVK);
+        ::memcpy(static_cast<char*>(mappedData) + offset, data, static_cast<std::size_t>(dataSize));
+    }
+    else if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
     {
         /* Copy input data to staging buffer memory */
         device_.WriteBuffer(bufferVK.GetStagingDeviceBuffer(), data, dataSize, offset);
 
-        /* Copy staging buffer into hardware buffer */
+        /* Copy staging buffer into hardware buffer after all pending uploads and command buffers */
+        commandQueue_->Flush();
         device_.CopyBuffer(bufferVK.GetStagingVkBuffer(), bufferVK.GetVkBuffer(), dataSize, offset, offset);
     }
     else
     {
-        /* Create staging buffer */
-        VkBufferCreateInfo stagingCreateInfo;
-        BuildVkBufferCreateInfo(
-            stagingCreateInfo,
-            dataSize,
-            (VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT)
-        );
-
-        VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, data, dataSize);
-
-        /* Copy staging buffer into hardware buffer */
-        device_.CopyBuffer(stagingBuffer.GetVkBuffer(), bufferVK.GetVkBuffer(), dataSize, 0, offset);
-
-        /* Release device memory region of staging buffer */
-        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+        /* Record upload into current batch; this does not wait for the GPU */
+        uploadBatcher_.WriteBuffer(bufferVK.GetVkBuffer(), offset, data, dataSize);
     }
 }
 
@@ -242,6 +369,17 @@ void VKRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
 
+    if (const void* mappedData = bufferVK.GetPersistentMapping())
+    {
+        /* Wait until all command buffers that reference this buffer are done with it, then read output data directly */
+        WaitForMappedBuffer(bufferVK);
+        ::memcpy(data, static_cast<const char*>(mappedData) + offset, static_cast<std::size_t>(dataSize));
+        return;
+    }
+
+    /* Submit pending uploads and command buffers before the buffer is copied back to the CPU */
+    commandQueue_->Flush();
+
     if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
     {
         /* Copy hardware buffer into staging buffer */
@@ -276,13 +414,13 @@ void VKRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data
 void* VKRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
-    return bufferVK.Map(device_, access, 0, bufferVK.GetSize());
+    return MapBufferRange(bufferVK, access, 0, bufferVK.GetSize());
 }
 
 void* VKRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::uint64_t offset, std::uint64_t length)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
-    return bufferVK.Map(device_, access, static_cast<VkDeviceSize>(offset), static_cast<VkDeviceSize>(length));
+    return MapBufferRange(bufferVK, access, static_cast<VkDeviceSize>(offset), static_cast<VkDeviceSize>(length));
 }
 
 void VKRenderSystem::UnmapBuffer(Buffer& buffer)
@@ -490,9 +628,12 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
 
 void VKRenderSystem::Release(Texture& texture)
 {
-    /* Release device memory region, then release texture object */
+    /* Only wait for the upload batches that still refer to this texture */
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
-    deviceMemoryMngr_->Release(textureVK.GetMemoryRegion());
+    uploadBatcher_.WaitForImage(textureVK.GetVkImage());
+
+    /* Release device memory region, then release texture object */
+    ReleaseMemoryRegion(textureVK.GetMemoryRegion());
     textures_.erase(&texture);
 }
 
@@ -506,7 +647,6 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
     const Extent3D              extent          = CalcTextureExtent(textureVK.GetType(), textureRegion.extent, subresource.numArrayLayers);
     const Format                format          = VKTypes::Unmap(textureVK.GetVkFormat());
 
-    VkImage                     image           = textureVK.GetVkImage();
     const std::uint32_t         imageSize       = extent.width * extent.height * extent.depth;
     const void*                 imageData       = nullptr;
     const VkDeviceSize          imageDataSize   = static_cast<VkDeviceSize>(GetMemoryFootprint(format, imageSize));
@@ -540,42 +680,8 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
         imageData = srcImageView.data;
     }
 
-    /* Create staging buffer */
-    VkBufferCreateInfo stagingCreateInfo;
-    BuildVkBufferCreateInfo(
-        stagingCreateInfo,
-        imageDataSize,
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT // <-- TODO: support read/write mapping //GetStagingVkBufferUsageFlags(bufferDesc.cpuAccessFlags)
-    );
-
-    VKDeviceBuffer stagingBuffer =
-    (
-        IsCompressedFormat(format)
-            ? CreateStagingBufferAndInitialize(stagingCreateInfo, imageData, imageDataSize)
-            : CreateTextureStagingBufferAndInitialize(stagingCreateInfo, imageData, imageDataSize, extent, srcRowStride, bytesPerPixel)
-    );
-
-    /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
-    VkCommandBuffer cmdBuffer = AllocCommandBuffer();
-    {
-        VkImageLayout oldLayout = textureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresource, true);
-
-        /* Use input offset and extent (instead of transient dimensions) because copy operation takes subresource parameters into account */
-        context_.CopyBufferToImage(
-            stagingBuffer.GetVkBuffer(),
-            image,
-            textureVK.GetVkFormat(),
-            VkOffset3D{ textureRegion.offset.x, textureRegion.offset.y, textureRegion.offset.z },
-            VkExtent3D{ textureRegion.extent.width, textureRegion.extent.height, textureRegion.extent.depth },
-            subresource
-        );
-
-        textureVK.TransitionImageLayout(context_, oldLayout, subresource, true);
-    }
-    FlushCommandBuffer(cmdBuffer);
-
-    /* Release staging buffer */
-    stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+    /* Record upload into current batch; this does not wait for the GPU */
+    uploadBatcher_.WriteTexture(textureVK, textureRegion, extent, imageData, imageDataSize, srcRowStride, bytesPerPixel);
 }
 
 void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
@@ -645,6 +751,109 @@ void VKRenderSystem::Release(Sampler& sampler)
     samplers_.erase(&sampler);
 }
 
+/* ----- Memory Heaps ----- */
+
+MemoryHeap* VKRenderSystem::CreateMemoryHeap(const MemoryHeapDescriptor& memoryHeapDesc)
+{
+    /* Select device local memory type that supports all kinds of resources the heap is created for */
+    std::uint32_t memoryTypeIndex = 0;
+    const std::uint32_t memoryTypeBits = GetMemoryHeapTypeBits(memoryHeapDesc.resources);
+    if (!VKTryFindMemoryType(physicalDevice_.GetMemoryProperties(), memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, memoryTypeIndex))
+        return nullptr;
+    return memoryHeaps_.emplace<VKMemoryHeap>(device_, memoryTypeIndex, memoryHeapDesc);
+}
+
+void VKRenderSystem::Release(MemoryHeap& memoryHeap)
+{
+    /* Placed resources still reference the memory of this heap, so it must outlive them */
+    auto& memoryHeapVK = LLGL_CAST(VKMemoryHeap&, memoryHeap);
+    if (memoryHeapVK.HasPlacedRegions())
+        return;
+    memoryHeaps_.erase(&memoryHeap);
+}
+
+bool VKRenderSystem::GetMemoryRequirements(const TextureDescriptor& textureDesc, MemoryRequirements& outRequirements)
+{
+    /* Query requirements from a temporary image, since Vulkan 1.0 has no query for image descriptors */
+    VKTexture textureVK{ device_, textureDesc };
+    const VkMemoryRequirements& requirements = textureVK.GetMemoryRequirements();
+    outRequirements.size        = requirements.size;
+    outRequirements.alignment   = requirements.alignment;
+    return true;
+}
+
+bool VKRenderSystem::GetMemoryRequirements(const BufferDescriptor& bufferDesc, MemoryRequirements& outRequirements)
+{
+    /* Query requirements from a temporary buffer, since Vulkan 1.0 has no query for buffer descriptors */
+    VKBuffer bufferVK{ device_, bufferDesc };
+    const VkMemoryRequirements& requirements = bufferVK.GetDeviceBuffer().GetRequirements();
+    outRequirements.size        = requirements.size;
+    outRequirements.alignment   = requirements.alignment;
+    return true;
+}
+
+Texture* VKRenderSystem::CreatePlacedTexture(MemoryHeap& memoryHeap, std::uint64_t offset, const TextureDescriptor& textureDesc)
+{
+    auto& memoryHeapVK = LLGL_CAST(VKMemoryHeap&, memoryHeap);
+
+    if (!memoryHeapVK.SupportsResources(GetMemoryHeapResourceFlags(textureDesc)))
+        return nullptr;
+
+    /* Create device texture without memory and bind it to the placed region */
+    VKTexture* textureVK = textures_.emplace<VKTexture>(device_, textureDesc);
+
+    VKDeviceMemoryRegion* memoryRegion = memoryHeapVK.AllocPlacedRegion(static_cast<VkDeviceSize>(offset), textureVK->GetMemoryRequirements());
+    if (memoryRegion == nullptr)
+    {
+        textures_.erase(textureVK);
+        return nullptr;
+    }
+    textureVK->BindMemoryRegion(device_, memoryRegion);
+
+    /* Initialize image layout; placed textures have no initial data */
+    const VkImageLayout initialLayout = FindOptimalInitialVkImageLayout(textureDesc.format, textureDesc.bindFlags);
+    if (initialLayout != VK_IMAGE_LAYOUT_UNDEFINED)
+    {
+        VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+        {
+            textureVK->TransitionImageLayout(context_, initialLayout, true);
+        }
+        FlushCommandBuffer(cmdBuffer);
+    }
+
+    /* Create primary image view for texture */
+    textureVK->CreateInternalImageView(device_);
+
+    return textureVK;
+}
+
+Buffer* VKRenderSystem::CreatePlacedBuffer(MemoryHeap& memoryHeap, std::uint64_t offset, const BufferDescriptor& bufferDesc)
+{
+    auto& memoryHeapVK = LLGL_CAST(VKMemoryHeap&, memoryHeap);
+
+    RenderSystem::AssertCreateBuffer(bufferDesc, static_cast<uint64_t>(std::numeric_limits<VkDeviceSize>::max()));
+
+    /* Placed buffers have no staging buffer, so they cannot be mapped */
+    if (bufferDesc.cpuAccessFlags != 0 || !memoryHeapVK.SupportsResources(MemoryHeapResourceFlags::Buffers))
+        return nullptr;
+
+    /* Create primary buffer object and bind it to the placed region */
+    VKBuffer* bufferVK = buffers_.emplace<VKBuffer>(device_, bufferDesc);
+
+    VKDeviceMemoryRegion* memoryRegion = memoryHeapVK.AllocPlacedRegion(static_cast<VkDeviceSize>(offset), bufferVK->GetDeviceBuffer().GetRequirements());
+    if (memoryRegion == nullptr)
+    {
+        buffers_.erase(bufferVK);
+        return nullptr;
+    }
+    bufferVK->BindMemoryRegion(device_, memoryRegion);
+
+    /* Placed buffers must stay in their heap, so they are never relocated by the defragmentation */
+    bufferVK->DisableRelocation();
+
+    return bufferVK;
+}
+
 /* ----- Resource Heaps ----- */
 
 ResourceHeap* VKRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
@@ -663,6 +872,18 @@ std::uint32_t VKRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std:
     return resourceHeapVK.WriteResourceViews(device_, firstDescriptor, resourceViews);
 }
 
+void VKRenderSystem::BeginResourceHeapUpdate(ResourceHeap& resourceHeap)
+{
+    auto& resourceHeapVK = LLGL_CAST(VKResourceHeap&, resourceHeap);
+    resourceHeapVK.BeginUpdate();
+}
+
+std::uint32_t VKRenderSystem::CommitResourceHeapUpdate(ResourceHeap& resourceHeap)
+{
+    auto& resourceHeapVK = LLGL_CAST(VKResourceHeap&, resourceHeap);
+    return resourceHeapVK.CommitUpdate(device_);
+}
+
 /* ----- Render Passes ----- */
 
 RenderPass* VKRenderSystem::CreateRenderPass(const RenderPassDescriptor& renderPassDesc)
@@ -704,7 +925,7 @@ void VKRenderSystem::Release(Shader& shader)
 
 PipelineLayout* VKRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
 {
-    return pipelineLayouts_.emplace<VKPipelineLayout>(device_, pipelineLayoutDesc);
+    return pipelineLayouts_.emplace<VKPipelineLayout>(physicalDevice_, device_, pipelineLayoutDesc);
 }
 
 void VKRenderSystem::Release(PipelineLayout& pipelineLayout)
@@ -733,6 +954,7 @@ PipelineState* VKRenderSystem::CreatePipelineState(const GraphicsPipelineDescrip
         (!swapChains_.empty() ? (*swapChains_.begin())->GetRenderPass() : nullptr),
         pipelineStateDesc,
         graphicsPipelineLimits_,
+        graphicsPipelineOptions_,
         pipelineCache
     );
 }
@@ -758,8 +980,20 @@ QueryHeap* VKRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& queryHeapD
 {
     if (queryHeapDesc.renderCondition)
         return queryHeaps_.emplace<VKPredicateQueryHeap>(device_, *deviceMemoryMngr_, queryHeapDesc);
-    else
-        return queryHeaps_.emplace<VKQueryHeap>(device_, queryHeapDesc);
+
+    if (VKHostQueryHeap::IsSupported(queryHeapDesc))
+    {
+        /* Queries must be reset once before their first use, afterwards they are reset every time their results are resolved */
+        auto* queryHeapVK = queryHeaps_.emplace<VKHostQueryHeap>(device_, *deviceMemoryMngr_, queryHeapDesc);
+        VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+        {
+            queryHeapVK->ResetAll(cmdBuffer);
+        }
+        FlushCommandBuffer(cmdBuffer);
+        return queryHeapVK;
+    }
+
+    return queryHeaps_.emplace<VKQueryHeap>(device_, queryHeapDesc);
 }
 
 void VKRenderSystem::Release(QueryHeap& queryHeap)
@@ -771,7 +1005,7 @@ void VKRenderSystem::Release(QueryHeap& queryHeap)
 
 Fence* VKRenderSystem::CreateFence()
 {
-    return fences_.emplace<VKFence>(device_);
+    return fences_.emplace<VKFence>(device_, commandQueue_->HasTimelineSemaphore());
 }
 
 void VKRenderSystem::Release(Fence& fence)
@@ -913,7 +1147,7 @@ void VKRenderSystem::CreateInstance(const RendererConfigurationVulkan* config)
     #endif // /VK_EXT_validation_features
 
     /* Create Vulkan instance */
-    VkResult result = vkCreateInstance(&instanceInfo, nullptr, instance_.ReleaseAndGetAddressOf());
+    VkResult result = vkCreateInstance(&instanceInfo, VKGetAllocationCallbacks(), instance_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan instance");
 }
 
@@ -983,7 +1217,7 @@ void VKRenderSystem::CreateDebugReportCallback()
         createInfo.pUserData    = this;
     }
     debugReportCallback_ = VKPtr<VkDebugReportCallbackEXT>{ instance_, DestroyDebugReportCallbackEXT };
-    auto result = CreateDebugReportCallbackEXT(instance_, &createInfo, nullptr, debugReportCallback_.ReleaseAndGetAddressOf());
+    auto result = CreateDebugReportCallbackEXT(instance_, &createInfo, VKGetAllocationCallbacks(), debugReportCallback_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan debug report callback");
 }
 
@@ -1012,11 +1246,12 @@ void VKRenderSystem::CreateLogicalDevice(VkDevice customLogicalDevice)
     /* Create logical device with all supported physical device feature */
     device_ = physicalDevice_.CreateLogicalDevice(customLogicalDevice);
 
-    /* Create command queue interface */
-    commandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue());
-
     /* Load Vulkan device extensions */
     VKLoadDeviceExtensions(device_, physicalDevice_.GetExtensionNames());
+
+    /* Create command queue interface; submissions are only coalesced if they can signal a timeline semaphore */
+    const bool useTimelineSemaphore = (physicalDevice_.SupportsTimelineSemaphore() && HasExtension(VKExt::KHR_timeline_semaphore));
+    commandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue(), useTimelineSemaphore, &uploadBatcher_);
 }
 
 bool VKRenderSystem::IsLayerRequired(const char* name, const RendererConfigurationVulkan* config) const
@@ -1112,9 +1347,195 @@ VkCommandBuffer VKRenderSystem::AllocCommandBuffer(bool begin)
 
 void VKRenderSystem::FlushCommandBuffer(VkCommandBuffer commandBuffer)
 {
+    /* Submit pending uploads and command buffers first to preserve the order of all writes */
+    commandQueue_->Flush();
     device_.FlushCommandBuffer(commandBuffer);
 }
 
+void VKRenderSystem::FlushProfile()
+{
+    /* Always flush cache statistics, so counters only cover the last frame even if no debugger is set */
+    FrameProfile profile;
+    VKRenderPassCache::Get().FlushProfile(profile.renderPassCacheRecord);
+    VKFramebufferCache::Get().FlushProfile(profile.renderPassCacheRecord);
+    VKPipelineLibraryCache::Get().FlushProfile(profile.graphicsPipelineRecord);
+    deviceMemoryMngr_->FlushProfile(profile.deviceMemoryRecord);
+    if (debugger_ != nullptr)
+        debugger_->RecordProfile(profile);
+}
+
+void VKRenderSystem::DefragmentDeviceMemory(VkDeviceSize maxRelocationSize)
+{
+    VKDeviceMemory* sourceChunk = deviceMemoryMngr_->FindDefragmentationSource();
+    if (sourceChunk == nullptr)
+        return;
+
+    /* Only relocate when the entire source chunk can be emptied within the budget, otherwise the relocation gains nothing */
+    const VkDeviceSize sourceUsedSize = sourceChunk->GetUsedSize();
+    if (sourceUsedSize > maxRelocationSize)
+        return;
+
+    /* Gather all buffers that reside in the source chunk; abort if any block of the chunk cannot be relocated */
+    std::vector<VKBuffer*> sourceBuffers;
+    VkDeviceSize sourceBufferSize = 0;
+
+    for (const auto& buffer : buffers_)
+    {
+        VKBuffer* bufferVK = buffer.get();
+        VKDeviceMemoryRegion* region = bufferVK->GetDeviceBuffer().GetMemoryRegion();
+        if (region == nullptr || region->GetParentChunk() != sourceChunk)
+            continue;
+        if (!bufferVK->IsRelocatable())
+            return;
+        sourceBuffers.push_back(bufferVK);
+        sourceBufferSize += region->GetSize();
+    }
+
+    if (sourceBufferSize != sourceUsedSize)
+        return;
+
+    /* Allocate all new regions in other chunks first, so nothing is moved unless all blocks fit */
+    std::vector<VKDeviceMemoryRegion*> newRegions;
+    newRegions.reserve(sourceBuffers.size());
+
+    for (VKBuffer* bufferVK : sourceBuffers)
+    {
+        VKDeviceMemoryRegion* newRegion = deviceMemoryMngr_->AllocateInExistingChunk(
+            bufferVK->GetDeviceBuffer().GetRequirements(),
+            sourceChunk->GetMemoryTypeIndex(),
+            sourceChunk
+        );
+        if (newRegion == nullptr)
+        {
+            for (VKDeviceMemoryRegion* region : newRegions)
+                deviceMemoryMngr_->Release(region);
+            return;
+        }
+        newRegions.push_back(newRegion);
+    }
+
+    for_range(i, sourceBuffers.size())
+    {
+        /* Replace native buffer and copy its content on the GPU; the old buffer is retired until the GPU no longer uses it */
+        VKBuffer* bufferVK = sourceBuffers[i];
+        const VkDeviceSize oldRegionSize = bufferVK->GetDeviceBuffer().GetMemoryRegion()->GetSize();
+
+        VKDeviceBuffer oldBuffer = bufferVK->Relocate(device_, newRegions[i]);
+        uploadBatcher_.CopyBuffer(oldBuffer.GetVkBuffer(), bufferVK->GetVkBuffer(), bufferVK->GetInternalSize());
+        retiredBuffers_.push_back(RetiredBuffer{ std::move(oldBuffer), frame_ });
+
+        deviceMemoryMngr_->RecordRelocation(oldRegionSize);
+    }
+
+    /* Submit copy commands before any command buffer of the next frame can use the relocated buffers */
+    uploadBatcher_.Submit();
+}
+
+void VKRenderSystem::ReleaseRetiredBuffers(bool releaseAll)
+{
+    /* Keep retired buffers alive until all frames in flight that might refer to them have been completed */
+    constexpr std::uint64_t numRetiredFrames = 4;
+
+    auto it = retiredBuffers_.begin();
+    for (; it != retiredBuffers_.end(); ++it)
+    {
+        if (!releaseAll && frame_ - it->frame < numRetiredFrames)
+            break;
+        it->buffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+    }
+    retiredBuffers_.erase(retiredBuffers_.begin(), it);
+}
+
+std::uint32_t VKRenderSystem::GetMemoryHeapTypeBits(long resources)
+{
+    /* Vulkan only reports supported memory types per resource, so intersect the memory types of representative resources */
+    std::uint32_t memoryTypeBits = ~0u;
+
+    if ((resources & MemoryHeapResourceFlags::Buffers) != 0)
+    {
+        BufferDescriptor bufferDesc;
+        {
+            bufferDesc.size         = 256;
+            bufferDesc.stride       = 4;
+            bufferDesc.format       = Format::R32UInt;
+            bufferDesc.bindFlags    = (
+                BindFlags::VertexBuffer     |
+                BindFlags::IndexBuffer      |
+                BindFlags::ConstantBuffer   |
+                BindFlags::Sampled          |
+                BindFlags::Storage          |
+                BindFlags::IndirectBuffer
+            );
+        }
+        VKBuffer bufferVK{ device_, bufferDesc };
+        memoryTypeBits &= bufferVK.GetDeviceBuffer().GetRequirements().memoryTypeBits;
+    }
+
+    TextureDescriptor textureDesc;
+    {
+        textureDesc.type        = TextureType::Texture2D;
+        textureDesc.format      = Format::RGBA8UNorm;
+        textureDesc.extent      = Extent3D{ 1, 1, 1 };
+        textureDesc.mipLevels   = 1;
+        textureDesc.miscFlags   = 0;
+    }
+
+    if ((resources & MemoryHeapResourceFlags::Textures) != 0)
+    {
+        textureDesc.bindFlags = (BindFlags::Sampled | BindFlags::Storage);
+        VKTexture textureVK{ device_, textureDesc };
+        memoryTypeBits &= textureVK.GetMemoryRequirements().memoryTypeBits;
+    }
+
+    if ((resources & MemoryHeapResourceFlags::AttachmentTextures) != 0)
+    {
+        textureDesc.bindFlags = (BindFlags::Sampled | BindFlags::ColorAttachment);
+        VKTexture colorTextureVK{ device_, textureDesc };
+        memoryTypeBits &= colorTextureVK.GetMemoryRequirements().memoryTypeBits;
+
+        textureDesc.format      = Format::D16UNorm;
+        textureDesc.bindFlags   = (BindFlags::Sampled | BindFlags::DepthStencilAttachment);
+        VKTexture depthTextureVK{ device_, textureDesc };
+        memoryTypeBits &= depthTextureVK.GetMemoryRequirements().memoryTypeBits;
+    }
+
+    return memoryTypeBits;
+}
+
+void VKRenderSystem::ReleaseMemoryRegion(VKDeviceMemoryRegion* region)
+{
+    /* Placed regions are owned by their memory heap; all other regions are owned by the device memory manager */
+    for (const auto& memoryHeap : memoryHeaps_)
+    {
+        if (memoryHeap->ReleasePlacedRegion(region))
+            return;
+    }
+    deviceMemoryMngr_->Release(region);
+}
+
+void* VKRenderSystem::MapBufferRange(VKBuffer& bufferVK, const CPUAccess access, VkDeviceSize offset, VkDeviceSize length)
+{
+    if (bufferVK.GetPersistentMapping() != nullptr)
+    {
+        /* Host visible device memory is accessed directly, so all command buffers that reference this buffer must be done with it */
+        WaitForMappedBuffer(bufferVK);
+    }
+    else
+    {
+        /* Submit pending uploads and command buffers before the staging buffer is copied */
+        commandQueue_->Flush();
+    }
+    return bufferVK.Map(device_, access, offset, length);
+}
+
+void VKRenderSystem::WaitForMappedBuffer(const VKBuffer& bufferVK)
+{
+    /* Pending uploads never target persistently mapped buffers, so only submissions of command buffers must be considered */
+    const std::uint64_t lastTimelineUse = bufferVK.GetLastTimelineUse();
+    if (lastTimelineUse > 0 && !commandQueue_->IsTimelineValueReached(lastTimelineUse))
+        commandQueue_->WaitTimelineValue(lastTimelineUse);
+}
+
 bool VKRenderSystem::QueryRendererDetails(RendererInfo* outInfo, RenderingCapabilities* outCaps)
 {
     if (outInfo != nullptr)
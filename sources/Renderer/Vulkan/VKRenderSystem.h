@@ -14,10 +14,12 @@
 #include "VKDevice.h"
 #include "../ContainerTypes.h"
 #include "Memory/VKDeviceMemoryManager.h"
+#include "Memory/VKMemoryHeap.h"
 
 #include "Command/VKCommandQueue.h"
 #include "Command/VKCommandBuffer.h"
 #include "Command/VKCommandContext.h"
+#include "Command/VKUploadBatcher.h"
 #include "VKSwapChain.h"
 
 #include "Buffer/VKBuffer.h"
@@ -55,6 +57,18 @@ class VKRenderSystem final : public RenderSystem
 
         #include <LLGL/Backend/RenderSystem.inl>
 
+    public:
+
+        void BeginResourceHeapUpdate(ResourceHeap& resourceHeap) override;
+        std::uint32_t CommitResourceHeapUpdate(ResourceHeap& resourceHeap) override;
+
+        MemoryHeap* CreateMemoryHeap(const MemoryHeapDescriptor& memoryHeapDesc) override;
+        void Release(MemoryHeap& memoryHeap) override;
+        bool GetMemoryRequirements(const TextureDescriptor& textureDesc, MemoryRequirements& outRequirements) override;
+        bool GetMemoryRequirements(const BufferDescriptor& bufferDesc, MemoryRequirements& outRequirements) override;
+        Texture* CreatePlacedTexture(MemoryHeap& memoryHeap, std::uint64_t offset, const TextureDescriptor& textureDesc) override;
+        Buffer* CreatePlacedBuffer(MemoryHeap& memoryHeap, std::uint64_t offset, const BufferDescriptor& bufferDesc) override;
+
     public:
 
         VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
@@ -67,6 +81,13 @@ class VKRenderSystem final : public RenderSystem
             return isBreakOnErrorEnabled_;
         }
 
+        /*
+        Updates the device memory budget, runs the device memory defragmentation, and releases resources that are no longer in use.
+        Then flushes the statistics of all device-wide caches into the rendering debugger. This is called by VKSwapChain::Present.
+        With multiple swap-chains, only the first present of each frame advances the frame, i.e. when a swap-chain presents again.
+        */
+        void NextFrame(const VKSwapChain& swapChain);
+
     private:
 
         #include <LLGL/Backend/RenderSystem.Internal.inl>
@@ -101,6 +122,35 @@ class VKRenderSystem final : public RenderSystem
         VkCommandBuffer AllocCommandBuffer(bool begin = true);
         void FlushCommandBuffer(VkCommandBuffer commandBuffer);
 
+        void FlushProfile();
+
+        // Relocates buffers out of the device memory chunk with the lowest utilization up to the specified number of bytes.
+        void DefragmentDeviceMemory(VkDeviceSize maxRelocationSize);
+
+        // Releases the retired device buffers whose frame is old enough, or all of them if 'releaseAll' is true.
+        void ReleaseRetiredBuffers(bool releaseAll);
+
+        // Returns the memory type bits that are supported by all kinds of resources specified by MemoryHeapResourceFlags.
+        std::uint32_t GetMemoryHeapTypeBits(long resources);
+
+        // Releases the specified device memory region either from the memory heap it was placed in or from the device memory manager.
+        void ReleaseMemoryRegion(VKDeviceMemoryRegion* region);
+
+        // Maps the specified range of the buffer into CPU memory space and waits for the GPU if the buffer memory is accessed directly.
+        void* MapBufferRange(VKBuffer& bufferVK, const CPUAccess access, VkDeviceSize offset, VkDeviceSize length);
+
+        // Waits until all submissions that reference the specified persistently mapped buffer have been completed.
+        void WaitForMappedBuffer(const VKBuffer& bufferVK);
+
+    private:
+
+        // Native buffer that has been replaced by a relocation but might still be in use by the GPU.
+        struct RetiredBuffer
+        {
+            VKDeviceBuffer  buffer;
+            std::uint64_t   frame;
+        };
+
     private:
 
         /* ----- Common objects ----- */
@@ -115,11 +165,19 @@ class VKRenderSystem final : public RenderSystem
 
         bool                                    isDebugLayerEnabled_    = false;
         bool                                    isBreakOnErrorEnabled_  = false;
+        RenderingDebugger*                      debugger_               = nullptr;
         VKPtr<VkDebugReportCallbackEXT>         debugReportCallback_;
 
         std::unique_ptr<VKDeviceMemoryManager>  deviceMemoryMngr_;
+        VKUploadBatcher                         uploadBatcher_;
+
+        std::uint64_t                           frame_                  = 0;
+        VkDeviceSize                            defragmentationSize_    = 0;
+        std::vector<RetiredBuffer>              retiredBuffers_;
+        std::vector<const VKSwapChain*>         presentedSwapChains_;
 
         VKGraphicsPipelineLimits                graphicsPipelineLimits_;
+        VKGraphicsPipelineOptions               graphicsPipelineOptions_;
 
         /* ----- Hardware object containers ----- */
 
@@ -139,6 +197,7 @@ class VKRenderSystem final : public RenderSystem
         HWObjectContainer<VKResourceHeap>       resourceHeaps_;
         HWObjectContainer<VKQueryHeap>          queryHeaps_;
         HWObjectContainer<VKFence>              fences_;
+        HWObjectContainer<VKMemoryHeap>         memoryHeaps_;
 
 };
 
@@ -6,9 +6,11 @@
  */
 
 #include "VKSwapChain.h"
+#include "VKRenderSystem.h"
 #include "VKCore.h"
 #include "VKTypes.h"
 #include "Command/VKCommandContext.h"
+#include "Command/VKCommandQueue.h"
 #include "Memory/VKDeviceMemoryManager.h"
 #include "Texture/VKImageUtils.h"
 #include "../TextureUtils.h"
@@ -19,6 +21,7 @@
 #include <LLGL/Utils/ForRange.h>
 #include <limits.h>
 #include <set>
+#include <thread>
 
 #if LLGL_LINUX_ENABLE_WAYLAND
     #include <vulkan/vulkan_wayland.h>
@@ -33,6 +36,14 @@ namespace LLGL
 
 constexpr std::uint32_t VKSwapChain::maxNumFramesInFlight;
 
+// Weight of the current frame for the running averages of the frame timings.
+static constexpr double g_frameTimeSmoothing = 0.1;
+
+static std::uint64_t GetElapsedNanoseconds(const std::chrono::steady_clock::time_point& startTime, const std::chrono::steady_clock::time_point& endTime)
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count());
+}
+
 static VKPtr<VkImageView> NullVkImageView(VkDevice device)
 {
     return VKPtr<VkImageView>{ device, vkDestroyImageView };
@@ -54,15 +65,18 @@ static VKPtr<VkFence> NullVkFence(VkDevice device)
 }
 
 VKSwapChain::VKSwapChain(
+    VKRenderSystem&                 renderSystem,
     VkInstance                      instance,
     VkPhysicalDevice                physicalDevice,
     VkDevice                        device,
     VKDeviceMemoryManager&          deviceMemoryMngr,
     const SwapChainDescriptor&      desc,
     const std::shared_ptr<Surface>& surface,
-    const RendererInfo&             rendererInfo)
+    const RendererInfo&             rendererInfo,
+    VKCommandQueue*                 commandQueue)
 :
     SwapChain                { desc                            },
+    renderSystem_            { renderSystem                    },
     instance_                { instance                        },
     physicalDevice_          { physicalDevice                  },
     device_                  { device                          },
@@ -73,6 +87,7 @@ VKSwapChain::VKSwapChain(
     swapChainSamples_        { GetClampedSamples(desc.samples) },
     secondaryRenderPass_     { device                          },
     depthStencilBuffer_      { device                          },
+    commandQueue_            { commandQueue                    },
     imageAvailableSemaphore_ { NullVkSemaphore(device_),
                                NullVkSemaphore(device_),
                                NullVkSemaphore(device_)        },
@@ -81,7 +96,8 @@ VKSwapChain::VKSwapChain(
                                NullVkSemaphore(device_)        },
     inFlightFences_          { NullVkFence(device_),
                                NullVkFence(device_),
-                               NullVkFence(device_)            }
+                               NullVkFence(device_)            },
+    lowLatency_              { desc.lowLatency                 }
 {
     SetOrCreateSurface(surface, SwapChain::BuildDefaultSurfaceTitle(rendererInfo), desc);
 
@@ -90,6 +106,7 @@ VKSwapChain::VKSwapChain(
 
     /* Pick image count for swap-chain and depth-stencil format */
     numPreferredColorBuffers_   = PickSwapChainSize(desc.swapBuffers);
+    numFramesInFlight_          = PickNumFramesInFlight(desc.framesInFlight);
     depthStencilFormat_         = PickDepthStencilFormat(desc.depthBits, desc.stencilBits);
 
     /* Create Vulkan render passes, swap-chain, depth-stencil buffer, and multisampling color buffers */
@@ -109,12 +126,14 @@ bool VKSwapChain::IsPresentable() const
 
 void VKSwapChain::Present()
 {
+    const Clock::time_point presentBeginTime = Clock::now();
+
     /* Initialize semaphores */
     VkSemaphore waitSemaphores[] = { imageAvailableSemaphore_[currentFrameInFlight_] };
     VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
     VkSemaphore signalSemaphores[] = { renderFinishedSemaphore_[currentFrameInFlight_] };
 
-    /* Submit signal semaphore to graphics queue */
+    /* Submit signal semaphore to graphics queue together with all pending command buffers */
     VkSubmitInfo submitInfo;
     {
         submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
@@ -127,8 +146,15 @@ void VKSwapChain::Present()
         submitInfo.signalSemaphoreCount = 1;
         submitInfo.pSignalSemaphores    = signalSemaphores;
     }
-    VkResult result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, inFlightFences_[currentFrameInFlight_]);
-    VKThrowIfFailed(result, "failed to submit semaphore to Vulkan graphics queue");
+    if (commandQueue_ != nullptr)
+        commandQueue_->FlushSubmissions(&submitInfo, inFlightFences_[currentFrameInFlight_]);
+    else
+    {
+        VkResult result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, inFlightFences_[currentFrameInFlight_]);
+        VKThrowIfFailed(result, "failed to submit semaphore to Vulkan graphics queue");
+    }
+
+    const Clock::time_point submitEndTime = Clock::now();
 
     /* Present result on screen */
     VkPresentInfoKHR presentInfo;
@@ -142,11 +168,27 @@ void VKSwapChain::Present()
         presentInfo.pImageIndices       = &currentColorBuffer_;
         presentInfo.pResults            = nullptr;
     }
-    result = vkQueuePresentKHR(presentQueue_, &presentInfo);
+    VkResult result = vkQueuePresentKHR(presentQueue_, &presentInfo);
     VKThrowIfFailed(result, "failed to present Vulkan graphics queue");
 
-    /* Move to next frame */
+    const Clock::time_point presentEndTime = Clock::now();
+
+    /* Move to next frame; this stores the fence and acquire wait times */
     AcquireNextColorBuffer();
+    renderSystem_.NextFrame(*this);
+
+    /* Store timings of this frame and optionally delay the CPU for the next frame */
+    frameTimings_.frameCount++;
+    frameTimings_.submitTime    = GetElapsedNanoseconds(presentBeginTime, submitEndTime);
+    frameTimings_.presentTime   = GetElapsedNanoseconds(submitEndTime, presentEndTime);
+    UpdateFrameTimeEstimates(presentBeginTime);
+
+    if (lowLatency_)
+        SleepForLowLatency();
+    else
+        frameTimings_.latencySleepTime = 0;
+
+    lastPresentEndTime_ = Clock::now();
 }
 
 std::uint32_t VKSwapChain::GetCurrentSwapIndex() const
@@ -174,6 +216,12 @@ Format VKSwapChain::GetDepthStencilFormat() const
     return VKTypes::Unmap(depthStencilFormat_);
 }
 
+bool VKSwapChain::GetFrameTimings(SwapChainFrameTimings& outTimings) const
+{
+    outTimings = frameTimings_;
+    return true;
+}
+
 const RenderPass* VKSwapChain::GetRenderPass() const
 {
     return (&swapChainRenderPass_);
@@ -300,6 +348,8 @@ bool VKSwapChain::ResizeBuffersPrimary(const Extent2D& resolution)
         swapChainExtent_.height != resolution.height)
     {
         /* Wait until graphics queue is idle before resources are destroyed and recreated */
+        if (commandQueue_ != nullptr)
+            commandQueue_->Flush();
         vkQueueWaitIdle(graphicsQueue_);
 
         /* Recreate presenting semaphores and Vulkan surface */
@@ -322,7 +372,7 @@ void VKSwapChain::CreateGpuSemaphore(VKPtr<VkSemaphore>& semaphore)
         createInfo.pNext = nullptr;
         createInfo.flags = 0;
     }
-    VkResult result = vkCreateSemaphore(device_, &createInfo, nullptr, semaphore.ReleaseAndGetAddressOf());
+    VkResult result = vkCreateSemaphore(device_, &createInfo, VKGetAllocationCallbacks(), semaphore.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan semaphore");
 }
 
@@ -334,7 +384,7 @@ void VKSwapChain::CreateGpuFence(VKPtr<VkFence>& fence)
         createInfo.pNext = nullptr;
         createInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
     }
-    VkResult result = vkCreateFence(device_, &createInfo, nullptr, fence.ReleaseAndGetAddressOf());
+    VkResult result = vkCreateFence(device_, &createInfo, VKGetAllocationCallbacks(), fence.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan fence");
 }
 
@@ -369,7 +419,7 @@ void VKSwapChain::CreateGpuSurface()
         createInfo.hinstance    = GetModuleHandle(NULL);
         createInfo.hwnd         = nativeHandle.window;
     }
-    VkResult result = vkCreateWin32SurfaceKHR(instance_, &createInfo, nullptr, surface_.ReleaseAndGetAddressOf());
+    VkResult result = vkCreateWin32SurfaceKHR(instance_, &createInfo, VKGetAllocationCallbacks(), surface_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Win32 surface for Vulkan swap-chain");
 
     #elif defined LLGL_OS_LINUX
@@ -384,7 +434,7 @@ void VKSwapChain::CreateGpuSurface()
         createInfo.dpy      = nativeHandle.x11.display;
         createInfo.window   = nativeHandle.x11.window;
 
-        VkResult result = vkCreateXlibSurfaceKHR(instance_, &createInfo, nullptr, surface_.ReleaseAndGetAddressOf());
+        VkResult result = vkCreateXlibSurfaceKHR(instance_, &createInfo, VKGetAllocationCallbacks(), surface_.ReleaseAndGetAddressOf());
         VKThrowIfFailed(result, "failed to create Xlib surface for Vulkan swap-chain");
     }
     #if LLGL_LINUX_ENABLE_WAYLAND
@@ -398,7 +448,7 @@ void VKSwapChain::CreateGpuSurface()
         createInfo.display  = nativeHandle.wayland.display;
         createInfo.surface  = nativeHandle.wayland.window;
 
-        VkResult result = vkCreateWaylandSurfaceKHR(instance_, &createInfo, nullptr, surface_.ReleaseAndGetAddressOf());
+        VkResult result = vkCreateWaylandSurfaceKHR(instance_, &createInfo, VKGetAllocationCallbacks(), surface_.ReleaseAndGetAddressOf());
         VKThrowIfFailed(result, "failed to create Wayland surface for Vulkan swap-chain");
     }
     else
@@ -417,7 +467,7 @@ void VKSwapChain::CreateGpuSurface()
         createInfo.flags    = 0;
         createInfo.window   = nativeHandle.window;
     }
-    VkResult result = vkCreateAndroidSurfaceKHR(instance_, &createInfo, nullptr, surface_.ReleaseAndGetAddressOf());
+    VkResult result = vkCreateAndroidSurfaceKHR(instance_, &createInfo, VKGetAllocationCallbacks(), surface_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Android surface for Vulkan swap-chain");
 
     #elif defined LLGL_OS_MACOS || defined LLGL_OS_IOS
@@ -429,7 +479,7 @@ void VKSwapChain::CreateGpuSurface()
         createInfo.flags    = 0;
         createInfo.pLayer   = CreateCAMetalLayerForSurfaceHandle(&nativeHandle, sizeof(nativeHandle));
     }
-    VkResult result = vkCreateMetalSurfaceEXT(instance_, &createInfo, nullptr, surface_.ReleaseAndGetAddressOf());
+    VkResult result = vkCreateMetalSurfaceEXT(instance_, &createInfo, VKGetAllocationCallbacks(), surface_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Macos surface for Vulkan swap-chain");
 
     #else
@@ -524,7 +574,7 @@ void VKSwapChain::CreateSwapChain(const Extent2D& resolution, std::uint32_t vsyn
         createInfo.clipped                      = VK_TRUE;
         createInfo.oldSwapchain                 = VK_NULL_HANDLE;
     }
-    VkResult result = vkCreateSwapchainKHR(device_, &createInfo, nullptr, swapChain_.ReleaseAndGetAddressOf());
+    VkResult result = vkCreateSwapchainKHR(device_, &createInfo, VKGetAllocationCallbacks(), swapChain_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan swap-chain");
 
     /* Query swap-chain images */
@@ -574,7 +624,7 @@ void VKSwapChain::CreateSwapChainImageViews()
 
         /* Create image view for framebuffer */
         VKPtr<VkImageView> imageView{ NullVkImageView(device_) };
-        VkResult result = vkCreateImageView(device_, &createInfo, nullptr, imageView.ReleaseAndGetAddressOf());
+        VkResult result = vkCreateImageView(device_, &createInfo, VKGetAllocationCallbacks(), imageView.ReleaseAndGetAddressOf());
         VKThrowIfFailed(result, "failed to create Vulkan swap-chain image view");
         swapChainImageViews_[i] = std::move(imageView);
     }
@@ -628,7 +678,7 @@ void VKSwapChain::CreateSwapChainFramebuffers()
 
         /* Create framebuffer */
         VKPtr<VkFramebuffer> framebuffer{ NullVkFramebuffer(device_) };
-        VkResult result = vkCreateFramebuffer(device_, &createInfo, nullptr, framebuffer.ReleaseAndGetAddressOf());
+        VkResult result = vkCreateFramebuffer(device_, &createInfo, VKGetAllocationCallbacks(), framebuffer.ReleaseAndGetAddressOf());
         VKThrowIfFailed(result, "failed to create Vulkan swap-chain framebuffer");
         swapChainFramebuffers_[i] = std::move(framebuffer);
     }
@@ -754,10 +804,20 @@ std::uint32_t VKSwapChain::PickSwapChainSize(std::uint32_t swapBuffers) const
     );
 }
 
+std::uint32_t VKSwapChain::PickNumFramesInFlight(std::uint32_t framesInFlight) const
+{
+    if (framesInFlight == 0)
+        return maxNumFramesInFlight;
+    return Clamp(framesInFlight, 1u, maxNumFramesInFlight);
+}
+
 void VKSwapChain::AcquireNextColorBuffer()
 {
-    currentFrameInFlight_ = (currentFrameInFlight_ + 1) % maxNumFramesInFlight;
+    currentFrameInFlight_ = (currentFrameInFlight_ + 1) % numFramesInFlight_;
+
+    const Clock::time_point fenceWaitBeginTime = Clock::now();
     vkWaitForFences(device_, 1, inFlightFences_[currentFrameInFlight_].GetAddressOf(), VK_TRUE, UINT64_MAX);
+    const Clock::time_point acquireBeginTime = Clock::now();
 
     vkAcquireNextImageKHR(
         device_,
@@ -774,9 +834,66 @@ void VKSwapChain::AcquireNextColorBuffer()
         currentColorBuffer_, numColorBuffers_
     );
 
+    frameTimings_.fenceWaitTime     = GetElapsedNanoseconds(fenceWaitBeginTime, acquireBeginTime);
+    frameTimings_.acquireWaitTime   = GetElapsedNanoseconds(acquireBeginTime, Clock::now());
+
     vkResetFences(device_, 1, inFlightFences_[currentFrameInFlight_].GetAddressOf());
 }
 
+void VKSwapChain::UpdateFrameTimeEstimates(const Clock::time_point& presentBeginTime)
+{
+    if (frameTimings_.frameCount > 1)
+    {
+        /* Blend timings of this frame into the running averages */
+        frameTimings_.frameTime = GetElapsedNanoseconds(lastPresentBeginTime_, presentBeginTime);
+        const double cpuWorkTime = static_cast<double>(GetElapsedNanoseconds(lastPresentEndTime_, presentBeginTime));
+        if (frameTimings_.frameCount > 2)
+        {
+            avgFrameTime_   += (static_cast<double>(frameTimings_.frameTime) - avgFrameTime_) * g_frameTimeSmoothing;
+            avgCpuWorkTime_ += (cpuWorkTime - avgCpuWorkTime_) * g_frameTimeSmoothing;
+        }
+        else
+        {
+            avgFrameTime_   = static_cast<double>(frameTimings_.frameTime);
+            avgCpuWorkTime_ = cpuWorkTime;
+        }
+    }
+    lastPresentBeginTime_ = presentBeginTime;
+}
+
+void VKSwapChain::SleepForLowLatency()
+{
+    frameTimings_.latencySleepTime = 0;
+
+    /* Count the frames the GPU is still working on; the fence of the current frame has just been reset and is not submitted yet */
+    std::uint32_t numPendingFrames = 0;
+    for_range(i, numFramesInFlight_)
+    {
+        if (i != currentFrameInFlight_ && vkGetFenceStatus(device_, inFlightFences_[i]) == VK_NOT_READY)
+            ++numPendingFrames;
+    }
+
+    if (numPendingFrames == 0)
+        return;
+
+    /*
+    Whenever frames are pending, the GPU or presentation engine is the bottleneck and the average frame time approximates the duration of each pending frame.
+    The oldest pending frame is already in progress, so only half of it is accounted for, which keeps the GPU fed if the estimate is slightly off.
+    The next frame should be submitted just when the pending frames are done, so the CPU work time of the next frame is subtracted.
+    */
+    const double sleepTime = std::min(
+        (static_cast<double>(numPendingFrames) - 0.5) * avgFrameTime_ - avgCpuWorkTime_,
+        avgFrameTime_
+    );
+
+    if (sleepTime > 0.0)
+    {
+        const Clock::time_point sleepBeginTime = Clock::now();
+        std::this_thread::sleep_for(std::chrono::nanoseconds{ static_cast<std::int64_t>(sleepTime) });
+        frameTimings_.latencySleepTime = GetElapsedNanoseconds(sleepBeginTime, Clock::now());
+    }
+}
+
 
 } // /namespace LLGL
 
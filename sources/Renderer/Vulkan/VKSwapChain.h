@@ -19,6 +19,7 @@
 #include "Texture/VKColorBuffer.h"
 #include <memory>
 #include <vector>
+#include <chrono>
 
 
 namespace LLGL
@@ -26,6 +27,8 @@ namespace LLGL
 
 
 class VKCommandContext;
+class VKCommandQueue;
+class VKRenderSystem;
 class VKDeviceMemoryManager;
 class VKDeviceMemoryRegion;
 
@@ -39,15 +42,21 @@ class VKSwapChain final : public SwapChain
     public:
 
         VKSwapChain(
+            VKRenderSystem&                 renderSystem,
             VkInstance                      instance,
             VkPhysicalDevice                physicalDevice,
             VkDevice                        device,
             VKDeviceMemoryManager&          deviceMemoryMngr,
             const SwapChainDescriptor&      desc,
             const std::shared_ptr<Surface>& surface,
-            const RendererInfo&             rendererInfo
+            const RendererInfo&             rendererInfo,
+            VKCommandQueue*                 commandQueue    = nullptr
         );
 
+        bool GetFrameTimings(SwapChainFrameTimings& outTimings) const override;
+
+    public:
+
         // Returns the swap-chain render pass object.
         inline const VKRenderPass& GetSwapChainRenderPass() const
         {
@@ -119,13 +128,23 @@ class VKSwapChain final : public SwapChain
         VkExtent2D PickSwapExtent(const VkSurfaceCapabilitiesKHR& surfaceCaps, const Extent2D& resolution) const;
         VkFormat PickDepthStencilFormat(int depthBits, int stencilBits) const;
         std::uint32_t PickSwapChainSize(std::uint32_t swapBuffers) const;
+        std::uint32_t PickNumFramesInFlight(std::uint32_t framesInFlight) const;
 
         void AcquireNextColorBuffer();
 
+        // Updates the running averages of the frame time and CPU work time with the timings of the current frame.
+        void UpdateFrameTimeEstimates(const std::chrono::steady_clock::time_point& presentBeginTime);
+
+        // Sleeps until the GPU is expected to become idle, minus the time the CPU needs to record the next frame.
+        void SleepForLowLatency();
+
     private:
 
+        using Clock = std::chrono::steady_clock;
+
         static constexpr std::uint32_t maxNumFramesInFlight = 3;
 
+        VKRenderSystem&                     renderSystem_;
         VkInstance                          instance_                                   = VK_NULL_HANDLE;
         VkPhysicalDevice                    physicalDevice_                             = VK_NULL_HANDLE;
         VkDevice                            device_;
@@ -147,6 +166,7 @@ class VKSwapChain final : public SwapChain
         std::uint32_t                       numPreferredColorBuffers_                   = 2;
         std::uint32_t                       numColorBuffers_                            = 0;
         std::uint32_t                       currentColorBuffer_                         = 0; // determined by vkAcquireNextImageKHR
+        std::uint32_t                       numFramesInFlight_                          = maxNumFramesInFlight;
         std::uint32_t                       currentFrameInFlight_                       = 0; // current index for maximum frames in flight
         std::uint32_t                       vsyncInterval_                              = 0;
 
@@ -155,6 +175,7 @@ class VKSwapChain final : public SwapChain
         VKDepthStencilBuffer                depthStencilBuffer_;
         std::vector<VKColorBuffer>          colorBuffers_;
 
+        VKCommandQueue*                     commandQueue_                               = nullptr;
         VkQueue                             graphicsQueue_                              = VK_NULL_HANDLE;
         VkQueue                             presentQueue_                               = VK_NULL_HANDLE;
 
@@ -162,6 +183,13 @@ class VKSwapChain final : public SwapChain
         VKPtr<VkSemaphore>                  renderFinishedSemaphore_[maxNumFramesInFlight];
         VKPtr<VkFence>                      inFlightFences_[maxNumFramesInFlight];
 
+        bool                                lowLatency_                                 = false;
+        SwapChainFrameTimings               frameTimings_;
+        Clock::time_point                   lastPresentBeginTime_;
+        Clock::time_point                   lastPresentEndTime_;
+        double                              avgFrameTime_                               = 0.0; // running average in nanoseconds
+        double                              avgCpuWorkTime_                             = 0.0; // running average in nanoseconds
+
 };
 
 
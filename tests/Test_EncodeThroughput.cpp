@@ -0,0 +1,118 @@
+/*
+ * Test_EncodeThroughput.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utils/VertexFormat.h>
+#include <functional>
+#include <exception>
+
+
+/*
+Measures the CPU time to encode draw commands with the Null backend.
+If LLGL was built with LLGL_STATIC_BACKEND=Null, the same commands are also encoded via the devirtualized StaticCommandBuffer interface.
+*/
+
+static const std::uint32_t g_numFrames          = 200;
+static const std::uint32_t g_numDrawsPerFrame   = 10000;
+
+static double MeasureEncoding(const std::function<void()>& encodeFrame)
+{
+    const std::uint64_t startTick = LLGL::Timer::Tick();
+
+    for (std::uint32_t frame = 0; frame < g_numFrames; ++frame)
+        encodeFrame();
+
+    const std::uint64_t endTick = LLGL::Timer::Tick();
+
+    return static_cast<double>(endTick - startTick) * 1000.0 / static_cast<double>(LLGL::Timer::Frequency());
+}
+
+static void PrintResult(const char* name, double elapsedTime)
+{
+    const double numDraws = static_cast<double>(g_numFrames) * static_cast<double>(g_numDrawsPerFrame);
+    LLGL::Log::Printf(
+        "%s: %.2f ms (%.2f ns/draw, %.2f M draws/s)\n",
+        name, elapsedTime, elapsedTime * 1.0e6 / numDraws, numDraws / (elapsedTime * 1000.0)
+    );
+}
+
+int main()
+{
+    try
+    {
+        LLGL::Log::RegisterCallbackStd();
+
+        // Load Null render system without debugger, since the debug layer cannot be devirtualized
+        LLGL::RenderSystemPtr renderer = LLGL::RenderSystem::Load("Null");
+        if (!renderer)
+            return 1;
+
+        LLGL::VertexFormat vertexFormat;
+        vertexFormat.AppendAttribute({ "position", LLGL::Format::RGB32Float });
+
+        const float vertices[] = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+        LLGL::BufferDescriptor vertexBufferDesc;
+        {
+            vertexBufferDesc.size           = sizeof(vertices);
+            vertexBufferDesc.bindFlags      = LLGL::BindFlags::VertexBuffer;
+            vertexBufferDesc.vertexAttribs  = vertexFormat.attributes;
+        }
+        LLGL::Buffer* vertexBuffer = renderer->CreateBuffer(vertexBufferDesc, vertices);
+
+        LLGL::CommandBuffer* commands = renderer->CreateCommandBuffer();
+
+        // Encode commands through virtual CommandBuffer interface
+        const double virtualTime = MeasureEncoding(
+            [&]()
+            {
+                commands->Begin();
+                for (std::uint32_t i = 0; i < g_numDrawsPerFrame; ++i)
+                {
+                    commands->SetVertexBuffer(*vertexBuffer);
+                    commands->SetResource(0, *vertexBuffer);
+                    commands->Draw(3, 0);
+                }
+                commands->End();
+            }
+        );
+        PrintResult("CommandBuffer      ", virtualTime);
+
+        #ifdef LLGL_STATIC_BACKEND_NULL
+
+        // Encode commands through devirtualized StaticCommandBuffer interface
+        LLGL::StaticCommandBuffer staticCommands{ *commands };
+        const double staticTime = MeasureEncoding(
+            [&]()
+            {
+                staticCommands.Begin();
+                for (std::uint32_t i = 0; i < g_numDrawsPerFrame; ++i)
+                {
+                    staticCommands.SetVertexBuffer(*vertexBuffer);
+                    staticCommands.SetResource(0, *vertexBuffer);
+                    staticCommands.Draw(3, 0);
+                }
+                staticCommands.End();
+            }
+        );
+        PrintResult("StaticCommandBuffer", staticTime);
+
+        #else
+
+        LLGL::Log::Printf("StaticCommandBuffer: not available (LLGL was not built with LLGL_STATIC_BACKEND=Null)\n");
+
+        #endif // /LLGL_STATIC_BACKEND_NULL
+    }
+    catch (const std::exception& e)
+    {
+        LLGL::Log::Errorf("%s\n", e.what());
+    }
+    return 0;
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,38 @@
+/*
+ * MultiBind.330core.frag
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#version 330 core
+
+in vec2 vTexCoord;
+
+out vec4 outColor;
+
+uniform sampler2D colorMap0;
+uniform sampler2D colorMap1;
+uniform sampler2D colorMap2;
+uniform sampler2D colorMap3;
+uniform sampler2D colorMap4;
+uniform sampler2D colorMap5;
+uniform sampler2D colorMap6;
+uniform sampler2D colorMap7;
+
+void main()
+{
+    // Sample all textures uniformly and select one per vertical stripe, so each of the eight texture/sampler bindings covers its own section of the framebuffer
+    vec4 colors[8] = vec4[8](
+        texture(colorMap0, vTexCoord),
+        texture(colorMap1, vTexCoord),
+        texture(colorMap2, vTexCoord),
+        texture(colorMap3, vTexCoord),
+        texture(colorMap4, vTexCoord),
+        texture(colorMap5, vTexCoord),
+        texture(colorMap6, vTexCoord),
+        texture(colorMap7, vTexCoord)
+    );
+    int stripe = clamp(int(vTexCoord.x * 8.0), 0, 7);
+    outColor = colors[stripe];
+}
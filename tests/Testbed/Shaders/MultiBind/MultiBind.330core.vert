@@ -0,0 +1,19 @@
+/*
+ * MultiBind.330core.vert
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#version 330 core
+
+in vec3 position;
+in vec2 texCoord;
+
+out vec2 vTexCoord;
+
+void main()
+{
+    gl_Position = vec4(position.xy, 0, 1);
+    vTexCoord = texCoord;
+}
@@ -381,6 +381,7 @@ unsigned TestbedContext::RunAllTests()
     // Run all command buffer tests
     RUN_TEST( CommandBufferSubmit         );
     RUN_TEST( CommandBufferEncode         );
+    RUN_TEST( CommandBufferDrawOverhead   );
 
     // Run all resource tests
     RUN_TEST( NativeHandle                );
@@ -389,6 +390,7 @@ unsigned TestbedContext::RunAllTests()
     RUN_TEST( BufferFill                  );
     RUN_TEST( BufferUpdate                );
     RUN_TEST( BufferCopy                  );
+    RUN_TEST( BufferWriteDynamic          );
     RUN_TEST( TextureTypes                );
     RUN_TEST( TextureWriteAndRead         );
     RUN_TEST( TextureCopy                 );
@@ -400,8 +402,11 @@ unsigned TestbedContext::RunAllTests()
     RUN_TEST( MipMaps                     );
     RUN_TEST( PipelineCaching             );
     RUN_TEST( ShaderErrors                );
+    RUN_TEST( ShaderVariantCache          );
     RUN_TEST( SamplerBuffer               );
     RUN_TEST( BarrierReadAfterWrite       );
+    RUN_TEST( ResourceHeapUpdate          );
+    RUN_TEST( MemoryHeapAliasing          );
 
     // Run all rendering tests
     RUN_TEST( DepthBuffer                 );
@@ -414,6 +419,8 @@ unsigned TestbedContext::RunAllTests()
     RUN_TEST( CommandBufferSecondary      );
     RUN_TEST( TriangleStripCutOff         );
     RUN_TEST( TextureViews                );
+    RUN_TEST( ResourceHeapUpdateOrder     );
+    RUN_TEST( TextureViewPool             );
     RUN_TEST( TextureStrides              );
     RUN_TEST( Uniforms                    );
     RUN_TEST( ShadowMapping               );
@@ -423,12 +430,14 @@ unsigned TestbedContext::RunAllTests()
     RUN_TEST( StreamOutput                );
     RUN_TEST( ResourceCopy                );
     RUN_TEST( CombinedTexSamplers         );
+    RUN_TEST( MultiBind                   );
     RUN_TEST( MeshShaders                 );
 
     // Reset main renderer and run C99 tests
     // LLGL can't run the same render system in multiple instances (confuses the context management in GL backend)
     renderer.reset();
     RUN_C99_TEST( OffscreenC99 );
+    RUN_C99_TEST( DescriptorIndexingC99 );
 
     #undef RUN_TEST
 
@@ -473,6 +482,10 @@ unsigned TestbedContext::RunRendererIndependentTests(int argc, char* argv[])
     RUN_TEST( ParseUtil );
     RUN_TEST( ImageConversions );
     RUN_TEST( ImageStrides );
+    RUN_TEST( ImageContainer );
+    RUN_TEST( ImageCompression );
+    RUN_TEST( ImageDecompression );
+    RUN_TEST( Allocator );
 
     #undef RUN_TEST
 
@@ -881,6 +894,21 @@ bool TestbedContext::HasUniqueBindingSlots() const
     return (renderer->GetRendererID() == RendererID::Vulkan);
 }
 
+bool TestbedContext::HasBatchedResourceHeapUpdates() const
+{
+    switch (renderer->GetRendererID())
+    {
+        case RendererID::Null:
+        case RendererID::OpenGL:
+        case RendererID::OpenGLES:
+        case RendererID::WebGL:
+        case RendererID::Vulkan:
+            return true;
+        default:
+            return false;
+    }
+}
+
 float TestbedContext::GetAspectRatio() const
 {
     const Extent2D resolution = swapChain->GetResolution();
@@ -1109,6 +1137,8 @@ bool TestbedContext::LoadShaders()
         shaders[VSVertexFormat2]    = LoadShaderFromFile("VertexFormats.330core.vert",         ShaderType::Vertex,          nullptr, nullptr, definesVerexFormat1, VertFmtLayout2);
         shaders[VSVertexFormat3]    = LoadShaderFromFile("VertexFormats.330core.vert",         ShaderType::Vertex,          nullptr, nullptr, nullptr, VertFmtLayout3);
         shaders[PSVertexFormat]     = LoadShaderFromFile("VertexFormats.330core.frag",         ShaderType::Fragment);
+        shaders[VSMultiBind]        = LoadShaderFromFile("MultiBind.330core.vert",             ShaderType::Vertex);
+        shaders[PSMultiBind]        = LoadShaderFromFile("MultiBind.330core.frag",             ShaderType::Fragment);
     }
     else if (IsShadingLanguageSupported(ShadingLanguage::Metal))
     {
@@ -107,6 +107,9 @@ class TestbedContext
         // Returns true if the current renderer requires unique bindings slots (Vulkan only).
         bool HasUniqueBindingSlots() const;
 
+        // Returns true if the current renderer records resource heap writes until they are committed (OpenGL, Vulkan, and Null only).
+        bool HasBatchedResourceHeapUpdates() const;
+
         // Returns the aspect ratio of the main viewport.
         float GetAspectRatio() const;
 
@@ -199,6 +202,9 @@ class TestbedContext
             MSMeshlet,
             PSMeshlet,
 
+            VSMultiBind,
+            PSMultiBind,
+
             ShaderCount,
         };
 
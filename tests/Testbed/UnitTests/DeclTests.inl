@@ -26,6 +26,10 @@ DECL_RITEST( ContainerStringOperators );
 DECL_RITEST( ParseUtil );
 DECL_RITEST( ImageConversions );
 DECL_RITEST( ImageStrides );
+DECL_RITEST( ImageContainer );
+DECL_RITEST( ImageCompression );
+DECL_RITEST( ImageDecompression );
+DECL_RITEST( Allocator );
 
 #undef DECL_RITEST
 
@@ -46,6 +50,7 @@ DECL_TEST( CommandBufferSubmit );
 DECL_TEST( CommandBufferEncode );
 DECL_TEST( CommandBufferSecondary );
 DECL_TEST( CommandBufferMultiThreading );
+DECL_TEST( CommandBufferDrawOverhead );
 
 // Resource tests
 DECL_TEST( BufferWriteAndRead );
@@ -53,6 +58,7 @@ DECL_TEST( BufferMap );
 DECL_TEST( BufferFill );
 DECL_TEST( BufferUpdate );
 DECL_TEST( BufferCopy );
+DECL_TEST( BufferWriteDynamic );
 DECL_TEST( BufferToTextureCopy );
 DECL_TEST( TextureCopy );
 DECL_TEST( TextureToBufferCopy );
@@ -64,9 +70,12 @@ DECL_TEST( RenderTargetNAttachments );
 DECL_TEST( MipMaps );
 DECL_TEST( PipelineCaching );
 DECL_TEST( ShaderErrors );
+DECL_TEST( ShaderVariantCache );
 DECL_TEST( SamplerBuffer );
 DECL_TEST( NativeHandle );
 DECL_TEST( BarrierReadAfterWrite );
+DECL_TEST( ResourceHeapUpdate );
+DECL_TEST( MemoryHeapAliasing );
 
 // Rendering tests
 DECL_TEST( DepthBuffer );
@@ -77,6 +86,8 @@ DECL_TEST( BlendStates );
 DECL_TEST( DualSourceBlending );
 DECL_TEST( TriangleStripCutOff );
 DECL_TEST( TextureViews );
+DECL_TEST( ResourceHeapUpdateOrder );
+DECL_TEST( TextureViewPool );
 DECL_TEST( TextureStrides );
 DECL_TEST( Uniforms );
 DECL_TEST( ShadowMapping );
@@ -86,10 +97,12 @@ DECL_TEST( ResourceArrays );
 DECL_TEST( StreamOutput );
 DECL_TEST( ResourceCopy );
 DECL_TEST( CombinedTexSamplers );
+DECL_TEST( MultiBind );
 DECL_TEST( MeshShaders );
 
 // C99 tests
 DECL_TEST( OffscreenC99 );
+DECL_TEST( DescriptorIndexingC99 );
 
 #undef DECL_TEST
 
@@ -0,0 +1,209 @@
+/*
+ * TestAllocator.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Allocator.h>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+
+// Upstream allocator that counts the allocations per category it receives.
+class CountingAllocator final : public Allocator
+{
+
+    public:
+
+        void* Allocate(std::size_t size, std::size_t alignment, AllocationCategory category) override
+        {
+            void* ptr = ::malloc(size + alignment + sizeof(void*));
+            if (ptr == nullptr)
+                return nullptr;
+
+            /* Store the original address in front of the aligned address */
+            const std::uintptr_t addr = (reinterpret_cast<std::uintptr_t>(ptr) + sizeof(void*) + alignment - 1) & ~(alignment - 1);
+            ::memcpy(reinterpret_cast<void*>(addr - sizeof(void*)), &ptr, sizeof(void*));
+            ++numAllocations[static_cast<int>(category)];
+            return reinterpret_cast<void*>(addr);
+        }
+
+        void Free(void* ptr, std::size_t /*size*/, std::size_t /*alignment*/, AllocationCategory category) override
+        {
+            void* mem = nullptr;
+            ::memcpy(&mem, static_cast<char*>(ptr) - sizeof(void*), sizeof(void*));
+            ::free(mem);
+            --numAllocations[static_cast<int>(category)];
+        }
+
+    public:
+
+        int numAllocations[static_cast<int>(AllocationCategory::Native) + 1] = {};
+
+};
+
+static bool IsAligned(const void* ptr, std::size_t alignment)
+{
+    return ((reinterpret_cast<std::uintptr_t>(ptr) & (alignment - 1)) == 0);
+}
+
+DEF_RITEST( Allocator )
+{
+    TestResult result = TestResult::Passed;
+
+    CountingAllocator upstream;
+
+    #define TEST_ALLOCATOR(COND)                                                    \
+        if (!(COND))                                                                \
+        {                                                                           \
+            Log::Errorf("Allocator test failed at line %d: %s\n", __LINE__, #COND); \
+            result = TestResult::FailedMismatch;                                    \
+        }
+
+    // Allocate transient memory from arena with different alignments
+    {
+        FrameArenaAllocator arena{ 256, &upstream };
+
+        void* a = arena.Allocate(100, 4, AllocationCategory::Transient);
+        void* b = arena.Allocate(8, 64, AllocationCategory::Transient);
+        TEST_ALLOCATOR(a != nullptr && b != nullptr);
+        TEST_ALLOCATOR(IsAligned(a, 4) && IsAligned(b, 64));
+        TEST_ALLOCATOR(arena.GetCapacity(AllocationCategory::Transient) == 256);
+        TEST_ALLOCATOR(upstream.numAllocations[static_cast<int>(AllocationCategory::Transient)] == 1);
+
+        // Grow most recent allocation in place
+        void* b2 = arena.Reallocate(b, 8, 32, 64, AllocationCategory::Transient);
+        TEST_ALLOCATOR(b2 == b);
+
+        // Allocation that exceeds the block size must append a new block
+        void* c = arena.Allocate(1000, 16, AllocationCategory::Transient);
+        TEST_ALLOCATOR(c != nullptr && IsAligned(c, 16));
+        TEST_ALLOCATOR(arena.GetCapacity(AllocationCategory::Transient) >= 256 + 1000);
+
+        // Move allocation that is not the most recent one and preserve its content
+        ::memset(a, 0x5A, 100);
+        void* a2 = arena.Reallocate(a, 100, 200, 4, AllocationCategory::Transient);
+        TEST_ALLOCATOR(a2 != nullptr && a2 != a && static_cast<const unsigned char*>(a2)[99] == 0x5A);
+
+        // Freeing all allocations merges the blocks into one, so the next frame fits into a single block
+        const std::size_t capacity = arena.GetCapacity(AllocationCategory::Transient);
+        arena.Free(a2, 200, 4, AllocationCategory::Transient);
+        arena.Free(b2, 32, 64, AllocationCategory::Transient);
+        arena.Free(c, 1000, 16, AllocationCategory::Transient);
+        TEST_ALLOCATOR(arena.GetCapacity(AllocationCategory::Transient) == capacity);
+        TEST_ALLOCATOR(upstream.numAllocations[static_cast<int>(AllocationCategory::Transient)] == 1);
+
+        void* d = arena.Allocate(capacity, 8, AllocationCategory::Transient);
+        TEST_ALLOCATOR(d != nullptr && arena.GetCapacity(AllocationCategory::Transient) == capacity);
+        arena.Free(d, capacity, 8, AllocationCategory::Transient);
+
+        // Command buffer memory uses its own arena and other categories are forwarded upstream
+        void* e = arena.Allocate(64, 8, AllocationCategory::CommandBuffer);
+        void* f = arena.Allocate(64, 8, AllocationCategory::Object);
+        TEST_ALLOCATOR(arena.GetCapacity(AllocationCategory::CommandBuffer) == 256);
+        TEST_ALLOCATOR(arena.GetCapacity(AllocationCategory::Object) == 0);
+        TEST_ALLOCATOR(upstream.numAllocations[static_cast<int>(AllocationCategory::CommandBuffer)] == 1);
+        TEST_ALLOCATOR(upstream.numAllocations[static_cast<int>(AllocationCategory::Object)] == 1);
+        arena.Free(e, 64, 8, AllocationCategory::CommandBuffer);
+        arena.Free(f, 64, 8, AllocationCategory::Object);
+        TEST_ALLOCATOR(upstream.numAllocations[static_cast<int>(AllocationCategory::Object)] == 0);
+
+        // Memory that is freed out of order must be reused while other allocations are still alive
+        void* g = arena.Allocate(64, 8, AllocationCategory::CommandBuffer);
+        void* h = arena.Allocate(64, 8, AllocationCategory::CommandBuffer);
+        void* k = arena.Allocate(64, 8, AllocationCategory::CommandBuffer);
+        arena.Free(g, 64, 8, AllocationCategory::CommandBuffer);
+        arena.Free(h, 64, 8, AllocationCategory::CommandBuffer);
+        void* g2 = arena.Allocate(128, 8, AllocationCategory::CommandBuffer);
+        TEST_ALLOCATOR(g2 == g);
+        arena.Free(k, 64, 8, AllocationCategory::CommandBuffer);
+        arena.Free(g2, 128, 8, AllocationCategory::CommandBuffer);
+        TEST_ALLOCATOR(arena.GetCapacity(AllocationCategory::CommandBuffer) == 256);
+    }
+
+    // All arena blocks must have been returned to the upstream allocator
+    for (int n : upstream.numAllocations)
+        TEST_ALLOCATOR(n == 0);
+
+    // Route allocations of a render system through the arena
+    {
+        FrameArenaAllocator arena{ 1024*1024, &upstream };
+
+        const AllocationUsage objectUsage0          = GetAllocationUsage(AllocationCategory::Object);
+        const AllocationUsage commandBufferUsage0   = GetAllocationUsage(AllocationCategory::CommandBuffer);
+
+        RenderSystemDescriptor rendererDesc = "Null";
+        {
+            rendererDesc.allocator = &arena;
+        }
+        RenderSystemPtr renderer = RenderSystem::Load(rendererDesc);
+        if (!renderer)
+        {
+            Log::Printf("Null renderer not available; skip allocator routing test\n");
+            return (result == TestResult::Passed ? TestResult::Skipped : result);
+        }
+
+        CommandBuffer* cmdBuffer = renderer->CreateCommandBuffer();
+        {
+            cmdBuffer->Begin();
+            {
+                for_range(i, 1000)
+                    cmdBuffer->Draw(3, i);
+            }
+            cmdBuffer->End();
+        }
+
+        // Create and destroy command buffers while the first one stays alive; the arena must not grow with each iteration
+        std::size_t firstCommandBufferCapacity = 0;
+        for_range(frame, 100)
+        {
+            CommandBuffer* frameCmdBuffer = renderer->CreateCommandBuffer();
+            {
+                frameCmdBuffer->Begin();
+                {
+                    for_range(i, 1000)
+                        frameCmdBuffer->Draw(3, i);
+                }
+                frameCmdBuffer->End();
+            }
+            renderer->Release(*frameCmdBuffer);
+
+            if (frame == 0)
+                firstCommandBufferCapacity = arena.GetCapacity(AllocationCategory::CommandBuffer);
+        }
+        TEST_ALLOCATOR(arena.GetCapacity(AllocationCategory::CommandBuffer) == firstCommandBufferCapacity);
+
+        const AllocationUsage objectUsage1          = GetAllocationUsage(AllocationCategory::Object);
+        const AllocationUsage commandBufferUsage1   = GetAllocationUsage(AllocationCategory::CommandBuffer);
+
+        TEST_ALLOCATOR(objectUsage1.numAllocations > objectUsage0.numAllocations);
+        TEST_ALLOCATOR(commandBufferUsage1.totalAllocations > commandBufferUsage0.totalAllocations);
+        TEST_ALLOCATOR(commandBufferUsage1.currentSize > commandBufferUsage0.currentSize);
+        TEST_ALLOCATOR(arena.GetCapacity(AllocationCategory::CommandBuffer) >= commandBufferUsage1.currentSize - commandBufferUsage0.currentSize);
+        TEST_ALLOCATOR(upstream.numAllocations[static_cast<int>(AllocationCategory::Object)] > 0);
+
+        // Loading another render system with a different allocator must fail while this one is alive
+        RenderSystemDescriptor otherRendererDesc = "Null";
+        RenderSystemPtr otherRenderer = RenderSystem::Load(otherRendererDesc);
+        TEST_ALLOCATOR(!otherRenderer);
+
+        RenderSystem::Unload(std::move(renderer));
+
+        const AllocationUsage objectUsage2          = GetAllocationUsage(AllocationCategory::Object);
+        const AllocationUsage commandBufferUsage2   = GetAllocationUsage(AllocationCategory::CommandBuffer);
+
+        TEST_ALLOCATOR(objectUsage2.currentSize == objectUsage0.currentSize);
+        TEST_ALLOCATOR(commandBufferUsage2.currentSize == commandBufferUsage0.currentSize);
+        TEST_ALLOCATOR(commandBufferUsage2.peakSize >= commandBufferUsage1.currentSize);
+    }
+
+    for (int n : upstream.numAllocations)
+        TEST_ALLOCATOR(n == 0);
+
+    #undef TEST_ALLOCATOR
+
+    return result;
+}
@@ -0,0 +1,119 @@
+/*
+ * TestBufferWriteDynamic.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+
+
+/*
+Writes the same data repeatedly into a static buffer and a buffer with MiscFlags::DynamicUsage and measures the CPU time per write.
+With the Vulkan backend on devices with host visible device memory (ReBAR/UMA), the dynamic buffer is written directly without staging buffer.
+The writes are timed while a frame that does not reference either buffer is still in flight, so they must not wait for the GPU to become idle.
+*/
+DEF_TEST( BufferWriteDynamic )
+{
+    constexpr std::uint32_t numValues = 1024;
+
+    const std::uint32_t numWrites = (opt.fastTest ? 20 : 200);
+
+    // Create static and dynamic buffer with same size
+    BufferDescriptor buf1Desc;
+    {
+        buf1Desc.size       = numValues * sizeof(std::uint32_t);
+        buf1Desc.bindFlags  = BindFlags::ConstantBuffer;
+    }
+    CREATE_BUFFER(buf1, buf1Desc, "buf1{static}", nullptr);
+
+    BufferDescriptor buf2Desc = buf1Desc;
+    {
+        buf2Desc.miscFlags  = MiscFlags::DynamicUsage;
+    }
+    CREATE_BUFFER(buf2, buf2Desc, "buf2{dynamic}", nullptr);
+
+    std::vector<std::uint32_t> values(numValues);
+
+    // Submit a frame that keeps the GPU busy without referencing any of the written buffers
+    auto SubmitFrameInFlight = [&]()
+    {
+        constexpr std::uint32_t numClears = 16;
+        cmdBuffer->Begin();
+        {
+            for_range(i, numClears)
+            {
+                cmdBuffer->BeginRenderPass(*swapChain);
+                {
+                    cmdBuffer->Clear(ClearFlags::Color, ClearValue{ 0.0f, 0.0f, static_cast<float>(i) / numClears, 1.0f });
+                }
+                cmdBuffer->EndRenderPass();
+            }
+        }
+        cmdBuffer->End();
+    };
+
+    auto WriteRepeatedly = [&](Buffer& buf) -> double
+    {
+        const std::uint64_t t0 = Timer::Tick();
+
+        for_range(i, numWrites)
+        {
+            for_range(j, numValues)
+                values[j] = i * numValues + j;
+            renderer->WriteBuffer(buf, 0, values.data(), buf1Desc.size);
+        }
+
+        const std::uint64_t t1 = Timer::Tick();
+
+        return TestbedContext::ToMillisecs(t0, t1);
+    };
+
+    SubmitFrameInFlight();
+    const double staticWriteTime    = WriteRepeatedly(*buf1);
+    cmdQueue->WaitIdle();
+
+    SubmitFrameInFlight();
+    const double dynamicWriteTime   = WriteRepeatedly(*buf2);
+    cmdQueue->WaitIdle();
+
+    if (opt.showTiming)
+    {
+        Log::Printf(
+            "Buffer writes with frame in flight (%u writes of %" PRIu64 " bytes): static buffer (%.4f ms, %.3f us/write), dynamic buffer (%.4f ms, %.3f us/write)\n",
+            numWrites, buf1Desc.size,
+            staticWriteTime, staticWriteTime * 1000.0 / numWrites,
+            dynamicWriteTime, dynamicWriteTime * 1000.0 / numWrites
+        );
+    }
+
+    // Read back both buffers; they must contain the values of the last write
+    std::vector<std::uint32_t> buf1Data(numValues, 0);
+    std::vector<std::uint32_t> buf2Data(numValues, 0);
+
+    renderer->ReadBuffer(*buf1, 0, buf1Data.data(), buf1Desc.size);
+    renderer->ReadBuffer(*buf2, 0, buf2Data.data(), buf2Desc.size);
+
+    TestResult result = TestResult::Passed;
+
+    if (buf1Data != values)
+    {
+        Log::Errorf("Mismatch between data of static buffer and last written values\n");
+        result = TestResult::FailedMismatch;
+    }
+    if (buf2Data != values)
+    {
+        Log::Errorf("Mismatch between data of dynamic buffer and last written values\n");
+        result = TestResult::FailedMismatch;
+    }
+
+    // Clear resources
+    renderer->Release(*buf1);
+    renderer->Release(*buf2);
+
+    return result;
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,88 @@
+/*
+ * TestCommandBufferDrawOverhead.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+
+
+/*
+Encodes a large number of draw calls with and without intermediate state changes and measures the CPU time per draw call.
+When run with the debug layer (-d), this shows the validation overhead per draw compared to the backend itself (e.g. Null backend).
+*/
+DEF_TEST( CommandBufferDrawOverhead )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    const std::uint32_t numDraws = (opt.fastTest ? 2000 : 20000);
+
+    // Create PSO for solid geometry
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = swapChain->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.depth.testEnabled   = true;
+        psoDesc.depth.writeEnabled  = true;
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    CREATE_GRAPHICS_PSO(pso, psoDesc, "psoDrawOverhead");
+
+    auto EncodeDraws = [&](bool rebindResources) -> double
+    {
+        const std::uint64_t t0 = Timer::Tick();
+
+        cmdBuffer->Begin();
+        {
+            cmdBuffer->BeginRenderPass(*swapChain);
+            {
+                cmdBuffer->Clear(ClearFlags::ColorDepth, bgColorDarkBlue);
+                cmdBuffer->SetViewport(swapChain->GetResolution());
+                cmdBuffer->SetPipelineState(*pso);
+                cmdBuffer->SetVertexBuffer(*meshBuffer);
+                cmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, models[ModelCube].indexBufferOffset);
+                cmdBuffer->SetResource(0, *sceneCbuffer);
+
+                for_range(i, numDraws)
+                {
+                    if (rebindResources)
+                        cmdBuffer->SetResource(0, *sceneCbuffer);
+                    cmdBuffer->DrawIndexed(models[ModelCube].numIndices, 0);
+                }
+            }
+            cmdBuffer->EndRenderPass();
+        }
+        cmdBuffer->End();
+
+        const std::uint64_t t1 = Timer::Tick();
+
+        return TestbedContext::ToMillisecs(t0, t1);
+    };
+
+    const double staticStateTime    = EncodeDraws(false);
+    const double dynamicStateTime   = EncodeDraws(true);
+
+    if (opt.showTiming)
+    {
+        Log::Printf(
+            "Draw overhead (%u draws): static state (%.4f ms, %.3f us/draw), rebinding resources (%.4f ms, %.3f us/draw)\n",
+            numDraws,
+            staticStateTime, staticStateTime * 1000.0 / numDraws,
+            dynamicStateTime, dynamicStateTime * 1000.0 / numDraws
+        );
+    }
+
+    // Clear resources
+    renderer->Release(*pso);
+
+    return TestResult::Passed;
+}
+
+
@@ -0,0 +1,139 @@
+/*
+ * TestDescriptorIndexingC99.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL-C/LLGL.h>
+
+
+#if LLGL_TESTBED_INCLUDE_C99_TESTS
+
+/*
+Creates pipeline layouts with a descriptor-indexed heap binding (LLGLBindingDescriptorIndexing) via the C99 wrapper.
+An array size within LLGLRenderingLimits::maxDescriptorIndexingArraySize must be accepted and an array size beyond it must be reported by the debug layer.
+This only runs with the Null backend, since other backends would forward the invalid array size to the driver.
+*/
+DEF_TEST( DescriptorIndexingC99 )
+{
+    if (moduleName != "Null")
+        return TestResult::Skipped;
+
+    // Create render system with debug layer
+    LLGLReport report = llglAllocReport();
+    LLGLReport debugReport = llglAllocReport();
+    LLGLRenderingDebugger debugger = llglAllocRenderingDebugger();
+
+    auto FreeResources = [&report, &debugReport, &debugger]() -> void
+    {
+        if (LLGL_GET(report))
+            llglFreeReport(report);
+        if (LLGL_GET(debugReport))
+            llglFreeReport(debugReport);
+        if (LLGL_GET(debugger))
+            llglFreeRenderingDebugger(debugger);
+    };
+
+    LLGLRenderSystemDescriptor renderSysDesc = {};
+    renderSysDesc.moduleName    = moduleName.c_str();
+    renderSysDesc.debugger      = debugger;
+
+    if (llglLoadRenderSystemExt(&renderSysDesc, report) == 0)
+    {
+        llglLogErrorf("Failed to load render system \"%s\" via C99 wrapper\n:%s", moduleName.c_str(), llglGetReportText(report));
+        FreeResources();
+        return TestResult::FailedErrors;
+    }
+
+    LLGLRenderingCapabilities caps = {};
+    llglGetRenderingCaps(&caps);
+
+    TestResult result = TestResult::Passed;
+
+    if (!caps.features.hasDescriptorIndexing || caps.limits.maxDescriptorIndexingArraySize == 0)
+    {
+        llglLogErrorf("Expected support for descriptor indexing with a non-zero array size limit in Null backend\n");
+        result = TestResult::FailedMismatch;
+    }
+
+    auto CreateDescriptorIndexingLayout = [](std::uint32_t arraySize) -> LLGLPipelineLayout
+    {
+        LLGLBindingDescriptor heapBinding = {};
+        {
+            heapBinding.name        = "materialTextures";
+            heapBinding.type        = LLGLResourceTypeTexture;
+            heapBinding.bindFlags   = LLGLBindSampled;
+            heapBinding.stageFlags  = LLGLStageFragmentStage;
+            heapBinding.arraySize   = arraySize;
+            heapBinding.flags       = LLGLBindingDescriptorIndexing;
+        }
+        LLGLPipelineLayoutDescriptor layoutDesc = {};
+        {
+            layoutDesc.numHeapBindings  = 1;
+            layoutDesc.heapBindings     = &heapBinding;
+        }
+        return llglCreatePipelineLayout(&layoutDesc);
+    };
+
+    // Collect all reports from the debug layer while the pipeline layouts are created
+    LLGLLogHandle logHandle = llglRegisterLogCallbackReport(debugReport);
+
+    // Array size at the limit must be accepted without errors
+    LLGLPipelineLayout validLayout = CreateDescriptorIndexingLayout(caps.limits.maxDescriptorIndexingArraySize);
+
+    if (llglHasReportErrors(debugReport))
+    {
+        llglLogErrorf(
+            "Unexpected errors for descriptor-indexed heap binding with array size %u:\n%s",
+            caps.limits.maxDescriptorIndexingArraySize, llglGetReportText(debugReport)
+        );
+        result = TestResult::FailedErrors;
+    }
+    else if (llglGetPipelineLayoutNumHeapBindings(validLayout) != caps.limits.maxDescriptorIndexingArraySize)
+    {
+        /* Null backend expands heap binding arrays into one binding per array element */
+        llglLogErrorf(
+            "Mismatch between number of heap bindings in pipeline layout (%u) and expected number (%u)\n",
+            llglGetPipelineLayoutNumHeapBindings(validLayout), caps.limits.maxDescriptorIndexingArraySize
+        );
+        result = TestResult::FailedMismatch;
+    }
+
+    // Array size beyond the limit must be reported; this also requires the binding flags to be passed through the C99 wrapper
+    LLGLPipelineLayout invalidLayout = CreateDescriptorIndexingLayout(caps.limits.maxDescriptorIndexingArraySize + 1);
+
+    if (result == TestResult::Passed && !llglHasReportErrors(debugReport))
+    {
+        llglLogErrorf(
+            "Expected error for descriptor-indexed heap binding with array size %u exceeding limit of %u\n",
+            caps.limits.maxDescriptorIndexingArraySize + 1, caps.limits.maxDescriptorIndexingArraySize
+        );
+        result = TestResult::FailedMismatch;
+    }
+
+    llglUnregisterLogCallback(logHandle);
+
+    // Clean up entire C99 render system
+    llglReleasePipelineLayout(validLayout);
+    llglReleasePipelineLayout(invalidLayout);
+
+    FreeResources();
+    llglUnloadRenderSystem();
+
+    return result;
+}
+
+#else // LLGL_TESTBED_INCLUDE_C99_TESTS
+
+DEF_TEST( DescriptorIndexingC99 )
+{
+    return TestResult::Skipped; // C99 tests not included
+}
+
+#endif // /LLGL_TESTBED_INCLUDE_C99_TESTS
+
+
+
+// ================================================================================
@@ -0,0 +1,202 @@
+/*
+ * TestImageCompression.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Utils/Image.h>
+#include <LLGL/Utils/TypeNames.h>
+#include <cmath>
+
+
+// Returns the peak signal-to-noise ratio (in dB) over the first 'numComponents' components of two RGBA8 images.
+static double ComputePSNR(const std::uint8_t* lhs, const std::uint8_t* rhs, std::size_t numPixels, std::uint32_t numComponents)
+{
+    double squaredError = 0.0;
+    for_range(i, numPixels)
+    {
+        for_range(c, numComponents)
+        {
+            const double delta = static_cast<double>(lhs[i*4 + c]) - static_cast<double>(rhs[i*4 + c]);
+            squaredError += delta * delta;
+        }
+    }
+    if (squaredError == 0.0)
+        return INFINITY;
+    const double meanSquaredError = squaredError / static_cast<double>(numPixels * numComponents);
+    return 10.0 * std::log10(255.0 * 255.0 / meanSquaredError);
+}
+
+/*
+Compresses images into BC1, BC3, BC4, and BC5 with both quality levels, decompresses them again,
+and validates the peak signal-to-noise ratio (PSNR). With -t, the PSNR and throughput (MPix/s) are printed.
+*/
+DEF_RITEST( ImageCompression )
+{
+    const std::string imagePath = "../Media/Textures/";
+
+    struct CompressionFormat
+    {
+        Format          format;
+        std::uint32_t   numComponents;  // Number of components that are encoded
+        double          minPSNR;        // Minimum PSNR (in dB) that is accepted for the natural test images
+    };
+
+    const CompressionFormat compressionFormats[] =
+    {
+        { Format::BC1UNorm, 3, 25.0 },
+        { Format::BC3UNorm, 4, 25.0 },
+        { Format::BC4UNorm, 1, 30.0 },
+        { Format::BC5UNorm, 2, 30.0 },
+    };
+
+    auto TestCompression = [&](const std::string& filename) -> TestResult
+    {
+        Image img = TestbedContext::LoadImageFromFile(imagePath + filename, opt.verbose);
+        img.Convert(ImageFormat::RGBA, DataType::UInt8);
+
+        // Crop image extent to multiple of 4 as required for decompression; source rows keep their original stride
+        const Extent2D extent{ img.GetExtent().width & ~3u, img.GetExtent().height & ~3u };
+
+        ImageView srcImageView = img.GetView();
+        srcImageView.rowStride = img.GetExtent().width * 4;
+
+        DynamicByteArray croppedImage{ extent.width * extent.height * 4, UninitializeTag{} };
+        for_range(y, extent.height)
+            ::memcpy(croppedImage.get() + y * extent.width * 4, static_cast<const char*>(img.GetData()) + y * srcImageView.rowStride, extent.width * 4);
+
+        const std::size_t numPixels = extent.width * extent.height;
+
+        for (const CompressionFormat& compressionFormat : compressionFormats)
+        {
+            double psnr[2] = {};
+            double timeMs[2] = {};
+
+            for (ImageCompressionQuality quality : { ImageCompressionQuality::Fast, ImageCompressionQuality::High })
+            {
+                const std::uint32_t qualityIndex = static_cast<std::uint32_t>(quality);
+
+                const std::uint64_t t0 = Timer::Tick();
+                DynamicByteArray compressedData = CompressImageBuffer(compressionFormat.format, srcImageView, extent, quality, LLGL_MAX_THREAD_COUNT);
+                const std::uint64_t t1 = Timer::Tick();
+
+                const std::size_t expectedSize = numPixels * GetFormatAttribs(compressionFormat.format).bitSize / 16;
+                if (compressedData.size() != expectedSize)
+                {
+                    Log::Errorf(
+                        Log::ColorFlags::StdError,
+                        "Mismatch between compressed image size of '%s' in %s format (%zu bytes) and expected size (%zu bytes)\n",
+                        filename.c_str(), ToString(compressionFormat.format), compressedData.size(), expectedSize
+                    );
+                    return TestResult::FailedMismatch;
+                }
+
+                const ImageView compressedImageView{ ImageFormat::Compressed, DataType::UInt8, compressedData.get(), compressedData.size() };
+                DynamicByteArray decompressedData = DecompressImageBufferToRGBA8UNorm(compressionFormat.format, compressedImageView, extent);
+
+                psnr[qualityIndex] = ComputePSNR(
+                    reinterpret_cast<const std::uint8_t*>(croppedImage.get()),
+                    reinterpret_cast<const std::uint8_t*>(decompressedData.get()),
+                    numPixels,
+                    compressionFormat.numComponents
+                );
+                timeMs[qualityIndex] = TestbedContext::ToMillisecs(t0, t1);
+
+                if (psnr[qualityIndex] < compressionFormat.minPSNR)
+                {
+                    Log::Errorf(
+                        Log::ColorFlags::StdError,
+                        "PSNR of '%s' in %s format (%.2f dB) is below threshold (%.2f dB)\n",
+                        filename.c_str(), ToString(compressionFormat.format), psnr[qualityIndex], compressionFormat.minPSNR
+                    );
+                    return TestResult::FailedMismatch;
+                }
+            }
+
+            // High quality must never be worse than fast quality, since cluster fit only replaces range fit results with lower error
+            if (psnr[1] + 0.01 < psnr[0])
+            {
+                Log::Errorf(
+                    Log::ColorFlags::StdError,
+                    "PSNR of '%s' in %s format with high quality (%.2f dB) is worse than with fast quality (%.2f dB)\n",
+                    filename.c_str(), ToString(compressionFormat.format), psnr[1], psnr[0]
+                );
+                return TestResult::FailedMismatch;
+            }
+
+            if (opt.showTiming)
+            {
+                const double megaPixels = static_cast<double>(numPixels) / 1.0e+6;
+                Log::Printf(
+                    "Compression of '%s' to %s: Fast (%.2f dB, %.1f MPix/s), High (%.2f dB, %.1f MPix/s)\n",
+                    filename.c_str(), ToString(compressionFormat.format),
+                    psnr[0], megaPixels * 1000.0 / timeMs[0],
+                    psnr[1], megaPixels * 1000.0 / timeMs[1]
+                );
+            }
+        }
+
+        return TestResult::Passed;
+    };
+
+    // BC1 must encode pixels with alpha less than 128 as transparent black
+    {
+        const std::uint8_t srcPixels[16][4] =
+        {
+            { 255, 0, 0, 255 }, { 255, 0, 0,   0 }, { 0, 255, 0, 255 }, { 0, 255, 0,   0 },
+            { 255, 0, 0, 255 }, { 255, 0, 0,   0 }, { 0, 255, 0, 255 }, { 0, 255, 0,   0 },
+            { 255, 0, 0, 255 }, { 255, 0, 0, 127 }, { 0, 255, 0, 255 }, { 0, 255, 0, 128 },
+            { 255, 0, 0, 255 }, { 255, 0, 0, 127 }, { 0, 255, 0, 255 }, { 0, 255, 0, 128 },
+        };
+
+        const ImageView srcImageView{ ImageFormat::RGBA, DataType::UInt8, srcPixels, sizeof(srcPixels) };
+        DynamicByteArray compressedData = CompressImageBuffer(Format::BC1UNorm, srcImageView, Extent2D{ 4, 4 });
+        DynamicByteArray decompressedData = DecompressImageBufferToRGBA8UNorm(Format::BC1UNorm, ImageView{ ImageFormat::Compressed, DataType::UInt8, compressedData.get(), compressedData.size() }, Extent2D{ 4, 4 });
+
+        const std::uint8_t* dstPixels = reinterpret_cast<const std::uint8_t*>(decompressedData.get());
+        for_range(i, 16)
+        {
+            const std::uint8_t expectedAlpha = (srcPixels[i][3] < 128 ? 0 : 255);
+            if (dstPixels[i*4 + 3] != expectedAlpha)
+            {
+                Log::Errorf(
+                    Log::ColorFlags::StdError,
+                    "Mismatch between BC1 decompressed alpha of pixel [%d] (%u) and expected alpha (%u)\n",
+                    i, dstPixels[i*4 + 3], expectedAlpha
+                );
+                return TestResult::FailedMismatch;
+            }
+            if (expectedAlpha == 255 && (dstPixels[i*4 + 0] != srcPixels[i][0] || dstPixels[i*4 + 1] != srcPixels[i][1]))
+            {
+                Log::Errorf(
+                    Log::ColorFlags::StdError,
+                    "Mismatch between BC1 decompressed color of pixel [%d] (%u, %u) and expected color (%u, %u)\n",
+                    i, dstPixels[i*4 + 0], dstPixels[i*4 + 1], srcPixels[i][0], srcPixels[i][1]
+                );
+                return TestResult::FailedMismatch;
+            }
+        }
+    }
+
+    #define TEST_COMPRESSION(FILENAME)                          \
+        {                                                       \
+            const TestResult result = TestCompression(FILENAME);\
+            if (result != TestResult::Passed)                   \
+                return result;                                  \
+        }
+
+    TEST_COMPRESSION("Gradient.png");
+
+    if (!opt.fastTest)
+    {
+        TEST_COMPRESSION("Grid10x10.png");
+        TEST_COMPRESSION("VanGogh-starry_night.jpg");
+    }
+
+    return TestResult::Passed;
+}
+
+
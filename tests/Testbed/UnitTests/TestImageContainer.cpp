@@ -0,0 +1,375 @@
+/*
+ * TestImageContainer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ImageContainer.h>
+#include <LLGL/Utils/TypeNames.h>
+#include <stb/stb_image.h>
+#include <stb/stb_image_write.h>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+
+
+static void AppendUInt32(std::vector<char>& buffer, std::uint32_t value)
+{
+    const char* bytes = reinterpret_cast<const char*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+}
+
+static void AppendUInt64(std::vector<char>& buffer, std::uint64_t value)
+{
+    const char* bytes = reinterpret_cast<const char*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(value));
+}
+
+static void WriteUInt32(std::vector<char>& buffer, std::size_t offset, std::uint32_t value)
+{
+    ::memcpy(&buffer[offset], &value, sizeof(value));
+}
+
+static void WriteUInt64(std::vector<char>& buffer, std::size_t offset, std::uint64_t value)
+{
+    ::memcpy(&buffer[offset], &value, sizeof(value));
+}
+
+// Returns the byte pattern that is used to fill the specified subresource.
+static char GetSubresourcePattern(std::uint32_t mipLevel, std::uint32_t arrayLayer)
+{
+    return static_cast<char>(arrayLayer * 16 + mipLevel + 1);
+}
+
+// Synthesizes a DDS container with DX10 header extension and BC1 compressed 2D-array texture.
+static std::vector<char> GenerateDDSContainer(std::uint32_t size, std::uint32_t numLayers, std::uint32_t numMips)
+{
+    std::vector<char> buffer;
+
+    AppendUInt32(buffer, 0x20534444);                       // Magic "DDS "
+    AppendUInt32(buffer, 124);                              // Header size
+    AppendUInt32(buffer, 0x00000001 | 0x00000002 | 0x00000004 | 0x00001000 | 0x00020000); // Flags: CAPS, HEIGHT, WIDTH, PIXELFORMAT, MIPMAPCOUNT
+    AppendUInt32(buffer, size);                             // Height
+    AppendUInt32(buffer, size);                             // Width
+    AppendUInt32(buffer, 0);                                // Pitch or linear size
+    AppendUInt32(buffer, 0);                                // Depth
+    AppendUInt32(buffer, numMips);                          // MIP-map count
+    for_range(i, 11)
+        AppendUInt32(buffer, 0);                            // Reserved
+    AppendUInt32(buffer, 32);                               // Pixel format size
+    AppendUInt32(buffer, 0x00000004);                       // Pixel format flags: FOURCC
+    AppendUInt32(buffer, 0x30315844);                       // FourCC "DX10"
+    for_range(i, 5)
+        AppendUInt32(buffer, 0);                            // Bit count and masks
+    AppendUInt32(buffer, 0x00001000);                       // Caps: TEXTURE
+    for_range(i, 4)
+        AppendUInt32(buffer, 0);                            // Caps2-4, reserved
+    AppendUInt32(buffer, 71);                               // DXGI_FORMAT_BC1_UNORM
+    AppendUInt32(buffer, 3);                                // D3D10_RESOURCE_DIMENSION_TEXTURE2D
+    AppendUInt32(buffer, 0);                                // Misc flag
+    AppendUInt32(buffer, numLayers);                        // Array size
+    AppendUInt32(buffer, 0);                                // Misc flags 2
+
+    // DDS stores each array layer with its entire MIP-map chain
+    for_range(arrayLayer, numLayers)
+    {
+        for_range(mipLevel, numMips)
+        {
+            const std::uint32_t numBlocks = std::max(1u, ((size >> mipLevel) + 3) / 4);
+            buffer.insert(buffer.end(), numBlocks * numBlocks * 8, GetSubresourcePattern(mipLevel, arrayLayer));
+        }
+    }
+
+    return buffer;
+}
+
+// Synthesizes a KTX2 container with RGBA8 2D-array texture. MIP-maps are stored in reverse order as recommended by the KTX2 specification.
+static std::vector<char> GenerateKTX2Container(std::uint32_t size, std::uint32_t numLayers, std::uint32_t numMips)
+{
+    static const std::uint8_t identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+    std::vector<char> buffer{ reinterpret_cast<const char*>(identifier), reinterpret_cast<const char*>(identifier) + sizeof(identifier) };
+
+    AppendUInt32(buffer, 37);                               // VK_FORMAT_R8G8B8A8_UNORM
+    AppendUInt32(buffer, 1);                                // Type size
+    AppendUInt32(buffer, size);                             // Pixel width
+    AppendUInt32(buffer, size);                             // Pixel height
+    AppendUInt32(buffer, 0);                                // Pixel depth
+    AppendUInt32(buffer, numLayers);                        // Layer count
+    AppendUInt32(buffer, 1);                                // Face count
+    AppendUInt32(buffer, numMips);                          // Level count
+    AppendUInt32(buffer, 0);                                // Supercompression scheme
+    for_range(i, 4)
+        AppendUInt32(buffer, 0);                            // DFD and KVD offsets and lengths
+    AppendUInt64(buffer, 0);                                // SGD offset
+    AppendUInt64(buffer, 0);                                // SGD length
+
+    const std::size_t levelIndexOffset = buffer.size();
+    buffer.resize(buffer.size() + numMips * 24);
+
+    for_range_reverse(mipLevel, numMips)
+    {
+        const std::uint32_t mipSize     = std::max(1u, size >> mipLevel);
+        const std::size_t   layerSize   = mipSize * mipSize * 4;
+
+        const std::size_t levelOffset = buffer.size();
+        for_range(arrayLayer, numLayers)
+            buffer.insert(buffer.end(), layerSize, GetSubresourcePattern(mipLevel, arrayLayer));
+
+        WriteUInt64(buffer, levelIndexOffset + mipLevel * 24 +  0, levelOffset);
+        WriteUInt64(buffer, levelIndexOffset + mipLevel * 24 +  8, layerSize * numLayers);
+        WriteUInt64(buffer, levelIndexOffset + mipLevel * 24 + 16, layerSize * numLayers);
+    }
+
+    return buffer;
+}
+
+static bool WriteFileBuffer(const std::string& filename, const std::vector<char>& buffer)
+{
+    std::ofstream file{ filename, std::ios::out | std::ios::binary };
+    if (!file.good())
+        return false;
+    file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    return file.good();
+}
+
+/*
+Synthesizes DDS and KTX2 containers with block compressed and uncompressed array textures and full MIP chains,
+validates that each subresource view points to the expected payload, uploads the KTX2 container to a Null renderer texture and reads it back,
+and compares the load time including the upload against stb_image.
+*/
+DEF_RITEST( ImageContainer )
+{
+    TestResult result = TestResult::Passed;
+
+    const std::uint32_t size        = (opt.fastTest ? 256 : 2048);
+    const std::uint32_t numLayers   = 2;
+    const std::uint32_t numMips     = NumMipLevels(size, size);
+
+    auto ValidateContainer = [&](const char* name, const LLGL::ImageContainer& container, ImageFormat expectedFormat, std::uint32_t bytesPerBlock, std::uint32_t blockSize) -> void
+    {
+        const TextureDescriptor& desc = container.GetTextureDesc();
+        if (desc.type != TextureType::Texture2DArray || desc.arrayLayers != numLayers || desc.mipLevels != numMips || desc.extent != Extent3D{ size, size, 1 })
+        {
+            Log::Errorf(
+                Log::ColorFlags::StdError,
+                "Mismatch between %s container descriptor (%s[%u], %u MIPs, %ux%ux%u) and expected descriptor (Texture2DArray[%u], %u MIPs, %ux%ux1)\n",
+                name, ToString(desc.type), desc.arrayLayers, desc.mipLevels, desc.extent.width, desc.extent.height, desc.extent.depth,
+                numLayers, numMips, size, size
+            );
+            result = TestResult::FailedMismatch;
+            return;
+        }
+
+        for_range(arrayLayer, numLayers)
+        {
+            for_range(mipLevel, numMips)
+            {
+                const std::uint32_t numBlocks       = std::max(1u, ((size >> mipLevel) + blockSize - 1) / blockSize);
+                const std::size_t   expectedSize    = numBlocks * numBlocks * bytesPerBlock;
+                const char          expectedPattern = GetSubresourcePattern(mipLevel, arrayLayer);
+
+                const ImageView view = container.GetSubresourceView(mipLevel, arrayLayer);
+                const char* data = static_cast<const char*>(view.data);
+
+                if (view.format != expectedFormat || view.dataSize != expectedSize || data == nullptr ||
+                    data[0] != expectedPattern || data[view.dataSize - 1] != expectedPattern)
+                {
+                    Log::Errorf(
+                        Log::ColorFlags::StdError,
+                        "Mismatch between %s subresource view [MIP %u, layer %u] (%zu bytes) and expected view (%zu bytes)\n",
+                        name, mipLevel, arrayLayer, view.dataSize, expectedSize
+                    );
+                    result = TestResult::FailedMismatch;
+                    return;
+                }
+            }
+        }
+    };
+
+    const std::vector<char> ddsBuffer   = GenerateDDSContainer(size, numLayers, numMips);
+    const std::vector<char> ktx2Buffer  = GenerateKTX2Container(size, numLayers, numMips);
+
+    // Parse containers from memory
+    LLGL::ImageContainer ddsContainer, ktx2Container;
+    Report report;
+
+    if (!ddsContainer.LoadFromBlob(Blob::CreateWeakRef(ddsBuffer.data(), ddsBuffer.size()), &report))
+    {
+        Log::Errorf(Log::ColorFlags::StdError, "Failed to parse DDS container: %s", report.GetText());
+        return TestResult::FailedErrors;
+    }
+    ValidateContainer("DDS", ddsContainer, ImageFormat::Compressed, 8, 4);
+
+    if (!ktx2Container.LoadFromBlob(Blob::CreateWeakRef(ktx2Buffer.data(), ktx2Buffer.size()), &report))
+    {
+        Log::Errorf(Log::ColorFlags::StdError, "Failed to parse KTX2 container: %s", report.GetText());
+        return TestResult::FailedErrors;
+    }
+    ValidateContainer("KTX2", ktx2Container, ImageFormat::RGBA, 4, 1);
+
+    // Truncated containers must be rejected
+    if (ddsContainer.LoadFromBlob(Blob::CreateWeakRef(ddsBuffer.data(), ddsBuffer.size() - 1)) || ddsContainer)
+    {
+        Log::Errorf(Log::ColorFlags::StdError, "Truncated DDS container was not rejected\n");
+        result = TestResult::FailedErrors;
+    }
+
+    // MIP-map count beyond the full MIP chain must be clamped
+    std::vector<char> ddsBufferExcessMips = ddsBuffer;
+    WriteUInt32(ddsBufferExcessMips, 28, 40);
+
+    if (!ddsContainer.LoadFromBlob(Blob::CreateWeakRef(ddsBufferExcessMips.data(), ddsBufferExcessMips.size()), &report))
+    {
+        Log::Errorf(Log::ColorFlags::StdError, "Failed to parse DDS container with excess MIP-map count: %s", report.GetText());
+        result = TestResult::FailedErrors;
+    }
+    else
+        ValidateContainer("DDS with excess MIPs", ddsContainer, ImageFormat::Compressed, 8, 4);
+
+    // Layer count that exceeds the container size must be rejected before any subresource is allocated
+    std::vector<char> ktx2BufferExcessLayers = ktx2Buffer;
+    WriteUInt32(ktx2BufferExcessLayers, 32, 0xFFFFFFFFu);
+
+    if (ktx2Container.LoadFromBlob(Blob::CreateWeakRef(ktx2BufferExcessLayers.data(), ktx2BufferExcessLayers.size())) || ktx2Container)
+    {
+        Log::Errorf(Log::ColorFlags::StdError, "KTX2 container with excess layer count was not rejected\n");
+        result = TestResult::FailedErrors;
+    }
+
+    if (result != TestResult::Passed)
+        return result;
+
+    // Load KTX2 container from memory mapped file and compare against the same image in PNG format loaded with stb_image
+    const std::string ktx2Filename  = opt.outputDir + "ImageContainer.ktx2";
+    const std::string pngFilename   = opt.outputDir + "ImageContainer.png";
+
+    if (!WriteFileBuffer(ktx2Filename, ktx2Buffer))
+    {
+        Log::Errorf(Log::ColorFlags::StdError, "Failed to write KTX2 container: %s\n", ktx2Filename.c_str());
+        return TestResult::FailedErrors;
+    }
+
+    // Load Null renderer to include texture uploads in the load times and validate the uploaded subresources
+    RenderSystemPtr renderer = RenderSystem::Load("Null");
+    if (!renderer)
+        Log::Printf("Null renderer not available; skip image container upload\n");
+
+    const std::uint64_t t0 = Timer::Tick();
+
+    Texture* ktx2Texture = nullptr;
+
+    if (!ktx2Container.LoadFromFile(ktx2Filename.c_str(), &report))
+    {
+        Log::Errorf(Log::ColorFlags::StdError, "Failed to load KTX2 container: %s", report.GetText());
+        result = TestResult::FailedErrors;
+    }
+    else
+    {
+        ValidateContainer("KTX2 file", ktx2Container, ImageFormat::RGBA, 4, 1);
+        if (renderer)
+            ktx2Texture = ktx2Container.CreateTexture(*renderer);
+    }
+
+    const std::uint64_t t1 = Timer::Tick();
+
+    // Read back each subresource of the uploaded texture and compare it with the container
+    if (ktx2Texture != nullptr)
+    {
+        std::vector<char> readbackData;
+
+        for_range(arrayLayer, numLayers)
+        {
+            for_range(mipLevel, numMips)
+            {
+                const ImageView srcView = ktx2Container.GetSubresourceView(mipLevel, arrayLayer);
+                readbackData.assign(srcView.dataSize, 0);
+
+                const std::uint32_t mipSize = std::max(1u, size >> mipLevel);
+                const TextureRegion region
+                {
+                    TextureSubresource{ arrayLayer, 1, mipLevel, 1 },
+                    Offset3D{},
+                    Extent3D{ mipSize, mipSize, 1 }
+                };
+
+                MutableImageView dstView;
+                {
+                    dstView.format      = srcView.format;
+                    dstView.dataType    = srcView.dataType;
+                    dstView.data        = readbackData.data();
+                    dstView.dataSize    = readbackData.size();
+                }
+                renderer->ReadTexture(*ktx2Texture, region, dstView);
+
+                if (::memcmp(readbackData.data(), srcView.data, srcView.dataSize) != 0)
+                {
+                    Log::Errorf(
+                        Log::ColorFlags::StdError,
+                        "Mismatch between uploaded KTX2 texture subresource [MIP %u, layer %u] and container subresource view\n",
+                        mipLevel, arrayLayer
+                    );
+                    result = TestResult::FailedMismatch;
+                    break;
+                }
+            }
+        }
+
+        renderer->Release(*ktx2Texture);
+    }
+    else if (renderer && ktx2Container)
+    {
+        Log::Errorf(Log::ColorFlags::StdError, "Failed to create texture from KTX2 container\n");
+        result = TestResult::FailedErrors;
+    }
+
+    if (opt.showTiming)
+    {
+        const ImageView baseView = ktx2Container.GetSubresourceView(0, 0);
+        if (baseView.data != nullptr && stbi_write_png(pngFilename.c_str(), static_cast<int>(size), static_cast<int>(size), 4, baseView.data, static_cast<int>(size * 4)) != 0)
+        {
+            const std::uint64_t t2 = Timer::Tick();
+
+            int w = 0, h = 0, c = 0;
+            stbi_uc* imgBuf = stbi_load(pngFilename.c_str(), &w, &h, &c, 4);
+
+            if (renderer && imgBuf != nullptr)
+            {
+                TextureDescriptor pngTexDesc;
+                {
+                    pngTexDesc.format       = Format::RGBA8UNorm;
+                    pngTexDesc.extent       = Extent3D{ static_cast<std::uint32_t>(w), static_cast<std::uint32_t>(h), 1 };
+                    pngTexDesc.bindFlags    = BindFlags::Sampled;
+                    pngTexDesc.miscFlags    = 0;
+                    pngTexDesc.mipLevels    = 1;
+                }
+                const ImageView pngView{ ImageFormat::RGBA, DataType::UInt8, imgBuf, static_cast<std::size_t>(w) * static_cast<std::size_t>(h) * 4 };
+                if (Texture* pngTexture = renderer->CreateTexture(pngTexDesc, &pngView))
+                    renderer->Release(*pngTexture);
+            }
+
+            stbi_image_free(imgBuf);
+
+            const std::uint64_t t3 = Timer::Tick();
+
+            Log::Printf(
+                "Image container load time (%ux%u, %u layers, %u MIPs%s): KTX2 mapped (%.4f ms), PNG base level via stb_image (%.4f ms)\n",
+                size, size, numLayers, numMips, (renderer ? ", including upload" : ""), TestbedContext::ToMillisecs(t0, t1), TestbedContext::ToMillisecs(t2, t3)
+            );
+
+            std::remove(pngFilename.c_str());
+        }
+    }
+
+    ktx2Container.Reset();
+    std::remove(ktx2Filename.c_str());
+
+    if (renderer)
+        RenderSystem::Unload(std::move(renderer));
+
+    return result;
+}
+
+
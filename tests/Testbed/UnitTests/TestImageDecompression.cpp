@@ -0,0 +1,281 @@
+/*
+ * TestImageDecompression.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Utils/TypeNames.h>
+#include <vector>
+#include <cstring>
+
+
+// Returns true if the specified 128-bit ASTC block is a void-extent block, i.e. a block with a constant color.
+static bool IsASTCVoidExtentBlock(const std::uint8_t* data)
+{
+    return (data[0] == 0xFC && (data[1] & 0x01) != 0);
+}
+
+/*
+Decompresses ETC2 and ASTC reference blocks and compares the decoded RGBA8 texels against the values derived from the block encoding.
+The reference blocks cover all ETC2 modes (individual, differential, T, H, and planar), ASTC LDR and HDR void-extent blocks, and an ASTC block with direct RGBA endpoints.
+The blocks are then tiled into images whose extents are not a multiple of the block size to cover clipping of partial blocks and multi-threaded decompression.
+With -t, the throughput (MPix/s) is printed.
+*/
+DEF_RITEST( ImageDecompression )
+{
+    struct ReferenceBlock
+    {
+        Format          format;
+        std::uint8_t    data[16];       // ETC2 blocks only use the first 8 bytes
+        std::uint8_t    texels[16][4];  // Expected RGBA8 texels of the 4x4 block in row-major order
+    };
+
+    const ReferenceBlock referenceBlocks[] =
+    {
+        {
+            // ETC2 individual mode
+            Format::ETC2UNorm,
+            { 0xF3, 0x0C, 0x79, 0x1C, 0x99, 0xAA, 0x92, 0xD6 },
+            {
+                { 255,   2, 121, 255 }, { 255,   8, 127, 255 }, {   4, 157, 106, 255 }, {   0,  21,   0, 255 },
+                { 247,   0, 111, 255 }, { 253,   0, 117, 255 }, { 234, 255, 255, 255 }, {  98, 251, 200, 255 },
+                { 255,   8, 127, 255 }, { 255,   8, 127, 255 }, {  98, 251, 200, 255 }, {  98, 251, 200, 255 },
+                { 253,   0, 117, 255 }, { 247,   0, 111, 255 }, {   4, 157, 106, 255 }, {   0,  21,   0, 255 },
+            }
+        },
+        {
+            // ETC2 differential mode
+            Format::ETC2UNorm,
+            { 0xA3, 0x55, 0xE3, 0x57, 0x99, 0xAA, 0x92, 0xD6 },
+            {
+                { 174,  91, 240, 255 }, { 194, 111, 255, 255 }, { 156,  73, 222, 255 }, { 136,  53, 202, 255 },
+                { 136,  53, 202, 255 }, { 156,  73, 222, 255 }, { 194, 111, 255, 255 }, { 174,  91, 240, 255 },
+                { 255, 137, 255, 255 }, { 255, 137, 255, 255 }, { 213,  81, 255, 255 }, { 213,  81, 255, 255 },
+                { 165,  33, 231, 255 }, { 109,   0, 175, 255 }, { 165,  33, 231, 255 }, { 109,   0, 175, 255 },
+            }
+        },
+        {
+            // ETC2 T-mode
+            Format::ETC2UNorm,
+            { 0xF9, 0x29, 0x4B, 0x6B, 0x99, 0xAA, 0x92, 0xD6 },
+            {
+                { 221,  34, 153, 255 }, { 100, 219, 134, 255 }, {  68, 187, 102, 255 }, {  36, 155,  70, 255 },
+                {  36, 155,  70, 255 }, {  68, 187, 102, 255 }, { 100, 219, 134, 255 }, { 221,  34, 153, 255 },
+                { 100, 219, 134, 255 }, { 100, 219, 134, 255 }, { 221,  34, 153, 255 }, { 221,  34, 153, 255 },
+                {  68, 187, 102, 255 }, {  36, 155,  70, 255 }, {  68, 187, 102, 255 }, {  36, 155,  70, 255 },
+            }
+        },
+        {
+            // ETC2 H-mode
+            Format::ETC2UNorm,
+            { 0x51, 0xFA, 0x14, 0xAB, 0x99, 0xAA, 0x92, 0xD6 },
+            {
+                { 186,  67, 220, 255 }, { 154,  35, 188, 255 }, {  50, 169, 101, 255 }, {  18, 137,  69, 255 },
+                {  18, 137,  69, 255 }, {  50, 169, 101, 255 }, { 154,  35, 188, 255 }, { 186,  67, 220, 255 },
+                { 154,  35, 188, 255 }, { 154,  35, 188, 255 }, { 186,  67, 220, 255 }, { 186,  67, 220, 255 },
+                {  50, 169, 101, 255 }, {  18, 137,  69, 255 }, {  50, 169, 101, 255 }, {  18, 137,  69, 255 },
+            }
+        },
+        {
+            // ETC2 planar mode
+            Format::ETC2UNorm,
+            { 0x11, 0x49, 0xFA, 0x7F, 0x28, 0x20, 0x1F, 0xE8 },
+            {
+                {  32, 201, 243, 255 }, {  88, 161, 186, 255 }, { 144, 121, 130, 255 }, { 199,  80,  73, 255 },
+                {  24, 215, 223, 255 }, {  80, 174, 166, 255 }, { 136, 134, 109, 255 }, { 191,  94,  53, 255 },
+                {  16, 228, 203, 255 }, {  72, 188, 146, 255 }, { 128, 148,  89, 255 }, { 183, 107,  32, 255 },
+                {   8, 242, 182, 255 }, {  64, 201, 126, 255 }, { 120, 161,  69, 255 }, { 175, 121,  12, 255 },
+            }
+        },
+        {
+            // ASTC LDR void-extent
+            Format::ASTC4x4,
+            { 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x20, 0x80, 0x80, 0xFF, 0xFF, 0x40, 0x40 },
+            {
+                {  32, 128, 255,  64 }, {  32, 128, 255,  64 }, {  32, 128, 255,  64 }, {  32, 128, 255,  64 },
+                {  32, 128, 255,  64 }, {  32, 128, 255,  64 }, {  32, 128, 255,  64 }, {  32, 128, 255,  64 },
+                {  32, 128, 255,  64 }, {  32, 128, 255,  64 }, {  32, 128, 255,  64 }, {  32, 128, 255,  64 },
+                {  32, 128, 255,  64 }, {  32, 128, 255,  64 }, {  32, 128, 255,  64 }, {  32, 128, 255,  64 },
+            }
+        },
+        {
+            // ASTC LDR void-extent
+            Format::ASTC4x4,
+            { 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x60, 0x60, 0xFF, 0xFF },
+            {
+                { 255,   0,  96, 255 }, { 255,   0,  96, 255 }, { 255,   0,  96, 255 }, { 255,   0,  96, 255 },
+                { 255,   0,  96, 255 }, { 255,   0,  96, 255 }, { 255,   0,  96, 255 }, { 255,   0,  96, 255 },
+                { 255,   0,  96, 255 }, { 255,   0,  96, 255 }, { 255,   0,  96, 255 }, { 255,   0,  96, 255 },
+                { 255,   0,  96, 255 }, { 255,   0,  96, 255 }, { 255,   0,  96, 255 }, { 255,   0,  96, 255 },
+            }
+        },
+        {
+            // ASTC single partition, RGBA direct endpoints, 4x4 weight grid
+            Format::ASTC4x4,
+            { 0x42, 0x80, 0x21, 0xE0, 0x41, 0xC0, 0x61, 0xA0, 0xFF, 0x01, 0x01, 0x00, 0xF0, 0x0F, 0xCC, 0x33 },
+            {
+                {  16,  32,  48, 255 }, { 240, 224, 208, 128 }, {  16,  32,  48, 255 }, { 240, 224, 208, 128 },
+                { 240, 224, 208, 128 }, {  16,  32,  48, 255 }, { 240, 224, 208, 128 }, {  16,  32,  48, 255 },
+                {  16,  32,  48, 255 }, {  16,  32,  48, 255 }, { 240, 224, 208, 128 }, { 240, 224, 208, 128 },
+                { 240, 224, 208, 128 }, { 240, 224, 208, 128 }, {  16,  32,  48, 255 }, {  16,  32,  48, 255 },
+            }
+        },
+        {
+            // ASTC HDR void-extent: illegal in the LDR profile and must decode to the error color magenta
+            Format::ASTC4x4,
+            { 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C },
+            {
+                { 255,   0, 255, 255 }, { 255,   0, 255, 255 }, { 255,   0, 255, 255 }, { 255,   0, 255, 255 },
+                { 255,   0, 255, 255 }, { 255,   0, 255, 255 }, { 255,   0, 255, 255 }, { 255,   0, 255, 255 },
+                { 255,   0, 255, 255 }, { 255,   0, 255, 255 }, { 255,   0, 255, 255 }, { 255,   0, 255, 255 },
+                { 255,   0, 255, 255 }, { 255,   0, 255, 255 }, { 255,   0, 255, 255 }, { 255,   0, 255, 255 },
+            }
+        },
+    };
+
+    // Tiles the specified blocks into a compressed image
+    auto TileBlocks = [](Format format, const Extent2D& extent, const std::vector<const ReferenceBlock*>& blocks) -> std::vector<std::uint8_t>
+    {
+        const FormatAttributes& formatAttribs = GetFormatAttribs(format);
+        const std::size_t blockSize = formatAttribs.bitSize / 8;
+        const std::size_t numBlocks = ((extent.width + formatAttribs.blockWidth - 1) / formatAttribs.blockWidth) * ((extent.height + formatAttribs.blockHeight - 1) / formatAttribs.blockHeight);
+
+        std::vector<std::uint8_t> data(numBlocks * blockSize);
+        for_range(i, numBlocks)
+            ::memcpy(&data[i * blockSize], blocks[i % blocks.size()]->data, blockSize);
+
+        return data;
+    };
+
+    // Decompresses the tiled blocks with a single and multiple threads and compares each texel with its reference block
+    auto DecompressAndCompare = [&](Format format, const Extent2D& extent, const std::vector<const ReferenceBlock*>& blocks) -> TestResult
+    {
+        const std::vector<std::uint8_t> compressedData = TileBlocks(format, extent, blocks);
+        const ImageView srcImageView{ ImageFormat::Compressed, DataType::UInt8, compressedData.data(), compressedData.size() };
+
+        std::vector<std::uint8_t> decompressedData[2];
+        for_range(i, 2)
+        {
+            decompressedData[i].resize(extent.width * extent.height * 4);
+            const MutableImageView dstImageView{ ImageFormat::RGBA, DataType::UInt8, decompressedData[i].data(), decompressedData[i].size() };
+            if (!DecompressImageBufferToRGBA8UNorm(format, srcImageView, dstImageView, extent, (i == 0 ? 1u : LLGL_MAX_THREAD_COUNT)))
+            {
+                Log::Errorf(Log::ColorFlags::StdError, "Failed to decompress image in %s format\n", ToString(format));
+                return TestResult::FailedErrors;
+            }
+        }
+
+        // Multi-threaded decompression must produce the exact same result
+        if (decompressedData[0] != decompressedData[1])
+        {
+            Log::Errorf(Log::ColorFlags::StdError, "Mismatch between single- and multi-threaded decompression in %s format\n", ToString(format));
+            return TestResult::FailedMismatch;
+        }
+
+        // Blocks with a footprint larger than 4x4 are void-extent blocks with a constant color, so the texel index can wrap around
+        const FormatAttributes& formatAttribs = GetFormatAttribs(format);
+        const std::uint32_t numBlocksX = (extent.width + formatAttribs.blockWidth - 1) / formatAttribs.blockWidth;
+
+        for_range(y, extent.height)
+        {
+            for_range(x, extent.width)
+            {
+                const std::uint32_t blockIndex = (y / formatAttribs.blockHeight) * numBlocksX + (x / formatAttribs.blockWidth);
+                const std::uint32_t texelIndex = ((y % formatAttribs.blockHeight) % 4) * 4 + ((x % formatAttribs.blockWidth) % 4);
+                const std::uint8_t* expected = blocks[blockIndex % blocks.size()]->texels[texelIndex];
+                const std::uint8_t* actual = &decompressedData[0][(y * extent.width + x) * 4];
+                if (::memcmp(actual, expected, 4) != 0)
+                {
+                    Log::Errorf(
+                        Log::ColorFlags::StdError,
+                        "Mismatch between decompressed texel [%u, %u] (%u, %u, %u, %u) and expected texel (%u, %u, %u, %u) in %s format\n",
+                        x, y, actual[0], actual[1], actual[2], actual[3], expected[0], expected[1], expected[2], expected[3], ToString(format)
+                    );
+                    return TestResult::FailedMismatch;
+                }
+            }
+        }
+
+        return TestResult::Passed;
+    };
+
+    #define TEST_DECOMPRESSION(FORMAT, EXTENT, BLOCKS)                                  \
+        {                                                                               \
+            const TestResult result = DecompressAndCompare(FORMAT, EXTENT, BLOCKS);     \
+            if (result != TestResult::Passed)                                           \
+                return result;                                                          \
+        }
+
+    // Decompress each reference block on its own
+    for (const ReferenceBlock& block : referenceBlocks)
+        TEST_DECOMPRESSION(block.format, Extent2D(4, 4), { &block });
+
+    // Decompress tiled reference blocks with 3x2 blocks per image. ASTC footprints other than 4x4 only use the void-extent blocks.
+    const Format tiledFormats[] =
+    {
+        Format::ETC2UNorm,
+        Format::ASTC4x4,
+        Format::ASTC5x4,
+        Format::ASTC6x6,
+        Format::ASTC8x5,
+        Format::ASTC10x8,
+        Format::ASTC12x12,
+    };
+
+    for (Format format : tiledFormats)
+    {
+        const FormatAttributes& formatAttribs = GetFormatAttribs(format);
+        const bool isFootprint4x4 = (formatAttribs.blockWidth == 4 && formatAttribs.blockHeight == 4);
+
+        std::vector<const ReferenceBlock*> blocks;
+        for (const ReferenceBlock& block : referenceBlocks)
+        {
+            if (block.format == format || (!isFootprint4x4 && block.format == Format::ASTC4x4 && IsASTCVoidExtentBlock(block.data)))
+                blocks.push_back(&block);
+        }
+
+        const Extent2D extent
+        {
+            static_cast<std::uint32_t>(formatAttribs.blockWidth * 3 - 1),
+            static_cast<std::uint32_t>(formatAttribs.blockHeight * 2 - 1)
+        };
+        TEST_DECOMPRESSION(format, extent, blocks);
+    }
+
+    #undef TEST_DECOMPRESSION
+
+    // Measure throughput with a larger image made of repeated reference blocks
+    if (opt.showTiming)
+    {
+        const Extent2D extent{ 1024, 1024 };
+        std::vector<std::uint8_t> decompressedData(extent.width * extent.height * 4);
+        const MutableImageView dstImageView{ ImageFormat::RGBA, DataType::UInt8, decompressedData.data(), decompressedData.size() };
+
+        for (Format format : { Format::ETC2UNorm, Format::ASTC4x4 })
+        {
+            std::vector<const ReferenceBlock*> blocks;
+            for (const ReferenceBlock& block : referenceBlocks)
+            {
+                if (block.format == format)
+                    blocks.push_back(&block);
+            }
+
+            const std::vector<std::uint8_t> compressedData = TileBlocks(format, extent, blocks);
+            const ImageView srcImageView{ ImageFormat::Compressed, DataType::UInt8, compressedData.data(), compressedData.size() };
+
+            const std::uint64_t t0 = Timer::Tick();
+            DecompressImageBufferToRGBA8UNorm(format, srcImageView, dstImageView, extent, LLGL_MAX_THREAD_COUNT);
+            const std::uint64_t t1 = Timer::Tick();
+
+            const double megaPixels = static_cast<double>(extent.width * extent.height) / 1.0e+6;
+            Log::Printf("Decompression of %s: %.1f MPix/s\n", ToString(format), megaPixels * 1000.0 / TestbedContext::ToMillisecs(t0, t1));
+        }
+    }
+
+    return TestResult::Passed;
+}
+
+
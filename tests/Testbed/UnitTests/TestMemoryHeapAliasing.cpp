@@ -0,0 +1,229 @@
+/*
+ * TestMemoryHeapAliasing.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+
+
+/*
+Places two transient render targets at the same offset of a memory heap and a buffer behind them (RenderSystem::CreateMemoryHeap).
+Switching between the aliased textures is done with CommandBuffer::AliasingBarrier.
+Invalid placements (misaligned, out of bounds, or unsupported resource kind) must fail and a memory heap must not be released while resources are placed in it.
+*/
+DEF_TEST( MemoryHeapAliasing )
+{
+    if (!caps.features.hasPlacedResources)
+        return TestResult::Skipped;
+
+    TestResult result = TestResult::Passed;
+
+    auto IsOverlapping = [](std::uint64_t offsetA, std::uint64_t sizeA, std::uint64_t offsetB, std::uint64_t sizeB) -> bool
+    {
+        return (offsetA < offsetB + sizeB && offsetB < offsetA + sizeA);
+    };
+
+    auto IsValidRequirements = [&result](const char* name, const MemoryRequirements& requirements) -> void
+    {
+        if (requirements.size == 0 || requirements.alignment == 0 || (requirements.alignment & (requirements.alignment - 1)) != 0)
+        {
+            Log::Errorf(
+                "Invalid memory requirements for %s: size = %" PRIu64 ", alignment = %" PRIu64 "\n",
+                name, requirements.size, requirements.alignment
+            );
+            result = TestResult::FailedErrors;
+        }
+    };
+
+    // Query memory requirements of two transient render targets and one buffer
+    TextureDescriptor tex1Desc;
+    {
+        tex1Desc.debugName  = "transientColor";
+        tex1Desc.bindFlags  = BindFlags::ColorAttachment | BindFlags::Sampled;
+        tex1Desc.format     = Format::RGBA8UNorm;
+        tex1Desc.extent     = { 256, 256, 1 };
+        tex1Desc.mipLevels  = 1;
+    }
+    TextureDescriptor tex2Desc = tex1Desc;
+    {
+        tex2Desc.debugName  = "transientAccum";
+        tex2Desc.format     = Format::R32Float;
+    }
+    BufferDescriptor bufDesc;
+    {
+        bufDesc.debugName   = "transientBuffer";
+        bufDesc.size        = 4096;
+        bufDesc.bindFlags   = BindFlags::Storage;
+    }
+
+    MemoryRequirements tex1Reqs, tex2Reqs, bufReqs;
+    if (!renderer->GetMemoryRequirements(tex1Desc, tex1Reqs) ||
+        !renderer->GetMemoryRequirements(tex2Desc, tex2Reqs) ||
+        !renderer->GetMemoryRequirements(bufDesc, bufReqs))
+    {
+        Log::Errorf("Failed to query memory requirements despite support for placed resources\n");
+        return TestResult::FailedErrors;
+    }
+
+    IsValidRequirements("texture 'transientColor'", tex1Reqs);
+    IsValidRequirements("texture 'transientAccum'", tex2Reqs);
+    IsValidRequirements("buffer 'transientBuffer'", bufReqs);
+
+    if (result != TestResult::Passed)
+        return result;
+
+    // Create heap that fits both aliased textures at offset 0 and the buffer behind them
+    const std::uint64_t texSize     = std::max(tex1Reqs.size, tex2Reqs.size);
+    const std::uint64_t bufOffset   = ((texSize + bufReqs.alignment - 1) / bufReqs.alignment) * bufReqs.alignment;
+
+    MemoryHeapDescriptor heapDesc;
+    {
+        heapDesc.debugName  = "transientHeap";
+        heapDesc.size       = bufOffset + bufReqs.size;
+    }
+    MemoryHeap* heap = renderer->CreateMemoryHeap(heapDesc);
+
+    if (heap == nullptr)
+    {
+        Log::Errorf("Failed to create memory heap despite support for placed resources\n");
+        return TestResult::FailedErrors;
+    }
+
+    if (heap->GetSize() != heapDesc.size)
+    {
+        Log::Errorf("Mismatch between memory heap size (%" PRIu64 ") and expected size (%" PRIu64 ")\n", heap->GetSize(), heapDesc.size);
+        result = TestResult::FailedMismatch;
+    }
+
+    // Only the two textures are meant to alias; the buffer must not overlap them
+    if (!IsOverlapping(0, tex1Reqs.size, 0, tex2Reqs.size) || IsOverlapping(0, texSize, bufOffset, bufReqs.size))
+    {
+        Log::Errorf(
+            "Unexpected overlap of placed resources: textures [0, %" PRIu64 ") and [0, %" PRIu64 "), buffer [%" PRIu64 ", %" PRIu64 ")\n",
+            tex1Reqs.size, tex2Reqs.size, bufOffset, bufOffset + bufReqs.size
+        );
+        result = TestResult::FailedMismatch;
+    }
+
+    Texture* tex1 = renderer->CreatePlacedTexture(*heap, 0, tex1Desc);
+    Texture* tex2 = renderer->CreatePlacedTexture(*heap, 0, tex2Desc);
+    Buffer* buf1 = renderer->CreatePlacedBuffer(*heap, bufOffset, bufDesc);
+
+    if (tex1 == nullptr || tex2 == nullptr || buf1 == nullptr)
+    {
+        Log::Errorf("Failed to create placed resources inside memory heap of %" PRIu64 " bytes\n", heapDesc.size);
+        result = TestResult::FailedErrors;
+    }
+
+    // Switch between the aliased render targets
+    if (tex1 != nullptr && tex2 != nullptr)
+    {
+        cmdBuffer->Begin();
+        {
+            cmdBuffer->AliasingBarrier(nullptr, tex1);
+            cmdBuffer->AliasingBarrier(tex1, tex2);
+            cmdBuffer->AliasingBarrier(tex2, nullptr);
+        }
+        cmdBuffer->End();
+    }
+
+    // Invalid placements must fail: misaligned offset, out of bounds offset, and out of bounds size
+    auto ExpectPlacementFailure = [&result](const char* name, const void* resource) -> void
+    {
+        if (resource != nullptr)
+        {
+            Log::Errorf("Expected placement of %s to fail, but resource was created\n", name);
+            result = TestResult::FailedMismatch;
+        }
+    };
+
+    if (bufReqs.alignment > 1)
+    {
+        Buffer* misalignedBuf = renderer->CreatePlacedBuffer(*heap, bufReqs.alignment / 2, bufDesc);
+        ExpectPlacementFailure("buffer with misaligned offset", misalignedBuf);
+        if (misalignedBuf != nullptr)
+            renderer->Release(*misalignedBuf);
+    }
+
+    const std::uint64_t outOfBoundsOffset = ((heapDesc.size + bufReqs.alignment - 1) / bufReqs.alignment) * bufReqs.alignment;
+    Buffer* outOfBoundsBuf = renderer->CreatePlacedBuffer(*heap, outOfBoundsOffset, bufDesc);
+    ExpectPlacementFailure("buffer with out of bounds offset", outOfBoundsBuf);
+    if (outOfBoundsBuf != nullptr)
+        renderer->Release(*outOfBoundsBuf);
+
+    BufferDescriptor largeBufDesc = bufDesc;
+    {
+        largeBufDesc.debugName  = "transientLargeBuffer";
+        largeBufDesc.size       = heapDesc.size;
+    }
+    Buffer* largeBuf = renderer->CreatePlacedBuffer(*heap, bufOffset, largeBufDesc);
+    ExpectPlacementFailure("buffer with out of bounds size", largeBuf);
+    if (largeBuf != nullptr)
+        renderer->Release(*largeBuf);
+
+    // Memory heap must not be released while resources are placed in it; a rejected release leaves the heap intact
+    if (buf1 != nullptr)
+    {
+        renderer->Release(*heap);
+
+        Buffer* buf1Again = renderer->CreatePlacedBuffer(*heap, bufOffset, bufDesc);
+        if (buf1Again == nullptr)
+        {
+            Log::Errorf("Failed to create placed buffer after rejected release of memory heap with placed resources\n");
+            result = TestResult::FailedErrors;
+        }
+        else
+            renderer->Release(*buf1Again);
+    }
+
+    // Clear resources; placed resources must be released before their heap
+    if (tex1 != nullptr)
+        renderer->Release(*tex1);
+    if (tex2 != nullptr)
+        renderer->Release(*tex2);
+    if (buf1 != nullptr)
+        renderer->Release(*buf1);
+
+    renderer->Release(*heap);
+
+    // Create heap that is restricted to buffers and place the buffer inside of it; the heap is large enough for the texture, too
+    MemoryHeapDescriptor bufHeapDesc;
+    {
+        bufHeapDesc.debugName   = "transientBufferHeap";
+        bufHeapDesc.size        = std::max(bufReqs.size, tex1Reqs.size);
+        bufHeapDesc.resources   = MemoryHeapResourceFlags::Buffers;
+    }
+    MemoryHeap* bufHeap = renderer->CreateMemoryHeap(bufHeapDesc);
+
+    if (bufHeap == nullptr)
+    {
+        Log::Errorf("Failed to create memory heap that is restricted to buffers\n");
+        return TestResult::FailedErrors;
+    }
+
+    Buffer* buf2 = renderer->CreatePlacedBuffer(*bufHeap, 0, bufDesc);
+
+    if (buf2 == nullptr)
+    {
+        Log::Errorf("Failed to create placed buffer inside memory heap that is restricted to buffers\n");
+        result = TestResult::FailedErrors;
+    }
+    else
+        renderer->Release(*buf2);
+
+    // Textures must not be placed inside a memory heap that is restricted to buffers
+    Texture* tex3 = renderer->CreatePlacedTexture(*bufHeap, 0, tex1Desc);
+    ExpectPlacementFailure("texture inside memory heap that is restricted to buffers", tex3);
+    if (tex3 != nullptr)
+        renderer->Release(*tex3);
+
+    renderer->Release(*bufHeap);
+
+    return result;
+}
+
+
+
+// ================================================================================
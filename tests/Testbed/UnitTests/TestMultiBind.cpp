@@ -0,0 +1,242 @@
+/*
+ * TestMultiBind.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/Parse.h>
+#include <string.h>
+
+
+/*
+Binds 8 textures and 8 samplers to consecutive slots and renders them in 8 vertical stripes.
+This is aiming at the GL backend to ensure deferred resource bindings are flushed correctly with GL_ARB_multi_bind (see GLStateManager::FlushDeferredBindings).
+First frame:
+  Create resources and flush the native call records of the setup.
+Second frame:
+  Render all stripes and compare the framebuffer with the reference image.
+Third frame:
+  If LLGL was built with LLGL_GL_ENABLE_PROC_PROFILER, ensure the bindings of the second frame were issued with fewer glBindTextures/glBindSamplers calls than bound slots.
+*/
+DEF_TEST( MultiBind )
+{
+    if (renderer->GetRendererID() != RendererID::OpenGL)
+        return TestResult::Skipped;
+
+    constexpr std::uint32_t numSlots = 8;
+
+    static TestResult result = TestResult::Passed;
+    static PipelineLayout* psoLayout = nullptr;
+    static PipelineState* pso = nullptr;
+    static Texture* colorMaps[numSlots] = {};
+    static Sampler* colorSamplers[numSlots] = {};
+
+    auto ReleaseResources = [this]() -> void
+    {
+        for_range(i, numSlots)
+        {
+            SAFE_RELEASE(colorMaps[i]);
+            SAFE_RELEASE(colorSamplers[i]);
+        }
+        SAFE_RELEASE(pso);
+        SAFE_RELEASE(psoLayout);
+    };
+
+    if (frame == 0)
+    {
+        result = TestResult::Passed;
+
+        if (shaders[VSMultiBind] == nullptr || shaders[PSMultiBind] == nullptr)
+        {
+            Log::Errorf("Missing shaders for backend\n");
+            return TestResult::FailedErrors;
+        }
+
+        // Create PSO layout with 8 textures and 8 samplers that share the same slots, i.e. texture units in GL
+        psoLayout = renderer->CreatePipelineLayout(
+            Parse(
+                "texture(colorMap0@0):frag,"
+                "texture(colorMap1@1):frag,"
+                "texture(colorMap2@2):frag,"
+                "texture(colorMap3@3):frag,"
+                "texture(colorMap4@4):frag,"
+                "texture(colorMap5@5):frag,"
+                "texture(colorMap6@6):frag,"
+                "texture(colorMap7@7):frag,"
+                "sampler(0):frag,"
+                "sampler(1):frag,"
+                "sampler(2):frag,"
+                "sampler(3):frag,"
+                "sampler(4):frag,"
+                "sampler(5):frag,"
+                "sampler(6):frag,"
+                "sampler(7):frag,"
+            )
+        );
+
+        GraphicsPipelineDescriptor psoDesc;
+        {
+            psoDesc.debugName       = "MultiBind.PSO";
+            psoDesc.pipelineLayout  = psoLayout;
+            psoDesc.renderPass      = swapChain->GetRenderPass();
+            psoDesc.vertexShader    = shaders[VSMultiBind];
+            psoDesc.fragmentShader  = shaders[PSMultiBind];
+        }
+        CREATE_GRAPHICS_PSO_EXT(pso, psoDesc, psoDesc.debugName);
+
+        // Create single-colored textures, one for each combination of the RGB channels, and samplers with different states
+        for_range(i, numSlots)
+        {
+            const std::uint8_t color[4] =
+            {
+                static_cast<std::uint8_t>((i & 0x1) != 0 ? 0xFF : 0x00),
+                static_cast<std::uint8_t>((i & 0x2) != 0 ? 0xFF : 0x00),
+                static_cast<std::uint8_t>((i & 0x4) != 0 ? 0xFF : 0x00),
+                0xFF
+            };
+
+            const std::string texName = "MultiBind.colorMap" + std::to_string(i);
+
+            TextureDescriptor texDesc;
+            {
+                texDesc.debugName   = texName.c_str();
+                texDesc.format      = Format::RGBA8UNorm;
+                texDesc.extent      = { 1, 1, 1 };
+                texDesc.bindFlags   = BindFlags::Sampled;
+                texDesc.mipLevels   = 1;
+            }
+            ImageView imageView;
+            {
+                imageView.format    = ImageFormat::RGBA;
+                imageView.dataType  = DataType::UInt8;
+                imageView.data      = color;
+                imageView.dataSize  = sizeof(color);
+            }
+            colorMaps[i] = renderer->CreateTexture(texDesc, &imageView);
+
+            SamplerDescriptor samplerDesc;
+            {
+                samplerDesc.addressModeU    = ((i & 0x1) != 0 ? SamplerAddressMode::Clamp : SamplerAddressMode::Repeat);
+                samplerDesc.addressModeV    = ((i & 0x2) != 0 ? SamplerAddressMode::Clamp : SamplerAddressMode::Repeat);
+                samplerDesc.minFilter       = ((i & 0x4) != 0 ? SamplerFilter::Nearest : SamplerFilter::Linear);
+                samplerDesc.magFilter       = ((i & 0x4) != 0 ? SamplerFilter::Nearest : SamplerFilter::Linear);
+                samplerDesc.mipMapEnabled   = false;
+            }
+            colorSamplers[i] = renderer->CreateSampler(samplerDesc);
+        }
+
+        // Present this frame to flush all native calls of the setup before the test frame is recorded
+        return TestResult::Continue;
+    }
+
+    if (frame == 1)
+    {
+        // Discard profile of the setup frame
+        debugger.FlushProfile();
+
+        // Render scene
+        const IndexedTriangleMesh& mesh = models[ModelRect];
+
+        Texture* readbackTex = nullptr;
+
+        cmdBuffer->Begin();
+        {
+            cmdBuffer->SetVertexBuffer(*meshBuffer);
+            cmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+
+            cmdBuffer->BeginRenderPass(*swapChain);
+            {
+                cmdBuffer->Clear(ClearFlags::Color, bgColorDarkBlue);
+                cmdBuffer->SetViewport(opt.resolution);
+                cmdBuffer->SetPipelineState(*pso);
+
+                // Set all textures and samplers individually; the GL backend defers these bindings until the draw command
+                for_range(i, numSlots)
+                {
+                    cmdBuffer->SetResource(i, *colorMaps[i]);
+                    cmdBuffer->SetResource(numSlots + i, *colorSamplers[i]);
+                }
+
+                cmdBuffer->DrawIndexed(mesh.numIndices, 0);
+
+                // Capture framebuffer
+                readbackTex = CaptureFramebuffer(*cmdBuffer, swapChain->GetColorFormat(), opt.resolution);
+            }
+            cmdBuffer->EndRenderPass();
+        }
+        cmdBuffer->End();
+
+        // Match entire color buffer and create delta heat map
+        SaveCapture(readbackTex, "MultiBind");
+
+        constexpr int threshold = 2;
+        constexpr unsigned tolerance = 0;
+        const DiffResult diff = DiffImages("MultiBind", threshold, tolerance);
+
+        TestResult intermediateResult = diff.Evaluate("multi-bind");
+        if (intermediateResult != TestResult::Passed)
+        {
+            result = intermediateResult;
+            if (!opt.greedy)
+            {
+                ReleaseResources();
+                return result;
+            }
+        }
+
+        // Present this frame to flush the native calls of the test frame
+        return TestResult::Continue;
+    }
+
+    // Evaluate native call records of the previous frame; These are only available with the GL procedure profiler and a debugger
+    FrameProfile profile;
+    debugger.FlushProfile(&profile);
+
+    auto GetNumNativeCalls = [&profile](const char* function) -> std::uint32_t
+    {
+        std::uint32_t numCalls = 0;
+        for (const ProfileNativeCallRecord& record : profile.nativeCallRecords)
+        {
+            if (::strcmp(record.function.c_str(), function) == 0)
+                numCalls += record.calls;
+        }
+        return numCalls;
+    };
+
+    const std::uint32_t numBindTexturesCalls = GetNumNativeCalls("glBindTextures");
+    const std::uint32_t numBindSamplersCalls = GetNumNativeCalls("glBindSamplers");
+
+    // Without GL_ARB_multi_bind, bindings are not deferred and neither of these functions is called
+    if (numBindTexturesCalls > 0 || numBindSamplersCalls > 0)
+    {
+        if (numBindTexturesCalls >= numSlots)
+        {
+            Log::Errorf(
+                "Mismatch between number of glBindTextures calls (%u) and expected number (less than %u) for deferred bindings\n",
+                numBindTexturesCalls, numSlots
+            );
+            result = TestResult::FailedMismatch;
+        }
+        if (numBindSamplersCalls >= numSlots)
+        {
+            Log::Errorf(
+                "Mismatch between number of glBindSamplers calls (%u) and expected number (less than %u) for deferred bindings\n",
+                numBindSamplersCalls, numSlots
+            );
+            result = TestResult::FailedMismatch;
+        }
+    }
+    else if (opt.verbose && !profile.nativeCallRecords.empty())
+        Log::Printf("Native call records do not contain glBindTextures or glBindSamplers; GL_ARB_multi_bind is not supported\n");
+
+    // Clear resources
+    ReleaseResources();
+
+    return result;
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,124 @@
+/*
+ * TestResourceHeapUpdate.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/Parse.h>
+
+
+/*
+Writes scattered descriptors into a resource heap immediately and with a batched update (RenderSystem::BeginResourceHeapUpdate/CommitResourceHeapUpdate).
+Backends with batched updates must coalesce multiple writes to the same descriptor and report the number of unique descriptors on commit.
+*/
+DEF_TEST( ResourceHeapUpdate )
+{
+    const std::uint32_t numSets         = (opt.fastTest ? 256 : 4096);
+    const std::uint32_t numBindings     = 2;
+    const std::uint32_t numDescriptors  = numSets * numBindings;
+
+    // Create PSO layout with two heap bindings
+    PipelineLayout* psoLayout = renderer->CreatePipelineLayout(
+        Parse(
+            "heap{"
+            "  texture(colorMap@2):frag,"
+            "  sampler(texSampler@3):frag,"
+            "}"
+        )
+    );
+
+    // Create resource heap with initial resource views for all descriptor sets
+    std::vector<ResourceViewDescriptor> initialResourceViews;
+    initialResourceViews.reserve(numDescriptors);
+
+    for_range(i, numSets)
+    {
+        initialResourceViews.push_back(textures[TextureDetailMap]);
+        initialResourceViews.push_back(samplers[SamplerNearest]);
+    }
+
+    ResourceHeap* resHeap = renderer->CreateResourceHeap(psoLayout, initialResourceViews);
+
+    TestResult result = TestResult::Passed;
+
+    // Writes the texture descriptor of each set in reverse order, i.e. in the worst order for a write-combining update
+    auto WriteScatteredTextures = [&](Texture* texture) -> std::uint32_t
+    {
+        std::uint32_t numWritten = 0;
+        for (std::uint32_t i = numSets; i-- > 0;)
+        {
+            const ResourceViewDescriptor resourceView = texture;
+            numWritten += renderer->WriteResourceHeap(*resHeap, i * numBindings, { &resourceView, 1 });
+        }
+        return numWritten;
+    };
+
+    // Measure immediate writes
+    const std::uint64_t t0 = Timer::Tick();
+
+    const std::uint32_t numWrittenImmediate = WriteScatteredTextures(textures[TexturePaintingA_NPOT]);
+
+    const std::uint64_t t1 = Timer::Tick();
+
+    if (numWrittenImmediate != numSets)
+    {
+        Log::Errorf("Mismatch between number of immediately written descriptors (%u) and expected number (%u)\n", numWrittenImmediate, numSets);
+        result = TestResult::FailedMismatch;
+    }
+
+    // Measure batched writes; Write each descriptor twice to ensure the last write is taken
+    const std::uint64_t t2 = Timer::Tick();
+
+    renderer->BeginResourceHeapUpdate(*resHeap);
+    const std::uint32_t numRecorded = WriteScatteredTextures(textures[TexturePaintingA_NPOT]) + WriteScatteredTextures(textures[TexturePaintingB]);
+    const std::uint32_t numCommitted = renderer->CommitResourceHeapUpdate(*resHeap);
+
+    const std::uint64_t t3 = Timer::Tick();
+
+    if (numRecorded != numSets * 2)
+    {
+        Log::Errorf("Mismatch between number of recorded descriptors (%u) and expected number (%u)\n", numRecorded, numSets * 2);
+        result = TestResult::FailedMismatch;
+    }
+
+    // Backends without batched updates write immediately and commit nothing
+    const std::uint32_t numCommittedExpected = (HasBatchedResourceHeapUpdates() ? numSets : 0);
+
+    if (numCommitted != numCommittedExpected)
+    {
+        Log::Errorf("Mismatch between number of committed descriptors (%u) and expected number (%u)\n", numCommitted, numCommittedExpected);
+        result = TestResult::FailedMismatch;
+    }
+
+    // Committing an empty update must not write anything
+    renderer->BeginResourceHeapUpdate(*resHeap);
+    const std::uint32_t numCommittedEmpty = renderer->CommitResourceHeapUpdate(*resHeap);
+
+    if (numCommittedEmpty != 0)
+    {
+        Log::Errorf("Mismatch between number of committed descriptors of empty update (%u) and expected number (0)\n", numCommittedEmpty);
+        result = TestResult::FailedMismatch;
+    }
+
+    if (opt.showTiming)
+    {
+        const double immediateTime  = TestbedContext::ToMillisecs(t0, t1);
+        const double batchedTime    = TestbedContext::ToMillisecs(t2, t3);
+        Log::Printf(
+            "Resource heap update (%u descriptors): immediate (%.4f ms, %.0f descriptors/s), batched with 2x writes (%.4f ms, %.0f descriptors/s)\n",
+            numSets,
+            immediateTime, numSets * 1000.0 / std::max(immediateTime, 0.0001),
+            batchedTime, numSets * 2000.0 / std::max(batchedTime, 0.0001)
+        );
+    }
+
+    // Clear resources
+    renderer->Release(*resHeap);
+    renderer->Release(*psoLayout);
+
+    return result;
+}
+
+
@@ -0,0 +1,165 @@
+/*
+ * TestResourceHeapUpdateOrder.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/Parse.h>
+
+
+/*
+Writes two different textures to the same descriptor within a single batched resource heap update (RenderSystem::BeginResourceHeapUpdate/CommitResourceHeapUpdate).
+Then renders a rectangle with that resource heap and reads back the center pixel to ensure the second texture is bound, i.e. the last write takes effect.
+*/
+DEF_TEST( ResourceHeapUpdateOrder )
+{
+    if (shaders[VSTextured] == nullptr || shaders[PSTextured] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    // Create graphics PSO
+    PipelineLayout* psoLayout = renderer->CreatePipelineLayout(
+        Parse(
+            HasCombinedSamplers()
+                ?   "cbuffer(Scene@1):vert:frag,"
+                    "heap{texture(colorMap@2):frag},"
+                    "sampler(2):frag,"
+                :
+                    "cbuffer(Scene@1):vert:frag,"
+                    "heap{texture(colorMap@2):frag},"
+                    "sampler(linearSampler@3):frag,"
+        )
+    );
+
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout  = psoLayout;
+        psoDesc.renderPass      = swapChain->GetRenderPass();
+        psoDesc.vertexShader    = shaders[VSTextured];
+        psoDesc.fragmentShader  = shaders[PSTextured];
+    }
+    CREATE_GRAPHICS_PSO(pso, psoDesc, "psoResHeapUpdateOrder");
+
+    // Create two single-colored textures: the first one is red, the second one is green
+    auto CreateSolidColorTexture = [this](const char* name, const ColorRGBAub& color) -> Texture*
+    {
+        TextureDescriptor texDesc;
+        {
+            texDesc.debugName   = name;
+            texDesc.format      = Format::RGBA8UNorm;
+            texDesc.extent      = { 1, 1, 1 };
+            texDesc.bindFlags   = BindFlags::Sampled;
+            texDesc.mipLevels   = 1;
+        }
+        ImageView imageView;
+        {
+            imageView.format    = ImageFormat::RGBA;
+            imageView.dataType  = DataType::UInt8;
+            imageView.data      = &color;
+            imageView.dataSize  = sizeof(color);
+        }
+        return renderer->CreateTexture(texDesc, &imageView);
+    };
+
+    Texture* texFirst   = CreateSolidColorTexture("texResHeapUpdateOrder.First", ColorRGBAub{ 0xFF, 0x00, 0x00, 0xFF });
+    Texture* texSecond  = CreateSolidColorTexture("texResHeapUpdateOrder.Second", ColorRGBAub{ 0x00, 0xFF, 0x00, 0xFF });
+
+    // Create resource heap with a single descriptor and write both textures to it within the same batched update
+    const ResourceViewDescriptor initialResourceViews[] = { textures[TextureDetailMap] };
+    ResourceHeap* resHeap = renderer->CreateResourceHeap(psoLayout, initialResourceViews);
+
+    renderer->BeginResourceHeapUpdate(*resHeap);
+    {
+        const ResourceViewDescriptor firstResourceView = texFirst;
+        renderer->WriteResourceHeap(*resHeap, 0, { &firstResourceView, 1 });
+
+        const ResourceViewDescriptor secondResourceView = texSecond;
+        renderer->WriteResourceHeap(*resHeap, 0, { &secondResourceView, 1 });
+    }
+    renderer->CommitResourceHeapUpdate(*resHeap);
+
+    // Initialize scene constants to draw a screen-filling rectangle
+    sceneConstants = SceneConstants{};
+
+    sceneConstants.vpMatrix.LoadIdentity();
+    sceneConstants.wMatrix.LoadIdentity();
+
+    // Render scene
+    const IndexedTriangleMesh& mesh = models[ModelRect];
+
+    Texture* readbackTex = nullptr;
+
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->SetVertexBuffer(*meshBuffer);
+        cmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+
+        cmdBuffer->UpdateBuffer(*sceneCbuffer, 0, &sceneConstants, sizeof(sceneConstants));
+
+        cmdBuffer->BeginRenderPass(*swapChain);
+        {
+            cmdBuffer->Clear(ClearFlags::Color, bgColorDarkBlue);
+            cmdBuffer->SetViewport(opt.resolution);
+            cmdBuffer->SetPipelineState(*pso);
+            cmdBuffer->SetResource(0, *sceneCbuffer);
+            cmdBuffer->SetResource(1, *samplers[SamplerNearestClamp]);
+            cmdBuffer->SetResourceHeap(*resHeap);
+            cmdBuffer->DrawIndexed(mesh.numIndices, 0);
+
+            // Capture framebuffer
+            readbackTex = CaptureFramebuffer(*cmdBuffer, swapChain->GetColorFormat(), opt.resolution);
+        }
+        cmdBuffer->EndRenderPass();
+    }
+    cmdBuffer->End();
+
+    // Read back center pixel which must be covered by the rectangle
+    const Offset3D readbackTexPosition
+    {
+        static_cast<std::int32_t>(opt.resolution.width/2),
+        static_cast<std::int32_t>(opt.resolution.height/2),
+        0,
+    };
+    const TextureRegion readbackTexRegion{ readbackTexPosition, Extent3D{ 1, 1, 1 } };
+
+    ColorRGBub readbackColor;
+
+    MutableImageView dstImageView;
+    {
+        dstImageView.format     = ImageFormat::RGB;
+        dstImageView.data       = &readbackColor;
+        dstImageView.dataSize   = sizeof(readbackColor);
+        dstImageView.dataType   = DataType::UInt8;
+    }
+    renderer->ReadTexture(*readbackTex, readbackTexRegion, dstImageView);
+
+    TestResult result = TestResult::Passed;
+
+    // Only the green channel must be set, since the shader only applies shading to the sampled texture color
+    if (!(readbackColor.g > 0 && readbackColor.r == 0 && readbackColor.b == 0))
+    {
+        Log::Errorf(
+            "Mismatch between readback color (%u, %u, %u) and expected color of last written texture (0, >0, 0)\n",
+            readbackColor.r, readbackColor.g, readbackColor.b
+        );
+        result = TestResult::FailedMismatch;
+    }
+
+    // Clear resources
+    renderer->Release(*readbackTex);
+    renderer->Release(*resHeap);
+    renderer->Release(*texFirst);
+    renderer->Release(*texSecond);
+    renderer->Release(*pso);
+    renderer->Release(*psoLayout);
+
+    return result;
+}
+
+
+
+// ================================================================================
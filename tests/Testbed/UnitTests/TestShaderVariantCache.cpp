@@ -0,0 +1,162 @@
+/*
+ * TestShaderVariantCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <algorithm>
+
+
+/*
+Ensure equivalent shader variants are only compiled once, regardless of the order and duplicates of their macros,
+and that the persistent shader binaries are used after the variant cache has been restored from its blob.
+*/
+DEF_TEST( ShaderVariantCache )
+{
+    auto IsShadingLanguageSupported = [this](ShadingLanguage language) -> bool
+    {
+        return (std::find(caps.shadingLanguages.begin(), caps.shadingLanguages.end(), language) != caps.shadingLanguages.end());
+    };
+
+    // Select fragment shader of the triangle mesh for the respective shading language
+    ShaderDescriptor shaderDesc;
+    shaderDesc.type = ShaderType::Fragment;
+
+    if (IsShadingLanguageSupported(ShadingLanguage::HLSL))
+    {
+        shaderDesc.source       = "Shaders/TriangleMesh/TriangleMesh.hlsl";
+        shaderDesc.entryPoint   = "PSMain";
+        shaderDesc.profile      = "ps_5_0";
+    }
+    else if (IsShadingLanguageSupported(ShadingLanguage::GLSL))
+        shaderDesc.source = "Shaders/TriangleMesh/TriangleMesh.330core.frag";
+    else if (IsShadingLanguageSupported(ShadingLanguage::Metal))
+    {
+        shaderDesc.source       = "Shaders/TriangleMesh/TriangleMesh.metal";
+        shaderDesc.entryPoint   = "PSMain";
+        shaderDesc.profile      = "1.1";
+    }
+    else
+        return TestResult::Skipped;
+
+    const ShaderMacro definesA[] =
+    {
+        ShaderMacro{ "ENABLE_TEXTURING", "1" },
+        ShaderMacro{ "UNUSED_MACRO", nullptr },
+        ShaderMacro{ nullptr, nullptr }
+    };
+
+    // Same macro set as 'definesA' in different order and with a redefinition
+    const ShaderMacro definesB[] =
+    {
+        ShaderMacro{ "UNUSED_MACRO", nullptr },
+        ShaderMacro{ "ENABLE_TEXTURING", "0" },
+        ShaderMacro{ "ENABLE_TEXTURING", "1" },
+        ShaderMacro{ nullptr, nullptr }
+    };
+
+    const ShaderVariantCacheStatistics initialStats = renderer->GetShaderVariantCacheStatistics();
+
+    auto CreateVariant = [this, &shaderDesc](const ShaderMacro* defines, double& outElapsedMS) -> Shader*
+    {
+        ShaderDescriptor variantDesc = shaderDesc;
+        variantDesc.defines = defines;
+
+        const std::uint64_t startTime = Timer::Tick();
+        Shader* shader = renderer->CreateShaderVariant(variantDesc);
+        const std::uint64_t endTime = Timer::Tick();
+
+        outElapsedMS = (static_cast<double>(endTime - startTime) / static_cast<double>(Timer::Frequency())) * 1000.0;
+
+        return shader;
+    };
+
+    double elapsedTime[4] = {};
+
+    Shader* shaderA = CreateVariant(definesA, elapsedTime[0]);
+    Shader* shaderB = CreateVariant(definesB, elapsedTime[1]);
+    Shader* shaderC = CreateVariant(nullptr, elapsedTime[2]);
+
+    if (shaderA == nullptr || shaderC == nullptr)
+    {
+        Log::Errorf("Failed to create shader variants\n");
+        return TestResult::FailedErrors;
+    }
+
+    if (shaderA != shaderB)
+    {
+        Log::Errorf("Mismatch between shader variants with equivalent macro sets\n");
+        return TestResult::FailedMismatch;
+    }
+
+    if (shaderA == shaderC)
+    {
+        Log::Errorf("Mismatch between shader variants with different macro sets\n");
+        return TestResult::FailedMismatch;
+    }
+
+    const ShaderVariantCacheStatistics stats = renderer->GetShaderVariantCacheStatistics();
+
+    if (stats.numHits   != initialStats.numHits   + 1 ||
+        stats.numMisses != initialStats.numMisses + 2 ||
+        stats.numVariants != initialStats.numVariants + 2)
+    {
+        Log::Errorf(
+            "Mismatch between shader variant cache statistics: hits = %u (expected %u), misses = %u (expected %u), variants = %u (expected %u)\n",
+            static_cast<unsigned>(stats.numHits), static_cast<unsigned>(initialStats.numHits + 1),
+            static_cast<unsigned>(stats.numMisses), static_cast<unsigned>(initialStats.numMisses + 2),
+            stats.numVariants, initialStats.numVariants + 2
+        );
+        return TestResult::FailedMismatch;
+    }
+
+    // Persist shader variant cache and release all variants
+    Blob cacheBlob = renderer->GetShaderVariantCacheBlob();
+
+    renderer->ReleaseShaderVariant(*shaderA);
+    renderer->ReleaseShaderVariant(*shaderB);
+    renderer->ReleaseShaderVariant(*shaderC);
+
+    if (renderer->GetShaderVariantCacheStatistics().numVariants != initialStats.numVariants)
+    {
+        Log::Errorf("Shader variants were not released\n");
+        return TestResult::FailedErrors;
+    }
+
+    // Restore shader variant cache; only backends that export shader binaries produce a non-empty blob
+    if (cacheBlob)
+    {
+        if (!renderer->SetShaderVariantCacheBlob(cacheBlob))
+        {
+            Log::Errorf("Failed to restore shader variant cache from blob\n");
+            return TestResult::FailedErrors;
+        }
+
+        const std::uint64_t numBinaryLoads = renderer->GetShaderVariantCacheStatistics().numBinaryLoads;
+
+        shaderA = CreateVariant(definesA, elapsedTime[3]);
+
+        if (shaderA == nullptr || renderer->GetShaderVariantCacheStatistics().numBinaryLoads != numBinaryLoads + 1)
+        {
+            Log::Errorf("Shader variant was not created from persistent binary\n");
+            return TestResult::FailedErrors;
+        }
+
+        renderer->ReleaseShaderVariant(*shaderA);
+        renderer->SetShaderVariantCacheBlob(Blob{});
+    }
+
+    if (opt.showTiming)
+    {
+        Log::Printf(
+            "Shader variant cache: miss = %.2f ms, hit = %.2f ms, binary load = %.2f ms\n",
+            elapsedTime[0], elapsedTime[1], elapsedTime[3]
+        );
+    }
+
+    return TestResult::Passed;
+}
+
+
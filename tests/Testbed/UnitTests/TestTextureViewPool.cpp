@@ -0,0 +1,310 @@
+/*
+ * TestTextureViewPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/Parse.h>
+#include <cstdlib>
+
+
+/*
+Creates more texture views than the GL texture view pool keeps alive (RendererConfigurationOpenGL::maxCachedTextureViews), one per layer of an array texture.
+First frame:
+  Create one resource heap per texture view and release all of them again, so the least recently used texture views are evicted from the pool.
+Second frame:
+  Request the most recently released texture view, which must be reused, and the first texture view, which must be recreated.
+  Render both texture views side by side and read back the layer colors.
+Third frame:
+  Evaluate the texture view pool record of the previous frame. This requires a debugger, i.e. the Testbed running in CPU debug mode.
+*/
+DEF_TEST( TextureViewPool )
+{
+    if (renderer->GetRendererID() != RendererID::OpenGL || !caps.features.hasTextureViews)
+        return TestResult::Skipped;
+
+    // The Testbed does not change the default limit of the texture view pool
+    const std::uint32_t maxCachedTextureViews   = RendererConfigurationOpenGL{}.maxCachedTextureViews;
+    const std::uint32_t numEvictedTextureViews  = 4;
+    const std::uint32_t numTextureViews         = maxCachedTextureViews + numEvictedTextureViews;
+
+    static TestResult result = TestResult::Passed;
+    static PipelineLayout* psoLayout = nullptr;
+    static PipelineState* pso = nullptr;
+    static Texture* arrayTex = nullptr;
+    static ResourceHeap* resHeaps[2] = {};
+
+    // Returns a unique color for each array layer
+    auto GetLayerColor = [](std::uint32_t layer) -> ColorRGBub
+    {
+        return ColorRGBub
+        {
+            static_cast<std::uint8_t>(layer * 3u),
+            static_cast<std::uint8_t>(255u - layer * 3u),
+            static_cast<std::uint8_t>((layer % 2u) * 255u)
+        };
+    };
+
+    auto CreateTextureViewHeap = [this](std::uint32_t layer) -> ResourceHeap*
+    {
+        ResourceViewDescriptor resourceView;
+        {
+            resourceView.resource                               = arrayTex;
+            resourceView.textureView.type                       = TextureType::Texture2D;
+            resourceView.textureView.format                     = Format::RGBA8UNorm;
+            resourceView.textureView.subresource.baseArrayLayer = layer;
+            resourceView.textureView.subresource.numArrayLayers = 1;
+            resourceView.textureView.subresource.baseMipLevel   = 0;
+            resourceView.textureView.subresource.numMipLevels   = 1;
+        }
+        return renderer->CreateResourceHeap(psoLayout, { resourceView });
+    };
+
+    auto ReleaseResources = [this]() -> void
+    {
+        SAFE_RELEASE(resHeaps[0]);
+        SAFE_RELEASE(resHeaps[1]);
+        SAFE_RELEASE(arrayTex);
+        SAFE_RELEASE(pso);
+        SAFE_RELEASE(psoLayout);
+    };
+
+    if (frame == 0)
+    {
+        result = TestResult::Passed;
+
+        if (shaders[VSTextured] == nullptr || shaders[PSTextured] == nullptr)
+        {
+            Log::Errorf("Missing shaders for backend\n");
+            return TestResult::FailedErrors;
+        }
+
+        // Create graphics PSO
+        psoLayout = renderer->CreatePipelineLayout(
+            Parse(
+                "cbuffer(Scene@1):vert:frag,"
+                "heap{texture(colorMap@2):frag},"
+                "sampler(2):frag,"
+            )
+        );
+
+        GraphicsPipelineDescriptor psoDesc;
+        {
+            psoDesc.debugName       = "TextureViewPool.PSO";
+            psoDesc.pipelineLayout  = psoLayout;
+            psoDesc.renderPass      = swapChain->GetRenderPass();
+            psoDesc.vertexShader    = shaders[VSTextured];
+            psoDesc.fragmentShader  = shaders[PSTextured];
+        }
+        CREATE_GRAPHICS_PSO_EXT(pso, psoDesc, psoDesc.debugName);
+
+        // Create array texture with a single texel per layer
+        std::vector<ColorRGBAub> layerColors(numTextureViews);
+        for_range(layer, numTextureViews)
+        {
+            const ColorRGBub color = GetLayerColor(layer);
+            layerColors[layer] = ColorRGBAub{ color.r, color.g, color.b, 0xFF };
+        }
+
+        TextureDescriptor texDesc;
+        {
+            texDesc.debugName   = "TextureViewPool.Layers";
+            texDesc.type        = TextureType::Texture2DArray;
+            texDesc.format      = Format::RGBA8UNorm;
+            texDesc.extent      = { 1, 1, 1 };
+            texDesc.arrayLayers = numTextureViews;
+            texDesc.bindFlags   = BindFlags::Sampled;
+            texDesc.mipLevels   = 1;
+        }
+        ImageView imageView;
+        {
+            imageView.format    = ImageFormat::RGBA;
+            imageView.dataType  = DataType::UInt8;
+            imageView.data      = layerColors.data();
+            imageView.dataSize  = sizeof(ColorRGBAub) * layerColors.size();
+        }
+        arrayTex = renderer->CreateTexture(texDesc, &imageView);
+
+        // Discard profile of previous tests, so the next frame profile only contains the texture views of this frame
+        debugger.FlushProfile();
+
+        // Create a texture view for each layer and release them in ascending order; This evicts the first texture views from the pool
+        std::vector<ResourceHeap*> layerResHeaps(numTextureViews);
+        for_range(layer, numTextureViews)
+            layerResHeaps[layer] = CreateTextureViewHeap(layer);
+        for_range(layer, numTextureViews)
+            renderer->Release(*layerResHeaps[layer]);
+
+        // Present this frame to flush the texture view pool record
+        return TestResult::Continue;
+    }
+
+    if (frame == 1)
+    {
+        // Evaluate texture view pool record of the first frame; Other tests may have left unused texture views in the pool, which are evicted first
+        FrameProfile profile;
+        debugger.FlushProfile(&profile);
+
+        const ProfileTextureViewPoolRecord& record = profile.textureViewPoolRecord;
+        if (record.textureViewCreations > 0)
+        {
+            if (record.textureViewCreations != numTextureViews)
+            {
+                Log::Errorf(
+                    "Mismatch between number of created texture views (%u) and expected number (%u)\n",
+                    record.textureViewCreations, numTextureViews
+                );
+                result = TestResult::FailedMismatch;
+            }
+            if (record.textureViewEvictions < numEvictedTextureViews)
+            {
+                Log::Errorf(
+                    "Mismatch between number of evicted texture views (%u) and expected number (at least %u)\n",
+                    record.textureViewEvictions, numEvictedTextureViews
+                );
+                result = TestResult::FailedMismatch;
+            }
+            if (record.numCachedTextureViews != maxCachedTextureViews)
+            {
+                Log::Errorf(
+                    "Mismatch between number of cached texture views (%u) and expected number (%u)\n",
+                    record.numCachedTextureViews, maxCachedTextureViews
+                );
+                result = TestResult::FailedMismatch;
+            }
+        }
+        else if (opt.verbose)
+            Log::Printf("Texture view pool record is empty; Run Testbed with CPU debugger to evaluate pool counters\n");
+
+        // Request the last released texture view (still cached) and the first one (evicted)
+        const std::uint32_t layers[2] = { numTextureViews - 1, 0 };
+
+        resHeaps[0] = CreateTextureViewHeap(layers[0]);
+        resHeaps[1] = CreateTextureViewHeap(layers[1]);
+
+        // Initialize scene constants to draw a rectangle that fills the entire viewport
+        sceneConstants = SceneConstants{};
+
+        sceneConstants.vpMatrix.LoadIdentity();
+        sceneConstants.wMatrix.LoadIdentity();
+
+        // Render both texture views side by side
+        const IndexedTriangleMesh& mesh = models[ModelRect];
+
+        const Extent2D halfResolution{ opt.resolution.width/2, opt.resolution.height };
+
+        Texture* readbackTex = nullptr;
+
+        cmdBuffer->Begin();
+        {
+            cmdBuffer->SetVertexBuffer(*meshBuffer);
+            cmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+
+            cmdBuffer->UpdateBuffer(*sceneCbuffer, 0, &sceneConstants, sizeof(sceneConstants));
+
+            cmdBuffer->BeginRenderPass(*swapChain);
+            {
+                cmdBuffer->Clear(ClearFlags::Color, bgColorDarkBlue);
+                cmdBuffer->SetPipelineState(*pso);
+                cmdBuffer->SetResource(0, *sceneCbuffer);
+                cmdBuffer->SetResource(1, *samplers[SamplerNearestClamp]);
+
+                for_range(i, 2)
+                {
+                    cmdBuffer->SetViewport(Viewport{ Offset2D{ static_cast<std::int32_t>(halfResolution.width * i), 0 }, halfResolution });
+                    cmdBuffer->SetResourceHeap(*resHeaps[i]);
+                    cmdBuffer->DrawIndexed(mesh.numIndices, 0);
+                }
+
+                // Capture framebuffer
+                readbackTex = CaptureFramebuffer(*cmdBuffer, swapChain->GetColorFormat(), opt.resolution);
+            }
+            cmdBuffer->EndRenderPass();
+        }
+        cmdBuffer->End();
+
+        // Read back center pixel of each half and compare them with the respective layer color
+        auto IsColorComponentEqual = [](std::uint8_t lhs, std::uint8_t rhs) -> bool
+        {
+            return (std::abs(static_cast<int>(lhs) - static_cast<int>(rhs)) <= 1);
+        };
+
+        for_range(i, 2)
+        {
+            const Offset3D readbackTexPosition
+            {
+                static_cast<std::int32_t>(halfResolution.width * i + halfResolution.width/2),
+                static_cast<std::int32_t>(halfResolution.height/2),
+                0,
+            };
+            const TextureRegion readbackTexRegion{ readbackTexPosition, Extent3D{ 1, 1, 1 } };
+
+            ColorRGBub readbackColor;
+
+            MutableImageView dstImageView;
+            {
+                dstImageView.format     = ImageFormat::RGB;
+                dstImageView.data       = &readbackColor;
+                dstImageView.dataSize   = sizeof(readbackColor);
+                dstImageView.dataType   = DataType::UInt8;
+            }
+            renderer->ReadTexture(*readbackTex, readbackTexRegion, dstImageView);
+
+            const ColorRGBub expectedColor = GetLayerColor(layers[i]);
+
+            if (!IsColorComponentEqual(readbackColor.r, expectedColor.r) ||
+                !IsColorComponentEqual(readbackColor.g, expectedColor.g) ||
+                !IsColorComponentEqual(readbackColor.b, expectedColor.b))
+            {
+                Log::Errorf(
+                    "Mismatch between readback color (%u, %u, %u) and expected color (%u, %u, %u) of %s texture view for layer %u\n",
+                    readbackColor.r, readbackColor.g, readbackColor.b,
+                    expectedColor.r, expectedColor.g, expectedColor.b,
+                    (i == 0 ? "reused" : "recreated"), layers[i]
+                );
+                result = TestResult::FailedMismatch;
+            }
+        }
+
+        renderer->Release(*readbackTex);
+
+        // Present this frame to flush the texture view pool record
+        return TestResult::Continue;
+    }
+
+    // Evaluate texture view pool record of the second frame
+    FrameProfile profile;
+    debugger.FlushProfile(&profile);
+
+    const ProfileTextureViewPoolRecord& record = profile.textureViewPoolRecord;
+    if (record.textureViewCreations > 0 || record.textureViewReuses > 0)
+    {
+        if (record.textureViewReuses != 1)
+        {
+            Log::Errorf(
+                "Mismatch between number of reused texture views (%u) and expected number (1) for layer %u\n",
+                record.textureViewReuses, numTextureViews - 1
+            );
+            result = TestResult::FailedMismatch;
+        }
+        if (record.textureViewCreations != 1)
+        {
+            Log::Errorf(
+                "Mismatch between number of created texture views (%u) and expected number (1) for evicted layer 0\n",
+                record.textureViewCreations
+            );
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // Clear resources
+    ReleaseResources();
+
+    return result;
+}
+
+
+
+// ================================================================================
@@ -147,6 +147,7 @@ void ConvertBindingDesc(BindingDescriptor& dst, const LLGLBindingDescriptor& src
     dst.stageFlags  = src.stageFlags;
     dst.slot        = { src.slot.index, src.slot.set };
     dst.arraySize   = src.arraySize;
+    dst.flags       = src.flags;
 }
 
 void ConvertStaticSamplerDesc(StaticSamplerDescriptor& dst, const LLGLStaticSamplerDescriptor& src)
@@ -45,11 +45,20 @@ static void ConvertC99ProfileTimeRecord(LLGLProfileTimeRecord& dst, const Profil
     dst.elapsedTime     = src.elapsedTime;
 }
 
+static void ConvertC99ProfileNativeCallRecord(LLGLProfileNativeCallRecord& dst, const ProfileNativeCallRecord& src)
+{
+    dst.function    = src.function.c_str();
+    dst.command     = src.command.c_str();
+    dst.calls       = src.calls;
+    dst.elapsedTime = src.elapsedTime;
+}
+
 LLGL_C_EXPORT void llglFlushDebuggerProfile(LLGLRenderingDebugger debugger, LLGLFrameProfile* outFrameProfile)
 {
     LLGL_ASSERT_PTR(outFrameProfile);
 
     static thread_local FrameProfile internalFrameProfile;
+    static thread_local std::vector<LLGLProfileNativeCallRecord> internalProfileNativeCallRecords;
     static thread_local std::vector<LLGLProfileTimeRecord> internalProfileTimeRecords;
     LLGL_PTR(RenderingDebugger, debugger)->FlushProfile(&internalFrameProfile);
 
@@ -65,6 +74,37 @@ LLGL_C_EXPORT void llglFlushDebuggerProfile(LLGLRenderingDebugger debugger, LLGL
     );
     std::memcpy(&(outFrameProfile->commandBufferRecord), &(internalFrameProfile.commandBufferRecord), sizeof(LLGLProfileCommandBufferRecord));
 
+    static_assert(
+        sizeof(LLGLProfileTextureViewPoolRecord) == sizeof(ProfileTextureViewPoolRecord),
+        "LLGLProfileTextureViewPoolRecord and LLGL::ProfileTextureViewPoolRecord expected to be the same size"
+    );
+    std::memcpy(&(outFrameProfile->textureViewPoolRecord), &(internalFrameProfile.textureViewPoolRecord), sizeof(LLGLProfileTextureViewPoolRecord));
+
+    static_assert(
+        sizeof(LLGLProfileRenderPassCacheRecord) == sizeof(ProfileRenderPassCacheRecord),
+        "LLGLProfileRenderPassCacheRecord and LLGL::ProfileRenderPassCacheRecord expected to be the same size"
+    );
+    std::memcpy(&(outFrameProfile->renderPassCacheRecord), &(internalFrameProfile.renderPassCacheRecord), sizeof(LLGLProfileRenderPassCacheRecord));
+
+    static_assert(
+        sizeof(LLGLProfileGraphicsPipelineRecord) == sizeof(ProfileGraphicsPipelineRecord),
+        "LLGLProfileGraphicsPipelineRecord and LLGL::ProfileGraphicsPipelineRecord expected to be the same size"
+    );
+    std::memcpy(&(outFrameProfile->graphicsPipelineRecord), &(internalFrameProfile.graphicsPipelineRecord), sizeof(LLGLProfileGraphicsPipelineRecord));
+
+    static_assert(
+        sizeof(LLGLProfileDeviceMemoryRecord) == sizeof(ProfileDeviceMemoryRecord),
+        "LLGLProfileDeviceMemoryRecord and LLGL::ProfileDeviceMemoryRecord expected to be the same size"
+    );
+    std::memcpy(&(outFrameProfile->deviceMemoryRecord), &(internalFrameProfile.deviceMemoryRecord), sizeof(LLGLProfileDeviceMemoryRecord));
+
+    internalProfileNativeCallRecords.resize(internalFrameProfile.nativeCallRecords.size());
+    for_range(i, internalFrameProfile.nativeCallRecords.size())
+        ConvertC99ProfileNativeCallRecord(internalProfileNativeCallRecords[i], internalFrameProfile.nativeCallRecords[i]);
+
+    outFrameProfile->numNativeCallRecords = internalProfileNativeCallRecords.size();
+    outFrameProfile->nativeCallRecords = internalProfileNativeCallRecords.data();
+
     internalProfileTimeRecords.resize(internalFrameProfile.timeRecords.size());
     for_range(i, internalFrameProfile.timeRecords.size())
         ConvertC99ProfileTimeRecord(internalProfileTimeRecords[i], internalFrameProfile.timeRecords[i]);
@@ -42,6 +42,7 @@ static void ConvertBindingDesc(ShaderReflectionC99Wrapper& wrapper, LLGLBindingD
     dst.stageFlags  = src.stageFlags;
     dst.slot        = { src.slot.index, src.slot.set };
     dst.arraySize   = src.arraySize;
+    dst.flags       = src.flags;
 }
 
 static void ConvertShaderResourceReflection(ShaderReflectionC99Wrapper& wrapper, LLGLShaderResourceReflection& dst, const ShaderResourceReflection& src)
@@ -681,6 +681,8 @@ LLGL_STATIC_ASSERT_FLAG(Barrier, StorageBuffer);
 LLGL_STATIC_ASSERT_FLAG(Barrier, StorageTexture);
 LLGL_STATIC_ASSERT_FLAG(Barrier, Storage);
 
+LLGL_STATIC_ASSERT_FLAG(Binding, DescriptorIndexing);
+
 LLGL_STATIC_ASSERT_FLAG(ShaderCompile, Debug);
 LLGL_STATIC_ASSERT_FLAG(ShaderCompile, NoOptimization);
 LLGL_STATIC_ASSERT_FLAG(ShaderCompile, OptimizationLevel1);
@@ -926,6 +928,9 @@ LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, stencilBits);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, samples);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, swapBuffers);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, fullscreen);
+LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, resizable);
+LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, framesInFlight);
+LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, lowLatency);
 
 LLGL_STATIC_ASSERT_SIZE(RenderingFeatures);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasRenderTargets);
@@ -955,6 +960,8 @@ LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasLogicOp);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasPipelineCaching);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasPipelineStatistics);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasRenderCondition);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasDescriptorIndexing);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasPlacedResources);
 
 LLGL_STATIC_ASSERT_SIZE(RenderingLimits);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, lineWidthRange);
@@ -982,6 +989,7 @@ LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxDepthBufferSamples);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxStencilBufferSamples);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxNoAttachmentSamples);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, storageResourceStageFlags);
+LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxDescriptorIndexingArraySize);
 
 LLGL_STATIC_ASSERT_SIZE(ImageView);
 LLGL_STATIC_ASSERT_OFFSET(ImageView, format);
@@ -1145,6 +1153,44 @@ LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, drawCommands);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, dispatchCommands);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandBufferRecord, meshCommands);
 
+LLGL_STATIC_ASSERT_SIZE(ProfileTextureViewPoolRecord);
+LLGL_STATIC_ASSERT_OFFSET(ProfileTextureViewPoolRecord, textureViewCreations);
+LLGL_STATIC_ASSERT_OFFSET(ProfileTextureViewPoolRecord, textureViewReuses);
+LLGL_STATIC_ASSERT_OFFSET(ProfileTextureViewPoolRecord, textureViewEvictions);
+LLGL_STATIC_ASSERT_OFFSET(ProfileTextureViewPoolRecord, numTextureViews);
+LLGL_STATIC_ASSERT_OFFSET(ProfileTextureViewPoolRecord, numCachedTextureViews);
+
+LLGL_STATIC_ASSERT_SIZE(ProfileRenderPassCacheRecord);
+LLGL_STATIC_ASSERT_OFFSET(ProfileRenderPassCacheRecord, renderPassCreations);
+LLGL_STATIC_ASSERT_OFFSET(ProfileRenderPassCacheRecord, renderPassReuses);
+LLGL_STATIC_ASSERT_OFFSET(ProfileRenderPassCacheRecord, framebufferCreations);
+LLGL_STATIC_ASSERT_OFFSET(ProfileRenderPassCacheRecord, framebufferReuses);
+LLGL_STATIC_ASSERT_OFFSET(ProfileRenderPassCacheRecord, framebufferEvictions);
+LLGL_STATIC_ASSERT_OFFSET(ProfileRenderPassCacheRecord, numRenderPasses);
+LLGL_STATIC_ASSERT_OFFSET(ProfileRenderPassCacheRecord, numFramebuffers);
+
+LLGL_STATIC_ASSERT_SIZE(ProfileGraphicsPipelineRecord);
+LLGL_STATIC_ASSERT_OFFSET(ProfileGraphicsPipelineRecord, pipelineCreations);
+LLGL_STATIC_ASSERT_OFFSET(ProfileGraphicsPipelineRecord, pipelineLinks);
+LLGL_STATIC_ASSERT_OFFSET(ProfileGraphicsPipelineRecord, libraryCreations);
+LLGL_STATIC_ASSERT_OFFSET(ProfileGraphicsPipelineRecord, libraryReuses);
+LLGL_STATIC_ASSERT_OFFSET(ProfileGraphicsPipelineRecord, numLibraries);
+LLGL_STATIC_ASSERT_OFFSET(ProfileGraphicsPipelineRecord, creationTime);
+
+LLGL_STATIC_ASSERT_SIZE(ProfileDeviceMemoryRecord);
+LLGL_STATIC_ASSERT_OFFSET(ProfileDeviceMemoryRecord, numChunks);
+LLGL_STATIC_ASSERT_OFFSET(ProfileDeviceMemoryRecord, numEmptyChunks);
+LLGL_STATIC_ASSERT_OFFSET(ProfileDeviceMemoryRecord, numBlocks);
+LLGL_STATIC_ASSERT_OFFSET(ProfileDeviceMemoryRecord, numFragments);
+LLGL_STATIC_ASSERT_OFFSET(ProfileDeviceMemoryRecord, allocatedSize);
+LLGL_STATIC_ASSERT_OFFSET(ProfileDeviceMemoryRecord, usedSize);
+LLGL_STATIC_ASSERT_OFFSET(ProfileDeviceMemoryRecord, maxFragmentSize);
+LLGL_STATIC_ASSERT_OFFSET(ProfileDeviceMemoryRecord, budget);
+LLGL_STATIC_ASSERT_OFFSET(ProfileDeviceMemoryRecord, usage);
+LLGL_STATIC_ASSERT_OFFSET(ProfileDeviceMemoryRecord, chunkReleases);
+LLGL_STATIC_ASSERT_OFFSET(ProfileDeviceMemoryRecord, relocations);
+LLGL_STATIC_ASSERT_OFFSET(ProfileDeviceMemoryRecord, relocatedSize);
+
 LLGL_STATIC_ASSERT_SIZE(ColorCodes);
 LLGL_STATIC_ASSERT_OFFSET(ColorCodes, textFlags);
 LLGL_STATIC_ASSERT_OFFSET(ColorCodes, backgroundFlags);
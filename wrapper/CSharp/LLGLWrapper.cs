@@ -869,6 +869,12 @@ namespace LLGL
         Storage        = (StorageBuffer | StorageTexture),
     }
 
+    [Flags]
+    public enum BindingFlags : int
+    {
+        DescriptorIndexing = (1 << 0),
+    }
+
     [Flags]
     public enum ColorMaskFlags : int
     {
@@ -1430,6 +1436,185 @@ namespace LLGL
         }
     }
 
+    public class ProfileTextureViewPoolRecord
+    {
+        public int TextureViewCreations { get; set; }  = 0;
+        public int TextureViewReuses { get; set; }     = 0;
+        public int TextureViewEvictions { get; set; }  = 0;
+        public int NumTextureViews { get; set; }       = 0;
+        public int NumCachedTextureViews { get; set; } = 0;
+
+        public ProfileTextureViewPoolRecord() { }
+
+        internal ProfileTextureViewPoolRecord(NativeLLGL.ProfileTextureViewPoolRecord native)
+        {
+            Native = native;
+        }
+
+        internal NativeLLGL.ProfileTextureViewPoolRecord Native
+        {
+            set
+            {
+                TextureViewCreations  = value.textureViewCreations;
+                TextureViewReuses     = value.textureViewReuses;
+                TextureViewEvictions  = value.textureViewEvictions;
+                NumTextureViews       = value.numTextureViews;
+                NumCachedTextureViews = value.numCachedTextureViews;
+            }
+        }
+    }
+
+    public class ProfileRenderPassCacheRecord
+    {
+        public int RenderPassCreations { get; set; }  = 0;
+        public int RenderPassReuses { get; set; }     = 0;
+        public int FramebufferCreations { get; set; } = 0;
+        public int FramebufferReuses { get; set; }    = 0;
+        public int FramebufferEvictions { get; set; } = 0;
+        public int NumRenderPasses { get; set; }      = 0;
+        public int NumFramebuffers { get; set; }      = 0;
+
+        public ProfileRenderPassCacheRecord() { }
+
+        internal ProfileRenderPassCacheRecord(NativeLLGL.ProfileRenderPassCacheRecord native)
+        {
+            Native = native;
+        }
+
+        internal NativeLLGL.ProfileRenderPassCacheRecord Native
+        {
+            set
+            {
+                RenderPassCreations  = value.renderPassCreations;
+                RenderPassReuses     = value.renderPassReuses;
+                FramebufferCreations = value.framebufferCreations;
+                FramebufferReuses    = value.framebufferReuses;
+                FramebufferEvictions = value.framebufferEvictions;
+                NumRenderPasses      = value.numRenderPasses;
+                NumFramebuffers      = value.numFramebuffers;
+            }
+        }
+    }
+
+    public class ProfileGraphicsPipelineRecord
+    {
+        public int PipelineCreations { get; set; } = 0;
+        public int PipelineLinks { get; set; }     = 0;
+        public int LibraryCreations { get; set; }  = 0;
+        public int LibraryReuses { get; set; }     = 0;
+        public int NumLibraries { get; set; }      = 0;
+        public int CreationTime { get; set; }      = 0;
+
+        public ProfileGraphicsPipelineRecord() { }
+
+        internal ProfileGraphicsPipelineRecord(NativeLLGL.ProfileGraphicsPipelineRecord native)
+        {
+            Native = native;
+        }
+
+        internal NativeLLGL.ProfileGraphicsPipelineRecord Native
+        {
+            set
+            {
+                PipelineCreations = value.pipelineCreations;
+                PipelineLinks     = value.pipelineLinks;
+                LibraryCreations  = value.libraryCreations;
+                LibraryReuses     = value.libraryReuses;
+                NumLibraries      = value.numLibraries;
+                CreationTime      = value.creationTime;
+            }
+        }
+    }
+
+    public class ProfileDeviceMemoryRecord
+    {
+        public long NumChunks { get; set; }       = 0;
+        public long NumEmptyChunks { get; set; }  = 0;
+        public long NumBlocks { get; set; }       = 0;
+        public long NumFragments { get; set; }    = 0;
+        public long AllocatedSize { get; set; }   = 0;
+        public long UsedSize { get; set; }        = 0;
+        public long MaxFragmentSize { get; set; } = 0;
+        public long Budget { get; set; }          = 0;
+        public long Usage { get; set; }           = 0;
+        public long ChunkReleases { get; set; }   = 0;
+        public long Relocations { get; set; }     = 0;
+        public long RelocatedSize { get; set; }   = 0;
+
+        public ProfileDeviceMemoryRecord() { }
+
+        internal ProfileDeviceMemoryRecord(NativeLLGL.ProfileDeviceMemoryRecord native)
+        {
+            Native = native;
+        }
+
+        internal NativeLLGL.ProfileDeviceMemoryRecord Native
+        {
+            set
+            {
+                NumChunks       = value.numChunks;
+                NumEmptyChunks  = value.numEmptyChunks;
+                NumBlocks       = value.numBlocks;
+                NumFragments    = value.numFragments;
+                AllocatedSize   = value.allocatedSize;
+                UsedSize        = value.usedSize;
+                MaxFragmentSize = value.maxFragmentSize;
+                Budget          = value.budget;
+                Usage           = value.usage;
+                ChunkReleases   = value.chunkReleases;
+                Relocations     = value.relocations;
+                RelocatedSize   = value.relocatedSize;
+            }
+        }
+    }
+
+    public class ProfileNativeCallRecord
+    {
+        public AnsiString Function { get; set; }
+        public AnsiString Command { get; set; }
+        public int        Calls { get; set; }       = 0;
+        public long       ElapsedTime { get; set; } = 0;
+
+        public ProfileNativeCallRecord() { }
+
+        internal ProfileNativeCallRecord(NativeLLGL.ProfileNativeCallRecord native)
+        {
+            Native = native;
+        }
+
+        internal NativeLLGL.ProfileNativeCallRecord Native
+        {
+            get
+            {
+                var native = new NativeLLGL.ProfileNativeCallRecord();
+                unsafe
+                {
+                    fixed (byte* functionPtr = Function.Ascii)
+                    {
+                        native.function = functionPtr;
+                    }
+                    fixed (byte* commandPtr = Command.Ascii)
+                    {
+                        native.command = commandPtr;
+                    }
+                    native.calls       = Calls;
+                    native.elapsedTime = ElapsedTime;
+                }
+                return native;
+            }
+            set
+            {
+                unsafe
+                {
+                    Function    = Marshal.PtrToStringAnsi((IntPtr)value.function);
+                    Command     = Marshal.PtrToStringAnsi((IntPtr)value.command);
+                    Calls       = value.calls;
+                    ElapsedTime = value.elapsedTime;
+                }
+            }
+        }
+    }
+
     public class RenderingFeatures
     {
         public bool HasRenderTargets { get; set; }             = false;
@@ -1460,6 +1645,8 @@ namespace LLGL
         public bool HasPipelineCaching { get; set; }           = false;
         public bool HasPipelineStatistics { get; set; }        = false;
         public bool HasRenderCondition { get; set; }           = false;
+        public bool HasDescriptorIndexing { get; set; }        = false;
+        public bool HasPlacedResources { get; set; }           = false;
 
         public RenderingFeatures() { }
 
@@ -1500,6 +1687,8 @@ namespace LLGL
                 HasPipelineCaching           = value.hasPipelineCaching;
                 HasPipelineStatistics        = value.hasPipelineStatistics;
                 HasRenderCondition           = value.hasRenderCondition;
+                HasDescriptorIndexing        = value.hasDescriptorIndexing;
+                HasPlacedResources           = value.hasPlacedResources;
             }
         }
     }
@@ -1531,6 +1720,7 @@ namespace LLGL
         public int     MaxStencilBufferSamples { get; set; }       = 0;
         public int     MaxNoAttachmentSamples { get; set; }        = 0;
         public int     StorageResourceStageFlags { get; set; }     = 0;
+        public int     MaxDescriptorIndexingArraySize { get; set; } = 0;
 
         public RenderingLimits() { }
 
@@ -1576,6 +1766,7 @@ namespace LLGL
                     MaxStencilBufferSamples          = value.maxStencilBufferSamples;
                     MaxNoAttachmentSamples           = value.maxNoAttachmentSamples;
                     StorageResourceStageFlags        = value.storageResourceStageFlags;
+                    MaxDescriptorIndexingArraySize   = value.maxDescriptorIndexingArraySize;
                 }
             }
         }
@@ -1767,7 +1958,7 @@ namespace LLGL
     {
         public BindingDescriptor() { }
 
-        public BindingDescriptor(string name = null, ResourceType type = ResourceType.Undefined, BindFlags bindFlags = 0, StageFlags stageFlags = 0, BindingSlot slot = new BindingSlot(), int arraySize = 0)
+        public BindingDescriptor(string name = null, ResourceType type = ResourceType.Undefined, BindFlags bindFlags = 0, StageFlags stageFlags = 0, BindingSlot slot = new BindingSlot(), int arraySize = 0, BindingFlags flags = 0)
         {
             Name       = name;
             Type       = type;
@@ -1775,6 +1966,7 @@ namespace LLGL
             StageFlags = stageFlags;
             Slot       = slot;
             ArraySize  = arraySize;
+            Flags      = flags;
         }
 
         public AnsiString   Name { get; set; }
@@ -1783,6 +1975,7 @@ namespace LLGL
         public StageFlags   StageFlags { get; set; } = 0;
         public BindingSlot  Slot { get; set; }       = new BindingSlot();
         public int          ArraySize { get; set; }  = 0;
+        public BindingFlags Flags { get; set; }      = 0;
 
         internal BindingDescriptor(NativeLLGL.BindingDescriptor native)
         {
@@ -1805,6 +1998,7 @@ namespace LLGL
                     native.stageFlags = (int)StageFlags;
                     native.slot       = Slot;
                     native.arraySize  = ArraySize;
+                    native.flags      = (int)Flags;
                 }
                 return native;
             }
@@ -1818,6 +2012,7 @@ namespace LLGL
                     StageFlags = (StageFlags)value.stageFlags;
                     Slot       = value.slot;
                     ArraySize  = value.arraySize;
+                    Flags      = (BindingFlags)value.flags;
                 }
             }
         }
@@ -2075,8 +2270,41 @@ namespace LLGL
 
     public class FrameProfile
     {
-        public ProfileCommandQueueRecord  CommandQueueRecord { get; set; }  = new ProfileCommandQueueRecord();
-        public ProfileCommandBufferRecord CommandBufferRecord { get; set; } = new ProfileCommandBufferRecord();
+        public ProfileCommandQueueRecord     CommandQueueRecord { get; set; }     = new ProfileCommandQueueRecord();
+        public ProfileCommandBufferRecord    CommandBufferRecord { get; set; }    = new ProfileCommandBufferRecord();
+        public ProfileTextureViewPoolRecord  TextureViewPoolRecord { get; set; }  = new ProfileTextureViewPoolRecord();
+        public ProfileRenderPassCacheRecord  RenderPassCacheRecord { get; set; }  = new ProfileRenderPassCacheRecord();
+        public ProfileGraphicsPipelineRecord GraphicsPipelineRecord { get; set; } = new ProfileGraphicsPipelineRecord();
+        public ProfileDeviceMemoryRecord     DeviceMemoryRecord { get; set; }     = new ProfileDeviceMemoryRecord();
+        private ProfileNativeCallRecord[] nativeCallRecords;
+        private NativeLLGL.ProfileNativeCallRecord[] nativeCallRecordsNative;
+        public ProfileNativeCallRecord[] NativeCallRecords
+        {
+            get
+            {
+                return nativeCallRecords;
+            }
+            set
+            {
+                if (value != null)
+                {
+                    nativeCallRecords = value;
+                    nativeCallRecordsNative = new NativeLLGL.ProfileNativeCallRecord[nativeCallRecords.Length];
+                    for (int nativeCallRecordsIndex = 0; nativeCallRecordsIndex < nativeCallRecords.Length; ++nativeCallRecordsIndex)
+                    {
+                        if (nativeCallRecords[nativeCallRecordsIndex] != null)
+                        {
+                            nativeCallRecordsNative[nativeCallRecordsIndex] = nativeCallRecords[nativeCallRecordsIndex].Native;
+                        }
+                    }
+                }
+                else
+                {
+                    nativeCallRecords = null;
+                    nativeCallRecordsNative = null;
+                }
+            }
+        }
         private ProfileTimeRecord[] timeRecords;
         private NativeLLGL.ProfileTimeRecord[] timeRecordsNative;
         public ProfileTimeRecord[] TimeRecords
@@ -2122,7 +2350,16 @@ namespace LLGL
                 {
                     CommandQueueRecord.Native= value.commandQueueRecord;
                     CommandBufferRecord.Native= value.commandBufferRecord;
-                    TimeRecords         = new ProfileTimeRecord[(int)value.numTimeRecords];
+                    TextureViewPoolRecord.Native= value.textureViewPoolRecord;
+                    RenderPassCacheRecord.Native= value.renderPassCacheRecord;
+                    GraphicsPipelineRecord.Native= value.graphicsPipelineRecord;
+                    DeviceMemoryRecord.Native= value.deviceMemoryRecord;
+                    NativeCallRecords      = new ProfileNativeCallRecord[(int)value.numNativeCallRecords];
+                    for (int i = 0; i < NativeCallRecords.Length; ++i)
+                    {
+                        NativeCallRecords[i] = new ProfileNativeCallRecord(value.nativeCallRecords[i]);
+                    }
+                    TimeRecords            = new ProfileTimeRecord[(int)value.numTimeRecords];
                     for (int i = 0; i < TimeRecords.Length; ++i)
                     {
                         TimeRecords[i] = new ProfileTimeRecord(value.timeRecords[i]);
@@ -2334,28 +2571,32 @@ namespace LLGL
     {
         public SwapChainDescriptor() { }
 
-        public SwapChainDescriptor(string debugName = null, Extent2D resolution = new Extent2D(), int colorBits = 32, int depthBits = 24, int stencilBits = 8, int samples = 1, int swapBuffers = 2, bool fullscreen = false, bool resizable = false)
-        {
-            DebugName   = debugName;
-            Resolution  = resolution;
-            ColorBits   = colorBits;
-            DepthBits   = depthBits;
-            StencilBits = stencilBits;
-            Samples     = samples;
-            SwapBuffers = swapBuffers;
-            Fullscreen  = fullscreen;
-            Resizable   = resizable;
-        }
-
-        public AnsiString DebugName { get; set; }   = null;
-        public Extent2D   Resolution { get; set; }  = new Extent2D();
-        public int        ColorBits { get; set; }   = 32;
-        public int        DepthBits { get; set; }   = 24;
-        public int        StencilBits { get; set; } = 8;
-        public int        Samples { get; set; }     = 1;
-        public int        SwapBuffers { get; set; } = 2;
-        public bool       Fullscreen { get; set; }  = false;
-        public bool       Resizable { get; set; }   = false;
+        public SwapChainDescriptor(string debugName = null, Extent2D resolution = new Extent2D(), int colorBits = 32, int depthBits = 24, int stencilBits = 8, int samples = 1, int swapBuffers = 2, bool fullscreen = false, bool resizable = false, int framesInFlight = 0, bool lowLatency = false)
+        {
+            DebugName      = debugName;
+            Resolution     = resolution;
+            ColorBits      = colorBits;
+            DepthBits      = depthBits;
+            StencilBits    = stencilBits;
+            Samples        = samples;
+            SwapBuffers    = swapBuffers;
+            Fullscreen     = fullscreen;
+            Resizable      = resizable;
+            FramesInFlight = framesInFlight;
+            LowLatency     = lowLatency;
+        }
+
+        public AnsiString DebugName { get; set; }      = null;
+        public Extent2D   Resolution { get; set; }     = new Extent2D();
+        public int        ColorBits { get; set; }      = 32;
+        public int        DepthBits { get; set; }      = 24;
+        public int        StencilBits { get; set; }    = 8;
+        public int        Samples { get; set; }        = 1;
+        public int        SwapBuffers { get; set; }    = 2;
+        public bool       Fullscreen { get; set; }     = false;
+        public bool       Resizable { get; set; }      = false;
+        public int        FramesInFlight { get; set; } = 0;
+        public bool       LowLatency { get; set; }     = false;
 
         internal NativeLLGL.SwapChainDescriptor Native
         {
@@ -2368,14 +2609,16 @@ namespace LLGL
                     {
                         native.debugName = debugNamePtr;
                     }
-                    native.resolution  = Resolution;
-                    native.colorBits   = ColorBits;
-                    native.depthBits   = DepthBits;
-                    native.stencilBits = StencilBits;
-                    native.samples     = Samples;
-                    native.swapBuffers = SwapBuffers;
-                    native.fullscreen  = Fullscreen;
-                    native.resizable   = Resizable;
+                    native.resolution     = Resolution;
+                    native.colorBits      = ColorBits;
+                    native.depthBits      = DepthBits;
+                    native.stencilBits    = StencilBits;
+                    native.samples        = Samples;
+                    native.swapBuffers    = SwapBuffers;
+                    native.fullscreen     = Fullscreen;
+                    native.resizable      = Resizable;
+                    native.framesInFlight = FramesInFlight;
+                    native.lowLatency     = LowLatency;
                 }
                 return native;
             }
@@ -3810,6 +4053,60 @@ namespace LLGL
             public int meshCommands;             /* = 0 */
         }
 
+        public unsafe struct ProfileTextureViewPoolRecord
+        {
+            public int textureViewCreations;  /* = 0 */
+            public int textureViewReuses;     /* = 0 */
+            public int textureViewEvictions;  /* = 0 */
+            public int numTextureViews;       /* = 0 */
+            public int numCachedTextureViews; /* = 0 */
+        }
+
+        public unsafe struct ProfileRenderPassCacheRecord
+        {
+            public int renderPassCreations;  /* = 0 */
+            public int renderPassReuses;     /* = 0 */
+            public int framebufferCreations; /* = 0 */
+            public int framebufferReuses;    /* = 0 */
+            public int framebufferEvictions; /* = 0 */
+            public int numRenderPasses;      /* = 0 */
+            public int numFramebuffers;      /* = 0 */
+        }
+
+        public unsafe struct ProfileGraphicsPipelineRecord
+        {
+            public int pipelineCreations; /* = 0 */
+            public int pipelineLinks;     /* = 0 */
+            public int libraryCreations;  /* = 0 */
+            public int libraryReuses;     /* = 0 */
+            public int numLibraries;      /* = 0 */
+            public int creationTime;      /* = 0 */
+        }
+
+        public unsafe struct ProfileDeviceMemoryRecord
+        {
+            public long numChunks;       /* = 0 */
+            public long numEmptyChunks;  /* = 0 */
+            public long numBlocks;       /* = 0 */
+            public long numFragments;    /* = 0 */
+            public long allocatedSize;   /* = 0 */
+            public long usedSize;        /* = 0 */
+            public long maxFragmentSize; /* = 0 */
+            public long budget;          /* = 0 */
+            public long usage;           /* = 0 */
+            public long chunkReleases;   /* = 0 */
+            public long relocations;     /* = 0 */
+            public long relocatedSize;   /* = 0 */
+        }
+
+        public unsafe struct ProfileNativeCallRecord
+        {
+            public byte* function;
+            public byte* command;
+            public int   calls;       /* = 0 */
+            public long  elapsedTime; /* = 0 */
+        }
+
         public unsafe struct RendererInfo
         {
             public byte*  rendererName;
@@ -3880,6 +4177,10 @@ namespace LLGL
             public bool hasPipelineStatistics;        /* = false */
             [MarshalAs(UnmanagedType.I1)]
             public bool hasRenderCondition;           /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasDescriptorIndexing;        /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasPlacedResources;           /* = false */
         }
 
         public unsafe struct RenderingLimits
@@ -3909,6 +4210,7 @@ namespace LLGL
             public int         maxStencilBufferSamples;          /* = 0 */
             public int         maxNoAttachmentSamples;           /* = 0 */
             public int         storageResourceStageFlags;        /* = 0 */
+            public int         maxDescriptorIndexingArraySize;   /* = 0 */
         }
 
         public unsafe struct ResourceHeapDescriptor
@@ -4007,6 +4309,7 @@ namespace LLGL
             public int          stageFlags; /* = 0 */
             public BindingSlot  slot;
             public int          arraySize;  /* = 0 */
+            public int          flags;      /* = 0 */
         }
 
         public unsafe struct UniformDescriptor
@@ -4098,10 +4401,16 @@ namespace LLGL
 
         public unsafe struct FrameProfile
         {
-            public ProfileCommandQueueRecord  commandQueueRecord;
-            public ProfileCommandBufferRecord commandBufferRecord;
-            public IntPtr                     numTimeRecords;
-            public ProfileTimeRecord*         timeRecords;
+            public ProfileCommandQueueRecord     commandQueueRecord;
+            public ProfileCommandBufferRecord    commandBufferRecord;
+            public ProfileTextureViewPoolRecord  textureViewPoolRecord;
+            public ProfileRenderPassCacheRecord  renderPassCacheRecord;
+            public ProfileGraphicsPipelineRecord graphicsPipelineRecord;
+            public ProfileDeviceMemoryRecord     deviceMemoryRecord;
+            public IntPtr                        numNativeCallRecords;
+            public ProfileNativeCallRecord*      nativeCallRecords;
+            public IntPtr                        numTimeRecords;
+            public ProfileTimeRecord*            timeRecords;
         }
 
         public unsafe struct AttachmentFormatDescriptor
@@ -4171,17 +4480,20 @@ namespace LLGL
 
         public unsafe struct SwapChainDescriptor
         {
-            public byte*    debugName;   /* = null */
+            public byte*    debugName;      /* = null */
             public Extent2D resolution;
-            public int      colorBits;   /* = 32 */
-            public int      depthBits;   /* = 24 */
-            public int      stencilBits; /* = 8 */
-            public int      samples;     /* = 1 */
-            public int      swapBuffers; /* = 2 */
+            public int      colorBits;      /* = 32 */
+            public int      depthBits;      /* = 24 */
+            public int      stencilBits;    /* = 8 */
+            public int      samples;        /* = 1 */
+            public int      swapBuffers;    /* = 2 */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool     fullscreen;     /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool     fullscreen;  /* = false */
+            public bool     resizable;      /* = false */
+            public int      framesInFlight; /* = 0 */
             [MarshalAs(UnmanagedType.I1)]
-            public bool     resizable;   /* = false */
+            public bool     lowLatency;     /* = false */
         }
 
         public unsafe struct TextureDescriptor
@@ -866,6 +866,11 @@ const (
     BarrierStorage        = (BarrierStorageBuffer | BarrierStorageTexture)
 )
 
+type BindingFlags int
+const (
+    BindingDescriptorIndexing = (1 << 0)
+)
+
 type ColorMaskFlags int
 const (
     ColorMaskZero = 0
@@ -1115,6 +1120,55 @@ type ProfileCommandBufferRecord struct {
     MeshCommands             uint32 /* = 0 */
 }
 
+type ProfileTextureViewPoolRecord struct {
+    TextureViewCreations  uint32 /* = 0 */
+    TextureViewReuses     uint32 /* = 0 */
+    TextureViewEvictions  uint32 /* = 0 */
+    NumTextureViews       uint32 /* = 0 */
+    NumCachedTextureViews uint32 /* = 0 */
+}
+
+type ProfileRenderPassCacheRecord struct {
+    RenderPassCreations  uint32 /* = 0 */
+    RenderPassReuses     uint32 /* = 0 */
+    FramebufferCreations uint32 /* = 0 */
+    FramebufferReuses    uint32 /* = 0 */
+    FramebufferEvictions uint32 /* = 0 */
+    NumRenderPasses      uint32 /* = 0 */
+    NumFramebuffers      uint32 /* = 0 */
+}
+
+type ProfileGraphicsPipelineRecord struct {
+    PipelineCreations uint32 /* = 0 */
+    PipelineLinks     uint32 /* = 0 */
+    LibraryCreations  uint32 /* = 0 */
+    LibraryReuses     uint32 /* = 0 */
+    NumLibraries      uint32 /* = 0 */
+    CreationTime      uint32 /* = 0 */
+}
+
+type ProfileDeviceMemoryRecord struct {
+    NumChunks       uint64 /* = 0 */
+    NumEmptyChunks  uint64 /* = 0 */
+    NumBlocks       uint64 /* = 0 */
+    NumFragments    uint64 /* = 0 */
+    AllocatedSize   uint64 /* = 0 */
+    UsedSize        uint64 /* = 0 */
+    MaxFragmentSize uint64 /* = 0 */
+    Budget          uint64 /* = 0 */
+    Usage           uint64 /* = 0 */
+    ChunkReleases   uint64 /* = 0 */
+    Relocations     uint64 /* = 0 */
+    RelocatedSize   uint64 /* = 0 */
+}
+
+type ProfileNativeCallRecord struct {
+    Function    string
+    Command     string
+    Calls       uint32 /* = 0 */
+    ElapsedTime uint64 /* = 0 */
+}
+
 type RendererInfo struct {
     RendererName        string
     DeviceName          string
@@ -1289,6 +1343,7 @@ type BindingDescriptor struct {
     StageFlags uint         /* = 0 */
     Slot       BindingSlot
     ArraySize  uint32       /* = 0 */
+    Flags      uint         /* = 0 */
 }
 
 type UniformDescriptor struct {
@@ -1359,9 +1414,14 @@ type QueryHeapDescriptor struct {
 }
 
 type FrameProfile struct {
-    CommandQueueRecord  ProfileCommandQueueRecord
-    CommandBufferRecord ProfileCommandBufferRecord
-    TimeRecords         []ProfileTimeRecord        /* = nil */
+    CommandQueueRecord     ProfileCommandQueueRecord
+    CommandBufferRecord    ProfileCommandBufferRecord
+    TextureViewPoolRecord  ProfileTextureViewPoolRecord
+    RenderPassCacheRecord  ProfileRenderPassCacheRecord
+    GraphicsPipelineRecord ProfileGraphicsPipelineRecord
+    DeviceMemoryRecord     ProfileDeviceMemoryRecord
+    NativeCallRecords      []ProfileNativeCallRecord     /* = nil */
+    TimeRecords            []ProfileTimeRecord           /* = nil */
 }
 
 type AttachmentFormatDescriptor struct {